@@ -27,7 +27,7 @@ void ReadAmigaHunkObject(ira_t *ira) {
     fseek(ira->files.sourceFile, 4, SEEK_SET);
     ReadSymbol(ira->files.sourceFile, 0, 0, ira->symbolName);
     if (ira->params.pFlags & SHOW_RELOCINFO)
-        printf("  Unit    : %s\n", ira->symbolName);
+        fprintf(ira->files.msgFile, "  Unit    : %s\n", ira->symbolName);
 
     while ((hunk = readbe32(ira->files.sourceFile))) { /* Type of hunk (Code,Data,...) */
 
@@ -145,7 +145,7 @@ void ReadAmigaHunkObject(ira_t *ira) {
     } /* Read next hunk and relocate. */
 
     if (ira->params.pFlags & SHOW_RELOCINFO)
-        printf("  Hunks : %d\n", (int) ira->hunkCount);
+        fprintf(ira->files.msgFile, "  Hunks : %d\n", (int) ira->hunkCount);
 
     /* Get memory according to the number of hunks found in object file */
     ira->hunksMemoryType = mycalloc(ira->hunkCount * sizeof(uint16_t));
@@ -171,13 +171,13 @@ void ReadAmigaHunkExecutable(ira_t *ira) {
 
     /* Skip (unused) resident library name */
     while (ReadSymbol(ira->files.sourceFile, 0, 0, ira->symbolName))
-        printf("  Unexpected resident library name in HUNK_HEADER : %s\n", ira->symbolName);
+        fprintf(ira->files.msgFile, "  Unexpected resident library name in HUNK_HEADER : %s\n", ira->symbolName);
 
     /* Read number of hunks */
     ira->hunkCount = readbe32(ira->files.sourceFile);
 
     if (ira->params.pFlags & SHOW_RELOCINFO)
-        printf("  Hunks : %d\n", (int) ira->hunkCount);
+        fprintf(ira->files.msgFile, "  Hunks : %d\n", (int) ira->hunkCount);
 
     /* Read first and last hunk numbers */
     ira->firstHunk = readbe32(ira->files.sourceFile);
@@ -216,6 +216,17 @@ void ReadAmigaHunkExecutable(ira_t *ira) {
     ExamineHunks(ira);
 }
 
+/*
+ * Points every hunk's content into the program buffer, at the hunk's offset.
+ * Has to be called again each time ira->buffer moves.
+ */
+static void MapHunksContent(ira_t *ira) {
+    uint32_t i;
+
+    for (i = 0; i < ira->hunkCount; i++)
+        ira->hunksContent[i] = (uint32_t *) ((uint8_t *) ira->buffer + (ira->hunksOffs[i] - ira->params.prgStart));
+}
+
 void ExamineHunks(ira_t *ira) {
     char hunkName[STDNAMELENGTH];
     uint8_t type;
@@ -232,11 +243,13 @@ void ExamineHunks(ira_t *ira) {
         ira->hunksSize[i] *= 4;
         ira->hunksOffs[i] = offs;
         offs += ira->hunksSize[i];
-
-        /* get memory for hunks */
-        ira->hunksContent[i] = mycalloc(ira->hunksSize[i]);
     }
 
+    /* All hunks are relocated in place into one contiguous program buffer */
+    ira->params.prgLen = offs - ira->params.prgStart;
+    ira->buffer = mycalloc(ira->params.prgLen + 4);
+    MapHunksContent(ira);
+
     /* read hunks and relocate */
     for (i = 0; i < ira->hunkCount;) {
         /* Hunk type (Code,Data,...) */
@@ -264,34 +277,40 @@ void ExamineHunks(ira_t *ira) {
 
                 /* optional overlay hunks */
                 if (i > ira->lastHunk) {
-                    printf("i > LastHunk\n");
+                    fprintf(ira->files.msgFile, "i > LastHunk\n");
                     /* calculate relocation offset */
                     ira->hunksSize[i] = hunkLen * 4;
                     ira->hunksOffs[i] = offs;
                     offs += ira->hunksSize[i];
-                    /* allocate memory for hunk */
-                    ira->hunksContent[i] = mycalloc(ira->hunksSize[i]);
+                    /* make room for hunk at the end of program buffer */
+                    ira->buffer = myrealloc(ira->buffer, offs - ira->params.prgStart + 4);
+                    memset((uint8_t *) ira->buffer + ira->params.prgLen, 0, offs - ira->params.prgStart + 4 - ira->params.prgLen);
+                    ira->params.prgLen = offs - ira->params.prgStart;
+                    MapHunksContent(ira);
                 }
 
+                if (hunk != HUNK_BSS && hunkLen * 4 > ira->hunksSize[i])
+                    ExitPrg("Hunk %d: length (%ld) exceeds size in header (%ld).", (int) i, (long) (hunkLen * 4), (long) ira->hunksSize[i]);
+
                 if (hunk != HUNK_BSS)                                                              /* for code and data only */
                     fread(ira->hunksContent[i], sizeof(uint32_t), hunkLen, ira->files.sourceFile); /* longwords in memory */
 
                 if (ira->params.pFlags & SHOW_RELOCINFO) {
-                    printf("\n    Module %d : %s ,%-8s", (int) i, modname[ira->hunksType[i] - HUNK_CODE], memtypename[ira->hunksMemoryType[i]]);
+                    fprintf(ira->files.msgFile, "\n    Module %d : %s ,%-8s", (int) i, modname[ira->hunksType[i] - HUNK_CODE], memtypename[ira->hunksMemoryType[i]]);
                     if (ira->hunksMemoryType[i] == 3)
-                        printf("($%lx)", (unsigned long) ira->hunksMemoryAttrs[i]);
+                        fprintf(ira->files.msgFile, "($%lx)", (unsigned long) ira->hunksMemoryAttrs[i]);
                     if (hunkName[0]) {
-                        printf(" ,Name='%s'", hunkName);
+                        fprintf(ira->files.msgFile, " ,Name='%s'", hunkName);
                         hunkName[0] = 0;
                     }
                     if (ira->hunksType[i] == HUNK_BSS)
-                        printf(" ,%ld Bytes.\n", (long) ira->hunksSize[i]);
+                        fprintf(ira->files.msgFile, " ,%ld Bytes.\n", (long) ira->hunksSize[i]);
                     else {
-                        printf(" ,%ld Bytes", (long) (hunkLen * 4));
+                        fprintf(ira->files.msgFile, " ,%ld Bytes", (long) (hunkLen * 4));
                         if (ira->hunksSize[i] - hunkLen * 4)
-                            printf(" (+ %ld BSS).\n", (long) (ira->hunksSize[i] - hunkLen * 4));
+                            fprintf(ira->files.msgFile, " (+ %ld BSS).\n", (long) (ira->hunksSize[i] - hunkLen * 4));
                         else
-                            printf(".\n");
+                            fprintf(ira->files.msgFile, ".\n");
                     }
                 }
                 break;
@@ -310,15 +329,15 @@ void ExamineHunks(ira_t *ira) {
                         fseek(ira->files.sourceFile, (relocnt + 1) * sizeof(uint32_t), SEEK_CUR);
                 } while (relocnt);
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("      Hunk_(D)Reloc16/8: %ld entries\n", (long) relocnt1);
+                    fprintf(ira->files.msgFile, "      Hunk_(D)Reloc16/8: %ld entries\n", (long) relocnt1);
                 break;
             case HUNK_DREL32:       /* V37+ */
             case HUNK_RELOC32SHORT: /* V39+ */
                 if (ira->params.pFlags & SHOW_RELOCINFO) {
                     if (hunk == HUNK_DREL32)
-                        printf("      Hunk_DRel32: ");
+                        fprintf(ira->files.msgFile, "      Hunk_DRel32: ");
                     if (hunk == HUNK_RELOC32SHORT)
-                        printf("      Hunk_Reloc32Short: ");
+                        fprintf(ira->files.msgFile, "      Hunk_Reloc32Short: ");
                 }
                 relocnt1 = 0;
                 do {
@@ -337,7 +356,8 @@ void ExamineHunks(ira_t *ira) {
                     if (relomod > ira->lastHunk)
                         ExitPrg("Relocation: Bad Hunk (%ld).", (long) relomod);
 
-                    /* execute relocation */
+                    /* execute relocation, the tables grow once for the whole group */
+                    ReserveRelocs(relocnt);
                     ira->RelocNumber = relocnt;
                     ira->DRelocBuffer = mycalloc(ira->RelocNumber * sizeof(uint16_t));
                     fread(ira->DRelocBuffer, sizeof(uint16_t), ira->RelocNumber, ira->files.sourceFile);
@@ -360,16 +380,16 @@ void ExamineHunks(ira_t *ira) {
                             InsertLabel(dummy);
                         }
                     }
-                    free(ira->DRelocBuffer);
+                    myfree(ira->DRelocBuffer);
                     ira->DRelocBuffer = 0;
                 } while (1);
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("%ld entries\n", (long) relocnt1);
+                    fprintf(ira->files.msgFile, "%ld entries\n", (long) relocnt1);
                 break;
             case HUNK_RELOC32:
                 if (ira->params.pFlags & SHOW_RELOCINFO) {
                     if (hunk == HUNK_RELOC32)
-                        printf("      Hunk_Reloc32: ");
+                        fprintf(ira->files.msgFile, "      Hunk_Reloc32: ");
                 }
                 relocnt1 = 0;
                 do {
@@ -388,7 +408,8 @@ void ExamineHunks(ira_t *ira) {
                     if (relomod > ira->lastHunk)
                         ExitPrg("Relocation: Bad Hunk (%d).", (int) relomod);
 
-                    /* execute relocation */
+                    /* execute relocation, the tables grow once for the whole group */
+                    ReserveRelocs(relocnt);
                     ira->RelocNumber = relocnt;
                     ira->RelocBuffer = mycalloc(ira->RelocNumber * 4);
                     fread(ira->RelocBuffer, sizeof(uint32_t), ira->RelocNumber, ira->files.sourceFile);
@@ -411,11 +432,11 @@ void ExamineHunks(ira_t *ira) {
                             InsertLabel(dummy);
                         }
                     }
-                    free(ira->RelocBuffer);
+                    myfree(ira->RelocBuffer);
                     ira->RelocBuffer = 0;
                 } while (1);
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("%ld entries\n", (long) relocnt1);
+                    fprintf(ira->files.msgFile, "%ld entries\n", (long) relocnt1);
                 break;
             case HUNK_OVERLAY:
                 fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
@@ -431,18 +452,18 @@ void ExamineHunks(ira_t *ira) {
                 } else
                     OVL_Size = OVL_Size / 8;
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("\n    Hunk_Overlay: %ld Level, %ld Entries\n", (long) OVL_Level, (long) OVL_Size);
+                    fprintf(ira->files.msgFile, "\n    Hunk_Overlay: %ld Level, %ld Entries\n", (long) OVL_Level, (long) OVL_Size);
                 while (OVL_Size--) {
                     fread(&OVL_Data, sizeof(uint32_t), 8, ira->files.sourceFile);
                     if (ira->params.pFlags & SHOW_RELOCINFO) {
-                        printf("      SeekOffset: $%08lx\n", (unsigned long) be32(&OVL_Data[0]));
-                        printf("      Dummy1    : %ld\n", (long) be32(&OVL_Data[1]));
-                        printf("      Dummy2    : %ld\n", (long) be32(&OVL_Data[2]));
-                        printf("      Level     : %ld\n", (long) be32(&OVL_Data[3]));
-                        printf("      Ordinate  : %ld\n", (long) be32(&OVL_Data[4]));
-                        printf("      FirstHunk : %ld\n", (long) be32(&OVL_Data[5]));
-                        printf("      SymbolHunk: %ld\n", (long) be32(&OVL_Data[6]));
-                        printf("      SymbolOffX: %08lx\n\n", (long) be32(&OVL_Data[7]));
+                        fprintf(ira->files.msgFile, "      SeekOffset: $%08lx\n", (unsigned long) be32(&OVL_Data[0]));
+                        fprintf(ira->files.msgFile, "      Dummy1    : %ld\n", (long) be32(&OVL_Data[1]));
+                        fprintf(ira->files.msgFile, "      Dummy2    : %ld\n", (long) be32(&OVL_Data[2]));
+                        fprintf(ira->files.msgFile, "      Level     : %ld\n", (long) be32(&OVL_Data[3]));
+                        fprintf(ira->files.msgFile, "      Ordinate  : %ld\n", (long) be32(&OVL_Data[4]));
+                        fprintf(ira->files.msgFile, "      FirstHunk : %ld\n", (long) be32(&OVL_Data[5]));
+                        fprintf(ira->files.msgFile, "      SymbolHunk: %ld\n", (long) be32(&OVL_Data[6]));
+                        fprintf(ira->files.msgFile, "      SymbolOffX: %08lx\n\n", (long) be32(&OVL_Data[7]));
                     }
                 }
                 break;
@@ -457,27 +478,27 @@ void ExamineHunks(ira_t *ira) {
                 break;
             case HUNK_DEBUG:
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("      hunk_debug (skipped).\n");
+                    fprintf(ira->files.msgFile, "      hunk_debug (skipped).\n");
                 fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                 fseek(ira->files.sourceFile, be32(BUF32) * sizeof(uint32_t), SEEK_CUR);
                 break;
             case HUNK_SYMBOL:
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("      hunk_symbol:\n");
+                    fprintf(ira->files.msgFile, "      hunk_symbol:\n");
                 while ((dummy = ReadSymbol(ira->files.sourceFile, &value, 0, ira->symbolName)))
                     if (value > ira->hunksSize[i])
-                        fprintf(stderr, "Symbol %s value $%08lx not in section limits.\n", ira->symbolName, (unsigned long) value);
+                        fprintf(ira->files.errFile, "Symbol %s value $%08lx not in section limits.\n", ira->symbolName, (unsigned long) value);
                     else {
                         value += (ira->hunksOffs[i]);
                         if (ira->params.pFlags & SHOW_RELOCINFO)
-                            printf("        %s = %08lx\n", ira->symbolName, (unsigned long) value);
+                            fprintf(ira->files.msgFile, "        %s = %08lx\n", ira->symbolName, (unsigned long) value);
                         InsertSymbol((char *)ira->symbolName, value);
                         InsertLabel(value);
                     }
                 break;
             case HUNK_EXT:
                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                    printf("      hunk_ext:\n");
+                    fprintf(ira->files.msgFile, "      hunk_ext:\n");
                 do {
                     dummy = ReadSymbol(ira->files.sourceFile, &value, &type, ira->symbolName);
                     if (dummy) {
@@ -485,106 +506,106 @@ void ExamineHunks(ira_t *ira) {
                             uint32_t ref;
                             case EXT_SYMB:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_symb:\n");
+                                    fprintf(ira->files.msgFile, "        ext_symb:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s = %08lx\n", ira->symbolName, (unsigned long) value);
+                                    fprintf(ira->files.msgFile, "          %s = %08lx\n", ira->symbolName, (unsigned long) value);
                                 break;
                             case EXT_DEF:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_def:\n");
+                                    fprintf(ira->files.msgFile, "        ext_def:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s = %08lx\n", ira->symbolName, (unsigned long) value);
+                                    fprintf(ira->files.msgFile, "          %s = %08lx\n", ira->symbolName, (unsigned long) value);
                                 break;
                             case EXT_ABS:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_abs:\n");
+                                    fprintf(ira->files.msgFile, "        ext_abs:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s = %08lx\n", ira->symbolName, (unsigned long) value);
+                                    fprintf(ira->files.msgFile, "          %s = %08lx\n", ira->symbolName, (unsigned long) value);
                                 break;
                             case EXT_RES:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_res:\n");
+                                    fprintf(ira->files.msgFile, "        ext_res:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s = %08lx\n", ira->symbolName, (unsigned long) value);
+                                    fprintf(ira->files.msgFile, "          %s = %08lx\n", ira->symbolName, (unsigned long) value);
                                 break;
                             case EXT_COMMON:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_common:\n");
+                                    fprintf(ira->files.msgFile, "        ext_common:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, Size=%ld\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, Size=%ld\n", ira->symbolName, (long) value);
                                 fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                 fseek(ira->files.sourceFile, be32(BUF32) * sizeof(uint32_t), SEEK_CUR);
                                 break;
                             case EXT_REF32:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_ref32:\n");
+                                    fprintf(ira->files.msgFile, "        ext_ref32:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_REF16:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_ref16:\n");
+                                    fprintf(ira->files.msgFile, "        ext_ref16:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_REF8:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_ref8:\n");
+                                    fprintf(ira->files.msgFile, "        ext_ref8:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_DEXT32:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_dext32:\n");
+                                    fprintf(ira->files.msgFile, "        ext_dext32:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_DEXT16:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_dext16:\n");
+                                    fprintf(ira->files.msgFile, "        ext_dext16:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_DEXT8:
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("        ext_dext8:\n");
+                                    fprintf(ira->files.msgFile, "        ext_dext8:\n");
                                 if (ira->params.pFlags & SHOW_RELOCINFO)
-                                    printf("          %s, %ld reference(s)\n", ira->symbolName, (long) value);
+                                    fprintf(ira->files.msgFile, "          %s, %ld reference(s)\n", ira->symbolName, (long) value);
                                 while (value--) {
                                     fread(BUF32, sizeof(uint32_t), 1, ira->files.sourceFile);
                                     ref = be32(BUF32);
                                     if (ira->params.pFlags & SHOW_RELOCINFO)
-                                        printf("          %08lx\n", (unsigned long) ref);
+                                        fprintf(ira->files.msgFile, "          %08lx\n", (unsigned long) ref);
                                 }
                                 break;
                             case EXT_RELREF32:
@@ -617,14 +638,15 @@ void ExamineHunks(ira_t *ira) {
         } /* End of switch() */
 
     } /* read next hunk */
-    printf("\n");
+    fprintf(ira->files.msgFile, "\n");
 
-    /* write data to file and release memory */
-    for (i = 0; i < ira->hunkCount; i++) {
-        fwrite(ira->hunksContent[i], 1, ira->hunksSize[i], ira->files.binaryFile);
-        free(ira->hunksContent[i]);
-    }
-    free(ira->hunksContent);
+    /* Relocated program only goes to a file when asked for (-KEEPBIN) */
+    if (ira->files.binaryFile)
+        if (fwrite(ira->buffer, 1, ira->params.prgLen, ira->files.binaryFile) != ira->params.prgLen)
+            ExitPrg("Can't write binary file \"%s\".", ira->filenames.binaryName);
+
+    /* hunks contents are only pointers into ira->buffer */
+    myfree(ira->hunksContent);
     ira->hunksContent = 0;
 }
 
@@ -0,0 +1,97 @@
+#!/bin/sh
+#
+# bench.sh
+#
+#  Created on: 17 october 2026
+#      Project  : IRA  -  680x0 Interactive ReAssembler
+#      Part     : bench/bench.sh
+#      Purpose  : "make bench", IRA throughput over a synthetic corpus
+#
+# Usage: bench.sh <ira> <mkcorpus> [runs]
+#
+# Every source of the corpus is reassembled as it is, with -PREPROC and
+# with -CONFIG, runs times (3 by default). The fastest run is reported in
+# MB of source per second for each phase -STATS times, and as a whole.
+# The corpus is made with fixed seeds, so two IRA builds can be compared
+# by running this with each of them.
+# -PREPROC must find the code of the corpus from the entry on: Pass 0 has
+# to decode an instruction in at most 6 bytes of the CODE areas of the
+# generated config file, else the sources are of no use and this fails.
+
+IRA=$1
+MKCORPUS=$2
+RUNS=${3:-3}
+
+if [ ! -x "$IRA" ] || [ ! -x "$MKCORPUS" ]; then
+    echo "Usage: bench.sh <ira> <mkcorpus> [runs]" >&2
+    exit 1
+fi
+case $IRA in /*) ;; *) IRA=$(pwd)/$IRA ;; esac
+case $MKCORPUS in /*) ;; *) MKCORPUS=$(pwd)/$MKCORPUS ;; esac
+
+DIR=$(mktemp -d "${TMPDIR:-/tmp}/irabench.XXXXXX") || exit 1
+trap 'rm -rf "$DIR"' EXIT INT TERM
+cd "$DIR" || exit 1
+
+# name, then the mkcorpus options. -PREPROC writes a config file of its
+# own, so the generated one is kept aside.
+corpus() {
+    name=$1
+    shift
+    "$MKCORPUS" "$@" -cnf "$name.gen" "$name" || exit 1
+}
+corpus small    -seed 1 -hunks 3 -size 65536
+corpus hunks    -seed 2 -hunks 24 -size 16384 -bss 65536
+corpus relocs   -seed 3 -hunks 3 -size 262144 -relocs 20 -jmptabs 4
+corpus strings  -seed 4 -hunks 3 -size 262144 -strings 15 -bss 262144
+corpus large    -seed 5 -hunks 6 -size 1048576 -symbols
+corpus binary   -seed 6 -binary -size 524288
+corpus binlarge -seed 7 -binary -size 2097152 -relocs 10
+
+status=0
+printf "%-9s %-9s %8s %8s %8s %8s %8s %8s %8s %8s %10s\n" source mode load romtag pass0 pass1 labels text render total "total ms"
+for source in small hunks relocs strings large binary binlarge; do
+    case $source in bin*) type=-BINARY ;; *) type= ;; esac
+    for mode in plain -PREPROC -CONFIG; do
+        [ $mode = plain ] && option= || option=$mode
+        run=0
+        while [ $run -lt "$RUNS" ]; do
+            rm -f "$source.cnf"
+            [ $mode = -CONFIG ] && cp "$source.gen" "$source.cnf"
+            "$IRA" $type $option -STATS "$source" "$source.asm" 2>/dev/null | sed -n '/^STATS  :/,$p' >"stats.$run"
+            [ -s "stats.$run" ] || echo "$source $mode: IRA failed" >&2
+            run=$((run + 1))
+        done
+        if [ $mode = -PREPROC ]; then
+            code=0
+            while read -r keyword from dash to; do
+                [ "$keyword" = CODE ] && code=$((code + 0x${to#\$} - 0x${from#\$}))
+            done <"$source.gen"
+            pass0=$(awk '$1 == "pass0" { print $4 }' stats.0)
+            if [ $((${pass0:-0} * 6)) -lt $code ]; then
+                echo "$source: Pass 0 decodes ${pass0:-0} instructions in $code bytes of code" >&2
+                status=1
+            fi
+        fi
+        # the fastest run, in MB/s
+        cat stats.* | awk -v source="$source" -v mode="$mode" -v size="$(wc -c <"$source")" '
+            /^STATS  :/ { run++ }
+            $1 ~ /^(load|romtag|pass0|pass1|labels|text|render|total)$/ { ms[run, $1] = $2 }
+            END {
+                split("load romtag pass0 pass1 labels text render total", phase, " ")
+                best = 1
+                for (r = 2; r <= run; r++)
+                    if (ms[r, "total"] < ms[best, "total"])
+                        best = r
+                printf "%-9s %-9s", source, mode
+                for (p = 1; p <= 8; p++)
+                    if (ms[best, phase[p]] > 0)
+                        printf " %8.1f", size / 1000 / ms[best, phase[p]]
+                    else
+                        printf " %8s", "-"
+                printf " %10.1f\n", ms[best, "total"]
+            }'
+        rm -f stats.*
+    done
+done
+exit $status
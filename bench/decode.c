@@ -0,0 +1,211 @@
+/*
+ * decode.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : bench/decode.c
+ *      Purpose  : "make decodebench", decoder throughput and checksums
+ *
+ * Every first word 0000-FFFF is followed by five extension words, taken
+ * from one of four sets by the low bits of the first word. Each set only
+ * holds words that are one-word instructions themselves (NOP, MOVEQ,
+ * ADD.L D0,(A0) and a mix), so whatever an instruction leaves over
+ * decodes on its own and every first word starts an instruction. The
+ * binary is reassembled through libira for every CPU, FPU and MMU choice
+ * CheckCPU() accepts. Pass 1 (GetOpCode(), DoSpecific(), operands for
+ * labels) and Pass 2 (the same, written as text) are timed with -STATS,
+ * and the target is hashed without its IRA version line.
+ *
+ * Usage: decode [-runs n] [-sums] [-check file]
+ *     -runs n     fastest of n runs (3)
+ *     -sums       print only the checksums, one run
+ *     -check file fail unless the checksums are those of file (from -sums)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../libira.h"
+
+#define SOURCE "decode.bin"
+#define TARGET "decode.asm"
+#define EXTENSION_WORDS 5
+
+static const uint16_t extensionWords[4][EXTENSION_WORDS] = {
+    {0x4E71, 0x4E71, 0x4E71, 0x4E71, 0x4E71}, /* NOP: brief format, D4.L*8 */
+    {0x7E10, 0x7E10, 0x7E10, 0x7E10, 0x7E10}, /* MOVEQ: brief format, D7.L*8 */
+    {0xD190, 0xD190, 0xD190, 0xD190, 0xD190}, /* ADD.L D0,(A0): full format, no base, no index */
+    {0x2200, 0x4E71, 0xD190, 0x7E10, 0x4E75}  /* MOVE.L D0,D1 ... RTS */
+};
+
+static const char *cpus[] = {"-M68000", "-M68010", "-M68020", "-M68030", "-M68040", "-M68060"};
+static const char *fpus[] = {NULL, "-M68881", "-M68882"};
+static const char *mmus[] = {NULL, "-M68851"};
+
+typedef struct Phase_s {
+    double ms;
+    unsigned long long instructions;
+} Phase_t;
+
+static int WriteSource(void) {
+    FILE *file;
+    uint32_t word, i;
+
+    if (!(file = fopen(SOURCE, "wb")))
+        return 0;
+    for (word = 0; word < 0x10000; word++) {
+        putc(word >> 8, file);
+        putc(word & 0xFF, file);
+        for (i = 0; i < EXTENSION_WORDS; i++) {
+            putc(extensionWords[word & 3][i] >> 8, file);
+            putc(extensionWords[word & 3][i] & 0xFF, file);
+        }
+    }
+    return !fclose(file);
+}
+
+/* FNV-1a of the target after the comment lines at its start */
+static uint64_t HashTarget(void) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    FILE *file;
+    int c, header = 1, start = 1;
+
+    if (!(file = fopen(TARGET, "rb")))
+        return 0;
+    while ((c = getc(file)) != EOF) {
+        if (start)
+            header &= c == ';' || c == '\n';
+        start = c == '\n';
+        if (!header) {
+            hash ^= (uint8_t) c;
+            hash *= 0x100000001b3ULL;
+        }
+    }
+    fclose(file);
+    return hash;
+}
+
+/* Wall time and instructions of a phase in the -STATS=JSON line */
+static int GetPhase(const char *json, const char *name, Phase_t *phase) {
+    char key[32];
+    const char *p;
+
+    sprintf(key, "\"%s\": {", name);
+    if (!(p = strstr(json, key)))
+        return 0;
+    return sscanf(p + strlen(key), "\"wall_ms\": %lf, \"cpu_ms\": %*f, \"instructions\": %llu", &phase->ms, &phase->instructions) == 2;
+}
+
+/* One run, 0 if it failed */
+static int Run(ira_t *options, FILE *stats, Phase_t *pass1, Phase_t *pass2, char *error, size_t size) {
+    char json[2048];
+
+    rewind(stats);
+    if (IraDisassemble(options, SOURCE, TARGET, error, size))
+        return 0;
+    fflush(stats);
+    rewind(stats);
+    json[0] = 0;
+    while (fgets(json, sizeof(json), stats) && json[0] != '{')
+        ;
+    if (!GetPhase(json, "pass1", pass1) || !GetPhase(json, "render", pass2)) {
+        snprintf(error, size, "No -STATS output.");
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    char *args[5], name[32], error[256], line[64], expected[64];
+    Phase_t pass1, pass2, best1, best2;
+    FILE *stats, *check = NULL;
+    ira_t *options;
+    uint64_t hash;
+    int runs = 3, sums = 0, failed = 0, accepted = 0, count, run, cpu, fpu, mmu, i;
+
+    for (i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-runs") && i + 1 < argc)
+            runs = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-sums"))
+            sums = 1;
+        else if (!strcmp(argv[i], "-check") && i + 1 < argc) {
+            if (!(check = fopen(argv[++i], "r"))) {
+                fprintf(stderr, "Can't open \"%s\".\n", argv[i]);
+                return (EXIT_FAILURE);
+            }
+        } else {
+            fprintf(stderr, "Usage: decode [-runs n] [-sums] [-check file]\n");
+            return (EXIT_FAILURE);
+        }
+    }
+    if (sums || runs < 1)
+        runs = 1;
+
+    if (!WriteSource() || !(stats = tmpfile())) {
+        fprintf(stderr, "Can't write \"%s\".\n", SOURCE);
+        return (EXIT_FAILURE);
+    }
+
+    if (!sums)
+        printf("%-22s %14s %14s  %s\n", "CPU", "Pass 1 dec/s", "Pass 2 dec/s", "checksum");
+    for (cpu = 0; cpu < 6; cpu++)
+        for (fpu = 0; fpu < 3; fpu++)
+            for (mmu = 0; mmu < 2; mmu++) {
+                count = 0;
+                args[count++] = "-BINARY";
+                args[count++] = "-STATS=JSON";
+                args[count++] = (char *) cpus[cpu];
+                if (fpus[fpu])
+                    args[count++] = (char *) fpus[fpu];
+                if (mmus[mmu])
+                    args[count++] = (char *) mmus[mmu];
+                sprintf(name, "%s%s%s%s%s", cpus[cpu] + 1, fpus[fpu] ? "/" : "", fpus[fpu] ? fpus[fpu] + 1 : "", mmus[mmu] ? "/" : "",
+                        mmus[mmu] ? mmus[mmu] + 1 : "");
+
+                /* not a combination CheckCPU() accepts */
+                if (!(options = IraNew(count, args, error, sizeof(error))))
+                    continue;
+                accepted++;
+                IraSetOutput(options, stats, stats);
+
+                for (run = 0; run < runs; run++) {
+                    if (!Run(options, stats, &pass1, &pass2, error, sizeof(error))) {
+                        fprintf(stderr, "%s: %s\n", name, error);
+                        return (EXIT_FAILURE);
+                    }
+                    if (!run || pass1.ms < best1.ms)
+                        best1 = pass1;
+                    if (!run || pass2.ms < best2.ms)
+                        best2 = pass2;
+                }
+                IraFree(options);
+                hash = HashTarget();
+
+                if (sums)
+                    printf("%s\t%08lx%08lx\n", name, (unsigned long) (hash >> 32), (unsigned long) (hash & 0xffffffffUL));
+                else
+                    printf("%-22s %14.0f %14.0f  %08lx%08lx\n", name, best1.instructions / best1.ms * 1000, best2.instructions / best2.ms * 1000,
+                           (unsigned long) (hash >> 32), (unsigned long) (hash & 0xffffffffUL));
+
+                if (check) {
+                    sprintf(line, "%s\t%08lx%08lx\n", name, (unsigned long) (hash >> 32), (unsigned long) (hash & 0xffffffffUL));
+                    if (!fgets(expected, sizeof(expected), check) || strcmp(expected, line)) {
+                        fprintf(stderr, "Checksum mismatch: %s", line);
+                        failed = 1;
+                    }
+                }
+            }
+
+    if (!accepted) {
+        fprintf(stderr, "%s\n", error);
+        failed = 1;
+    }
+    if (check)
+        fclose(check);
+    fclose(stats);
+    remove(SOURCE);
+    remove(TARGET);
+    return (failed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
@@ -0,0 +1,643 @@
+/*
+ * mkcorpus.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : bench/mkcorpus.c
+ *      Purpose  : Synthetic m68k sources for "make bench"
+ *
+ * Writes an Amiga hunk executable, a hunk object or a raw binary (for
+ * -BINARY) filled with plausible 68000 code: functions, each calling the
+ * next ones, so that all are reached from the entry, relocated pointers,
+ * jump tables, strings embedded in code, data hunks, a BSS hunk, symbols
+ * and, in objects, external definitions and references. With -cnf it also
+ * writes a config file with CODE, PTRS, TEXT, JMPW, EQU, LABEL, COMMENT
+ * and BANNER directives for that source. The same seed gives the same
+ * file, with or without -cnf.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HUNK_UNIT 0x3E7
+#define HUNK_NAME 0x3E8
+#define HUNK_CODE 0x3E9
+#define HUNK_DATA 0x3EA
+#define HUNK_BSS 0x3EB
+#define HUNK_RELOC32 0x3EC
+#define HUNK_EXT 0x3EF
+#define HUNK_SYMBOL 0x3F0
+#define HUNK_END 0x3F2
+#define HUNK_HEADER 0x3F3
+#define EXT_DEF 1
+#define EXT_REF32 129
+
+#define EXTERNALS 4 /* names referenced by an object */
+#define EQU_EVERY 8 /* EQU directive at every 8th immediate */
+
+typedef struct Hunk_s {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t len;
+    uint32_t type;
+    uint32_t base; /* address of the hunk in a raw binary and the config file */
+    uint32_t *relocOff;
+    uint32_t *relocHunk;
+    uint32_t relocCount;
+    uint32_t relocMax;
+    uint32_t *refOff; /* external references of an object */
+    uint32_t *refName;
+    uint32_t refCount;
+    uint32_t refMax;
+    uint32_t *starts; /* offsets of the instructions */
+    uint32_t startCount;
+    uint32_t startMax;
+} Hunk_t;
+
+typedef struct Call_s {
+    uint32_t offset; /* of the displacement or address */
+    uint32_t func;   /* number of the function called in this hunk */
+    int absolute;    /* JSR abs.l, else BSR.W */
+} Call_t;
+
+static uint64_t seed = 0x9E3779B97F4A7C15ULL;
+static Hunk_t *hunks;
+static uint32_t hunkCount = 3;
+static uint32_t immediates;
+static FILE *config;
+static Call_t *calls; /* of functions not made yet */
+static uint32_t callCount;
+static uint32_t callMax;
+
+static void *Alloc(void *ptr, size_t size) {
+    if (!(ptr = realloc(ptr, size))) {
+        fprintf(stderr, "Out of memory.\n");
+        exit(EXIT_FAILURE);
+    }
+    return (ptr);
+}
+
+/* xorshift64, 0 .. n-1 */
+static uint32_t Random(uint32_t n) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    return (n ? (uint32_t) (seed % n) : 0);
+}
+
+static void Put16(Hunk_t *hunk, uint32_t value) {
+    hunk->data[hunk->len++] = (uint8_t) (value >> 8);
+    hunk->data[hunk->len++] = (uint8_t) value;
+}
+
+static void Put32(Hunk_t *hunk, uint32_t value) {
+    Put16(hunk, value >> 16);
+    Put16(hunk, value & 0xFFFF);
+}
+
+static void AddReloc(Hunk_t *hunk, uint32_t offset, uint32_t target) {
+    if (hunk->relocCount == hunk->relocMax) {
+        hunk->relocMax = hunk->relocMax ? hunk->relocMax * 2 : 64;
+        hunk->relocOff = Alloc(hunk->relocOff, hunk->relocMax * sizeof(uint32_t));
+        hunk->relocHunk = Alloc(hunk->relocHunk, hunk->relocMax * sizeof(uint32_t));
+    }
+    hunk->relocOff[hunk->relocCount] = offset;
+    hunk->relocHunk[hunk->relocCount++] = target;
+}
+
+static void AddRef(Hunk_t *hunk, uint32_t offset, uint32_t name) {
+    if (hunk->refCount == hunk->refMax) {
+        hunk->refMax = hunk->refMax ? hunk->refMax * 2 : 64;
+        hunk->refOff = Alloc(hunk->refOff, hunk->refMax * sizeof(uint32_t));
+        hunk->refName = Alloc(hunk->refName, hunk->refMax * sizeof(uint32_t));
+    }
+    hunk->refOff[hunk->refCount] = offset;
+    hunk->refName[hunk->refCount++] = name;
+}
+
+static void AddStart(Hunk_t *hunk) {
+    if (hunk->startCount == hunk->startMax) {
+        hunk->startMax = hunk->startMax ? hunk->startMax * 2 : 256;
+        hunk->starts = Alloc(hunk->starts, hunk->startMax * sizeof(uint32_t));
+    }
+    hunk->starts[hunk->startCount++] = hunk->len;
+}
+
+/* 32-bit address of offset in hunk, relocated unless raw */
+static void PutAddress(Hunk_t *hunk, uint32_t target, uint32_t offset, int raw) {
+    if (raw)
+        Put32(hunk, hunks[target].base + offset);
+    else {
+        AddReloc(hunk, hunk->len, target);
+        Put32(hunk, offset);
+    }
+}
+
+/* 32-bit pointer into a random hunk */
+static void PutPointer(Hunk_t *hunk, int raw) {
+    uint32_t target = Random(hunkCount);
+    uint32_t offset = hunks[target].size ? Random(hunks[target].size / 2) * 2 : 0;
+
+    if (hunks[target].type == HUNK_CODE && hunks[target].startCount && Random(2))
+        offset = hunks[target].starts[Random(hunks[target].startCount)];
+    PutAddress(hunk, target, offset, raw);
+}
+
+static void PutString(Hunk_t *hunk, uint32_t room) {
+    static const char *words[] = {"dos.library", "intuition.library", "graphics.library", "Error: ", "Ready.",
+                                  "Out of memory", "%s: %ld\n", "CON:0/0/640/200/Output", "topaz.font", "Workbench"};
+    const char *word = words[Random(sizeof(words) / sizeof(words[0]))];
+    uint32_t len = strlen(word);
+
+    if (len + 2 > room)
+        return;
+    memcpy(hunk->data + hunk->len, word, len);
+    hunk->len += len;
+    hunk->data[hunk->len++] = 0;
+    if (hunk->len & 1)
+        hunk->data[hunk->len++] = 0;
+}
+
+/* ADD.W D0,D0 ; MOVE.W 6(PC,D0.W),D0 ; JMP 2(PC,D0.W) ; table ; cases */
+static int PutJumpTable(Hunk_t *hunk) {
+    uint32_t table, count = 3 + Random(6), i;
+
+    if (hunk->len + 10 + count * 6 + 8 >= hunk->size)
+        return 0;
+    Put16(hunk, 0xD040);
+    Put16(hunk, 0x303B);
+    Put16(hunk, 0x0006);
+    Put16(hunk, 0x4EFB);
+    Put16(hunk, 0x0002);
+    table = hunk->len;
+    for (i = 0; i < count; i++)
+        Put16(hunk, (count * 2 + i * 4) & 0xFFFF);
+    for (i = 0; i < count; i++) {
+        AddStart(hunk);
+        Put16(hunk, 0x7000 | (i & 0xFF));
+        Put16(hunk, 0x4E75);
+    }
+    if (config)
+        fprintf(config, "JMPW\t$%08lx - $%08lx\n", (unsigned long) (hunk->base + table),
+                (unsigned long) (hunk->base + table + count * 2));
+    return 1;
+}
+
+/* BRA.S over a string */
+static void PutCodeString(Hunk_t *hunk) {
+    uint32_t at = hunk->len, len;
+
+    Put16(hunk, 0x6000);
+    PutString(hunk, hunk->size - hunk->len - 16);
+    len = hunk->len - at - 2;
+    if (!len || len > 126) {
+        hunk->len = at;
+        Put16(hunk, 0x4E71);
+    } else
+        hunk->data[at + 1] = (uint8_t) len;
+}
+
+/* EQU directive for an immediate value at adr */
+static void PutEquate(Hunk_t *hunk, const char *name, uint32_t adr, char size) {
+    if (config && !(immediates++ % EQU_EVERY))
+        fprintf(config, "EQU\t%s_%lu\t$%08lx.%c\n", name, (unsigned long) immediates, (unsigned long) (hunk->base + adr), size);
+}
+
+/* Straight-line instructions, the control flow is left to MakeFunction() */
+static void PutInstruction(Hunk_t *hunk) {
+    uint32_t d = Random(8), s = Random(8);
+
+    switch (Random(10)) {
+        case 0: /* MOVEQ */
+            Put16(hunk, 0x7000 | d << 9 | Random(256));
+            break;
+        case 1: /* MOVE.L Ds,Dd */
+            Put16(hunk, 0x2000 | d << 9 | s);
+            break;
+        case 2: /* MOVE.L d16(A5),Dd */
+            Put16(hunk, 0x2000 | d << 9 | 5 << 3 | 5);
+            Put16(hunk, Random(0x4000) * 2);
+            break;
+        case 3: /* JSR -LVO(A6) */
+            Put16(hunk, 0x4EAE);
+            Put16(hunk, (0x10000 - 6 * (5 + Random(150))) & 0xFFFF);
+            break;
+        case 4: /* CMP.L #imm,Dd */
+            Put16(hunk, 0xB0BC | d << 9);
+            PutEquate(hunk, "value", hunk->len, 'L');
+            Put32(hunk, Random(0x10000));
+            break;
+        case 5: /* ADDQ.L */
+            PutEquate(hunk, "quick", hunk->len, 'Q');
+            Put16(hunk, 0x5088 | (1 + Random(7)) << 9 | s);
+            break;
+        case 6: /* LEA d16(PC),An */
+            Put16(hunk, 0x41FA | (d & 6) << 9);
+            Put16(hunk, (0x10000 - 2 * Random(hunk->len / 2 + 1)) & 0xFFFF);
+            break;
+        case 7: /* MOVE.W d16(A5),d16(A5) */
+            Put16(hunk, 0x3000 | 5 << 9 | 5 << 6 | 5 << 3 | 5);
+            Put16(hunk, Random(0x8000));
+            Put16(hunk, Random(0x8000));
+            break;
+        case 8: /* ADD.L */
+            Put16(hunk, 0xD080 | d << 9 | s);
+            break;
+        default: /* CMPI.L */
+            Put16(hunk, 0x0C80 | d);
+            Put32(hunk, Random(0x100));
+            break;
+    }
+}
+
+/* BSR.W or JSR abs.l to function func of this hunk, which is not made yet */
+static void PutCall(Hunk_t *hunk, uint32_t func, int absolute) {
+    if (callCount == callMax) {
+        callMax = callMax ? callMax * 2 : 64;
+        calls = Alloc(calls, callMax * sizeof(Call_t));
+    }
+    Put16(hunk, absolute ? 0x4EB9 : 0x6100);
+    calls[callCount].offset = hunk->len;
+    calls[callCount].func = func;
+    calls[callCount++].absolute = absolute;
+    Put16(hunk, 0);
+    if (absolute)
+        Put16(hunk, 0);
+}
+
+/* The calls of functions up to func go to the current offset */
+static void ResolveCalls(Hunk_t *hunk, uint32_t func, int raw) {
+    uint32_t len = hunk->len, i, k;
+
+    for (i = k = 0; i < callCount; i++) {
+        if (calls[i].func > func) {
+            calls[k++] = calls[i];
+            continue;
+        }
+        hunk->len = calls[i].offset;
+        if (calls[i].absolute)
+            PutAddress(hunk, (uint32_t) (hunk - hunks), len, raw);
+        else
+            Put16(hunk, (len - calls[i].offset) & 0xFFFF);
+    }
+    callCount = k;
+    hunk->len = len;
+}
+
+/* MOVEM or LINK, instructions with local branches and calls to the next
+ * functions, then RTS, or a jump table. Every function calls the next one,
+ * so that the code is reached from the entry. */
+static void MakeFunction(Hunk_t *hunk, uint32_t func, int raw, int object, uint32_t relocs, uint32_t jumpTables, uint32_t strings) {
+    uint32_t first = hunk->startCount, count = 4 + Random(40), frame = Random(3), d;
+
+    ResolveCalls(hunk, func, raw);
+    AddStart(hunk);
+    if (frame == 1) { /* MOVEM.L regs,-(A7) */
+        Put16(hunk, 0x48E7);
+        Put16(hunk, 0x3F3E);
+    } else if (frame == 2) { /* LINK */
+        Put16(hunk, 0x4E55);
+        Put16(hunk, (0x10000 - 4 * (1 + Random(64))) & 0xFFFF);
+    }
+    AddStart(hunk);
+    PutCall(hunk, func + 1, 0);
+
+    while (count-- && hunk->len + 64 < hunk->size) {
+        AddStart(hunk);
+        d = Random(8);
+        if (Random(100) < relocs) {
+            switch (Random(3)) {
+                case 0: /* LEA abs.l,An */
+                    Put16(hunk, 0x41F9 | (d & 6) << 9);
+                    PutPointer(hunk, raw);
+                    break;
+                case 1: /* JSR abs.l, an external in objects */
+                    if (object) {
+                        Put16(hunk, 0x4EB9);
+                        AddRef(hunk, hunk->len, Random(EXTERNALS));
+                        Put32(hunk, 0);
+                    } else
+                        PutCall(hunk, func + 1 + Random(3), 1);
+                    break;
+                default: /* MOVE.L #abs,-(A7) */
+                    Put16(hunk, 0x2F3C);
+                    PutPointer(hunk, raw);
+                    break;
+            }
+        } else if (jumpTables && Random(400) < jumpTables && PutJumpTable(hunk))
+            return;
+        else if (strings && Random(100) < strings)
+            PutCodeString(hunk);
+        else
+            switch (Random(6)) {
+                case 0: /* BSR.W */
+                    PutCall(hunk, func + 1 + Random(3), 0);
+                    break;
+                case 1: /* BNE.S back in this function */
+                    if (hunk->startCount - first > 4 && hunk->len + 2 - hunk->starts[hunk->startCount - 4] < 120) {
+                        Put16(hunk, 0x6600 | (0x100 - (hunk->len + 2 - hunk->starts[hunk->startCount - 2 - Random(3)])));
+                        break;
+                    }
+                    Put16(hunk, 0x4A80 | d);
+                    break;
+                case 2: /* DBF back in this function */
+                    if (hunk->startCount - first > 2) {
+                        Put16(hunk, 0x51C8 | d);
+                        Put16(hunk, (hunk->starts[hunk->startCount - 2] - hunk->len) & 0xFFFF);
+                        break;
+                    }
+                    /* fall through */
+                default:
+                    PutInstruction(hunk);
+                    break;
+            }
+    }
+
+    AddStart(hunk);
+    if (frame == 1) { /* MOVEM.L (A7)+,regs */
+        Put16(hunk, 0x4CDF);
+        Put16(hunk, 0x7CFC);
+        AddStart(hunk);
+    } else if (frame == 2) { /* UNLK */
+        Put16(hunk, 0x4E5D);
+        AddStart(hunk);
+    }
+    Put16(hunk, 0x4E75);
+}
+
+/* Functions, the last one takes the calls left and goes on to the code hunk next */
+static void MakeCode(Hunk_t *hunk, uint32_t next, int raw, int object, uint32_t relocs, uint32_t jumpTables, uint32_t strings) {
+    uint32_t func = 0;
+
+    callCount = 0;
+    while (hunk->len + 128 < hunk->size)
+        MakeFunction(hunk, func++, raw, object, relocs, jumpTables, strings);
+    ResolveCalls(hunk, UINT32_MAX, raw);
+    AddStart(hunk);
+    if (next < hunkCount) { /* JSR abs.l */
+        Put16(hunk, 0x4EB9);
+        PutAddress(hunk, next, 0, raw);
+        AddStart(hunk);
+    }
+    while (hunk->len + 2 < hunk->size)
+        Put16(hunk, 0x4E71);
+    Put16(hunk, 0x4E75);
+}
+
+static void MakeData(Hunk_t *hunk, int raw, uint32_t relocs, uint32_t strings) {
+    uint32_t r, at;
+
+    while (hunk->len + 40 < hunk->size) {
+        r = Random(100);
+        if (r < relocs) {
+            if (raw && config)
+                fprintf(config, "PTRS\t$%08lx\n", (unsigned long) (hunk->base + hunk->len));
+            PutPointer(hunk, raw);
+        } else if (r < relocs + strings) {
+            at = hunk->len;
+            PutString(hunk, hunk->size - hunk->len);
+            if (config && hunk->len > at)
+                fprintf(config, "TEXT\t$%08lx - $%08lx\n", (unsigned long) (hunk->base + at), (unsigned long) (hunk->base + hunk->len));
+        } else
+            Put32(hunk, Random(0x7FFFFFFF));
+    }
+    hunk->len = hunk->size;
+}
+
+/* Some LABEL, COMMENT and BANNER directives at instruction starts */
+static void MakeDirectives(void) {
+    uint32_t i, k, adr;
+
+    for (i = 0; i < hunkCount; i++) {
+        if (hunks[i].type != HUNK_CODE)
+            continue;
+        for (k = 0; k < hunks[i].startCount && k < 400; k += 7) {
+            adr = hunks[i].base + hunks[i].starts[k * 37 % hunks[i].startCount];
+            if (k % 3 == 0)
+                fprintf(config, "COMMENT\t$%08lx\tcall site %lu\n", (unsigned long) adr, (unsigned long) k);
+            else if (k % 3 == 1)
+                fprintf(config, "BANNER\t$%08lx\tfunction %lu\n", (unsigned long) adr, (unsigned long) k);
+            else
+                fprintf(config, "LABEL\tfunc_%lu_%lu\t$%08lx\n", (unsigned long) i, (unsigned long) k, (unsigned long) adr);
+        }
+    }
+}
+
+static void Write32(FILE *file, uint32_t value) {
+    putc((value >> 24) & 0xFF, file);
+    putc((value >> 16) & 0xFF, file);
+    putc((value >> 8) & 0xFF, file);
+    putc(value & 0xFF, file);
+}
+
+/* Type and length in longwords, then the name padded with zeros */
+static void WriteName(FILE *file, uint32_t type, const char *name) {
+    uint32_t len = strlen(name), n = (len + 3) / 4;
+
+    Write32(file, type << 24 | n);
+    fwrite(name, 1, len, file);
+    for (n = n * 4 - len; n; n--)
+        putc(0, file);
+}
+
+/* Definitions of some instructions, and the references to externals */
+static void WriteExternals(FILE *file, uint32_t i) {
+    static const char *externals[EXTERNALS] = {"_Open", "_Close", "_Read", "_Write"};
+    Hunk_t *hunk = &hunks[i];
+    char name[48];
+    uint32_t k, n, e;
+
+    Write32(file, HUNK_EXT);
+    if (hunk->type == HUNK_CODE)
+        for (k = 0; k < hunk->startCount; k += 13) {
+            sprintf(name, "func_%lu_%lu", (unsigned long) i, (unsigned long) k);
+            WriteName(file, EXT_DEF, name);
+            Write32(file, hunk->starts[k]);
+        }
+    for (e = 0; e < EXTERNALS; e++) {
+        for (n = 0, k = 0; k < hunk->refCount; k++)
+            n += hunk->refName[k] == e;
+        if (!n)
+            continue;
+        WriteName(file, EXT_REF32, externals[e]);
+        Write32(file, n);
+        for (k = 0; k < hunk->refCount; k++)
+            if (hunk->refName[k] == e)
+                Write32(file, hunk->refOff[k]);
+    }
+    Write32(file, 0);
+}
+
+static void WriteHunks(FILE *file, uint32_t bss, int symbols, int object) {
+    Hunk_t *hunk;
+    char name[48];
+    uint32_t i, k, n, target;
+
+    if (object) {
+        Write32(file, HUNK_UNIT);
+        WriteName(file, 0, "corpus");
+    } else {
+        Write32(file, HUNK_HEADER);
+        Write32(file, 0);
+        Write32(file, hunkCount + (bss ? 1 : 0));
+        Write32(file, 0);
+        Write32(file, hunkCount - (bss ? 0 : 1));
+        for (i = 0; i < hunkCount; i++)
+            Write32(file, hunks[i].size / 4);
+        if (bss)
+            Write32(file, (bss + 3) / 4);
+    }
+
+    for (i = 0; i < hunkCount; i++) {
+        hunk = &hunks[i];
+        Write32(file, hunk->type);
+        Write32(file, hunk->size / 4);
+        fwrite(hunk->data, 1, hunk->size, file);
+
+        if (hunk->relocCount) {
+            Write32(file, HUNK_RELOC32);
+            for (target = 0; target < hunkCount; target++) {
+                for (n = 0, k = 0; k < hunk->relocCount; k++)
+                    n += hunk->relocHunk[k] == target;
+                if (!n)
+                    continue;
+                Write32(file, n);
+                Write32(file, target);
+                for (k = 0; k < hunk->relocCount; k++)
+                    if (hunk->relocHunk[k] == target)
+                        Write32(file, hunk->relocOff[k]);
+            }
+            Write32(file, 0);
+        }
+        if (object)
+            WriteExternals(file, i);
+
+        if (symbols && hunk->type == HUNK_CODE) {
+            Write32(file, HUNK_SYMBOL);
+            for (k = 0; k < hunk->startCount; k += 13) {
+                sprintf(name, "sym_%lu_%lu", (unsigned long) i, (unsigned long) k);
+                WriteName(file, 0, name);
+                Write32(file, hunk->starts[k]);
+            }
+            Write32(file, 0);
+        }
+        Write32(file, HUNK_END);
+    }
+
+    if (bss) {
+        Write32(file, HUNK_BSS);
+        Write32(file, (bss + 3) / 4);
+        Write32(file, HUNK_END);
+    }
+}
+
+static void Usage(void) {
+    fprintf(stderr, "Usage: mkcorpus [-binary|-object] [-hunks n] [-size bytes] [-relocs %%] [-jmptabs n]\n"
+                    "                [-strings %%] [-bss bytes] [-symbols] [-seed n] [-cnf file] <out>\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+    uint32_t size = 65536, bss = 0, relocs = 5, jumpTables = 2, strings = 3, base = 0, next, i;
+    int raw = 0, object = 0, symbols = 0, hunksGiven = 0;
+    const char *out = NULL, *configName = NULL;
+    FILE *file;
+
+    for (i = 1; i < (uint32_t) argc; i++) {
+        if (!strcmp(argv[i], "-binary"))
+            raw = 1;
+        else if (!strcmp(argv[i], "-object"))
+            object = 1;
+        else if (!strcmp(argv[i], "-symbols"))
+            symbols = 1;
+        else if (i + 1 == (uint32_t) argc && argv[i][0] == '-')
+            Usage();
+        else if (!strcmp(argv[i], "-hunks")) {
+            hunkCount = strtoul(argv[++i], NULL, 0);
+            hunksGiven = 1;
+        }
+        else if (!strcmp(argv[i], "-size"))
+            size = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-relocs"))
+            relocs = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-jmptabs"))
+            jumpTables = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-strings"))
+            strings = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-bss"))
+            bss = strtoul(argv[++i], NULL, 0);
+        else if (!strcmp(argv[i], "-seed"))
+            seed ^= strtoull(argv[++i], NULL, 0) * 0x2545F4914F6CDD1DULL;
+        else if (!strcmp(argv[i], "-cnf"))
+            configName = argv[++i];
+        else if (argv[i][0] == '-' || out)
+            Usage();
+        else
+            out = argv[i];
+    }
+    if (!out || hunkCount < 1 || size < 256 || (raw && object))
+        Usage();
+    /* a raw binary is one code hunk, unless asked for more */
+    if (raw) {
+        if (!hunksGiven)
+            hunkCount = 1;
+        bss = 0;
+    }
+    size &= ~3UL;
+    if (configName) {
+        if (!(config = fopen(configName, "w"))) {
+            fprintf(stderr, "Can't open \"%s\" for writing.\n", configName);
+            return (EXIT_FAILURE);
+        }
+        fprintf(config, "MACHINE\t68000\n");
+    }
+
+    /* every third hunk holds data */
+    hunks = Alloc(NULL, hunkCount * sizeof(Hunk_t));
+    memset(hunks, 0, hunkCount * sizeof(Hunk_t));
+    for (i = 0; i < hunkCount; i++) {
+        hunks[i].type = (i % 3 == 1) ? HUNK_DATA : HUNK_CODE;
+        hunks[i].size = hunks[i].type == HUNK_DATA ? size / 4 : size;
+        hunks[i].data = Alloc(NULL, hunks[i].size + 64);
+        memset(hunks[i].data, 0, hunks[i].size + 64);
+        hunks[i].base = base;
+        base += hunks[i].size;
+    }
+
+    /* code first, so that pointers in data can hit instruction starts */
+    for (i = 0; i < hunkCount; i++)
+        if (hunks[i].type == HUNK_CODE) {
+            for (next = i + 1; next < hunkCount && hunks[next].type != HUNK_CODE; next++)
+                ;
+            MakeCode(&hunks[i], next, raw, object, relocs, jumpTables, strings);
+            if (config)
+                fprintf(config, "CODE\t$%08lx - $%08lx\n", (unsigned long) hunks[i].base,
+                        (unsigned long) (hunks[i].base + hunks[i].size));
+        }
+    for (i = 0; i < hunkCount; i++)
+        if (hunks[i].type == HUNK_DATA)
+            MakeData(&hunks[i], raw, relocs, strings * 4);
+
+    if (config) {
+        MakeDirectives();
+        fprintf(config, "END\n");
+        fclose(config);
+    }
+
+    if (!(file = fopen(out, "wb"))) {
+        fprintf(stderr, "Can't open \"%s\" for writing.\n", out);
+        return (EXIT_FAILURE);
+    }
+    if (raw)
+        for (i = 0; i < hunkCount; i++)
+            fwrite(hunks[i].data, 1, hunks[i].size, file);
+    else
+        WriteHunks(file, bss, symbols, object);
+    if (fclose(file)) {
+        fprintf(stderr, "Can't write \"%s\".\n", out);
+        return (EXIT_FAILURE);
+    }
+    return (EXIT_SUCCESS);
+}
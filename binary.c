@@ -20,13 +20,13 @@
 #include "supp.h"
 
 void Read68kBinary(ira_t *ira) {
-    /* In binary mode, sourceFile and binaryFile will be the same file.
-     * IRA must keep it because we don't want to delete sourceFile at exit. */
+    /* In binary mode, sourceFile and binaryFile are the same file.
+     * There is nothing to relocate, so it is never written. */
     ira->params.pFlags |= KEEP_BINARY;
 
     /* Previously allocated string for binaryName is now useless,
      * because pointer will be overwritten by sourceName's */
-    free(ira->filenames.binaryName);
+    myfree(ira->filenames.binaryName);
     ira->filenames.binaryName = ira->filenames.sourceName;
 
     /* Let's behave like this:
@@ -42,6 +42,13 @@ void Read68kBinary(ira_t *ira) {
     ira->hunksOffs[0] = ira->params.prgStart;
     ira->hunksType[0] = HUNK_CODE;
 
+    /* Program is the whole source file, read it straight into memory */
+    ira->params.prgLen = ira->hunksSize[0];
+    ira->buffer = mycalloc(ira->params.prgLen + 4);
+    fseek(ira->files.sourceFile, 0, SEEK_SET);
+    if ((fread(ira->buffer, 1, ira->params.prgLen, ira->files.sourceFile)) != ira->params.prgLen)
+        ExitPrg("Can't read all data (source file has not expected size).");
+
     ira->firstHunk = 0;
     ira->lastHunk = 1;
 }
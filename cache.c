@@ -0,0 +1,643 @@
+/*
+ * cache.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : cache.c
+ *      Purpose  : -CACHE, the state after Pass 1 kept on disk
+ *
+ * A cache file holds the fields of ira_t a source has after Pass 1, listed
+ * in cacheFields[], followed by every array they point to. It is named
+ * after a hash of everything Pass 1 depends on: CACHE_FORMAT, the layout
+ * of those fields, the options, the source and the config file. So a
+ * changed input simply doesn't find its cache file.
+ * COMMENT and BANNER are left out of the hash and read again on a hit:
+ * they only change the text Pass 2 writes.
+ *
+ * Next to it, a text file keeps the target Pass 2 wrote last, in parts
+ * keyed by their COMMENT and BANNER lines. A hit copies the parts whose
+ * lines are unchanged and only writes the others.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ira.h"
+
+#include "cache.h"
+#include "config.h"
+#include "init.h"
+#include "ira_2.h"
+#include "supp.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define CACHE_PID ((unsigned long) getpid())
+#else
+#define CACHE_PID 0UL
+#endif
+
+#define CACHE_MAGIC "IRACACHE"
+/* Bump it whenever cacheFields[], the arrays WriteCache() writes or what Pass 0 and 1 find changes */
+#define CACHE_FORMAT 3
+#define CACHE_EXT ".irc"
+#define CACHE_TEXT_MAGIC "IRATEXT1"
+#define CACHE_TEXT_EXT ".irt"
+
+/* Longest string a cache file may hold */
+#define CACHE_STRING_MAX (1UL << 24)
+
+typedef struct CacheField_s {
+    uint32_t offset;
+    uint32_t size;
+} CacheField_t;
+
+#define CACHE_FIELD(field) {offsetof(ira_t, field), sizeof(((ira_t *) 0)->field)}
+
+/* What Pass 2 needs of ira_t besides the arrays. Pointers, files and
+ * what belongs to the run are left out, a hit keeps them as they are. */
+static const CacheField_t cacheFields[] = {
+    CACHE_FIELD(params.pFlags), CACHE_FIELD(params.codeEntry), CACHE_FIELD(params.textMethod),
+    CACHE_FIELD(params.cpuType), CACHE_FIELD(params.prgStart), CACHE_FIELD(params.prgLen),
+    CACHE_FIELD(params.prgEnd), CACHE_FIELD(params.bitRange), CACHE_FIELD(params.immedByte),
+    CACHE_FIELD(params.sourceType), CACHE_FIELD(params.baseAbs), CACHE_FIELD(params.baseReg),
+    CACHE_FIELD(reloc.relocMax), CACHE_FIELD(label.labelMax),
+    CACHE_FIELD(symbols.symbolMax), CACHE_FIELD(symbols.symbolCount), CACHE_FIELD(symbols.symbolHashMask),
+    CACHE_FIELD(codeArea.codeAreaMax), CACHE_FIELD(codeArea.cnfCodeAreaMax), CACHE_FIELD(codeArea.codeAdrMax),
+    CACHE_FIELD(codeArea.codeAreas), CACHE_FIELD(codeArea.codeAreaEnd), CACHE_FIELD(codeArea.cnfCodeAreas),
+    CACHE_FIELD(codeArea.codeAdrs),
+    CACHE_FIELD(baseReg),
+    CACHE_FIELD(noBase.noBaseMax), CACHE_FIELD(noBase.noBaseCount), CACHE_FIELD(noBase.noBaseIndex),
+    CACHE_FIELD(noBase.noBaseFlag),
+    CACHE_FIELD(noPtr.noPtrMax), CACHE_FIELD(noPtr.noPtrCount),
+    CACHE_FIELD(text.textMax), CACHE_FIELD(text.textCount), CACHE_FIELD(text.textIndex),
+    CACHE_FIELD(commentIndex), CACHE_FIELD(bannerIndex), CACHE_FIELD(equateCount),
+    CACHE_FIELD(jmp.jmpCount), CACHE_FIELD(jmp.jmpMax), CACHE_FIELD(jmp.jmpIndex),
+    CACHE_FIELD(opCodeNumber), CACHE_FIELD(sourceadr), CACHE_FIELD(destadr),
+    CACHE_FIELD(prgCount), CACHE_FIELD(progressLines), CACHE_FIELD(progressAdr),
+    CACHE_FIELD(symbolName), CACHE_FIELD(ea_register), CACHE_FIELD(alt_register), CACHE_FIELD(ext_register),
+    CACHE_FIELD(rotate_shift_count), CACHE_FIELD(addressMode), CACHE_FIELD(addressMode2), CACHE_FIELD(extension),
+    CACHE_FIELD(displace), CACHE_FIELD(seaow), CACHE_FIELD(extra), CACHE_FIELD(pass),
+    CACHE_FIELD(RelocNumber), CACHE_FIELD(lastHunk), CACHE_FIELD(firstHunk), CACHE_FIELD(labcount),
+    CACHE_FIELD(XRefCount), CACHE_FIELD(p2labind), CACHE_FIELD(LabX_len), CACHE_FIELD(relocount),
+    CACHE_FIELD(nextreloc), CACHE_FIELD(LabAdr), CACHE_FIELD(LabAdrFlag), CACHE_FIELD(pc),
+    CACHE_FIELD(phaseAdr), CACHE_FIELD(hunkCount), CACHE_FIELD(modulcnt), CACHE_FIELD(adrlen),
+    CACHE_FIELD(mnebuf), CACHE_FIELD(dtabuf), CACHE_FIELD(adrbuf),
+    CACHE_FIELD(mnecnt), CACHE_FIELD(dtacnt), CACHE_FIELD(adrcnt)};
+
+/* Temp files this thread wrote, part of their names with the process id, see WriteCache() */
+static IRA_TLS uint32_t tempCount;
+
+/* FNV-1a, 64 bits */
+static uint64_t HashBytes(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *p = data;
+
+    while (size--)
+        hash = (hash ^ *p++) * 0x100000001b3ULL;
+    return (hash);
+}
+
+static uint64_t HashValue(uint64_t hash, uint32_t value) {
+    return (HashBytes(hash, &value, sizeof(value)));
+}
+
+/* At most size bytes from where the file is */
+static uint64_t HashFile(uint64_t hash, FILE *file, uint64_t size) {
+    uint8_t buf[4096];
+    size_t n;
+
+    while (size && (n = fread(buf, 1, size < sizeof(buf) ? (size_t) size : sizeof(buf), file))) {
+        hash = HashBytes(hash, buf, n);
+        size -= n;
+    }
+    return (hash);
+}
+
+/* The config file without its COMMENT and BANNER lines */
+static uint64_t HashConfig(uint64_t hash, FILE *file) {
+    char line[256];
+    int start = 1, skip = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        if (start)
+            skip = !strnicmp(line, "COMMENT", 7) || !strnicmp(line, "BANNER", 6);
+        if (!skip)
+            hash = HashBytes(hash, line, strlen(line));
+        start = strchr(line, '\n') != NULL;
+    }
+    return (hash);
+}
+
+static uint64_t CacheKey(ira_t *ira) {
+    static const char build[] = CACHE_MAGIC " " VERSION "." REVISION;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint32_t i;
+    FILE *config;
+
+    /* HashValue() hashes the bytes in memory, so the byte order is in it too */
+    hash = HashBytes(hash, build, sizeof(build));
+    hash = HashValue(hash, CACHE_FORMAT);
+    for (i = 0; i < sizeof(cacheFields) / sizeof(cacheFields[0]); i++) {
+        hash = HashValue(hash, cacheFields[i].offset);
+        hash = HashValue(hash, cacheFields[i].size);
+    }
+    hash = HashValue(hash, sizeof(Relocation_t));
+    hash = HashValue(hash, sizeof(JMPTab_t));
+    hash = HashValue(hash, sizeof(TextPart_t));
+
+    /* -BATCH and -STATS don't change the result, a single run may use the cache of a batch */
+    hash = HashValue(hash, ira->params.pFlags & ~(BATCH | STATS | STATS_JSON));
+    hash = HashValue(hash, ira->params.codeEntry);
+    hash = HashValue(hash, ira->params.textMethod);
+    hash = HashValue(hash, ira->params.cpuType);
+    hash = HashValue(hash, ira->params.prgStart);
+    hash = HashValue(hash, ira->params.bitRange);
+    hash = HashValue(hash, ira->params.immedByte);
+    hash = HashValue(hash, ira->params.sourceType);
+    hash = HashValue(hash, ira->params.baseAbs);
+    hash = HashValue(hash, ira->params.baseReg);
+    hash = HashValue(hash, ira->baseReg.baseAddress);
+    hash = HashValue(hash, (uint16_t) ira->baseReg.baseOffset);
+    hash = HashValue(hash, ira->adrlen);
+
+    hash = HashFile(hash, ira->files.sourceFile, ~(uint64_t) 0);
+    rewind(ira->files.sourceFile);
+
+    if (ira->params.pFlags & CONFIG) {
+        if ((config = fopen(ira->filenames.configName, "r"))) {
+            hash = HashConfig(HashValue(hash, 1), config);
+            fclose(config);
+        } else
+            hash = HashValue(hash, 0);
+    }
+    return (hash);
+}
+
+static char *CacheName(ira_t *ira) {
+    const char *dir = ira->params.cacheDir;
+    size_t len = strlen(dir);
+    char *name = myalloc(len + 24);
+
+    /* "RAM:" and "dir/" need no separator */
+    sprintf(name, "%s%s%08lx%08lx" CACHE_EXT, dir, len && !strchr(":/", dir[len - 1]) ? "/" : "",
+            (unsigned long) (ira->cacheKey >> 32), (unsigned long) (ira->cacheKey & 0xffffffffUL));
+    return (name);
+}
+
+static char *CacheTextName(ira_t *ira) {
+    size_t len = strlen(ira->filenames.cacheName) - (sizeof(CACHE_EXT) - 1);
+    char *name = myalloc(len + sizeof(CACHE_TEXT_EXT));
+
+    memcpy(name, ira->filenames.cacheName, len);
+    strcpy(name + len, CACHE_TEXT_EXT);
+    return (name);
+}
+
+static void WriteBlock(FILE *file, const void *data, uint32_t size) {
+    fwrite(&size, sizeof(size), 1, file);
+    if (size)
+        fwrite(data, 1, size, file);
+}
+
+static void WriteString(FILE *file, const char *s) {
+    WriteBlock(file, s, strlen(s) + 1);
+}
+
+/* A block as written by WriteBlock(), NULL if it is longer than max or than the rest of the file up to end */
+static void *ReadBlock(FILE *file, uint32_t *size, uint32_t max, uint64_t end, int tag) {
+    uint8_t *data;
+    long at;
+
+    if (fread(size, sizeof(*size), 1, file) != 1 || *size > max || (at = ftell(file)) < 0 || *size > end - at)
+        return (NULL);
+    data = mytalloc((size_t) *size + 1, tag);
+    data[*size] = 0;
+    if (fread(data, 1, *size, file) != *size) {
+        myfree(data);
+        return (NULL);
+    }
+    return (data);
+}
+
+/* A block of count elements, the field keeps it to be freed by FreeIra().
+ * The size is checked before it is multiplied down to 32 bits. */
+#define READ_ARRAY(field, count, elementSize, tag)                                                 \
+    if ((uint64_t) (count) * (elementSize) > end ||                                                \
+        !((field) = ReadBlock(file, &size, (uint32_t) ((count) * (elementSize)), end, (tag))) ||   \
+        size != (uint64_t) (count) * (elementSize))                                                \
+        return (0);
+
+/* Counts a damaged file could make Pass 2 go past the end of an array with */
+static int CheckCounts(ira_t *ira) {
+    return (ira->relocount < ira->reloc.relocMax && ira->labcount < ira->label.labelMax &&
+            ira->XRefCount < ira->LabX_len && ira->symbols.symbolCount <= ira->symbols.symbolMax &&
+            ira->symbols.symbolCount <= ira->symbols.symbolHashMask / 2 && ira->symbols.symbolHashMask != 0xffffffffUL &&
+            !(ira->symbols.symbolHashMask & (ira->symbols.symbolHashMask + 1)) &&
+            ira->codeArea.codeAreas <= ira->codeArea.codeAreaMax &&
+            ira->codeArea.cnfCodeAreas <= ira->codeArea.cnfCodeAreaMax &&
+            ira->codeArea.codeAdrs <= ira->codeArea.codeAdrMax && ira->noBase.noBaseCount <= ira->noBase.noBaseMax &&
+            ira->noPtr.noPtrCount <= ira->noPtr.noPtrMax && ira->text.textCount <= ira->text.textMax &&
+            ira->jmp.jmpCount <= ira->jmp.jmpMax && ira->params.prgLen < 0xfffffff0UL);
+}
+
+/* Everything the pointers of ira_t point to, in the order of WriteCache(). end is the length of the file. */
+static int ReadArrays(ira_t *ira, FILE *file, uint64_t end) {
+    uint32_t i, size, adr, count;
+    int32_t equateSize;
+    char *names, *p;
+
+    READ_ARRAY(ira->buffer, ira->params.prgLen + 4, 1, MEM_OTHER)
+    READ_ARRAY(ira->adrMap, (ira->params.prgLen >> 3) + 1, 1, MEM_OTHER)
+    READ_ARRAY(ira->reloc.relocs, ira->reloc.relocMax, sizeof(Relocation_t), MEM_RELOCS)
+    READ_ARRAY(ira->label.labelAdr, ira->label.labelMax, 4, MEM_LABELS)
+    READ_ARRAY(ira->LabelNum, ira->hunkCount, 4, MEM_LABELS)
+    READ_ARRAY(ira->XRefList, ira->LabX_len, 4, MEM_XREFS)
+
+    READ_ARRAY(ira->symbols.symbolValue, ira->symbols.symbolMax, 4, MEM_SYMBOLS)
+    READ_ARRAY(ira->symbols.symbolHash, ira->symbols.symbolHashMask + 1, 4, MEM_SYMBOLS)
+    for (i = 0; i <= ira->symbols.symbolHashMask; i++)
+        if (ira->symbols.symbolHash[i] > ira->symbols.symbolCount)
+            return (0);
+    if (!(names = ReadBlock(file, &size, (uint32_t) -2, end, MEM_SYMBOLS)) || (ira->symbols.symbolCount && (!size || names[size - 1]))) {
+        myfree(names);
+        return (0);
+    }
+    /* All names in one pool block, chained like the ones of PoolSymbolName() */
+    ira->symbols.symbolBlocks = mytalloc(sizeof(char *) + size + 1, MEM_SYMBOLS);
+    *(char **) ira->symbols.symbolBlocks = NULL;
+    memcpy(ira->symbols.symbolBlocks + sizeof(char *), names, size);
+    myfree(names);
+    ira->symbols.symbolPoolFree = 0;
+    ira->symbols.symbolName = mytcalloc(ira->symbols.symbolMax * sizeof(char *), MEM_SYMBOLS);
+    for (p = ira->symbols.symbolBlocks + sizeof(char *), i = 0; i < ira->symbols.symbolCount; i++) {
+        if (p >= ira->symbols.symbolBlocks + sizeof(char *) + size)
+            return (0);
+        ira->symbols.symbolName[i] = p;
+        p += strlen(p) + 1;
+    }
+
+    READ_ARRAY(ira->codeArea.codeArea1, ira->codeArea.codeAreaMax, 4, MEM_CODEAREAS)
+    READ_ARRAY(ira->codeArea.codeArea2, ira->codeArea.codeAreaMax, 4, MEM_CODEAREAS)
+    READ_ARRAY(ira->codeArea.cnfCodeArea1, ira->codeArea.cnfCodeAreaMax, 4, MEM_CODEAREAS)
+    READ_ARRAY(ira->codeArea.cnfCodeArea2, ira->codeArea.cnfCodeAreaMax, 4, MEM_CODEAREAS)
+    READ_ARRAY(ira->codeArea.codeAdr, ira->codeArea.codeAdrMax, 4, MEM_CODEAREAS)
+    READ_ARRAY(ira->noBase.noBaseStart, ira->noBase.noBaseMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->noBase.noBaseEnd, ira->noBase.noBaseMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->noPtr.noPtrStart, ira->noPtr.noPtrMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->noPtr.noPtrEnd, ira->noPtr.noPtrMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->text.textStart, ira->text.textMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->text.textEnd, ira->text.textMax, 4, MEM_CONFIG)
+    READ_ARRAY(ira->jmp.jmpTable, ira->jmp.jmpMax, sizeof(JMPTab_t), MEM_CONFIG)
+
+    READ_ARRAY(ira->hunksMemoryType, ira->hunkCount, 2, MEM_OTHER)
+    READ_ARRAY(ira->hunksMemoryAttrs, ira->hunkCount, 4, MEM_OTHER)
+    READ_ARRAY(ira->hunksSize, ira->hunkCount, 4, MEM_OTHER)
+    READ_ARRAY(ira->hunksType, ira->hunkCount, 4, MEM_OTHER)
+    READ_ARRAY(ira->hunksOffs, ira->hunkCount, 4, MEM_OTHER)
+
+    /* COMMENT and BANNER are read from the config file again, see ReadCache() */
+    ira->commentCount = ira->bannerCount = 0;
+
+    /* The equates are inserted again, like ReadConfig() does */
+    count = ira->equateCount;
+    ira->equateCount = ira->equateNameCount = ira->equateNameMask = 0;
+    while (count--) {
+        if (fread(&adr, sizeof(adr), 1, file) != 1 || fread(&equateSize, sizeof(equateSize), 1, file) != 1 ||
+            !(names = ReadBlock(file, &size, CACHE_STRING_MAX, end, MEM_CONFIG)))
+            return (0);
+        if (adr > ira->params.prgLen || (equateSize != 0 && equateSize != 1 && equateSize != 2 && equateSize != 4)) {
+            myfree(names);
+            return (0);
+        }
+        InsertEquate(ira, names, adr, equateSize);
+        myfree(names);
+    }
+    return (1);
+}
+
+/* Like the end of LoadSource(), for what it would have written or changed */
+static void RestoreFiles(ira_t *ira) {
+    switch (ira->params.sourceType & SOURCE_FAMILY_MASK) {
+        case SOURCE_FAMILY_AMIGA:
+            if (ira->params.pFlags & KEEP_BINARY) {
+                if (!(ira->files.binaryFile = fopen(ira->filenames.binaryName, "wb")))
+                    ExitPrg("Can't open binary file \"%s\" for writing.", ira->filenames.binaryName);
+                if (fwrite(ira->buffer, 1, ira->params.prgLen, ira->files.binaryFile) != ira->params.prgLen)
+                    ExitPrg("Can't write binary file \"%s\".", ira->filenames.binaryName);
+                fclose(ira->files.binaryFile);
+                ira->files.binaryFile = NULL;
+            }
+            break;
+        case SOURCE_FAMILY_NONE:
+            myfree(ira->filenames.binaryName);
+            ira->filenames.binaryName = ira->filenames.sourceName;
+            break;
+    }
+    fclose(ira->files.sourceFile);
+    ira->files.sourceFile = NULL;
+}
+
+/* The fields of cacheFields[], in their order */
+static int ReadFields(ira_t *ira, FILE *file) {
+    uint32_t i;
+
+    for (i = 0; i < sizeof(cacheFields) / sizeof(cacheFields[0]); i++)
+        if (fread((char *) ira + cacheFields[i].offset, cacheFields[i].size, 1, file) != 1)
+            return (0);
+    return (1);
+}
+
+/* Returns 1 if ira is now as after Pass 1, 0 if the source has to be read */
+int ReadCache(ira_t *ira) {
+    char magic[sizeof(CACHE_MAGIC) - 1];
+    uint64_t key, sum, end;
+    ira_t *cache;
+    FILE *file;
+    long length;
+
+    ira->cacheKey = CacheKey(ira);
+    ira->filenames.cacheName = CacheName(ira);
+    if (!(file = fopen(ira->filenames.cacheName, "rb")))
+        return (0);
+    if (fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, CACHE_MAGIC, sizeof(magic)) ||
+        fread(&key, sizeof(key), 1, file) != 1 || key != ira->cacheKey) {
+        fclose(file);
+        return (0);
+    }
+
+    /* The sum at the end covers the rest, so a damaged file is never used */
+    if (fseek(file, 0, SEEK_END) || (length = ftell(file)) < (long) (sizeof(magic) + 2 * sizeof(key)) ||
+        fseek(file, length - sizeof(sum), SEEK_SET) || fread(&sum, sizeof(sum), 1, file) != 1 || fseek(file, 0, SEEK_SET) ||
+        HashFile(0xcbf29ce484222325ULL, file, length - sizeof(sum)) != sum || fseek(file, sizeof(magic) + sizeof(key), SEEK_SET)) {
+        fprintf(ira->files.errFile, "WARNING: Cache file \"%s\" is damaged, ignored.\n", ira->filenames.cacheName);
+        fclose(file);
+        return (0);
+    }
+    end = length - sizeof(sum);
+
+    /* Everything not in cacheFields[] starts out empty, as after Start() */
+    cache = mytcalloc(sizeof(ira_t), MEM_OTHER);
+    ira->cacheRead = cache;
+    ira->files.readFile = file;
+    if (!ReadFields(cache, file) || !CheckCounts(cache) || !ReadArrays(cache, file, end)) {
+        fprintf(ira->files.errFile, "WARNING: Cache file \"%s\" is damaged, ignored.\n", ira->filenames.cacheName);
+        fclose(file);
+        ira->files.readFile = NULL;
+        ira->cacheRead = NULL;
+        FreeIra(cache);
+        return (0);
+    }
+    fclose(file);
+    ira->files.readFile = NULL;
+    ira->cacheRead = NULL;
+
+    /* What belongs to this run stays */
+    cache->params.pFlags = (cache->params.pFlags & ~(BATCH | STATS | STATS_JSON)) | (ira->params.pFlags & (BATCH | STATS | STATS_JSON));
+    cache->params.jobs = ira->params.jobs;
+    cache->params.cacheDir = ira->params.cacheDir;
+    cache->filenames = ira->filenames;
+    cache->files = ira->files;
+    cache->exitJump = ira->exitJump;
+    cache->stats = ira->stats;
+    cache->decoded = ira->decoded;
+    cache->opCodeTable = ira->opCodeTable;
+    cache->cacheKey = ira->cacheKey;
+    cache->cacheHit = 1;
+    *ira = *cache;
+    myfree(cache);
+
+    RestoreFiles(ira);
+    if (ira->params.pFlags & CONFIG)
+        ReadConfigComments(ira);
+    SortDirectives(ira);
+    return (1);
+}
+
+/* After Pass 1: the fields of cacheFields[], then every array they point to */
+void WriteCache(ira_t *ira) {
+    char *temp = myalloc(strlen(ira->filenames.cacheName) + 48);
+    Symbol_t *symbols = &ira->symbols;
+    Equate_t *equate;
+    uint32_t i, size;
+    int32_t equateSize;
+    uint64_t sum;
+    FILE *file;
+    int error;
+
+    /* Written under a name of its own, so no other job or process reads it half done */
+    sprintf(temp, "%s.%lu.%p.%lu", ira->filenames.cacheName, CACHE_PID, (void *) ira, (unsigned long) ++tempCount);
+    if (!(file = fopen(temp, "w+b"))) {
+        fprintf(ira->files.errFile, "WARNING: Can't write cache file \"%s\".\n", temp);
+        myfree(temp);
+        return;
+    }
+
+    fwrite(CACHE_MAGIC, 1, sizeof(CACHE_MAGIC) - 1, file);
+    fwrite(&ira->cacheKey, sizeof(ira->cacheKey), 1, file);
+    for (i = 0; i < sizeof(cacheFields) / sizeof(cacheFields[0]); i++)
+        fwrite((char *) ira + cacheFields[i].offset, cacheFields[i].size, 1, file);
+
+    WriteBlock(file, ira->buffer, ira->params.prgLen + 4);
+    WriteBlock(file, ira->adrMap, (ira->params.prgLen >> 3) + 1);
+    WriteBlock(file, ira->reloc.relocs, ira->reloc.relocMax * sizeof(Relocation_t));
+    WriteBlock(file, ira->label.labelAdr, ira->label.labelMax * 4);
+    WriteBlock(file, ira->LabelNum, ira->hunkCount * 4);
+    WriteBlock(file, ira->XRefList, ira->LabX_len * 4);
+
+    WriteBlock(file, symbols->symbolValue, symbols->symbolMax * 4);
+    WriteBlock(file, symbols->symbolHash, (symbols->symbolHashMask + 1) * 4);
+    for (size = 0, i = 0; i < symbols->symbolCount; i++)
+        size += strlen(symbols->symbolName[i]) + 1;
+    fwrite(&size, sizeof(size), 1, file);
+    for (i = 0; i < symbols->symbolCount; i++)
+        fwrite(symbols->symbolName[i], 1, strlen(symbols->symbolName[i]) + 1, file);
+
+    WriteBlock(file, ira->codeArea.codeArea1, ira->codeArea.codeAreaMax * 4);
+    WriteBlock(file, ira->codeArea.codeArea2, ira->codeArea.codeAreaMax * 4);
+    WriteBlock(file, ira->codeArea.cnfCodeArea1, ira->codeArea.cnfCodeAreaMax * 4);
+    WriteBlock(file, ira->codeArea.cnfCodeArea2, ira->codeArea.cnfCodeAreaMax * 4);
+    WriteBlock(file, ira->codeArea.codeAdr, ira->codeArea.codeAdrMax * 4);
+    WriteBlock(file, ira->noBase.noBaseStart, ira->noBase.noBaseMax * 4);
+    WriteBlock(file, ira->noBase.noBaseEnd, ira->noBase.noBaseMax * 4);
+    WriteBlock(file, ira->noPtr.noPtrStart, ira->noPtr.noPtrMax * 4);
+    WriteBlock(file, ira->noPtr.noPtrEnd, ira->noPtr.noPtrMax * 4);
+    WriteBlock(file, ira->text.textStart, ira->text.textMax * 4);
+    WriteBlock(file, ira->text.textEnd, ira->text.textMax * 4);
+    WriteBlock(file, ira->jmp.jmpTable, ira->jmp.jmpMax * sizeof(JMPTab_t));
+
+    WriteBlock(file, ira->hunksMemoryType, ira->hunkCount * 2);
+    WriteBlock(file, ira->hunksMemoryAttrs, ira->hunkCount * 4);
+    WriteBlock(file, ira->hunksSize, ira->hunkCount * 4);
+    WriteBlock(file, ira->hunksType, ira->hunkCount * 4);
+    WriteBlock(file, ira->hunksOffs, ira->hunkCount * 4);
+
+    for (equate = ira->equates; equate; equate = equate->next) {
+        fwrite(&equate->equateAdr, sizeof(equate->equateAdr), 1, file);
+        equateSize = equate->size;
+        fwrite(&equateSize, sizeof(equateSize), 1, file);
+        WriteString(file, equate->equateName);
+    }
+
+    /* The sum of everything written, see ReadCache() */
+    if (!(error = fseek(file, 0, SEEK_SET))) {
+        sum = HashFile(0xcbf29ce484222325ULL, file, ~(uint64_t) 0);
+        error = fseek(file, 0, SEEK_END) || fwrite(&sum, sizeof(sum), 1, file) != 1;
+    }
+
+    if (ferror(file) | fclose(file) | error) {
+        fprintf(ira->files.errFile, "WARNING: Can't write cache file \"%s\".\n", temp);
+        remove(temp);
+    } else if (rename(temp, ira->filenames.cacheName))
+        /* Another job was faster, its file is the same */
+        remove(temp);
+    myfree(temp);
+}
+
+/* Entries of list before end, from *index on */
+static uint64_t HashComments(uint64_t hash, Comment_t **list, uint32_t count, uint32_t *index, uint32_t end) {
+    for (; *index < count && list[*index]->commentAdr < end; (*index)++) {
+        hash = HashValue(hash, list[*index]->commentAdr);
+        hash = HashBytes(hash, list[*index]->commentText, strlen(list[*index]->commentText) + 1);
+    }
+    return (hash);
+}
+
+/* Parts of the text file, NULL if it doesn't belong to this Pass 1 */
+static TextPart_t *ReadTextParts(ira_t *ira, FILE *file) {
+    char magic[sizeof(CACHE_TEXT_MAGIC) - 1];
+    uint64_t key;
+    uint32_t count;
+    TextPart_t *parts;
+
+    if (fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, CACHE_TEXT_MAGIC, sizeof(magic)) ||
+        fread(&key, sizeof(key), 1, file) != 1 || key != ira->cacheKey || fread(&count, sizeof(count), 1, file) != 1 ||
+        count != ira->textPartCount)
+        return (NULL);
+
+    parts = mytalloc(count * sizeof(TextPart_t), MEM_OTHER);
+    if (fread(parts, sizeof(TextPart_t), count, file) != count) {
+        myfree(parts);
+        return (NULL);
+    }
+    return (parts);
+}
+
+/* Before Pass 2 writes the areas: split them into parts that start after
+ * some data, like WriteAreasParallel() does, and mark the parts the text
+ * file has with the same COMMENT and BANNER lines. */
+void ReadCacheText(ira_t *ira) {
+    TextPart_t *parts, *cached;
+    uint32_t area, count, i, comment = 0, banner = 0, end;
+    uint64_t data, size = 0;
+    char *name;
+    FILE *file;
+
+    if (!ira->params.cacheDir || (ira->params.pFlags & (SPLITFILE | BASEREG2)) || !ira->codeArea.codeAreas)
+        return;
+
+    ira->areaOffset = mytcalloc((ira->codeArea.codeAreas + 1) * sizeof(uint64_t), MEM_OTHER);
+    ira->textParts = parts = mytcalloc(ira->codeArea.codeAreas * sizeof(TextPart_t), MEM_OTHER);
+    for (count = 0, area = 0; area < ira->codeArea.codeAreas; area++)
+        if (area == 0 || ira->codeArea.codeArea2[area - 1] < ira->codeArea.codeArea1[area])
+            parts[count++].first = area;
+    ira->textPartCount = count;
+    for (i = 0; i < count; i++) {
+        end = i + 1 < count ? ira->codeArea.codeArea1[parts[i + 1].first] : ~(uint32_t) 0;
+        parts[i].key = HashComments(0xcbf29ce484222325ULL, ira->commentByAdr, ira->commentCount, &comment, end);
+        parts[i].key = HashComments(HashValue(parts[i].key, 0), ira->bannerByAdr, ira->bannerCount, &banner, end);
+    }
+
+    if (!ira->cacheHit)
+        return;
+    name = CacheTextName(ira);
+    file = fopen(name, "rb");
+    myfree(name);
+    if (!file)
+        return;
+    ira->files.readFile = file;
+
+    if ((cached = ReadTextParts(ira, file))) {
+        data = ftell(file);
+        for (i = 0; i < count && cached[i].first == parts[i].first; i++)
+            if (cached[i].offset + cached[i].size > size)
+                size = cached[i].offset + cached[i].size;
+        /* a file cut short keeps nothing */
+        if (i == count && !fseek(file, 0, SEEK_END) && (uint64_t) ftell(file) >= data + size)
+            for (i = 0; i < count; i++)
+                if (cached[i].key == parts[i].key) {
+                    parts[i].offset = data + cached[i].offset;
+                    parts[i].size = cached[i].size;
+                    parts[i].cached = 1;
+                    ira->textPartsCached++;
+                }
+        myfree(cached);
+    }
+    if (!ira->textPartsCached) {
+        fclose(file);
+        ira->files.readFile = NULL;
+    }
+}
+
+/* After Pass 2: keep the target as the text file, unless every part came from it */
+void WriteCacheText(ira_t *ira) {
+    TextPart_t *parts = ira->textParts;
+    uint32_t count = ira->textPartCount, i;
+    char buf[4096], *name, *temp;
+    FILE *file, *target;
+    size_t n;
+    int error;
+
+    if (!parts)
+        return;
+    if (ira->files.readFile) {
+        fclose(ira->files.readFile);
+        ira->files.readFile = NULL;
+    }
+    if (ira->textPartsCached == count)
+        return;
+
+    for (i = 0; i < count; i++) {
+        parts[i].offset = ira->areaOffset[parts[i].first];
+        parts[i].size = ira->areaOffset[i + 1 < count ? parts[i + 1].first : ira->codeArea.codeAreas] - parts[i].offset;
+        parts[i].cached = 0;
+    }
+    CloseTarget();
+    if (!(target = fopen(ira->filenames.targetName, "rb")))
+        return;
+
+    /* Written under a name of its own, like the cache file */
+    name = CacheTextName(ira);
+    temp = myalloc(strlen(name) + 48);
+    sprintf(temp, "%s.%lu.%p.%lu", name, CACHE_PID, (void *) ira, (unsigned long) ++tempCount);
+    if (!(file = fopen(temp, "wb"))) {
+        fprintf(ira->files.errFile, "WARNING: Can't write cache file \"%s\".\n", temp);
+        fclose(target);
+        myfree(temp);
+        myfree(name);
+        return;
+    }
+
+    fwrite(CACHE_TEXT_MAGIC, 1, sizeof(CACHE_TEXT_MAGIC) - 1, file);
+    fwrite(&ira->cacheKey, sizeof(ira->cacheKey), 1, file);
+    fwrite(&count, sizeof(count), 1, file);
+    fwrite(parts, sizeof(TextPart_t), count, file);
+    while ((n = fread(buf, 1, sizeof(buf), target)))
+        fwrite(buf, 1, n, file);
+    error = ferror(target);
+    fclose(target);
+
+    if (ferror(file) | fclose(file) | error) {
+        fprintf(ira->files.errFile, "WARNING: Can't write cache file \"%s\".\n", temp);
+        remove(temp);
+    } else if (rename(temp, name)) {
+        /* not over an existing file everywhere */
+        remove(name);
+        if (rename(temp, name))
+            remove(temp);
+    }
+    myfree(temp);
+    myfree(name);
+}
@@ -0,0 +1,18 @@
+/*
+ * cache.h
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : cache.h
+ *      Purpose  : Headers about the -CACHE analysis cache
+ */
+
+#ifndef CACHE_H_
+#define CACHE_H_
+
+int ReadCache(ira_t *);
+void ReadCacheText(ira_t *);
+void WriteCache(ira_t *);
+void WriteCacheText(ira_t *);
+
+#endif /* CACHE_H_ */
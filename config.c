@@ -87,6 +87,97 @@ void CreateConfig(ira_t *ira) {
     fclose(configfile);
 }
 
+typedef struct AdrItem_s {
+    uint32_t adr;
+    uint32_t seq;
+    void *item;
+} AdrItem_t;
+
+/* By address, then in config file order */
+static int CompareAdrItems(const void *a, const void *b) {
+    const AdrItem_t *x = a, *y = b;
+
+    if (x->adr != y->adr)
+        return (x->adr < y->adr ? -1 : 1);
+    return (x->seq < y->seq ? -1 : (x->seq > y->seq));
+}
+
+static void **SortAdrItems(AdrItem_t *items, uint32_t count) {
+    void **sorted = mytalloc(count * sizeof(void *) + 1, MEM_CONFIG);
+    uint32_t i;
+
+    qsort(items, count, sizeof(AdrItem_t), CompareAdrItems);
+    for (i = 0; i < count; i++)
+        sorted[i] = items[i].item;
+    myfree(items);
+    return (sorted);
+}
+
+static Comment_t **SortComments(Comment_t *p, uint32_t count) {
+    AdrItem_t *items = mytalloc(count * sizeof(AdrItem_t) + 1, MEM_CONFIG);
+    uint32_t i;
+
+    for (i = 0; p; p = p->next, i++) {
+        items[i].adr = p->commentAdr;
+        items[i].seq = i;
+        items[i].item = p;
+    }
+    return ((Comment_t **) SortAdrItems(items, count));
+}
+
+static Equate_t **SortEquates(Equate_t *p, uint32_t count) {
+    AdrItem_t *items = mytalloc(count * sizeof(AdrItem_t) + 1, MEM_CONFIG);
+    uint32_t i;
+
+    for (i = 0; p; p = p->next, i++) {
+        items[i].adr = p->equateAdr;
+        items[i].seq = i;
+        items[i].item = p;
+    }
+    return ((Equate_t **) SortAdrItems(items, count));
+}
+
+/* COMMENT or BANNER: an address, then the text up to the end of the line */
+static void ReadCommentDirective(ira_t *ira, char *cfg, FILE *configfile, uint16_t line_number, int banner) {
+    uint32_t value;
+    uint16_t i = banner ? 6 : 7;
+    char *ptr1;
+
+    /* Get address */
+    if ((ptr1 = strchr(cfg, '$')))
+        value = stch_l(ptr1 + 1);
+    else
+        value = atoi(&cfg[i]);
+
+    /* Is this address good ? */
+    if (value < ira->params.prgStart || value >= ira->params.prgEnd) {
+        if (ptr1 && *ptr1 == '$') {
+            ExitPrg("CONFIG ERROR: address $%lx must be within [$%lx,$%lx[ (at line %d).",
+                    (unsigned long) value, (unsigned long) ira->params.prgStart,
+                    (unsigned long) ira->params.prgEnd, line_number);
+        } else {
+            ExitPrg("CONFIG ERROR: address %lu must be within [%lu,%lu[ (at line %d).",
+                    (unsigned long) value, (unsigned long) ira->params.prgStart,
+                    (unsigned long) ira->params.prgEnd, line_number);
+        }
+    }
+
+    /* Go to the second param */
+    while (isspace(cfg[i]))
+        i++;
+    while (isgraph(cfg[i]))
+        i++;
+    while (isspace(cfg[i]))
+        i++;
+
+    /* A comment can be greater than 255 bytes */
+    ptr1 = GetFullLine(ira, cfg, configfile);
+    if (banner)
+        InsertBanner(ira, value, &ptr1[i]);
+    else
+        InsertComment(ira, value, &ptr1[i]);
+}
+
 void ReadConfig(ira_t *ira) {
     FILE *configfile;
     uint32_t area1, area2, base;
@@ -98,10 +189,11 @@ void ReadConfig(ira_t *ira) {
 
     if (!(configfile = fopen(ira->filenames.configName, "r")))
         if (ira->params.pFlags & PREPROC)
-            printf("WARNING: Can't find config file \"%s\"\n", ira->filenames.configName);
+            fprintf(ira->files.msgFile, "WARNING: Can't find config file \"%s\"\n", ira->filenames.configName);
         else
             ExitPrg("Can't open config file \"%s\".", ira->filenames.configName);
     else {
+        ira->files.readFile = configfile;
         line_number = 0;
         do {
             line_number++;
@@ -120,10 +212,7 @@ void ReadConfig(ira_t *ira) {
              * note: FULL LINE has to be ignored !
              *       otherwise string starting at 255th byte will be considered as the next line in the next loop */
             if (cfg[0] == ';') {
-                ptr1 = GetFullLine(cfg, configfile);
-                /* Don't forget to free allocated memory (yes, it seams silly to get and free immediatly...) */
-                if (ptr1 != cfg)
-                    free(ptr1);
+                GetFullLine(ira, cfg, configfile);
 
                 /* And let's go to the next line */
                 continue;
@@ -366,81 +455,13 @@ void ReadConfig(ira_t *ira) {
                     ira->baseReg.baseOffset = (int16_t) off;
                 } else
                     ira->baseReg.baseOffset = (int16_t) atoi(&cfg[7]);
-            } else if (!strnicmp(cfg, "COMMENT", 7)) {
-                /* Get address */
-                if ((ptr1 = strchr(cfg, '$')))
-                    value = stch_l(ptr1 + 1);
-                else
-                    value = atoi(&cfg[7]);
-
-                /* Is this address good ? */
-                if (value < ira->params.prgStart || value >= ira->params.prgEnd) {
-                    if (ptr1 && *ptr1 == '$') {
-                        ExitPrg("CONFIG ERROR: address $%lx must be within [$%lx,$%lx[ (at line %d).",
-                                (unsigned long) value, (unsigned long) ira->params.prgStart,
-                                (unsigned long) ira->params.prgEnd, line_number);
-                    } else {
-                        ExitPrg("CONFIG ERROR: address %lu must be within [%lu,%lu[ (at line %d).",
-                                (unsigned long) value, (unsigned long) ira->params.prgStart,
-                                (unsigned long) ira->params.prgEnd, line_number);
-                    }
-                }
-
-                /* Go to the second param */
-                i = 7;
-                while (isspace(cfg[i]))
-                    i++;
-                while (isgraph(cfg[i]))
-                    i++;
-                while (isspace(cfg[i]))
-                    i++;
-
-                /* A comment can be greater than 255 bytes */
-                ptr1 = GetFullLine(cfg, configfile);
-                InsertComment(ira, value, &ptr1[i]);
-
-                /* Don't forget to free allocated memory */
-                if (ptr1 != cfg)
-                    free(ptr1);
-            } else if (!strnicmp(cfg, "BANNER", 6)) {
-                /* Get address */
-                if ((ptr1 = strchr(cfg, '$')))
-                    value = stch_l(ptr1 + 1);
-                else
-                    value = atoi(&cfg[6]);
-
-                /* Is this address good ? */
-                if (value < ira->params.prgStart || value >= ira->params.prgEnd) {
-                    if (ptr1 && *ptr1 == '$') {
-                        ExitPrg("CONFIG ERROR: address $%lx must be within [$%lx,$%lx[ (at line %d).",
-                                (unsigned long) value, (unsigned long) ira->params.prgStart,
-                                (unsigned long) ira->params.prgEnd, line_number);
-                    } else {
-                        ExitPrg("CONFIG ERROR: address %lu must be within [%lu,%lu[ (at line %d).",
-                                (unsigned long) value, (unsigned long) ira->params.prgStart,
-                                (unsigned long) ira->params.prgEnd, line_number);
-                    }
-                }
-
-                /* Go to the second param */
-                i = 6;
-                while (isspace(cfg[i]))
-                    i++;
-                while (isgraph(cfg[i]))
-                    i++;
-                while (isspace(cfg[i]))
-                    i++;
-
-                /* A banner can be greater than 255 bytes */
-                ptr1 = GetFullLine(cfg, configfile);
-                InsertBanner(ira, value, &ptr1[i]);
-
-                /* Don't forget to free allocated memory */
-                if (ptr1 != cfg)
-                    free(ptr1);
-            } else if (!strnicmp(cfg, "EQU", 3)) {
+            } else if (!strnicmp(cfg, "COMMENT", 7))
+                ReadCommentDirective(ira, cfg, configfile, line_number, 0);
+            else if (!strnicmp(cfg, "BANNER", 6))
+                ReadCommentDirective(ira, cfg, configfile, line_number, 1);
+            else if (!strnicmp(cfg, "EQU", 3)) {
                 /* EQU directive have undefined number of arguments: line can be greater than 255 bytes */
-                ptr1 = GetFullLine(cfg, configfile);
+                ptr1 = GetFullLine(ira, cfg, configfile);
 
                 /* Go to the first parameter */
                 for (i = 3; isspace(ptr1[i]); i++)
@@ -521,10 +542,6 @@ void ReadConfig(ira_t *ira) {
                         i++;
                     }
                 }
-
-                /* Don't forget to free allocated memory */
-                if (ptr1 != cfg)
-                    free(ptr1);
             } else if (!strnicmp(cfg, "LABEL", 5)) {
                 /* Go to the first parameter */
                 for (i = 5; isspace(cfg[i]); i++)
@@ -562,7 +579,41 @@ void ReadConfig(ira_t *ira) {
         } while (strnicmp(cfg, "END", 3));
 
         fclose(configfile);
+        ira->files.readFile = NULL;
     }
+
+    SortDirectives(ira);
+}
+
+/* Only COMMENT and BANNER, the rest of the config file came from -CACHE */
+void ReadConfigComments(ira_t *ira) {
+    FILE *configfile;
+    char cfg[256];
+    uint16_t line_number = 0;
+
+    if (!(configfile = fopen(ira->filenames.configName, "r")))
+        return;
+    ira->files.readFile = configfile;
+
+    while (fgets(cfg, 256, configfile) && strnicmp(cfg, "END", 3)) {
+        line_number++;
+        if (!strnicmp(cfg, "COMMENT", 7))
+            ReadCommentDirective(ira, cfg, configfile, line_number, 0);
+        else if (!strnicmp(cfg, "BANNER", 6))
+            ReadCommentDirective(ira, cfg, configfile, line_number, 1);
+        /* The other lines ReadConfig() reads in full */
+        else if (cfg[0] == ';' || !strnicmp(cfg, "EQU", 3))
+            GetFullLine(ira, cfg, configfile);
+    }
+    fclose(configfile);
+    ira->files.readFile = NULL;
+}
+
+/* Pass 2 looks COMMENT, BANNER and EQU up by address */
+void SortDirectives(ira_t *ira) {
+    ira->commentByAdr = SortComments(ira->comments, ira->commentCount);
+    ira->bannerByAdr = SortComments(ira->banners, ira->bannerCount);
+    ira->equateByAdr = SortEquates(ira->equates, ira->equateCount);
 }
 
 void CheckEquateName(char *name, uint16_t line_number) {
@@ -594,8 +645,8 @@ void CNFAreaToCodeArea(ira_t *ira) {
 void InsertBanner(ira_t *ira, uint32_t adr, char *banner) {
     Comment_t *p;
 
-    /* note: mycalloc doesn't return if allocation failed, so no need to check returned value */
-    p = mycalloc(sizeof(Comment_t));
+    /* note: mytcalloc doesn't return if allocation failed, so no need to check returned value */
+    p = mytcalloc(sizeof(Comment_t), MEM_CONFIG);
 
     /* If last banner exists, the new one will be its next */
     if (ira->lastBanner)
@@ -606,17 +657,18 @@ void InsertBanner(ira_t *ira, uint32_t adr, char *banner) {
 
     /* Whatever happened, the new one is the new last one */
     ira->lastBanner = p;
+    ira->bannerCount++;
 
     p->commentAdr = adr;
-    p->commentText = mystrdup(banner);
-    /* note: thanks to mycalloc(), p->next is already set to NULL */
+    p->commentText = strcpy(mytalloc(strlen(banner) + 1, MEM_CONFIG), banner);
+    /* note: thanks to mytcalloc(), p->next is already set to NULL */
 }
 
 void InsertComment(ira_t *ira, uint32_t adr, char *comment) {
     Comment_t *p;
 
-    /* note: mycalloc doesn't return if allocation failed, so no need to check returned value */
-    p = mycalloc(sizeof(Comment_t));
+    /* note: mytcalloc doesn't return if allocation failed, so no need to check returned value */
+    p = mytcalloc(sizeof(Comment_t), MEM_CONFIG);
 
     /* If last comment exists, the new one will be its next */
     if (ira->lastComment)
@@ -627,10 +679,49 @@ void InsertComment(ira_t *ira, uint32_t adr, char *comment) {
 
     /* Whatever happened, the new one is the new last one */
     ira->lastComment = p;
+    ira->commentCount++;
 
     p->commentAdr = adr;
-    p->commentText = mystrdup(comment);
-    /* note: thanks to mycalloc(), p->next is already set to NULL */
+    p->commentText = strcpy(mytalloc(strlen(comment) + 1, MEM_CONFIG), comment);
+    /* note: thanks to mytcalloc(), p->next is already set to NULL */
+}
+
+/* Hash slot of the first equate named name, or the free slot where it would go */
+static Equate_t **EquateNameSlot(ira_t *ira, const char *name) {
+    const unsigned char *s;
+    uint32_t h = 2166136261UL;
+
+    if (!ira->equateNames) {
+        ira->equateNameMask = 255;
+        ira->equateNames = mytcalloc((ira->equateNameMask + 1) * sizeof(Equate_t *), MEM_CONFIG);
+    }
+
+    for (s = (const unsigned char *) name; *s; s++)
+        h = (h ^ *s) * 16777619UL;
+    for (h &= ira->equateNameMask; ira->equateNames[h]; h = (h + 1) & ira->equateNameMask)
+        if (!strcmp(ira->equateNames[h]->equateName, name))
+            break;
+
+    return (&ira->equateNames[h]);
+}
+
+static void InsertEquateName(ira_t *ira, Equate_t *equ) {
+    Equate_t **old;
+    uint32_t i, n;
+
+    *EquateNameSlot(ira, equ->equateName) = equ;
+
+    /* keep the hash at most half full */
+    if (++ira->equateNameCount * 2 > ira->equateNameMask) {
+        old = ira->equateNames;
+        n = ira->equateNameMask + 1;
+        ira->equateNameMask = ira->equateNameMask * 2 + 1;
+        ira->equateNames = mytcalloc((ira->equateNameMask + 1) * sizeof(Equate_t *), MEM_CONFIG);
+        for (i = 0; i < n; i++)
+            if (old[i])
+                *EquateNameSlot(ira, old[i]->equateName) = old[i];
+        myfree(old);
+    }
 }
 
 void InsertEquate(ira_t *ira, char *name, uint32_t adr, int size) {
@@ -638,9 +729,6 @@ void InsertEquate(ira_t *ira, char *name, uint32_t adr, int size) {
     int i;
     Equate_t *p, *e;
 
-    /* note: mycalloc doesn't return if allocation failed, so no need to check returned value */
-    p = mycalloc(sizeof(Equate_t));
-
     /* note: ira->buffer is uint16_t pointer but is loaded by fread(ira->buffer, 1,...).
      * Because it keeps big endianness, it is possible to cast ira->buffer to (int8_t *) and simply read
      * data as big endian without taking care about anything (nor endianness neither memory alignment). */
@@ -669,12 +757,15 @@ void InsertEquate(ira_t *ira, char *name, uint32_t adr, int size) {
             break;
     }
 
-    /* Let's check if other similar equates have the same value (otherwise, it can't work at all) */
-    for (e = ira->equates; e; e = e->next)
-        if (!strcmp(name, e->equateName))
-            if (value != e->equateValue)
-                ExitPrg("ERROR: for EQU \"%s\", addresses $%x.%c (%d) and $%x.%c (%d) does not have the same value.", name, e->equateAdr,
-                        e->size == 4 ? 'L' : e->size == 2 ? 'W' : size == 1 ? 'B' : 'Q', e->equateValue, adr, size == 4 ? 'L' : size == 2 ? 'W' : size == 1 ? 'B' : 'Q', value);
+    /* Let's check if other similar equates have the same value (otherwise, it can't work at all)
+     * note: all equates with that name have the same value, so checking the first one is enough */
+    if ((e = *EquateNameSlot(ira, name)))
+        if (value != e->equateValue)
+            ExitPrg("ERROR: for EQU \"%s\", addresses $%x.%c (%d) and $%x.%c (%d) does not have the same value.", name, e->equateAdr,
+                    e->size == 4 ? 'L' : e->size == 2 ? 'W' : size == 1 ? 'B' : 'Q', e->equateValue, adr, size == 4 ? 'L' : size == 2 ? 'W' : size == 1 ? 'B' : 'Q', value);
+
+    /* note: mytcalloc doesn't return if allocation failed, so no need to check returned value */
+    p = mytcalloc(sizeof(Equate_t), MEM_CONFIG);
 
     /* If last equate exists, the new one will be its next */
     if (ira->lastEquate)
@@ -685,16 +776,22 @@ void InsertEquate(ira_t *ira, char *name, uint32_t adr, int size) {
 
     /* Whatever happened, the new one is the new last one */
     ira->lastEquate = p;
+    ira->equateCount++;
 
     p->equateAdr = adr;
     p->equateValue = value;
     p->size = size;
-    p->equateName = mystrdup(name);
-    /* note: thanks to mycalloc(), p->next is already set to NULL */
+    p->equateName = strcpy(mytalloc(strlen(name) + 1, MEM_CONFIG), name);
+    /* note: thanks to mytcalloc(), p->next is already set to NULL */
+
+    if (e)
+        p->duplicate = 1;
+    else
+        InsertEquateName(ira, p);
 }
 
 void InsertCNFArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
-    uint32_t i;
+    uint32_t i, max;
 
     if (ira->codeArea.cnfCodeAreas == 0) {
         ira->codeArea.cnfCodeArea1[0] = adr1;
@@ -722,21 +819,23 @@ void InsertCNFArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
             ira->codeArea.cnfCodeArea2[i] = adr2;
             ira->codeArea.cnfCodeAreas++;
             if (ira->codeArea.cnfCodeAreas == ira->codeArea.cnfCodeAreaMax) {
-                ira->codeArea.cnfCodeArea1 = GetNewVarBuffer(ira->codeArea.cnfCodeArea1, ira->codeArea.cnfCodeAreaMax);
-                ira->codeArea.cnfCodeArea2 = GetNewVarBuffer(ira->codeArea.cnfCodeArea2, ira->codeArea.cnfCodeAreaMax);
-                ira->codeArea.cnfCodeAreaMax *= 2;
+                max = GrowMax(ira->codeArea.cnfCodeAreaMax, ira->codeArea.cnfCodeAreas + 1);
+                ira->codeArea.cnfCodeArea1 = ResizeArray(ira->codeArea.cnfCodeArea1, ira->codeArea.cnfCodeAreaMax, max, sizeof(uint32_t));
+                ira->codeArea.cnfCodeArea2 = ResizeArray(ira->codeArea.cnfCodeArea2, ira->codeArea.cnfCodeAreaMax, max, sizeof(uint32_t));
+                ira->codeArea.cnfCodeAreaMax = max;
             }
         }
     }
 }
 
 void InsertNoPointersArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
-    uint32_t i;
+    uint32_t i, max;
 
     if (ira->noPtr.noPtrCount >= ira->noPtr.noPtrMax) {
-        ira->noPtr.noPtrStart = GetNewVarBuffer(ira->noPtr.noPtrStart, ira->noPtr.noPtrMax);
-        ira->noPtr.noPtrEnd = GetNewVarBuffer(ira->noPtr.noPtrEnd, ira->noPtr.noPtrMax);
-        ira->noPtr.noPtrMax *= 2;
+        max = GrowMax(ira->noPtr.noPtrMax, ira->noPtr.noPtrCount + 1);
+        ira->noPtr.noPtrStart = ResizeArray(ira->noPtr.noPtrStart, ira->noPtr.noPtrMax, max, sizeof(uint32_t));
+        ira->noPtr.noPtrEnd = ResizeArray(ira->noPtr.noPtrEnd, ira->noPtr.noPtrMax, max, sizeof(uint32_t));
+        ira->noPtr.noPtrMax = max;
     }
     for (i = 0; i < ira->noPtr.noPtrCount; i++) {
         if (adr1 < ira->noPtr.noPtrStart[i])
@@ -752,12 +851,13 @@ void InsertNoPointersArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
 }
 
 void InsertNoBaseArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
-    uint32_t i;
+    uint32_t i, max;
 
     if (ira->noBase.noBaseCount >= ira->noBase.noBaseMax) {
-        ira->noBase.noBaseStart = GetNewVarBuffer(ira->noBase.noBaseStart, ira->noBase.noBaseMax);
-        ira->noBase.noBaseEnd = GetNewVarBuffer(ira->noBase.noBaseEnd, ira->noBase.noBaseMax);
-        ira->noBase.noBaseMax *= 2;
+        max = GrowMax(ira->noBase.noBaseMax, ira->noBase.noBaseCount + 1);
+        ira->noBase.noBaseStart = ResizeArray(ira->noBase.noBaseStart, ira->noBase.noBaseMax, max, sizeof(uint32_t));
+        ira->noBase.noBaseEnd = ResizeArray(ira->noBase.noBaseEnd, ira->noBase.noBaseMax, max, sizeof(uint32_t));
+        ira->noBase.noBaseMax = max;
     }
     for (i = 0; i < ira->noBase.noBaseCount; i++) {
         if (adr1 < ira->noBase.noBaseStart[i])
@@ -773,12 +873,13 @@ void InsertNoBaseArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
 }
 
 void InsertTextArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
-    uint32_t i;
+    uint32_t i, max;
 
     if (ira->text.textCount >= ira->text.textMax) {
-        ira->text.textStart = GetNewVarBuffer(ira->text.textStart, ira->text.textMax);
-        ira->text.textEnd = GetNewVarBuffer(ira->text.textEnd, ira->text.textMax);
-        ira->text.textMax *= 2;
+        max = GrowMax(ira->text.textMax, ira->text.textCount + 1);
+        ira->text.textStart = ResizeArray(ira->text.textStart, ira->text.textMax, max, sizeof(uint32_t));
+        ira->text.textEnd = ResizeArray(ira->text.textEnd, ira->text.textMax, max, sizeof(uint32_t));
+        ira->text.textMax = max;
     }
     for (i = 0; i < ira->text.textCount; i++) {
         if (adr1 < ira->text.textStart[i])
@@ -796,10 +897,8 @@ void InsertTextArea(ira_t *ira, uint32_t adr1, uint32_t adr2) {
 void InsertJmpTabArea(ira_t *ira, int size, uint32_t adr1, uint32_t adr2, uint32_t base) {
     uint32_t i;
 
-    if (ira->jmp.jmpCount >= ira->jmp.jmpMax) {
-        ira->jmp.jmpTable = GetNewStructBuffer(ira->jmp.jmpTable, sizeof(JMPTab_t), ira->jmp.jmpMax);
-        ira->jmp.jmpMax *= 2;
-    }
+    if (ira->jmp.jmpCount >= ira->jmp.jmpMax)
+        ira->jmp.jmpTable = GrowArray(ira->jmp.jmpTable, &ira->jmp.jmpMax, ira->jmp.jmpCount + 1, sizeof(JMPTab_t));
     for (i = 0; i < ira->jmp.jmpCount; i++) {
         if (adr1 < ira->jmp.jmpTable[i].start)
             break;
@@ -813,18 +912,22 @@ void InsertJmpTabArea(ira_t *ira, int size, uint32_t adr1, uint32_t adr2, uint32
     ira->jmp.jmpCount++;
 }
 
-char *GetFullLine(char *cfg, FILE *configfile) {
+/* Returns cfg, or ira->configLine for a line longer than 255 bytes.
+ * Either is only valid until the next line is read. */
+char *GetFullLine(ira_t *ira, char *cfg, FILE *configfile) {
     char *p, *q;
     int i;
 
     /* Note : the comment can be very long and the whole line can be longer than 255 bytes */
     /* Let's call fgets() again and again until a real end of line is reached */
     for (p = cfg, i = 2; strlen(cfg) == 255 && cfg[254] != '\n'; i++) {
-        if (p == cfg) {
-            p = myalloc(i * 256);
-            strcpy(p, cfg);
-        } else
-            p = myrealloc(p, i * 256);
+        if (ira->configLineSize < i * 256) {
+            ira->configLine = ira->configLine ? myrealloc(ira->configLine, i * 256) : mytalloc(i * 256, MEM_CONFIG);
+            ira->configLineSize = i * 256;
+        }
+        if (p == cfg)
+            strcpy(ira->configLine, cfg);
+        p = ira->configLine;
 
         /* Note: fgets() can return NULL !
          * If the last line of config file has a length of 255 bytes and do not ends by a newline,
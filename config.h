@@ -17,7 +17,7 @@ void CheckEquateName(char *, uint16_t);
 void CNFAreaToCodeArea(ira_t *);
 void CreateConfig(ira_t *);
 uint32_t GetAddress(char *, uint16_t);
-char *GetFullLine(char *, FILE *);
+char *GetFullLine(ira_t *, char *, FILE *);
 void InsertBanner(ira_t *, uint32_t, char *);
 void InsertComment(ira_t *, uint32_t, char *);
 void InsertEquate(ira_t *, char *, uint32_t, int);
@@ -27,5 +27,7 @@ void InsertNoBaseArea(ira_t *, uint32_t, uint32_t);
 void InsertNoPointersArea(ira_t *, uint32_t, uint32_t);
 void InsertTextArea(ira_t *, uint32_t, uint32_t);
 void ReadConfig(ira_t *);
+void ReadConfigComments(ira_t *);
+void SortDirectives(ira_t *);
 
 #endif /* CONFIG_H_ */
@@ -23,7 +23,7 @@ const size_t cpuname_number = sizeof(cpuname) / 8;
 
 /* All data are now gathered into an unique array */
 /* note: family field is used to execute specific piece of code (i.e checking extension word with LPSTOP) */
-Opcode_t instructions[] = {
+const Opcode_t instructions[] = {
     /* family                   opcode[8]  result  mask    srcadr                                                                                      destadr flags cputype */
     {OPC_BITFIELD, "BF", 0xe8c0, 0xf8c0, MODE_SPECIFIC, MODE_SPECIFIC, OPF_ONE_MORE_WORD, M020UP},
     {OPC_ROTATE_SHIFT_MEMORY, "ASL", 0xe1c0, 0xffc0, MODE_NONE, A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32, OPF_OPERAND_WORD, M680x0},
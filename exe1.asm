@@ -0,0 +1,1832 @@
+; IRA V2.09 (Oct 17 2026) (c)1993-1995 Tim Ruehsen
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+
+
+	SECTION S_0,CODE
+
+sym_0_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0005
+	LEA	sym_0_0(PC),A0
+	TST.L	D5
+	MOVE.L	#LAB_0040+2,-(A7)
+LAB_0001:
+	MOVE.L	25452(A5),D6
+	MOVEQ	#-35,D6
+	BSR.W	LAB_0017
+	BNE.S	LAB_0001
+	ADD.W	D0,D0
+	MOVE.W	LAB_0002(PC,D0.W),D0
+	JMP	LAB_0002(PC,D0.W)
+LAB_0002:
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	ORI.B	#$24,-(A0)
+LAB_0003:
+	ORI.B	#$2c,28672(A0)
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+sym_0_13:
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+	MOVEQ	#7,D0
+	RTS
+LAB_0005:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	sym_0_39
+	BSR.W	LAB_0019
+LAB_0006:
+	BSR.W	LAB_0019
+	DBF	D7,LAB_0006
+	CMP.L	#$0000caa7,D3
+	JSR	-858(A6)
+	MOVEQ	#51,D3
+sym_0_26:
+	MOVEQ	#-89,D6
+	MOVE.W	23344(A5),21638(A5)
+	BRA.S	LAB_0008
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_0008:
+	MOVE.L	D6,D4
+	DBF	D1,LAB_0008
+	BNE.S	LAB_0008
+	CMP.L	#$0000beee,D3
+LAB_0009:
+	CMP.L	#$00002a71,D3
+LAB_000A:
+	DBF	D5,LAB_0009
+	BNE.S	LAB_000A
+	MOVE.W	31148(A5),30047(A5)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+sym_0_39:
+	BSR.W	LAB_0017
+	MOVE.L	D5,D7
+	MOVE.W	28102(A5),30109(A5)
+	BSR.W	LAB_0021
+	ADDQ.L	#6,A3
+	JSR	-636(A6)
+LAB_000C:
+	BSR.W	LAB_0021
+LAB_000D:
+	BNE.S	LAB_000C
+	JSR	-390(A6)
+LAB_000E:
+	BNE.S	LAB_000D
+	DBF	D0,LAB_000E
+	BNE.S	LAB_000E
+sym_0_52:
+	MOVEQ	#57,D2
+LAB_0010:
+	BSR.W	LAB_0021
+	DBF	D5,LAB_0010
+	CMPI.L	#$000000fb,D3
+	BRA.S	LAB_0011
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_001C
+	BSR.S	LAB_001D
+	DC.W	$7900
+LAB_0011:
+	ADD.L	D3,D7
+	LEA	sym_0_0(PC),A6
+	MOVEQ	#-112,D7
+LAB_0012:
+	BSR.W	LAB_0021
+LAB_0013:
+	MOVE.L	23448(A5),D0
+LAB_0014:
+	JSR	-888(A6)
+	BNE.S	LAB_0012
+LAB_0015:
+	BNE.S	LAB_0013
+sym_0_65:
+	DBF	D4,LAB_0015
+	RTS
+LAB_0017:
+	BSR.W	LAB_0019
+	JSR	LAB_0033
+	ADD.W	D0,D0
+	MOVE.W	LAB_0018(PC,D0.W),D0
+	JMP	LAB_0018(PC,D0.W)
+LAB_0018:
+	ORI.B	#$0a,D6
+	DC.W	$000e
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+LAB_0019:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0021
+	BRA.S	LAB_001A
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+	MOVE.L	25610(A4),0(A2)
+LAB_001A:
+	MOVE.W	27718(A5),542(A5)
+sym_0_78:
+	BRA.S	LAB_001E
+	BVS.S	LAB_0026
+	MOVEQ	#117,D2
+	BVS.S	LAB_0028
+	DC.W	$696f
+	BGT.S	LAB_0020
+	DC.W	$6c69
+	BHI.S	LAB_002A
+LAB_001C:
+	BSR.S	LAB_002B
+LAB_001D:
+	DC.W	$7900
+LAB_001E:
+	ADD.L	D3,D2
+	ADD.W	D0,D0
+	MOVE.W	LAB_001F(PC,D0.W),D0
+	JMP	LAB_001F(PC,D0.W)
+LAB_001F:
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+	ORI.B	#$26,-(A2)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+LAB_0020:
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+LAB_0021:
+	LINK.W	A5,#-248
+	BSR.W	LAB_0033
+LAB_0023:
+	TST.L	D3
+sym_0_91:
+	MOVE.L	#LAB_00B3,-(A7)
+	ADD.L	D3,D6
+	JSR	LAB_0033
+	BNE.S	sym_0_91
+LAB_0025:
+	CMPI.L	#$0000002e,D6
+	BNE.S	LAB_0025
+	ADD.L	D0,D5
+	LEA	LAB_0023(PC),A2
+LAB_0026:
+	BSR.W	LAB_0033
+	MOVE.L	D3,D1
+	MOVEQ	#-84,D0
+LAB_0027:
+	ADDQ.L	#6,A3
+LAB_0028:
+	DBF	D0,LAB_0027
+sym_0_104:
+	BRA.S	LAB_002C
+LAB_002A:
+	DC.W	$434f
+LAB_002B:
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_002C:
+	ADDQ.L	#1,A2
+	MOVE.L	#LAB_00B2,-(A7)
+LAB_002D:
+	BSR.W	LAB_0033
+	ADD.L	D6,D5
+	BNE.S	LAB_002D
+	JSR	-888(A6)
+	ADDQ.L	#4,A1
+	BRA.S	LAB_002E
+	BEQ.S	LAB_0036
+	BSR.S	LAB_0036
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_002E:
+	BRA.S	LAB_002F
+	BVS.S	LAB_003A
+	MOVEQ	#117,D2
+	BVS.S	LAB_003B+2
+	DC.W	$696f
+	BGT.S	LAB_0032
+	DC.W	$6c69
+	BHI.S	LAB_003D
+	BSR.S	LAB_003E
+	DC.W	$7900
+LAB_002F:
+	BSR.W	LAB_0045
+	ADDQ.L	#3,A7
+	ADD.W	D0,D0
+	MOVE.W	LAB_0030(PC,D0.W),D0
+	JMP	LAB_0030(PC,D0.W)
+LAB_0030:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+sym_0_117:
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+LAB_0032:
+	RTS
+LAB_0033:
+	BSR.W	LAB_0042
+	DBF	D3,LAB_0033
+	TST.L	D5
+	BSR.W	LAB_0051
+	LEA	LAB_0014+2(PC),A2
+	JSR	-498(A6)
+LAB_0034:
+	CMP.L	#$0000a5f1,D6
+	CMPI.L	#$000000d2,D6
+sym_0_130:
+	BSR.W	LAB_0045
+LAB_0036:
+	BNE.S	LAB_0034
+	MOVE.L	D3,D1
+LAB_0037:
+	MOVE.W	32203(A5),12016(A5)
+LAB_0038:
+	MOVE.L	D2,D1
+	BNE.S	LAB_0038
+LAB_0039:
+	BNE.S	LAB_0037
+LAB_003A:
+	CMP.L	#$00009df4,D1
+	BNE.S	LAB_0039
+LAB_003B:
+	BSR.W	LAB_0042
+	DBF	D1,LAB_003B
+LAB_003D:
+	MOVE.L	D4,D1
+LAB_003E:
+	CMP.L	#$0000d7d5,D5
+sym_0_143:
+	ADD.W	D0,D0
+	MOVE.W	LAB_0041(PC,D0.W),D0
+LAB_0040:
+	JMP	LAB_0041(PC,D0.W)
+LAB_0041:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_0042:
+	LINK.W	A5,#-252
+	BSR.W	LAB_0045
+	ADD.W	D0,D0
+	MOVE.W	LAB_0043(PC,D0.W),D0
+	JMP	LAB_0043(PC,D0.W)
+LAB_0043:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+sym_0_156:
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_0045:
+	BSR.W	LAB_0051
+	MOVE.L	D4,D3
+	ADDQ.L	#5,A3
+LAB_0046:
+	CMP.L	#$00003c83,D2
+	BNE.S	LAB_0046
+	BNE.S	LAB_0046
+	JSR	-498(A6)
+LAB_0047:
+	JSR	-858(A6)
+	DBF	D0,LAB_0047
+sym_0_169:
+	BSR.W	LAB_006D
+	ADD.L	D3,D1
+LAB_0049:
+	MOVE.L	15060(A5),D4
+	DBF	D0,LAB_0049
+	MOVE.L	D6,D4
+	BRA.S	LAB_004A
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_004A:
+	MOVEQ	#-37,D6
+	MOVE.L	#LAB_00D8,-(A7)
+LAB_004B:
+	BSR.W	sym_0_221
+	BSR.W	LAB_0051
+LAB_004C:
+	BRA.S	LAB_004D
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_004D:
+	BNE.S	LAB_004B
+	MOVE.W	22745(A5),7208(A5)
+sym_0_182:
+	CMPI.L	#$00000015,D3
+	CMP.L	#$0000fa92,D3
+	BNE.S	sym_0_182
+LAB_004F:
+	BSR.W	LAB_006D
+	DBF	D3,LAB_004F
+	ADD.L	D2,D3
+	BRA.S	LAB_0050
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0050:
+	MOVEQ	#112,D6
+	CMPI.L	#$0000003f,D3
+	BSR.W	LAB_0051
+	RTS
+LAB_0051:
+	LINK.W	A5,#-100
+	BSR.W	sym_0_221
+sym_0_195:
+	BSR.W	LAB_006D
+LAB_0053:
+	DBF	D1,sym_0_195
+	BNE.S	LAB_0053
+	BNE.S	sym_0_195
+	MOVE.L	D5,D1
+LAB_0054:
+	CMPI.L	#$000000d6,D4
+	BSR.W	LAB_006D
+	BSR.W	LAB_006D
+	BNE.S	LAB_0054
+LAB_0055:
+	MOVE.L	7416(A5),D6
+LAB_0056:
+	ADDQ.L	#2,A5
+	DBF	D0,LAB_0056
+	BNE.S	LAB_0055
+sym_0_208:
+	MOVE.W	24928(A5),31906(A5)
+	CMP.L	#$0000c795,D5
+	JSR	-816(A6)
+	BNE.S	sym_0_208
+LAB_0058:
+	BRA.S	LAB_0059
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0059:
+	DBF	D4,LAB_0058
+	MOVE.L	D3,D4
+	ADDQ.L	#6,A7
+	ADD.L	D5,D6
+	BSR.W	sym_0_221
+	BSR.W	LAB_0076
+	UNLK	A5
+	RTS
+sym_0_221:
+	BSR.W	LAB_006D
+LAB_005B:
+	DBF	D3,sym_0_221
+	CMP.L	#$0000bf49,D3
+	BNE.S	LAB_005B
+LAB_005C:
+	BRA.S	LAB_005D
+	BVS.S	LAB_0068
+	MOVEQ	#117,D2
+	BVS.S	LAB_0069
+	DC.W	$696f
+	BGT.S	LAB_0060+2
+	DC.W	$6c69
+	BHI.S	LAB_006B
+	BSR.S	LAB_006C
+	DC.W	$7900
+LAB_005D:
+	DBF	D3,LAB_005C
+	DBF	D4,LAB_005D
+	BSR.W	LAB_006D
+LAB_005E:
+	BRA.S	LAB_005F
+	BVS.S	LAB_006E
+	MOVEQ	#117,D2
+	BVS.S	LAB_0070
+	DC.W	$696f
+	BGT.S	LAB_0066
+	DC.W	$6c69
+	BHI.S	LAB_0073
+	BSR.S	LAB_0074
+	DC.W	$7900
+LAB_005F:
+	DBF	D7,LAB_005E
+LAB_0060:
+	LEA	LAB_004C(PC),A0
+	DBF	D0,LAB_0060
+sym_0_234:
+	MOVE.L	D6,D3
+LAB_0063:
+	ADD.L	D6,D5
+	DBF	D6,LAB_0063
+LAB_0064:
+	BSR.W	LAB_0076
+	DBF	D4,LAB_0064
+	ADDQ.L	#4,A0
+	ADDQ.L	#7,A5
+LAB_0065:
+	CMP.L	#$0000735f,D6
+LAB_0066:
+	BNE.S	LAB_0065
+	ADD.W	D0,D0
+	MOVE.W	LAB_0067(PC,D0.W),D0
+	JMP	LAB_0067(PC,D0.W)
+LAB_0067:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+LAB_0068:
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+LAB_0069:
+	RTS
+sym_0_247:
+	MOVEQ	#3,D0
+	RTS
+LAB_006B:
+	MOVEQ	#4,D0
+LAB_006C:
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_006D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0076
+LAB_006E:
+	TST.L	D5
+	DBF	D3,LAB_006E
+LAB_006F:
+	JSR	-438(A6)
+LAB_0070:
+	BNE.S	LAB_006F
+LAB_0071:
+	MOVE.L	D0,D0
+LAB_0072:
+	BNE.S	LAB_0071
+LAB_0073:
+	BNE.S	LAB_0072
+LAB_0074:
+	BNE.S	LAB_0071
+sym_0_260:
+	MOVE.L	D2,D5
+	DBF	D0,sym_0_260
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0076:
+	BSR.W	LAB_0079
+LAB_0077:
+	MOVE.W	24571(A5),10884(A5)
+	DBF	D1,LAB_0077
+	BNE.S	LAB_0076
+	CMP.L	#$0000b556,D4
+	MOVEQ	#-66,D2
+	BSR.W	sym_0_312
+	BRA.S	sym_0_273
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_0080+2
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_0083
+	DC.W	$7900
+sym_0_273:
+	RTS
+LAB_0079:
+	LINK.W	A5,#-60
+	BSR.W	LAB_007E
+	BSR.W	LAB_007E
+	TST.L	D1
+	ADD.L	D6,D2
+LAB_007A:
+	ADDQ.L	#3,A7
+	DBF	D7,LAB_007A
+LAB_007B:
+	MOVE.W	8236(A5),10348(A5)
+	DBF	D4,LAB_007B
+	CMP.L	#$0000c518,D6
+	ADD.W	D0,D0
+	MOVE.W	LAB_007C(PC,D0.W),D0
+	JMP	LAB_007C(PC,D0.W)
+LAB_007C:
+	DC.W	$000a
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	DC.W	$001a
+	MOVEQ	#0,D0
+	RTS
+sym_0_286:
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+LAB_007E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_007F:
+	BSR.W	sym_0_312
+	DBF	D2,LAB_007F
+LAB_0080:
+	BSR.W	LAB_0097
+LAB_0081:
+	BRA.S	LAB_0082
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0088
+	DC.W	$792e
+	DC.W	$0000
+LAB_0082:
+	BNE.S	LAB_0081
+	BNE.S	LAB_0082
+	BRA.S	LAB_0084
+LAB_0083:
+	BEQ.S	LAB_008B
+	BSR.S	LAB_008B
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_0084:
+	BSR.W	LAB_008C
+sym_0_299:
+	BSR.W	sym_0_312
+	BSR.W	LAB_008C
+LAB_0086:
+	BSR.W	sym_0_312
+	DBF	D3,LAB_0086
+	ADD.W	D0,D0
+	MOVE.W	LAB_0087(PC,D0.W),D0
+	JMP	LAB_0087(PC,D0.W)
+LAB_0087:
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	ORI.B	#$24,-(A0)
+	ORI.B	#$2c,28672(A0)
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+LAB_0088:
+	RTS
+	MOVEQ	#7,D0
+	RTS
+sym_0_312:
+	LINK.W	A5,#-160
+	BSR.W	LAB_008C
+	ADD.W	D0,D0
+	MOVE.W	LAB_008A(PC,D0.W),D0
+	JMP	LAB_008A(PC,D0.W)
+LAB_008A:
+	DC.W	$000e
+LAB_008B:
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+	ORI.B	#$26,-(A2)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+LAB_008C:
+	LINK.W	A5,#-100
+LAB_008D:
+	BSR.W	LAB_0097
+	CMPI.L	#$0000003d,D1
+sym_0_325:
+	JSR	LAB_0097
+	BSR.W	LAB_009B
+	MOVE.L	D3,D5
+LAB_008F:
+	BSR.W	LAB_009B
+LAB_0090:
+	ADDQ.L	#7,A6
+	DBF	D0,LAB_0090
+LAB_0091:
+	MOVE.W	27415(A5),10241(A5)
+	CMP.L	#$0000c57a,D3
+	MOVEQ	#-45,D6
+LAB_0092:
+	BNE.S	LAB_0091
+LAB_0093:
+	DBF	D0,LAB_0092
+	BNE.S	LAB_0092
+	BNE.S	LAB_0093
+sym_0_338:
+	BSR.W	LAB_00A9
+LAB_0095:
+	JSR	-870(A6)
+	DBF	D1,LAB_0095
+	MOVE.L	25456(A5),D1
+	LEA	LAB_0021+2(PC),A6
+	BSR.W	LAB_00A9
+	CMPI.L	#$000000ca,D1
+LAB_0096:
+	ADD.L	D6,D6
+	BSR.W	LAB_0097
+	BNE.S	LAB_0096
+	UNLK	A5
+	RTS
+LAB_0097:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+sym_0_351:
+	BSR.W	LAB_009B
+	BSR.W	LAB_00A9
+	CMPI.L	#$000000b1,D1
+	MOVE.L	30854(A5),D4
+LAB_0099:
+	BRA.S	LAB_009A
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+	MOVE.L	25610(A4),0(A2)
+LAB_009A:
+	DBF	D5,LAB_0099
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_009B:
+	BSR.W	LAB_00A9
+	MOVE.L	4446(A5),D4
+	MOVE.L	18658(A5),D6
+LAB_009C:
+	MOVE.L	12378(A5),D7
+sym_0_364:
+	BRA.S	LAB_009E
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_009E:
+	JSR	-816(A6)
+LAB_009F:
+	BNE.S	LAB_009C
+	BSR.W	LAB_00AF
+LAB_00A0:
+	BNE.S	LAB_009F
+LAB_00A1:
+	DBF	D1,LAB_00A0
+	ADDQ.L	#6,A5
+	CMP.L	#$00005d1c,D3
+	JSR	-30(A6)
+	JSR	-168(A6)
+	MOVE.L	D2,D5
+	ADD.L	D6,D6
+	CMPI.L	#$000000bb,D6
+sym_0_377:
+	MOVE.L	30430(A5),D3
+	ADDQ.L	#7,A1
+	BSR.W	LAB_00AF
+LAB_00A3:
+	MOVEQ	#-92,D2
+LAB_00A4:
+	MOVE.L	D6,D6
+	BNE.S	LAB_00A4
+	BNE.S	LAB_00A3
+	ADD.L	D0,D5
+	LEA	LAB_008F(PC),A2
+	ADD.L	D6,D5
+	CMP.L	#$0000f788,D4
+	MOVE.W	24483(A5),23004(A5)
+LAB_00A5:
+	MOVE.L	32062(A5),D5
+sym_0_390:
+	DBF	D2,LAB_00A5
+	ADDQ.L	#2,A1
+	JSR	-414(A6)
+	CMPI.L	#$0000009e,D0
+	ADD.L	D6,D3
+	CMPI.L	#$00000094,D1
+	BSR.W	LAB_00AF
+	LEA	LAB_005F(PC),A2
+	MOVE.W	5605(A5),7566(A5)
+	CMPI.L	#$0000001a,D1
+	LEA	LAB_008D+2(PC),A0
+	BSR.W	LAB_00AF
+	ADDQ.L	#4,A6
+sym_0_403:
+	BRA.S	LAB_00A8
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_00A8:
+	RTS
+LAB_00A9:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00AF
+	MOVE.W	6066(A5),26397(A5)
+	TST.L	D3
+LAB_00AA:
+	BSR.W	LAB_00AF
+	DBF	D5,LAB_00AA
+	MOVE.W	19688(A5),8049(A5)
+	CMPI.L	#$00000098,D5
+	BRA.S	LAB_00AB
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	DC.W	$6272
+	DC.W	$6172
+	DC.W	$7900
+LAB_00AB:
+	ADD.L	D3,D3
+	DBF	D2,LAB_00AB
+sym_0_416:
+	BSR.W	LAB_00AF
+LAB_00AD:
+	JSR	-738(A6)
+	DBF	D0,LAB_00AD
+	BNE.S	sym_0_416
+	BNE.S	LAB_00AD
+	JSR	LAB_00AF
+LAB_00AE:
+	CMP.L	#$00006a8c,D1
+	DBF	D1,LAB_00AE
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00AF:
+	JSR	sym_2_0
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	DC.B	"intuition."
+LAB_00B0:
+	DC.L	$6c696272,$61727900,$5702fdd5,$2bc4ea31
+	DC.L	$43331c7c,$52656164,$792e0000,$388ef53a
+	DC.L	$6847e829,$67726170,$68696373,$2e6c6962
+	DC.L	$72617279,$0000696e,$74756974,$696f6e2e
+	DC.L	$6c696272,$61727900,$57b6feeb
+LAB_00B1:
+	DC.L	$219f3fba,$52656164,$792e0000,$741e38c3
+	DC.L	$7763ec3b
+	DC.L	LAB_0071
+	DC.L	$45f97925,$52656164,$792e0000,$4f757420
+	DC.L	$6f66206d,$656d6f72,$79002285,$f80d4572
+	DC.L	$726f723a,$20002573,$3a20256c,$640a0000
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172
+	DC.L	$79003695,$e2656772,$61706869,$63732e6c
+	DC.L	$69627261,$72790000,$52656164,$792e0000
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172
+	DC.W	$7900
+	DC.L	LAB_00A1
+	DC.L	$576f726b,$62656e63,$68002573,$3a20256c
+	DC.L	$640a0000,$001374d2,$2995140b,$122a27f4
+	DC.L	$1ebb2f9a,$576f726b,$62656e63,$68004e35
+	DC.L	$7b87656d,$06587d63,$95da1339,$ef1054e5
+	DC.L	$65123cdb,$c6ea2168,$9f17395f,$91fe33e5
+	DC.L	$c02258cc,$c8a65265,$6164792e,$000047f1
+	DC.L	$7f0f4572,$726f723a,$2000620d,$f59165d7
+	DC.L	$e2a35026,$44b42851,$68f1212b,$4b8727f0
+	DC.L	$68d219da,$0e697fb4,$569315b9,$478040cb
+	DC.L	$02a23109,$e667162e,$e38c470f,$2a24434f
+	DC.L	$4e3a302f,$302f3634,$302f3230,$302f4f75
+	DC.L	$74707574,$00002573,$3a20256c,$640a0000
+LAB_00B2:
+	DC.L	$0dab112e,$746f7061
+	DC.W	$7a2e
+LAB_00B3:
+	DC.L	$666f6e74,$000061bf,$6d453840,$9aa63614
+	DC.W	$bb23
+	DC.L	LAB_006D
+	DC.L	$4760408b,$746f7061,$7a2e666f,$6e740000
+	DC.L	$0b4e2b13
+	DS.L	9
+LAB_00B4:
+	DS.L	1
+
+
+	SECTION S_2,CODE
+
+sym_2_0:
+	LINK.W	A5,#-188
+	BSR.W	sym_2_13
+	BRA.S	LAB_00B6
+	BVS.S	LAB_00C0+2
+	MOVEQ	#117,D2
+	BVS.S	LAB_00C3
+	DC.W	$696f
+	BGT.S	LAB_00BA
+	DC.W	$6c69
+	BHI.S	LAB_00C5
+	BSR.S	LAB_00C6
+	DC.W	$7900
+LAB_00B6:
+	BRA.S	LAB_00B7
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_00C4
+	DC.W	$792e
+	DC.W	$0000
+LAB_00B7:
+	MOVE.L	28848(A5),D2
+	ADD.W	D0,D0
+	MOVE.W	LAB_00B8(PC,D0.W),D0
+	JMP	LAB_00B8(PC,D0.W)
+LAB_00B8:
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+LAB_00B9:
+	ORI.B	#$26,-(A2)
+LAB_00BA:
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+LAB_00BB:
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+sym_2_13:
+	BSR.W	LAB_00D1
+	JSR	-510(A6)
+LAB_00BD:
+	BRA.S	LAB_00BE
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_00CB
+	DC.W	$792e
+	DC.W	$0000
+LAB_00BE:
+	JSR	-654(A6)
+LAB_00BF:
+	MOVE.L	9942(A5),D0
+LAB_00C0:
+	DBF	D5,LAB_00BF
+LAB_00C2:
+	DBF	D0,LAB_00C0
+	DBF	D5,LAB_00C2
+LAB_00C3:
+	BRA.S	LAB_00C7
+LAB_00C4:
+	BEQ.S	LAB_00D0
+	BSR.S	LAB_00D0
+LAB_00C5:
+	DC.W	$6869
+LAB_00C6:
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_00C7:
+	MOVE.W	14305(A5),28878(A5)
+LAB_00C8:
+	BSR.W	LAB_00DE
+	JSR	LAB_00D4
+sym_2_26:
+	CMPI.L	#$00000051,D5
+	ADD.L	D6,D2
+	MOVEQ	#42,D5
+	MOVE.L	D1,D3
+	MOVE.L	#LAB_00BB,-(A7)
+	MOVE.L	15708(A5),D7
+	ADD.L	D6,D3
+	BSR.W	LAB_00D1
+	ADD.L	D2,D4
+	CMP.L	#$0000d435,D7
+LAB_00CA:
+	BRA.S	LAB_00CC
+	DC.W	$4572
+LAB_00CB:
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_00CC:
+	BNE.S	LAB_00CA
+	ADDQ.L	#7,A7
+sym_2_39:
+	BNE.S	LAB_00CA
+	BSR.W	LAB_00D1
+	ADD.W	D0,D0
+	MOVE.W	LAB_00CE(PC,D0.W),D0
+	JMP	LAB_00CE(PC,D0.W)
+LAB_00CE:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+LAB_00CF:
+	RTS
+	MOVEQ	#1,D0
+	RTS
+LAB_00D0:
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_00D1:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00D4
+	TST.L	D2
+	CMP.L	#$0000c9fa,D2
+	ADD.W	D0,D0
+	MOVE.W	LAB_00D2(PC,D0.W),D0
+	JMP	LAB_00D2(PC,D0.W)
+LAB_00D2:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+	RTS
+sym_2_52:
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_00D4:
+	BSR.W	LAB_00DE
+LAB_00D5:
+	BSR.W	LAB_00ED
+	DBF	D1,LAB_00D5
+LAB_00D6:
+	JSR	LAB_00ED
+	BNE.S	LAB_00D6
+LAB_00D7:
+	BRA.S	LAB_00DA
+LAB_00D8:
+	BEQ.S	LAB_00E2
+	BSR.S	LAB_00E2
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+LAB_00D9:
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_00DA:
+	MOVE.W	12729(A5),32666(A5)
+	BNE.S	LAB_00D7
+LAB_00DB:
+	JSR	LAB_00ED
+sym_2_65:
+	DBF	D0,LAB_00DB
+	DBF	D6,sym_2_65
+	BNE.S	LAB_00DB
+	LEA	LAB_00B9(PC),A2
+LAB_00DD:
+	MOVE.L	27718(A5),D0
+	DBF	D7,LAB_00DD
+	CMPI.L	#$000000d7,D5
+	MOVE.L	#LAB_00B1,-(A7)
+	MOVE.L	28254(A5),D5
+	LEA	LAB_00BD,A0
+	MOVE.L	5506(A5),D2
+	RTS
+LAB_00DE:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+sym_2_78:
+	BSR.W	LAB_00ED
+	MOVE.L	D3,D5
+	ADD.L	D5,D5
+	BRA.S	LAB_00E1
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_00E1:
+	BRA.S	LAB_00E3
+	BVS.S	LAB_00EC
+	MOVEQ	#117,D2
+	BVS.S	LAB_00EF
+	DC.W	$696f
+	BGT.S	LAB_00E9
+LAB_00E2:
+	DC.W	$6c69
+	BHI.S	LAB_00F0
+	BSR.S	LAB_00F0+2
+	DC.W	$7900
+LAB_00E3:
+	ADD.L	D3,D4
+LAB_00E4:
+	BSR.W	LAB_0113
+LAB_00E5:
+	BRA.S	LAB_00E6
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_00F2
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_00F4+2
+	DC.W	$7900
+LAB_00E6:
+	BRA.S	LAB_00E8
+	DC.W	$646f
+	DC.W	$732e
+LAB_00E7:
+	DC.W	$6c69
+	BHI.S	LAB_00F6
+	BSR.S	LAB_00F6+2
+	DC.W	$7900
+LAB_00E8:
+	ADDQ.L	#3,A6
+LAB_00E9:
+	ADD.W	D0,D0
+	MOVE.W	LAB_00EA(PC,D0.W),D0
+	JMP	LAB_00EA(PC,D0.W)
+LAB_00EA:
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	ORI.B	#$24,-(A0)
+	ORI.B	#$2c,28672(A0)
+	RTS
+	MOVEQ	#1,D0
+	RTS
+sym_2_91:
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+	MOVEQ	#7,D0
+LAB_00EC:
+	RTS
+LAB_00ED:
+	BSR.W	LAB_00FF
+LAB_00EE:
+	DBF	D1,LAB_00ED
+LAB_00EF:
+	DBF	D1,LAB_00EE
+	MOVEQ	#3,D1
+LAB_00F0:
+	MOVE.L	#LAB_00B0,-(A7)
+LAB_00F2:
+	BNE.S	LAB_00EF
+sym_2_104:
+	LEA	LAB_00E4+2(PC),A2
+	BSR.W	LAB_0113
+	JSR	LAB_00FF
+LAB_00F4:
+	JSR	-282(A6)
+	DBF	D7,LAB_00F4
+	CMPI.L	#$000000f4,D5
+LAB_00F6:
+	JSR	LAB_00FF
+	BSR.W	LAB_00FF
+	BSR.W	LAB_00FF
+	BSR.W	LAB_00FF
+LAB_00F8:
+	CMPI.L	#$00000032,D3
+LAB_00F9:
+	DBF	D6,LAB_00F8
+	BNE.S	LAB_00F9
+sym_2_117:
+	BSR.W	LAB_0118
+LAB_00FB:
+	BSR.W	LAB_0113
+	BNE.S	LAB_00FB
+	MOVEQ	#-79,D0
+	JSR	-438(A6)
+LAB_00FC:
+	JSR	-666(A6)
+	DBF	D2,LAB_00FC
+	MOVE.L	D6,D1
+LAB_00FD:
+	BSR.W	LAB_00FF
+	BSR.W	LAB_0118
+	BNE.S	LAB_00FD
+	BNE.S	LAB_00FD
+	MOVEQ	#3,D6
+sym_2_130:
+	RTS
+LAB_00FF:
+	LINK.W	A5,#-216
+	BSR.W	LAB_0113
+LAB_0100:
+	BRA.S	LAB_0101
+	BVS.S	LAB_010A
+	MOVEQ	#117,D2
+	BVS.S	LAB_010C+2
+	DC.W	$696f
+	BGT.S	LAB_0104
+	DC.W	$6c69
+	BHI.S	LAB_010D+2
+	BSR.S	LAB_010F
+	DC.W	$7900
+LAB_0101:
+	DBF	D6,LAB_0100
+	MOVE.L	D3,D5
+	BSR.W	LAB_0113
+	BSR.W	LAB_011E
+	ADD.L	D5,D0
+	MOVE.W	11158(A5),20033(A5)
+LAB_0102:
+	LEA	LAB_00F2(PC),A0
+	LEA	LAB_00D9(PC),A0
+	CMPI.L	#$00000035,D1
+sym_2_143:
+	BRA.S	LAB_0105
+LAB_0104:
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0105:
+	MOVE.L	#LAB_00DB,-(A7)
+	MOVE.L	32468(A5),D2
+LAB_0106:
+	BSR.W	LAB_011E
+LAB_0107:
+	DBF	D3,LAB_0106
+	DBF	D6,LAB_0107
+LAB_0108:
+	ADD.L	D3,D1
+LAB_0109:
+	BSR.W	LAB_0118
+	DBF	D6,LAB_0109
+	CMP.L	#$00000c12,D5
+	JSR	-726(A6)
+	LEA	LAB_00C8+2(PC),A6
+LAB_010A:
+	BSR.W	LAB_0113
+sym_2_156:
+	DBF	D0,LAB_010A
+LAB_010C:
+	DBF	D0,sym_2_156
+	MOVEQ	#-1,D0
+LAB_010D:
+	BSR.W	LAB_0113
+LAB_010F:
+	DBF	D5,LAB_010D
+LAB_0110:
+	LEA	LAB_00DE+2(PC),A4
+LAB_0111:
+	DBF	D2,LAB_0110
+	LEA	LAB_00E5(PC),A0
+LAB_0112:
+	BNE.S	LAB_0111
+	BNE.S	LAB_0112
+	UNLK	A5
+	RTS
+LAB_0113:
+	LINK.W	A5,#-100
+sym_2_169:
+	BSR.W	LAB_0118
+	DBF	D0,sym_2_169
+LAB_0115:
+	TST.L	D4
+	BNE.S	LAB_0115
+	BRA.S	LAB_0116
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_011E
+	BSR.S	LAB_011E+2
+	DC.W	$7900
+LAB_0116:
+	CMP.L	#$00000261,D1
+LAB_0117:
+	CMP.L	#$0000ca2e,D0
+	UNLK	A5
+	RTS
+LAB_0118:
+	LINK.W	A5,#-160
+LAB_0119:
+	BSR.W	LAB_011E
+	DBF	D2,LAB_0119
+	MOVE.L	D7,D3
+sym_2_182:
+	MOVE.L	13100(A5),D5
+	DBF	D5,sym_2_182
+	BNE.S	sym_2_182
+	BSR.W	LAB_0126
+LAB_011B:
+	MOVE.L	30506(A5),D1
+	DBF	D2,LAB_011B
+	ADD.W	D0,D0
+	MOVE.W	LAB_011C(PC,D0.W),D0
+	JMP	LAB_011C(PC,D0.W)
+LAB_011C:
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	ORI.B	#$24,-(A0)
+	ORI.B	#$2c,28672(A0)
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+sym_2_195:
+	MOVEQ	#6,D0
+	RTS
+	MOVEQ	#7,D0
+	RTS
+LAB_011E:
+	LINK.W	A5,#-68
+LAB_0120:
+	BSR.W	LAB_0123
+	DBF	D7,LAB_0120
+	JSR	-210(A6)
+	ADDQ.L	#4,A6
+	LEA	LAB_00DE(PC),A0
+LAB_0121:
+	BRA.S	LAB_0122
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_012B+2
+	DC.W	$792e
+	DC.W	$0000
+LAB_0122:
+	DBF	D3,LAB_0121
+	UNLK	A5
+	RTS
+LAB_0123:
+	LINK.W	A5,#-240
+sym_2_208:
+	BSR.W	LAB_0126
+LAB_0125:
+	TST.L	D0
+	TST.L	D1
+	BNE.S	LAB_0125
+	ADD.L	D3,D3
+	BSR.W	LAB_0132
+	BSR.W	LAB_0132
+	MOVE.L	D6,D1
+	UNLK	A5
+	RTS
+LAB_0126:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0132
+	BRA.S	sym_2_221
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+sym_2_221:
+	ADD.L	D3,D5
+LAB_0128:
+	LEA	LAB_00E7(PC),A4
+	DBF	D6,LAB_0128
+	JSR	-846(A6)
+LAB_0129:
+	BNE.S	LAB_0128
+	BNE.S	LAB_0129
+LAB_012A:
+	LEA	LAB_0128(PC),A6
+LAB_012B:
+	DBF	D6,LAB_012A
+LAB_012D:
+	DBF	D0,LAB_012B
+LAB_012E:
+	BNE.S	LAB_012D
+LAB_012F:
+	DBF	D2,LAB_012E
+	MOVE.L	29724(A5),D3
+	CMPI.L	#$00000083,D1
+sym_2_234:
+	BNE.S	LAB_012F
+	DBF	D7,sym_2_234
+	CMP.L	#$0000d296,D2
+	BRA.S	LAB_0131
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_013B+4
+	BSR.S	LAB_013C
+	DC.W	$7900
+LAB_0131:
+	MOVEQ	#88,D5
+	DBF	D2,LAB_0131
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0132:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0133:
+	BSR.W	LAB_0136
+	DBF	D2,LAB_0133
+	CMPI.L	#$000000b0,D6
+	ADD.W	D0,D0
+	MOVE.W	LAB_0134(PC,D0.W),D0
+	JMP	LAB_0134(PC,D0.W)
+LAB_0134:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+sym_2_247:
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_0136:
+	BSR.W	LAB_0143
+LAB_0137:
+	JSR	-312(A6)
+	DBF	D1,LAB_0137
+	BSR.W	sym_2_338
+LAB_0138:
+	MOVE.L	23344(A5),D2
+	DBF	D3,LAB_0138
+	MOVE.L	22500(A5),D4
+LAB_0139:
+	CMPI.L	#$00000056,D1
+sym_2_260:
+	MOVE.W	726(A5),9555(A5)
+	BNE.S	LAB_0139
+LAB_013B:
+	CMPI.L	#$00000004,D7
+LAB_013C:
+	BNE.S	sym_2_260
+	CMP.L	#$0000c8ad,D1
+	JSR	-228(A6)
+	BSR.W	LAB_0151
+	JSR	-456(A6)
+	MOVE.L	6094(A5),D4
+LAB_013D:
+	MOVE.W	8346(A5),27483(A5)
+LAB_013E:
+	DBF	D5,LAB_013D
+LAB_013F:
+	DBF	D0,LAB_013E
+	DBF	D3,LAB_013F
+sym_2_273:
+	MOVE.L	D7,D6
+LAB_0141:
+	MOVE.L	D6,D2
+	MOVE.L	D3,D1
+	BNE.S	LAB_0141
+	BRA.S	LAB_0142
+	BEQ.S	LAB_014B+2
+	BSR.S	LAB_014B+2
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_0142:
+	ADD.L	D0,D2
+	RTS
+LAB_0143:
+	BSR.W	LAB_0151
+	MOVEQ	#82,D1
+	BSR.W	LAB_0161
+LAB_0144:
+	MOVE.L	D7,D4
+	DBF	D1,LAB_0144
+sym_2_286:
+	BSR.W	LAB_0151
+	BNE.S	LAB_0144
+	BSR.W	LAB_0161
+	MOVE.L	D1,D7
+	JSR	-498(A6)
+	BSR.W	LAB_0161
+	BSR.W	LAB_0151
+LAB_0146:
+	MOVEQ	#36,D6
+	ADD.L	D1,D6
+	LEA	LAB_00B4,A2
+	BNE.S	LAB_0146
+LAB_0147:
+	BSR.W	LAB_0161
+	MOVE.L	D2,D0
+sym_2_299:
+	BNE.S	LAB_0147
+	ADD.L	D7,D2
+	MOVE.L	27712(A5),D4
+	MOVE.L	D1,D1
+	BRA.S	LAB_0149
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0155
+	DC.W	$792e
+	DC.W	$0000
+LAB_0149:
+	BRA.S	LAB_014A
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_014A:
+	DBF	D5,LAB_0149
+LAB_014B:
+	BSR.W	sym_2_338
+	CMPI.L	#$0000001f,D0
+LAB_014C:
+	LEA	LAB_0108(PC),A6
+LAB_014D:
+	DBF	D6,LAB_014C
+	ADDQ.L	#7,A2
+	BNE.S	LAB_014D
+sym_2_312:
+	MOVE.L	D6,D1
+LAB_014F:
+	DBF	D1,sym_2_312
+	DBF	D3,LAB_014F
+LAB_0150:
+	JSR	-342(A6)
+	DBF	D5,LAB_0150
+	RTS
+LAB_0151:
+	LINK.W	A5,#-156
+	BSR.W	sym_2_338
+LAB_0152:
+	LEA	LAB_0117+2(PC),A2
+LAB_0153:
+	MOVEQ	#95,D7
+	BNE.S	LAB_0152
+	BNE.S	LAB_0153
+	LEA	LAB_0102(PC),A2
+sym_2_325:
+	BRA.S	LAB_0156
+	BVS.S	LAB_015C+2
+	MOVEQ	#117,D2
+	BVS.S	LAB_015E
+	DC.W	$696f
+	BGT.S	LAB_0159
+	DC.W	$6c69
+	BHI.S	LAB_015F
+	BSR.S	LAB_0160
+LAB_0155:
+	DC.W	$7900
+LAB_0156:
+	BRA.S	LAB_0157
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+	MOVE.L	25610(A4),0(A2)
+LAB_0157:
+	CMPI.L	#$0000009c,D6
+LAB_0158:
+	MOVE.L	20020(A5),D7
+	DBF	D4,LAB_0158
+	CMPI.L	#$000000a5,D5
+	CMPI.L	#$000000ca,D5
+LAB_0159:
+	ADD.W	D0,D0
+	MOVE.W	LAB_015A(PC,D0.W),D0
+	JMP	LAB_015A(PC,D0.W)
+LAB_015A:
+	DC.W	$000a
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	DC.W	$001a
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+sym_2_338:
+	LINK.W	A5,#-140
+	BSR.W	LAB_0161
+	ADD.W	D0,D0
+	MOVE.W	LAB_015D(PC,D0.W),D0
+LAB_015C:
+	JMP	LAB_015D(PC,D0.W)
+LAB_015D:
+	ORI.B	#$0a,D6
+	DC.W	$000e
+	MOVEQ	#0,D0
+LAB_015E:
+	RTS
+	MOVEQ	#1,D0
+	RTS
+LAB_015F:
+	MOVEQ	#2,D0
+LAB_0160:
+	RTS
+LAB_0161:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0164
+	ADD.W	D0,D0
+	MOVE.W	LAB_0162(PC,D0.W),D0
+	JMP	LAB_0162(PC,D0.W)
+LAB_0162:
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	ORI.B	#$24,-(A0)
+	ORI.B	#$2c,28672(A0)
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+sym_2_351:
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+	MOVEQ	#7,D0
+	RTS
+LAB_0164:
+	BSR.W	LAB_016C
+	BRA.S	LAB_0165
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_016E
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_0170+2
+	DC.W	$7900
+LAB_0165:
+	BSR.W	LAB_016C
+LAB_0166:
+	BSR.W	LAB_0172
+	BNE.S	LAB_0166
+	BSR.W	LAB_016C
+	JSR	LAB_016C
+	MOVE.W	15358(A5),15625(A5)
+sym_2_364:
+	BRA.S	LAB_0168
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0168:
+	JSR	-162(A6)
+	DBF	D6,LAB_0168
+LAB_0169:
+	BSR.W	LAB_0172
+	DBF	D4,LAB_0169
+	BRA.S	LAB_016A
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_0176
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_0178
+	DC.W	$7900
+LAB_016A:
+	MOVEQ	#83,D7
+LAB_016B:
+	MOVE.L	D6,D2
+	JSR	-114(A6)
+	RTS
+LAB_016C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0172
+	BSR.W	LAB_017A
+sym_2_377:
+	BRA.S	LAB_016F
+LAB_016E:
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+	MOVE.L	25610(A4),0(A2)
+LAB_016F:
+	LEA	LAB_00CF(PC),A0
+	MOVE.L	D1,D2
+LAB_0170:
+	BSR.W	LAB_0184
+	MOVEQ	#-9,D7
+LAB_0171:
+	BSR.W	LAB_0184
+	DBF	D6,LAB_0171
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0172:
+	LINK.W	A5,#-132
+	BSR.W	LAB_017A
+	ADD.L	D5,D0
+	MOVEQ	#-79,D5
+sym_2_390:
+	JSR	LAB_0184
+	BSR.W	LAB_017A
+LAB_0174:
+	ADD.L	D5,D0
+	BNE.S	LAB_0174
+LAB_0175:
+	LEA	LAB_0003+2,A0
+	BRA.S	LAB_0177
+LAB_0176:
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0177:
+	ADD.L	D3,D7
+	BNE.S	LAB_0175
+	LEA	LAB_016B(PC),A2
+LAB_0178:
+	BSR.W	LAB_0184
+	MOVEQ	#24,D0
+	CMP.L	#$0000594c,D4
+	UNLK	A5
+sym_2_403:
+	RTS
+LAB_017A:
+	BSR.W	LAB_0184
+	ADDQ.L	#3,A3
+LAB_017B:
+	MOVE.L	25972(A5),D2
+LAB_017C:
+	DBF	D7,LAB_017B
+LAB_017D:
+	DBF	D1,LAB_017C
+	DBF	D1,LAB_017D
+	BSR.W	LAB_0184
+LAB_017E:
+	MOVE.W	20575(A5),13887(A5)
+LAB_017F:
+	DBF	D3,LAB_017E
+	MOVE.L	232(A5),D7
+LAB_0180:
+	MOVE.L	14478(A5),D7
+sym_2_416:
+	BNE.S	LAB_017F
+	BNE.S	LAB_0180
+	BSR.W	LAB_0184
+	MOVE.L	D5,D5
+	MOVE.L	1802(A5),D4
+LAB_0182:
+	MOVE.L	D0,D7
+	DBF	D1,LAB_0182
+LAB_0183:
+	BSR.W	LAB_0184
+	DBF	D5,LAB_0183
+	RTS
+LAB_0184:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_3,BSS
+
+SECSTRT_3:
+	DS.L	512
+	END
@@ -0,0 +1,2110 @@
+; IRA V2.09 (Oct 17 2026) (c)1993-1995 Tim Ruehsen
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+
+
+	SECTION S_0,CODE
+
+SECSTRT_0:
+	BSR.W	LAB_000A
+LAB_0002:
+	LEA	SECSTRT_0+2(PC),A0
+	BSR.W	LAB_000A
+LAB_0003:
+	LEA	LAB_003A,A6
+	CMP.L	#$0000b934,D4
+	ADDQ.L	#5,A1
+	ADD.L	D0,D0
+	MOVE.W	16178(A5),22220(A5)
+LAB_0004:
+	MOVE.L	#LAB_0060,-(A7)
+	JSR	-822(A6)
+	BNE.S	LAB_0004
+	ADDQ.L	#1,A6
+LAB_0005:
+	MOVE.W	19202(A5),11796(A5)
+	DBF	D0,LAB_0005
+LAB_0006:
+	CMPI.L	#$00000064,D3
+	BSR.W	LAB_000A
+LAB_0007:
+	BSR.W	LAB_001A
+LAB_0008:
+	LEA	SECSTRT_0(PC),A0
+	CMPI.L	#$0000000f,D6
+	BSR.W	LAB_001A
+LAB_0009:
+	BNE.S	LAB_0008
+	DBF	D5,LAB_0009
+	CMP.L	#$0000538c,D2
+	MOVEQ	#102,D0
+	RTS
+LAB_000A:
+	LINK.W	A5,#-200
+	BSR.W	LAB_0017
+LAB_000B:
+	LEA	LAB_0002+2(PC),A4
+	DBF	D1,LAB_000B
+	LEA	LAB_013C+2,A2
+LAB_000C:
+	MOVEQ	#-42,D2
+LAB_000D:
+	MOVE.L	#LAB_013F,-(A7)
+	BSR.W	LAB_0025
+	BNE.S	LAB_000C
+LAB_000E:
+	LEA	LAB_0007+2(PC),A6
+LAB_000F:
+	DBF	D1,LAB_000E
+LAB_0010:
+	MOVE.L	#LAB_0126,-(A7)
+	MOVE.L	#LAB_01B9,-(A7)
+	BNE.S	LAB_000F
+	CMPI.L	#$0000001f,D4
+	BSR.W	LAB_0025
+LAB_0011:
+	BSR.W	LAB_0017
+	DBF	D0,LAB_0011
+	ADDQ.L	#2,A2
+	JSR	-546(A6)
+	BSR.W	LAB_0025
+LAB_0012:
+	JSR	LAB_0025
+	BSR.W	LAB_001A
+LAB_0013:
+	BSR.W	LAB_001A
+	DBF	D5,LAB_0013
+	BSR.W	LAB_001A
+	LEA	LAB_0006(PC),A0
+LAB_0014:
+	BSR.W	LAB_0025
+	DBF	D3,LAB_0014
+	LEA	LAB_00A6,A4
+	ADD.W	D0,D0
+	MOVE.W	LAB_0015(PC,D0.W),D0
+	JMP	LAB_0015(PC,D0.W)
+LAB_0015:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+	MOVEQ	#0,D0
+LAB_0016:
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_0017:
+	BSR.W	LAB_001A
+	TST.L	D4
+LAB_0018:
+	BSR.W	LAB_001A
+	DBF	D0,LAB_0018
+	BSR.W	LAB_002D
+	BNE.S	LAB_0018
+LAB_0019:
+	BSR.W	LAB_001A
+	DBF	D0,LAB_0019
+	RTS
+LAB_001A:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0025
+	LEA	LAB_00C5+4,A6
+LAB_001B:
+	BSR.W	LAB_0025
+	BNE.S	LAB_001B
+LAB_001C:
+	JSR	-744(A6)
+	BNE.S	LAB_001C
+LAB_001D:
+	LEA	LAB_001D(PC),A0
+	LEA	LAB_0012(PC),A4
+	ADDQ.L	#2,A0
+	BNE.S	LAB_001D
+LAB_001E:
+	BSR.W	LAB_0025
+	DBF	D0,LAB_001E
+	BSR.W	LAB_002D
+LAB_001F:
+	CMP.L	#$0000179c,D7
+LAB_0020:
+	BSR.W	LAB_0034
+LAB_0021:
+	ADD.L	D5,D1
+LAB_0022:
+	BNE.S	LAB_0021
+	BNE.S	LAB_0020
+	CMPI.L	#$0000000e,D3
+	MOVE.L	12850(A5),D2
+	ADDQ.L	#7,A6
+	LEA	LAB_008D,A4
+	BSR.W	LAB_0025
+	MOVE.L	24826(A5),D1
+	ADD.L	D6,D3
+	LEA	LAB_0010+2(PC),A4
+	JSR	LAB_0025
+	ADDQ.L	#7,A2
+LAB_0023:
+	JSR	-282(A6)
+	MOVE.W	16334(A5),11569(A5)
+	ADD.L	D5,D7
+LAB_0024:
+	BNE.S	LAB_0023
+	BNE.S	LAB_0024
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0025:
+	LINK.W	A5,#-92
+	BSR.W	LAB_002D
+	TST.L	D1
+	MOVE.L	D2,D4
+	ADD.L	D2,D1
+LAB_0026:
+	MOVEQ	#20,D5
+LAB_0027:
+	DBF	D4,LAB_0026
+	ADD.L	D1,D5
+	BSR.W	LAB_002D
+	LEA	LAB_001E(PC),A6
+	BSR.W	LAB_0034
+	MOVE.L	#LAB_000D,-(A7)
+	JSR	LAB_0036
+	CMPI.L	#$00000063,D6
+	MOVE.L	5690(A5),D0
+LAB_0028:
+	CMPI.L	#$0000009d,D7
+LAB_002A:
+	BNE.S	LAB_0028
+	BNE.S	LAB_002A
+	MOVE.L	D1,D6
+	BRA.S	LAB_002B
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_002B:
+	UNLK	A5
+LAB_002C:
+	RTS
+LAB_002D:
+	BSR.W	LAB_0034
+	CMP.L	#$00003eed,D3
+	CMPI.L	#$000000d2,D0
+	MOVE.L	#LAB_005B,-(A7)
+	JSR	LAB_0047
+	MOVE.L	#LAB_0072+2,-(A7)
+	JSR	-654(A6)
+	ADDQ.L	#1,A0
+	JSR	LAB_0047
+	MOVE.L	#LAB_0128,-(A7)
+	JSR	LAB_0036
+LAB_002E:
+	LEA	LAB_011D,A6
+LAB_002F:
+	BNE.S	LAB_002E
+	DBF	D4,LAB_002F
+	ADDQ.L	#5,A5
+LAB_0030:
+	LEA	LAB_002A(PC),A2
+LAB_0031:
+	DBF	D4,LAB_0030
+	BSR.W	LAB_0034
+	JSR	-210(A6)
+LAB_0032:
+	BNE.S	LAB_0031
+LAB_0033:
+	DBF	D3,LAB_0032
+	RTS
+LAB_0034:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0036
+	MOVE.L	26998(A5),D3
+	MOVEQ	#7,D1
+	BRA.S	LAB_0035
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_003E+2
+	BSR.S	LAB_003F
+	DC.W	$7900
+LAB_0035:
+	MOVEQ	#100,D1
+	BNE.S	LAB_0035
+	JSR	LAB_0036
+	MOVE.L	23682(A5),D4
+	LEA	LAB_0156,A4
+	JSR	LAB_0047
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0036:
+	LINK.W	A5,#-76
+	BSR.W	LAB_0047
+LAB_0037:
+	MOVE.W	11690(A5),26225(A5)
+	TST.L	D5
+LAB_0038:
+	JSR	-84(A6)
+	BNE.S	LAB_0037
+	BNE.S	LAB_0038
+	MOVE.L	#LAB_0008,-(A7)
+LAB_0039:
+	LEA	LAB_0033+2(PC),A4
+	BRA.S	LAB_003C
+LAB_003A:
+	BEQ.S	LAB_0048+2
+LAB_003B:
+	BSR.S	LAB_0048+2
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	26978(A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_003C:
+	CMP.L	#$0000df55,D5
+	BNE.S	LAB_0039
+LAB_003D:
+	CMP.L	#$0000146b,D0
+	BSR.W	LAB_0055
+	BNE.S	LAB_003D
+	ADDQ.L	#1,A1
+LAB_003E:
+	JSR	-720(A6)
+LAB_003F:
+	MOVEQ	#62,D4
+LAB_0040:
+	LEA	LAB_0016(PC),A0
+LAB_0041:
+	MOVEQ	#125,D4
+	BSR.W	LAB_0047
+LAB_0042:
+	BRA.S	LAB_0043
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0043:
+	BNE.S	LAB_0041
+	BNE.S	LAB_0042
+	MOVE.W	24338(A5),5676(A5)
+	MOVEQ	#-73,D2
+	LEA	LAB_0057,A0
+LAB_0044:
+	MOVE.L	D3,D1
+	DBF	D5,LAB_0044
+LAB_0045:
+	BSR.W	LAB_0055
+	DBF	D6,LAB_0045
+	ADD.L	D1,D2
+	MOVE.W	14566(A5),25111(A5)
+LAB_0046:
+	UNLK	A5
+	RTS
+LAB_0047:
+	LINK.W	A5,#-180
+LAB_0048:
+	BSR.W	LAB_0055
+LAB_004A:
+	DBF	D3,LAB_0048
+LAB_004B:
+	LEA	LAB_003B(PC),A4
+LAB_004C:
+	BNE.S	LAB_004B
+LAB_004D:
+	DBF	D3,LAB_004C
+	MOVE.L	D5,D5
+	BNE.S	LAB_004D
+	LEA	LAB_00D7+2,A6
+	ADD.L	D2,D3
+LAB_004E:
+	LEA	LAB_00D0,A6
+	MOVE.L	#LAB_01BC,-(A7)
+	MOVE.L	D6,D3
+	CMPI.L	#$00000013,D2
+	BSR.W	LAB_0055
+	MOVE.L	29078(A5),D4
+LAB_004F:
+	MOVE.L	#LAB_005E,-(A7)
+	DBF	D7,LAB_004F
+LAB_0050:
+	MOVE.L	D7,D3
+LAB_0051:
+	DBF	D1,LAB_0050
+	DBF	D6,LAB_0051
+	JSR	-174(A6)
+LAB_0052:
+	MOVE.L	#LAB_0099,-(A7)
+	MOVEQ	#105,D1
+	CMP.L	#$00004001,D4
+	CMP.L	#$00008b4c,D7
+	ADD.L	D3,D0
+	BSR.W	LAB_0055
+LAB_0053:
+	JSR	-456(A6)
+	DBF	D7,LAB_0053
+LAB_0054:
+	BSR.W	LAB_0055
+	CMPI.L	#$000000f2,D6
+	MOVE.W	31977(A5),2640(A5)
+	CMP.L	#$00006434,D7
+	UNLK	A5
+	RTS
+LAB_0055:
+	JSR	SECSTRT_2
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	DC.L	$47fb4e5b,$38449725,$5f942585,$26ff9c46
+	DC.L	$0e2fc57b,$5788eab5,$303c921f,$08a0b5ea
+	DC.L	$4439f12e
+LAB_0056:
+	DC.B	"Ready.",0,0
+	DC.L	LAB_01B0
+	DC.L	$2bdf0438,$4572726f
+	DC.W	$723a
+LAB_0057:
+	DC.W	$2000
+	DC.L	LAB_0122
+	DC.L	LAB_00EA
+	DC.L	$25733a20
+LAB_0058:
+	DC.B	"%ld",10,0,0
+LAB_0059:
+	DC.L	$540f2a49
+	DC.W	$5169
+LAB_005A:
+	DC.L	$90c2708d
+	DC.W	$5c5b
+	DC.L	LAB_00CA
+	DC.L	$7958d9db
+	DC.L	LAB_0111
+	DC.L	$39a97081,$2c919025,$3dbfbd4a
+	DC.W	$5fd5
+LAB_005B:
+	DC.L	$ac56037e
+	DC.W	$672e
+LAB_005C:
+	DC.L	LAB_0180
+	DC.W	$46f3
+LAB_005D:
+	DC.L	$b50f0c16,$639352ac,$4e70696e,$74756974
+	DC.L	$696f6e2e,$6c696272
+	DC.W	$6172
+LAB_005E:
+	DC.L	$79000ae0,$fda75b9f,$887e0cb6,$5b045be0
+	DC.L	$35f17f9f
+	DC.W	$7e55
+LAB_005F:
+	DC.L	$71e4cdb1
+LAB_0060:
+	DC.L	LAB_012C
+LAB_0061:
+	DC.L	$3acbbc70
+	DC.W	$17f8
+LAB_0062:
+	DC.W	$7dbf
+	DC.L	LAB_01C9
+	DC.W	$76e5
+LAB_0063:
+	DC.L	$98dd212b,$66e276fd
+	DC.W	$3e6f
+	DC.L	LAB_0056
+	DC.L	$355ccbe9
+	DS.L	3
+LAB_0064:
+	DS.L	1
+LAB_0065:
+	DS.L	4
+	DS.W	1
+LAB_0066:
+	DS.L	1
+	DS.W	1
+
+
+	SECTION S_2,CODE
+
+SECSTRT_2:
+	LINK.W	A5,#-100
+	BSR.W	LAB_0070
+LAB_0068:
+	MOVE.L	#LAB_0125,-(A7)
+LAB_0069:
+	JSR	-798(A6)
+	ADDQ.L	#2,A7
+LAB_006A:
+	CMP.L	#$000006ad,D6
+LAB_006B:
+	CMP.L	#$00003785,D3
+LAB_006C:
+	CMP.L	#$0000ef94,D7
+	DBF	D3,LAB_006C
+	MOVE.L	27282(A5),D1
+	MOVE.W	25397(A5),20147(A5)
+LAB_006E:
+	LEA	LAB_0069(PC),A2
+	LEA	LAB_006A+2(PC),A0
+	CMPI.L	#$000000da,D1
+	ADDQ.L	#7,A1
+	ADDQ.L	#7,A7
+LAB_006F:
+	ADD.L	D1,D4
+	DBF	D4,LAB_006F
+	UNLK	A5
+	RTS
+LAB_0070:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_007B
+	LEA	LAB_0028+2,A4
+	ADDQ.L	#5,A0
+	MOVE.L	D4,D7
+LAB_0071:
+	CMPI.L	#$00000078,D0
+LAB_0072:
+	DBF	D0,LAB_0071
+	JSR	-594(A6)
+LAB_0073:
+	MOVE.W	2940(A5),17258(A5)
+	MOVE.L	D1,D1
+LAB_0074:
+	JSR	LAB_0087
+LAB_0075:
+	DBF	D6,LAB_0074
+LAB_0076:
+	BSR.W	LAB_0097
+	DBF	D5,LAB_0076
+	BNE.S	LAB_0076
+LAB_0077:
+	MOVE.L	D7,D4
+	MOVE.L	D6,D1
+	BNE.S	LAB_0077
+	LEA	LAB_0064,A6
+LAB_0078:
+	MOVE.W	22672(A5),3105(A5)
+	DBF	D1,LAB_0078
+	BSR.W	LAB_0087
+	BSR.W	LAB_007B
+LAB_0079:
+	LEA	LAB_0059,A6
+LAB_007A:
+	LEA	LAB_003D,A2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_007B:
+	LINK.W	A5,#-180
+	BSR.W	LAB_0087
+LAB_007C:
+	BSR.W	LAB_0097
+LAB_007D:
+	DBF	D3,LAB_007C
+	BNE.S	LAB_007C
+	MOVEQ	#115,D3
+	MOVE.L	D7,D3
+	CMPI.L	#$000000ab,D2
+	ADDQ.L	#5,A2
+	CMPI.L	#$0000002e,D2
+LAB_007E:
+	JSR	LAB_0087
+	BNE.S	LAB_007E
+	BSR.W	LAB_0087
+LAB_007F:
+	LEA	LAB_0068+4(PC),A2
+LAB_0080:
+	DBF	D0,LAB_007F
+LAB_0081:
+	CMP.L	#$0000b010,D4
+LAB_0082:
+	BNE.S	LAB_0081
+	DBF	D1,LAB_0082
+LAB_0083:
+	CMP.L	#$00003eb3,D6
+	DBF	D6,LAB_0083
+	JSR	LAB_0087
+	BSR.W	LAB_0087
+LAB_0084:
+	MOVE.L	134(A5),D5
+	DBF	D3,LAB_0084
+	LEA	LAB_006E+2(PC),A6
+	ADD.W	D0,D0
+	MOVE.W	LAB_0085(PC,D0.W),D0
+	JMP	LAB_0085(PC,D0.W)
+LAB_0085:
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+	ORI.B	#$26,-(A2)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+LAB_0086:
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+LAB_0087:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0097
+	MOVE.L	#LAB_01BE+2,-(A7)
+	CMP.L	#$0000385c,D5
+	BSR.W	LAB_00AD
+LAB_0088:
+	BSR.W	LAB_00AD
+	MOVEQ	#127,D0
+	BNE.S	LAB_0088
+	JSR	LAB_00AD
+LAB_008A:
+	CMP.L	#$0000fd49,D7
+LAB_008B:
+	BNE.S	LAB_008A
+	DBF	D6,LAB_008B
+LAB_008C:
+	LEA	LAB_0075(PC),A2
+	DBF	D1,LAB_008C
+	MOVE.L	#LAB_003D,-(A7)
+LAB_008D:
+	CMPI.L	#$00000083,D2
+LAB_008E:
+	BSR.W	LAB_0097
+	MOVEQ	#-76,D1
+	BNE.S	LAB_008E
+LAB_008F:
+	ADD.L	D6,D7
+	DBF	D6,LAB_008F
+	CMPI.L	#$00000077,D3
+	LEA	LAB_01D3,A6
+	MOVE.L	9028(A5),D2
+	MOVE.L	#LAB_0166,-(A7)
+	ADDQ.L	#5,A6
+LAB_0090:
+	LEA	LAB_0073+2(PC),A4
+	ADD.L	D0,D7
+	ADDQ.L	#2,A2
+LAB_0091:
+	LEA	LAB_0090(PC),A0
+LAB_0092:
+	DBF	D6,LAB_0091
+	DBF	D2,LAB_0092
+	JSR	-282(A6)
+LAB_0093:
+	MOVE.L	22822(A5),D2
+LAB_0094:
+	DBF	D2,LAB_0093
+	DBF	D3,LAB_0094
+LAB_0095:
+	LEA	LAB_006C+4(PC),A0
+	DBF	D0,LAB_0095
+	CMP.L	#$0000ed0f,D3
+	BSR.W	LAB_0097
+LAB_0096:
+	BSR.W	LAB_0097
+	ADDQ.L	#4,A7
+	LEA	LAB_006B+4(PC),A4
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0097:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00A1
+	MOVE.W	10692(A5),151(A5)
+	CMP.L	#$0000994f,D7
+LAB_0098:
+	MOVE.L	#LAB_0123,-(A7)
+	ADDQ.L	#6,A3
+	JSR	LAB_00A1
+LAB_0099:
+	BNE.S	LAB_0098
+	DBF	D0,LAB_0099
+LAB_009A:
+	MOVE.L	#LAB_0131,-(A7)
+LAB_009B:
+	DBF	D1,LAB_009A
+LAB_009C:
+	DBF	D5,LAB_009B
+LAB_009D:
+	DBF	D5,LAB_009C
+LAB_009E:
+	BNE.S	LAB_009D
+	BNE.S	LAB_009E
+LAB_009F:
+	BSR.W	LAB_00B7
+	DBF	D4,LAB_009F
+	MOVE.L	19366(A5),D3
+	LEA	LAB_0086(PC),A6
+	LEA	LAB_0124,A2
+	BSR.W	LAB_00A1
+LAB_00A0:
+	JSR	-924(A6)
+	DBF	D3,LAB_00A0
+	MOVEQ	#26,D6
+	ADD.L	D7,D3
+	LEA	LAB_0077(PC),A4
+	MOVE.L	#LAB_010F,-(A7)
+	BSR.W	LAB_00B7
+	CMP.L	#$000043e5,D3
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00A1:
+	BSR.W	LAB_00AD
+	BSR.W	LAB_00B7
+	CMP.L	#$0000691f,D3
+	ADDQ.L	#1,A2
+	BSR.W	LAB_00B7
+	MOVE.L	#LAB_0121,-(A7)
+	MOVE.W	11737(A5),28354(A5)
+	LEA	LAB_011C,A6
+LAB_00A2:
+	MOVE.L	5082(A5),D7
+	BSR.W	LAB_00B7
+LAB_00A4:
+	CMPI.L	#$00000065,D1
+LAB_00A5:
+	DBF	D5,LAB_00A4
+LAB_00A6:
+	MOVE.L	#LAB_011E,-(A7)
+LAB_00A7:
+	BNE.S	LAB_00A5
+	DBF	D5,LAB_00A7
+	JSR	-834(A6)
+	MOVE.L	1384(A5),D1
+	BSR.W	LAB_00B7
+	BRA.S	LAB_00A8
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_00B0
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_00B2
+	DC.W	$7900
+LAB_00A8:
+	CMPI.L	#$00000004,D7
+LAB_00A9:
+	JSR	LAB_00AD
+LAB_00AA:
+	MOVE.L	#LAB_0054,-(A7)
+	BSR.W	LAB_00B7
+	BNE.S	LAB_00A9
+LAB_00AB:
+	MOVE.L	#LAB_0052+2,-(A7)
+	BNE.S	LAB_00AB
+	LEA	LAB_0096+2(PC),A6
+	MOVE.L	D6,D0
+LAB_00AC:
+	MOVE.L	#LAB_017B,-(A7)
+	BNE.S	LAB_00AC
+	BSR.W	LAB_00AD
+	RTS
+LAB_00AD:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00B7
+LAB_00AE:
+	ADDQ.L	#4,A7
+	JSR	LAB_00B7
+	JSR	-48(A6)
+	BNE.S	LAB_00AE
+LAB_00AF:
+	JSR	-768(A6)
+	DBF	D2,LAB_00AF
+	MOVE.L	D2,D3
+	MOVE.L	#LAB_012B,-(A7)
+	BSR.W	LAB_00B7
+LAB_00B0:
+	LEA	LAB_0027,A0
+LAB_00B1:
+	LEA	LAB_007A(PC),A4
+	MOVE.L	#LAB_00E4+2,-(A7)
+	BNE.S	LAB_00B1
+LAB_00B2:
+	ADD.L	D2,D4
+	DBF	D7,LAB_00B2
+	BSR.W	LAB_00B7
+	CMPI.L	#$0000003a,D6
+	MOVE.L	D4,D5
+LAB_00B3:
+	MOVE.L	D2,D4
+	DBF	D6,LAB_00B3
+	ADDQ.L	#2,A3
+	BRA.S	LAB_00B4
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_00B9
+	DC.W	$0000
+LAB_00B4:
+	LEA	LAB_0088+2(PC),A4
+LAB_00B5:
+	DBF	D3,LAB_00B4
+	DBF	D0,LAB_00B5
+LAB_00B6:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00B7:
+	JSR	SECSTRT_3
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_00B8:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_00B9:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_3,CODE
+
+SECSTRT_3:
+	BSR.W	LAB_00C1
+	MOVE.L	#LAB_0013,-(A7)
+LAB_00BB:
+	ADD.L	D1,D3
+	DBF	D1,LAB_00BB
+LAB_00BC:
+	MOVE.W	22586(A5),30218(A5)
+	DBF	D6,LAB_00BC
+	BNE.S	LAB_00BC
+	MOVEQ	#6,D3
+LAB_00BD:
+	ADD.L	D0,D7
+LAB_00BE:
+	DBF	D7,LAB_00BD
+	ADD.W	D0,D0
+	MOVE.W	LAB_00BF(PC,D0.W),D0
+	JMP	LAB_00BF(PC,D0.W)
+LAB_00BF:
+	DC.W	$000a
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	DC.W	$001a
+	MOVEQ	#0,D0
+	RTS
+LAB_00C0:
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+LAB_00C1:
+	LINK.W	A5,#-28
+LAB_00C2:
+	BSR.W	LAB_00C9
+	DBF	D1,LAB_00C2
+LAB_00C3:
+	ADDQ.L	#3,A4
+LAB_00C4:
+	DBF	D7,LAB_00C3
+	BNE.S	LAB_00C4
+LAB_00C5:
+	CMPI.L	#$000000af,D2
+	MOVE.L	#LAB_0130,-(A7)
+LAB_00C6:
+	MOVE.W	8735(A5),18843(A5)
+	DBF	D0,LAB_00C6
+	MOVE.W	24848(A5),19922(A5)
+LAB_00C7:
+	JSR	-402(A6)
+	BSR.W	LAB_00C9
+	BNE.S	LAB_00C7
+LAB_00C8:
+	ADDQ.L	#2,A3
+	DBF	D7,LAB_00C8
+	MOVE.W	15440(A5),20008(A5)
+	BSR.W	LAB_00EB
+	UNLK	A5
+	RTS
+LAB_00C9:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00D9
+	JSR	LAB_00EB
+LAB_00CA:
+	MOVE.L	D3,D3
+LAB_00CB:
+	ADDQ.L	#1,A4
+	DBF	D6,LAB_00CB
+	MOVE.W	13954(A5),18799(A5)
+	CMP.L	#$0000adc9,D1
+	MOVEQ	#-53,D1
+LAB_00CC:
+	LEA	LAB_012D,A0
+	BSR.W	LAB_00EB
+LAB_00CD:
+	BNE.S	LAB_00CC
+	BNE.S	LAB_00CD
+LAB_00CE:
+	LEA	LAB_012E,A0
+	JSR	LAB_00EB
+	ADDQ.L	#2,A6
+LAB_00CF:
+	BNE.S	LAB_00CE
+	DBF	D0,LAB_00CF
+	CMPI.L	#$000000cd,D2
+	BRA.S	LAB_00D2
+	BVS.S	LAB_00DE
+	MOVEQ	#117,D2
+	BVS.S	LAB_00DF
+LAB_00D0:
+	DC.W	$696f
+	BGT.S	LAB_00D7+2
+	DC.W	$6c69
+LAB_00D1:
+	BHI.S	LAB_00E0
+	BSR.S	LAB_00E0+2
+	DC.W	$7900
+LAB_00D2:
+	BSR.W	LAB_00D9
+	JSR	LAB_00F4
+LAB_00D3:
+	BSR.W	LAB_00F4
+	BNE.S	LAB_00D3
+LAB_00D4:
+	MOVE.L	D7,D3
+	DBF	D4,LAB_00D4
+LAB_00D5:
+	MOVE.L	#LAB_0046,-(A7)
+	CMPI.L	#$00000054,D7
+LAB_00D6:
+	MOVE.L	D6,D5
+LAB_00D7:
+	DBF	D0,LAB_00D6
+LAB_00D8:
+	MOVE.W	14748(A5),9711(A5)
+	BNE.S	LAB_00D8
+	BSR.W	LAB_00EB
+	ADD.L	D7,D0
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00D9:
+	BSR.W	LAB_00EB
+LAB_00DA:
+	DBF	D3,LAB_00D9
+LAB_00DB:
+	DBF	D3,LAB_00DA
+LAB_00DC:
+	BRA.S	LAB_00DD
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_00EB
+	DC.W	$792e
+	DC.W	$0000
+LAB_00DD:
+	LEA	LAB_00DB,A4
+	BRA.S	LAB_00DF
+	DC.W	$4f75
+	MOVEQ	#32,D2
+LAB_00DE:
+	BLE.S	LAB_00EE
+	MOVEA.L	25965(A5),A0
+	BLE.S	LAB_00F0
+	DC.W	$7900
+LAB_00DF:
+	BNE.S	LAB_00DC
+	BSR.W	LAB_00FA
+LAB_00E0:
+	MOVE.L	#LAB_0061,-(A7)
+LAB_00E2:
+	BNE.S	LAB_00DF
+	MOVE.L	23910(A5),D7
+LAB_00E3:
+	JSR	LAB_00F4
+	BNE.S	LAB_00E3
+LAB_00E4:
+	MOVE.L	#LAB_01D2,-(A7)
+	DBF	D3,LAB_00E4
+	LEA	LAB_001F,A4
+LAB_00E6:
+	LEA	LAB_00BB(PC),A0
+LAB_00E8:
+	BNE.S	LAB_00E6
+	BSR.W	LAB_00FA
+	BSR.W	LAB_00FA
+	LEA	LAB_00E2(PC),A6
+LAB_00E9:
+	CMP.L	#$00009e50,D0
+LAB_00EA:
+	JSR	-924(A6)
+	BNE.S	LAB_00E9
+	RTS
+LAB_00EB:
+	BSR.W	LAB_00F4
+	DBF	D4,LAB_00EB
+	JSR	LAB_00FA
+LAB_00EC:
+	MOVEQ	#-3,D3
+LAB_00ED:
+	DBF	D2,LAB_00EC
+LAB_00EE:
+	MOVE.W	28974(A5),16972(A5)
+LAB_00EF:
+	CMPI.L	#$000000d2,D3
+	BNE.S	LAB_00ED
+	BSR.W	LAB_00FA
+LAB_00F0:
+	JSR	LAB_00FA
+LAB_00F1:
+	BSR.W	LAB_00F4
+	LEA	LAB_00E6+2(PC),A4
+LAB_00F2:
+	BNE.S	LAB_00F1
+LAB_00F3:
+	MOVEQ	#-5,D0
+	MOVEQ	#14,D2
+	BNE.S	LAB_00F3
+	ADD.L	D0,D4
+	CMP.L	#$00004eca,D5
+	LEA	LAB_013E,A6
+	LEA	LAB_00D5(PC),A4
+	BSR.W	LAB_00F4
+	MOVE.L	7308(A5),D2
+	RTS
+LAB_00F4:
+	BSR.W	LAB_00FA
+LAB_00F5:
+	ADD.L	D2,D1
+	TST.L	D6
+	MOVE.L	14794(A5),D5
+	BNE.S	LAB_00F5
+	MOVE.L	D2,D3
+	MOVE.L	D3,D1
+LAB_00F6:
+	MOVE.L	D4,D3
+LAB_00F7:
+	DBF	D2,LAB_00F6
+	DBF	D6,LAB_00F7
+	MOVEQ	#48,D6
+LAB_00F8:
+	BSR.W	LAB_0105
+LAB_00F9:
+	BNE.S	LAB_00F8
+	MOVE.L	#LAB_0063,-(A7)
+	BNE.S	LAB_00F9
+	RTS
+LAB_00FA:
+	LINK.W	A5,#-20
+	BSR.W	LAB_0105
+LAB_00FB:
+	LEA	LAB_00F2(PC),A4
+	LEA	LAB_0147+2,A2
+	BNE.S	LAB_00FB
+	BSR.W	LAB_010A
+	ADD.L	D2,D3
+	LEA	LAB_014D,A2
+LAB_00FC:
+	JSR	LAB_010A
+LAB_00FD:
+	DBF	D2,LAB_00FC
+	DBF	D7,LAB_00FD
+	MOVE.W	28459(A5),30517(A5)
+LAB_00FE:
+	ADD.L	D7,D2
+LAB_00FF:
+	DBF	D4,LAB_00FE
+	BNE.S	LAB_00FF
+	MOVE.L	D3,D7
+	LEA	LAB_00D1,A0
+LAB_0100:
+	CMP.L	#$00008bd3,D3
+	DBF	D4,LAB_0100
+	MOVEQ	#-15,D4
+	CMPI.L	#$0000005e,D2
+LAB_0101:
+	LEA	LAB_00E3(PC),A4
+	BRA.S	LAB_0102
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0106+4
+	DC.W	$792e
+	DC.W	$0000
+LAB_0102:
+	BNE.S	LAB_0101
+	MOVE.L	14822(A5),D4
+	ADD.L	D6,D5
+	MOVE.W	11542(A5),12236(A5)
+	JSR	LAB_0110
+LAB_0103:
+	LEA	LAB_0022,A2
+	MOVE.L	10330(A5),D0
+	BNE.S	LAB_0103
+	LEA	LAB_00FD(PC),A2
+	ADD.W	D0,D0
+	MOVE.W	LAB_0104(PC,D0.W),D0
+	JMP	LAB_0104(PC,D0.W)
+LAB_0104:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_0105:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_010A
+	TST.L	D6
+LAB_0106:
+	JSR	LAB_0110
+LAB_0108:
+	DBF	D3,LAB_0106
+	CMPI.L	#$00000007,D0
+	ADDQ.L	#6,A4
+	CMPI.L	#$0000000f,D5
+LAB_0109:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_010A:
+	LINK.W	A5,#-92
+	BSR.W	LAB_0110
+LAB_010B:
+	LEA	LAB_0108+2(PC),A2
+	MOVE.L	#LAB_0194+2,-(A7)
+	LEA	LAB_0129,A4
+	ADD.W	D0,D0
+	MOVE.W	LAB_010D(PC,D0.W),D0
+LAB_010C:
+	JMP	LAB_010D(PC,D0.W)
+LAB_010D:
+	DC.W	$0008
+	DC.W	$000c
+LAB_010E:
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+LAB_010F:
+	MOVEQ	#3,D0
+	RTS
+LAB_0110:
+	BSR.W	LAB_0119
+	TST.L	D6
+LAB_0111:
+	BSR.W	LAB_0119
+	BNE.S	LAB_0110
+LAB_0113:
+	MOVE.L	D5,D2
+	DBF	D7,LAB_0113
+	BRA.S	LAB_0114
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_011A
+	BSR.S	LAB_011B
+	DC.W	$7900
+LAB_0114:
+	MOVE.L	#LAB_00AA,-(A7)
+	LEA	LAB_0188,A4
+	MOVE.L	#LAB_004E,-(A7)
+LAB_0115:
+	CMPI.L	#$00000087,D5
+LAB_0116:
+	DBF	D0,LAB_0115
+	DBF	D1,LAB_0116
+	JSR	-894(A6)
+	MOVE.W	13685(A5),32095(A5)
+	MOVE.L	D3,D4
+	CMP.L	#$0000e3ed,D6
+LAB_0117:
+	BSR.W	LAB_0119
+	DBF	D6,LAB_0117
+	CMP.L	#$000090f2,D1
+	JSR	LAB_0119
+	BRA.S	LAB_0118
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	DC.W	$6f66
+	MOVEA.L	25965(A5),A0
+	DC.W	$6f72
+	DC.W	$7900
+LAB_0118:
+	RTS
+LAB_0119:
+	JSR	SECSTRT_5
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_011A:
+	NOP
+LAB_011B:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_4,DATA
+
+SECSTRT_4:
+	DC.L	$31c453ed,$4572726f
+LAB_011C:
+	DC.W	$723a
+LAB_011D:
+	DC.L	$20000e2e,$7dd6734d
+	DC.W	$8e69
+LAB_011E:
+	DC.L	LAB_0065
+	DC.W	$3a25
+LAB_011F:
+	DC.L	$747a48cf
+	DC.W	$df07
+LAB_0120:
+	DC.L	LAB_0109
+	DC.L	LAB_010E
+	DC.L	$04604b49,$2df8cb14,$415e18d4
+	DC.W	$0bd7
+LAB_0121:
+	DC.W	$b2b3
+LAB_0122:
+	DC.L	$5073bc44,$775842ec,$0c1f3afc,$61f0661e
+	DC.L	$477d3905
+LAB_0123:
+	DC.L	$41d85083
+	DC.L	LAB_0051
+	DC.L	$0967787c,$28085c47,$0b41d5af
+LAB_0124:
+	DC.B	"Out of memor"
+LAB_0125:
+	DC.W	$7900
+	DC.L	LAB_0144
+	DC.L	$16a40973,$67726170,$68696373,$2e6c6962
+	DC.L	$72617279,$0000277f
+	DC.W	$d1e8
+LAB_0126:
+	DC.W	$2c6a
+LAB_0127:
+	DC.L	$3b736be4
+LAB_0128:
+	DC.L	$eebb646f
+LAB_0129:
+	DC.L	$732e6c69,$62726172,$79002332
+	DC.W	$84d3
+	DC.L	LAB_0058
+	DC.L	$1dfdbfcc,$500a94ed,$434f4e3a
+LAB_012A:
+	DC.B	"0/0/640/200/Ou"
+LAB_012B:
+	DC.W	$7470
+LAB_012C:
+	DC.W	$7574
+LAB_012D:
+	DS.W	1
+	DC.L	LAB_00BE
+	DC.L	$21657f17,$5184fee1,$6483d998
+	DS.W	1
+LAB_012E:
+	DS.L	3
+	DS.W	1
+LAB_012F:
+	DS.L	2
+LAB_0130:
+	DS.L	1
+	DS.W	1
+LAB_0131:
+	DS.L	2
+	DS.W	1
+
+
+	SECTION S_5,CODE
+
+SECSTRT_5:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0133:
+	BSR.W	LAB_0145
+	DBF	D0,LAB_0133
+	LEA	LAB_016F,A6
+LAB_0134:
+	MOVE.L	#LAB_004A,-(A7)
+	DBF	D1,LAB_0134
+LAB_0135:
+	CMP.L	#$0000cd61,D0
+LAB_0136:
+	LEA	LAB_015C,A2
+	JSR	-180(A6)
+	BSR.W	LAB_0161
+LAB_0138:
+	JSR	-618(A6)
+	DBF	D7,LAB_0138
+	MOVE.L	D6,D7
+LAB_0139:
+	CMP.L	#$0000edce,D5
+	DBF	D5,LAB_0139
+LAB_013A:
+	BSR.W	LAB_0161
+	ADDQ.L	#5,A3
+LAB_013B:
+	JSR	-450(A6)
+LAB_013C:
+	DBF	D5,LAB_013B
+	JSR	LAB_0161
+LAB_013D:
+	BNE.S	LAB_013B
+LAB_013E:
+	BRA.S	LAB_0140
+	DC.W	$646f
+	DC.W	$732e
+LAB_013F:
+	DC.W	$6c69
+	BHI.S	LAB_014E+2
+	BSR.S	LAB_014E+4
+	DC.W	$7900
+LAB_0140:
+	BNE.S	LAB_013D
+	LEA	LAB_013A(PC),A0
+LAB_0141:
+	BRA.S	LAB_0142
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0142:
+	BSR.W	LAB_0161
+	BNE.S	LAB_0141
+	LEA	LAB_0136+2(PC),A2
+LAB_0143:
+	LEA	LAB_0136(PC),A2
+LAB_0144:
+	BSR.W	LAB_0145
+	MOVE.L	#LAB_00A2+2,-(A7)
+	BNE.S	LAB_0143
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0145:
+	BSR.W	LAB_015B
+	LEA	LAB_0135+4(PC),A2
+LAB_0146:
+	JSR	-72(A6)
+LAB_0147:
+	DBF	D3,LAB_0146
+	BNE.S	LAB_0147
+LAB_0149:
+	JSR	-156(A6)
+LAB_014A:
+	DBF	D5,LAB_0149
+	DBF	D3,LAB_014A
+	BSR.W	LAB_015B
+LAB_014B:
+	LEA	LAB_0056,A6
+LAB_014C:
+	JSR	LAB_0161
+	DBF	D7,LAB_014C
+LAB_014D:
+	BNE.S	LAB_014B
+	DBF	D6,LAB_014D
+	MOVEQ	#-69,D3
+	MOVE.L	D5,D6
+LAB_014E:
+	MOVE.L	#LAB_0066,-(A7)
+	MOVE.L	#SECSTRT_6+2,-(A7)
+LAB_0151:
+	MOVE.L	#LAB_019E,-(A7)
+	BNE.S	LAB_014E
+LAB_0152:
+	BSR.W	LAB_015B
+	DBF	D4,LAB_0152
+	MOVE.L	#LAB_010C,-(A7)
+	CMP.L	#$00003846,D5
+LAB_0153:
+	JSR	LAB_0161
+LAB_0154:
+	BSR.W	LAB_015B
+LAB_0155:
+	DBF	D0,LAB_0154
+LAB_0156:
+	DBF	D3,LAB_0155
+LAB_0157:
+	JSR	LAB_0167
+	BSR.W	LAB_0161
+LAB_0158:
+	ADD.L	D1,D0
+LAB_0159:
+	DBF	D1,LAB_0158
+	DBF	D3,LAB_0159
+	MOVE.L	D6,D5
+LAB_015A:
+	BSR.W	LAB_0161
+	BSR.W	LAB_0167
+	BNE.S	LAB_015A
+	RTS
+LAB_015B:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0161
+	MOVE.W	11855(A5),14035(A5)
+LAB_015C:
+	TST.L	D6
+LAB_015D:
+	DBF	D0,LAB_015C
+	CMPI.L	#$000000a2,D0
+	BNE.S	LAB_015D
+	MOVEQ	#102,D7
+LAB_015E:
+	BSR.W	LAB_0167
+LAB_015F:
+	DBF	D4,LAB_015E
+	MOVE.L	842(A5),D5
+LAB_0160:
+	BNE.S	LAB_015F
+	DBF	D6,LAB_0160
+	JSR	-204(A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0161:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0167
+LAB_0162:
+	ADDQ.L	#3,A1
+	JSR	-384(A6)
+LAB_0163:
+	BNE.S	LAB_0162
+	DBF	D7,LAB_0163
+	LEA	LAB_012F,A2
+LAB_0164:
+	MOVE.L	1002(A5),D3
+	DBF	D6,LAB_0164
+	BSR.W	LAB_0179
+	MOVE.L	D0,D1
+	MOVEQ	#-124,D6
+	ADD.W	D0,D0
+	MOVE.W	LAB_0165(PC,D0.W),D0
+	JMP	LAB_0165(PC,D0.W)
+LAB_0165:
+	ORI.B	#$0a,D6
+	DC.W	$000e
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+LAB_0166:
+	MOVEQ	#2,D0
+	RTS
+LAB_0167:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0168:
+	BSR.W	LAB_016D
+	DBF	D1,LAB_0168
+	MOVE.W	21195(A5),6830(A5)
+	ADD.L	D3,D3
+	MOVE.L	D4,D7
+	MOVE.W	24908(A5),2446(A5)
+LAB_0169:
+	BSR.W	LAB_0179
+	BSR.W	LAB_0179
+	BNE.S	LAB_0169
+	ADDQ.L	#1,A0
+	JSR	-426(A6)
+	LEA	LAB_0100,A0
+	MOVE.L	D2,D7
+LAB_016A:
+	JSR	LAB_016D
+	MOVEQ	#69,D7
+	JSR	-654(A6)
+	MOVE.L	D7,D5
+LAB_016B:
+	BSR.W	LAB_016D
+	DBF	D2,LAB_016B
+LAB_016C:
+	MOVEQ	#61,D3
+	DBF	D7,LAB_016C
+	JSR	-384(A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_016D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0179
+	BSR.W	LAB_0183
+LAB_016E:
+	MOVEQ	#2,D5
+LAB_016F:
+	DBF	D4,LAB_016E
+LAB_0170:
+	BRA.S	LAB_0172
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+LAB_0171:
+	MOVE.L	25610(A4),0(A2)
+LAB_0172:
+	JSR	-594(A6)
+	DBF	D6,LAB_0172
+	BNE.S	LAB_0170
+	ADD.L	D3,D5
+	BSR.W	LAB_0183
+LAB_0173:
+	JSR	-96(A6)
+	JSR	-708(A6)
+	BNE.S	LAB_0173
+	MOVEQ	#-88,D6
+	JSR	LAB_0179
+LAB_0174:
+	LEA	LAB_0149(PC),A4
+	BNE.S	LAB_0174
+	ADDQ.L	#5,A0
+	BRA.S	LAB_0175
+	DC.W	$2573
+	MOVE.W	-(A0),D5
+	MOVE.L	25610(A4),0(A2)
+LAB_0175:
+	MOVE.L	10990(A5),D7
+	ADD.L	D0,D5
+	MOVE.L	#LAB_01D0+2,-(A7)
+	CMPI.L	#$00000018,D6
+LAB_0176:
+	MOVE.L	#LAB_00E2,-(A7)
+	ADD.L	D4,D4
+	MOVEQ	#103,D4
+	BNE.S	LAB_0176
+	ADD.L	D3,D2
+	JSR	LAB_0179
+	BSR.W	LAB_0179
+LAB_0177:
+	CMPI.L	#$00000088,D2
+	DBF	D5,LAB_0177
+	JSR	LAB_017D
+	ADD.L	D0,D6
+LAB_0178:
+	MOVE.W	19035(A5),15119(A5)
+	DBF	D1,LAB_0178
+	LEA	LAB_0157+2(PC),A2
+	BNE.S	LAB_0178
+	MOVE.L	#LAB_00C0,-(A7)
+	MOVE.W	6478(A5),18684(A5)
+	BSR.W	LAB_0179
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0179:
+	BSR.W	LAB_017D
+LAB_017A:
+	DBF	D1,LAB_0179
+	CMPI.L	#$00000011,D7
+	BNE.S	LAB_017A
+LAB_017B:
+	ADD.W	D0,D0
+	MOVE.W	LAB_017C(PC,D0.W),D0
+	JMP	LAB_017C(PC,D0.W)
+LAB_017C:
+	DC.W	$000a
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	DC.W	$001a
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+LAB_017D:
+	BSR.W	LAB_0183
+LAB_017E:
+	ADD.L	D1,D6
+	ADD.L	D1,D4
+	BNE.S	LAB_017E
+	MOVE.L	D7,D7
+LAB_017F:
+	MOVE.L	#LAB_00EF,-(A7)
+	DBF	D7,LAB_017F
+LAB_0180:
+	LEA	LAB_0171(PC),A2
+	ADD.W	D0,D0
+	MOVE.W	LAB_0181(PC,D0.W),D0
+	JMP	LAB_0181(PC,D0.W)
+LAB_0181:
+	DC.W	$000a
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	DC.W	$001a
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_0182:
+	MOVEQ	#4,D0
+	RTS
+LAB_0183:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0184:
+	BSR.W	LAB_0186
+	DBF	D2,LAB_0184
+	ADD.W	D0,D0
+	MOVE.W	LAB_0185(PC,D0.W),D0
+	JMP	LAB_0185(PC,D0.W)
+LAB_0185:
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+	ORI.B	#$26,-(A2)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+LAB_0186:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0189
+	MOVE.L	#LAB_00FC,-(A7)
+	BSR.W	LAB_0189
+LAB_0187:
+	MOVE.L	#LAB_0003,-(A7)
+	DBF	D3,LAB_0187
+	MOVE.L	#LAB_002C,-(A7)
+	MOVE.L	12636(A5),D1
+	CMPI.L	#$00000020,D2
+	BSR.W	LAB_0189
+	MOVEQ	#118,D1
+	MOVE.L	20980(A5),D3
+	ADDQ.L	#4,A1
+	BSR.W	LAB_0189
+LAB_0188:
+	MOVE.L	#LAB_0030,-(A7)
+	CMPI.L	#$0000001c,D3
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0189:
+	JSR	SECSTRT_6
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_6,CODE
+
+SECSTRT_6:
+	BSR.W	LAB_019D
+	TST.L	D3
+LAB_018C:
+	ADD.L	D4,D3
+	BSR.W	LAB_01A8
+LAB_018D:
+	BNE.S	LAB_018C
+LAB_018E:
+	MOVE.L	D7,D2
+	BNE.S	LAB_018D
+LAB_018F:
+	MOVE.L	D4,D0
+	BNE.S	LAB_018F
+LAB_0190:
+	ADD.L	D4,D5
+	CMP.L	#$00001b0f,D3
+LAB_0191:
+	MOVE.L	#LAB_0062,-(A7)
+	MOVE.L	#LAB_0110,-(A7)
+	JSR	-678(A6)
+	CMPI.L	#$0000000e,D4
+LAB_0192:
+	MOVE.L	#LAB_0124,-(A7)
+LAB_0193:
+	DBF	D0,LAB_0192
+	DBF	D7,LAB_0193
+	BSR.W	LAB_01A8
+	MOVEQ	#-83,D4
+LAB_0194:
+	BSR.W	LAB_01A8
+LAB_0195:
+	LEA	LAB_0191+2(PC),A4
+	DBF	D2,LAB_0195
+	ADD.L	D6,D1
+LAB_0196:
+	JSR	LAB_019D
+	ADDQ.L	#4,A5
+	BNE.S	LAB_0196
+	MOVE.W	12813(A5),24361(A5)
+	MOVE.W	24875(A5),4905(A5)
+LAB_0197:
+	LEA	LAB_0197(PC),A6
+LAB_0198:
+	MOVE.L	#LAB_010B+2,-(A7)
+	DBF	D5,LAB_0198
+	JSR	-612(A6)
+	MOVE.L	D3,D6
+LAB_0199:
+	LEA	LAB_0120,A4
+LAB_019B:
+	BNE.S	LAB_0199
+	DBF	D1,LAB_019B
+	LEA	LAB_005D,A6
+	BSR.W	LAB_01A8
+LAB_019C:
+	MOVE.L	#LAB_00E8,-(A7)
+	DBF	D3,LAB_019C
+	RTS
+LAB_019D:
+	LINK.W	A5,#-160
+	BSR.W	LAB_01A8
+	ADD.L	D7,D6
+LAB_019E:
+	TST.L	D1
+	JSR	-132(A6)
+	BNE.S	LAB_019E
+	BRA.S	LAB_019F
+	SUBQ.W	#3,29291(A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_019F:
+	JSR	-654(A6)
+	BRA.S	LAB_01A0
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	12335(A7),D0
+	MOVE.W	47(A4,D3.W),D3
+	MOVE.W	47(A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_01A0:
+	MOVE.L	#LAB_011F,-(A7)
+LAB_01A1:
+	CMPI.L	#$00000008,D3
+	CMP.L	#$0000c0d0,D5
+	BNE.S	LAB_01A1
+LAB_01A2:
+	MOVE.W	24126(A5),11266(A5)
+LAB_01A3:
+	BNE.S	LAB_01A2
+	BNE.S	LAB_01A2
+LAB_01A4:
+	LEA	LAB_018E(PC),A2
+	CMPI.L	#$00000067,D3
+	BNE.S	LAB_01A4
+LAB_01A5:
+	BNE.S	LAB_01A4
+	DBF	D4,LAB_01A5
+	ADD.L	D7,D4
+	ADD.L	D3,D4
+	CMPI.L	#$00000024,D3
+	CMP.L	#$00002593,D4
+	JSR	LAB_01A8
+	BSR.W	LAB_01AE
+LAB_01A6:
+	BSR.W	LAB_01A8
+LAB_01A7:
+	BSR.W	LAB_01AE
+	DBF	D7,LAB_01A7
+	BNE.S	LAB_01A6
+	UNLK	A5
+	RTS
+LAB_01A8:
+	BSR.W	LAB_01AE
+	MOVEQ	#-115,D4
+LAB_01A9:
+	BSR.W	LAB_01AE
+	BSR.W	LAB_01AE
+	LEA	LAB_0199+4(PC),A2
+	BNE.S	LAB_01A9
+	MOVE.L	21814(A5),D6
+	LEA	LAB_0190(PC),A0
+LAB_01AA:
+	LEA	LAB_01A3(PC),A6
+	DBF	D3,LAB_01AA
+	BNE.S	LAB_01AA
+LAB_01AB:
+	BSR.W	LAB_01AE
+	MOVEQ	#-14,D1
+	BNE.S	LAB_01AB
+	MOVEQ	#-123,D2
+LAB_01AC:
+	CMPI.L	#$000000e4,D3
+	MOVE.L	20006(A5),D3
+	BSR.W	LAB_01C5
+	BNE.S	LAB_01AC
+	MOVE.L	23226(A5),D0
+	ADD.W	D0,D0
+	MOVE.W	LAB_01AD(PC,D0.W),D0
+	JMP	LAB_01AD(PC,D0.W)
+LAB_01AD:
+	DC.W	$000e
+	ORI.B	#$16,(A2)
+	ORI.B	#$1e,(A2)+
+	ORI.B	#$26,-(A2)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+	MOVEQ	#6,D0
+	RTS
+LAB_01AE:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_01AF:
+	BSR.W	LAB_01B7
+LAB_01B0:
+	DBF	D2,LAB_01AF
+	BSR.W	LAB_01C5
+LAB_01B1:
+	JSR	-414(A6)
+	MOVE.L	20510(A5),D6
+LAB_01B2:
+	BSR.W	LAB_01CA
+LAB_01B3:
+	DBF	D0,LAB_01B2
+	BSR.W	LAB_01CA
+	LEA	LAB_0199+4(PC),A4
+	BNE.S	LAB_01B3
+LAB_01B4:
+	CMPI.L	#$000000f6,D6
+	JSR	-408(A6)
+	BSR.W	LAB_01B7
+	JSR	-708(A6)
+	LEA	LAB_00A2,A0
+	MOVE.L	D5,D2
+	LEA	LAB_01B4+4(PC),A4
+LAB_01B5:
+	LEA	LAB_01AC(PC),A2
+	DBF	D0,LAB_01B5
+	ADD.W	D0,D0
+	MOVE.W	LAB_01B6(PC,D0.W),D0
+	JMP	LAB_01B6(PC,D0.W)
+LAB_01B6:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_01B7:
+	LINK.W	A5,#-168
+	BSR.W	LAB_01C5
+LAB_01B8:
+	MOVE.L	#LAB_0111+2,-(A7)
+LAB_01B9:
+	DBF	D1,LAB_01B8
+LAB_01BA:
+	BSR.W	LAB_01CD
+	DBF	D1,LAB_01BA
+LAB_01BB:
+	BSR.W	LAB_01CA
+	LEA	LAB_0040,A2
+	BNE.S	LAB_01BB
+LAB_01BC:
+	MOVE.L	#LAB_005C+2,-(A7)
+	BSR.W	LAB_01CA
+	ADD.L	D4,D4
+LAB_01BD:
+	BNE.S	LAB_01BC
+	DBF	D1,LAB_01BD
+LAB_01BE:
+	LEA	LAB_0197,A6
+	DBF	D3,LAB_01BE
+LAB_01C0:
+	ADD.L	D4,D7
+LAB_01C1:
+	DBF	D2,LAB_01C0
+	ADD.L	D1,D6
+	BNE.S	LAB_01C1
+LAB_01C2:
+	ADD.L	D3,D1
+LAB_01C3:
+	DBF	D5,LAB_01C2
+LAB_01C4:
+	BSR.W	LAB_01CD
+	LEA	LAB_0151+4,A2
+	BNE.S	LAB_01C4
+	UNLK	A5
+	RTS
+LAB_01C5:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_01CA
+	LEA	LAB_00B6,A6
+LAB_01C6:
+	TST.L	D5
+	BSR.W	LAB_01CD
+	LEA	LAB_01C3(PC),A6
+	BSR.W	LAB_01CA
+	ADDQ.L	#1,A1
+	MOVEQ	#109,D1
+	CMP.L	#$00009c72,D6
+	MOVE.W	22922(A5),15033(A5)
+	MOVE.W	3745(A5),19708(A5)
+	BSR.W	LAB_01CD
+	MOVE.L	D5,D6
+	LEA	LAB_01B1(PC),A2
+	LEA	LAB_0182,A6
+LAB_01C7:
+	LEA	LAB_005A,A4
+LAB_01C8:
+	DBF	D2,LAB_01C7
+	DBF	D4,LAB_01C8
+	ADDQ.L	#5,A1
+	BNE.S	LAB_01C8
+	MOVE.L	D0,D2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+LAB_01C9:
+	RTS
+LAB_01CA:
+	LINK.W	A5,#-20
+LAB_01CB:
+	BSR.W	LAB_01CD
+	JSR	-204(A6)
+	MOVE.L	#LAB_005F,-(A7)
+	BNE.S	LAB_01CB
+	JSR	-906(A6)
+	JSR	-594(A6)
+	JSR	LAB_01DA
+	MOVE.L	#LAB_012A,-(A7)
+LAB_01CC:
+	LEA	LAB_01C6(PC),A6
+	DBF	D0,LAB_01CC
+	MOVE.L	#LAB_00B8,-(A7)
+	UNLK	A5
+	RTS
+LAB_01CD:
+	LINK.W	A5,#-100
+	BSR.W	LAB_01D3
+	JSR	-546(A6)
+	MOVE.L	D6,D0
+	BSR.W	LAB_01DA
+	BSR.W	LAB_01DA
+	BSR.W	LAB_01DA
+	LEA	LAB_0153,A6
+	BSR.W	LAB_01DA
+LAB_01CE:
+	LEA	LAB_016A,A0
+	CMP.L	#$000013c7,D2
+	BNE.S	LAB_01CE
+	BNE.S	LAB_01CE
+LAB_01CF:
+	BSR.W	LAB_01DA
+LAB_01D0:
+	DBF	D2,LAB_01CF
+LAB_01D2:
+	DBF	D4,LAB_01D0
+	UNLK	A5
+	RTS
+LAB_01D3:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_01DA
+LAB_01D4:
+	MOVE.L	#LAB_0127,-(A7)
+	MOVE.L	#LAB_007D,-(A7)
+LAB_01D5:
+	MOVEQ	#102,D6
+	BNE.S	LAB_01D4
+LAB_01D6:
+	BNE.S	LAB_01D5
+	MOVE.L	#LAB_0080,-(A7)
+LAB_01D7:
+	BNE.S	LAB_01D6
+	BNE.S	LAB_01D7
+	MOVE.L	27620(A5),D4
+	JSR	LAB_01DA
+LAB_01D8:
+	LEA	LAB_0079+2,A6
+	DBF	D0,LAB_01D8
+	JSR	-300(A6)
+	ADD.W	D0,D0
+	MOVE.W	LAB_01D9(PC,D0.W),D0
+	JMP	LAB_01D9(PC,D0.W)
+LAB_01D9:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_01DA:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+	END
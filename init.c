@@ -20,11 +20,13 @@
 #include "amiga_hunks.h"
 #include "atari.h"
 #include "binary.h"
+#include "cache.h"
 #include "elf.h"
 #include "init.h"
 #include "ira_2.h"
 #include "config.h"
 #include "constants.h"
+#include "stats.h"
 #include "supp.h"
 
 ira_t *Start(void) {
@@ -39,6 +41,7 @@ ira_t *Start(void) {
 
     ira->reloc.relocMax = 1024;
     ira->symbols.symbolMax = 16;
+    ira->symbols.symbolHashMask = 31;
     ira->codeArea.codeAreaMax = 16;
     ira->codeArea.cnfCodeAreaMax = 16;
     ira->codeArea.codeAdrMax = 16;
@@ -52,38 +55,128 @@ ira_t *Start(void) {
     ira->pass = -1;
     ira->LabX_len = 400;
     ira->adrlen = 0;
+    ira->progressLines = 200;
+
+    ira->files.msgFile = stdout;
+    ira->files.errFile = stderr;
 
     return ira;
 }
 
+static void FreeComments(Comment_t *p) {
+    Comment_t *next;
+
+    for (; p; p = next) {
+        next = p->next;
+        myfree(p->commentText);
+        myfree(p);
+    }
+}
+
+void FreeIra(ira_t *ira) {
+    Equate_t *equate, *next;
+    char *block;
+
+    /* note: myfree(NULL) does nothing, so what has not been allocated yet needs no check */
+    if (ira->filenames.binaryName != ira->filenames.sourceName)
+        myfree(ira->filenames.binaryName);
+    myfree(ira->filenames.sourceName);
+    myfree(ira->filenames.targetName);
+    myfree(ira->filenames.configName);
+    myfree(ira->filenames.cacheName);
+    myfree(ira->stats);
+    myfree(ira->configLine);
+    myfree(ira->textParts);
+    myfree(ira->areaOffset);
+    if (ira->cacheRead)
+        FreeIra(ira->cacheRead);
+
+    myfree(ira->reloc.relocs);
+    myfree(ira->label.labelAdr);
+    myfree(ira->LabelAdr2);
+    myfree(ira->LabelNum);
+    myfree(ira->XRefList);
+
+    while ((block = ira->symbols.symbolBlocks)) {
+        ira->symbols.symbolBlocks = *(char **) block;
+        myfree(block);
+    }
+    myfree(ira->symbols.symbolName);
+    myfree(ira->symbols.symbolValue);
+    myfree(ira->symbols.symbolHash);
+
+    myfree(ira->codeArea.codeArea1);
+    myfree(ira->codeArea.codeArea2);
+    myfree(ira->codeArea.cnfCodeArea1);
+    myfree(ira->codeArea.cnfCodeArea2);
+    myfree(ira->codeArea.codeAdr);
+    myfree(ira->noBase.noBaseStart);
+    myfree(ira->noBase.noBaseEnd);
+    myfree(ira->noPtr.noPtrStart);
+    myfree(ira->noPtr.noPtrEnd);
+    myfree(ira->text.textStart);
+    myfree(ira->text.textEnd);
+    myfree(ira->jmp.jmpTable);
+
+    FreeComments(ira->comments);
+    FreeComments(ira->banners);
+    for (equate = ira->equates; equate; equate = next) {
+        next = equate->next;
+        myfree(equate->equateName);
+        myfree(equate);
+    }
+    myfree(ira->commentByAdr);
+    myfree(ira->bannerByAdr);
+    myfree(ira->equateByAdr);
+    myfree(ira->equateNames);
+
+    myfree(ira->opCodeTable);
+    myfree(ira->buffer);
+    myfree(ira->DRelocBuffer);
+    myfree(ira->RelocBuffer);
+    myfree(ira->adrMap);
+    myfree(ira->hunksMemoryType);
+    myfree(ira->hunksMemoryAttrs);
+    myfree(ira->hunksSize);
+    myfree(ira->hunksContent);
+    myfree(ira->hunksType);
+    myfree(ira->hunksOffs);
+    myfree(ira);
+}
+
+/* Options up to the first argument that isn't one */
+void InitOptions(ira_t *ira, int argc, char **argv, int *nextarg) {
+    uint16_t addrstyle = CPU_ADDR_STYLE;
+
+    ReadOptions(ira, argc, argv, nextarg, &addrstyle);
+
+    /* Let's check CPU and FPUs */
+    CheckCPU(ira);
+
+    /* By default, CPU will choose the addressing style (old style for 68000/010, new style for others).
+     * If a style is explicitly asked, it will be used ignoring CPU. */
+    if ((addrstyle == CPU_ADDR_STYLE && (ira->params.cpuType & (M68000 | M68010))) || addrstyle == OLD_ADDR_STYLE)
+        ira->params.pFlags |= OLDSTYLE;
+}
+
 void Init(ira_t *ira, int argc, char **argv) {
     int nextarg = 1;
-    uint32_t i;
-    uint16_t addrstyle = CPU_ADDR_STYLE;
 
     /* If argc lesser than 2: IRA is missing some arguments */
     if (argc < 2) {
 #ifdef AMIGAOS
         /* argc equals 0 means "launched from Workbench" on AmigaOS. */
         if (argc == 0)
-            fprintf(stderr, "IRA launching from Workbench is not yet supported\n\n");
+            fprintf(ira->files.errFile, "IRA launching from Workbench is not yet supported\n\n");
 #endif
         FormatError();
         ExitPrg("");
     }
 
-    fprintf(stderr, IDSTRING1, VERSION, REVISION);
+    fprintf(ira->files.errFile, IDSTRING1, VERSION, REVISION);
 
     /* Get everything we can from command line */
-    ReadOptions(ira, argc, argv, &nextarg, &addrstyle);
-
-    /* Let's check CPU and FPUs */
-    CheckCPU(ira);
-
-    /* By default, CPU will choose the addressing style (old style for 68000/010, new style for others).
-     * If a style is explicitly asked, it will be used ignoring CPU. */
-    if ((addrstyle == CPU_ADDR_STYLE && (ira->params.cpuType & (M68000 | M68010))) || addrstyle == OLD_ADDR_STYLE)
-        ira->params.pFlags |= OLDSTYLE;
+    InitOptions(ira, argc, argv, &nextarg);
 
     /* All options are now handled, let's go to source and target file's name stuff. */
 
@@ -91,25 +184,29 @@ void Init(ira_t *ira, int argc, char **argv) {
     if (nextarg >= argc)
         ExitPrg("No source specified!");
 
-    /* note: mystrdup() uses myalloc() which doesn't return if allocation failed, so no need to check returned value */
-    ira->filenames.sourceName = mystrdup(argv[nextarg++]);
-
-    /* Let's check if source file is readable. */
-    if (!(ira->files.sourceFile = fopen(ira->filenames.sourceName, "rb")))
-        ExitPrg("Can't open source file \"%s\".", ira->filenames.sourceName);
+    /* With -BATCH the source lists the sources, every one of them is read by its own job */
+    if (ira->params.pFlags & BATCH) {
+        if (ira->params.pFlags & SERVE)
+            ExitPrg("-BATCH and -SERVE can't be used together.");
+        if (nextarg + 1 < argc)
+            ExitPrg("-BATCH takes no target, targets are named after their sources.");
+        ira->filenames.sourceName = mystrdup(argv[nextarg]);
+        return;
+    }
 
-    /* If target is specified (in next argument), so be it */
-    if (nextarg < argc)
-        ira->filenames.targetName = mystrdup(argv[nextarg]);
-    /* Else, let's build it with source's name with ASM extension. */
-    else
-        ira->filenames.targetName = ExtendFileName(ira->filenames.sourceName, ASM_EXT);
+    /* With -SERVE the source is the socket, jobs name their sources and targets */
+    if (ira->params.pFlags & SERVE) {
+        if (nextarg + 1 < argc)
+            ExitPrg("-SERVE takes no target, every job names its own.");
+        ira->filenames.sourceName = mystrdup(argv[nextarg]);
+        return;
+    }
 
-    /* Let's build other names from source name with appropriate extensions */
-    ira->filenames.configName = ExtendFileName(ira->filenames.sourceName, CONFIG_EXT);
-    ira->filenames.binaryName = ExtendFileName(ira->filenames.sourceName, BIN_EXT);
-    ira->filenames.labelName = ExtendFileName(ira->filenames.sourceName, LABEL_EXT);
+    InitSource(ira, argv[nextarg], nextarg + 1 < argc ? argv[nextarg + 1] : NULL);
+}
 
+/* Reads the source, and the config file */
+static void LoadSource(ira_t *ira) {
     /* If source type wasn't forced to binary, let's find out the file type. */
     if (!ira->params.sourceType)
         ira->params.sourceType = AutoScan(ira);
@@ -119,39 +216,37 @@ void Init(ira_t *ira, int argc, char **argv) {
         ira->reloc.relocMax = 1;
 
     /* Let's try to get some memory */
-    ira->label.labelAdr = mycalloc(ira->label.labelMax * 4);
-    ira->reloc.relocAdr = mycalloc(ira->reloc.relocMax * 4);
-    /* note: mycalloc() doesn't return if allocation failed, so no need to check returned value */
-    ira->reloc.relocAdr[0] = 1; /* If no Reloc found */
-    ira->reloc.relocOff = mycalloc(ira->reloc.relocMax * 4);
-    ira->reloc.relocVal = mycalloc(ira->reloc.relocMax * 4);
-    ira->reloc.relocMod = mycalloc(ira->reloc.relocMax * 4);
-    ira->symbols.symbolName = mycalloc(ira->symbols.symbolMax * sizeof(char *));
-    ira->symbols.symbolValue = mycalloc(ira->symbols.symbolMax * sizeof(uint32_t));
-    ira->codeArea.codeArea1 = mycalloc(ira->codeArea.codeAreaMax * sizeof(uint32_t));
-    ira->codeArea.codeArea2 = mycalloc(ira->codeArea.codeAreaMax * sizeof(uint32_t));
-    ira->codeArea.cnfCodeArea1 = mycalloc(ira->codeArea.cnfCodeAreaMax * sizeof(uint32_t));
-    ira->codeArea.cnfCodeArea2 = mycalloc(ira->codeArea.cnfCodeAreaMax * sizeof(uint32_t));
-    ira->codeArea.codeAdr = mycalloc(ira->codeArea.codeAdrMax * sizeof(uint32_t));
-    ira->noBase.noBaseStart = mycalloc(ira->noBase.noBaseMax * sizeof(uint32_t));
-    ira->noBase.noBaseEnd = mycalloc(ira->noBase.noBaseMax * sizeof(uint32_t));
-    ira->noPtr.noPtrStart = mycalloc(ira->noPtr.noPtrMax * sizeof(uint32_t));
-    ira->noPtr.noPtrEnd = mycalloc(ira->noPtr.noPtrMax * sizeof(uint32_t));
-    ira->text.textStart = mycalloc(ira->text.textMax * sizeof(uint32_t));
-    ira->text.textEnd = mycalloc(ira->text.textMax * sizeof(uint32_t));
-    ira->jmp.jmpTable = mycalloc(ira->jmp.jmpMax * sizeof(JMPTab_t));
+    ira->label.labelAdr = mytcalloc(ira->label.labelMax * 4, MEM_LABELS);
+    ira->reloc.relocs = mytcalloc(ira->reloc.relocMax * sizeof(Relocation_t), MEM_RELOCS);
+    /* note: mytcalloc() doesn't return if allocation failed, so no need to check returned value */
+    ira->reloc.relocs[0].adr = 1; /* If no Reloc found */
+    ira->symbols.symbolName = mytcalloc(ira->symbols.symbolMax * sizeof(char *), MEM_SYMBOLS);
+    ira->symbols.symbolValue = mytcalloc(ira->symbols.symbolMax * sizeof(uint32_t), MEM_SYMBOLS);
+    ira->symbols.symbolHash = mytcalloc((ira->symbols.symbolHashMask + 1) * sizeof(uint32_t), MEM_SYMBOLS);
+    ira->codeArea.codeArea1 = mytcalloc(ira->codeArea.codeAreaMax * sizeof(uint32_t), MEM_CODEAREAS);
+    ira->codeArea.codeArea2 = mytcalloc(ira->codeArea.codeAreaMax * sizeof(uint32_t), MEM_CODEAREAS);
+    ira->codeArea.cnfCodeArea1 = mytcalloc(ira->codeArea.cnfCodeAreaMax * sizeof(uint32_t), MEM_CODEAREAS);
+    ira->codeArea.cnfCodeArea2 = mytcalloc(ira->codeArea.cnfCodeAreaMax * sizeof(uint32_t), MEM_CODEAREAS);
+    ira->codeArea.codeAdr = mytcalloc(ira->codeArea.codeAdrMax * sizeof(uint32_t), MEM_CODEAREAS);
+    ira->noBase.noBaseStart = mytcalloc(ira->noBase.noBaseMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->noBase.noBaseEnd = mytcalloc(ira->noBase.noBaseMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->noPtr.noPtrStart = mytcalloc(ira->noPtr.noPtrMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->noPtr.noPtrEnd = mytcalloc(ira->noPtr.noPtrMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->text.textStart = mytcalloc(ira->text.textMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->text.textEnd = mytcalloc(ira->text.textMax * sizeof(uint32_t), MEM_CONFIG);
+    ira->jmp.jmpTable = mytcalloc(ira->jmp.jmpMax * sizeof(JMPTab_t), MEM_CONFIG);
 
     /* Source file read according to its chosen or detected type */
     switch (ira->params.sourceType & SOURCE_FAMILY_MASK) {
         case SOURCE_FAMILY_AMIGA:
-            /* Let's try to open binary file */
-            if ((ira->files.binaryFile = fopen(ira->filenames.binaryName, "wb")))
-                if (ira->params.sourceType == AMIGA_HUNK_EXECUTABLE)
-                    ReadAmigaHunkExecutable(ira);
-                else
-                    ReadAmigaHunkObject(ira);
+            /* Relocated hunks are kept in memory, binary file is only written when asked for */
+            if (ira->params.pFlags & KEEP_BINARY)
+                if (!(ira->files.binaryFile = fopen(ira->filenames.binaryName, "wb")))
+                    ExitPrg("Can't open binary file \"%s\" for writing.", ira->filenames.binaryName);
+            if (ira->params.sourceType == AMIGA_HUNK_EXECUTABLE)
+                ReadAmigaHunkExecutable(ira);
             else
-                ExitPrg("Can't open binary file \"%s\" for writing.", ira->filenames.binaryName);
+                ReadAmigaHunkObject(ira);
             break;
         case SOURCE_FAMILY_ATARI:
             ReadAtariExecutable(ira);
@@ -167,32 +262,16 @@ void Init(ira_t *ira, int argc, char **argv) {
             break;
     }
 
-    /* Initial reading is done, let's close files to open them again differently, later */
+    /* Initial reading is done, ira->buffer contains everything, let's close files */
     if (ira->files.sourceFile)
         fclose(ira->files.sourceFile);
     if (ira->files.binaryFile)
         fclose(ira->files.binaryFile);
     ira->files.binaryFile = ira->files.sourceFile = NULL;
 
-    /* A binary file has been created, containing everything, its size is the program size */
-    ira->params.prgLen = FileLength((uint8_t *)ira->filenames.binaryName);
-
-    /* Open binary file */
-    if (!(ira->files.binaryFile = fopen(ira->filenames.binaryName, "rb")))
-        ExitPrg("Can't open binary file \"%s\" for reading.", ira->filenames.binaryName);
-
-    /* Open labels file */
-    if (!(ira->files.labelFile = fopen(ira->filenames.labelName, "wb")))
-        ExitPrg("Can't open label file \"%s\" for writing.", ira->filenames.labelName);
-
-    /* note: mycalloc() doesn't return if allocation failed, so no need to check returned value */
-    ira->LabelNum = mycalloc(ira->hunkCount * sizeof(uint32_t));
-    ira->XRefList = mycalloc(ira->LabX_len * sizeof(uint32_t));
-    ira->buffer = mycalloc(ira->params.prgLen + 4);
-
-    /* Has binary file the expected size ? */
-    if ((fread(ira->buffer, 1, ira->params.prgLen, ira->files.binaryFile)) != ira->params.prgLen)
-        ExitPrg("Can't read all data (binary file has not expected size).");
+    /* note: mytcalloc() doesn't return if allocation failed, so no need to check returned value */
+    ira->LabelNum = mytcalloc(ira->hunkCount * sizeof(uint32_t), MEM_LABELS);
+    ira->XRefList = mytcalloc(ira->LabX_len * sizeof(uint32_t), MEM_XREFS);
 
     /* Something obvious about program's end */
     ira->params.prgEnd = ira->params.prgStart + ira->params.prgLen;
@@ -225,17 +304,47 @@ void Init(ira_t *ira, int argc, char **argv) {
                 ira->baseReg.baseAddress < ira->hunksOffs[ira->baseReg.baseSection] + ira->hunksSize[ira->baseReg.baseSection])
                 break;
     }
+}
 
-    printf("SOURCE : \"%s\"\n", ira->filenames.sourceName);
-    printf("TARGET : \"%s\"\n", ira->filenames.targetName);
+void InitSource(ira_t *ira, char *source, char *target) {
+    uint32_t i;
+
+    /* note: mystrdup() uses myalloc() which doesn't return if allocation failed, so no need to check returned value */
+    ira->filenames.sourceName = mystrdup(source);
+
+    /* Let's check if source file is readable. */
+    if (!(ira->files.sourceFile = fopen(ira->filenames.sourceName, "rb")))
+        ExitPrg("Can't open source file \"%s\".", ira->filenames.sourceName);
+
+    /* If target is specified (in next argument), so be it */
+    if (target)
+        ira->filenames.targetName = mystrdup(target);
+    /* Else, let's build it with source's name with ASM extension. */
+    else
+        ira->filenames.targetName = ExtendFileName(ira->filenames.sourceName, ASM_EXT);
+
+    /* Let's build other names from source name with appropriate extensions */
+    ira->filenames.configName = ExtendFileName(ira->filenames.sourceName, CONFIG_EXT);
+    ira->filenames.binaryName = ExtendFileName(ira->filenames.sourceName, BIN_EXT);
+
+    /* With -CACHE, Pass 1 may already be done */
+    StatsStart(ira);
+    if (!ira->params.cacheDir || !ReadCache(ira))
+        LoadSource(ira);
+    StatsStop(ira, STATS_LOAD);
+
+    fprintf(ira->files.msgFile, "SOURCE : \"%s\"\n", ira->filenames.sourceName);
+    fprintf(ira->files.msgFile, "TARGET : \"%s\"\n", ira->filenames.targetName);
     if (ira->params.pFlags & KEEP_BINARY)
-        printf("BINARY : \"%s\"\n", ira->filenames.binaryName);
+        fprintf(ira->files.msgFile, "BINARY : \"%s\"\n", ira->filenames.binaryName);
     if (ira->params.pFlags & CONFIG)
-        printf("CONFIG : \"%s\"\n", ira->filenames.configName);
+        fprintf(ira->files.msgFile, "CONFIG : \"%s\"\n", ira->filenames.configName);
     for (i = 0; i < cpuname_number; i++)
         if (ira->params.cpuType & (1 << i))
-            printf("MACHINE: %s\n", cpuname[i]);
-    printf("OFFSET : $%08lX\n", (unsigned long) ira->params.prgStart);
+            fprintf(ira->files.msgFile, "MACHINE: %s\n", cpuname[i]);
+    fprintf(ira->files.msgFile, "OFFSET : $%08lX\n", (unsigned long) ira->params.prgStart);
+    if (ira->params.cacheDir)
+        fprintf(ira->files.msgFile, "CACHE  : \"%s\"%s\n", ira->filenames.cacheName, ira->cacheHit ? " (hit)" : "");
 }
 
 void ReadOptions(ira_t *ira, int argc, char **argv, int *nextarg, uint16_t *addrstyle) {
@@ -257,6 +366,12 @@ void ReadOptions(ira_t *ira, int argc, char **argv, int *nextarg, uint16_t *addr
             case 'S':
                 if (!(stricmp(odata, "PLITFILE")))
                     ira->params.pFlags |= SPLITFILE;
+                else if (!(stricmp(odata, "ERVE")))
+                    ira->params.pFlags |= SERVE;
+                else if (!(stricmp(odata, "TATS")))
+                    ira->params.pFlags |= STATS;
+                else if (!(stricmp(odata, "TATS=JSON")))
+                    ira->params.pFlags |= STATS | STATS_JSON;
                 else
                     ExitPrg("Unknown option -%c%s", option, odata);
                 break;
@@ -344,7 +459,10 @@ void ReadOptions(ira_t *ira, int argc, char **argv, int *nextarg, uint16_t *addr
             case 'C':
                 if (!(stricmp(odata, "ONFIG")))
                     ira->params.pFlags |= CONFIG;
-                else if (!(strnicmp(odata, "OMPAT=", 6))) {
+                else if (!(strnicmp(odata, "ACHE=", 5)) && odata[5]) {
+                    myfree(ira->params.cacheDir);
+                    ira->params.cacheDir = mystrdup(&odata[5]);
+                } else if (!(strnicmp(odata, "OMPAT=", 6))) {
                     char c, *p = odata + 6;
 
                     while ((c = *p++)) {
@@ -364,6 +482,17 @@ void ReadOptions(ira_t *ira, int argc, char **argv, int *nextarg, uint16_t *addr
                     ExitPrg("Unknown option -%c%s", option, odata);
                 break;
 
+            case 'J':
+                if (!strnicmp(odata, "OBS=", 4)) {
+                    int32_t jobs = stcd_l(&odata[4]);
+
+                    if (jobs < 1)
+                        ExitPrg("-JOBS=%s: JOBS must be at least 1!", &odata[4]);
+                    ira->params.jobs = jobs;
+                } else
+                    ExitPrg("Unknown option -%c%s", option, odata);
+                break;
+
             case 'K':
                 if (!(stricmp(odata, "EEPZH")))
                     ira->params.pFlags |= KEEP_ZEROHUNKS;
@@ -386,6 +515,8 @@ void ReadOptions(ira_t *ira, int argc, char **argv, int *nextarg, uint16_t *addr
             case 'B':
                 if (!(stricmp(odata, "INARY")))
                     ira->params.sourceType = M68K_BINARY;
+                else if (!(stricmp(odata, "ATCH")))
+                    ira->params.pFlags |= BATCH;
                 else if (!(stricmp(odata, "ASEABS")))
                     ira->params.baseAbs = 1;
                 else if (!(stricmp(odata, "ASEREG")))
@@ -15,11 +15,13 @@
 #define ASM_EXT ".asm"
 #define BIN_EXT ".bin"
 #define CONFIG_EXT ".cnf"
-#define LABEL_EXT ".label"
 
 void CheckCPU(ira_t *);
 char *ExtendFileName(char *, char *);
+void FreeIra(ira_t *);
 void Init(ira_t *, int, char **);
+void InitOptions(ira_t *, int, char **, int *);
+void InitSource(ira_t *, char *, char *);
 void ReadOptions(ira_t *, int, char **, int *, uint16_t *);
 ira_t *Start(void);
 
@@ -15,91 +15,90 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef IRA_THREADS
+#include <unistd.h>
+#endif
 
 #include "ira.h"
 
 #include "amiga_hunks.h"
 #include "atari.h"
+#include "cache.h"
 #include "config.h"
 #include "constants.h"
 #include "elf.h"
 #include "init.h"
 #include "ira_2.h"
 #include "opcode.h"
+#include "stats.h"
 #include "supp.h"
 
-#ifdef AMIGAOS
-const char *VERsion = "$VER: IRA " VERSION "." REVISION " "__AMIGADATE__;
-#endif
-
-ira_t *ira;
-
-int main(int argc, char **argv) {
-    ira = Start();
-
-    Init(ira, argc, argv);
-    GroupOpCodeByNibble(ira);
-    SearchRomTag(ira);
-    if (ira->params.pFlags & PREPROC) {
-        DPass0(ira);
-        CreateConfig(ira);
-    } else if (ira->params.pFlags & CONFIG)
-        CNFAreaToCodeArea(ira);
-    else
-        SectionToArea(ira);
-
-    PrintAreas(&ira->codeArea);
-    DPass1(ira);
-    DPass2(ira);
-
-    ExitPrg(NULL);
-}
+IRA_TLS ira_t *ira;
 
 void FormatError(void) {
-    fprintf(stderr, "Usage  : IRA [Options] <Source> [Target]\n"
-                    "\n"
-                    "Source : Specifies the path of the source.\n"
-                    "Target : Specifies the path of the target.\n"
-                    "Options:\n"
-                    "        -M68xxx           xxx = 000,010,020,030,040,060,851,881,882:\n"
-                    "                          Specifies processor/coprocessor.\n"
-                    "        -BINARY           Treat source file as binary.\n"
-                    "        -A                Append address and data to every line.\n"
-                    "        -AW               Same as -A, but enforce 8-digit addresses.\n"
-                    "        -INFO             Print informations about the hunk's structure.\n"
-                    "        -OFFSET=<offs>    Specifies offset to relocate at.\n"
-                    "        -TEXT=<x>         x = 1: Method for searching text.\n"
-                    "        -KEEPZH           Hunks with zero length are recognized.\n"
-                    "        -KEEPBIN          Keep the file with the binary data.\n"
-                    "        -OLDSTYLE         Addressing modes are M68000 like.\n"
-                    "        -NEWSTYLE         Addressing modes are M68020 like.\n"
-                    "        -ESCCODES         Use escape character '\\' in strings.\n"
-                    "        -COMPAT=<flags>   Various compatibility flags.\n"
-                    "        -SPLITFILE        Put each section in its own file.\n"
-                    "        -CONFIG           Loads config file.\n"
-                    "        -PREPROC          Finds data in code sections. Useful.\n"
-                    "        -ENTRY=<offs>     Where to begin scanning of code.\n"
-                    "        -BASEREG[=<x>[,<adr>[,<off>]]]\n"
-                    "                          Baserelative mode d16(Ax).\n"
-                    "                          x = 0-7 : Number of the address register.\n"
-                    "                          adr     : Base address.\n"
-                    "                          off     : Offset on base address.\n"
-                    "        -BASEABS          Baserel addr.mode as an absolute label.\n"
-                    "\n");
+    fprintf(ira->files.errFile, "Usage  : IRA [Options] <Source> [Target]\n"
+                                "         IRA -BATCH [Options] <Source list or directory>\n"
+                                "         IRA -SERVE [Options] <Socket>\n"
+                                "\n"
+                                "Source : Specifies the path of the source.\n"
+                                "Target : Specifies the path of the target.\n"
+                                "Options:\n"
+                                "        -M68xxx           xxx = 000,010,020,030,040,060,851,881,882:\n"
+                                "                          Specifies processor/coprocessor.\n"
+                                "        -BINARY           Treat source file as binary.\n"
+                                "        -A                Append address and data to every line.\n"
+                                "        -AW               Same as -A, but enforce 8-digit addresses.\n"
+                                "        -INFO             Print informations about the hunk's structure.\n"
+                                "        -OFFSET=<offs>    Specifies offset to relocate at.\n"
+                                "        -TEXT=<x>         x = 1: Method for searching text.\n"
+                                "        -KEEPZH           Hunks with zero length are recognized.\n"
+                                "        -KEEPBIN          Keep the file with the binary data.\n"
+                                "        -OLDSTYLE         Addressing modes are M68000 like.\n"
+                                "        -NEWSTYLE         Addressing modes are M68020 like.\n"
+                                "        -ESCCODES         Use escape character '\\' in strings.\n"
+                                "        -COMPAT=<flags>   Various compatibility flags.\n"
+                                "        -SPLITFILE        Put each section in its own file.\n"
+                                "        -CONFIG           Loads config file.\n"
+                                "        -PREPROC          Finds data in code sections. Useful.\n"
+                                "        -ENTRY=<offs>     Where to begin scanning of code.\n"
+                                "        -BASEREG[=<x>[,<adr>[,<off>]]]\n"
+                                "                          Baserelative mode d16(Ax).\n"
+                                "                          x = 0-7 : Number of the address register.\n"
+                                "                          adr     : Base address.\n"
+                                "                          off     : Offset on base address.\n"
+                                "        -BASEABS          Baserel addr.mode as an absolute label.\n"
+                                "        -BATCH            Disassemble every source of a list or directory.\n"
+                                "        -JOBS=<n>         Number of -BATCH, -SERVE or Pass 2 threads.\n"
+                                "        -SERVE            Take jobs from a Unix domain socket.\n"
+                                "        -CACHE=<dir>      Keep the result of Pass 1 in dir.\n"
+                                "        -STATS[=JSON]     Print times and counters of every pass.\n"
+                                "\n");
 }
 
 void ExitPrg(const char *errtext, ...) {
     int exit_status;
     va_list arguments;
 
+    if (ira->part) {
+        va_start(arguments, errtext);
+        vsnprintf(ira->exitText, sizeof(ira->exitText), errtext ? errtext : "", arguments);
+        va_end(arguments);
+        longjmp(*ira->exitJump, 1);
+    }
+
     if (errtext) {
         va_start(arguments, errtext);
-        vfprintf(stderr, errtext, arguments);
-        fprintf(stderr, "\n");
+        vfprintf(ira->files.errFile, errtext, arguments);
+        fprintf(ira->files.errFile, "\n");
         va_end(arguments);
+        if (ira->exitJump) {
+            va_start(arguments, errtext);
+            vsnprintf(ira->exitText, sizeof(ira->exitText), errtext, arguments);
+            va_end(arguments);
+        }
         exit_status = EXIT_FAILURE;
     } else {
-        printf("\n");
+        fprintf(ira->files.msgFile, "\n");
         exit_status = EXIT_SUCCESS;
     }
 
@@ -107,45 +106,41 @@ void ExitPrg(const char *errtext, ...) {
         fclose(ira->files.sourceFile);
     if (ira->files.binaryFile)
         fclose(ira->files.binaryFile);
-    if (ira->files.targetFile)
-        fclose(ira->files.targetFile);
-    if (ira->files.labelFile)
-        fclose(ira->files.labelFile);
-
-    if (ira->filenames.labelName)
-        delfile(ira->filenames.labelName);
-    if (!(ira->params.pFlags & KEEP_BINARY) && ira->filenames.binaryName)
-        delfile(ira->filenames.binaryName);
+    if (ira->files.readFile)
+        fclose(ira->files.readFile);
+    CloseTarget();
 
+    if (ira->exitJump)
+        longjmp(*ira->exitJump, 1);
     exit(exit_status);
 }
 
 void PrintAreas(CodeArea_t *codeArea) {
     unsigned long i;
 
-    printf("codeAdrs: %lu   codeAdrMax: %lu\n", (unsigned long) codeArea->codeAdrs, (unsigned long) codeArea->codeAdrMax);
+    fprintf(ira->files.msgFile, "codeAdrs: %lu   codeAdrMax: %lu\n", (unsigned long) codeArea->codeAdrs, (unsigned long) codeArea->codeAdrMax);
 
     for (i = 0; i < codeArea->codeAreas; i++)
-        printf("CodeArea[%lu]: %08lx - %08lx\n", i, (unsigned long) codeArea->codeArea1[i], (unsigned long) codeArea->codeArea2[i]);
+        fprintf(ira->files.msgFile, "CodeArea[%lu]: %08lx - %08lx\n", i, (unsigned long) codeArea->codeArea1[i], (unsigned long) codeArea->codeArea2[i]);
 
-    printf("\n\n");
+    fprintf(ira->files.msgFile, "\n\n");
 }
 
-void WriteBaseDirective(FILE *f) {
+void WriteBaseDirective(void) {
     ira->adrbuf[0] = 0;
     GetLabel(ira->baseReg.baseAddress, MODE_INVALID);
-    fprintf(f, "\tBASEREG\t%s", ira->adrbuf);
+    TargetPrintf("\tBASEREG\t%s", ira->adrbuf);
     ira->adrbuf[0] = 0;
     if (ira->baseReg.baseOffset > 0)
-        fprintf(f, "+%hd,A%hu\n", ira->baseReg.baseOffset, ira->params.baseReg);
+        TargetPrintf("+%hd,A%hu\n", ira->baseReg.baseOffset, ira->params.baseReg);
     else if (ira->baseReg.baseOffset < 0)
-        fprintf(f, "-%hd,A%hu\n", -ira->baseReg.baseOffset, ira->params.baseReg);
+        TargetPrintf("-%hd,A%hu\n", -ira->baseReg.baseOffset, ira->params.baseReg);
     else
-        fprintf(f, ",A%hu\n", ira->params.baseReg);
+        TargetPrintf(",A%hu\n", ira->params.baseReg);
 }
 
 void SplitCodeAreas(ira_t *ira) {
-    uint32_t i, j, ptr1;
+    uint32_t i, j, ptr1, max;
 
     /* splitting code areas where sections begin or end */
     for (i = 0; i < ira->hunkCount; i++) {
@@ -165,9 +160,10 @@ void SplitCodeAreas(ira_t *ira) {
                         ira->codeArea.codeArea2[j] = ira->codeArea.codeArea1[j + 1] = ptr1;
                     ira->codeArea.codeAreas++;
                     if (ira->codeArea.codeAreas == ira->codeArea.codeAreaMax) {
-                        ira->codeArea.codeArea1 = GetNewVarBuffer(ira->codeArea.codeArea1, ira->codeArea.codeAreaMax);
-                        ira->codeArea.codeArea2 = GetNewVarBuffer(ira->codeArea.codeArea2, ira->codeArea.codeAreaMax);
-                        ira->codeArea.codeAreaMax *= 2;
+                        max = GrowMax(ira->codeArea.codeAreaMax, ira->codeArea.codeAreas + 1);
+                        ira->codeArea.codeArea1 = ResizeArray(ira->codeArea.codeArea1, ira->codeArea.codeAreaMax, max, sizeof(uint32_t));
+                        ira->codeArea.codeArea2 = ResizeArray(ira->codeArea.codeArea2, ira->codeArea.codeAreaMax, max, sizeof(uint32_t));
+                        ira->codeArea.codeAreaMax = max;
                     }
                     break;
                 }
@@ -176,9 +172,10 @@ void SplitCodeAreas(ira_t *ira) {
             ira->codeArea.codeArea2[ira->codeArea.codeAreas] = ira->codeArea.codeArea1[ira->codeArea.codeAreas] = ptr1;
             ira->codeArea.codeAreas++;
             if (ira->codeArea.codeAreas == ira->codeArea.codeAreaMax) {
-                ira->codeArea.codeArea1 = GetNewVarBuffer(ira->codeArea.codeArea1, ira->codeArea.codeAreaMax);
-                ira->codeArea.codeArea2 = GetNewVarBuffer(ira->codeArea.codeArea2, ira->codeArea.codeAreaMax);
-                ira->codeArea.codeAreaMax *= 2;
+                max = GrowMax(ira->codeArea.codeAreaMax, ira->codeArea.codeAreas + 1);
+                ira->codeArea.codeArea1 = ResizeArray(ira->codeArea.codeArea1, ira->codeArea.codeAreaMax, max, sizeof(uint32_t));
+                ira->codeArea.codeArea2 = ResizeArray(ira->codeArea.codeArea2, ira->codeArea.codeAreaMax, max, sizeof(uint32_t));
+                ira->codeArea.codeAreaMax = max;
             }
         }
     }
@@ -197,102 +194,193 @@ static int NoPtrsArea(uint32_t adr) {
     return 0;
 }
 
+/* Is adr the start of an instruction or data in Pass 1 ? */
+static int IsPass1Adr(uint32_t adr) {
+    if (adr < ira->params.prgStart || adr >= ira->params.prgEnd)
+        return 0;
+    adr -= ira->params.prgStart;
+    return (ira->adrMap[adr >> 3] >> (adr & 7)) & 1;
+}
+
+/* First Pass 1 address at or after adr, prgEnd if there is none */
+static uint32_t NextPass1Adr(uint32_t adr) {
+    uint32_t i, len = ira->params.prgLen;
+
+    i = adr < ira->params.prgStart ? 0 : adr - ira->params.prgStart;
+    while (i < len) {
+        if (!(i & 7) && !ira->adrMap[i >> 3]) {
+            i += 8;
+            continue;
+        }
+        if ((ira->adrMap[i >> 3] >> (i & 7)) & 1)
+            return ira->params.prgStart + i;
+        i++;
+    }
+    return ira->params.prgEnd;
+}
+
+/* Last Pass 1 address before adr, 0 if there is none */
+static uint32_t PrevPass1Adr(uint32_t adr) {
+    uint32_t i;
+
+    if (adr <= ira->params.prgStart)
+        return 0;
+    i = adr > ira->params.prgEnd ? ira->params.prgLen : adr - ira->params.prgStart;
+    while (i--) {
+        if ((i & 7) == 7 && !ira->adrMap[i >> 3]) {
+            i -= 7;
+            continue;
+        }
+        if ((ira->adrMap[i >> 3] >> (i & 7)) & 1)
+            return ira->params.prgStart + i;
+    }
+    return 0;
+}
+
 static void CheckNoBase(uint32_t adr) {
     if ((ira->params.pFlags & BASEREG2) && ira->noBase.noBaseIndex < ira->noBase.noBaseCount) {
         if (!ira->noBase.noBaseFlag) {
             if (adr >= ira->noBase.noBaseStart[ira->noBase.noBaseIndex]) {
                 ira->noBase.noBaseFlag = 1;
                 if (ira->pass == 2)
-                    fprintf(ira->files.targetFile, "\tENDB\tA%hu\n", ira->params.baseReg);
+                    TargetPrintf("\tENDB\tA%hu\n", ira->params.baseReg);
             }
         } else {
             if (adr >= ira->noBase.noBaseEnd[ira->noBase.noBaseIndex]) {
                 ira->noBase.noBaseFlag = 0;
                 if (ira->pass == 2)
-                    WriteBaseDirective(ira->files.targetFile);
+                    WriteBaseDirective();
                 ira->noBase.noBaseIndex++;
             }
         }
     }
 }
 
+/* Copy name into the symbol name pool */
+static char *PoolSymbolName(const char *name) {
+    uint32_t len = strlen(name) + 1, size;
+    char *p;
+
+    if (!ira->symbols.symbolPool || len > ira->symbols.symbolPoolFree) {
+        size = sizeof(char *) + (len > SYMBOL_POOL_SIZE ? len : SYMBOL_POOL_SIZE);
+        p = mytalloc(size, MEM_SYMBOLS);
+        *(char **) p = ira->symbols.symbolBlocks;
+        ira->symbols.symbolBlocks = p;
+        ira->symbols.symbolPool = p + sizeof(char *);
+        ira->symbols.symbolPoolFree = size - sizeof(char *);
+    }
+    p = strcpy(ira->symbols.symbolPool, name);
+    ira->symbols.symbolPool += len;
+    ira->symbols.symbolPoolFree -= len;
+    return (p);
+}
+
 void InsertSymbol(char *name, uint32_t value) {
-    uint32_t i;
+    uint32_t i, max, *slot = SymbolSlot(value);
 
-    for (i = 0; i < ira->symbols.symbolCount; i++)
-        if (ira->symbols.symbolValue[i] == value)
-            return;
+    /* only the first symbol at an address is kept */
+    if (*slot)
+        return;
 
     ira->symbols.symbolValue[ira->symbols.symbolCount] = value;
-    ira->symbols.symbolName[ira->symbols.symbolCount] = mycalloc(strlen(name) + 1);
-    strcpy(ira->symbols.symbolName[ira->symbols.symbolCount++], name);
+    ira->symbols.symbolName[ira->symbols.symbolCount] = PoolSymbolName(name);
+    *slot = ++ira->symbols.symbolCount;
 
     if (ira->symbols.symbolCount == ira->symbols.symbolMax) {
-        ira->symbols.symbolName = GetNewPtrBuffer(ira->symbols.symbolName, ira->symbols.symbolMax);
-        ira->symbols.symbolValue = GetNewVarBuffer(ira->symbols.symbolValue, ira->symbols.symbolMax);
-        ira->symbols.symbolMax *= 2;
+        max = GrowMax(ira->symbols.symbolMax, ira->symbols.symbolCount + 1);
+        ira->symbols.symbolName = ResizeArray(ira->symbols.symbolName, ira->symbols.symbolMax, max, sizeof(char *));
+        ira->symbols.symbolValue = ResizeArray(ira->symbols.symbolValue, ira->symbols.symbolMax, max, sizeof(uint32_t));
+        ira->symbols.symbolMax = max;
+    }
+
+    /* keep the hash at most half full */
+    if (ira->symbols.symbolCount * 2 > ira->symbols.symbolHashMask) {
+        myfree(ira->symbols.symbolHash);
+        ira->symbols.symbolHashMask = ira->symbols.symbolHashMask * 2 + 1;
+        ira->symbols.symbolHash = mytcalloc((ira->symbols.symbolHashMask + 1) * sizeof(uint32_t), MEM_SYMBOLS);
+        for (i = 0; i < ira->symbols.symbolCount; i++)
+            *SymbolSlot(ira->symbols.symbolValue[i]) = i + 1;
     }
 }
 
+/* Pending code addresses are kept in descending order,
+ * so the lowest one is taken from the end of codeAdr. */
 static uint32_t GetCodeAdr(uint32_t *ptr) {
     if (ira->codeArea.codeAdrs) {
-        *ptr = ira->codeArea.codeAdr[0];
-        lmovmem(&ira->codeArea.codeAdr[1], &ira->codeArea.codeAdr[0], ira->codeArea.codeAdrs - 1);
-        ira->codeArea.codeAdrs--;
+        *ptr = ira->codeArea.codeAdr[--ira->codeArea.codeAdrs];
         return (1);
     }
     return (0);
 }
 
+/* Index of the first pending code address lower than adr, codeAdrs if there is none */
+static uint32_t FindCodeAdr(CodeArea_t *codeArea, uint32_t adr) {
+    uint32_t l = 0, m, r = codeArea->codeAdrs;
+
+    while (l < r) {
+        m = (l + r) / 2;
+        if (codeArea->codeAdr[m] >= adr)
+            l = m + 1;
+        else
+            r = m;
+    }
+    return (l);
+}
+
+/* Index of the first code area ending after adr, codeAreas if there is none.
+ * note: code areas are sorted and don't overlap */
+static uint32_t FindCodeArea(CodeArea_t *codeArea, uint32_t adr) {
+    uint32_t l = 0, m, r = codeArea->codeAreas;
+
+    while (l < r) {
+        m = (l + r) / 2;
+        if (codeArea->codeArea2[m] <= adr)
+            l = m + 1;
+        else
+            r = m;
+    }
+    return (l);
+}
+
 void InsertCodeAdr(ira_t *ira, uint32_t adr) {
-    uint32_t l = 0, m, r = ira->codeArea.codeAdrs, i;
+    uint32_t i;
 
     if (!(ira->params.pFlags & PREPROC))
         return;
 
     /* check if label points into an earlier processed code area */
-    for (i = 0; i < ira->codeArea.codeAreas; i++) {
-        if ((adr >= ira->codeArea.codeArea1[i]) && (adr < ira->codeArea.codeArea2[i])) {
-            return;
-        }
-    }
+    i = FindCodeArea(&ira->codeArea, adr);
+    if (i < ira->codeArea.codeAreas && adr >= ira->codeArea.codeArea1[i])
+        return;
 
     /* this case occurs pretty often */
-    if (ira->codeArea.codeAdrs && (adr > ira->codeArea.codeAdr[ira->codeArea.codeAdrs - 1])) {
+    if (ira->codeArea.codeAdrs && (adr < ira->codeArea.codeAdr[ira->codeArea.codeAdrs - 1])) {
         ira->codeArea.codeAdr[ira->codeArea.codeAdrs++] = adr;
     } else {
-        /* adr binary search */
-        while (l < r) {
-            m = (l + r) / 2;
-            if (ira->codeArea.codeAdr[m] < adr)
-                l = m + 1;
-            else
-                r = m;
-        }
-        if ((ira->codeArea.codeAdr[r] != adr) || (r == ira->codeArea.codeAdrs)) {
-            lmovmem(&ira->codeArea.codeAdr[r], &ira->codeArea.codeAdr[r + 1], ira->codeArea.codeAdrs - r);
-            ira->codeArea.codeAdr[r] = adr;
+        i = FindCodeAdr(&ira->codeArea, adr);
+        if (i == 0 || ira->codeArea.codeAdr[i - 1] != adr) {
+            lmovmem(&ira->codeArea.codeAdr[i], &ira->codeArea.codeAdr[i + 1], ira->codeArea.codeAdrs - i);
+            ira->codeArea.codeAdr[i] = adr;
             ira->codeArea.codeAdrs++;
         }
     }
-    if (ira->codeArea.codeAdrs == ira->codeArea.codeAdrMax) {
-        ira->codeArea.codeAdr = GetNewVarBuffer(ira->codeArea.codeAdr, ira->codeArea.codeAdrMax);
-        ira->codeArea.codeAdrMax *= 2;
-    }
+    if (ira->codeArea.codeAdrs == ira->codeArea.codeAdrMax)
+        ira->codeArea.codeAdr = GrowArray(ira->codeArea.codeAdr, &ira->codeArea.codeAdrMax, ira->codeArea.codeAdrs + 1, sizeof(uint32_t));
 }
 
 void InsertCodeArea(CodeArea_t *codeArea, uint32_t adr1, uint32_t adr2) {
-    uint32_t i, j;
+    uint32_t i, j, k, max;
 
     if (codeArea->codeAreas == 0) {
         codeArea->codeArea1[0] = adr1;
         codeArea->codeArea2[0] = adr2;
         codeArea->codeAreas++;
+        k = 0;
     } else {
-        i = 0;
-        while (adr1 > codeArea->codeArea2[i] && i < codeArea->codeAreas)
-            i++;
-        if (adr1 == codeArea->codeArea2[i]) {
+        /* first area ending at or after adr1 */
+        i = (adr1 ? FindCodeArea(codeArea, adr1 - 1) : 0);
+        k = i;
+        if (i < codeArea->codeAreas && adr1 == codeArea->codeArea2[i]) {
             codeArea->codeArea2[i] = adr2;
             while (((i + 1) < codeArea->codeAreas) && (codeArea->codeArea2[i] >= codeArea->codeArea1[i + 1])) {
                 codeArea->codeArea2[i] = codeArea->codeArea2[i + 1];
@@ -310,25 +398,21 @@ void InsertCodeArea(CodeArea_t *codeArea, uint32_t adr1, uint32_t adr2) {
             codeArea->codeArea2[i] = adr2;
             codeArea->codeAreas++;
             if (codeArea->codeAreas == codeArea->codeAreaMax) {
-                codeArea->codeArea1 = GetNewVarBuffer(codeArea->codeArea1, codeArea->codeAreaMax);
-                codeArea->codeArea2 = GetNewVarBuffer(codeArea->codeArea2, codeArea->codeAreaMax);
-                codeArea->codeAreaMax *= 2;
+                max = GrowMax(codeArea->codeAreaMax, codeArea->codeAreas + 1);
+                codeArea->codeArea1 = ResizeArray(codeArea->codeArea1, codeArea->codeAreaMax, max, sizeof(uint32_t));
+                codeArea->codeArea2 = ResizeArray(codeArea->codeArea2, codeArea->codeAreaMax, max, sizeof(uint32_t));
+                codeArea->codeAreaMax = max;
             }
         }
     }
 
-    fprintf(stderr, "Areas: %4lu  \r", (unsigned long) codeArea->codeAreas);
-    fflush(stderr);
-
-    /* remove all labels that point within a earlier processed code area */
-    for (j = 0; j < codeArea->codeAreas; j++) {
-        for (i = 0; i < codeArea->codeAdrs;) {
-            if ((codeArea->codeAdr[i] >= codeArea->codeArea1[j]) && (codeArea->codeAdr[i] < codeArea->codeArea2[j])) {
-                lmovmem(&codeArea->codeAdr[i + 1], &codeArea->codeAdr[i], codeArea->codeAdrs - i - 1);
-                codeArea->codeAdrs--;
-            } else
-                i++;
-        }
+    /* Remove all labels that point within the area just grown (k).
+     * Pending labels are never inside the other areas, InsertCodeAdr() rejects them. */
+    i = FindCodeAdr(codeArea, codeArea->codeArea2[k]);
+    j = FindCodeAdr(codeArea, codeArea->codeArea1[k]);
+    if (j > i) {
+        lmovmem(&codeArea->codeAdr[j], &codeArea->codeAdr[i], codeArea->codeAdrs - j);
+        codeArea->codeAdrs -= j - i;
     }
 }
 
@@ -353,6 +437,23 @@ void SectionToArea(ira_t *ira) {
     SplitCodeAreas(ira);
 }
 
+/* Index of the section containing adr, hunkCount if there is none.
+ * note: sections follow each other in ascending order */
+static uint32_t FindHunk(ira_t *ira, uint32_t adr) {
+    uint32_t l = 0, m, r = ira->hunkCount;
+
+    while (l < r) {
+        m = (l + r) / 2;
+        if (ira->hunksOffs[m] + ira->hunksSize[m] <= adr)
+            l = m + 1;
+        else
+            r = m;
+    }
+    if (l < ira->hunkCount && adr >= ira->hunksOffs[l])
+        return (l);
+    return (ira->hunkCount);
+}
+
 void DPass0(ira_t *ira) {
     uint16_t dummy;
     uint16_t EndFlag;
@@ -362,22 +463,18 @@ void DPass0(ira_t *ira) {
     ptr2 = (ira->params.prgEnd - ira->params.prgStart) / 2;
     if (!(ira->params.pFlags & ROMTAGatZERO) && !(ira->params.pFlags & CONFIG))
         InsertCodeAdr(ira, ira->params.codeEntry);
-    fprintf(stderr, "Pass 0: scanning for data in code\n");
+    fprintf(ira->files.errFile, "Pass 0: scanning for data in code\n");
 
     while (GetCodeAdr(&ptr1)) {
         ira->prgCount = (ptr1 - ira->params.prgStart) / 2;
 
         /* Find out in which section we are */
-        for (ira->modulcnt = 0; ira->modulcnt < ira->hunkCount; ira->modulcnt++)
-            if ((ptr1 >= ira->hunksOffs[ira->modulcnt]) && (ptr1 < (ira->hunksOffs[ira->modulcnt] + ira->hunksSize[ira->modulcnt]))) {
-                ira->codeArea.codeAreaEnd = (ira->hunksOffs[ira->modulcnt] + ira->hunksSize[ira->modulcnt] - ira->params.prgStart) / 2;
-                break;
-            }
+        ira->modulcnt = FindHunk(ira, ptr1);
+        if (ira->modulcnt < ira->hunkCount)
+            ira->codeArea.codeAreaEnd = (ira->hunksOffs[ira->modulcnt] + ira->hunksSize[ira->modulcnt] - ira->params.prgStart) / 2;
 
         /* Find the first relocation in this code area */
-        for (ira->nextreloc = 0; ira->nextreloc < ira->relocount; ira->nextreloc++)
-            if (ira->reloc.relocAdr[ira->nextreloc] >= ptr1)
-                break;
+        ira->nextreloc = FindReloc(ptr1);
 
         EndFlag = 0;
         while (EndFlag == 0) {
@@ -385,12 +482,12 @@ void DPass0(ira_t *ira) {
                 InsertCodeArea(&ira->codeArea, ptr1, ira->prgCount * 2 + ira->params.prgStart);
                 break;
             } else if (ira->prgCount > ptr2) {
-                fprintf(stderr, "Watch out: prgcount*2(=%08lx) > (prgend-prgstart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
+                fprintf(ira->files.errFile, "Watch out: prgcount*2(=%08lx) > (prgend-prgstart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
                         (unsigned long) (ira->params.prgEnd - ira->params.prgStart));
                 break;
             }
 
-            if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+            if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                 ira->nextreloc++;
                 ira->prgCount += 2;
                 continue;
@@ -411,11 +508,11 @@ void DPass0(ira_t *ira) {
             if ((instructions[ira->opCodeNumber].flags & OPF_APPEND_SIZE) && ira->extension == 3)
                 ira->addressMode = MODE_INVALID;
 
-            if (instructions[ira->opCodeNumber].sourceadr)
-                if (DoAdress1(ira, instructions[ira->opCodeNumber].sourceadr))
+            if (ira->sourceadr)
+                if (DoAdress1(ira, ira->sourceadr))
                     continue;
 
-            if (instructions[ira->opCodeNumber].destadr) {
+            if (ira->destadr) {
                 if (instructions[ira->opCodeNumber].family == OPC_MOVE) {
                     ira->addressMode = ((ira->seaow & ALT_MODE_MASK) >> 3) | ira->alt_register;
                     if (ira->addressMode < EA_MODE_FIELD_MASK)
@@ -425,12 +522,12 @@ void DPass0(ira_t *ira) {
                     ira->ea_register = ira->alt_register;
                 }
 
-                if (DoAdress1(ira, instructions[ira->opCodeNumber].destadr))
+                if (DoAdress1(ira, ira->destadr))
                     continue;
                 else if (instructions[ira->opCodeNumber].family == OPC_LEA || instructions[ira->opCodeNumber].family == OPC_MOVEAL)
                     if (ira->params.pFlags & BASEREG1)
                         if (ira->addressMode2 == 1 && ira->alt_register == ira->params.baseReg)
-                            printf("BASEREG\t%08lX: A%hd\n", (unsigned long) (ira->pc * 2 + ira->params.prgStart), ira->params.baseReg);
+                            fprintf(ira->files.msgFile, "BASEREG\t%08lX: A%hd\n", (unsigned long) (ira->pc * 2 + ira->params.prgStart), ira->params.baseReg);
             }
 
             /* Check for data in code */
@@ -470,7 +567,7 @@ void DPass0(ira_t *ira) {
                 }
     }
 
-    fprintf(stderr, "\n");
+    fprintf(ira->files.errFile, "\n");
 
     /* Preparing sections to be area aligned */
     SectionToArea(ira);
@@ -500,67 +597,843 @@ static void GenJmptab(uint8_t *buf, int size, uint32_t pc, int32_t base, int cou
                 dtacat(itohex(be16(buf + 2), 4));
                 mnecat("DC.L");
                 break;
-            default:
-                ExitPrg("Illegal jmp table size %d.", size);
+            default:
+                ExitPrg("Illegal jmp table size %d.", size);
+                break;
+        }
+        adrcat("(");
+        GetLabel(adr, MODE_INVALID);
+        adrcat(")-(");
+        GetLabel(base, MODE_INVALID);
+        adrcat(")");
+        Output();
+    }
+}
+
+/* Move *index to the first entry of list at or after adr.
+ * Pass 2 asks for ascending addresses, so this is usually a few steps forward. */
+static uint32_t SeekComment(Comment_t **list, uint32_t count, uint32_t *index, uint32_t adr) {
+    uint32_t l = 0, m, r;
+
+    if (*index && list[*index - 1]->commentAdr >= adr) {
+        /* going backwards */
+        for (r = *index; l < r;) {
+            m = (l + r) / 2;
+            if (list[m]->commentAdr < adr)
+                l = m + 1;
+            else
+                r = m;
+        }
+        *index = l;
+    }
+    while (*index < count && list[*index]->commentAdr < adr)
+        (*index)++;
+
+    return (*index);
+}
+
+/* Put the Pass 2 cursors on the first entries at or after adr */
+static void SyncAdr(ira_t *ira, uint32_t adr) {
+    ira->prgCount = (adr - ira->params.prgStart) / 2;
+    if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < adr)
+        ira->nextreloc = FindReloc(adr);
+    while (ira->p2labind < ira->labcount && ira->LabelAdr2[ira->p2labind] < adr)
+        ira->p2labind++;
+    while (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start < adr)
+        ira->jmp.jmpIndex++;
+    while (ira->text.textIndex < ira->text.textCount && ira->text.textStart[ira->text.textIndex] < adr)
+        ira->text.textIndex++;
+    SeekComment(ira->commentByAdr, ira->commentCount, &ira->commentIndex, adr);
+    SeekComment(ira->bannerByAdr, ira->bannerCount, &ira->bannerIndex, adr);
+}
+
+/* The cursors at the start of area. After some data this is where the
+ * previous area left them, unless a label, relocation or TEXT was hidden
+ * in an equate. */
+static void SyncArea(ira_t *ira, uint32_t area) {
+    SyncAdr(ira, area ? ira->codeArea.codeArea1[area] : ira->params.prgStart);
+}
+
+/* Pass 2 of one code area and the data up to the next one */
+static void WriteArea(ira_t *ira, uint32_t area) {
+    uint16_t tflag, text, dummy;
+    uint16_t longs_per_line;
+    uint32_t i, j, k, l, zero;
+    uint8_t *buf, tptr[64 * 5 + 8]; /* one DC.B line, at most 5 bytes for each of 61 values */
+    uint32_t ptr1, ptr2, end;
+    char *equate_name;
+
+    SyncArea(ira, area);
+    if (ira->areaOffset)
+        ira->areaOffset[area] = TargetOffset();
+
+    while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea1[area])) {
+        ira->modulcnt++;
+        if (ira->params.pFlags & SPLITFILE)
+            SplitOutputFiles(&ira->files, &ira->filenames, ira->modulcnt);
+        WriteSection(ira);
+    }
+
+    ira->dtabuf[0] = 0;
+    ira->adrbuf[0] = 0;
+    ira->mnebuf[0] = 0;
+
+    /* HERE BEGINS THE CODE PART OF PASS 2 */
+    /***************************************/
+
+    ira->codeArea.codeAreaEnd = (ira->codeArea.codeArea2[area] - ira->params.prgStart) / 2;
+
+    CheckPhase(-1); /* phase sync */
+
+    while (ira->prgCount < ira->codeArea.codeAreaEnd) {
+        CheckPhase(ira->prgCount * 2 + ira->params.prgStart);
+
+        WriteBanner(ira->params.prgStart + ira->prgCount * 2);
+        WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
+        WriteComment(ira->params.prgStart + ira->prgCount * 2);
+
+        dtacat(itohex(ira->params.prgStart + ira->prgCount * 2, ira->adrlen));
+        dtacat(": ");
+        if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
+            mnecat("DC.L");
+            dtacat(itohex(be16(&ira->buffer[ira->prgCount]), 4));
+            dtacat(itohex(be16(&ira->buffer[ira->prgCount + 1]), 4));
+            GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
+            ira->nextreloc++;
+            Output();
+            ira->prgCount += 2;
+            continue;
+        }
+        ira->pc = ira->prgCount;
+        ira->seaow = be16(&ira->buffer[ira->prgCount++]);
+        dtacat(itohex(ira->seaow, 4));
+
+        GetOpCode(ira, ira->seaow);
+
+        mnecat(instructions[ira->opCodeNumber].opcode);
+        if (instructions[ira->opCodeNumber].flags & OPF_ONE_MORE_WORD) {
+            ira->extra = be16(&ira->buffer[ira->prgCount]);
+            ira->ext_register = (ira->extra & REGISTER_EXTENSION_MASK) >> 12;
+            if (P2WriteReloc())
+                continue;
+        }
+
+        if (instructions[ira->opCodeNumber].flags & OPF_APPEND_CC) {
+            dummy = (ira->seaow & cc_MASK) >> 8;
+            /* note: For Bcc, CC "T" (0000) and "F" (0001) don't exist. Bcc with 0000 is BRA and Bcc with 0001 is BSR.
+             *       cpu_cc[] should contain 16 items (as CC is coded over 4 bits) but actually contains 18.
+             *       Why ?
+             *       Because, 17th and 18th items are "RA" and "SR".
+             *       It is a trick to have BRA and BSR instead of BT and BF by adding 16 to CC got in dummy variable */
+            if (instructions[ira->opCodeNumber].family == OPC_Bcc && dummy < 2)
+                dummy += 16;
+            mnecat(cpu_cc[dummy]);
+        }
+
+        if (instructions[ira->opCodeNumber].flags & OPF_APPEND_PCC) {
+            if (instructions[ira->opCodeNumber].family == OPC_PBcc)
+                dummy = ira->seaow;
+            else
+                dummy = ira->extra;
+            mnecat(mmu_cc[dummy & Pcc_MASK]);
+        }
+
+        DoSpecific(ira, 2);
+
+        if (instructions[ira->opCodeNumber].flags & OPF_APPEND_SIZE) {
+            if (ira->extension != 3) {
+                mnecat(extensions[ira->extension]);
+            } else {
+                ira->addressMode = MODE_INVALID;
+            }
+        }
+
+        if (ira->sourceadr) {
+            if (DoAdress2(ira->sourceadr))
+                continue;
+
+            if (ira->destadr)
+                adrcat(",");
+        }
+
+        if (ira->destadr) {
+            if (instructions[ira->opCodeNumber].family == OPC_MOVE) {
+                ira->addressMode = ((ira->seaow & ALT_MODE_MASK) >> 3) | ira->alt_register;
+                if (ira->addressMode < EA_MODE_FIELD_MASK)
+                    ira->addressMode = (ira->addressMode >> 3);
+                else
+                    ira->addressMode = 7 + ira->alt_register;
+                ira->ea_register = ira->alt_register;
+            }
+
+            if (DoAdress2(ira->destadr))
+                continue;
+
+            /* Third PACK and UNPK adjustment operand */
+            if (instructions[ira->opCodeNumber].family == OPC_PACK_UNPACK) {
+                adrcat(",#");
+                equate_name = GetEquate(2, (ira->prgCount - 1) << 1);
+                if (equate_name)
+                    adrcat(equate_name);
+                else {
+                    adrcat("$");
+                    adrcat(itohex(ira->extra, 4));
+                }
+            }
+        }
+
+        Output();
+        CheckNoBase(ira->params.prgStart + ira->prgCount * 2);
+
+        if (ira->prgCount > ira->codeArea.codeAreaEnd)
+            fprintf(ira->files.errFile, "P2 Watch out: prgCount*2(=%08lx) > (prgEnd-prgStart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
+                    (unsigned long) (ira->params.prgEnd - ira->params.prgStart));
+    }
+
+    while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea2[area])) {
+        ira->modulcnt++;
+        if (ira->params.pFlags & SPLITFILE)
+            SplitOutputFiles(&ira->files, &ira->filenames, ira->modulcnt);
+        WriteSection(ira);
+    }
+
+    /* HERE BEGINS THE DATA PART OF PASS 2 */
+    /***************************************/
+
+    ptr1 = ira->codeArea.codeArea2[area];
+    if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < ptr1)
+        ira->nextreloc = FindReloc(ptr1); /* relocation hidden in code, Pass 1 warned */
+    if ((area + 1) < ira->codeArea.codeAreas)
+        end = ira->codeArea.codeArea1[area + 1];
+    else
+        end = ira->params.prgEnd;
+
+    while (ptr1 < end) {
+        text = 0;
+
+        buf = (uint8_t *) ira->buffer + ptr1 - ira->params.prgStart;
+
+        /* labels and relocations hidden inside an equate can't be written anymore */
+        while (ira->p2labind < ira->labcount && ira->LabelAdr2[ira->p2labind] < ptr1)
+            ira->p2labind++;
+        while (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < ptr1)
+            ira->nextreloc++;
+
+        WriteBanner(ptr1);
+        /* write label and/or relocation */
+        WriteLabel2(ptr1);
+        WriteComment(ptr1);
+        if (ira->reloc.relocs[ira->nextreloc].adr == ptr1) {
+            mnecat("DC.L");
+            GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
+            dtacat(itohex(ptr1, ira->adrlen));
+            dtacat(": ");
+            dtacat(itohex(be32(buf), 8));
+
+            ptr1 += 4;
+            ptr2 = ptr1;
+            ira->nextreloc++;
+
+            Output();
+            continue;
+        }
+
+        /* Check each possible size of equate (4, 2 and 1) */
+        for (i = 4; i; i >>= 1)
+            if ((equate_name = GetEquate(i, ptr1))) {
+                mnecat("DC");
+                mnecat(extensions[i >> 1]);
+                adrcat(equate_name);
+                /* In case of equate output, let's print raw data at the end of line */
+                dtacat(itohex(ptr1, ira->adrlen));
+                dtacat(": ");
+                dtacat(itohex(i == 4 ? be32(buf) : i == 2 ? be16(buf) : (*buf), i << 1));
+
+                ptr1 += i;
+                ptr2 = ptr1;
+
+                Output();
+                break;
+            }
+        /* Previous loop ends if (i == 0) or if it was "broken".
+         * If it was "broken", it means that an equate was found and
+         * IRA has to go to next iteration of current loop */
+        if (i)
+            continue;
+
+        /* sync with jump table */
+        while (ira->jmp.jmpIndex < ira->jmp.jmpCount && ptr1 > ira->jmp.jmpTable[ira->jmp.jmpIndex].start)
+            ira->jmp.jmpIndex++; /* we already warned in pass 1 about that */
+
+        /* ptr2 will be upper bound */
+        ptr2 = end;
+        if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < ptr2)
+            ptr2 = ira->reloc.relocs[ira->nextreloc].adr;
+
+        if (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start == ptr1) {
+            /* generate jump-table output */
+            ptr2 = ira->jmp.jmpTable[ira->jmp.jmpIndex].end >= ptr2 ? ptr2 : ira->jmp.jmpTable[ira->jmp.jmpIndex].end;
+            GenJmptab((uint8_t *) ira->buffer + (ptr1 - ira->params.prgStart), ira->jmp.jmpTable[ira->jmp.jmpIndex].size, ptr1,
+                      (int32_t) ira->jmp.jmpTable[ira->jmp.jmpIndex].base, (ptr2 - ptr1) / ira->jmp.jmpTable[ira->jmp.jmpIndex].size);
+            ira->jmp.jmpIndex++;
+            ptr1 = ptr2;
+            continue;
+        }
+
+        if (ira->p2labind < ira->labcount && ira->LabelAdr2[ira->p2labind] < ptr2)
+            ptr2 = ira->LabelAdr2[ira->p2labind];
+        if (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start < ptr2)
+            ptr2 = ira->jmp.jmpTable[ira->jmp.jmpIndex].start; /* stop at next jump-table */
+
+        /* sync with text table */
+        while (ira->text.textIndex < ira->text.textCount && ptr1 >= ira->text.textEnd[ira->text.textIndex]) {
+            fprintf(ira->files.errFile, "Watch out: TEXT $%08lx-$%08lx probably in code. Ignored.\n", (unsigned long) ira->text.textStart[ira->text.textIndex],
+                    (unsigned long) ira->text.textEnd[ira->text.textIndex]);
+            ira->text.textIndex++;
+        }
+        /* check for user defined text block at ptr1 */
+        if (ira->text.textIndex < ira->text.textCount && ptr1 >= ira->text.textStart[ira->text.textIndex]) {
+            if (ptr2 > ira->text.textEnd[ira->text.textIndex])
+                ptr2 = ira->text.textEnd[ira->text.textIndex];
+            text = 99;
+            ira->text.textIndex++;
+        } else if (ira->text.textIndex < ira->text.textCount && ptr1 < ira->text.textStart[ira->text.textIndex] && ptr2 > ira->text.textStart[ira->text.textIndex])
+            ptr2 = ira->text.textStart[ira->text.textIndex];
+
+        buf = (uint8_t *) ira->buffer + ptr1 - ira->params.prgStart;
+
+        /* a text must have a minimum length */
+        if (text == 0 && (ptr2 - ptr1) > 4) {
+            /* I think a text shouldn't begin with a zero-byte */
+            if (buf[0] != 0) {
+                for (j = 0, zero = 0, text = 1; j < (ptr2 - ptr1); j++) {
+                    /* First check for TEXT area */
+                    if (ira->text.textIndex < ira->text.textCount && ptr1 + j >= ira->text.textStart[ira->text.textIndex]) {
+                        if (ptr2 > ira->text.textEnd[ira->text.textIndex])
+                            ptr2 = ira->text.textEnd[ira->text.textIndex];
+                        text = 99;
+                        j = ptr2 - ptr1;
+                        zero = 0;
+                        ira->text.textIndex++;
+                        break;
+                    }
+
+                    if (buf[j] == 0) {
+                        if ((j + 1) < (ptr2 - ptr1)) {
+                            if (buf[j + 1] == 0) {
+                                zero++;
+                                if (zero > 4) {
+                                    text = 0;
+                                    break;
+                                }
+                            } else if (text < 4) {
+                                text = 0;
+                            }
+                        }
+                    } else if (!isprint(buf[j]) && !isspace(buf[j]) && buf[j] != 0x1b && buf[j] != 0x9b) {
+                        text = 0;
+                        break;
+                    } else {
+                        text++;
+                        zero = 0;
+                    }
+                }
+
+                if (j == 0)
+                    text = 0;
+                else if ((buf[j - 1] != 0) && (text < 6))
+                    text = 0;
+                if (text < 4)
+                    text = 0;
+                if (zero > 4)
+                    text = 0;
+            }
+        }
+
+        if (text) {
+            /* write buffer to file */
+            if (ira->params.pFlags & ADR_OUTPUT) {
+                mnecat(";");
+                mnecat(itohex(ptr1, ira->adrlen));
+                Output();
+            }
+
+            if ((ptr2 - ptr1) > 10000)
+                fprintf(ira->files.msgFile, "ptr1=%08lx  ptr2=%08lx  end=%08lx\n", (unsigned long) ptr1, (unsigned long) ptr2, (unsigned long) ira->params.prgEnd);
+
+            if (ira->params.pFlags & ADR_OUTPUT) {
+                for (i = 0; i < ((ptr2 - ptr1 - 1) / 16 + 1); i++) {
+                    strcpy(tptr, "\t;DC.B\t");
+                    k = 7;
+                    strcpy(&tptr[k++], "$");
+                    strcpy(&tptr[k], itohex((uint32_t) buf[i * 16], 2));
+                    k += 2;
+                    for (j = i * 16 + 1; j < (ptr2 - ptr1) && j < ((i + 1) * 16); j++) {
+                        strcpy(&tptr[k], ",$");
+                        k += 2;
+                        strcpy(&tptr[k], itohex((uint32_t) buf[j], 2));
+                        k += 2;
+                    }
+                    tptr[k++] = '\n';
+                    WriteTarget(tptr, k);
+                }
+            }
+
+            /* create string */
+            for (tflag = 0, j = 0, k = 0, l = 0; j < (ptr2 - ptr1); j++, l++) {
+                if (j == 0 || l > 60 || (j > 0 && buf[j - 1] == 0 && buf[j] != 0) || (j > 0 && buf[j - 1] == 10 && buf[j] != 0 && buf[j] != 10)) {
+                    if (tflag) {
+                        if (tflag == 1)
+                            tptr[k++] = '\"';
+                        tptr[k++] = '\n';
+                        WriteTarget(tptr, k);
+                        k = 0;
+                    }
+                    strcpy(&tptr[k], "\tDC.B\t");
+                    k += 6;
+                    tflag = 0;
+                    l = 0;
+                }
+                if (isprint(buf[j])) {
+                    if (tflag == 0)
+                        tptr[k++] = '\"';
+                    if (tflag == 2) {
+                        tptr[k++] = ',';
+                        tptr[k++] = '\"';
+                    }
+                    if (ira->params.pFlags & ESCCODES) {
+                        if (buf[j] == '\"' || buf[j] == '\'' || buf[j] == '\\')
+                            tptr[k++] = '\\';
+                    } else {
+                        if (buf[j] == '\"')
+                            tptr[k++] = '\"';
+                    }
+                    tptr[k++] = buf[j];
+                    tflag = 1;
+                } else {
+                    if (tflag == 1) {
+                        tptr[k++] = '\"';
+                        tptr[k++] = ',';
+                    }
+                    if (tflag == 2)
+                        tptr[k++] = ',';
+                    strcpy(&tptr[k], itoa((uint32_t) buf[j]));
+                    if (buf[j] > 99)
+                        k += 3;
+                    else if (buf[j] > 9)
+                        k += 2;
+                    else
+                        k++;
+                    tflag = 2;
+                }
+            }
+            if (tflag == 1)
+                tptr[k++] = '\"';
+            tptr[k++] = '\n';
+
+            /* write last line */
+            WriteTarget(tptr, k);
+        } else { /* !text */
+            /* First, let's check if there is any equate between ptr1 and ptr2
+             * note: CheckEquate() returns equate's address or ptr2 */
+            ptr2 = CheckEquate(ira, ptr1, ptr2);
+
+            /* Align to next even address by starting with a byte DS or DC */
+            if (((uintptr_t) buf) & 1) {
+                if ((*buf) == 0) {
+                    mnecat("DS.B");
+                    adrcat("1");
+                } else {
+                    mnecat("DC.B");
+                    adrcat("$");
+                    adrcat(itohex(*buf, 2));
+                }
+                dtacat(itohex(ptr1, ira->adrlen));
+
+                buf++;
+                ptr1++;
+                Output();
+            }
+            longs_per_line = 0;
+            while ((ptr2 - ptr1) >= 4) {
+                if (be32(buf) == 0) {
+                    if (longs_per_line)
+                        Output();
+                    longs_per_line = 0;
+                    dtacat(itohex(ptr1, ira->adrlen));
+                    for (i = 0; (ptr2 - ptr1) >= sizeof(uint32_t) && be32(buf) == 0; ptr1 += sizeof(uint32_t), buf += sizeof(uint32_t))
+                        i++;
+                    mnecat("DS.L");
+                    adrcat(itoa(i));
+                    Output();
+                } else {
+                    if (longs_per_line == 0) {
+                        mnecat("DC.L");
+                        adrcat("$");
+                        dtacat(itohex(ptr1, ira->adrlen));
+                    } else {
+                        adrcat(",$");
+                    }
+                    adrcat(itohex(be32(buf), 8));
+                    longs_per_line++;
+                    buf += 4;
+                    ptr1 += 4;
+                    if (longs_per_line == 4) {
+                        longs_per_line = 0;
+                        Output();
+                    }
+                }
+            }
+            if (longs_per_line)
+                Output();
+            if ((ptr2 - ptr1) > 1) {
+                if (be16(buf) == 0) {
+                    mnecat("DS.W");
+                    adrcat("1");
+                } else {
+                    mnecat("DC.W");
+                    adrcat("$");
+                    adrcat(itohex(be16(buf), 4));
+                }
+                dtacat(itohex(ptr1, ira->adrlen));
+                buf += 2;
+                ptr1 += 2;
+                Output();
+            }
+            if (ptr2 - ptr1) {
+                if ((*buf) == 0) {
+                    mnecat("DS.B");
+                    adrcat("1");
+                } else {
+                    mnecat("DC.B");
+                    adrcat("$");
+                    adrcat(itohex(*buf, 2));
+                }
+                dtacat(itohex(ptr1, ira->adrlen));
+                buf++;
+                ptr1++;
+                Output();
+            }
+        }
+
+        ptr1 = ptr2;
+    }
+
+    ira->prgCount = (end - ira->params.prgStart) / 2;
+}
+
+/* Go on after the areas first to last as if they had been written */
+static void SkipAreas(ira_t *ira, uint32_t first, uint32_t last) {
+    uint32_t area;
+
+    for (area = first; area < last; area++) {
+        while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea1[area]))
+            ira->modulcnt++;
+        while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea2[area]))
+            ira->modulcnt++;
+    }
+    SyncAdr(ira, last < ira->codeArea.codeAreas ? ira->codeArea.codeArea1[last] : ira->params.prgEnd);
+}
+
+/* Pass 2 of all areas after a -CACHE hit: the text of the unchanged parts
+ * is copied from the cache, the others are written */
+static void WriteTextParts(ira_t *ira) {
+    TextPart_t *part;
+    uint32_t area, last, i;
+
+    for (i = 0; i < ira->textPartCount; i++) {
+        part = &ira->textParts[i];
+        last = i + 1 < ira->textPartCount ? part[1].first : ira->codeArea.codeAreas;
+        if (part->cached) {
+            ira->areaOffset[part->first] = TargetOffset();
+            if (fseek(ira->files.readFile, (long) part->offset, SEEK_SET) || FileToTarget(ira->files.readFile, part->size))
+                ExitPrg("Can't read cache file of \"%s\".", ira->filenames.sourceName);
+            SkipAreas(ira, part->first, last);
+        } else
+            for (area = part->first; area < last; area++)
+                WriteArea(ira, area);
+    }
+}
+
+#ifdef IRA_THREADS
+typedef struct AreaJob_s {
+    ira_t ira;
+    uint32_t first;
+    uint32_t last;
+    pthread_t thread;
+    jmp_buf exitJump;
+    int failed; /* the message is in ira.exitText */
+} AreaJob_t;
+
+typedef struct AreaPool_s {
+    AreaJob_t *jobs;
+    uint32_t count;
+    uint32_t next;
+    int failed; /* no more jobs are taken */
+    pthread_mutex_t lock;
+} AreaPool_t;
+
+/* Split the areas into at most count parts, each with a copy of ira_t
+ * starting in the right section. A part only starts after some data, a
+ * section written at the end of a code area has already taken the labels
+ * at its start. With -SPLITFILE a part starts with a section, otherwise
+ * it is about size bytes long. */
+static uint32_t PlanAreaJobs(ira_t *ira, AreaJob_t *jobs, uint32_t count, uint32_t size) {
+    uint32_t area, modulcnt = ~0, n = 0;
+    int start;
+
+    for (area = 0; area < ira->codeArea.codeAreas; area++) {
+        if (area == 0)
+            start = 1;
+        else if (n >= count || ira->codeArea.codeArea2[area - 1] >= ira->codeArea.codeArea1[area])
+            start = 0;
+        else if (ira->params.pFlags & SPLITFILE)
+            start = (modulcnt + 1) < ira->hunkCount && ira->hunksOffs[modulcnt + 1] == ira->codeArea.codeArea1[area];
+        else
+            start = ira->codeArea.codeArea1[area] - ira->params.prgStart >= n * size;
+        if (start) {
+            if (n)
+                jobs[n - 1].last = area;
+            jobs[n].first = area;
+            jobs[n].ira = *ira;
+            jobs[n].ira.modulcnt = modulcnt;
+            jobs[n].ira.decoded = 0;
+            /* its own target, if any, is opened for it */
+            jobs[n].ira.files.targetFile = NULL;
+            memset(&jobs[n].ira.files.writer, 0, sizeof(Writer_t));
+            jobs[n].ira.files.written = 0;
+            n++;
+        }
+        while (((modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[modulcnt + 1] == ira->codeArea.codeArea1[area]))
+            modulcnt++;
+        while (((modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[modulcnt + 1] == ira->codeArea.codeArea2[area]))
+            modulcnt++;
+    }
+    if (n)
+        jobs[n - 1].last = ira->codeArea.codeAreas;
+
+    return n;
+}
+
+/* Pass 2 of a part on its thread. With sections, it closes its section
+ * file and the last part writes the last label. */
+static void WriteAreaJob(AreaJob_t *job, int sections, int last) {
+    uint32_t area;
+
+    ira = &job->ira;
+    ira->exitJump = &job->exitJump;
+    ira->part = 1;
+    if (setjmp(job->exitJump)) {
+        job->failed = 1;
+        return;
+    }
+    for (area = job->first; area < job->last; area++)
+        WriteArea(ira, area);
+    if (sections) {
+        if (last)
+            WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
+        CloseTarget();
+    }
+}
+
+static void *WriteAreasThread(void *arg) {
+    WriteAreaJob(arg, 0, 0);
+    return NULL;
+}
+
+/* Take section files from the pool until none is left */
+static void *WriteSectionsThread(void *arg) {
+    AreaPool_t *pool = arg;
+    AreaJob_t *job;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        job = pool->next < pool->count && !pool->failed ? &pool->jobs[pool->next++] : NULL;
+        pthread_mutex_unlock(&pool->lock);
+        if (!job)
+            break;
+
+        WriteAreaJob(job, 1, job == &pool->jobs[pool->count - 1]);
+        if (job->failed) {
+            pthread_mutex_lock(&pool->lock);
+            pool->failed = 1;
+            pthread_mutex_unlock(&pool->lock);
+        }
+    }
+    return NULL;
+}
+
+/* The first part here, then the others appended in address order as
+ * *joined goes through them. Returns the part that failed, NULL if none. */
+static ira_t *WriteFirstPart(ira_t *ira, AreaPool_t *pool, uint32_t *joined, ira_t **last) {
+    jmp_buf exitJump;
+    AreaJob_t *job;
+    uint64_t offset;
+    uint32_t area;
+
+    ira->exitJump = &exitJump;
+    ira->part = 1;
+    if (setjmp(exitJump))
+        return ira;
+
+    for (area = 0; area < pool->jobs[0].last; area++)
+        WriteArea(ira, area);
+    *last = ira;
+
+    while (*joined < pool->count) {
+        job = &pool->jobs[(*joined)++];
+        pthread_join(job->thread, NULL);
+        if (job->failed)
+            return &job->ira;
+        /* the part wrote its area offsets from its own start */
+        if (ira->areaOffset)
+            for (area = job->first, offset = TargetOffset(); area < job->last; area++)
+                ira->areaOffset[area] += offset;
+        AppendTarget(&job->ira.files);
+        *last = &job->ira;
+    }
+    return NULL;
+}
+
+/* Pass 2 of all areas and the last label, on -JOBS threads.
+ * Without -SPLITFILE the first part is written here and the others into
+ * temporary files, then appended in address order, so memory doesn't grow
+ * with the output. With -SPLITFILE every part writes its own section files.
+ * An error of any part ends the program here, once all parts are joined
+ * and their targets closed. */
+static void WriteAreasParallel(ira_t *ira) {
+    AreaPool_t pool;
+    pthread_t *threads;
+    ira_t *last, *failed = NULL;
+    FILE *file;
+    char exitText[sizeof(ira->exitText)];
+    uint32_t count = ira->params.jobs, joined = 1, n;
+
+    if (ira->params.pFlags & SPLITFILE)
+        n = ira->hunkCount + 1;
+    else
+        n = count;
+    if (n > ira->codeArea.codeAreas)
+        n = ira->codeArea.codeAreas;
+    pool.jobs = mycalloc(n * sizeof(AreaJob_t));
+    pool.count = n = PlanAreaJobs(ira, pool.jobs, n, (ira->params.prgEnd - ira->params.prgStart) / (n ? n : 1));
+    pool.next = 0;
+    pool.failed = 0;
+    last = n ? &pool.jobs[n - 1].ira : ira;
+
+    if (ira->params.pFlags & SPLITFILE) {
+        if (count > n)
+            count = n;
+        threads = myalloc(count * sizeof(pthread_t));
+        pthread_mutex_init(&pool.lock, NULL);
+        for (n = 0; n < count; n++)
+            if (pthread_create(&threads[n], NULL, WriteSectionsThread, &pool)) {
+                pthread_mutex_lock(&pool.lock);
+                pool.failed = 1;
+                pthread_mutex_unlock(&pool.lock);
+                snprintf(ira->exitText, sizeof(ira->exitText), "Can't start Pass 2 thread!");
+                failed = ira;
+                break;
+            }
+        count = n;
+        for (n = 0; n < count; n++)
+            pthread_join(threads[n], NULL);
+        pthread_mutex_destroy(&pool.lock);
+        myfree(threads);
+        for (n = 0; n < pool.count; n++)
+            if (pool.jobs[n].failed) {
+                DiscardTarget(&pool.jobs[n].ira.files);
+                if (!failed)
+                    failed = &pool.jobs[n].ira;
+            }
+    } else if (n) {
+        for (count = 1; count < n; count++) {
+            if (!(file = tmpfile())) {
+                snprintf(ira->exitText, sizeof(ira->exitText), "Can't open a temporary file for Pass 2!");
+                break;
+            }
+            OpenTargetFile(&pool.jobs[count].ira.files, file);
+            if (pthread_create(&pool.jobs[count].thread, NULL, WriteAreasThread, &pool.jobs[count])) {
+                DiscardTarget(&pool.jobs[count].ira.files);
+                snprintf(ira->exitText, sizeof(ira->exitText), "Can't start Pass 2 thread!");
                 break;
+            }
         }
-        adrcat("(");
-        GetLabel(adr, MODE_INVALID);
-        adrcat(")-(");
-        GetLabel(base, MODE_INVALID);
-        adrcat(")");
-        Output();
+        /* the parts started */
+        pool.count = count;
+
+        if (count < n)
+            failed = ira;
+        else
+            failed = WriteFirstPart(ira, &pool, &joined, &last);
+        ira->exitJump = NULL;
+        ira->part = 0;
+        if (failed) {
+            for (; joined < pool.count; joined++)
+                pthread_join(pool.jobs[joined].thread, NULL);
+            for (n = 1; n < pool.count; n++)
+                DiscardTarget(&pool.jobs[n].ira.files);
+        }
+    }
+
+    if (failed) {
+        strcpy(exitText, failed->exitText);
+        myfree(pool.jobs);
+        ExitPrg("%s", exitText);
+    }
+
+    /* go on from where the last part stopped */
+    ira->prgCount = last->prgCount;
+    ira->nextreloc = last->nextreloc;
+    ira->p2labind = last->p2labind;
+    ira->modulcnt = last->modulcnt;
+    ira->jmp.jmpIndex = last->jmp.jmpIndex;
+    ira->text.textIndex = last->text.textIndex;
+    ira->commentIndex = last->commentIndex;
+    ira->bannerIndex = last->bannerIndex;
+    for (n = 0; n < pool.count; n++) {
+        ira->decoded += pool.jobs[n].ira.decoded;
+        /* appended parts are counted by the target they went to */
+        if (ira->params.pFlags & SPLITFILE)
+            ira->files.written += pool.jobs[n].ira.files.written;
+    }
+    myfree(pool.jobs);
+
+    if (!(ira->params.pFlags & SPLITFILE)) {
+        if (ira->areaOffset)
+            ira->areaOffset[ira->codeArea.codeAreas] = TargetOffset();
+        WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
     }
 }
+#endif
 
 void DPass2(ira_t *ira) {
-    uint16_t tflag, text, dummy;
-    uint16_t longs_per_line, byte_count;
-    int32_t dummy1;
+    uint16_t tflag, text;
     uint32_t dummy2;
-    uint32_t i, j, k, l, m, r, rel, zero, alpha;
-    uint8_t *buf, *tptr;
-    uint32_t ptr1, ptr2, end, area;
-    char *equate_name;
+    uint32_t i, j, k, rel, alpha;
+    uint8_t *buf;
+    uint32_t area;
 
     ira->pass = 2;
-    ira->LabelAdr2 = mycalloc(ira->label.labelMax * 4 + 4);
+    StatsStart(ira);
+    SortLabels();
+    SortXrefs();
+    ira->LabelAdr2 = mytcalloc(ira->label.labelMax * 4 + 4, MEM_LABELS);
 
     if (ira->labcount) { /* Wenn ueberhaupt Labels vorhanden sind */
-        fprintf(stderr, "Pass 2: correcting labels\n");
-        if (!(ira->files.labelFile = fopen(ira->filenames.labelName, "rb")))
-            ExitPrg("Can't open label file \"%s\" for reading.", ira->filenames.labelName);
-
-        ira->labelbuf = mycalloc(ira->labc1 * sizeof(uint32_t));
-        fread(ira->labelbuf, sizeof(uint32_t), ira->labc1, ira->files.labelFile);
-        fclose(ira->files.labelFile);
-        ira->files.labelFile = 0;
-        delfile(ira->filenames.labelName);
+        fprintf(ira->files.errFile, "Pass 2: correcting labels\n");
         for (i = 0; i < ira->labcount; i++) {
-            dummy1 = ira->LabelAdr2[i] = ira->label.labelAdr[i];
-            if (dummy1 < (int32_t) ira->params.prgStart)
-                ira->LabelAdr2[i] = ira->params.prgStart;
-            /* Binaeres Suchen von dummy1 */
-            l = 0;
-            r = ira->labc1;
-            while (l < r) {
-                m = (l + r) / 2;
-                if ((int32_t) ira->labelbuf[m] < dummy1)
-                    l = m + 1;
-                else
-                    r = m;
-            }
-            if (ira->labelbuf[r] != dummy1 || r == ira->labc1) {
-                if (r > 0)
-                    ira->LabelAdr2[i] = ira->labelbuf[r - 1];
-                else
-                    ira->LabelAdr2[i] = 0;
-            }
+            ira->LabelAdr2[i] = ira->label.labelAdr[i];
+            /* Label inside of an instruction or a relocation: move it back to the start */
+            if (!IsPass1Adr(ira->label.labelAdr[i]))
+                ira->LabelAdr2[i] = PrevPass1Adr(ira->label.labelAdr[i]);
         }
     } /* Ende der Labelbearbeitung */
+    StatsStop(ira, STATS_LABELS);
 
     if (ira->params.textMethod) {
-        fprintf(stderr, "Pass 2: searching for text\n");
+        fprintf(ira->files.errFile, "Pass 2: searching for text\n");
+        StatsStart(ira);
 
         for (ira->modulcnt = 0; ira->modulcnt < ira->hunkCount; ira->modulcnt++) {
             /* BSS hunk --> there is no text */
@@ -605,10 +1478,10 @@ void DPass2(ira_t *ira) {
                 }
 
                 /* relocations don't have to be in a text */
-                while (ira->reloc.relocAdr[rel] <= (i + ira->hunksOffs[ira->modulcnt] - 4) && rel < ira->relocount)
+                while (ira->reloc.relocs[rel].adr <= (i + ira->hunksOffs[ira->modulcnt] - 4) && rel < ira->relocount)
                     rel++;
                 if (rel < ira->relocount) {
-                    if (ira->reloc.relocAdr[rel] <= (k + ira->hunksOffs[ira->modulcnt])) {
+                    if (ira->reloc.relocs[rel].adr <= (k + ira->hunksOffs[ira->modulcnt])) {
                         i = k;
                         continue;
                     }
@@ -617,44 +1490,46 @@ void DPass2(ira_t *ira) {
                 if (text) {
                     /* RTS --> seems to be code */
                     if (be16(&buf[k - 2]) == RTS_CODE) {
-                        printf("TEXT\t%08lx:\n", (unsigned long) (ira->hunksOffs[ira->modulcnt] + i));
-                        printf("\tDC.B\t");
+                        fprintf(ira->files.msgFile, "TEXT\t%08lx:\n", (unsigned long) (ira->hunksOffs[ira->modulcnt] + i));
+                        fprintf(ira->files.msgFile, "\tDC.B\t");
                         for (tflag = 0, j = i; j <= k; j++) {
                             if (isprint(buf[j]) && buf[j] != '\"') {
                                 if (tflag == 0)
-                                    printf("\"%c", buf[j]);
+                                    fprintf(ira->files.msgFile, "\"%c", buf[j]);
                                 if (tflag == 1)
-                                    printf("%c", buf[j]);
+                                    fprintf(ira->files.msgFile, "%c", buf[j]);
                                 if (tflag == 2)
-                                    printf(",\"%c", buf[j]);
+                                    fprintf(ira->files.msgFile, ",\"%c", buf[j]);
                                 tflag = 1;
                             } else {
                                 if (tflag == 0)
-                                    printf("%d", (int) buf[j]);
+                                    fprintf(ira->files.msgFile, "%d", (int) buf[j]);
                                 if (tflag == 1)
-                                    printf("\",%d", (int) buf[j]);
+                                    fprintf(ira->files.msgFile, "\",%d", (int) buf[j]);
                                 if (tflag == 2)
-                                    printf(",%d", (int) buf[j]);
+                                    fprintf(ira->files.msgFile, ",%d", (int) buf[j]);
                                 tflag = 2;
                             }
                         }
                         if (tflag == 1)
-                            printf("\"\n");
+                            fprintf(ira->files.msgFile, "\"\n");
                         if (tflag == 2)
-                            printf("\n");
+                            fprintf(ira->files.msgFile, "\n");
                     }
                 }
                 i = k;
             }
         }
+        StatsStop(ira, STATS_TEXT);
     }
 
-    fprintf(stderr, "Pass 2: writing mnemonics\n");
+    fprintf(ira->files.errFile, "Pass 2: writing mnemonics\n");
+    StatsStart(ira);
 
-    if (!(ira->files.targetFile = fopen(ira->filenames.targetName, "w")))
+    if (!OpenTarget(ira->filenames.targetName))
         ExitPrg("Can't open target file \"%s\" for writing.", ira->filenames.targetName);
 
-    fprintf(ira->files.targetFile, IDSTRING2, VERSION, REVISION);
+    TargetPrintf(IDSTRING2, VERSION, REVISION);
 
     /* Write EQU's */
     if (ira->XRefCount) {
@@ -663,10 +1538,10 @@ void DPass2(ira_t *ira) {
             GetExtName(i);
             if (strlen(ira->adrbuf) < 8)
                 adrcat("\t");
-            fprintf(ira->files.targetFile, EQUATE_TEMPLATE_HEXA, ira->adrbuf, (unsigned long) ira->XRefList[i]);
+            TargetPrintf(EQUATE_TEMPLATE_HEXA, ira->adrbuf, (unsigned long) ira->XRefList[i]);
         }
         ira->adrbuf[0] = 0;
-        fprintf(ira->files.targetFile, "\n");
+        TargetPrintf("\n");
     }
 
     /* Write custom EQU's (from config file) */
@@ -685,15 +1560,15 @@ void DPass2(ira_t *ira) {
     if (ira->params.cpuType & M68060)
         dummy2 = 68060;
     if (dummy2 != 68000)
-        fprintf(ira->files.targetFile, "\tMC%ld\n", (long) dummy2);
+        TargetPrintf("\tMC%ld\n", (long) dummy2);
     if ((ira->params.cpuType & FPU_EXTERNAL) && !(ira->params.cpuType & FPU_INTERNAL))
-        fprintf(ira->files.targetFile, "\tMC6888%c\n", (ira->params.cpuType & M68881) ? '1' : '2');
+        TargetPrintf("\tMC6888%c\n", (ira->params.cpuType & M68881) ? '1' : '2');
     if (dummy2 == 68020 && (ira->params.cpuType & MMU_EXTERNAL))
-        fprintf(ira->files.targetFile, "\tMC68851\n");
-    fprintf(ira->files.targetFile, "\n");
+        TargetPrintf("\tMC68851\n");
+    TargetPrintf("\n");
 
     if (ira->params.pFlags & BASEREG2)
-        WriteBaseDirective(ira->files.targetFile);
+        WriteBaseDirective();
 
     /* If split, write INCLUDE directives */
     if (ira->params.pFlags & SPLITFILE) {
@@ -701,11 +1576,10 @@ void DPass2(ira_t *ira) {
             if (!ira->hunksSize[ira->modulcnt])
                 if (!(ira->params.pFlags & KEEP_ZEROHUNKS))
                     continue;
-            fprintf(ira->files.targetFile, "\tINCLUDE\t\"%s.S%s\"\n", ira->filenames.targetName, itoa(ira->modulcnt));
+            TargetPrintf("\tINCLUDE\t\"%s.S%s\"\n", ira->filenames.targetName, itoa(ira->modulcnt));
         }
-        fprintf(ira->files.targetFile, "\tEND\n");
-        fclose(ira->files.targetFile);
-        ira->files.targetFile = 0;
+        TargetPrintf("\tEND\n");
+        CloseTarget();
     }
 
     ira->prgCount = 0;
@@ -716,492 +1590,57 @@ void DPass2(ira_t *ira) {
     ira->text.textIndex = 0;
     ira->jmp.jmpIndex = 0;
 
-    for (area = 0; area < ira->codeArea.codeAreas; area++) {
-        while ((ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea1[area]) && ((ira->modulcnt + 1) < ira->hunkCount)) {
-            ira->modulcnt++;
-            if (ira->params.pFlags & SPLITFILE)
-                SplitOutputFiles(&ira->files, &ira->filenames, ira->modulcnt);
-            WriteSection(ira);
-        }
-
-        ira->dtabuf[0] = 0;
-        ira->adrbuf[0] = 0;
-        ira->mnebuf[0] = 0;
-
-        /* HERE BEGINS THE CODE PART OF PASS 2 */
-        /***************************************/
-
-        ira->codeArea.codeAreaEnd = (ira->codeArea.codeArea2[area] - ira->params.prgStart) / 2;
-
-        CheckPhase(-1); /* phase sync */
-
-        while (ira->prgCount < ira->codeArea.codeAreaEnd) {
-            CheckPhase(ira->prgCount * 2 + ira->params.prgStart);
-
-            WriteBanner(ira->params.prgStart + ira->prgCount * 2);
-            WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
-            WriteComment(ira->params.prgStart + ira->prgCount * 2);
-
-            dtacat(itohex(ira->params.prgStart + ira->prgCount * 2, ira->adrlen));
-            dtacat(": ");
-            if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
-                mnecat("DC.L");
-                dtacat(itohex(be16(&ira->buffer[ira->prgCount]), 4));
-                dtacat(itohex(be16(&ira->buffer[ira->prgCount + 1]), 4));
-                GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
-                ira->nextreloc++;
-                Output();
-                ira->prgCount += 2;
-                continue;
-            }
-            ira->pc = ira->prgCount;
-            ira->seaow = be16(&ira->buffer[ira->prgCount++]);
-            dtacat(itohex(ira->seaow, 4));
-
-            GetOpCode(ira, ira->seaow);
-
-            mnecat(instructions[ira->opCodeNumber].opcode);
-            if (instructions[ira->opCodeNumber].flags & OPF_ONE_MORE_WORD) {
-                ira->extra = be16(&ira->buffer[ira->prgCount]);
-                ira->ext_register = (ira->extra & REGISTER_EXTENSION_MASK) >> 12;
-                if (P2WriteReloc())
-                    continue;
-            }
-
-            if (instructions[ira->opCodeNumber].flags & OPF_APPEND_CC) {
-                dummy = (ira->seaow & cc_MASK) >> 8;
-                /* note: For Bcc, CC "T" (0000) and "F" (0001) don't exist. Bcc with 0000 is BRA and Bcc with 0001 is BSR.
-                 *       cpu_cc[] should contain 16 items (as CC is coded over 4 bits) but actually contains 18.
-                 *       Why ?
-                 *       Because, 17th and 18th items are "RA" and "SR".
-                 *       It is a trick to have BRA and BSR instead of BT and BF by adding 16 to CC got in dummy variable */
-                if (instructions[ira->opCodeNumber].family == OPC_Bcc && dummy < 2)
-                    dummy += 16;
-                mnecat(cpu_cc[dummy]);
-            }
-
-            if (instructions[ira->opCodeNumber].flags & OPF_APPEND_PCC) {
-                if (instructions[ira->opCodeNumber].family == OPC_PBcc)
-                    dummy = ira->seaow;
-                else
-                    dummy = ira->extra;
-                mnecat(mmu_cc[dummy & Pcc_MASK]);
-            }
-
-            DoSpecific(ira, 2);
-
-            if (instructions[ira->opCodeNumber].flags & OPF_APPEND_SIZE) {
-                if (ira->extension != 3) {
-                    mnecat(extensions[ira->extension]);
-                } else {
-                    ira->addressMode = MODE_INVALID;
-                }
-            }
-
-            if (instructions[ira->opCodeNumber].sourceadr) {
-                if (DoAdress2(instructions[ira->opCodeNumber].sourceadr))
-                    continue;
-
-                if (instructions[ira->opCodeNumber].destadr)
-                    adrcat(",");
-            }
-
-            if (instructions[ira->opCodeNumber].destadr) {
-                if (instructions[ira->opCodeNumber].family == OPC_MOVE) {
-                    ira->addressMode = ((ira->seaow & ALT_MODE_MASK) >> 3) | ira->alt_register;
-                    if (ira->addressMode < EA_MODE_FIELD_MASK)
-                        ira->addressMode = (ira->addressMode >> 3);
-                    else
-                        ira->addressMode = 7 + ira->alt_register;
-                    ira->ea_register = ira->alt_register;
-                }
-
-                if (DoAdress2(instructions[ira->opCodeNumber].destadr))
-                    continue;
-
-                /* Third PACK and UNPK adjustment operand */
-                if (instructions[ira->opCodeNumber].family == OPC_PACK_UNPACK) {
-                    adrcat(",#");
-                    equate_name = GetEquate(2, (ira->prgCount - 1) << 1);
-                    if (equate_name)
-                        adrcat(equate_name);
-                    else {
-                        adrcat("$");
-                        adrcat(itohex(ira->extra, 4));
-                    }
-                }
-            }
-
-            Output();
-            CheckNoBase(ira->params.prgStart + ira->prgCount * 2);
-
-            if (ira->prgCount > ira->codeArea.codeAreaEnd)
-                fprintf(stderr, "P2 Watch out: prgCount*2(=%08lx) > (prgEnd-prgStart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
-                        (unsigned long) (ira->params.prgEnd - ira->params.prgStart));
-        }
-
-        while ((ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea2[area]) && ((ira->modulcnt + 1) < ira->hunkCount)) {
-            ira->modulcnt++;
-            if (ira->params.pFlags & SPLITFILE)
-                SplitOutputFiles(&ira->files, &ira->filenames, ira->modulcnt);
-            WriteSection(ira);
-        }
-
-        /* HERE BEGINS THE DATA PART OF PASS 2 */
-        /***************************************/
+    ReadCacheText(ira);
 
-        ptr1 = ira->codeArea.codeArea2[area];
-        if ((area + 1) < ira->codeArea.codeAreas)
-            end = ira->codeArea.codeArea1[area + 1];
+#ifdef IRA_THREADS
+    /* ExitPrg() can't return to an IraDisassemble() caller from another thread.
+     * -JOBS of -BATCH and -SERVE counts their workers, which write on their own. */
+    if (ira->params.jobs > 1 && !(ira->params.pFlags & (BASEREG2 | BATCH | SERVE)) && !ira->exitJump && !ira->textPartsCached)
+        WriteAreasParallel(ira);
+    else
+#endif
+    {
+        if (ira->textPartsCached)
+            WriteTextParts(ira);
         else
-            end = ira->params.prgEnd;
-
-        while (ptr1 < end) {
-            text = 0;
-
-            buf = (uint8_t *) ira->buffer + ptr1 - ira->params.prgStart;
-
-            WriteBanner(ptr1);
-            /* write label and/or relocation */
-            WriteLabel2(ptr1);
-            WriteComment(ptr1);
-            if (ira->reloc.relocAdr[ira->nextreloc] == ptr1) {
-                mnecat("DC.L");
-                GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
-                dtacat(itohex(ptr1, ira->adrlen));
-                dtacat(": ");
-                dtacat(itohex(be32(buf), 8));
-
-                ptr1 += 4;
-                ptr2 = ptr1;
-                ira->nextreloc++;
-
-                Output();
-                continue;
-            }
-
-            /* Check each possible size of equate (4, 2 and 1) */
-            for (i = 4; i; i >>= 1)
-                if ((equate_name = GetEquate(i, ptr1))) {
-                    mnecat("DC");
-                    mnecat(extensions[i >> 1]);
-                    adrcat(equate_name);
-                    /* In case of equate output, let's print raw data at the end of line */
-                    dtacat(itohex(ptr1, ira->adrlen));
-                    dtacat(": ");
-                    dtacat(itohex(i == 4 ? be32(buf) : i == 2 ? be16(buf) : (*buf), i << 1));
-
-                    ptr1 += i;
-                    ptr2 = ptr1;
-
-                    Output();
-                    break;
-                }
-            /* Previous loop ends if (i == 0) or if it was "broken".
-             * If it was "broken", it means that an equate was found and
-             * IRA has to go to next iteration of current loop */
-            if (i)
-                continue;
-
-            /* sync with jump table */
-            while (ira->jmp.jmpIndex < ira->jmp.jmpCount && ptr1 > ira->jmp.jmpTable[ira->jmp.jmpIndex].start)
-                ira->jmp.jmpIndex++; /* we already warned in pass 1 about that */
-
-            /* ptr2 will be upper bound */
-            ptr2 = end;
-            if (ira->nextreloc < ira->relocount && ira->reloc.relocAdr[ira->nextreloc] < ptr2)
-                ptr2 = ira->reloc.relocAdr[ira->nextreloc];
-
-            if (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start == ptr1) {
-                /* generate jump-table output */
-                ptr2 = ira->jmp.jmpTable[ira->jmp.jmpIndex].end >= ptr2 ? ptr2 : ira->jmp.jmpTable[ira->jmp.jmpIndex].end;
-                GenJmptab((uint8_t *) ira->buffer + (ptr1 - ira->params.prgStart), ira->jmp.jmpTable[ira->jmp.jmpIndex].size, ptr1,
-                          (int32_t) ira->jmp.jmpTable[ira->jmp.jmpIndex].base, (ptr2 - ptr1) / ira->jmp.jmpTable[ira->jmp.jmpIndex].size);
-                ira->jmp.jmpIndex++;
-                ptr1 = ptr2;
-                continue;
-            }
-
-            if (ira->p2labind < ira->labcount && ira->LabelAdr2[ira->p2labind] < ptr2)
-                ptr2 = ira->LabelAdr2[ira->p2labind];
-            if (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start < ptr2)
-                ptr2 = ira->jmp.jmpTable[ira->jmp.jmpIndex].start; /* stop at next jump-table */
-
-            /* sync with text table */
-            while (ira->text.textIndex < ira->text.textCount && ptr1 >= ira->text.textEnd[ira->text.textIndex]) {
-                fprintf(stderr, "Watch out: TEXT $%08lx-$%08lx probably in code. Ignored.\n", (unsigned long) ira->text.textStart[ira->text.textIndex],
-                        (unsigned long) ira->text.textEnd[ira->text.textIndex]);
-                ira->text.textIndex++;
-            }
-            /* check for user defined text block at ptr1 */
-            if (ira->text.textIndex < ira->text.textCount && ptr1 >= ira->text.textStart[ira->text.textIndex]) {
-                if (ptr2 > ira->text.textEnd[ira->text.textIndex])
-                    ptr2 = ira->text.textEnd[ira->text.textIndex];
-                text = 99;
-                ira->text.textIndex++;
-            } else if (ira->text.textIndex < ira->text.textCount && ptr1 < ira->text.textStart[ira->text.textIndex] && ptr2 > ira->text.textStart[ira->text.textIndex])
-                ptr2 = ira->text.textStart[ira->text.textIndex];
-
-            buf = (uint8_t *) ira->buffer + ptr1 - ira->params.prgStart;
-
-            /* a text must have a minimum length */
-            if (text == 0 && (ptr2 - ptr1) > 4) {
-                /* I think a text shouldn't begin with a zero-byte */
-                if (buf[0] != 0) {
-                    for (j = 0, zero = 0, text = 1; j < (ptr2 - ptr1); j++) {
-                        /* First check for TEXT area */
-                        if (ira->text.textIndex < ira->text.textCount && ptr1 + j >= ira->text.textStart[ira->text.textIndex]) {
-                            if (ptr2 > ira->text.textEnd[ira->text.textIndex])
-                                ptr2 = ira->text.textEnd[ira->text.textIndex];
-                            text = 99;
-                            j = ptr2 - ptr1;
-                            zero = 0;
-                            ira->text.textIndex++;
-                            break;
-                        }
-
-                        if (buf[j] == 0) {
-                            if ((j + 1) < (ptr2 - ptr1)) {
-                                if (buf[j + 1] == 0) {
-                                    zero++;
-                                    if (zero > 4) {
-                                        text = 0;
-                                        break;
-                                    }
-                                } else if (text < 4) {
-                                    text = 0;
-                                }
-                            }
-                        } else if (!isprint(buf[j]) && !isspace(buf[j]) && buf[j] != 0x1b && buf[j] != 0x9b) {
-                            text = 0;
-                            break;
-                        } else {
-                            text++;
-                            zero = 0;
-                        }
-                    }
-
-                    if (j == 0)
-                        text = 0;
-                    else if ((buf[j - 1] != 0) && (text < 6))
-                        text = 0;
-                    if (text < 4)
-                        text = 0;
-                    if (zero > 4)
-                        text = 0;
-                }
-            }
-
-            if (text) {
-                /* write buffer to file */
-                if (ira->params.pFlags & ADR_OUTPUT) {
-                    mnecat(";");
-                    mnecat(itohex(ptr1, ira->adrlen));
-                    Output();
-                }
-
-                if ((ptr2 - ptr1) > 10000)
-                    printf("ptr1=%08lx  ptr2=%08lx  end=%08lx\n", (unsigned long) ptr1, (unsigned long) ptr2, (unsigned long) ira->params.prgEnd);
-
-                /* get buffer for string */
-                tptr = mycalloc((ptr2 - ptr1) * 5 + 6);
-
-                if (ira->params.pFlags & ADR_OUTPUT) {
-                    for (i = 0; i < ((ptr2 - ptr1 - 1) / 16 + 1); i++) {
-                        strcpy(tptr, "\t;DC.B\t");
-                        k = 7;
-                        strcpy(&tptr[k++], "$");
-                        strcpy(&tptr[k], itohex((uint32_t) buf[i * 16], 2));
-                        k += 2;
-                        for (j = i * 16 + 1; j < (ptr2 - ptr1) && j < ((i + 1) * 16); j++) {
-                            strcpy(&tptr[k], ",$");
-                            k += 2;
-                            strcpy(&tptr[k], itohex((uint32_t) buf[j], 2));
-                            k += 2;
-                        }
-                        tptr[k++] = '\n';
-                        WriteTarget(tptr, k);
-                    }
-                }
-
-                /* create string */
-                for (tflag = 0, j = 0, k = 0, l = 0; j < (ptr2 - ptr1); j++, l++) {
-                    if (j == 0 || l > 60 || (j > 0 && buf[j - 1] == 0 && buf[j] != 0) || (j > 0 && buf[j - 1] == 10 && buf[j] != 0 && buf[j] != 10)) {
-                        if (tflag) {
-                            if (tflag == 1)
-                                tptr[k++] = '\"';
-                            tptr[k++] = '\n';
-                        }
-                        strcpy(&tptr[k], "\tDC.B\t");
-                        k += 6;
-                        tflag = 0;
-                        l = 0;
-                    }
-                    if (isprint(buf[j])) {
-                        if (tflag == 0)
-                            tptr[k++] = '\"';
-                        if (tflag == 2) {
-                            tptr[k++] = ',';
-                            tptr[k++] = '\"';
-                        }
-                        if (ira->params.pFlags & ESCCODES) {
-                            if (buf[j] == '\"' || buf[j] == '\'' || buf[j] == '\\')
-                                tptr[k++] = '\\';
-                        } else {
-                            if (buf[j] == '\"')
-                                tptr[k++] = '\"';
-                        }
-                        tptr[k++] = buf[j];
-                        tflag = 1;
-                    } else {
-                        if (tflag == 1) {
-                            tptr[k++] = '\"';
-                            tptr[k++] = ',';
-                        }
-                        if (tflag == 2)
-                            tptr[k++] = ',';
-                        strcpy(&tptr[k], itoa((uint32_t) buf[j]));
-                        if (buf[j] > 99)
-                            k += 3;
-                        else if (buf[j] > 9)
-                            k += 2;
-                        else
-                            k++;
-                        tflag = 2;
-                    }
-                }
-                if (tflag == 1)
-                    tptr[k++] = '\"';
-                tptr[k++] = '\n';
-
-                /* write string */
-                WriteTarget(tptr, k);
-
-                /* free stringbuffer */
-                free(tptr);
-            } else { /* !text */
-                /* First, let's check if there is any equate between ptr1 and ptr2
-                 * note: CheckEquate() returns equate's address or ptr2 */
-                ptr2 = CheckEquate(ira, ptr1, ptr2);
-
-                /* Align to next even address by starting with a byte DS or DC */
-                if (((uintptr_t) buf) & 1) {
-                    if ((*buf) == 0) {
-                        mnecat("DS.B");
-                        adrcat("1");
-                    } else {
-                        mnecat("DC.B");
-                        adrcat("$");
-                        adrcat(itohex(*buf, 2));
-                    }
-                    dtacat(itohex(ptr1, ira->adrlen));
-
-                    buf++;
-                    ptr1++;
-                    Output();
-                }
-                longs_per_line = 0;
-                while ((ptr2 - ptr1) >= 4) {
-                    if (be32(buf) == 0) {
-                        if (longs_per_line)
-                            Output();
-                        longs_per_line = 0;
-                        dtacat(itohex(ptr1, ira->adrlen));
-                        for (i = 0; (ptr2 - ptr1) >= sizeof(uint32_t) && be32(buf) == 0; ptr1 += sizeof(uint32_t), buf += sizeof(uint32_t))
-                            i++;
-                        mnecat("DS.L");
-                        adrcat(itoa(i));
-                        Output();
-                    } else {
-                        if (longs_per_line == 0) {
-                            mnecat("DC.L");
-                            adrcat("$");
-                            dtacat(itohex(ptr1, ira->adrlen));
-                        } else {
-                            adrcat(",$");
-                        }
-                        adrcat(itohex(be32(buf), 8));
-                        longs_per_line++;
-                        buf += 4;
-                        ptr1 += 4;
-                        if (longs_per_line == 4) {
-                            longs_per_line = 0;
-                            Output();
-                        }
-                    }
-                }
-                if (longs_per_line)
-                    Output();
-                if ((ptr2 - ptr1) > 1) {
-                    if (be16(buf) == 0) {
-                        mnecat("DS.W");
-                        adrcat("1");
-                    } else {
-                        mnecat("DC.W");
-                        adrcat("$");
-                        adrcat(itohex(be16(buf), 4));
-                    }
-                    dtacat(itohex(ptr1, ira->adrlen));
-                    buf += 2;
-                    ptr1 += 2;
-                    Output();
-                }
-                if (ptr2 - ptr1) {
-                    if ((*buf) == 0) {
-                        mnecat("DS.B");
-                        adrcat("1");
-                    } else {
-                        mnecat("DC.B");
-                        adrcat("$");
-                        adrcat(itohex(*buf, 2));
-                    }
-                    dtacat(itohex(ptr1, ira->adrlen));
-                    buf++;
-                    ptr1++;
-                    Output();
-                }
-            }
-
-            ptr1 = ptr2;
-        }
-
-        ira->prgCount = (end - ira->params.prgStart) / 2;
-    }
+            for (area = 0; area < ira->codeArea.codeAreas; area++)
+                WriteArea(ira, area);
+        if (ira->areaOffset)
+            ira->areaOffset[ira->codeArea.codeAreas] = TargetOffset();
 
-    if (ira->params.pFlags & SPLITFILE) {
-        fclose(ira->files.targetFile);
-        ira->files.targetFile = NULL;
+        /* write last label */
+        WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
     }
 
-    /* write last label */
-    WriteLabel2(ira->params.prgStart + ira->prgCount * 2);
+    if (ira->params.pFlags & SPLITFILE)
+        CloseTarget();
 
     if (ira->p2labind != ira->labcount)
-        fprintf(stderr, "labcount=%ld  p2labind=%ld\n", (long) ira->labcount, (long) ira->p2labind);
+        fprintf(ira->files.errFile, "labcount=%ld  p2labind=%ld\n", (long) ira->labcount, (long) ira->p2labind);
 
     if (!(ira->params.pFlags & SPLITFILE))
         WriteTarget("\tEND\n", 5);
+    StatsStop(ira, STATS_RENDER);
 
-    fprintf(stderr, "100%%\n\n");
+    fprintf(ira->files.errFile, "100%%\n\n");
 }
 
 void CheckPhase(uint32_t adr) {
-    static uint32_t lc = 0;
+    uint32_t next;
 
     if (ira->labcount) {
         if (adr == -1)
-            while (lc < ira->label.labelMax && ira->labelbuf[lc] < ira->prgCount * 2 + ira->params.prgStart)
-                lc++;
+            ira->phaseAdr = NextPass1Adr(ira->prgCount * 2 + ira->params.prgStart);
         else {
             /* automatic phase sync */
-            while (lc < ira->labc1 && adr > ira->labelbuf[lc])
-                lc++;
-
-            if (adr != ira->labelbuf[lc++])
-                fprintf(stderr, "PHASE ERROR: adr=%08lx  %08lx %08lx %08lx\n", (unsigned long) adr, (unsigned long) ira->labelbuf[lc - 2], (unsigned long) ira->labelbuf[lc - 1],
-                        (unsigned long) ira->labelbuf[lc]);
-            while (lc < ira->labc1 && ira->labelbuf[lc] == ira->labelbuf[lc - 1])
-                lc++;
+            if (adr > ira->phaseAdr)
+                ira->phaseAdr = NextPass1Adr(adr);
+
+            next = NextPass1Adr(ira->phaseAdr + 1);
+            if (adr != ira->phaseAdr)
+                fprintf(ira->files.errFile, "PHASE ERROR: adr=%08lx  %08lx %08lx %08lx\n", (unsigned long) adr, (unsigned long) PrevPass1Adr(ira->phaseAdr),
+                        (unsigned long) ira->phaseAdr, (unsigned long) next);
+            ira->phaseAdr = next;
         }
     }
 }
@@ -1209,91 +1648,98 @@ void CheckPhase(uint32_t adr) {
 void WriteLabel2(uint32_t adr) {
     uint32_t index;
     uint16_t flag;
-    static uint32_t oldadr = 0;
 
     /* output of percent every 2 kb */
-    if ((adr - oldadr) >= 2048) {
-        fprintf(stderr, "%3d%%\r", (int) (((adr - ira->params.prgStart) * 100) / ira->params.prgLen));
-        fflush(stderr);
-        oldadr = adr;
+    if ((adr - ira->progressAdr) >= 2048) {
+        fprintf(ira->files.errFile, "%3d%%\r", (int) (((adr - ira->params.prgStart) * 100) / ira->params.prgLen));
+        fflush(ira->files.errFile);
+        ira->progressAdr = adr;
     }
 
     /* write labels for current address */
     if (ira->LabelAdr2[ira->p2labind] < adr && ira->p2labind < ira->labcount)
-        fprintf(stderr, "%lx adr=%lx This=%x\n", (unsigned long) ira->p2labind, (unsigned long) adr, (unsigned long) ira->LabelAdr2[ira->p2labind]);
+        fprintf(ira->files.errFile, "%lx adr=%lx This=%x\n", (unsigned long) ira->p2labind, (unsigned long) adr, (unsigned long) ira->LabelAdr2[ira->p2labind]);
     if (ira->LabelAdr2[ira->p2labind] == adr && ira->p2labind < ira->labcount) {
         flag = 1;
         index = ira->p2labind;
         while (ira->LabelAdr2[ira->p2labind] == adr && ira->p2labind < ira->labcount) {
             if (GetSymbol(ira->label.labelAdr[ira->p2labind])) {
-                fprintf(ira->files.targetFile, "%s:\n", ira->adrbuf);
+                TargetPrintf("%s:\n", ira->adrbuf);
                 ira->adrbuf[0] = 0;
             } else
                 flag = 0;
             ira->p2labind++;
         }
         if (flag == 0)
-            fprintf(ira->files.targetFile, "LAB_%04lX:\n", (unsigned long) index);
+            TargetPrintf("LAB_%04lX:\n", (unsigned long) index);
     }
 }
 
 void WriteBanner(uint32_t adr) {
-    Comment_t *p;
-    int hasBanner, i;
-
-    for (p = ira->banners, hasBanner = 0; p; p = p->next)
-        if (p->commentAdr == adr) {
-            if (!hasBanner) {
-                hasBanner = 1;
-                fprintf(ira->files.targetFile, BANNER_TEMPLATE);
-            }
-            fprintf(ira->files.targetFile, COMMENT_TEMPLATE, p->commentText);
-        }
+    uint32_t i;
 
-    if (hasBanner)
-        fprintf(ira->files.targetFile, BANNER_TEMPLATE);
+    i = SeekComment(ira->bannerByAdr, ira->bannerCount, &ira->bannerIndex, adr);
+    if (i < ira->bannerCount && ira->bannerByAdr[i]->commentAdr == adr) {
+        TargetPrintf(BANNER_TEMPLATE);
+        for (; i < ira->bannerCount && ira->bannerByAdr[i]->commentAdr == adr; i++)
+            TargetPrintf(COMMENT_TEMPLATE, ira->bannerByAdr[i]->commentText);
+        TargetPrintf(BANNER_TEMPLATE);
+    }
 }
 
 void WriteComment(uint32_t adr) {
-    Comment_t *p;
+    uint32_t i;
 
-    for (p = ira->comments; p; p = p->next)
-        if (p->commentAdr == adr)
-            fprintf(ira->files.targetFile, COMMENT_TEMPLATE, p->commentText);
+    i = SeekComment(ira->commentByAdr, ira->commentCount, &ira->commentIndex, adr);
+    for (; i < ira->commentCount && ira->commentByAdr[i]->commentAdr == adr; i++)
+        TargetPrintf(COMMENT_TEMPLATE, ira->commentByAdr[i]->commentText);
 }
 
 void WriteEquates(ira_t *ira) {
-    Equate_t *p, *q;
-    int bool;
+    Equate_t *p;
 
     if (ira->equates) {
-        fprintf(ira->files.targetFile, "; Custom equates (from config file)\n");
-        for (p = ira->equates; p; p = p->next) {
-            for (q = ira->equates, bool = 1; q != p && bool; q = q->next)
-                if (strcmp(p->equateName, q->equateName) == 0)
-                    bool = 0;
-            if (bool)
-                fprintf(ira->files.targetFile, EQUATE_TEMPLATE_DECIMAL, p->equateName, p->equateValue);
-        }
-        fprintf(ira->files.targetFile, "\n");
+        TargetPrintf("; Custom equates (from config file)\n");
+        for (p = ira->equates; p; p = p->next)
+            if (!p->duplicate)
+                TargetPrintf(EQUATE_TEMPLATE_DECIMAL, p->equateName, p->equateValue);
+        TargetPrintf("\n");
     }
 }
 
 void Output(void) {
+    char line[256], *p = line;
+    uint32_t mnelen = ira->mnebuf[0] ? ira->mnecnt : 0;
+    uint32_t adrlen = ira->adrbuf[0] ? ira->adrcnt : 0;
     int i;
 
     /* Here, the issue takes place */
+    if (mnelen || adrlen || ((ira->params.pFlags & ADR_OUTPUT) && ira->dtabuf[0])) {
+        *p++ = '\t';
+        memcpy(p, ira->mnebuf, mnelen);
+        p += mnelen;
+    }
     if ((ira->params.pFlags & ADR_OUTPUT) && ira->dtabuf[0]) {
-        i = 3 - strlen(ira->adrbuf) / 8;
+        *p++ = '\t';
+        memcpy(p, ira->adrbuf, adrlen);
+        p += adrlen;
+        i = 3 - adrlen / 8;
         if (i <= 0)
-            adrcat(" ");
+            *p++ = ' ';
         for (; i > 0; i--)
-            adrcat("\t");
-        fprintf(ira->files.targetFile, "\t%s\t%s;%s\n", ira->mnebuf, ira->adrbuf, ira->dtabuf);
-    } else if (ira->adrbuf[0])
-        fprintf(ira->files.targetFile, "\t%s\t%s\n", ira->mnebuf, ira->adrbuf);
-    else if (ira->mnebuf[0])
-        fprintf(ira->files.targetFile, "\t%s\n", ira->mnebuf);
+            *p++ = '\t';
+        *p++ = ';';
+        memcpy(p, ira->dtabuf, ira->dtacnt);
+        p += ira->dtacnt;
+    } else if (adrlen) {
+        *p++ = '\t';
+        memcpy(p, ira->adrbuf, adrlen);
+        p += adrlen;
+    }
+    if (p != line) {
+        *p++ = '\n';
+        WriteTarget(line, p - line);
+    }
 
     ira->dtabuf[0] = '\0';
     ira->adrbuf[0] = '\0';
@@ -1301,7 +1747,7 @@ void Output(void) {
 }
 
 int P2WriteReloc() {
-    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
         ira->dtabuf[0] = 0;
         ira->mnebuf[0] = 0;
         ira->adrbuf[0] = 0;
@@ -1462,8 +1908,8 @@ int NewAdrModes2(uint16_t mode, uint16_t reg)
                     adrcat(".W");
                 }
                 if (bdsize == 3) {
-                    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
-                        GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
+                    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
+                        GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
                         ira->nextreloc++;
                         dtacat(itohex(be16(&ira->buffer[ira->prgCount++]), 4));
                         dtacat(itohex(be16(&ira->buffer[ira->prgCount++]), 4));
@@ -1559,8 +2005,8 @@ int NewAdrModes2(uint16_t mode, uint16_t reg)
                     adrcat(".W");
                 }
                 if (odsize == 3) {
-                    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
-                        GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
+                    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
+                        GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
                         ira->nextreloc++;
                         dtacat(itohex(be16(&ira->buffer[ira->prgCount++]), 4));
                         dtacat(itohex(be16(&ira->buffer[ira->prgCount++]), 4));
@@ -1773,8 +2219,8 @@ int DoAdress2(uint16_t adrs)
                               instructions[ira->opCodeNumber].family == OPC_ROTATE_SHIFT_MEMORY))
                 mode = MODE_INVALID;
             else {
-                if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
-                    GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
+                if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
+                    GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
                     ira->nextreloc++;
                 } else {
                     /* PEA for stack arguments in C code */
@@ -1813,7 +2259,7 @@ int DoAdress2(uint16_t adrs)
             break;
 
         case MODE_IMMEDIATE:
-            if (adrs == instructions[ira->opCodeNumber].sourceadr || instructions[ira->opCodeNumber].family == OPC_BITOP) {
+            if (adrs == ira->sourceadr || instructions[ira->opCodeNumber].family == OPC_BITOP) {
                 if (ira->extension != 3) {
                     if (ira->extension == 0) {
                         /* immediate data can have MSB different from 0 only if MSB is 0xff and LSB has most significant bit set.
@@ -1851,12 +2297,12 @@ int DoAdress2(uint16_t adrs)
                             adrcat(itohex(buf, 4));
                         }
                     } else if (ira->extension == 2) {
-                        if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart + 2))
+                        if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart + 2))
                             mode = MODE_INVALID;
                         else {
-                            if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+                            if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                                 adrcat("#");
-                                GetLabel(ira->reloc.relocVal[ira->nextreloc], 9999);
+                                GetLabel(ira->reloc.relocs[ira->nextreloc].val, 9999);
                                 ira->nextreloc++;
                             } else {
                                 adrcat("#");
@@ -2060,12 +2506,12 @@ int DoAdress2(uint16_t adrs)
             mnecat(&bitop[ira->extension][0]);
             if (!ira->extension) /* BTST */
                 if (ira->seaow & 0x0100)
-                    instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED;
+                    ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED;
                 else
-                    instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND;
+                    ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND;
             else
                 /* BCHG, BCLR, BSET */
-                instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
             if (ira->seaow & 0x0100) {
                 adrcat("D");
                 adrcat(itohex(reg, 1));
@@ -2444,13 +2890,15 @@ void DPass1(ira_t *ira) {
     ira->pass = 1;
     ira->prgCount = 0;
     ira->nextreloc = 0;
+    /* one bit per byte, set for every address where Pass 1 started an instruction or data */
+    ira->adrMap = mycalloc((ira->params.prgLen >> 3) + 1);
     ira->modulcnt = ~0;
     ira->noBase.noBaseIndex = 0;
     ira->noBase.noBaseFlag = 0;
     ira->jmp.jmpIndex = 0;
 
     for (area = 0; area < ira->codeArea.codeAreas; area++) {
-        while ((ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea1[area]) && ((ira->modulcnt + 1) < ira->hunkCount))
+        while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea1[area]))
             ira->modulcnt++;
 
         /* HERE BEGINS THE CODE PART OF PASS 1 */
@@ -2459,14 +2907,14 @@ void DPass1(ira_t *ira) {
         ira->codeArea.codeAreaEnd = (ira->codeArea.codeArea2[area] - ira->params.prgStart) / 2;
 
         while (ira->prgCount < ira->codeArea.codeAreaEnd) {
-            if (ira->nextreloc < ira->relocount && ira->reloc.relocAdr[ira->nextreloc] < (ira->prgCount * 2 + ira->params.prgStart))
-                fprintf(stderr, "Watch out: prgcounter(%08lx) > nextreloc(%08lx)\n", (unsigned long) (ira->prgCount * 2 + ira->params.prgStart),
-                        (unsigned long) ira->reloc.relocAdr[ira->nextreloc]);
+            if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < (ira->prgCount * 2 + ira->params.prgStart))
+                fprintf(ira->files.errFile, "Watch out: prgcounter(%08lx) > nextreloc(%08lx)\n", (unsigned long) (ira->prgCount * 2 + ira->params.prgStart),
+                        (unsigned long) ira->reloc.relocs[ira->nextreloc].adr);
 
             CheckNoBase(ira->params.prgStart + ira->prgCount * 2);
             WriteLabel1(ira->params.prgStart + ira->prgCount * 2);
 
-            if (ira->nextreloc < ira->relocount && ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+            if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                 ira->nextreloc++;
                 ira->prgCount += 2;
                 continue;
@@ -2487,11 +2935,11 @@ void DPass1(ira_t *ira) {
             if ((instructions[ira->opCodeNumber].flags & OPF_APPEND_SIZE) && ira->extension == 3)
                 ira->addressMode = MODE_INVALID;
 
-            if (instructions[ira->opCodeNumber].sourceadr)
-                if (DoAdress1(ira, instructions[ira->opCodeNumber].sourceadr))
+            if (ira->sourceadr)
+                if (DoAdress1(ira, ira->sourceadr))
                     continue;
 
-            if (instructions[ira->opCodeNumber].destadr) {
+            if (ira->destadr) {
                 if (instructions[ira->opCodeNumber].family == OPC_MOVE) {
                     ira->addressMode = ((ira->seaow & ALT_MODE_MASK) >> 3) | ira->alt_register;
                     if (ira->addressMode < EA_MODE_FIELD_MASK)
@@ -2501,20 +2949,20 @@ void DPass1(ira_t *ira) {
                     ira->ea_register = ira->alt_register;
                 }
 
-                if (DoAdress1(ira, instructions[ira->opCodeNumber].destadr))
+                if (DoAdress1(ira, ira->destadr))
                     continue;
                 else if (instructions[ira->opCodeNumber].family == OPC_LEA || instructions[ira->opCodeNumber].family == OPC_MOVEAL)
                     if (ira->params.pFlags & BASEREG1)
                         if (ira->addressMode2 == 1 && ira->alt_register == ira->params.baseReg)
-                            printf("BASEREG\t%08lX: A%hd\n", (unsigned long) (ira->pc * 2 + ira->params.prgStart), ira->params.baseReg);
+                            fprintf(ira->files.msgFile, "BASEREG\t%08lX: A%hd\n", (unsigned long) (ira->pc * 2 + ira->params.prgStart), ira->params.baseReg);
             }
 
             if (ira->prgCount > ira->codeArea.codeAreaEnd)
-                fprintf(stderr, "P1 Watch out: prgCount*2(=%08lx) > (prgEnd-prgStart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
+                fprintf(ira->files.errFile, "P1 Watch out: prgCount*2(=%08lx) > (prgEnd-prgStart)(=%08lx)\n", (unsigned long) (ira->prgCount * 2),
                         (unsigned long) (ira->params.prgEnd - ira->params.prgStart));
         }
 
-        while ((ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea2[area]) && ((ira->modulcnt + 1) < ira->hunkCount))
+        while (((ira->modulcnt + 1) < ira->hunkCount) && (ira->hunksOffs[ira->modulcnt + 1] == ira->codeArea.codeArea2[area]))
             ira->modulcnt++;
 
         /* HERE BEGINS THE DATA PART OF PASS 1 */
@@ -2526,14 +2974,14 @@ void DPass1(ira_t *ira) {
             end = ira->params.prgEnd;
 
         while (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->codeArea.codeArea2[area] > ira->jmp.jmpTable[ira->jmp.jmpIndex].start) {
-            fprintf(stderr, "P1 Watch out: ira->jmp.jmpTable $%08lx-$%08lx skipped.\n", (unsigned long) ira->jmp.jmpTable[ira->jmp.jmpIndex].start,
+            fprintf(ira->files.errFile, "P1 Watch out: ira->jmp.jmpTable $%08lx-$%08lx skipped.\n", (unsigned long) ira->jmp.jmpTable[ira->jmp.jmpIndex].start,
                     (unsigned long) ira->jmp.jmpTable[ira->jmp.jmpIndex].end);
             ira->jmp.jmpIndex++;
         }
 
         for (i = ira->codeArea.codeArea2[area]; i < end; i++) {
             WriteLabel1(i);
-            if (ira->nextreloc < ira->relocount && ira->reloc.relocAdr[ira->nextreloc] == i) {
+            if (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr == i) {
                 ira->nextreloc++;
                 i += 3;
             } else if (ira->jmp.jmpIndex < ira->jmp.jmpCount && ira->jmp.jmpTable[ira->jmp.jmpIndex].start == i) {
@@ -2546,38 +2994,34 @@ void DPass1(ira_t *ira) {
                 ira->jmp.jmpIndex++;
         }
         ira->prgCount = (end - ira->params.prgStart) / 2;
-        while (ira->nextreloc < ira->relocount && ira->reloc.relocAdr[ira->nextreloc] < (ira->prgCount * 2 + ira->params.prgStart)) {
+        while (ira->nextreloc < ira->relocount && ira->reloc.relocs[ira->nextreloc].adr < (ira->prgCount * 2 + ira->params.prgStart)) {
             if (!badreloc) {
-                fprintf(stderr, "P1 Missed bad reloc addr $%08lx!\n", (unsigned long) ira->reloc.relocAdr[ira->nextreloc]);
+                fprintf(ira->files.errFile, "P1 Missed bad reloc addr $%08lx!\n", (unsigned long) ira->reloc.relocs[ira->nextreloc].adr);
                 badreloc = 1;
             }
             ira->nextreloc++;
         }
     }
 
-    fprintf(stderr, "Pass 1: 100%%\n");
+    fprintf(ira->files.errFile, "Pass 1: 100%%\n");
     if (ira->relocount != ira->nextreloc)
-        fprintf(stderr, "relocount=%lu nextreloc=%lu\n", (unsigned long) ira->relocount, (unsigned long) ira->nextreloc);
-    fclose(ira->files.labelFile);
-    ira->files.labelFile = 0;
+        fprintf(ira->files.errFile, "relocount=%lu nextreloc=%lu\n", (unsigned long) ira->relocount, (unsigned long) ira->nextreloc);
 }
 
 void WriteLabel1(uint32_t adr) {
-    static uint16_t linecount = 200;
     /* emit percentage */
-    if (linecount++ >= 200) {
-        fprintf(stderr, "Pass 1: %3d%%\r", (int) (((adr - ira->params.prgStart) * 100) / ira->params.prgLen));
-        fflush(stderr);
-        linecount = 0;
+    if (ira->progressLines++ >= 200) {
+        fprintf(ira->files.errFile, "Pass 1: %3d%%\r", (int) (((adr - ira->params.prgStart) * 100) / ira->params.prgLen));
+        fflush(ira->files.errFile);
+        ira->progressLines = 0;
     }
 
-    if ((fwrite(&adr, sizeof(uint32_t), 1, ira->files.labelFile) != 1))
-        ExitPrg("Write error !");
-    ira->labc1++;
+    if (adr >= ira->params.prgStart && adr < ira->params.prgEnd)
+        ira->adrMap[(adr - ira->params.prgStart) >> 3] |= 1 << ((adr - ira->params.prgStart) & 7);
 }
 
 int P1WriteReloc(ira_t *ira) {
-    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
         ira->prgCount = ira->pc + 1;
         return (-1);
     } else {
@@ -2690,7 +3134,7 @@ static uint16_t NewAdrModes1(uint16_t mode, uint16_t reg)
                     }
                 }
                 if (bdsize == 3) {
-                    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+                    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                         ira->nextreloc++;
                         ira->prgCount += 2;
                     } else {
@@ -2733,7 +3177,7 @@ static uint16_t NewAdrModes1(uint16_t mode, uint16_t reg)
                         return ((uint16_t) 0xffff);
                 }
                 if (odsize == 3) {
-                    if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+                    if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                         ira->nextreloc++;
                         ira->prgCount += 2;
                     } else {
@@ -2850,7 +3294,7 @@ int DoAdress1(ira_t *ira, uint16_t adrs) {
                               instructions[ira->opCodeNumber].family == OPC_ROTATE_SHIFT_MEMORY))
                 mode = MODE_INVALID;
             else {
-                if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+                if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                     ira->LabAdr = adr;
                     ira->LabAdrFlag = 1;
                     ira->nextreloc++;
@@ -2884,7 +3328,7 @@ int DoAdress1(ira_t *ira, uint16_t adrs) {
             break;
 
         case MODE_IMMEDIATE:
-            if (adrs == instructions[ira->opCodeNumber].sourceadr || instructions[ira->opCodeNumber].family == OPC_BITOP) {
+            if (adrs == ira->sourceadr || instructions[ira->opCodeNumber].family == OPC_BITOP) {
                 if (ira->extension != 3) {
                     if (ira->extension == 0) {
                         /* immediate data can have MSB different from 0 only if MSB is 0xff and LSB has most significant bit set.
@@ -2902,10 +3346,10 @@ int DoAdress1(ira_t *ira, uint16_t adrs) {
                         if (P1WriteReloc(ira))
                             return (-1);
                     } else if (ira->extension == 2) {
-                        if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart + 2))
+                        if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart + 2))
                             mode = MODE_INVALID;
                         else {
-                            if (ira->reloc.relocAdr[ira->nextreloc] == (ira->prgCount * 2 + ira->params.prgStart)) {
+                            if (ira->reloc.relocs[ira->nextreloc].adr == (ira->prgCount * 2 + ira->params.prgStart)) {
                                 ira->nextreloc++;
                             }
                             ira->prgCount += 2;
@@ -2980,18 +3424,18 @@ int DoAdress1(ira_t *ira, uint16_t adrs) {
 
         case MODE_BIT_MANIPULATION:
             if (!ira->extension)
-                instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED; /* BTST */
+                ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED; /* BTST */
             else
-                instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32; /* sonstige B... */
+                ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32; /* sonstige B... */
 
             if (!ira->extension) /* BTST */
                 if (ira->seaow & 0x0100)
-                    instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED;
+                    ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND | IMMED;
                 else
-                    instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND;
+                    ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | PC_REL | PC_IND;
             else
                 /* BCHG, BCLR, BSET */
-                instructions[ira->opCodeNumber].destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                ira->destadr = D_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
             if (ira->seaow & 0x0100) {
             } else {
                 if (P1WriteReloc(ira))
@@ -3105,15 +3549,15 @@ int DoAdress1(ira_t *ira, uint16_t adrs) {
                 ira->displace = (buf << 16) | be16(&ira->buffer[ira->prgCount + 1]);
                 if (ira->displace != 0 && ira->displace != 2) {
                     ira->displace += ira->prgCount * 2;
-                    if (P2WriteReloc())
+                    if (P1WriteReloc(ira))
                         return (-1);
-                    if (P2WriteReloc())
+                    if (P1WriteReloc(ira))
                         return (-1);
                 } else
                     mode = MODE_INVALID;
             } else {
                 ira->displace = (ira->prgCount * 2 + (int16_t)(buf));
-                if (P2WriteReloc())
+                if (P1WriteReloc(ira))
                     return (-1);
             }
 
@@ -3209,43 +3653,47 @@ int AutoScan(ira_t *ira) {
     }
 
     if (ira->params.pFlags & SHOW_RELOCINFO)
-        printf("\n%s (%s)....:\n", SOURCE_FILE_DESCR(result), ira->filenames.sourceName);
+        fprintf(ira->files.msgFile, "\n%s (%s)....:\n", SOURCE_FILE_DESCR(result), ira->filenames.sourceName);
 
     return result;
 }
 
 void SplitOutputFiles(Files_t *files, Filenames_t *filenames, uint32_t count) {
-    if (files->targetFile)
-        fclose(files->targetFile);
-
-    strcpy(filenames->tsName, filenames->targetName);
-    strcat(filenames->tsName, ".S");
-    strcat(filenames->tsName, itoa(count));
-    if (!(files->targetFile = fopen(filenames->tsName, "w")))
-        ExitPrg("Can't open split target file \"%s\" for writing.", filenames->tsName);
+    char *name = myalloc(strlen(filenames->targetName) + 16);
+
+    CloseTarget();
+
+    strcpy(name, filenames->targetName);
+    strcat(name, ".S");
+    strcat(name, itoa(count));
+    if (!OpenTarget(name)) {
+        myfree(name);
+        ExitPrg("Can't open split target file \"%s.S%s\" for writing.", filenames->targetName, itoa(count));
+    }
+    myfree(name);
 }
 
 void WriteSection(ira_t *ira) {
     int section_start_label;
 
     if ((ira->hunksSize[ira->modulcnt] != 0) || (ira->params.pFlags & KEEP_ZEROHUNKS)) {
-        fprintf(ira->files.targetFile, "\n\n\t");
+        TargetPrintf("\n\n\t");
         if (ira->params.sourceType == M68K_BINARY && ira->modulcnt == 0)
-            fprintf(ira->files.targetFile, "ORG\t$%lx", (unsigned long) ira->params.prgStart);
+            TargetPrintf("ORG\t$%lx", (unsigned long) ira->params.prgStart);
         else {
-            fprintf(ira->files.targetFile, "SECTION S_%ld,%s", (long) ira->modulcnt, modname[ira->hunksType[ira->modulcnt] - HUNK_CODE]);
+            TargetPrintf("SECTION S_%ld,%s", (long) ira->modulcnt, modname[ira->hunksType[ira->modulcnt] - HUNK_CODE]);
             if (ira->hunksMemoryType[ira->modulcnt] == 3)
-                fprintf(ira->files.targetFile, ",$%lx", (unsigned long) ira->hunksMemoryAttrs[ira->modulcnt]);
+                TargetPrintf(",$%lx", (unsigned long) ira->hunksMemoryAttrs[ira->modulcnt]);
             else if (ira->hunksMemoryType[ira->modulcnt])
-                fprintf(ira->files.targetFile, ",%s", memtypename[ira->hunksMemoryType[ira->modulcnt]]);
+                TargetPrintf(",%s", memtypename[ira->hunksMemoryType[ira->modulcnt]]);
         }
-        fprintf(ira->files.targetFile, "\n\n");
+        TargetPrintf("\n\n");
 
         section_start_label = 1;
 
         while (ira->LabelAdr2[ira->p2labind] == ira->hunksOffs[ira->modulcnt] && ira->p2labind < ira->labcount) {
             if (GetSymbol(ira->label.labelAdr[ira->p2labind])) {
-                fprintf(ira->files.targetFile, "%s:\n", ira->adrbuf);
+                TargetPrintf("%s:\n", ira->adrbuf);
                 ira->adrbuf[0] = 0;
                 section_start_label = 0;
             }
@@ -3253,7 +3701,7 @@ void WriteSection(ira_t *ira) {
         }
 
         if (section_start_label)
-            fprintf(ira->files.targetFile, "SECSTRT_%ld:\n", (long) ira->modulcnt);
+            TargetPrintf("SECSTRT_%ld:\n", (long) ira->modulcnt);
     }
 }
 
@@ -3263,12 +3711,12 @@ void DoSpecific(ira_t *ira, int pass_number) {
     switch (instructions[ira->opCodeNumber].family) {
         case OPC_CMPI:
             if (ira->params.cpuType & M020UP)
-                instructions[ira->opCodeNumber].destadr |= PC_REL | PC_IND;
+                ira->destadr |= PC_REL | PC_IND;
             break;
 
         case OPC_TST:
             if (ira->params.cpuType & M020UP)
-                instructions[ira->opCodeNumber].sourceadr |= A_DIR | PC_REL | PC_IND | IMMED;
+                ira->sourceadr |= A_DIR | PC_REL | PC_IND | IMMED;
             break;
 
         case OPC_BITFIELD:
@@ -3287,20 +3735,20 @@ void DoSpecific(ira_t *ira, int pass_number) {
                     case BITFIELD_IDENTIFIER_CLR:
                     case BITFIELD_IDENTIFIER_SET:
                     case BITFIELD_IDENTIFIER_TST:
-                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
-                        instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
+                        ira->destadr = MODE_NONE;
                         break;
 
                     case BITFIELD_IDENTIFIER_INS:
-                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | MODE_DREG_DIRECT;
-                        instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
+                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | MODE_DREG_DIRECT;
+                        ira->destadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
                         break;
 
                     case BITFIELD_IDENTIFIER_EXTS:
                     case BITFIELD_IDENTIFIER_EXTU:
                     case BITFIELD_IDENTIFIER_FFO:
-                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
-                        instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | MODE_DREG_DIRECT;
+                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_BITFIELD;
+                        ira->destadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | MODE_DREG_DIRECT;
                         break;
                 }
             }
@@ -3316,18 +3764,18 @@ void DoSpecific(ira_t *ira, int pass_number) {
                     else
                         mnecat("MP2");
                 }
-                instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | ((ira->extra & REGISTER_EXTENSION_TYPE) ? MODE_AREG_DIRECT : MODE_DREG_DIRECT);
+                ira->destadr = MODE_IN_LOWER_BYTE | MODE_EXT_REGISTER | ((ira->extra & REGISTER_EXTENSION_TYPE) ? MODE_AREG_DIRECT : MODE_DREG_DIRECT);
             }
             ira->extension = (ira->seaow & ALT_EXTENSION_SIZE_MASK) >> 9;
             break;
 
         case OPC_MOVES:
             if (ira->extra & DIRECTION_EXTENSION_MASK) {
-                instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_MOVES;
-                instructions[ira->opCodeNumber].destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_MOVES;
+                ira->destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
             } else {
-                instructions[ira->opCodeNumber].sourceadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
-                instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_MOVES;
+                ira->sourceadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                ira->destadr = MODE_IN_LOWER_BYTE | MODE_MOVES;
             }
             break;
 
@@ -3351,8 +3799,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     if (ira->extra & PMMU_FD_BIT_MASK)
                                         ira->addressMode = MODE_INVALID;
                                     else {
-                                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG_TT;
-                                        instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG_TT;
+                                        ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                     }
                                 } else {
                                     /* memory to register */
@@ -3361,8 +3809,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     if (pass_number == 2 && (ira->extra & PMMU_FD_BIT_MASK))
                                         mnecat("FD");
 
-                                    instructions[ira->opCodeNumber].sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
-                                    instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PREG_TT;
+                                    ira->sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->destadr = MODE_IN_LOWER_BYTE | MODE_PREG_TT;
                                 }
                             } else
                                 /* Invalid MMU register */
@@ -3385,8 +3833,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     mnecat("LOAD");
                                     mnecat((ira->extra & PMMU_RW_BIT_MASK) ? "R" : "W");
                                 }
-                                instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC;
-                                instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC;
+                                ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                             } else
                                 ira->addressMode = MODE_INVALID;
                             break;
@@ -3396,8 +3844,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                             if (ira->params.cpuType & M68851) {
                                 if (pass_number == 2)
                                     mnecat("VALID");
-                                instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PVALID;
-                                instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PVALID;
+                                ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                             } else
                                 ira->addressMode = MODE_INVALID;
                             break;
@@ -3419,24 +3867,24 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                             PFLUSH_EXPECTED_FOR_MODE_ALL)
                                             ira->addressMode = MODE_INVALID;
                                         else {
-                                            instructions[ira->opCodeNumber].sourceadr = MODE_NONE;
-                                            instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                                            ira->sourceadr = MODE_NONE;
+                                            ira->destadr = MODE_NONE;
                                             if (pass_number == 2)
                                                 mnecat("FLUSHA");
                                         }
                                         break;
 
                                     case PFLUSH_MODE_FC_ONLY:
-                                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
-                                        instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
+                                        ira->destadr = MODE_NONE;
                                         if (pass_number == 2)
                                             mnecat("FLUSH");
                                         break;
 
                                     case PFLUSH_MODE_FC_SHARE:
                                         if (ira->params.cpuType & M68851) {
-                                            instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
-                                            instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                                            ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
+                                            ira->destadr = MODE_NONE;
                                             if (pass_number == 2)
                                                 mnecat("FLUSHS");
                                         } else
@@ -3444,16 +3892,16 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                         break;
 
                                     case PFLUSH_MODE_FC_EA:
-                                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
-                                        instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
+                                        ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                         if (pass_number == 2)
                                             mnecat("FLUSH");
                                         break;
 
                                     case PFLUSH_MODE_FC_EA_SHARE:
                                         if (ira->params.cpuType & M68851) {
-                                            instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
-                                            instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                            ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC_MASK;
+                                            ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                             if (pass_number == 2)
                                                 mnecat("FLUSHS");
                                         } else
@@ -3475,26 +3923,26 @@ void DoSpecific(ira_t *ira, int pass_number) {
 
                             if (ira->extra & PMMU_RW_BIT_MASK) {
                                 /* register to memory */
-                                instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
+                                ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
 
                                 /* PMOVE from CRP, SRP, DRP not allowed with modes Dn and An */
                                 dummy = (ira->extra & PMMU_PREG_MASK);
                                 if (dummy == PMMU_PREG_CRP || dummy == PMMU_PREG_SRP || dummy == PMMU_PREG_DRP)
-                                    instructions[ira->opCodeNumber].destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                 else
-                                    instructions[ira->opCodeNumber].destadr = D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->destadr = D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                             } else {
                                 /* memory to register */
 
                                 /* PMOVE to CRP, SRP, DRP not allowed with modes Dn and An */
                                 dummy = (ira->extra & PMMU_PREG_MASK);
                                 if (dummy == PMMU_PREG_CRP || dummy == PMMU_PREG_SRP || dummy == PMMU_PREG_DRP)
-                                    instructions[ira->opCodeNumber].sourceadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
+                                    ira->sourceadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
                                 else
-                                    instructions[ira->opCodeNumber].sourceadr =
+                                    ira->sourceadr =
                                         D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
 
-                                instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
+                                ira->destadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
                             }
                         } else
                             /* Extra word invalid */
@@ -3519,8 +3967,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     if (ira->extra & PMMU_FD_BIT_MASK)
                                         ira->addressMode = MODE_INVALID;
                                     else {
-                                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
-                                        instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
+                                        ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                     }
                                 } else {
                                     /* memory to register */
@@ -3529,8 +3977,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     if (pass_number == 2 && (ira->extra & PMMU_FD_BIT_MASK))
                                         mnecat("FD");
 
-                                    instructions[ira->opCodeNumber].sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
-                                    instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
+                                    ira->sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->destadr = MODE_IN_LOWER_BYTE | MODE_PREG1;
                                 }
                             } else
                                 /* Invalid MMU register */
@@ -3562,8 +4010,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     ira->addressMode = MODE_INVALID;
                                 else if (ira->extra & PMMU_RW_BIT_MASK) {
                                     /* register to memory */
-                                    instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
-                                    instructions[ira->opCodeNumber].destadr = D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
+                                    ira->destadr = D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                 } else {
                                     /* memory to register */
 
@@ -3571,9 +4019,9 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                     if (dummy == PMMU_PREG_PCSR)
                                         ira->addressMode = MODE_INVALID;
                                     else {
-                                        instructions[ira->opCodeNumber].sourceadr =
+                                        ira->sourceadr =
                                             D_DIR | A_DIR | A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
-                                        instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
+                                        ira->destadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
                                     }
                                 }
                             } else
@@ -3595,13 +4043,13 @@ void DoSpecific(ira_t *ira, int pass_number) {
                                 if (ira->extra & PMMU_RW_BIT_MASK) {
                                     /* register to memory */
 
-                                    instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
-                                    instructions[ira->opCodeNumber].destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
+                                    ira->destadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
                                 } else {
                                     /* memory to register */
 
-                                    instructions[ira->opCodeNumber].sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
-                                    instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
+                                    ira->sourceadr = A_IND | A_IND_D16 | A_IND_IDX | ABS16 | ABS32;
+                                    ira->destadr = MODE_IN_LOWER_BYTE | MODE_PREG2;
                                 }
                             } else
                                 /* Invalid MMU register */
@@ -3621,8 +4069,8 @@ void DoSpecific(ira_t *ira, int pass_number) {
                             mnecat((ira->extra & PMMU_RW_BIT_MASK) ? "R" : "W");
                         }
 
-                        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_FC;
-                        instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_PTEST;
+                        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_FC;
+                        ira->destadr = MODE_IN_LOWER_BYTE | MODE_PTEST;
                     } else
                         /* Invalid extension word */
                         ira->addressMode = MODE_INVALID;
@@ -3630,33 +4078,37 @@ void DoSpecific(ira_t *ira, int pass_number) {
 
                 case PMMU_PFLUSHR:
                     if (ira->extra == PFLUSHR_EXTENSION) {
-                        instructions[ira->opCodeNumber].sourceadr = MODE_NONE;
-                        instructions[ira->opCodeNumber].destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
+                        ira->sourceadr = MODE_NONE;
+                        ira->destadr = A_IND | A_IND_POST | A_IND_PRE | A_IND_D16 | A_IND_IDX | ABS16 | ABS32 | IMMED | PC_REL | PC_IND;
                         if (pass_number == 2)
                             mnecat("FLUSHR");
                     } else
                         ira->addressMode = MODE_INVALID;
                     break;
+
+                default:
+                    ira->addressMode = MODE_INVALID;
+                    break;
             }
             break;
 
         case OPC_PFLUSH040:
             switch (ira->seaow & PFLUSH040_OPMODE_MASK) {
                 case PFLUSH040_OPMODE_PAGE_NOT_GLOBAL:
-                    instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_AREG_INDIRECT;
+                    ira->destadr = MODE_IN_LOWER_BYTE | MODE_AREG_INDIRECT;
                     if (pass_number == 2)
                         mnecat("N");
                     break;
                 case PFLUSH040_OPMODE_PAGE:
-                    instructions[ira->opCodeNumber].destadr = MODE_IN_LOWER_BYTE | MODE_AREG_INDIRECT;
+                    ira->destadr = MODE_IN_LOWER_BYTE | MODE_AREG_INDIRECT;
                     break;
                 case PFLUSH040_OPMODE_ALL_NOT_GLOBAL:
-                    instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                    ira->destadr = MODE_NONE;
                     if (pass_number == 2)
                         mnecat("AN");
                     break;
                 case PFLUSH040_OPMODE_ALL:
-                    instructions[ira->opCodeNumber].destadr = MODE_NONE;
+                    ira->destadr = MODE_NONE;
                     if (pass_number == 2)
                         mnecat("A");
                     break;
@@ -3685,7 +4137,7 @@ void DoSpecific(ira_t *ira, int pass_number) {
                     ira->extension = 1;
                     if (pass_number == 2)
                         mnecat(extensions[ira->extension]);
-                    instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_IMMEDIATE;
+                    ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_IMMEDIATE;
                     break;
 
                 case PTRAPcc_OPMODE_LONG:
@@ -3693,11 +4145,11 @@ void DoSpecific(ira_t *ira, int pass_number) {
                     ira->extension = 2;
                     if (pass_number == 2)
                         mnecat(extensions[ira->extension]);
-                    instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_IMMEDIATE;
+                    ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_IMMEDIATE;
                     break;
 
                 case PTRAPcc_OPMODE_NONE:
-                    instructions[ira->opCodeNumber].sourceadr = MODE_NONE;
+                    ira->sourceadr = MODE_NONE;
                     break;
 
                 default:
@@ -3749,5 +4201,5 @@ void DoSpecific(ira_t *ira, int pass_number) {
      * DoSpecific() can also compute it but as DoAdress{0,1,2}() isn't called if {source,dest}adr == MODE_NONE...
      * so DoSpecific() has to explicitely compute sourceadr = MODE_IN_LOWER_BYTE | MODE_INVALID in order to let DoAdress{0,1,2}() handle this invalid mode. */
     if (ira->addressMode == MODE_INVALID)
-        instructions[ira->opCodeNumber].sourceadr = MODE_IN_LOWER_BYTE | MODE_INVALID;
+        ira->sourceadr = MODE_IN_LOWER_BYTE | MODE_INVALID;
 }
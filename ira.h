@@ -12,6 +12,15 @@
 #ifndef IRA_H
 #define IRA_H
 
+#include <setjmp.h>
+
+#ifdef IRA_THREADS
+#include <pthread.h>
+#define IRA_TLS __thread /* Pass 2 threads each have their own ira_t */
+#else
+#define IRA_TLS
+#endif
+
 #define VERSION "2"
 #define REVISION "09"
 
@@ -40,6 +49,14 @@
 
 #define lmovmem(x, y, a) memmove(y, x, (a) * sizeof(int32_t))
 
+#define SYMBOL_POOL_SIZE 16384
+#define TARGET_BUFSIZE (1 << 16)
+
+/* Percent of its old size a full table grows to, see GrowMax() */
+#ifndef ARRAY_GROWTH
+#define ARRAY_GROWTH 200
+#endif
+
 #define ADR_OUTPUT (1 << 0)     /* Output addresses in the code area  */
 #define KEEP_BINARY (1 << 1)    /* Keep binary-intermediate file      */
 #define SHOW_RELOCINFO (1 << 2) /* Show relocations information       */
@@ -52,6 +69,10 @@
 #define CONFIG (1 << 9)         /* Config file should be included     */
 #define ROMTAGatZERO (1 << 10)  /* Don't assume a code entry at adr=0 */
 #define ESCCODES (1 << 11)      /* Use Escape code '\' in strings     */
+#define BATCH (1 << 12)         /* Source is a list of sources        */
+#define SERVE (1 << 13)         /* Source is a socket to take jobs at */
+#define STATS (1 << 14)         /* Print times and counters at end    */
+#define STATS_JSON (1 << 15)    /* Print them as JSON                 */
 
 /* Addressing styles for IRA parameters handling */
 #define CPU_ADDR_STYLE 0
@@ -660,11 +681,6 @@ typedef struct OpCode_s {
     uint16_t cpuType;
 } Opcode_t;
 
-typedef struct OpCodeByNibble_s {
-    uint16_t start;
-    uint16_t count;
-} OpCodeByNibble_t;
-
 typedef struct ControlRegister_s {
     char name[6];
     uint16_t cpuflag;
@@ -685,14 +701,20 @@ typedef struct Parameters_s {
     uint32_t sourceType;
     uint16_t baseAbs;
     uint16_t baseReg;
+    uint32_t jobs;  /* -BATCH worker or Pass 2 threads, 0 for the default */
+    char *cacheDir; /* -CACHE directory, belongs to the options context */
 } Parameters_t;
 
+typedef struct Relocation_s {
+    uint32_t adr; /* where the relocated longword is */
+    uint32_t val; /* its contents, an address */
+    int32_t off;  /* offset from the hunk start, for hunk-spanning labels */
+    uint32_t mod; /* the hunk it points into */
+} Relocation_t;
+
 typedef struct Reloc_s {
     uint32_t relocMax;
-    uint32_t *relocAdr;
-    int32_t *relocOff;
-    uint32_t *relocVal;
-    uint32_t *relocMod;
+    Relocation_t *relocs;
 } Reloc_t;
 
 typedef struct Label_s {
@@ -705,6 +727,16 @@ typedef struct Symbol_s {
     uint32_t symbolCount;
     uint32_t *symbolValue;
     char **symbolName;
+
+    /* Open addressing hash of symbolValue: symbol index + 1, 0 for a free slot */
+    uint32_t symbolHashMask;
+    uint32_t *symbolHash;
+
+    /* Symbol names are stored one after another in pool blocks,
+     * the blocks are chained through their first pointer */
+    char *symbolBlocks;
+    char *symbolPool;
+    uint32_t symbolPoolFree;
 } Symbol_t;
 
 typedef struct CodeArea_s {
@@ -774,6 +806,7 @@ typedef struct Equate_s {
     uint32_t equateAdr;
     int32_t equateValue;
     int size;
+    int duplicate; /* name already used by an earlier equate */
     char *equateName;
     struct Equate_s *next;
 } Equate_t;
@@ -793,17 +826,74 @@ typedef struct Filenames_s {
     char *targetName;
     char *configName;
     char *binaryName;
-    char *labelName;
-    char *tsName;
+    char *cacheName;
 } Filenames_t;
 
+/* Target file buffers, see OpenTarget() */
+typedef struct Writer_s {
+    char *buf[2];
+    uint32_t size;
+    uint32_t len;  /* bytes in buf[fill] */
+    int fill;
+#ifdef IRA_THREADS
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t pending; /* bytes of buf[fill ^ 1] the thread has to write */
+    int error;
+    int stop;
+#endif
+} Writer_t;
+
 typedef struct Files_s {
     FILE *sourceFile;
     FILE *binaryFile;
     FILE *targetFile;
-    FILE *labelFile;
+    FILE *readFile; /* config or cache file being read, ExitPrg() closes it */
+    Writer_t writer;
+    uint64_t written; /* bytes handed to target files, for -STATS */
+
+    /* stdout and stderr unless changed by IraSetOutput() */
+    FILE *msgFile;
+    FILE *errFile;
 } Files_t;
 
+/* Areas of Pass 2 whose text only COMMENT and BANNER change, see cache.c */
+typedef struct TextPart_s {
+    uint32_t first;  /* first area */
+    uint64_t key;    /* hash of its COMMENT and BANNER lines */
+    uint64_t offset; /* of its text in the target, or in the cache while cached */
+    uint64_t size;
+    int cached;
+} TextPart_t;
+
+/* Phases timed by -STATS, see stats.c */
+enum { STATS_LOAD, STATS_ROMTAG, STATS_PASS0, STATS_PASS1, STATS_LABELS, STATS_TEXT, STATS_RENDER, STATS_PHASES };
+
+typedef struct Stats_s {
+    double wall[STATS_PHASES]; /* ms */
+    double cpu[STATS_PHASES];  /* ms */
+    uint64_t decoded[STATS_PHASES];
+    uint64_t written[STATS_PHASES];
+    /* at StatsStart() */
+    double startWall;
+    double startCpu;
+    uint64_t startDecoded;
+    uint64_t startWritten;
+} Stats_t;
+
+/* What a block is allocated for, counted with IRA_MEMSTATS, see supp.c */
+enum { MEM_RELOCS, MEM_LABELS, MEM_XREFS, MEM_CODEAREAS, MEM_SYMBOLS, MEM_CONFIG, MEM_OTHER, MEM_TAGS };
+
+typedef struct MemStats_s {
+    uint64_t allocs[MEM_TAGS];
+    uint64_t bytes[MEM_TAGS]; /* all allocated, reallocations with their new size */
+    uint64_t live[MEM_TAGS];
+    uint64_t peak[MEM_TAGS];
+    uint64_t heap; /* live bytes of all tags */
+    uint64_t peakHeap;
+} MemStats_t;
+
 typedef struct ira_s {
     Parameters_t params;
     Reloc_t reloc;
@@ -839,18 +929,68 @@ typedef struct ira_s {
     Equate_t *equates;
     Equate_t *lastEquate;
 
+    /* The same directives sorted by address once the config file is read.
+     * Pass 2 walks comments and banners with an index, like nextreloc. */
+    Comment_t **commentByAdr;
+    uint32_t commentCount;
+    uint32_t commentIndex;
+    Comment_t **bannerByAdr;
+    uint32_t bannerCount;
+    uint32_t bannerIndex;
+    Equate_t **equateByAdr;
+    uint32_t equateCount;
+
+    /* Open addressing hash of equate names: first equate with that name, NULL for a free slot */
+    Equate_t **equateNames;
+    uint32_t equateNameMask;
+    uint32_t equateNameCount;
+
     /* JMPtable */
     JMP_t jmp;
 
     Filenames_t filenames;
     Files_t files;
 
+    /* ExitPrg() returns there with the message, instead of exiting, see libira.c.
+     * A part of a parallel Pass 2 returns without closing anything, the
+     * thread joining it ends the program, see WriteAreasParallel(). */
+    jmp_buf *exitJump;
+    char exitText[256];
+    int part;
+
+    /* -CACHE key of the source, and whether Pass 1 came from the cache, see cache.c */
+    uint64_t cacheKey;
+    int cacheHit;
+
+    /* Kept here instead of in locals, so FreeIra() frees them after an ExitPrg().
+     * configLine is the config line GetFullLine() returned, cacheRead the
+     * cache file ReadCache() is reading. */
+    char *configLine;
+    uint32_t configLineSize;
+    struct ira_s *cacheRead;
+
+    /* -CACHE text of Pass 2, NULL without -CACHE or with -SPLITFILE.
+     * areaOffset has the target offset of every area and of the end. */
+    TextPart_t *textParts;
+    uint32_t textPartCount;
+    uint32_t textPartsCached;
+    uint64_t *areaOffset;
+
+    /* -STATS times, NULL without -STATS, and instructions decoded by all passes */
+    Stats_t *stats;
+    uint64_t decoded;
+
     /* OpCode management */
-    OpCodeByNibble_t opCodeByNibble[16];
+    uint16_t *opCodeTable;
     int opCodeNumber;
+    /* Operand modes of the current instruction, may be overridden by DoSpecific() */
+    uint16_t sourceadr;
+    uint16_t destadr;
 
     /* Misc values */
     uint32_t prgCount;
+    uint16_t progressLines; /* Pass 1 percentage every 200 lines */
+    uint32_t progressAdr;   /* Pass 2 percentage every 2 kb */
 
     /* unclassified ex-global variables */
     uint8_t symbolName[STDNAMELENGTH];
@@ -886,9 +1026,9 @@ typedef struct ira_s {
     uint32_t *hunksMemoryAttrs;
     int32_t LabAdr;
     uint16_t LabAdrFlag;
-    uint32_t labc1;
     uint32_t pc;
-    uint32_t *labelbuf;
+    uint8_t *adrMap;
+    uint32_t phaseAdr;
     uint32_t hunkCount;
     uint32_t modulcnt;
     uint32_t *hunksSize;
@@ -899,6 +1039,9 @@ typedef struct ira_s {
     char mnebuf[32];
     char dtabuf[96];
     char adrbuf[64];
+    uint32_t mnecnt;
+    uint32_t dtacnt;
+    uint32_t adrcnt;
 } ira_t;
 
 int AutoScan(ira_t *);
@@ -908,6 +1051,7 @@ int DoAdress2(uint16_t);
 void DPass0(ira_t *);
 void DPass1(ira_t *);
 void DPass2(ira_t *);
+void Disassemble(ira_t *);
 void DoSpecific(ira_t *, int);
 void ExitPrg(const char *, ...);
 void FormatError(void);
@@ -922,7 +1066,7 @@ void PrintAreas(CodeArea_t *);
 void SectionToArea(ira_t *);
 void SplitCodeAreas(ira_t *);
 void SplitOutputFiles(Files_t *, Filenames_t *, uint32_t);
-void WriteBaseDirective(FILE *);
+void WriteBaseDirective(void);
 void WriteBanner(uint32_t);
 void WriteComment(uint32_t);
 void WriteEquates(ira_t *);
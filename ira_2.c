@@ -10,6 +10,7 @@
  */
 
 #include <ctype.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -22,7 +23,7 @@
 #include "constants.h"
 #include "supp.h"
 
-extern ira_t *ira;
+extern IRA_TLS ira_t *ira;
 
 uint32_t FileLength(uint8_t *name) {
     int32_t len;
@@ -30,41 +31,47 @@ uint32_t FileLength(uint8_t *name) {
     if (name) {
         if (!(file = fopen((const char *)name, "rb")))
             ExitPrg("Can't open \"%s\".", name);
-        if (fseek(file, 0, SEEK_END))
+        len = fseek(file, 0, SEEK_END) ? -2L : ftell(file);
+        fclose(file);
+        if (len == -2L)
             ExitPrg("seek error (%s).", name);
-        if ((len = ftell(file)) == -1L)
+        if (len == -1L)
             ExitPrg("ftell error (%s).", name);
-        fclose(file);
     } else
-        printf("FileLength: Got no Name!\n");
+        fprintf(ira->files.msgFile, "FileLength: Got no Name!\n");
     return ((uint32_t) len);
 }
 
-void *GetNewVarBuffer(void *p, uint32_t size) {
-    uint8_t *np = myalloc(size * sizeof(uint32_t) * 2);
-
-    memcpy(np, p, size * sizeof(uint32_t));
-    memset(np + size * sizeof(uint32_t), 0, size * sizeof(uint32_t));
-    free(p);
-    return (np);
+/* Capacity for at least need elements, ARRAY_GROWTH percent of max or more */
+uint32_t GrowMax(uint32_t max, uint32_t need) {
+    uint64_t grown = (uint64_t) max * ARRAY_GROWTH / 100;
+
+    if (grown <= max)
+        grown = (uint64_t) max + 1;
+    if (grown < need)
+        grown = need;
+    if (grown > UINT32_MAX / 16)
+        ExitPrg("Out of memory (table of %lu entries)!", (unsigned long) need);
+    return ((uint32_t) grown);
 }
 
-void *GetNewPtrBuffer(void *p, uint32_t size) {
-    uint8_t *np = myalloc(size * sizeof(void *) * 2);
+/* Array of max elements of size bytes resized to newMax, by realloc() so
+ * it can grow in place. The new elements are zero. */
+void *ResizeArray(void *p, uint32_t max, uint32_t newMax, size_t size) {
+    uint8_t *np = myrealloc(p, (size_t) newMax * size);
 
-    memcpy(np, p, size * sizeof(void *));
-    memset(np + size * sizeof(void *), 0, size * sizeof(void *));
-    free(p);
+    if (newMax > max)
+        memset(np + (size_t) max * size, 0, (size_t) (newMax - max) * size);
     return (np);
 }
 
-void *GetNewStructBuffer(void *p, uint32_t size, uint32_t n) {
-    uint8_t *np = myalloc(n * size * 2);
+/* ResizeArray() to GrowMax(*max, need), *max is updated */
+void *GrowArray(void *p, uint32_t *max, uint32_t need, size_t size) {
+    uint32_t newMax = GrowMax(*max, need);
 
-    memcpy(np, p, n * size);
-    memset(np + n * size, 0, n * size);
-    free(p);
-    return (np);
+    p = ResizeArray(p, *max, newMax, size);
+    *max = newMax;
+    return (p);
 }
 
 void InsertReloc(uint32_t adr, uint32_t value, int32_t offs, uint32_t mod)
@@ -73,110 +80,153 @@ void InsertReloc(uint32_t adr, uint32_t value, int32_t offs, uint32_t mod)
  value   contents at that address (also an address)
  */
 {
-    uint32_t l = 0, m, r = ira->relocount;
-
     if (adr & 1)
         ExitPrg("Relocation at odd address $%lx not supported!", (unsigned long) adr);
-    /* This case happens frequently. */
-    if (ira->relocount && adr > ira->reloc.relocAdr[ira->relocount - 1]) {
-        ira->reloc.relocAdr[ira->relocount] = adr;
-        ira->reloc.relocVal[ira->relocount] = value;
-        ira->reloc.relocOff[ira->relocount] = offs;
-        ira->reloc.relocMod[ira->relocount++] = mod;
-    } else {
-        /* binary search for adr */
-        while (l < r) {
-            m = (l + r) / 2;
-            if (ira->reloc.relocAdr[m] < adr)
-                l = m + 1;
-            else
-                r = m;
-        }
-        if (r == ira->relocount || ira->reloc.relocAdr[r] != adr) {
-            lmovmem(&ira->reloc.relocAdr[r], &ira->reloc.relocAdr[r + 1], ira->relocount - r);
-            lmovmem(&ira->reloc.relocOff[r], &ira->reloc.relocOff[r + 1], ira->relocount - r);
-            lmovmem(&ira->reloc.relocVal[r], &ira->reloc.relocVal[r + 1], ira->relocount - r);
-            lmovmem(&ira->reloc.relocMod[r], &ira->reloc.relocMod[r + 1], ira->relocount - r);
-            ira->reloc.relocAdr[r] = adr;
-            ira->reloc.relocOff[r] = offs;
-            ira->reloc.relocVal[r] = value;
-            ira->reloc.relocMod[r] = mod;
-            ira->relocount++;
-        }
-    }
-    if (ira->relocount == ira->reloc.relocMax) {
-        ira->reloc.relocAdr = GetNewVarBuffer(ira->reloc.relocAdr, ira->reloc.relocMax);
-        ira->reloc.relocVal = GetNewVarBuffer(ira->reloc.relocVal, ira->reloc.relocMax);
-        ira->reloc.relocOff = GetNewVarBuffer(ira->reloc.relocOff, ira->reloc.relocMax);
-        ira->reloc.relocMod = GetNewVarBuffer(ira->reloc.relocMod, ira->reloc.relocMax);
-        ira->reloc.relocMax *= 2;
+
+    /* Just append, SortRelocs() puts the table in order before it is used. */
+    ira->reloc.relocs[ira->relocount].adr = adr;
+    ira->reloc.relocs[ira->relocount].val = value;
+    ira->reloc.relocs[ira->relocount].off = offs;
+    ira->reloc.relocs[ira->relocount++].mod = mod;
+
+    if (ira->relocount == ira->reloc.relocMax)
+        ira->reloc.relocs = GrowArray(ira->reloc.relocs, &ira->reloc.relocMax, ira->relocount + 1, sizeof(Relocation_t));
+}
+
+/* Room for n more relocations and their labels, as a reloc hunk announces them */
+void ReserveRelocs(uint32_t n) {
+    if (ira->relocount + n >= ira->reloc.relocMax)
+        ira->reloc.relocs = GrowArray(ira->reloc.relocs, &ira->reloc.relocMax, ira->relocount + n + 1, sizeof(Relocation_t));
+    if (ira->labcount + n >= ira->label.labelMax)
+        ira->label.labelAdr = GrowArray(ira->label.labelAdr, &ira->label.labelMax, ira->labcount + n + 1, sizeof(uint32_t));
+}
+
+/* Index of the first relocation at or after adr, relocount if there is none */
+uint32_t FindReloc(uint32_t adr) {
+    uint32_t l = 0, m, r = ira->relocount;
+
+    while (l < r) {
+        m = (l + r) / 2;
+        if (ira->reloc.relocs[m].adr < adr)
+            l = m + 1;
+        else
+            r = m;
     }
+    return (l);
 }
 
 void InsertLabel(int32_t adr) {
-    uint32_t l = 0, m, r = ira->labcount;
-
     if (ira->pass == 0)
         return;
 
-    /* Happens frequently. */
-    if (ira->labcount && (adr > (int32_t) ira->label.labelAdr[ira->labcount - 1])) {
-        ira->label.labelAdr[ira->labcount++] = adr;
-    } else {
-        /* binary search of adr */
-        while (l < r) {
-            m = (l + r) / 2;
-            if ((int32_t) ira->label.labelAdr[m] < adr)
-                l = m + 1;
-            else
-                r = m;
-        }
-        if (ira->label.labelAdr[r] != adr || r == ira->labcount) {
-            lmovmem(&ira->label.labelAdr[r], &ira->label.labelAdr[r + 1], ira->labcount - r);
-            ira->label.labelAdr[r] = adr;
-            ira->labcount++;
-        }
-    }
-    if (ira->labcount == ira->label.labelMax) {
-        ira->label.labelAdr = GetNewVarBuffer(ira->label.labelAdr, ira->label.labelMax);
-        ira->label.labelMax *= 2;
-    }
+    /* Just append, SortLabels() puts the table in order before it is used. */
+    ira->label.labelAdr[ira->labcount++] = adr;
+
+    if (ira->labcount == ira->label.labelMax)
+        ira->label.labelAdr = GrowArray(ira->label.labelAdr, &ira->label.labelMax, ira->labcount + 1, sizeof(uint32_t));
 }
 
 void InsertXref(uint32_t adr) {
-    uint32_t l = 0, m, r = ira->XRefCount;
-
     if (ira->pass == 0)
         return;
 
-    /* binary search of adr */
-    while (l < r) {
-        m = (l + r) / 2;
-        if (ira->XRefList[m] < adr)
-            l = m + 1;
-        else
-            r = m;
-    }
-    if (ira->XRefList[r] != adr || r == ira->XRefCount) {
-        lmovmem(&ira->XRefList[r], &ira->XRefList[r + 1], ira->XRefCount - r);
-        ira->XRefList[r] = adr;
-        ira->XRefCount++;
-    }
+    /* Just append, SortXrefs() puts the table in order before it is used. */
+    ira->XRefList[ira->XRefCount++] = adr;
 
-    if (ira->XRefCount == ira->LabX_len) {
-        ira->XRefList = GetNewVarBuffer(ira->XRefList, ira->LabX_len);
-        ira->LabX_len *= 2;
-    }
+    if (ira->XRefCount == ira->LabX_len)
+        ira->XRefList = GrowArray(ira->XRefList, &ira->LabX_len, ira->XRefCount + 1, sizeof(uint32_t));
+}
+
+/* Relocations are ordered by address, then by insertion order,
+ * so the first relocation inserted at an address is the one kept. */
+static int CompareRelocs(const void *a, const void *b) {
+    uint32_t i = *(const uint32_t *) a, j = *(const uint32_t *) b;
+
+    if (ira->reloc.relocs[i].adr != ira->reloc.relocs[j].adr)
+        return (ira->reloc.relocs[i].adr < ira->reloc.relocs[j].adr ? -1 : 1);
+    return (i < j ? -1 : (i > j));
+}
+
+/* Labels are compared as signed, like GetLabel() does */
+static int CompareLabels(const void *a, const void *b) {
+    int32_t i = *(const int32_t *) a, j = *(const int32_t *) b;
+
+    return (i < j ? -1 : (i > j));
+}
+
+static int CompareXrefs(const void *a, const void *b) {
+    uint32_t i = *(const uint32_t *) a, j = *(const uint32_t *) b;
+
+    return (i < j ? -1 : (i > j));
+}
+
+void SortRelocs(void) {
+    Relocation_t *relocs;
+    uint32_t *order, i, n;
+
+    /* Nothing to do if already strictly ascending */
+    for (i = 1; i < ira->relocount; i++)
+        if (ira->reloc.relocs[i - 1].adr >= ira->reloc.relocs[i].adr)
+            break;
+    if (i >= ira->relocount)
+        return;
+
+    order = mytalloc(ira->relocount * sizeof(uint32_t), MEM_RELOCS);
+    for (i = 0; i < ira->relocount; i++)
+        order[i] = i;
+    qsort(order, ira->relocount, sizeof(uint32_t), CompareRelocs);
+
+    /* note: unused entries must stay zero, pass 2 peeks past relocount */
+    relocs = mytcalloc(ira->reloc.relocMax * sizeof(Relocation_t), MEM_RELOCS);
+    for (i = 0, n = 0; i < ira->relocount; i++)
+        if (!n || relocs[n - 1].adr != ira->reloc.relocs[order[i]].adr)
+            relocs[n++] = ira->reloc.relocs[order[i]];
+    myfree(order);
+    myfree(ira->reloc.relocs);
+    ira->reloc.relocs = relocs;
+    ira->relocount = n;
+}
+
+void SortLabels(void) {
+    uint32_t i, n;
+
+    qsort(ira->label.labelAdr, ira->labcount, sizeof(uint32_t), CompareLabels);
+    for (i = 1, n = (ira->labcount ? 1 : 0); i < ira->labcount; i++)
+        if (ira->label.labelAdr[i] != ira->label.labelAdr[n - 1])
+            ira->label.labelAdr[n++] = ira->label.labelAdr[i];
+    memset(&ira->label.labelAdr[n], 0, (ira->labcount - n) * sizeof(uint32_t));
+    ira->labcount = n;
+}
+
+void SortXrefs(void) {
+    uint32_t i, n;
+
+    qsort(ira->XRefList, ira->XRefCount, sizeof(uint32_t), CompareXrefs);
+    for (i = 1, n = (ira->XRefCount ? 1 : 0); i < ira->XRefCount; i++)
+        if (ira->XRefList[i] != ira->XRefList[n - 1])
+            ira->XRefList[n++] = ira->XRefList[i];
+    memset(&ira->XRefList[n], 0, (ira->XRefCount - n) * sizeof(uint32_t));
+    ira->XRefCount = n;
+}
+
+/* Hash slot of the symbol at adr, or the free slot where it would go */
+uint32_t *SymbolSlot(uint32_t adr) {
+    uint32_t h = (adr ^ (adr >> 16)) * 0x45d9f3bUL;
+
+    h = (h ^ (h >> 16)) & ira->symbols.symbolHashMask;
+
+    while (ira->symbols.symbolHash[h] && ira->symbols.symbolValue[ira->symbols.symbolHash[h] - 1] != adr)
+        h = (h + 1) & ira->symbols.symbolHashMask;
+    return (&ira->symbols.symbolHash[h]);
 }
 
 int GetSymbol(uint32_t adr) {
-    uint32_t i;
+    uint32_t i = *SymbolSlot(adr);
 
-    for (i = 0; i < ira->symbols.symbolCount; i++)
-        if (ira->symbols.symbolValue[i] == adr) {
-            adrcat(ira->symbols.symbolName[i]);
-            return (-1);
-        }
+    if (i) {
+        adrcat(ira->symbols.symbolName[i - 1]);
+        return (-1);
+    }
 
     return (0);
 }
@@ -196,7 +246,7 @@ void GetLabel(int32_t address, uint16_t addressMode) {
         if (address > (int32_t) ira->hunksOffs[ira->baseReg.baseSection])
             adrcat("+");
         adrcat(itoa(address - ira->hunksOffs[ira->baseReg.baseSection]));
-        fprintf(stderr, "Base relative label not in section: %s\n", ira->adrbuf);
+        fprintf(ira->files.errFile, "Base relative label not in section: %s\n", ira->adrbuf);
         return;
     }
 
@@ -209,10 +259,10 @@ void GetLabel(int32_t address, uint16_t addressMode) {
             r = m;
     }
     if (ira->label.labelAdr[r] != address) {
-        fprintf(stderr, "ADR=%08lx not found! (mode=%d) relocount=%ld nextreloc=%ld\n", (unsigned long) address, (int) addressMode, (long) ira->relocount, (long) ira->nextreloc);
-        fprintf(stderr, "LabelAdr[l=%lu]=%08lx\n", l, (unsigned long) ira->label.labelAdr[l]);
-        fprintf(stderr, "LabelAdr[m=%lu]=%08lx\n", m, (unsigned long) ira->label.labelAdr[m]);
-        fprintf(stderr, "LabelAdr[r=%lu]=%08lx\n\n", r, (unsigned long) ira->label.labelAdr[r]);
+        fprintf(ira->files.errFile, "ADR=%08lx not found! (mode=%d) relocount=%ld nextreloc=%ld\n", (unsigned long) address, (int) addressMode, (long) ira->relocount, (long) ira->nextreloc);
+        fprintf(ira->files.errFile, "LabelAdr[l=%lu]=%08lx\n", l, (unsigned long) ira->label.labelAdr[l]);
+        fprintf(ira->files.errFile, "LabelAdr[m=%lu]=%08lx\n", m, (unsigned long) ira->label.labelAdr[m]);
+        fprintf(ira->files.errFile, "LabelAdr[r=%lu]=%08lx\n\n", r, (unsigned long) ira->label.labelAdr[r]);
         adrcat("LAB_");
         adrcat(itohex(address, 8));
         return;
@@ -225,15 +275,15 @@ void GetLabel(int32_t address, uint16_t addressMode) {
 
     /* Pass 2 */
     if (addressMode == 9999) {
-        if (ira->LabelAdr2[r] == ira->hunksOffs[ira->reloc.relocMod[ira->nextreloc]]) {
+        if (ira->LabelAdr2[r] == ira->hunksOffs[ira->reloc.relocs[ira->nextreloc].mod]) {
             if (!GetSymbol(ira->label.labelAdr[r2])) {
                 adrcat("SECSTRT_");
-                adrcat(itoa(ira->reloc.relocMod[ira->nextreloc]));
+                adrcat(itoa(ira->reloc.relocs[ira->nextreloc].mod));
             }
-            if ((dummy = ira->reloc.relocOff[ira->nextreloc])) {
-                if ((int32_t) ira->reloc.relocOff[ira->nextreloc] > 0)
+            if ((dummy = ira->reloc.relocs[ira->nextreloc].off)) {
+                if ((int32_t) ira->reloc.relocs[ira->nextreloc].off > 0)
                     adrcat("+");
-                adrcat(itoa(ira->reloc.relocOff[ira->nextreloc]));
+                adrcat(itoa(ira->reloc.relocs[ira->nextreloc].off));
             } else if ((dummy = ira->label.labelAdr[r2] - ira->LabelAdr2[r])) {
                 adrcat("+");
                 adrcat(itoa(dummy));
@@ -299,7 +349,7 @@ void GetExtName(uint32_t index) {
         else
             r = m;
     }
-    if (x_adrs[r].adr != xref) {
+    if (r == x_adr_number || x_adrs[r].adr != xref) {
         adrcat("EXT_");
         adrcat(itohex(index, 4));
     } else
@@ -318,37 +368,44 @@ void GetXref(uint32_t adr) {
             r = m;
     }
     if (ira->XRefList[r] != adr) {
-        fprintf(stderr, "XRef ADR=%08lx not found!\n", (unsigned long) adr);
+        fprintf(ira->files.errFile, "XRef ADR=%08lx not found!\n", (unsigned long) adr);
         adrcat("EXT_");
         adrcat(itohex(adr, 8));
     } else
         GetExtName(r);
 }
 
-char *GetEquate(int size, uint32_t adr) {
-    Equate_t *equ = ira->equates;
-    char *equate_name = NULL;
+/* Index of the first equate at or after adr in equateByAdr */
+static uint32_t FindEquate(uint32_t adr) {
+    uint32_t l = 0, m, r = ira->equateCount;
 
-    while (equ && !equate_name) {
-        if (equ->size == size && equ->equateAdr == adr)
-            equate_name = equ->equateName;
-        equ = equ->next;
+    while (l < r) {
+        m = (l + r) / 2;
+        if (ira->equateByAdr[m]->equateAdr < adr)
+            l = m + 1;
+        else
+            r = m;
     }
+    return (l);
+}
+
+char *GetEquate(int size, uint32_t adr) {
+    uint32_t i;
+
+    for (i = FindEquate(adr); i < ira->equateCount && ira->equateByAdr[i]->equateAdr == adr; i++)
+        if (ira->equateByAdr[i]->size == size)
+            return ira->equateByAdr[i]->equateName;
 
-    return equate_name;
+    return NULL;
 }
 
 uint32_t CheckEquate(ira_t *ira, uint32_t start, uint32_t end) {
-    Equate_t *equ;
-    uint32_t result = end;
+    uint32_t i = FindEquate(start);
 
-    for (equ = ira->equates; equ; equ = equ->next)
-        if (start <= equ->equateAdr && equ->equateAdr < end) {
-            result = equ->equateAdr;
-            break;
-        }
+    if (i < ira->equateCount && ira->equateByAdr[i]->equateAdr < end)
+        return ira->equateByAdr[i]->equateAdr;
 
-    return result;
+    return end;
 }
 
 static void CreateSymbol(const char *name, uint32_t symptr, uint32_t refptr, uint32_t module, uint32_t number) {
@@ -489,7 +546,229 @@ void SearchRomTag(ira_t *ira) {
     }
 }
 
+/* Target output is collected in two buffers of TARGET_BUFSIZE. With
+ * IRA_THREADS a writer thread writes one of them while Pass 2 fills
+ * the other one, otherwise a full buffer is written right away.
+ * See AppendTarget() for the parts of a parallel Pass 2. */
+#ifdef IRA_THREADS
+static void *WriterThread(void *arg) {
+    Files_t *files = arg;
+    Writer_t *w = &files->writer;
+    char *buf;
+    uint32_t len;
+    int error;
+
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        while (!w->pending && !w->stop)
+            pthread_cond_wait(&w->cond, &w->lock);
+        if (!w->pending)
+            break;
+        buf = w->buf[w->fill ^ 1];
+        len = w->pending;
+        pthread_mutex_unlock(&w->lock);
+
+        error = fwrite(buf, 1, len, files->targetFile) != len;
+
+        pthread_mutex_lock(&w->lock);
+        w->error |= error;
+        w->pending = 0;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+#endif
+
+/* Returns non-zero on a write error */
+static int FlushTarget(Files_t *files) {
+    Writer_t *w = &files->writer;
+    int error;
+
+#ifdef IRA_THREADS
+    pthread_mutex_lock(&w->lock);
+    while (w->pending)
+        pthread_cond_wait(&w->cond, &w->lock);
+    error = w->error;
+    if (w->len) {
+        w->fill ^= 1;
+        w->pending = w->len;
+        pthread_cond_broadcast(&w->cond);
+    }
+    pthread_mutex_unlock(&w->lock);
+#else
+    error = w->len && fwrite(w->buf[w->fill], 1, w->len, files->targetFile) != w->len;
+#endif
+    files->written += w->len;
+    w->len = 0;
+
+    return error;
+}
+
+int OpenTarget(const char *name) {
+    FILE *file;
+
+    if (!(file = fopen(name, "w")))
+        return 0;
+
+    OpenTargetFile(&ira->files, file);
+    return 1;
+}
+
+/* Write the target output of files to an open file */
+void OpenTargetFile(Files_t *files, FILE *file) {
+    Writer_t *w = &files->writer;
+
+    files->targetFile = file;
+    w->buf[0] = myalloc(2 * TARGET_BUFSIZE);
+    w->buf[1] = w->buf[0] + TARGET_BUFSIZE;
+    w->size = TARGET_BUFSIZE;
+    w->len = 0;
+    w->fill = 0;
+#ifdef IRA_THREADS
+    w->pending = 0;
+    w->error = 0;
+    w->stop = 0;
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->cond, NULL);
+    if (pthread_create(&w->thread, NULL, WriterThread, files))
+        ExitPrg("Can't start writer thread!");
+#endif
+}
+
+static void TargetFull(void) {
+    if (FlushTarget(&ira->files))
+        ExitPrg("Write Error !");
+}
+
+/* Returns non-zero on a write error, so the caller can free what it holds */
+static int CopyTarget(const char *p, uint32_t len) {
+    Writer_t *w = &ira->files.writer;
+    uint32_t n;
+
+    while (len) {
+        n = w->size - w->len;
+        if (n > len)
+            n = len;
+        memcpy(w->buf[w->fill] + w->len, p, n);
+        w->len += n;
+        p += n;
+        len -= n;
+        if (w->len == w->size && FlushTarget(&ira->files))
+            return 1;
+    }
+    return 0;
+}
+
+/* Write what is left and free the buffers, returns non-zero on a write error */
+static int StopTarget(Files_t *files) {
+    Writer_t *w = &files->writer;
+    int error;
+
+    error = FlushTarget(files);
+#ifdef IRA_THREADS
+    pthread_mutex_lock(&w->lock);
+    w->stop = 1;
+    pthread_cond_broadcast(&w->cond);
+    pthread_mutex_unlock(&w->lock);
+    pthread_join(w->thread, NULL);
+    error |= w->error;
+    pthread_cond_destroy(&w->cond);
+    pthread_mutex_destroy(&w->lock);
+#endif
+    myfree(w->buf[0]);
+    w->buf[0] = w->buf[1] = NULL;
+
+    return error;
+}
+
+void CloseTarget(void) {
+    Files_t *files = &ira->files;
+    int error;
+
+    if (!files->targetFile)
+        return;
+
+    error = StopTarget(files);
+    error |= fclose(files->targetFile) != 0;
+    files->targetFile = NULL;
+
+    if (error)
+        ExitPrg("Write Error !");
+}
+
+/* Append at most size bytes of file, from where it is, to the target.
+ * Returns how many of them the file didn't have. */
+uint64_t FileToTarget(FILE *file, uint64_t size) {
+    Writer_t *w = &ira->files.writer;
+    size_t n;
+
+    while (size && (n = fread(w->buf[w->fill] + w->len, 1, size < w->size - w->len ? size : w->size - w->len, file)) > 0) {
+        w->len += n;
+        size -= n;
+        if (w->len == w->size)
+            TargetFull();
+    }
+    return (size);
+}
+
+/* Bytes of target output so far, including those still in the buffer */
+uint64_t TargetOffset(void) {
+    return (ira->files.written + ira->files.writer.len);
+}
+
+/* Close the target of part, a temporary file, and append it to the target */
+void AppendTarget(Files_t *part) {
+    int error;
+
+    error = StopTarget(part);
+    rewind(part->targetFile);
+    FileToTarget(part->targetFile, ~(uint64_t) 0);
+    error |= ferror(part->targetFile);
+    fclose(part->targetFile);
+    part->targetFile = NULL;
+
+    if (error)
+        ExitPrg("Write Error !");
+}
+
+/* Close the target of part after an error, what it wrote is left as it is */
+void DiscardTarget(Files_t *part) {
+    if (part->writer.buf[0])
+        StopTarget(part);
+    if (part->targetFile)
+        fclose(part->targetFile);
+    part->targetFile = NULL;
+}
+
+void TargetPrintf(const char *fmt, ...) {
+    Writer_t *w = &ira->files.writer;
+    va_list arguments;
+    char *tmp;
+    int n, error;
+
+    va_start(arguments, fmt);
+    n = vsnprintf(w->buf[w->fill] + w->len, w->size - w->len, fmt, arguments);
+    va_end(arguments);
+    if (n < 0)
+        ExitPrg("Write Error !");
+
+    if ((uint32_t) n < w->size - w->len)
+        w->len += n;
+    else {
+        /* didn't fit, format again into a buffer of its own */
+        tmp = myalloc(n + 1);
+        va_start(arguments, fmt);
+        vsnprintf(tmp, n + 1, fmt, arguments);
+        va_end(arguments);
+        error = CopyTarget(tmp, n);
+        myfree(tmp);
+        if (error)
+            ExitPrg("Write Error !");
+    }
+}
+
 void WriteTarget(void *ptr, uint32_t len) {
-    if ((fwrite(ptr, 1, len, ira->files.targetFile)) != len)
+    if (CopyTarget(ptr, len))
         ExitPrg("Write Error !");
 }
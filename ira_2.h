@@ -12,20 +12,34 @@
 #ifndef IRA_2_H_
 #define IRA_2_H_
 
+void AppendTarget(Files_t *);
 uint32_t CheckEquate(ira_t *, uint32_t, uint32_t);
+void CloseTarget(void);
+void DiscardTarget(Files_t *);
 uint32_t FileLength(uint8_t *);
+uint64_t FileToTarget(FILE *, uint64_t);
+uint32_t FindReloc(uint32_t);
 char *GetEquate(int, uint32_t);
 void GetExtName(uint32_t);
 void GetLabel(int32_t, uint16_t);
-void *GetNewPtrBuffer(void *, uint32_t);
-void *GetNewStructBuffer(void *, uint32_t, uint32_t);
-void *GetNewVarBuffer(void *, uint32_t);
 int GetSymbol(uint32_t);
 void GetXref(uint32_t);
+void *GrowArray(void *, uint32_t *, uint32_t, size_t);
+uint32_t GrowMax(uint32_t, uint32_t);
 void InsertLabel(int32_t);
 void InsertReloc(uint32_t, uint32_t, int32_t, uint32_t);
 void InsertXref(uint32_t);
+int OpenTarget(const char *);
+void OpenTargetFile(Files_t *, FILE *);
+void ReserveRelocs(uint32_t);
+void *ResizeArray(void *, uint32_t, uint32_t, size_t);
 void SearchRomTag(ira_t *);
+void SortLabels(void);
+void SortRelocs(void);
+void SortXrefs(void);
+uint32_t *SymbolSlot(uint32_t);
+uint64_t TargetOffset(void);
+void TargetPrintf(const char *, ...);
 void WriteTarget(void *, uint32_t);
 
 #endif /* IRA_2_H_ */
@@ -0,0 +1,139 @@
+/*
+ * libira.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : libira.c
+ *      Purpose  : IRA as a library, see libira.h
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ira.h"
+
+#include "cache.h"
+#include "config.h"
+#include "init.h"
+#include "ira_2.h"
+#include "libira.h"
+#include "opcode.h"
+#include "stats.h"
+#include "supp.h"
+
+extern IRA_TLS ira_t *ira;
+
+/* Everything after Init() */
+void Disassemble(ira_t *ira) {
+    if (!ira->opCodeTable)
+        BuildOpCodeTable(ira);
+
+    /* InitSource() found Pass 1 in the -CACHE directory */
+    if (ira->cacheHit) {
+        if (ira->params.pFlags & PREPROC)
+            CreateConfig(ira);
+        PrintAreas(&ira->codeArea);
+        DPass2(ira);
+        WriteCacheText(ira);
+        PrintStats(ira);
+        return;
+    }
+
+    StatsStart(ira);
+    SearchRomTag(ira);
+    StatsStop(ira, STATS_ROMTAG);
+    SortRelocs();
+    if (ira->params.pFlags & PREPROC) {
+        StatsStart(ira);
+        DPass0(ira);
+        StatsStop(ira, STATS_PASS0);
+        CreateConfig(ira);
+    } else if (ira->params.pFlags & CONFIG)
+        CNFAreaToCodeArea(ira);
+    else
+        SectionToArea(ira);
+
+    PrintAreas(&ira->codeArea);
+    StatsStart(ira);
+    DPass1(ira);
+    StatsStop(ira, STATS_PASS1);
+    if (ira->params.cacheDir)
+        WriteCache(ira);
+    DPass2(ira);
+    WriteCacheText(ira);
+    PrintStats(ira);
+}
+
+static void SetError(char *error, size_t size, const char *text) {
+    if (error && size)
+        snprintf(error, size, "%s", text);
+}
+
+int IraDisassemble(ira_t *options, char *source, char *target, char *error, size_t size) {
+    ira_t *caller = ira;
+    jmp_buf exitJump;
+    volatile int failed = 0;
+
+    ira = Start();
+    ira->params = options->params;
+    ira->baseReg = options->baseReg;
+    ira->adrlen = options->adrlen;
+    ira->files.msgFile = options->files.msgFile;
+    ira->files.errFile = options->files.errFile;
+    ira->exitJump = &exitJump;
+
+    if (!setjmp(exitJump)) {
+        InitSource(ira, source, target);
+        /* unless the config file chose another CPU */
+        if (ira->params.cpuType == options->params.cpuType)
+            ira->opCodeTable = options->opCodeTable;
+        Disassemble(ira);
+        CloseTarget();
+    } else {
+        SetError(error, size, ira->exitText);
+        failed = -1;
+    }
+
+    if (ira->opCodeTable == options->opCodeTable)
+        ira->opCodeTable = NULL;
+    FreeIra(ira);
+    ira = caller;
+    return (failed);
+}
+
+void IraFree(ira_t *options) {
+    myfree(options->params.cacheDir);
+    FreeIra(options);
+}
+
+ira_t *IraNew(int argc, char **argv, char *error, size_t size) {
+    ira_t *caller = ira, *options;
+    jmp_buf exitJump;
+    int nextarg = 0;
+
+    ira = options = Start();
+    options->exitJump = &exitJump;
+
+    if (setjmp(exitJump)) {
+        SetError(error, size, options->exitText);
+        IraFree(options);
+        ira = caller;
+        return (NULL);
+    }
+
+    InitOptions(options, argc, argv, &nextarg);
+    if (nextarg < argc)
+        ExitPrg("Unexpected argument \"%s\".", argv[nextarg]);
+    BuildOpCodeTable(options);
+
+    options->exitJump = NULL;
+    ira = caller;
+    return (options);
+}
+
+void IraSetOutput(ira_t *options, FILE *msgFile, FILE *errFile) {
+    options->files.msgFile = msgFile;
+    options->files.errFile = errFile;
+}
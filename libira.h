@@ -0,0 +1,45 @@
+/*
+ * libira.h
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : libira.h
+ *      Purpose  : Interface of libira, IRA as a library
+ *
+ * An options context is made once, from the same options as the command
+ * line, then any number of sources are reassembled with it. Each source
+ * gets a context of its own, so with IRA_THREADS several threads may use
+ * the same options context at once. Errors are returned, never exit().
+ * Inside, IRA still reaches the context through the global ira pointer,
+ * thread-local with IRA_THREADS, which IraDisassemble() sets for the
+ * source and restores on return. Errors come back by a longjmp() from
+ * ExitPrg(). Without IRA_THREADS only one thread may call the library.
+ */
+
+#ifndef LIBIRA_H_
+#define LIBIRA_H_
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifndef IRA_H
+typedef struct ira_s ira_t;
+#endif
+
+/* Reassemble source into target (NULL for the name IRA would choose).
+ * Returns 0, or -1 with the message in error (may be NULL).
+ * Pass 2 runs on the calling thread only: an error on a Pass 2 thread
+ * could not return to the caller. The same holds for -BATCH and -SERVE,
+ * which run their sources through here. */
+int IraDisassemble(ira_t *, char *, char *, char *, size_t);
+
+void IraFree(ira_t *);
+
+/* Options as on the command line, without program name and source.
+ * Returns NULL with the message in error (may be NULL). */
+ira_t *IraNew(int, char **, char *, size_t);
+
+/* Where progress and warnings go, stdout and stderr by default */
+void IraSetOutput(ira_t *, FILE *, FILE *);
+
+#endif /* LIBIRA_H_ */
@@ -0,0 +1,221 @@
+/*
+ * main.c
+ *
+ *  Created on: 17 october 2026
+ *      Author   : Tim Ruehsen, Frank Wille, Nicolas Bastien
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : main.c
+ *      Purpose  : Main program and -BATCH mode
+ *      Copyright: (C)1993-1995 Tim Ruehsen
+ *                 (C)2009-2015 Frank Wille, (C)2014-2018 Nicolas Bastien
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef IRA_THREADS
+#include <unistd.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <dirent.h>
+#include <sys/stat.h>
+#define IRA_DIRS
+#endif
+
+#include "ira.h"
+
+#include "init.h"
+#include "libira.h"
+#include "opcode.h"
+#include "serve.h"
+#include "supp.h"
+
+#ifdef AMIGAOS
+const char *VERsion = "$VER: IRA " VERSION "." REVISION " "__AMIGADATE__;
+#endif
+
+#ifdef AMIGAOS
+#define NULL_DEVICE "NIL:"
+#elif defined(_WIN32)
+#define NULL_DEVICE "NUL"
+#else
+#define NULL_DEVICE "/dev/null"
+#endif
+
+extern IRA_TLS ira_t *ira;
+
+/* -BATCH: every source is disassembled by IraDisassemble() */
+typedef struct Batch_s {
+    ira_t *ira;    /* options of all sources */
+    FILE *msgFile; /* gets the OK and FAILED lines */
+    char **names;
+    uint32_t count;
+    uint32_t max;
+    uint32_t next;
+    uint32_t failed;
+#ifdef IRA_THREADS
+    pthread_mutex_t lock;
+#endif
+} Batch_t;
+
+static void AddBatchSource(Batch_t *batch, char *name) {
+    if (batch->count == batch->max) {
+        batch->max = batch->max ? batch->max * 2 : 64;
+        batch->names = myrealloc(batch->names, batch->max * sizeof(char *));
+    }
+    batch->names[batch->count++] = name;
+}
+
+#ifdef IRA_DIRS
+/* Files IRA writes itself are no sources */
+static int IsTargetName(const char *name) {
+    size_t len = strlen(name);
+
+    return (len >= 4 && (!stricmp(&name[len - 4], ASM_EXT) || !stricmp(&name[len - 4], BIN_EXT) || !stricmp(&name[len - 4], CONFIG_EXT)));
+}
+
+static int CompareNames(const void *a, const void *b) {
+    return (strcmp(*(char *const *) a, *(char *const *) b));
+}
+#endif
+
+/* The batch source is a directory or a file with one source per line */
+static void ReadBatchSources(Batch_t *batch) {
+    const char *source = batch->ira->filenames.sourceName;
+    char line[1024], *p;
+    FILE *list;
+#ifdef IRA_DIRS
+    struct dirent *entry;
+    struct stat st;
+    DIR *dir;
+
+    if ((dir = opendir(source))) {
+        while ((entry = readdir(dir))) {
+            p = myalloc(strlen(source) + strlen(entry->d_name) + 2);
+            sprintf(p, "%s/%s", source, entry->d_name);
+            if (!stat(p, &st) && S_ISREG(st.st_mode) && !IsTargetName(p))
+                AddBatchSource(batch, p);
+            else
+                myfree(p);
+        }
+        closedir(dir);
+        if (batch->count)
+            qsort(batch->names, batch->count, sizeof(char *), CompareNames);
+        return;
+    }
+#endif
+
+    if (!(list = fopen(source, "r")))
+        ExitPrg("Can't open source list \"%s\".", source);
+    while (fgets(line, sizeof(line), list)) {
+        if ((p = strpbrk(line, "\r\n")))
+            *p = 0;
+        if (line[0])
+            AddBatchSource(batch, mystrdup(line));
+    }
+    fclose(list);
+}
+
+/* Returns 1 if the source failed */
+static int RunBatchJob(Batch_t *batch, uint32_t i) {
+    char error[256];
+
+    if (IraDisassemble(batch->ira, batch->names[i], NULL, error, sizeof(error))) {
+        fprintf(batch->msgFile, "FAILED %s: %s\n", batch->names[i], error);
+        return (1);
+    }
+    fprintf(batch->msgFile, "OK     %s\n", batch->names[i]);
+    return (0);
+}
+
+#ifdef IRA_THREADS
+/* Take sources from the batch until none is left */
+static void *BatchThread(void *arg) {
+    Batch_t *batch = arg;
+    uint32_t i, failed = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&batch->lock);
+        i = batch->next++;
+        pthread_mutex_unlock(&batch->lock);
+        if (i >= batch->count)
+            break;
+        failed += RunBatchJob(batch, i);
+    }
+
+    pthread_mutex_lock(&batch->lock);
+    batch->failed += failed;
+    pthread_mutex_unlock(&batch->lock);
+    return NULL;
+}
+#endif
+
+static void RunBatch(ira_t *ira) {
+    Batch_t batch;
+    FILE *errFile = ira->files.errFile, *nullFile;
+    uint32_t i;
+#ifdef IRA_THREADS
+    pthread_t *threads;
+    uint32_t count = ira->params.jobs;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    memset(&batch, 0, sizeof(batch));
+    batch.ira = ira;
+    batch.msgFile = ira->files.msgFile;
+    ReadBatchSources(&batch);
+    if (!batch.count) {
+        fprintf(ira->files.msgFile, "0 sources done.\n");
+        return;
+    }
+    if (!(nullFile = fopen(NULL_DEVICE, "w")))
+        ExitPrg("Can't open \"%s\".", NULL_DEVICE);
+
+    /* The opcode table only depends on the CPU options */
+    BuildOpCodeTable(ira);
+    IraSetOutput(ira, nullFile, nullFile);
+
+#ifdef IRA_THREADS
+    if (!count)
+        count = cpus > 1 ? cpus : 1;
+    if (count > batch.count)
+        count = batch.count;
+    threads = myalloc(count * sizeof(pthread_t));
+    pthread_mutex_init(&batch.lock, NULL);
+    for (i = 0; i < count; i++)
+        if (pthread_create(&threads[i], NULL, BatchThread, &batch))
+            ExitPrg("Can't start batch thread!");
+    for (i = 0; i < count; i++)
+        pthread_join(threads[i], NULL);
+    pthread_mutex_destroy(&batch.lock);
+    myfree(threads);
+#else
+    for (i = 0; i < batch.count; i++)
+        batch.failed += RunBatchJob(&batch, i);
+#endif
+
+    IraSetOutput(ira, batch.msgFile, errFile);
+    fclose(nullFile);
+    for (i = 0; i < batch.count; i++)
+        myfree(batch.names[i]);
+    myfree(batch.names);
+
+    if (batch.failed)
+        ExitPrg("%lu of %lu sources failed.", (unsigned long) batch.failed, (unsigned long) batch.count);
+    fprintf(ira->files.msgFile, "%lu sources done.\n", (unsigned long) batch.count);
+}
+
+int main(int argc, char **argv) {
+    ira = Start();
+
+    Init(ira, argc, argv);
+    if (ira->params.pFlags & SERVE)
+        RunServer(ira);
+    else if (ira->params.pFlags & BATCH)
+        RunBatch(ira);
+    else
+        Disassemble(ira);
+
+    ExitPrg(NULL);
+}
@@ -19,31 +19,31 @@
 #include "opcode.h"
 #include "supp.h"
 
-static int FindOpCodeNumber(ira_t *ira, uint16_t seaow) {
-    int i, number;
-
-    /* set the number of the opcode to the maximum (DC.W) as default. */
-    number = OpCode_number - 1;
-
-    /* Linear search by nibble */
-    for (i = ira->opCodeByNibble[seaow >> 12].start; i < ira->opCodeByNibble[seaow >> 12].start + ira->opCodeByNibble[seaow >> 12].count; i++)
-        if (((seaow & instructions[i].mask) == instructions[i].result) && (instructions[i].cpuType & ira->params.cpuType)) {
-            number = i;
-            break;
-        }
+void BuildOpCodeTable(ira_t *ira) {
+    int i;
+    uint32_t w;
+    uint16_t bits, freebits;
 
-    return number;
-}
+    /* One entry for every possible first word, for the chosen CPU/FPU/MMU.
+     * note: mycalloc() doesn't return if allocation failed, so no need to check returned value */
+    ira->opCodeTable = mycalloc(OPCODE_TABLE_SIZE * sizeof(uint16_t));
 
-void GroupOpCodeByNibble(ira_t *ira) {
-    int i;
+    /* set the number of the opcode to the maximum (DC.W) as default. */
+    for (w = 0; w < OPCODE_TABLE_SIZE; w++)
+        ira->opCodeTable[w] = OpCode_number - 1;
 
-    /* Let's fill an index to find opcodes grouped by their first nibble.
-     * note: very important!!! instructions[] array MUST be sorted by opcode first nibble */
-    for (i = 0; i < OpCode_number - 1; i++) {
-        if (ira->opCodeByNibble[instructions[i].result >> 12].count == 0)
-            ira->opCodeByNibble[instructions[i].result >> 12].start = i;
-        ira->opCodeByNibble[instructions[i].result >> 12].count++;
+    /* A word matches an instruction when it is its result plus any combination of the bits
+     * outside of its mask. Instructions are entered from last to first, so that, like with a
+     * linear search, the first matching instruction of instructions[] is the one remaining. */
+    for (i = OpCode_number - 2; i >= 0; i--) {
+        if (!(instructions[i].cpuType & ira->params.cpuType) || (instructions[i].result & ~instructions[i].mask))
+            continue;
+        freebits = ~instructions[i].mask;
+        bits = 0;
+        do {
+            ira->opCodeTable[instructions[i].result | bits] = i;
+            bits = (bits - freebits) & freebits;
+        } while (bits);
     }
 }
 
@@ -52,7 +52,11 @@ void GroupOpCodeByNibble(ira_t *ira) {
  * as defined in chapter "2.1 INSTRUCTION FORMAT" of MC68000PRM.
  */
 void GetOpCode(ira_t *ira, uint16_t seaow) {
-    ira->opCodeNumber = FindOpCodeNumber(ira, seaow);
+    ira->opCodeNumber = ira->opCodeTable[seaow];
+
+    /* instructions[] is read-only, operand modes are decoded per instruction */
+    ira->sourceadr = instructions[ira->opCodeNumber].sourceadr;
+    ira->destadr = instructions[ira->opCodeNumber].destadr;
 
     /* split up the opcode */
     ira->alt_register = (seaow & ALT_REGISTER_MASK) >> 9;
@@ -13,7 +13,9 @@
 #ifndef OPCODE_H_
 #define OPCODE_H_
 
+#define OPCODE_TABLE_SIZE 0x10000
+
+void BuildOpCodeTable(ira_t *);
 void GetOpCode(ira_t *, uint16_t);
-void GroupOpCodeByNibble(ira_t *);
 
 #endif /* OPCODE_H_ */
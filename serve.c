@@ -0,0 +1,312 @@
+/*
+ * serve.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : serve.c
+ *      Purpose  : -SERVE, jobs taken from a Unix domain socket
+ *
+ * Every line a client sends is one job: the arguments of an IRA command
+ * line separated by tabs, options first, then the source and maybe the
+ * target. A job without options gets the options of IRA -SERVE. Each job
+ * is answered by one line:
+ *     OK<tab>source<tab>wall ms<tab>CPU ms
+ *     FAILED<tab>source<tab>error
+ * -JOBS=n clients are served at once, the jobs of one client in order.
+ * -BATCH, -JOBS and -SERVE are refused in a job. SIGTERM or SIGINT stops
+ * the server: no more clients are accepted, a connected one gets the
+ * answer to its next job, then the socket is removed.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#define IRA_SOCKETS
+#endif
+
+#include "ira.h"
+
+#include "libira.h"
+#include "opcode.h"
+#include "serve.h"
+#include "supp.h"
+
+#ifdef IRA_SOCKETS
+
+#define SERVE_ARGS 64     /* arguments of a job line */
+#define SERVE_CONTEXTS 32 /* option sets kept with their opcode table */
+
+/* Options context of the jobs sending the same options */
+typedef struct Context_s {
+    char *options; /* as sent, joined by tabs */
+    ira_t *ira;
+    struct Context_s *next;
+} Context_t;
+
+typedef struct Server_s {
+    ira_t *ira; /* options of IRA -SERVE */
+    FILE *nullFile;
+    int socket;
+    Context_t *contexts;
+    uint32_t contextCount;
+#ifdef IRA_THREADS
+    pthread_mutex_t lock;
+#endif
+} Server_t;
+
+/* For StopServer(), a signal handler has no other way to reach them */
+static volatile sig_atomic_t serverStopped;
+static int serverSocket = -1;
+
+/* SIGTERM and SIGINT: accept() returns, every thread ends after the job of its client */
+static void StopServer(int sig) {
+    serverStopped = 1;
+    shutdown(serverSocket, SHUT_RDWR);
+}
+
+/* The context for these options, made once. Sets *temporary if it must be freed after the job. */
+static ira_t *GetContext(Server_t *server, int argc, char **argv, char *error, size_t size, int *temporary) {
+    Context_t *context;
+    ira_t *result = NULL;
+    size_t len = 0;
+    char *options;
+    int i;
+
+    for (i = 0; i < argc; i++)
+        len += strlen(argv[i]) + 1;
+    options = myalloc(len + 1);
+    for (len = 0, i = 0; i < argc; i++)
+        len += sprintf(&options[len], "%s\t", argv[i]);
+
+#ifdef IRA_THREADS
+    pthread_mutex_lock(&server->lock);
+#endif
+    for (context = server->contexts; context; context = context->next)
+        if (!strcmp(context->options, options))
+            break;
+    if (context)
+        result = context->ira;
+    else if ((result = IraNew(argc, argv, error, size)) &&
+             ((result->params.pFlags & (BATCH | SERVE)) || result->params.jobs)) {
+        /* A job runs on a server thread, it can't start threads or servers of its own */
+        snprintf(error, size, "-BATCH, -JOBS and -SERVE can't be used in a job.");
+        IraFree(result);
+        result = NULL;
+    } else if (result) {
+        IraSetOutput(result, server->nullFile, server->nullFile);
+        if (server->contextCount < SERVE_CONTEXTS) {
+            context = myalloc(sizeof(Context_t));
+            context->options = options;
+            context->ira = result;
+            context->next = server->contexts;
+            server->contexts = context;
+            server->contextCount++;
+            options = NULL;
+        } else
+            *temporary = 1;
+    }
+#ifdef IRA_THREADS
+    pthread_mutex_unlock(&server->lock);
+#endif
+    myfree(options);
+    return (result);
+}
+
+static double Milliseconds(struct timespec *start, struct timespec *end) {
+    return ((end->tv_sec - start->tv_sec) * 1000.0 + (end->tv_nsec - start->tv_nsec) / 1000000.0);
+}
+
+static void RunJob(Server_t *server, char *line, FILE *out) {
+    char *argv[SERVE_ARGS], error[256], *p;
+    struct timespec wall[2], cpu[2];
+    int argc = 0, options, temporary = 0;
+    ira_t *context;
+
+    if ((p = strpbrk(line, "\r\n")))
+        *p = 0;
+    for (p = line; p;) {
+        if (argc == SERVE_ARGS) {
+            fprintf(out, "FAILED\t%s\tToo many arguments.\n", argv[0]);
+            return;
+        }
+        if (*p && *p != '\t')
+            argv[argc++] = p;
+        if ((p = strchr(p, '\t')))
+            *p++ = 0;
+    }
+
+    for (options = 0; options < argc && argv[options][0] == '-'; options++)
+        ;
+    if (options == argc) {
+        fprintf(out, "FAILED\t\tNo source specified!\n");
+        return;
+    }
+    if (argc - options > 2) {
+        fprintf(out, "FAILED\t%s\tUnexpected argument \"%s\".\n", argv[options], argv[options + 2]);
+        return;
+    }
+
+    if (!options)
+        context = server->ira;
+    else if (!(context = GetContext(server, options, argv, error, sizeof(error), &temporary))) {
+        fprintf(out, "FAILED\t%s\t%s\n", argv[options], error);
+        return;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wall[0]);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu[0]);
+    if (IraDisassemble(context, argv[options], options + 1 < argc ? argv[options + 1] : NULL, error, sizeof(error)))
+        fprintf(out, "FAILED\t%s\t%s\n", argv[options], error);
+    else {
+        clock_gettime(CLOCK_MONOTONIC, &wall[1]);
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu[1]);
+        fprintf(out, "OK\t%s\t%.3f\t%.3f\n", argv[options], Milliseconds(&wall[0], &wall[1]), Milliseconds(&cpu[0], &cpu[1]));
+    }
+
+    if (temporary)
+        IraFree(context);
+}
+
+/* Jobs of one client until it hangs up */
+static void ServeClient(Server_t *server, int client) {
+    char line[4096];
+    FILE *in, *out;
+    int c;
+
+    if (!(in = fdopen(client, "r"))) {
+        close(client);
+        return;
+    }
+    if (!(out = fdopen(dup(client), "w"))) {
+        fclose(in);
+        return;
+    }
+
+    while (!serverStopped && fgets(line, sizeof(line), in)) {
+        if (!strchr(line, '\n') && !feof(in)) {
+            while ((c = getc(in)) != EOF && c != '\n')
+                ;
+            fprintf(out, "FAILED\t\tJob line too long.\n");
+        } else
+            RunJob(server, line, out);
+        if (fflush(out))
+            break;
+    }
+
+    fclose(out);
+    fclose(in);
+}
+
+static void *ServerThread(void *arg) {
+    Server_t *server = arg;
+    int client;
+
+    while (!serverStopped)
+        if ((client = accept(server->socket, NULL, NULL)) >= 0)
+            ServeClient(server, client);
+        else if (errno != EINTR && errno != ECONNABORTED)
+            break;
+    return NULL;
+}
+
+void RunServer(ira_t *ira) {
+    Server_t server;
+    Context_t *context;
+    FILE *msgFile = ira->files.msgFile, *errFile = ira->files.errFile;
+    struct sockaddr_un address;
+    struct sigaction action;
+    struct stat st;
+    const char *name = ira->filenames.sourceName;
+    mode_t mask;
+#ifdef IRA_THREADS
+    pthread_t *threads;
+    uint32_t i, count = ira->params.jobs;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    memset(&server, 0, sizeof(server));
+    server.ira = ira;
+    if (strlen(name) >= sizeof(address.sun_path))
+        ExitPrg("Socket name \"%s\" is too long.", name);
+    if (!(server.nullFile = fopen("/dev/null", "w")))
+        ExitPrg("Can't open \"/dev/null\".");
+
+    /* A socket left by an earlier server is replaced, any other file is not */
+    if (!stat(name, &st) && S_ISSOCK(st.st_mode))
+        unlink(name);
+    if ((server.socket = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+        ExitPrg("Can't create socket.");
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, name);
+
+    /* Only the user running IRA may connect */
+    mask = umask(0077);
+    if (bind(server.socket, (struct sockaddr *) &address, sizeof(address)) || listen(server.socket, 16)) {
+        umask(mask);
+        ExitPrg("Can't listen on socket \"%s\".", name);
+    }
+    umask(mask);
+
+    /* A client hanging up must not end the server, SIGTERM and SIGINT end it cleanly */
+    signal(SIGPIPE, SIG_IGN);
+    serverSocket = server.socket;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = StopServer;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGTERM, &action, NULL);
+    sigaction(SIGINT, &action, NULL);
+
+    BuildOpCodeTable(ira);
+    fprintf(ira->files.msgFile, "Serving on \"%s\".\n", name);
+    fflush(ira->files.msgFile);
+    IraSetOutput(ira, server.nullFile, server.nullFile);
+
+#ifdef IRA_THREADS
+    if (!count)
+        count = cpus > 1 ? cpus : 1;
+    threads = myalloc(count * sizeof(pthread_t));
+    pthread_mutex_init(&server.lock, NULL);
+    for (i = 0; i < count; i++)
+        if (pthread_create(&threads[i], NULL, ServerThread, &server))
+            ExitPrg("Can't start server thread!");
+    for (i = 0; i < count; i++)
+        pthread_join(threads[i], NULL);
+    pthread_mutex_destroy(&server.lock);
+    myfree(threads);
+#else
+    ServerThread(&server);
+#endif
+
+    close(server.socket);
+    unlink(name);
+    serverSocket = -1;
+    while ((context = server.contexts)) {
+        server.contexts = context->next;
+        IraFree(context->ira);
+        myfree(context->options);
+        myfree(context);
+    }
+    IraSetOutput(ira, msgFile, errFile);
+    fclose(server.nullFile);
+    fprintf(ira->files.msgFile, "Server stopped.\n");
+}
+
+#else
+
+void RunServer(ira_t *ira) {
+    ExitPrg("-SERVE needs Unix domain sockets, not available here.");
+}
+
+#endif
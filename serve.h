@@ -0,0 +1,15 @@
+/*
+ * serve.h
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : serve.h
+ *      Purpose  : Headers about -SERVE
+ */
+
+#ifndef SERVE_H_
+#define SERVE_H_
+
+void RunServer(ira_t *);
+
+#endif /* SERVE_H_ */
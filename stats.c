@@ -0,0 +1,176 @@
+/*
+ * stats.c
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : stats.c
+ *      Purpose  : -STATS, times and counters of a run
+ *
+ * StatsStart() and StatsStop() go around each phase and do nothing
+ * without -STATS. CPU time is that of the whole process, so it includes
+ * the Pass 2 threads and, with -BATCH -JOBS, the other sources. Built
+ * with IRA_MEMSTATS, the allocations counted by supp.c follow; they are
+ * those of the whole process as well.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define IRA_RUSAGE
+#endif
+
+#include "ira.h"
+
+#include "stats.h"
+#include "supp.h"
+
+static const char *phaseNames[STATS_PHASES] = {"load", "romtag", "pass0", "pass1", "labels", "text", "render"};
+#ifdef IRA_MEMSTATS
+static const char *tagNames[MEM_TAGS] = {"relocs", "labels", "xrefs", "code_areas", "symbols", "config", "other"};
+#endif
+
+static void Now(double *wall, double *cpu) {
+#ifdef CLOCK_MONOTONIC
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    *wall = now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#else
+    *wall = time(NULL) * 1000.0;
+#endif
+    *cpu = clock() * 1000.0 / CLOCKS_PER_SEC;
+}
+
+/* Peak resident set of the process in KB, 0 if unknown */
+static unsigned long PeakRSS(void) {
+#ifdef IRA_RUSAGE
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage))
+        return 0;
+#ifdef __APPLE__
+    return (unsigned long) usage.ru_maxrss / 1024;
+#else
+    return (unsigned long) usage.ru_maxrss;
+#endif
+#else
+    return 0;
+#endif
+}
+
+/* Bytes of target output, including those still in the buffer */
+static uint64_t Written(ira_t *ira) {
+    return (ira->files.written + ira->files.writer.len);
+}
+
+void StatsStart(ira_t *ira) {
+    Stats_t *stats;
+
+    if (!(ira->params.pFlags & STATS))
+        return;
+    if (!ira->stats)
+        ira->stats = mycalloc(sizeof(Stats_t));
+
+    stats = ira->stats;
+    Now(&stats->startWall, &stats->startCpu);
+    stats->startDecoded = ira->decoded;
+    stats->startWritten = Written(ira);
+}
+
+void StatsStop(ira_t *ira, int phase) {
+    Stats_t *stats = ira->stats;
+    double wall, cpu;
+
+    if (!stats)
+        return;
+
+    Now(&wall, &cpu);
+    stats->wall[phase] += wall - stats->startWall;
+    stats->cpu[phase] += cpu - stats->startCpu;
+    stats->decoded[phase] += ira->decoded - stats->startDecoded;
+    stats->written[phase] += Written(ira) - stats->startWritten;
+}
+
+static void PrintStatsJSON(ira_t *ira, FILE *out) {
+    Stats_t *stats = ira->stats;
+    char *p;
+    int phase;
+#ifdef IRA_MEMSTATS
+    MemStats_t mem;
+    int tag;
+#endif
+
+    fprintf(out, "{\"source\": \"");
+    for (p = ira->filenames.sourceName; *p; p++)
+        if (*p == '"' || *p == '\\')
+            fprintf(out, "\\%c", *p);
+        else if ((unsigned char) *p < ' ')
+            fprintf(out, "\\u%04x", (unsigned) *p);
+        else
+            fputc(*p, out);
+    fprintf(out, "\", \"cache_hit\": %s, \"phases\": {", ira->cacheHit ? "true" : "false");
+    for (phase = 0; phase < STATS_PHASES; phase++)
+        fprintf(out, "%s\"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f, \"instructions\": %llu, \"bytes\": %llu}", phase ? ", " : "",
+                phaseNames[phase], stats->wall[phase], stats->cpu[phase], (unsigned long long) stats->decoded[phase],
+                (unsigned long long) stats->written[phase]);
+    fprintf(out, "}, \"instructions\": %llu, \"relocations\": %lu, \"labels\": %lu, \"xrefs\": %lu, \"symbols\": %lu, \"code_areas\": %lu, \"bytes\": %llu, ",
+            (unsigned long long) ira->decoded, (unsigned long) ira->relocount, (unsigned long) ira->labcount, (unsigned long) ira->XRefCount,
+            (unsigned long) ira->symbols.symbolCount, (unsigned long) ira->codeArea.codeAreas, (unsigned long long) Written(ira));
+#ifdef IRA_MEMSTATS
+    GetMemStats(&mem);
+    fprintf(out, "\"memory\": {");
+    for (tag = 0; tag < MEM_TAGS; tag++)
+        fprintf(out, "\"%s\": {\"allocs\": %llu, \"bytes\": %llu, \"live\": %llu, \"peak\": %llu}, ", tagNames[tag],
+                (unsigned long long) mem.allocs[tag], (unsigned long long) mem.bytes[tag], (unsigned long long) mem.live[tag],
+                (unsigned long long) mem.peak[tag]);
+    fprintf(out, "\"peak_heap\": %llu}, ", (unsigned long long) mem.peakHeap);
+#endif
+    fprintf(out, "\"peak_rss_kb\": %lu}\n", PeakRSS());
+}
+
+void PrintStats(ira_t *ira) {
+    Stats_t *stats = ira->stats;
+    FILE *out = ira->files.msgFile;
+    double wall = 0, cpu = 0;
+    int phase;
+#ifdef IRA_MEMSTATS
+    MemStats_t mem;
+    int tag;
+#endif
+
+    if (!stats)
+        return;
+    if (ira->params.pFlags & STATS_JSON) {
+        PrintStatsJSON(ira, out);
+        return;
+    }
+
+    fprintf(out, "STATS  : %s%s\n", ira->filenames.sourceName, ira->cacheHit ? " (cache hit)" : "");
+    fprintf(out, "  phase       wall ms      CPU ms  instructions         bytes\n");
+    for (phase = 0; phase < STATS_PHASES; phase++) {
+        fprintf(out, "  %-8s %10.3f  %10.3f  %12llu  %12llu\n", phaseNames[phase], stats->wall[phase], stats->cpu[phase],
+                (unsigned long long) stats->decoded[phase], (unsigned long long) stats->written[phase]);
+        wall += stats->wall[phase];
+        cpu += stats->cpu[phase];
+    }
+    fprintf(out, "  %-8s %10.3f  %10.3f  %12llu  %12llu\n", "total", wall, cpu, (unsigned long long) ira->decoded,
+            (unsigned long long) Written(ira));
+    fprintf(out, "  relocations %lu, labels %lu, xrefs %lu, symbols %lu, code areas %lu\n", (unsigned long) ira->relocount,
+            (unsigned long) ira->labcount, (unsigned long) ira->XRefCount, (unsigned long) ira->symbols.symbolCount,
+            (unsigned long) ira->codeArea.codeAreas);
+#ifdef IRA_MEMSTATS
+    GetMemStats(&mem);
+    fprintf(out, "  memory          allocs         bytes          live          peak\n");
+    for (tag = 0; tag < MEM_TAGS; tag++)
+        fprintf(out, "  %-10s %10llu  %12llu  %12llu  %12llu\n", tagNames[tag], (unsigned long long) mem.allocs[tag],
+                (unsigned long long) mem.bytes[tag], (unsigned long long) mem.live[tag], (unsigned long long) mem.peak[tag]);
+    fprintf(out, "  peak heap %llu bytes\n", (unsigned long long) mem.peakHeap);
+#endif
+    fprintf(out, "  peak RSS %lu KB\n", PeakRSS());
+}
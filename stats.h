@@ -0,0 +1,17 @@
+/*
+ * stats.h
+ *
+ *  Created on: 17 october 2026
+ *      Project  : IRA  -  680x0 Interactive ReAssembler
+ *      Part     : stats.h
+ *      Purpose  : Headers about -STATS
+ */
+
+#ifndef STATS_H_
+#define STATS_H_
+
+void PrintStats(ira_t *);
+void StatsStart(ira_t *);
+void StatsStop(ira_t *, int);
+
+#endif /* STATS_H_ */
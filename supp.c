@@ -17,20 +17,103 @@
 
 #include "ira.h"
 
-extern ira_t *ira;
+extern IRA_TLS ira_t *ira;
+
+#ifdef IRA_MEMSTATS
+
+/* Every block starts with its size and tag, so that myrealloc() and
+ * myfree() can take it off the live bytes. */
+typedef union BlockHeader_u {
+    struct {
+        size_t size;
+        int tag;
+    } block;
+    long double align;
+    void *pointer;
+} BlockHeader_t;
+
+static MemStats_t memStats;
+#ifdef IRA_THREADS
+static pthread_mutex_t memLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Live bytes of tag change from oldSize to newSize */
+static void CountBlock(int tag, size_t oldSize, size_t newSize) {
+#ifdef IRA_THREADS
+    pthread_mutex_lock(&memLock);
+#endif
+    if (newSize) {
+        memStats.allocs[tag]++;
+        memStats.bytes[tag] += newSize;
+    }
+    memStats.live[tag] = memStats.live[tag] - oldSize + newSize;
+    memStats.heap = memStats.heap - oldSize + newSize;
+    if (memStats.live[tag] > memStats.peak[tag])
+        memStats.peak[tag] = memStats.live[tag];
+    if (memStats.heap > memStats.peakHeap)
+        memStats.peakHeap = memStats.heap;
+#ifdef IRA_THREADS
+    pthread_mutex_unlock(&memLock);
+#endif
+}
 
-void *myalloc(size_t sz) {
-    void *p = NULL;
+void GetMemStats(MemStats_t *stats) {
+#ifdef IRA_THREADS
+    pthread_mutex_lock(&memLock);
+#endif
+    *stats = memStats;
+#ifdef IRA_THREADS
+    pthread_mutex_unlock(&memLock);
+#endif
+}
 
-    if (sz && (p = malloc(sz)) == NULL)
+void *mytalloc(size_t sz, int tag) {
+    BlockHeader_t *p;
+
+    if (!sz)
+        return NULL;
+    if ((p = malloc(sizeof(BlockHeader_t) + sz)) == NULL)
         ExitPrg("Out of memory (allocating %u bytes)!", (unsigned) sz);
-    return p;
+    p->block.size = sz;
+    p->block.tag = tag;
+    CountBlock(tag, 0, sz);
+    return (p + 1);
 }
 
-void *mycalloc(size_t sz) {
-    void *p = myalloc(sz);
+void *myrealloc(void *p, size_t sz) {
+    BlockHeader_t *q = p ? (BlockHeader_t *) p - 1 : NULL;
+    size_t oldSize = q ? q->block.size : 0;
+    int tag = q ? q->block.tag : MEM_OTHER;
 
-    memset(p, 0, sz);
+    if ((q = realloc(q, sizeof(BlockHeader_t) + sz)) == NULL)
+        ExitPrg("Out of memory (reallocating %u bytes)!", (unsigned) sz);
+    q->block.size = sz;
+    q->block.tag = tag;
+    CountBlock(tag, oldSize, sz);
+    return (q + 1);
+}
+
+void myfree(void *p) {
+    BlockHeader_t *q;
+
+    if (p) {
+        q = (BlockHeader_t *) p - 1;
+        CountBlock(q->block.tag, q->block.size, 0);
+        free(q);
+    }
+}
+
+#else
+
+void GetMemStats(MemStats_t *stats) {
+    memset(stats, 0, sizeof(MemStats_t));
+}
+
+void *mytalloc(size_t sz, int tag) {
+    void *p = NULL;
+
+    if (sz && (p = malloc(sz)) == NULL)
+        ExitPrg("Out of memory (allocating %u bytes)!", (unsigned) sz);
     return p;
 }
 
@@ -42,66 +125,83 @@ void *myrealloc(void *p, size_t sz) {
     return q;
 }
 
-char *itoa(int32_t integer) {
-    static char buf[16];
+void myfree(void *p) {
+    free(p);
+}
+
+#endif
 
-    sprintf(buf, "%ld", (long) integer);
-    return buf;
+void *mytcalloc(size_t sz, int tag) {
+    void *p = mytalloc(sz, tag);
+
+    memset(p, 0, sz);
+    return p;
 }
 
-char *itohex(uint32_t integer, uint8_t len) {
-    static char buf[16];
-    static char fmtbuf[] = "%04.4lx";
+void *myalloc(size_t sz) {
+    return mytalloc(sz, MEM_OTHER);
+}
 
-    fmtbuf[2] = len + '0';
-    fmtbuf[4] = len + '0';
-    sprintf(buf, fmtbuf, integer);
-    return buf;
+void *mycalloc(size_t sz) {
+    return mytcalloc(sz, MEM_OTHER);
 }
 
-void mnecat(const char *buf) {
-    static unsigned long cnt;
-    char *dst;
-    unsigned char c;
+static const char hexdigits[] = "0123456789abcdef";
 
-    dst = &ira->mnebuf[ira->mnebuf[0] ? cnt : 0];
+char *itoa(int32_t integer) {
+    static IRA_TLS char buf[16];
+    char *p = &buf[sizeof(buf) - 1];
+    uint32_t u = integer < 0 ? 0 - (uint32_t) integer : (uint32_t) integer;
 
+    *p = '\0';
     do {
-        c = *buf++;
-        *dst++ = c;
-    } while (c);
+        *--p = '0' + u % 10;
+        u /= 10;
+    } while (u);
+    if (integer < 0)
+        *--p = '-';
+    return p;
+}
 
-    cnt = dst - &ira->mnebuf[0] - 1;
+/* Same as "%0*.*lx": at least len digits, more when needed */
+char *itohex(uint32_t integer, uint32_t len) {
+    static IRA_TLS char buf[16];
+    char *p = &buf[sizeof(buf) - 1];
+
+    *p = '\0';
+    while (integer || len) {
+        *--p = hexdigits[integer & 15];
+        integer >>= 4;
+        if (len)
+            len--;
+    }
+    return p;
 }
 
-void dtacat(const char *buf) {
-    static unsigned long cnt;
-    char *dst;
+/* The line buffers are reset by clearing their first byte, so the
+ * lengths are only valid while that byte is set. */
+static uint32_t bufcat(char *dst, uint32_t cnt, const char *buf) {
+    char *p = &dst[dst[0] ? cnt : 0];
     unsigned char c;
 
-    dst = &ira->dtabuf[ira->dtabuf[0] ? cnt : 0];
-
     do {
         c = *buf++;
-        *dst++ = c;
+        *p++ = c;
     } while (c);
 
-    cnt = dst - &ira->dtabuf[0] - 1;
+    return p - dst - 1;
 }
 
-void adrcat(const char *buf) {
-    static unsigned long cnt;
-    char *dst;
-    unsigned char c;
-
-    dst = &ira->adrbuf[ira->adrbuf[0] ? cnt : 0];
+void mnecat(const char *buf) {
+    ira->mnecnt = bufcat(ira->mnebuf, ira->mnecnt, buf);
+}
 
-    do {
-        c = *buf++;
-        *dst++ = c;
-    } while (c);
+void dtacat(const char *buf) {
+    ira->dtacnt = bufcat(ira->dtabuf, ira->dtacnt, buf);
+}
 
-    cnt = dst - &ira->adrbuf[0] - 1;
+void adrcat(const char *buf) {
+    ira->adrcnt = bufcat(ira->adrbuf, ira->adrcnt, buf);
 }
 
 char *argopt(int argc, char **argv, int *nextarg, char *option) {
@@ -18,13 +18,17 @@ uint16_t be16(void *);
 uint32_t be32(void *);
 void delfile(const char *);
 void dtacat(const char *);
+void GetMemStats(MemStats_t *);
 char *itoa(int32_t);
 char *itohex(uint32_t, uint32_t);
 void mnecat(const char *);
 void *myalloc(size_t);
 void *mycalloc(size_t);
+void myfree(void *);
 void *myrealloc(void *, size_t);
 char *mystrdup(char *);
+void *mytalloc(size_t, int);
+void *mytcalloc(size_t, int);
 uint32_t readbe32(FILE *);
 int stccpy(char *, const char *, size_t);
 int32_t stcd_base(const char *, int);
@@ -0,0 +1,1894 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+; Custom equates (from config file)
+value_1	EQU	57382
+value_9	EQU	6761
+quick_17	EQU	7
+quick_25	EQU	4
+value_33	EQU	15534
+quick_41	EQU	6
+quick_49	EQU	3
+quick_57	EQU	7
+
+
+
+
+	ORG	$0
+
+SECSTRT_0:
+; call site 0
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0000: 48e73f3e
+LAB_0000:
+	BSR.W	LAB_0009		;0004: 61000046
+	TST.L	D0			;0008: 4a80
+LAB_0001:
+	LEA	LAB_0067,A4		;000a: 49f900000414
+	DBF	D4,LAB_0001		;0010: 51ccfff8
+; ------------------------------------------------------------------------------
+; function 301
+; ------------------------------------------------------------------------------
+LAB_0002:
+	MOVE.W	13253(A5),14562(A5)	;0014: 3b6d33c538e2
+	DBF	D3,LAB_0002		;001a: 51cbfff8
+LAB_0003:
+	MOVEQ	#14,D5			;001e: 7a0e
+LAB_0004:
+	MOVE.W	17172(A5),18322(A5)	;0020: 3b6d43144792
+	DBF	D5,LAB_0004		;0026: 51cdfff8
+	BNE.S	LAB_0003		;002a: 66f2
+	BNE.S	LAB_0004		;002c: 66f2
+func_0_14:
+	CMP.L	#value_1,D4		;002e: b8bc0000e026
+	DBF	D6,func_0_14		;0034: 51cefff8
+	BNE.S	func_0_14		;0038: 66f4
+	LEA	LAB_0002(PC),A6		;003a: 4dfaffd8
+LAB_0006:
+	CMPI.L	#$00000018,D6		;003e: 0c8600000018
+; call site 315
+	BNE.S	LAB_0006		;0044: 66f8
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0046: 4cdf7cfc
+LAB_0008:
+	RTS				;004a: 4e75
+LAB_0009:
+	BSR.W	func_0_329		;004c: 61000024
+	MOVE.W	633(A5),27965(A5)	;0050: 3b6d02796d3d
+LAB_000A:
+	BRA.S	LAB_000B		;0056: 600a
+	DC.W	$2573			;0058
+	MOVE.W	-(A0),D5		;005a: 3a20
+	MOVE.L	25610(A4),0(A2)		;005c: 256c640a0000
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_000B:
+	LEA	LAB_00E7+4,A0		;0062: 41f900000a98
+LAB_000C:
+	BNE.S	LAB_000A		;0068: 66ec
+	DBF	D6,LAB_000C		;006a: 51cefffc
+	MOVEQ	#23,D4			;006e: 7817
+	RTS				;0070: 4e75
+func_0_329:
+	BSR.W	LAB_001F		;0072: 610000a0
+	MOVEQ	#-30,D4			;0076: 78e2
+LAB_000E:
+	CMP.L	#$0000760d,D4		;0078: b8bc0000760d
+LAB_000F:
+	DBF	D1,LAB_000E		;007e: 51c9fff8
+	LEA	LAB_000F+2(PC),A0	;0082: 41fafffc
+	BSR.W	LAB_0023		;0086: 610000a4
+LAB_0010:
+; call site 42
+	MOVE.W	25258(A5),16623(A5)	;008a: 3b6d62aa40ef
+LAB_0011:
+	ADDQ.L	#5,A0			;0090: 5a88
+	DBF	D0,LAB_0011		;0092: 51c8fffc
+LAB_0012:
+	BSR.W	LAB_0023		;0096: 61000094
+LAB_0013:
+	BNE.S	LAB_0012		;009a: 66fa
+; ------------------------------------------------------------------------------
+; function 343
+; ------------------------------------------------------------------------------
+LAB_0014:
+	JSR	-78(A6)			;009c: 4eaeffb2
+	BNE.S	LAB_0013		;00a0: 66f8
+	JSR	LAB_002B		;00a2: 4eb9000001a0
+	BNE.S	LAB_0014		;00a8: 66f2
+LAB_0015:
+	BRA.S	LAB_0016		;00aa: 600a
+	SUBQ.W	#3,29291(A7)		;00ac: 576f726b
+	DC.W	$6265			;00b0
+	DC.W	$6e63			;00b2
+	DC.W	$6800			;00b4
+LAB_0016:
+	DBF	D4,LAB_0015		;00b6: 51ccfff2
+	DBF	D5,LAB_0016		;00ba: 51cdfffa
+func_0_56:
+	BSR.W	LAB_001F		;00be: 61000054
+LAB_0018:
+	LEA	LAB_0000+2(PC),A6	;00c2: 4dfaff42
+	DBF	D2,LAB_0018		;00c6: 51cafffa
+LAB_0019:
+	BSR.W	LAB_002B		;00ca: 610000d4
+	BNE.S	LAB_0019		;00ce: 66fa
+LAB_001A:
+; call site 357
+	MOVE.L	15380(A5),D7		;00d0: 2e2d3c14
+	MOVE.L	5278(A5),D2		;00d4: 242d149e
+	CMPI.L	#$000000a6,D1		;00d8: 0c81000000a6
+LAB_001B:
+	BSR.W	LAB_0023		;00de: 6100004c
+LAB_001C:
+	DBF	D6,LAB_001B		;00e2: 51cefffa
+	LEA	LAB_0014(PC),A6		;00e6: 4dfaffb4
+	BNE.S	LAB_001C		;00ea: 66f6
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+	JSR	-264(A6)		;00ec: 4eaefef8
+	BRA.S	LAB_001D		;00f0: 6012
+	BEQ.S	LAB_0028		;00f2: 6772
+	BSR.S	LAB_0028		;00f4: 6170
+	DC.W	$6869			;00f6
+	DC.W	$6373			;00f8
+	MOVEA.L	26978(A4),A7		;00fa: 2e6c6962
+	MOVEQ	#97,D1			;00fe: 7261
+	MOVEQ	#121,D1			;0100: 7279
+	DC.W	$0000			;0102
+LAB_001D:
+	MOVE.L	31186(A5),D5		;0104: 2a2d79d2
+	BSR.W	LAB_002B		;0108: 61000096
+	BNE.S	LAB_001D		;010c: 66f6
+func_0_371:
+	JSR	-528(A6)		;010e: 4eaefdf0
+	RTS				;0112: 4e75
+LAB_001F:
+	BSR.W	LAB_0023		;0114: 61000016
+LAB_0020:
+	MOVE.L	D7,D5			;0118: 2a07
+	MOVEQ	#-11,D5			;011a: 7af5
+LAB_0021:
+	BNE.S	LAB_001F		;011c: 66f6
+; call site 84
+	BNE.S	LAB_0020		;011e: 66f8
+LAB_0022:
+	CMP.L	#$00000723,D0		;0120: b0bc00000723
+	DBF	D5,LAB_0022		;0126: 51cdfff8
+	RTS				;012a: 4e75
+LAB_0023:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;012c: 48e73f3e
+; ------------------------------------------------------------------------------
+; function 385
+; ------------------------------------------------------------------------------
+LAB_0024:
+	BSR.W	LAB_002B		;0130: 6100006e
+	MOVEQ	#27,D6			;0134: 7c1b
+	LEA	LAB_0008,A0		;0136: 41f90000004a
+LAB_0025:
+	CMP.L	#$0000af78,D5		;013c: babc0000af78
+	MOVE.L	14638(A5),D3		;0142: 262d392e
+	BNE.S	LAB_0025		;0146: 66f4
+	ADD.L	D4,D6			;0148: dc84
+func_0_98:
+	ADDQ.L	#7,A6			;014a: 5e8e
+	BSR.W	LAB_0035		;014c: 610000e2
+LAB_0027:
+	LEA	LAB_00C7,A2		;0150: 45f900000806
+	MOVE.L	7262(A5),D2		;0156: 242d1c5e
+	MOVE.L	D2,D0			;015a: 2002
+; call site 399
+	BNE.S	LAB_0027		;015c: 66f2
+	MOVE.L	5250(A5),D2		;015e: 242d1482
+	BSR.W	LAB_002B		;0162: 6100003c
+LAB_0028:
+	BRA.S	LAB_002A		;0166: 6008
+LAB_0029:
+	DC.W	$4572			;0168
+	MOVEQ	#111,D1			;016a: 726f
+	MOVEQ	#58,D1			;016c: 723a
+	MOVE.L	D0,D0			;016e: 2000
+LAB_002A:
+	CMPI.L	#$000000dc,D2		;0170: 0c82000000dc
+	MOVEQ	#-118,D4		;0176: 788a
+	MOVEQ	#80,D7			;0178: 7e50
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	MOVE.W	31649(A5),12310(A5)	;017a: 3b6d7ba13016
+	CMP.L	#$0000c18d,D1		;0180: b2bc0000c18d
+	BSR.W	LAB_002B		;0186: 61000018
+	CMPI.L	#$000000ea,D5		;018a: 0c85000000ea
+	MOVE.W	70(A5),5574(A5)		;0190: 3b6d004615c6
+	BSR.W	LAB_0040		;0196: 610000fc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;019a: 4cdf7cfc
+	RTS				;019e: 4e75
+LAB_002B:
+	BSR.W	LAB_0035		;01a0: 6100008e
+LAB_002C:
+	LEA	LAB_001A+2(PC),A0	;01a4: 41faff2c
+	DBF	D0,LAB_002C		;01a8: 51c8fffa
+; call site 126
+	ADD.L	D1,D5			;01ac: da81
+	ADD.L	D4,D6			;01ae: dc84
+	BSR.W	LAB_0043		;01b0: 61000108
+LAB_002D:
+	CMP.L	#$00003568,D3		;01b4: b6bc00003568
+	BNE.S	LAB_002D		;01ba: 66f8
+	ADD.L	D2,D1			;01bc: d282
+LAB_002E:
+	CMPI.L	#$00000076,D5		;01be: 0c8500000076
+LAB_002F:
+	DBF	D2,LAB_002E		;01c4: 51cafff8
+	DBF	D2,LAB_002F		;01c8: 51cafffa
+	MOVEQ	#-113,D2		;01cc: 748f
+	MOVE.L	#$00000c5a,-(A7)	;01ce: 2f3c00000c5a
+	MOVE.W	23438(A5),26553(A5)	;01d4: 3b6d5b8e67b9
+func_0_140:
+	ADD.L	D2,D6			;01da: dc82
+LAB_0031:
+	MOVE.W	3052(A5),24827(A5)	;01dc: 3b6d0bec60fb
+	DBF	D2,LAB_0031		;01e2: 51cafff8
+	CMP.L	#value_9,D0		;01e6: b0bc00001a69
+	BSR.W	LAB_0035		;01ec: 61000042
+	MOVE.W	25728(A5),26953(A5)	;01f0: 3b6d64806949
+LAB_0032:
+	JSR	-48(A6)			;01f6: 4eaeffd0
+	BSR.W	LAB_0035		;01fa: 61000034
+	BSR.W	LAB_0043		;01fe: 610000ba
+	BNE.S	LAB_0032		;0202: 66f2
+	BSR.W	LAB_0035		;0204: 6100002a
+	ADD.L	D5,D0			;0208: d085
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+	CMPI.L	#$00000077,D3		;020a: 0c8300000077
+LAB_0033:
+	MOVE.W	30793(A5),29177(A5)	;0210: 3b6d784971f9
+	MOVE.L	D1,D3			;0216: 2601
+LAB_0034:
+	BSR.W	LAB_0040		;0218: 6100007a
+	BNE.S	LAB_0033		;021c: 66f2
+	BNE.S	LAB_0034		;021e: 66f8
+	BSR.W	LAB_0035		;0220: 6100000e
+	CMP.L	#$0000a57c,D0		;0224: b0bc0000a57c
+	BSR.W	LAB_0043		;022a: 6100008e
+	RTS				;022e: 4e75
+LAB_0035:
+	BSR.W	LAB_0040		;0230: 61000062
+LAB_0036:
+; call site 168
+	MOVE.L	#$00000a94,-(A7)	;0234: 2f3c00000a94
+	MOVE.W	19855(A5),2004(A5)	;023a: 3b6d4d8f07d4
+	MOVEQ	#52,D5			;0240: 7a34
+LAB_0037:
+	BNE.S	LAB_0036		;0242: 66f0
+	MOVEQ	#22,D5			;0244: 7a16
+	CMP.L	#$00007280,D2		;0246: b4bc00007280
+	BNE.S	LAB_0037		;024c: 66f4
+	BSR.W	LAB_0043		;024e: 6100006a
+LAB_0038:
+	BSR.W	LAB_0040		;0252: 61000040
+	BNE.S	LAB_0038		;0256: 66fa
+LAB_0039:
+	MOVE.W	19153(A5),4100(A5)	;0258: 3b6d4ad11004
+LAB_003A:
+	BNE.S	LAB_0039		;025e: 66f8
+func_0_182:
+	DBF	D7,LAB_003A		;0260: 51cffffc
+	MOVE.L	#$000011e8,-(A7)	;0264: 2f3c000011e8
+	CMP.L	#$00000281,D3		;026a: b6bc00000281
+LAB_003C:
+	JSR	-768(A6)		;0270: 4eaefd00
+	BNE.S	LAB_003C		;0274: 66fa
+LAB_003D:
+	JSR	-348(A6)		;0276: 4eaefea4
+	MOVE.L	9256(A5),D5		;027a: 2a2d2428
+LAB_003E:
+	BNE.S	LAB_003D		;027e: 66f6
+	BRA.S	LAB_003F		;0280: 6008
+	ADDQ.W	#1,-(A5)		;0282: 5265
+	BSR.S	LAB_0049+2		;0284: 6164
+	DC.W	$792e			;0286
+	DC.W	$0000			;0288
+LAB_003F:
+	BNE.S	LAB_003E		;028a: 66f2
+	BSR.W	LAB_0053		;028c: 610000d2
+	MOVE.L	D1,D3			;0290: 2601
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+	RTS				;0292: 4e75
+LAB_0040:
+	LINK.W	A5,#-52			;0294: 4e55ffcc
+	BSR.W	LAB_0043		;0298: 61000020
+LAB_0041:
+	TST.L	D4			;029c: 4a84
+	DBF	D7,LAB_0041		;029e: 51cffffc
+	JSR	LAB_0053		;02a2: 4eb900000360
+LAB_0042:
+	JSR	-576(A6)		;02a8: 4eaefdc0
+	DBF	D6,LAB_0042		;02ac: 51cefffa
+	MOVE.W	29065(A5),18730(A5)	;02b0: 3b6d7189492a
+	UNLK	A5			;02b6: 4e5d
+	RTS				;02b8: 4e75
+LAB_0043:
+; call site 210
+	BSR.W	LAB_0053		;02ba: 610000a4
+	MOVE.L	D0,D2			;02be: 2400
+	ADDQ.L	#7,A6			;02c0: 5e8e
+LAB_0044:
+	BSR.W	func_0_308		;02c2: 61000140
+	BNE.S	LAB_0044		;02c6: 66fa
+LAB_0045:
+	JSR	LAB_0053		;02c8: 4eb900000360
+	ADD.L	D7,D7			;02ce: de87
+	BSR.W	LAB_0053		;02d0: 6100008e
+LAB_0046:
+	LEA	LAB_0029(PC),A4		;02d4: 49fafe92
+	CMP.L	#$0000c694,D2		;02d8: b4bc0000c694
+LAB_0047:
+	BNE.S	LAB_0046		;02de: 66f4
+	JSR	LAB_005D		;02e0: 4eb9000003c2
+func_0_224:
+	BNE.S	LAB_0047		;02e6: 66f6
+LAB_0049:
+	DBF	D2,func_0_224		;02e8: 51cafffc
+	BRA.S	LAB_004A+2		;02ec: 600a
+	SUBQ.W	#3,29291(A7)		;02ee: 576f726b
+	DC.W	$6265			;02f2
+	DC.W	$6e63			;02f4
+LAB_004A:
+	BVC.W	LAB_0161		;02f6: 68000c86
+	ORI.B	#$3a,D0			;02fa: 0000003a
+LAB_004B:
+	MOVEQ	#-106,D0		;02fe: 7096
+	DBF	D7,LAB_004B		;0300: 51cffffc
+	BSR.W	LAB_0053		;0304: 6100005a
+	MOVE.L	#$00000896,-(A7)	;0308: 2f3c00000896
+LAB_004C:
+	LEA	LAB_005C,A4		;030e: 49f9000003a6
+LAB_004D:
+	DBF	D0,LAB_004C		;0314: 51c8fff8
+	MOVEQ	#122,D5			;0318: 7a7a
+LAB_004E:
+	JSR	-366(A6)		;031a: 4eaefe92
+; ------------------------------------------------------------------------------
+; function 238
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_004D		;031e: 66f4
+	BRA.S	LAB_004F		;0320: 6012
+	BEQ.S	LAB_005A		;0322: 6772
+	BSR.S	LAB_005A		;0324: 6170
+	DC.W	$6869			;0326
+	DC.W	$6373			;0328
+	MOVEA.L	26978(A4),A7		;032a: 2e6c6962
+	MOVEQ	#97,D1			;032e: 7261
+	MOVEQ	#121,D1			;0330: 7279
+	DC.W	$0000			;0332
+LAB_004F:
+	BNE.S	LAB_004E		;0334: 66e4
+	CMPI.L	#$0000005f,D5		;0336: 0c850000005f
+	BSR.W	func_0_308		;033c: 610000c6
+	LEA	LAB_00D3,A0		;0340: 41f900000972
+	ADDQ.L	#5,A6			;0346: 5a8e
+LAB_0050:
+	ADD.L	D6,D0			;0348: d086
+LAB_0051:
+	DBF	D2,LAB_0050		;034a: 51cafffc
+LAB_0052:
+	BNE.S	LAB_0051		;034e: 66fa
+	BSR.W	func_0_308		;0350: 610000b2
+	CMPI.L	#$00000006,D5		;0354: 0c8500000006
+; call site 252
+	BSR.W	func_0_308		;035a: 610000a8
+	RTS				;035e: 4e75
+LAB_0053:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0360: 48e73f3e
+	BSR.W	LAB_005D		;0364: 6100005c
+	JSR	-510(A6)		;0368: 4eaefe02
+LAB_0054:
+	MOVE.L	24924(A5),D0		;036c: 202d615c
+LAB_0055:
+	DBF	D7,LAB_0054		;0370: 51cffffa
+LAB_0056:
+	BSR.W	LAB_0071		;0374: 61000100
+	MOVE.L	#$000007be,-(A7)	;0378: 2f3c000007be
+	BSR.W	func_0_308		;037e: 61000084
+	BNE.S	LAB_0056		;0382: 66f0
+	BSR.W	LAB_0071		;0384: 610000f0
+func_0_266:
+	MOVE.L	D4,D6			;0388: 2c04
+	BNE.S	func_0_266		;038a: 66fc
+LAB_0058:
+	MOVEQ	#58,D0			;038c: 703a
+LAB_0059:
+	DBF	D0,LAB_0058		;038e: 51c8fffc
+	BNE.S	LAB_0059		;0392: 66fa
+	MOVE.L	D7,D5			;0394: 2a07
+LAB_005A:
+	MOVE.W	18667(A5),23994(A5)	;0396: 3b6d48eb5dba
+	ADDQ.L	#1,A6			;039c: 528e
+	JSR	-876(A6)		;039e: 4eaefc94
+LAB_005B:
+	ADDQ.L	#quick_17,A5		;03a2: 5e8d
+	ADD.L	D3,D4			;03a4: d883
+LAB_005C:
+	MOVE.L	#$0000097c,-(A7)	;03a6: 2f3c0000097c
+; ------------------------------------------------------------------------------
+; function 280
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_0071		;03ac: 610000c8
+	ADDQ.L	#2,A0			;03b0: 5488
+	LEA	LAB_0045+2(PC),A0	;03b2: 41faff16
+	CMPI.L	#$000000f4,D6		;03b6: 0c86000000f4
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;03bc: 4cdf7cfc
+	RTS				;03c0: 4e75
+LAB_005D:
+	BSR.W	func_0_308		;03c2: 61000040
+LAB_005E:
+	BRA.S	LAB_005F		;03c6: 600a
+	SUBQ.W	#3,29291(A7)		;03c8: 576f726b
+	DC.W	$6265			;03cc
+	DC.W	$6e63			;03ce
+	DC.W	$6800			;03d0
+LAB_005F:
+	DBF	D1,LAB_005E		;03d2: 51c9fff2
+	MOVE.L	#$00000824,-(A7)	;03d6: 2f3c00000824
+	ADDQ.L	#7,A5			;03dc: 5e8d
+; call site 294
+	JSR	-306(A6)		;03de: 4eaefece
+LAB_0060:
+	ADD.L	D0,D3			;03e2: d680
+	DBF	D1,LAB_0060		;03e4: 51c9fffc
+	JSR	-78(A6)			;03e8: 4eaeffb2
+	BSR.W	LAB_0083		;03ec: 61000118
+	JSR	-366(A6)		;03f0: 4eaefe92
+LAB_0061:
+	ADD.L	D1,D6			;03f4: dc81
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+LAB_0062:
+	BSR.W	LAB_0071		;03f6: 6100007e
+LAB_0063:
+	BNE.S	LAB_0061		;03fa: 66f8
+LAB_0064:
+	BNE.S	LAB_0063		;03fc: 66fc
+	DBF	D3,LAB_0064		;03fe: 51cbfffc
+	RTS				;0402: 4e75
+func_0_308:
+	BSR.W	LAB_0071		;0404: 61000070
+	TST.L	D6			;0408: 4a86
+	MOVE.L	29526(A5),D5		;040a: 2a2d7356
+	BNE.S	func_0_308		;040e: 66f4
+LAB_0066:
+	BRA.S	LAB_0068		;0410: 6012
+	BVS.S	LAB_0073		;0412: 696e
+LAB_0067:
+	MOVEQ	#117,D2			;0414: 7475
+	BVS.S	LAB_0074		;0416: 6974
+	DC.W	$696f			;0418
+	BGT.S	LAB_006C		;041a: 6e2e
+	DC.W	$6c69			;041c
+	BHI.S	LAB_0075		;041e: 6272
+	BSR.S	LAB_0076		;0420: 6172
+	DC.W	$7900			;0422
+LAB_0068:
+	JSR	-510(A6)		;0424: 4eaefe02
+; call site 21
+	BNE.S	LAB_0066		;0428: 66e6
+	LEA	LAB_0157,A6		;042a: 4df900000efe
+	MOVE.L	D2,D0			;0430: 2002
+	ADD.L	D5,D4			;0432: d885
+LAB_0069:
+	BSR.W	LAB_0071		;0434: 61000040
+; ------------------------------------------------------------------------------
+; function 322
+; ------------------------------------------------------------------------------
+	DBF	D7,LAB_0069		;0438: 51cffffa
+LAB_006A:
+	MOVE.W	2599(A5),13043(A5)	;043c: 3b6d0a2732f3
+LAB_006B:
+	LEA	LAB_0021(PC),A6		;0442: 4dfafcd8
+	DBF	D2,LAB_006B		;0446: 51cafffa
+LAB_006C:
+	BNE.S	LAB_006A		;044a: 66f0
+	ADD.L	D1,D0			;044c: d081
+LAB_006D:
+	LEA	LAB_004F(PC),A6		;044e: 4dfafee4
+func_0_35:
+	DBF	D6,LAB_006D		;0452: 51cefffa
+	MOVEQ	#82,D0			;0456: 7052
+	BNE.S	LAB_006D		;0458: 66f4
+	BSR.W	LAB_0086		;045a: 610000c8
+	MOVE.L	22786(A5),D4		;045e: 282d5902
+; call site 336
+	LEA	LAB_0024,A0		;0462: 41f900000130
+LAB_006F:
+	MOVE.W	21803(A5),32577(A5)	;0468: 3b6d552b7f41
+LAB_0070:
+	BNE.S	LAB_006F		;046e: 66f8
+	DBF	D1,LAB_0070		;0470: 51c9fffc
+	RTS				;0474: 4e75
+LAB_0071:
+	BSR.W	LAB_0083		;0476: 6100008e
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	TST.L	D1			;047a: 4a81
+	LEA	LAB_0055(PC),A4		;047c: 49fafef2
+LAB_0072:
+	MOVEQ	#41,D2			;0480: 7429
+LAB_0073:
+	MOVE.L	17520(A5),D2		;0482: 242d4470
+	BRA.S	func_0_350		;0486: 600e
+	DC.W	$4f75			;0488
+	MOVEQ	#32,D2			;048a: 7420
+LAB_0074:
+	BLE.S	LAB_0080+2		;048c: 6f66
+	MOVEA.L	25965(A5),A0		;048e: 206d656d
+LAB_0075:
+	BLE.S	LAB_0083		;0492: 6f72
+LAB_0076:
+	DC.W	$7900			;0494
+func_0_350:
+	BNE.S	LAB_0072		;0496: 66e8
+	BSR.W	LAB_008F		;0498: 610000e4
+	MOVE.L	25500(A5),D6		;049c: 2c2d639c
+	ADD.L	D4,D0			;04a0: d084
+	MOVE.L	17722(A5),D1		;04a2: 222d453a
+	ADD.L	D7,D1			;04a6: d287
+	ADD.L	D4,D4			;04a8: d884
+; call site 63
+	BSR.W	LAB_0086		;04aa: 61000078
+	JSR	LAB_008F		;04ae: 4eb90000057e
+	MOVE.W	18200(A5),8342(A5)	;04b4: 3b6d47182096
+LAB_0078:
+	MOVEQ	#17,D1			;04ba: 7211
+LAB_0079:
+	ADDQ.L	#1,A3			;04bc: 528b
+; ------------------------------------------------------------------------------
+; function 364
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_0079		;04be: 66fc
+	BNE.S	LAB_0078		;04c0: 66f8
+	BNE.S	LAB_0079		;04c2: 66f8
+	BSR.W	LAB_0086		;04c4: 6100005e
+LAB_007A:
+	JSR	-726(A6)		;04c8: 4eaefd2a
+LAB_007B:
+	BNE.S	LAB_007A		;04cc: 66fa
+LAB_007C:
+	DBF	D5,LAB_007B		;04ce: 51cdfffc
+func_0_77:
+	BNE.S	LAB_007B		;04d2: 66f8
+LAB_007E:
+	BNE.S	LAB_007C		;04d4: 66f8
+	BRA.S	LAB_007F		;04d6: 600e
+	DC.W	$4f75			;04d8
+	MOVEQ	#32,D2			;04da: 7420
+	BLE.S	LAB_008B		;04dc: 6f66
+	MOVEA.L	25965(A5),A0		;04de: 206d656d
+	BLE.S	LAB_008C+2		;04e2: 6f72
+	DC.W	$7900			;04e4
+LAB_007F:
+	LEA	LAB_016F,A6		;04e6: 4df900001028
+	BNE.S	LAB_007E		;04ec: 66e6
+; call site 378
+	BSR.W	LAB_008F		;04ee: 6100008e
+LAB_0080:
+	LEA	LAB_00D1,A2		;04f2: 45f900000934
+LAB_0082:
+	DBF	D5,LAB_0080		;04f8: 51cdfff8
+	JSR	-342(A6)		;04fc: 4eaefeaa
+	BNE.S	LAB_0082		;0500: 66f6
+	MOVEQ	#42,D2			;0502: 742a
+	RTS				;0504: 4e75
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+LAB_0083:
+	BSR.W	LAB_0086		;0506: 6100001c
+	DBF	D2,LAB_0083		;050a: 51cafffa
+	LEA	LAB_00CD,A0		;050e: 41f9000008ce
+	BNE.S	LAB_0083		;0514: 66f0
+func_0_392:
+	MOVE.W	9078(A5),1968(A5)	;0516: 3b6d237607b0
+LAB_0085:
+	BSR.W	LAB_0086		;051c: 61000006
+	BNE.S	LAB_0085		;0520: 66fa
+	RTS				;0522: 4e75
+LAB_0086:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0524: 48e73f3e
+LAB_0088:
+	BSR.W	LAB_008F		;0528: 61000054
+LAB_0089:
+	DBF	D6,LAB_0088		;052c: 51cefffa
+LAB_008A:
+; call site 105
+	DBF	D2,LAB_0089		;0530: 51cafffa
+	BSR.W	LAB_00A5		;0534: 61000128
+	BNE.S	LAB_0089		;0538: 66f2
+	BNE.S	LAB_008A		;053a: 66f4
+	CMPI.L	#$0000005f,D2		;053c: 0c820000005f
+	ADDQ.L	#7,A4			;0542: 5e8c
+LAB_008B:
+	ADD.L	D6,D0			;0544: d086
+	BRA.S	LAB_008C		;0546: 600c
+	MOVEQ	#111,D2			;0548: 746f
+	MOVEQ	#97,D0			;054a: 7061
+	MOVEQ	#46,D5			;054c: 7a2e
+	DC.W	$666f			;054e
+	BGT.S	LAB_0096		;0550: 6e74
+	DC.W	$0000			;0552
+LAB_008C:
+	LEA	LAB_0006+4(PC),A2	;0554: 45fafaec
+	MOVEQ	#-76,D0			;0558: 70b4
+	MOVEQ	#122,D7			;055a: 7e7a
+	JSR	-342(A6)		;055c: 4eaefeaa
+func_0_119:
+	CMPI.L	#$000000f9,D0		;0560: 0c80000000f9
+	JSR	-396(A6)		;0566: 4eaefe74
+	BSR.W	LAB_008F		;056a: 61000012
+	ADDQ.L	#6,A7			;056e: 5c8f
+	MOVE.W	7648(A5),10971(A5)	;0570: 3b6d1de02adb
+	ADD.L	D4,D0			;0576: d084
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0578: 4cdf7cfc
+	RTS				;057c: 4e75
+LAB_008F:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;057e: 48e73f3e
+	BSR.W	LAB_0098		;0582: 61000064
+	MOVE.L	28990(A5),D7		;0586: 2e2d713e
+	BSR.W	LAB_00A5		;058a: 610000d2
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_00A5		;058e: 610000ce
+LAB_0090:
+	ADDQ.L	#1,A7			;0592: 528f
+LAB_0091:
+	BRA.S	LAB_0092		;0594: 6008
+	DC.W	$4572			;0596
+	MOVEQ	#111,D1			;0598: 726f
+	MOVEQ	#58,D1			;059a: 723a
+	MOVE.L	D0,D0			;059c: 2000
+LAB_0092:
+	DBF	D2,LAB_0091		;059e: 51cafff4
+	BNE.S	LAB_0092		;05a2: 66fa
+	BSR.W	func_0_245		;05a4: 6100016e
+	LEA	LAB_0052,A2		;05a8: 45f90000034e
+LAB_0093:
+	ADDQ.L	#5,A7			;05ae: 5a8f
+	DBF	D5,LAB_0093		;05b0: 51cdfffc
+LAB_0094:
+	ADDQ.L	#quick_25,A7		;05b4: 588f
+	DBF	D4,LAB_0094		;05b6: 51ccfffc
+	BNE.S	LAB_0094		;05ba: 66f8
+; call site 147
+	JSR	-828(A6)		;05bc: 4eaefcc4
+LAB_0095:
+	ADDQ.L	#6,A3			;05c0: 5c8b
+	BNE.S	LAB_0095		;05c2: 66fc
+	BNE.S	LAB_0095		;05c4: 66fa
+LAB_0096:
+	BRA.S	LAB_0097		;05c6: 6012
+	BEQ.S	LAB_00A2+2		;05c8: 6772
+	BSR.S	LAB_00A2+2		;05ca: 6170
+	DC.W	$6869			;05cc
+	DC.W	$6373			;05ce
+	MOVEA.L	26978(A4),A7		;05d0: 2e6c6962
+	MOVEQ	#97,D1			;05d4: 7261
+	MOVEQ	#121,D1			;05d6: 7279
+	DC.W	$0000			;05d8
+LAB_0097:
+	ADD.L	D4,D6			;05da: dc84
+	MOVE.L	7174(A5),D3		;05dc: 262d1c06
+	MOVEQ	#64,D3			;05e0: 7640
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;05e2: 4cdf7cfc
+	RTS				;05e6: 4e75
+LAB_0098:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;05e8: 48e73f3e
+	BSR.W	LAB_00A5		;05ec: 61000070
+func_0_161:
+	MOVE.L	10642(A5),D5		;05f0: 2a2d2992
+LAB_009A:
+	TST.L	D0			;05f4: 4a80
+	BNE.S	LAB_009A		;05f6: 66fc
+LAB_009B:
+	LEA	LAB_0062+2(PC),A6	;05f8: 4dfafdfe
+	MOVE.L	D6,D2			;05fc: 2406
+	BRA.S	LAB_009D		;05fe: 6012
+	BEQ.S	LAB_00A7		;0600: 6772
+	BSR.S	LAB_00A7		;0602: 6170
+	DC.W	$6869			;0604
+	DC.W	$6373			;0606
+	MOVEA.L	26978(A4),A7		;0608: 2e6c6962
+	MOVEQ	#97,D1			;060c: 7261
+LAB_009C:
+	MOVEQ	#121,D1			;060e: 7279
+	DC.W	$0000			;0610
+LAB_009D:
+	BNE.S	LAB_009B		;0612: 66e4
+LAB_009E:
+	MOVEQ	#-81,D0			;0614: 70af
+	BSR.W	func_0_245		;0616: 610000fc
+	BNE.S	LAB_009E		;061a: 66f8
+LAB_009F:
+	MOVE.W	10067(A5),5597(A5)	;061c: 3b6d275315dd
+LAB_00A0:
+	BSR.W	func_0_245		;0622: 610000f0
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+LAB_00A1:
+	BSR.W	func_0_245		;0626: 610000ec
+	MOVE.L	#$00000868,-(A7)	;062a: 2f3c00000868
+	BNE.S	LAB_00A0		;0630: 66f0
+	BNE.S	LAB_00A1		;0632: 66f2
+	MOVE.L	D0,D0			;0634: 2000
+	JSR	-426(A6)		;0636: 4eaefe56
+LAB_00A2:
+	BSR.W	LAB_00A5		;063a: 61000022
+	BSR.W	LAB_00A5		;063e: 6100001e
+	BSR.W	func_0_245		;0642: 610000d0
+	ADD.L	D7,D3			;0646: d687
+LAB_00A3:
+	CMP.L	#$0000681b,D5		;0648: babc0000681b
+	DBF	D3,LAB_00A3		;064e: 51cbfff8
+LAB_00A4:
+; call site 189
+	MOVE.L	22026(A5),D2		;0652: 242d560a
+	BNE.S	LAB_00A4		;0656: 66fa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0658: 4cdf7cfc
+	RTS				;065c: 4e75
+LAB_00A5:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;065e: 48e73f3e
+	BSR.W	func_0_245		;0662: 610000b0
+	TST.L	D1			;0666: 4a81
+	MOVEQ	#116,D4			;0668: 7874
+LAB_00A6:
+	CMP.L	#$0000b11b,D2		;066a: b4bc0000b11b
+	DBF	D1,LAB_00A6		;0670: 51c9fff8
+LAB_00A7:
+	MOVEQ	#102,D5			;0674: 7a66
+	MOVE.L	28654(A5),D1		;0676: 222d6fee
+func_0_203:
+	BSR.W	LAB_00C6		;067a: 61000138
+	CMPI.L	#$000000c5,D1		;067e: 0c81000000c5
+	LEA	LAB_0091(PC),A0		;0684: 41faff0e
+	CMPI.L	#$000000da,D0		;0688: 0c80000000da
+	ADD.L	D1,D6			;068e: dc81
+LAB_00A9:
+	LEA	LAB_005B,A2		;0690: 45f9000003a2
+	DBF	D6,LAB_00A9		;0696: 51cefff8
+	ADD.L	D6,D1			;069a: d286
+	MOVE.W	14886(A5),26322(A5)	;069c: 3b6d3a2666d2
+	ADDQ.L	#6,A7			;06a2: 5c8f
+	ADD.L	D0,D5			;06a4: da80
+LAB_00AA:
+	BSR.W	LAB_00C6		;06a6: 6100010c
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+LAB_00AB:
+	BNE.S	LAB_00AA		;06aa: 66fa
+	BNE.S	LAB_00AB		;06ac: 66fc
+	BSR.W	func_0_245		;06ae: 61000064
+	CMPI.L	#$00000044,D6		;06b2: 0c8600000044
+LAB_00AC:
+	LEA	LAB_016F,A4		;06b8: 49f900001028
+LAB_00AD:
+	BSR.W	LAB_00C6		;06be: 610000f4
+LAB_00AE:
+	DBF	D4,LAB_00AD		;06c2: 51ccfffa
+LAB_00AF:
+	DBF	D4,LAB_00AE		;06c6: 51ccfffa
+	DBF	D1,LAB_00AF		;06ca: 51c9fffa
+LAB_00B0:
+	ADD.L	D5,D5			;06ce: da85
+LAB_00B1:
+	DBF	D5,LAB_00B0		;06d0: 51cdfffc
+	DBF	D7,LAB_00B1		;06d4: 51cffffa
+LAB_00B2:
+; call site 231
+	BRA.S	LAB_00B3		;06d8: 600c
+	DC.W	$646f			;06da
+	DC.W	$732e			;06dc
+	DC.W	$6c69			;06de
+	BHI.S	LAB_00BA+2		;06e0: 6272
+	BSR.S	LAB_00BA+4		;06e2: 6172
+	DC.W	$7900			;06e4
+LAB_00B3:
+	DBF	D0,LAB_00B2		;06e6: 51c8fff0
+	CMP.L	#$00004aaa,D4		;06ea: b8bc00004aaa
+LAB_00B4:
+	BNE.S	LAB_00B3		;06f0: 66f4
+	BNE.S	LAB_00B4		;06f2: 66fc
+	BSR.W	LAB_00C6		;06f4: 610000be
+	BRA.S	LAB_00B5		;06f8: 6008
+	DC.W	$4572			;06fa
+	MOVEQ	#111,D1			;06fc: 726f
+	MOVEQ	#58,D1			;06fe: 723a
+	MOVE.L	D0,D0			;0700: 2000
+LAB_00B5:
+	MOVE.W	8940(A5),169(A5)	;0702: 3b6d22ec00a9
+	LEA	LAB_009C(PC),A4		;0708: 49faff04
+	ADD.L	D6,D0			;070c: d086
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;070e: 4cdf7cfc
+	RTS				;0712: 4e75
+func_0_245:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0714: 48e73f3e
+	BSR.W	LAB_00C6		;0718: 6100009a
+	CMP.L	#$00007886,D0		;071c: b0bc00007886
+	TST.L	D7			;0722: 4a87
+LAB_00B7:
+	MOVEQ	#69,D5			;0724: 7a45
+LAB_00B8:
+	DBF	D3,LAB_00B7		;0726: 51cbfffc
+	CMPI.L	#$000000e7,D5		;072a: 0c85000000e7
+	BNE.S	LAB_00B8		;0730: 66f4
+	MOVE.L	D1,D2			;0732: 2401
+	MOVE.L	#$00000960,-(A7)	;0734: 2f3c00000960
+	JSR	LAB_00C6		;073a: 4eb9000007b4
+LAB_00B9:
+	CMP.L	#$00009c4f,D1		;0740: b2bc00009c4f
+; ------------------------------------------------------------------------------
+; function 259
+; ------------------------------------------------------------------------------
+	DBF	D7,LAB_00B9		;0746: 51cffff8
+	LEA	LAB_005E(PC),A4		;074a: 49fafc7a
+	JSR	-144(A6)		;074e: 4eaeff70
+LAB_00BA:
+	CMPI.L	#$0000006a,D1		;0752: 0c810000006a
+	BSR.W	LAB_00C6		;0758: 6100005a
+LAB_00BC:
+	MOVEQ	#-85,D0			;075c: 70ab
+LAB_00BD:
+	DBF	D0,LAB_00BC		;075e: 51c8fffc
+	DBF	D4,LAB_00BD		;0762: 51ccfffa
+	BNE.S	LAB_00BC		;0766: 66f4
+LAB_00BE:
+	MOVE.W	22018(A5),6702(A5)	;0768: 3b6d56021a2e
+	DBF	D2,LAB_00BE		;076e: 51cafff8
+LAB_00BF:
+	MOVE.L	#$000008d2,-(A7)	;0772: 2f3c000008d2
+LAB_00C0:
+; call site 273
+	MOVE.L	#$000009b6,-(A7)	;0778: 2f3c000009b6
+	DBF	D6,LAB_00C0		;077e: 51cefff8
+	CMP.L	#value_33,D4		;0782: b8bc00003cae
+	MOVEQ	#-80,D6			;0788: 7cb0
+	MOVE.L	D3,D6			;078a: 2c03
+LAB_00C1:
+	CMP.L	#$00006be7,D6		;078c: bcbc00006be7
+	ADDQ.L	#7,A6			;0792: 5e8e
+	MOVE.W	12977(A5),15252(A5)	;0794: 3b6d32b13b94
+LAB_00C2:
+	BNE.S	LAB_00C1		;079a: 66f0
+	DBF	D6,LAB_00C2		;079c: 51cefffc
+LAB_00C3:
+	JSR	-174(A6)		;07a0: 4eaeff52
+LAB_00C4:
+	BNE.S	LAB_00C3		;07a4: 66fa
+func_0_287:
+	BNE.S	LAB_00C4		;07a6: 66fc
+	BSR.W	LAB_00C6		;07a8: 6100000a
+	MOVE.L	D1,D1			;07ac: 2201
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;07ae: 4cdf7cfc
+	RTS				;07b2: 4e75
+LAB_00C6:
+	JSR	LAB_00D7		;07b4: 4eb900000a00
+	NOP				;07ba: 4e71
+	NOP				;07bc: 4e71
+	NOP				;07be: 4e71
+	NOP				;07c0: 4e71
+	NOP				;07c2: 4e71
+	NOP				;07c4: 4e71
+	NOP				;07c6: 4e71
+	NOP				;07c8: 4e71
+	NOP				;07ca: 4e71
+	NOP				;07cc: 4e71
+	NOP				;07ce: 4e71
+	NOP				;07d0: 4e71
+	NOP				;07d2: 4e71
+	NOP				;07d4: 4e71
+	NOP				;07d6: 4e71
+	NOP				;07d8: 4e71
+	NOP				;07da: 4e71
+	NOP				;07dc: 4e71
+	NOP				;07de: 4e71
+	NOP				;07e0: 4e71
+	NOP				;07e2: 4e71
+	NOP				;07e4: 4e71
+	NOP				;07e6: 4e71
+	NOP				;07e8: 4e71
+	NOP				;07ea: 4e71
+	NOP				;07ec: 4e71
+	NOP				;07ee: 4e71
+	NOP				;07f0: 4e71
+	NOP				;07f2: 4e71
+	NOP				;07f4: 4e71
+	NOP				;07f6: 4e71
+	NOP				;07f8: 4e71
+	NOP				;07fa: 4e71
+	NOP				;07fc: 4e71
+	RTS				;07fe: 4e75
+	DC.L	$1bed71db		;0800
+	DC.W	$2b48			;0804
+LAB_00C7:
+	DC.W	$ccef			;0806
+	DC.L	LAB_0033		;0808: 00000210
+	DC.L	$14c56918,$70610e5b,$603c5273,$469e9d13 ;080c
+	DC.L	$690b8b1d,$3569a2ba,$6ed45f45,$7d3b4a5e ;081c
+	DC.L	$0d843528,$263780a1	;082c
+	DC.L	LAB_00DD		;0834: 00000a54
+	;0838
+	;DC.B	$57,$6f
+	DC.B	"Wo"
+LAB_00C8:
+	DC.L	$726b6265,$6e636800,$2e4850de ;083a
+	;0846
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+	DC.L	$4e7307aa,$3ddec549,$70dc95b9,$572b4847 ;084e
+LAB_00C9:
+	DC.L	LAB_00CE		;085e: 00000902
+	DC.L	$3c996a4c,$477f8479,$2172e096,$28c0674a ;0862
+	;0872
+	;DC.B	$45,$72,$72,$6f,$72,$3a,$20,$00
+	DC.B	"Error: ",0
+	DC.L	$08e9d259,$6f816fa8,$52cd42bb,$1269a2ef ;087a
+	DC.L	$399b40d7		;088a
+	DC.L	LAB_00AC+4		;088e: 000006bc
+	DC.L	LAB_0129+2		;0892: 00000d62
+	DC.L	$615a8a73		;0896
+LAB_00CA:
+	DC.L	$7352e688		;089a
+	DC.L	LAB_00D6		;089e: 000009c2
+	;08a2
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+	DC.L	$17edeb24		;08b4
+	DC.W	$584d			;08b8
+LAB_00CB:
+	DC.L	$5f1e0162		;08ba
+	DC.W	$6179			;08be
+LAB_00CC:
+	DC.L	$5d646286,$5a03cf2d,$0571800d ;08c0
+	DC.W	$3071			;08cc
+LAB_00CD:
+	DC.L	$f4380413,$e6e36ec5	;08ce
+	DC.W	$46bc			;08d6
+	DC.L	LAB_00D5		;08d8: 000009b8
+	DC.L	$5ddaa5bb,$423614a5,$24a0cca7,$21edc478 ;08dc
+	DC.L	$1be38997,$77164339,$61a8331f,$704099e7 ;08ec
+	DC.L	$30e603b6		;08fc
+	DC.W	$3d52			;0900
+LAB_00CE:
+	DC.L	$ebcb35e2,$768b6e96	;0902
+	DC.W	$6b17			;090a
+LAB_00CF:
+	DC.L	$4851d4a9,$32a4b794,$0405a048,$1ee0f41e ;090c
+	DC.L	$1c1a5d7d,$128c1443	;091c
+	DC.W	$6390			;0924
+LAB_00D0:
+	DC.L	$725c65cd,$9e906b49	;0926
+	DC.W	$f0fb			;092e
+	DC.L	LAB_00FF		;0930: 00000bca
+LAB_00D1:
+	DC.L	$2bffa838,$5f37bf4f,$7310e7ed,$19c03376 ;0934
+	DC.L	$1085ade4,$325b583b	;0944
+	DC.L	LAB_00D2		;094c: 00000970
+	DC.L	$56a30d99,$2d701eb5,$104b6c82 ;0950
+	;095c
+	;DC.B	$64,$6f,$73,$2e,$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"dos.library",0
+	DC.L	$74271696		;0968
+	;096c
+	;DC.B	$52,$65,$61,$64
+	DC.B	"Read"
+LAB_00D2:
+	DC.W	$792e			;0970
+LAB_00D3:
+	DS.W	1			;0972
+	;0974
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e
+	DC.B	"intuition."
+LAB_00D4:
+	DC.L	$6c696272,$61727900,$31b28d61,$70813d6f ;097e
+	DC.L	$15e39c58,$0c955e0e,$75101c99,$00a3ad97 ;098e
+	DC.L	$2c91b2f4,$7590a3e2,$170d3926,$52716e20 ;099e
+	DC.L	$64995f55,$0518c420	;09ae
+	DC.W	$7e38			;09b6
+LAB_00D5:
+	DC.L	$87d240b9		;09b8
+	DC.W	$91a6			;09bc
+	;09be
+	;DC.B	$67,$72,$61,$70
+	DC.B	"grap"
+LAB_00D6:
+	DC.L	$68696373,$2e6c6962,$72617279,$00001f14 ;09c2
+	DC.L	$c30d024b,$158a0000	;09d2
+	DS.L	9			;09da
+	DS.W	1			;09fe
+LAB_00D7:
+; call site 0
+	LINK.W	A5,#-4			;0a00: 4e55fffc
+	BSR.W	LAB_00DF		;0a04: 6100005c
+LAB_00D8:
+	JSR	-726(A6)		;0a08: 4eaefd2a
+	CMPI.L	#$00000090,D7		;0a0c: 0c8700000090
+	MOVE.L	10716(A5),D2		;0a12: 242d29dc
+	BSR.W	LAB_00ED		;0a16: 610000d2
+	MOVEQ	#78,D7			;0a1a: 7e4e
+LAB_00D9:
+	MOVE.W	20175(A5),27538(A5)	;0a1c: 3b6d4ecf6b92
+	BNE.S	LAB_00D9		;0a22: 66f8
+func_2_224:
+	ADD.L	D4,D2			;0a24: d484
+	BSR.W	LAB_00ED		;0a26: 610000c2
+	LEA	LAB_00D8+2(PC),A2	;0a2a: 45faffde
+	BRA.S	LAB_00DB		;0a2e: 600c
+	MOVEQ	#111,D2			;0a30: 746f
+	MOVEQ	#97,D0			;0a32: 7061
+	MOVEQ	#46,D5			;0a34: 7a2e
+	DC.W	$666f			;0a36
+	BGT.S	LAB_00E8		;0a38: 6e74
+	DC.W	$0000			;0a3a
+LAB_00DB:
+	MOVE.W	12575(A5),2749(A5)	;0a3c: 3b6d311f0abd
+	JSR	LAB_00F2		;0a42: 4eb900000b24
+LAB_00DC:
+	MOVE.W	23271(A5),30866(A5)	;0a48: 3b6d5ae77892
+	ADD.L	D3,D7			;0a4e: de83
+	BSR.W	LAB_00DF		;0a50: 61000010
+LAB_00DD:
+	ADD.L	D0,D7			;0a54: de80
+	BNE.S	LAB_00DD		;0a56: 66fc
+func_2_119:
+	MOVE.W	9041(A5),2647(A5)	;0a58: 3b6d23510a57
+	UNLK	A5			;0a5e: 4e5d
+	RTS				;0a60: 4e75
+LAB_00DF:
+	LINK.W	A5,#-24			;0a62: 4e55ffe8
+	BSR.W	LAB_00ED		;0a66: 61000082
+LAB_00E0:
+	TST.L	D2			;0a6a: 4a82
+	DBF	D3,LAB_00E0		;0a6c: 51cbfffc
+	LEA	LAB_00CF,A4		;0a70: 49f90000090c
+	BSR.W	LAB_0103		;0a76: 61000174
+; ------------------------------------------------------------------------------
+; function 343
+; ------------------------------------------------------------------------------
+LAB_00E1:
+	MOVE.L	524(A5),D2		;0a7a: 242d020c
+LAB_00E2:
+	DBF	D4,LAB_00E1		;0a7e: 51ccfffa
+func_2_14:
+LAB_00E3:
+	MOVE.L	#$0000076a,-(A7)	;0a82: 2f3c0000076a
+LAB_00E5:
+	DBF	D1,func_2_14		;0a88: 51c9fff8
+	BNE.S	LAB_00E2		;0a8c: 66f0
+	MOVE.L	8662(A5),D3		;0a8e: 262d21d6
+LAB_00E6:
+	BNE.S	LAB_00E5		;0a92: 66f4
+LAB_00E7:
+	JSR	LAB_00ED		;0a94: 4eb900000aea
+	BSR.W	LAB_00F2		;0a9a: 61000088
+	JSR	-324(A6)		;0a9e: 4eaefebc
+	JSR	-204(A6)		;0aa2: 4eaeff34
+; ------------------------------------------------------------------------------
+; function 238
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_00ED		;0aa6: 61000042
+	BSR.W	LAB_0103		;0aaa: 61000140
+LAB_00E8:
+	LEA	LAB_00DC+4(PC),A0	;0aae: 41faff9c
+LAB_00E9:
+	JSR	LAB_00F2		;0ab2: 4eb900000b24
+	DBF	D1,LAB_00E9		;0ab8: 51c9fff8
+	MOVE.L	D7,D5			;0abc: 2a07
+	LEA	LAB_00DF(PC),A2		;0abe: 45faffa2
+LAB_00EA:
+	BSR.W	LAB_00ED		;0ac2: 61000026
+	DBF	D4,LAB_00EA		;0ac6: 51ccfffa
+	BSR.W	LAB_00F2		;0aca: 61000058
+LAB_00EB:
+	BSR.W	LAB_00ED		;0ace: 6100001a
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	ADDQ.L	#2,A6			;0ad2: 548e
+	LEA	LAB_00CA,A0		;0ad4: 41f90000089a
+LAB_00EC:
+	BNE.S	LAB_00EB		;0ada: 66f2
+	DBF	D4,LAB_00EC		;0adc: 51ccfffc
+	JSR	LAB_00F2		;0ae0: 4eb900000b24
+	UNLK	A5			;0ae6: 4e5d
+	RTS				;0ae8: 4e75
+LAB_00ED:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0aea: 48e73f3e
+	BSR.W	LAB_00F2		;0aee: 61000034
+; call site 357
+	BRA.S	LAB_00EE		;0af2: 6012
+	BEQ.S	LAB_00F6+2		;0af4: 6772
+	BSR.S	LAB_00F6+2		;0af6: 6170
+	DC.W	$6869			;0af8
+	DC.W	$6373			;0afa
+	MOVEA.L	26978(A4),A7		;0afc: 2e6c6962
+	MOVEQ	#97,D1			;0b00: 7261
+	MOVEQ	#121,D1			;0b02: 7279
+	DC.W	$0000			;0b04
+LAB_00EE:
+	BSR.W	LAB_00F2		;0b06: 6100001c
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_00F0:
+	BNE.S	LAB_00EE		;0b0a: 66fa
+LAB_00F1:
+	DBF	D6,LAB_00F0		;0b0c: 51cefffc
+	DBF	D5,LAB_00F1		;0b10: 51cdfffa
+	BSR.W	LAB_0103		;0b14: 610000d6
+	MOVE.L	D1,D6			;0b18: 2c01
+	BSR.W	LAB_0103		;0b1a: 610000d0
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0b1e: 4cdf7cfc
+	RTS				;0b22: 4e75
+LAB_00F2:
+; call site 252
+	BSR.W	LAB_0103		;0b24: 610000c6
+	MOVE.L	314(A5),D0		;0b28: 202d013a
+	BSR.W	LAB_0114		;0b2c: 6100014c
+	CMPI.L	#$00000061,D2		;0b30: 0c8200000061
+LAB_00F3:
+	MOVEQ	#-85,D2			;0b36: 74ab
+	DBF	D2,LAB_00F3		;0b38: 51cafffc
+	MOVE.W	25320(A5),29485(A5)	;0b3c: 3b6d62e8732d
+	JSR	-834(A6)		;0b42: 4eaefcbe
+	BRA.S	LAB_00F5		;0b46: 600c
+LAB_00F4:
+	MOVEQ	#111,D2			;0b48: 746f
+	MOVEQ	#97,D0			;0b4a: 7061
+	MOVEQ	#46,D5			;0b4c: 7a2e
+	DC.W	$666f			;0b4e
+	BGT.S	LAB_00FE		;0b50: 6e74
+	DC.W	$0000			;0b52
+LAB_00F5:
+	JSR	-402(A6)		;0b54: 4eaefe6e
+	DBF	D5,LAB_00F5		;0b58: 51cdfffa
+; call site 147
+	LEA	LAB_00C9+2,A0		;0b5c: 41f900000860
+	MOVE.L	28406(A5),D2		;0b62: 242d6ef6
+LAB_00F6:
+	LEA	LAB_0010,A4		;0b66: 49f90000008a
+	JSR	LAB_0114		;0b6c: 4eb900000c7a
+LAB_00F7:
+	BSR.W	LAB_0114		;0b72: 61000106
+	BNE.S	LAB_00F7		;0b76: 66fa
+	MOVE.L	D5,D4			;0b78: 2805
+LAB_00F8:
+	BSR.W	LAB_011D		;0b7a: 61000170
+	DBF	D5,LAB_00F8		;0b7e: 51cdfffa
+func_2_371:
+	LEA	LAB_009F+4,A0		;0b82: 41f900000620
+	BNE.S	LAB_00F8		;0b88: 66f0
+LAB_00FA:
+; call site 42
+	MOVE.W	10799(A5),25531(A5)	;0b8a: 3b6d2a2f63bb
+	CMPI.L	#$0000004c,D7		;0b90: 0c870000004c
+	JSR	LAB_011D		;0b96: 4eb900000cec
+LAB_00FB:
+	CMPI.L	#$0000000e,D3		;0b9c: 0c830000000e
+	MOVEQ	#106,D1			;0ba2: 726a
+	LEA	LAB_00B3,A4		;0ba4: 49f9000006e6
+	MOVE.L	#$000005a6,-(A7)	;0baa: 2f3c000005a6
+	LEA	LAB_00D0,A0		;0bb0: 41f900000926
+LAB_00FC:
+	CMPI.L	#$00000033,D2		;0bb6: 0c8200000033
+func_2_266:
+	CMP.L	#$0000a62f,D4		;0bbc: b8bc0000a62f
+	BNE.S	LAB_00FC		;0bc2: 66f2
+	MOVEQ	#-104,D2		;0bc4: 7498
+LAB_00FE:
+	MOVE.L	27550(A5),D3		;0bc6: 262d6b9e
+LAB_00FF:
+	MOVEQ	#92,D6			;0bca: 7c5c
+LAB_0100:
+	BSR.W	LAB_0114		;0bcc: 610000ac
+LAB_0101:
+	BNE.S	LAB_0100		;0bd0: 66fa
+	DBF	D6,LAB_0101		;0bd2: 51cefffc
+	BSR.W	LAB_0114		;0bd6: 610000a2
+	MOVE.W	16108(A5),32145(A5)	;0bda: 3b6d3eec7d91
+	JSR	-390(A6)		;0be0: 4eaefe7a
+func_2_161:
+	CMPI.L	#$00000034,D4		;0be4: 0c8400000034
+	RTS				;0bea: 4e75
+LAB_0103:
+	LINK.W	A5,#-100		;0bec: 4e55ff9c
+LAB_0104:
+	BSR.W	LAB_0114		;0bf0: 61000088
+	DBF	D6,LAB_0104		;0bf4: 51cefffa
+	JSR	-858(A6)		;0bf8: 4eaefca6
+	BSR.W	LAB_0122		;0bfc: 61000138
+	MOVE.W	18739(A5),8801(A5)	;0c00: 3b6d49332261
+	CMPI.L	#$000000f9,D1		;0c06: 0c81000000f9
+; ------------------------------------------------------------------------------
+; function 385
+; ------------------------------------------------------------------------------
+LAB_0105:
+	BSR.W	LAB_0122		;0c0c: 61000128
+	DBF	D6,LAB_0105		;0c10: 51cefffa
+func_2_56:
+	LEA	LAB_00EE+2(PC),A2	;0c14: 45fafef2
+	BNE.S	func_2_56		;0c18: 66fa
+	BNE.S	func_2_56		;0c1a: 66f8
+	MOVE.W	28214(A5),5994(A5)	;0c1c: 3b6d6e36176a
+	JSR	-36(A6)			;0c22: 4eaeffdc
+LAB_0107:
+	BSR.W	LAB_0122		;0c26: 6100010e
+LAB_0108:
+	DBF	D3,LAB_0107		;0c2a: 51cbfffa
+	DBF	D3,LAB_0108		;0c2e: 51cbfffa
+LAB_0109:
+	BSR.W	LAB_0114		;0c32: 61000046
+; ------------------------------------------------------------------------------
+; function 280
+; ------------------------------------------------------------------------------
+LAB_010A:
+	DBF	D7,LAB_0109		;0c36: 51cffffa
+	BNE.S	LAB_010A		;0c3a: 66fa
+	BNE.S	LAB_010A		;0c3c: 66f8
+	ADDQ.L	#1,A5			;0c3e: 528d
+	BSR.W	LAB_0114		;0c40: 61000038
+LAB_010B:
+	LEA	func_2_371(PC),A6	;0c44: 4dfaff3c
+LAB_010C:
+	DBF	D7,LAB_010B		;0c48: 51cffffa
+	MOVEQ	#-115,D6		;0c4c: 7c8d
+LAB_010D:
+	BNE.S	LAB_010C		;0c4e: 66f8
+LAB_010E:
+	MOVE.L	D3,D1			;0c50: 2203
+	DBF	D6,LAB_010E		;0c52: 51cefffc
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+	JSR	LAB_011D		;0c56: 4eb900000cec
+	CMPI.L	#$00000058,D0		;0c5c: 0c8000000058
+LAB_010F:
+	JSR	-552(A6)		;0c62: 4eaefdd8
+	ADDQ.L	#6,A7			;0c66: 5c8f
+	BNE.S	LAB_010F		;0c68: 66f8
+	ADDQ.L	#1,A2			;0c6a: 528a
+LAB_0111:
+	LEA	LAB_00F4(PC),A4		;0c6c: 49fafeda
+LAB_0112:
+	DBF	D4,LAB_0111		;0c70: 51ccfffa
+	BNE.S	LAB_0112		;0c74: 66fa
+LAB_0113:
+; call site 399
+	UNLK	A5			;0c76: 4e5d
+	RTS				;0c78: 4e75
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+LAB_0114:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0c7a: 48e73f3e
+	BSR.W	LAB_011D		;0c7e: 6100006c
+	TST.L	D3			;0c82: 4a83
+	BRA.S	LAB_0115		;0c84: 600a
+	SUBQ.W	#3,29291(A7)		;0c86: 576f726b
+	DC.W	$6265			;0c8a
+	DC.W	$6e63			;0c8c
+	DC.W	$6800			;0c8e
+LAB_0115:
+	BRA.S	LAB_0116		;0c90: 600e
+	DC.W	$4f75			;0c92
+	MOVEQ	#32,D2			;0c94: 7420
+	BLE.S	LAB_011E+2		;0c96: 6f66
+	MOVEA.L	25965(A5),A0		;0c98: 206d656d
+	BLE.S	LAB_011F		;0c9c: 6f72
+	DC.W	$7900			;0c9e
+LAB_0116:
+	DBF	D3,LAB_0115		;0ca0: 51cbffee
+	BNE.S	LAB_0116		;0ca4: 66fa
+	ADD.L	D3,D0			;0ca6: d083
+	BNE.S	LAB_0116		;0ca8: 66f6
+LAB_0117:
+; call site 294
+	LEA	LAB_0113(PC),A2		;0caa: 45faffca
+	MOVE.L	#$00000912,-(A7)	;0cae: 2f3c00000912
+	MOVEQ	#-89,D2			;0cb4: 74a7
+LAB_0118:
+	BNE.S	LAB_0117		;0cb6: 66f2
+LAB_0119:
+	DBF	D5,LAB_0118		;0cb8: 51cdfffc
+	BNE.S	LAB_0119		;0cbc: 66fa
+	BRA.S	LAB_011A		;0cbe: 600c
+	MOVEQ	#111,D2			;0cc0: 746f
+	MOVEQ	#97,D0			;0cc2: 7061
+	MOVEQ	#46,D5			;0cc4: 7a2e
+	DC.W	$666f			;0cc6
+	BGT.S	LAB_0123		;0cc8: 6e74
+	DC.W	$0000			;0cca
+LAB_011A:
+	ADD.L	D3,D5			;0ccc: da83
+	DBF	D0,LAB_011A		;0cce: 51c8fffc
+LAB_011B:
+	ADDQ.L	#quick_41,A1		;0cd2: 5c89
+LAB_011C:
+	DBF	D7,LAB_011B		;0cd4: 51cffffc
+; call site 189
+	MOVEQ	#-118,D0		;0cd8: 708a
+	BNE.S	LAB_011C		;0cda: 66f8
+	BSR.W	LAB_0122		;0cdc: 61000058
+	MOVE.L	27766(A5),D4		;0ce0: 282d6c76
+	MOVEQ	#95,D5			;0ce4: 7a5f
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0ce6: 4cdf7cfc
+	RTS				;0cea: 4e75
+LAB_011D:
+	LINK.W	A5,#-180		;0cec: 4e55ff4c
+	BSR.W	LAB_0122		;0cf0: 61000044
+	ADD.L	D7,D0			;0cf4: d087
+	LEA	LAB_00D4,A0		;0cf6: 41f90000097e
+LAB_011E:
+; call site 84
+	JSR	-444(A6)		;0cfc: 4eaefe44
+	MOVE.W	24711(A5),30854(A5)	;0d00: 3b6d60877886
+	LEA	LAB_010D(PC),A2		;0d06: 45faff46
+	MOVE.W	19529(A5),26257(A5)	;0d0a: 3b6d4c496691
+LAB_011F:
+	BRA.S	LAB_0120		;0d10: 6012
+	BVS.S	LAB_012D		;0d12: 696e
+	MOVEQ	#117,D2			;0d14: 7475
+	BVS.S	LAB_012E		;0d16: 6974
+	DC.W	$696f			;0d18
+	BGT.S	LAB_0125+4		;0d1a: 6e2e
+	DC.W	$6c69			;0d1c
+	BHI.S	LAB_012F		;0d1e: 6272
+	BSR.S	LAB_012F+2		;0d20: 6172
+	DC.W	$7900			;0d22
+LAB_0120:
+	BSR.W	LAB_0139		;0d24: 610000cc
+	ADDQ.L	#5,A2			;0d28: 5a8a
+	BSR.W	LAB_0122		;0d2a: 6100000a
+	MOVE.L	28970(A5),D5		;0d2e: 2a2d712a
+func_2_308:
+	UNLK	A5			;0d32: 4e5d
+	RTS				;0d34: 4e75
+LAB_0122:
+	LINK.W	A5,#-244		;0d36: 4e55ff0c
+	BSR.W	LAB_0129		;0d3a: 61000024
+LAB_0123:
+	TST.L	D7			;0d3e: 4a87
+	TST.L	D1			;0d40: 4a81
+LAB_0124:
+	BSR.W	LAB_0129		;0d42: 6100001c
+LAB_0125:
+	MOVE.W	14755(A5),27920(A5)	;0d46: 3b6d39a36d10
+	BNE.S	LAB_0125		;0d4c: 66f8
+	CMP.L	#$0000db70,D2		;0d4e: b4bc0000db70
+LAB_0127:
+	BSR.W	LAB_013E		;0d54: 610000dc
+func_2_203:
+	DBF	D5,LAB_0127		;0d58: 51cdfffa
+	UNLK	A5			;0d5c: 4e5d
+	RTS				;0d5e: 4e75
+LAB_0129:
+	LINK.W	A5,#-124		;0d60: 4e55ff84
+	BSR.W	LAB_0139		;0d64: 6100008c
+	MOVE.L	D7,D0			;0d68: 2007
+	ADD.L	D7,D1			;0d6a: d287
+	LEA	func_2_224(PC),A4	;0d6c: 49fafcb6
+	BSR.W	LAB_0139		;0d70: 61000080
+LAB_012B:
+	CMPI.L	#$00000035,D4		;0d74: 0c8400000035
+	DBF	D5,LAB_012B		;0d7a: 51cdfff8
+func_2_98:
+	MOVE.L	D6,D0			;0d7e: 2006
+	MOVEQ	#69,D2			;0d80: 7445
+LAB_012D:
+	BSR.W	LAB_013E		;0d82: 610000ae
+	BSR.W	LAB_013E		;0d86: 610000aa
+	ADD.L	D5,D4			;0d8a: d885
+LAB_012E:
+	MOVE.W	27271(A5),26258(A5)	;0d8c: 3b6d6a876692
+LAB_012F:
+	LEA	LAB_00E3+4(PC),A0	;0d92: 41fafcf2
+LAB_0131:
+	BRA.S	LAB_0132		;0d96: 600a
+	SUBQ.W	#3,29291(A7)		;0d98: 576f726b
+	DC.W	$6265			;0d9c
+	DC.W	$6e63			;0d9e
+	DC.W	$6800			;0da0
+LAB_0132:
+	DBF	D5,LAB_0131		;0da2: 51cdfff2
+; ------------------------------------------------------------------------------
+; function 322
+; ------------------------------------------------------------------------------
+	JSR	LAB_0151		;0da6: 4eb900000ec4
+	BSR.W	LAB_0139		;0dac: 61000044
+LAB_0133:
+	CMP.L	#$00007cf9,D0		;0db0: b0bc00007cf9
+	DBF	D0,LAB_0133		;0db6: 51c8fff8
+LAB_0134:
+	ADD.L	D1,D6			;0dba: dc81
+LAB_0135:
+	BNE.S	LAB_0134		;0dbc: 66fc
+	BNE.S	LAB_0135		;0dbe: 66fc
+LAB_0136:
+	MOVE.W	30940(A5),5677(A5)	;0dc0: 3b6d78dc162d
+	DBF	D1,LAB_0136		;0dc6: 51c9fff8
+LAB_0137:
+	ADDQ.L	#5,A3			;0dca: 5a8b
+	DBF	D0,LAB_0137		;0dcc: 51c8fffc
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+	ADD.L	D7,D6			;0dd0: dc87
+	JSR	-432(A6)		;0dd2: 4eaefe50
+	MOVE.L	D6,D6			;0dd6: 2c06
+	MOVE.L	D6,D2			;0dd8: 2406
+	BRA.S	LAB_0138		;0dda: 6012
+	BEQ.S	LAB_0140+2		;0ddc: 6772
+	BSR.S	LAB_0140+2		;0dde: 6170
+	DC.W	$6869			;0de0
+	DC.W	$6373			;0de2
+	MOVEA.L	26978(A4),A7		;0de4: 2e6c6962
+	MOVEQ	#97,D1			;0de8: 7261
+	MOVEQ	#121,D1			;0dea: 7279
+	DC.W	$0000			;0dec
+LAB_0138:
+	UNLK	A5			;0dee: 4e5d
+	RTS				;0df0: 4e75
+LAB_0139:
+	LINK.W	A5,#-256		;0df2: 4e55ff00
+LAB_013A:
+	BSR.W	LAB_013E		;0df6: 6100003a
+	DBF	D6,LAB_013A		;0dfa: 51cefffa
+LAB_013B:
+	MOVE.L	D7,D1			;0dfe: 2207
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	DBF	D7,LAB_013B		;0e00: 51cffffc
+LAB_013C:
+	JSR	-132(A6)		;0e04: 4eaeff7c
+LAB_013D:
+	DBF	D1,LAB_013C		;0e08: 51c9fffa
+	DBF	D4,LAB_013D		;0e0c: 51ccfffa
+	MOVE.L	4070(A5),D6		;0e10: 2c2d0fe6
+	BNE.S	LAB_013D		;0e14: 66f2
+	MOVE.W	22392(A5),24790(A5)	;0e16: 3b6d577860d6
+	MOVEQ	#6,D4			;0e1c: 7806
+	CMP.L	#$00006c9c,D6		;0e1e: bcbc00006c9c
+; call site 336
+	MOVE.L	#$00000ff2,-(A7)	;0e24: 2f3c00000ff2
+	LEA	LAB_00F0(PC),A2		;0e2a: 45fafcde
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+	UNLK	A5			;0e2e: 4e5d
+	RTS				;0e30: 4e75
+LAB_013E:
+	BSR.W	LAB_0151		;0e32: 61000090
+	MOVE.W	11834(A5),31462(A5)	;0e36: 3b6d2e3a7ae6
+	TST.L	D3			;0e3c: 4a83
+LAB_013F:
+	ADDQ.L	#7,A3			;0e3e: 5e8b
+	CMP.L	#$0000065b,D7		;0e40: bebc0000065b
+	BSR.W	LAB_0159		;0e46: 610000c0
+; call site 231
+	BNE.S	LAB_013F		;0e4a: 66f2
+	MOVE.L	D0,D6			;0e4c: 2c00
+LAB_0140:
+	MOVE.L	9092(A5),D5		;0e4e: 2a2d2384
+	MOVE.L	D0,D0			;0e52: 2000
+	BSR.W	LAB_0159		;0e54: 610000b2
+LAB_0141:
+	MOVE.L	17522(A5),D4		;0e58: 282d4472
+	BNE.S	LAB_0141		;0e5c: 66fa
+LAB_0142:
+	MOVEQ	#-28,D4			;0e5e: 78e4
+	MOVE.W	27057(A5),26402(A5)	;0e60: 3b6d69b16722
+	BNE.S	LAB_0142		;0e66: 66f6
+	BSR.W	LAB_0151		;0e68: 6100005a
+LAB_0143:
+; call site 126
+	ADD.L	D6,D6			;0e6c: dc86
+LAB_0144:
+	BNE.S	LAB_0143		;0e6e: 66fc
+	BNE.S	LAB_0144		;0e70: 66fc
+LAB_0145:
+	JSR	LAB_0151		;0e72: 4eb900000ec4
+	DBF	D1,LAB_0145		;0e78: 51c9fff8
+LAB_0146:
+	BSR.W	LAB_0159		;0e7c: 6100008a
+LAB_0147:
+	DBF	D5,LAB_0146		;0e80: 51cdfffa
+	DBF	D0,LAB_0147		;0e84: 51c8fffa
+LAB_0148:
+	BSR.W	LAB_0166		;0e88: 61000128
+func_2_350:
+	DBF	D7,LAB_0148		;0e8c: 51cffffa
+LAB_014A:
+	MOVE.L	D5,D5			;0e90: 2a05
+; call site 21
+	MOVE.W	11906(A5),2911(A5)	;0e92: 3b6d2e820b5f
+LAB_014B:
+	BNE.S	func_2_350		;0e98: 66f2
+	BNE.S	LAB_014A		;0e9a: 66f4
+	MOVE.L	D6,D0			;0e9c: 2006
+LAB_014C:
+	BNE.S	LAB_014B		;0e9e: 66f8
+	MOVE.W	22146(A5),30383(A5)	;0ea0: 3b6d568276af
+	ADDQ.L	#quick_49,A3		;0ea6: 568b
+LAB_014D:
+	BNE.S	LAB_014C		;0ea8: 66f4
+LAB_014E:
+	BNE.S	LAB_014D		;0eaa: 66fc
+func_2_245:
+	BNE.S	LAB_014E		;0eac: 66fc
+	BSR.W	LAB_0159		;0eae: 61000058
+	MOVE.L	#$00000130,-(A7)	;0eb2: 2f3c00000130
+LAB_0150:
+	JSR	-744(A6)		;0eb8: 4eaefd18
+	BSR.W	LAB_0166		;0ebc: 610000f4
+	BNE.S	LAB_0150		;0ec0: 66f6
+	RTS				;0ec2: 4e75
+LAB_0151:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0ec4: 48e73f3e
+LAB_0152:
+	BSR.W	LAB_0159		;0ec8: 6100003e
+	BSR.W	LAB_0166		;0ecc: 610000e4
+LAB_0153:
+	TST.L	D1			;0ed0: 4a81
+func_2_140:
+	BNE.S	LAB_0152		;0ed2: 66f4
+	BNE.S	LAB_0153		;0ed4: 66fa
+	JSR	-678(A6)		;0ed6: 4eaefd5a
+	MOVE.L	14488(A5),D5		;0eda: 2a2d3898
+	JSR	-402(A6)		;0ede: 4eaefe6e
+LAB_0155:
+	MOVEQ	#-63,D4			;0ee2: 78c1
+	DBF	D4,LAB_0155		;0ee4: 51ccfffc
+	MOVE.L	D4,D0			;0ee8: 2004
+	MOVE.L	D4,D3			;0eea: 2604
+; ------------------------------------------------------------------------------
+; function 364
+; ------------------------------------------------------------------------------
+	ADD.W	D0,D0			;0eec: d040
+	MOVE.W	LAB_0156(PC,D0.W),D0	;0eee: 303b0006
+	JMP	LAB_0156(PC,D0.W)	;0ef2: 4efb0002
+LAB_0156:
+	ORI.B	#$0a,D6			;0ef6: 0006000a
+	DC.W	$000e			;0efa
+	MOVEQ	#0,D0			;0efc: 7000
+LAB_0157:
+	RTS				;0efe: 4e75
+func_2_35:
+	MOVEQ	#1,D0			;0f00: 7001
+	RTS				;0f02: 4e75
+	MOVEQ	#2,D0			;0f04: 7002
+	RTS				;0f06: 4e75
+LAB_0159:
+	LINK.W	A5,#-168		;0f08: 4e55ff58
+	BSR.W	LAB_0166		;0f0c: 610000a4
+	TST.L	D5			;0f10: 4a85
+	LEA	LAB_00CC,A0		;0f12: 41f9000008c0
+LAB_015A:
+	MOVE.W	7772(A5),8032(A5)	;0f18: 3b6d1e5c1f60
+LAB_015B:
+	DBF	D6,LAB_015A		;0f1e: 51cefff8
+	BSR.W	LAB_0166		;0f22: 6100008e
+; ------------------------------------------------------------------------------
+; function 259
+; ------------------------------------------------------------------------------
+	MOVEQ	#79,D1			;0f26: 724f
+	BNE.S	LAB_015B		;0f28: 66f4
+LAB_015C:
+	BSR.W	LAB_0170		;0f2a: 61000118
+	DBF	D1,LAB_015C		;0f2e: 51c9fffa
+LAB_015D:
+	MOVE.L	D6,D3			;0f32: 2606
+	MOVE.L	D3,D1			;0f34: 2203
+	MOVE.L	21810(A5),D0		;0f36: 202d5532
+	BNE.S	LAB_015D		;0f3a: 66f6
+	MOVE.L	21360(A5),D0		;0f3c: 202d5370
+	BRA.S	LAB_015E		;0f40: 600c
+	DC.W	$646f			;0f42
+	DC.W	$732e			;0f44
+	DC.W	$6c69			;0f46
+	BHI.S	LAB_0167+2		;0f48: 6272
+	BSR.S	LAB_0167+4		;0f4a: 6172
+	DC.W	$7900			;0f4c
+LAB_015E:
+	MOVEQ	#-89,D7			;0f4e: 7ea7
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+	LEA	LAB_00E6(PC),A4		;0f50: 49fafb40
+	MOVE.W	21733(A5),21772(A5)	;0f54: 3b6d54e5550c
+	LEA	LAB_0124(PC),A2		;0f5a: 45fafde6
+	JSR	-30(A6)			;0f5e: 4eaeffe2
+	MOVE.L	D5,D7			;0f62: 2e05
+	MOVEQ	#-44,D1			;0f64: 72d4
+	MOVE.L	D5,D4			;0f66: 2805
+	MOVE.L	13752(A5),D2		;0f68: 242d35b8
+LAB_015F:
+	LEA	LAB_0107(PC),A0		;0f6c: 41fafcb8
+LAB_0160:
+; call site 378
+	DBF	D4,LAB_015F		;0f70: 51ccfffa
+	CMP.L	#$00008064,D0		;0f74: b0bc00008064
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	JSR	-708(A6)		;0f7a: 4eaefd3c
+LAB_0161:
+	BNE.S	LAB_0160		;0f7e: 66f0
+	DBF	D3,LAB_0161		;0f80: 51cbfffc
+LAB_0162:
+	BSR.W	LAB_0166		;0f84: 6100002c
+	BNE.S	LAB_0162		;0f88: 66fa
+	ADDQ.L	#2,A0			;0f8a: 5488
+	BSR.W	LAB_0173		;0f8c: 610000d2
+LAB_0163:
+	CMPI.L	#$000000d2,D5		;0f90: 0c85000000d2
+LAB_0164:
+	DBF	D1,LAB_0163		;0f96: 51c9fff8
+; call site 273
+	DBF	D4,LAB_0164		;0f9a: 51ccfffa
+	MOVE.W	14145(A5),24943(A5)	;0f9e: 3b6d3741616f
+LAB_0165:
+	JSR	-810(A6)		;0fa4: 4eaefcd6
+	DBF	D1,LAB_0165		;0fa8: 51c9fffa
+	ADD.L	D2,D4			;0fac: d882
+	UNLK	A5			;0fae: 4e5d
+	RTS				;0fb0: 4e75
+LAB_0166:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0fb2: 48e73f3e
+	BSR.W	LAB_0170		;0fb6: 6100008c
+LAB_0167:
+	LEA	LAB_00CB,A0		;0fba: 41f9000008ba
+	LEA	LAB_00FA+4(PC),A6	;0fc0: 4dfafbcc
+; call site 168
+	MOVE.L	#$000000c4,-(A7)	;0fc4: 2f3c000000c4
+	CMP.L	#$00003cb2,D3		;0fca: b6bc00003cb2
+	MOVE.W	21221(A5),27392(A5)	;0fd0: 3b6d52e56b00
+	MOVE.L	5170(A5),D7		;0fd6: 2e2d1432
+	CMP.L	#$000031fb,D0		;0fda: b0bc000031fb
+LAB_0169:
+	MOVEQ	#-115,D7		;0fe0: 7e8d
+LAB_016A:
+	DBF	D4,LAB_0169		;0fe2: 51ccfffc
+	DBF	D5,LAB_016A		;0fe6: 51cdfffa
+	BNE.S	LAB_016A		;0fea: 66f6
+func_2_392:
+	BSR.W	LAB_0173		;0fec: 61000072
+	JSR	LAB_0183		;0ff0: 4eb9000010f0
+; call site 63
+	BSR.W	LAB_0183		;0ff6: 610000f8
+LAB_016C:
+	ADD.L	D3,D1			;0ffa: d283
+LAB_016D:
+	DBF	D0,LAB_016C		;0ffc: 51c8fffc
+	MOVE.L	11782(A5),D1		;1000: 222d2e06
+	BSR.W	LAB_0173		;1004: 6100005a
+	BNE.S	LAB_016D		;1008: 66f2
+	MOVE.W	427(A5),3432(A5)	;100a: 3b6d01ab0d68
+	BSR.W	LAB_0170		;1010: 61000032
+	MOVE.W	12308(A5),4468(A5)	;1014: 3b6d30141174
+func_2_287:
+	BSR.W	LAB_0183		;101a: 610000d4
+	MOVE.W	15312(A5),13223(A5)	;101e: 3b6d3bd033a7
+	LEA	LAB_010F+2(PC),A4	;1024: 49fafc3e
+LAB_016F:
+	LEA	LAB_00C8,A6		;1028: 4df90000083a
+	DBF	D1,LAB_016F		;102e: 51c9fff8
+	CMPI.L	#$0000003d,D4		;1032: 0c840000003d
+	MOVE.L	D3,D6			;1038: 2c03
+	BSR.W	LAB_0170		;103a: 61000008
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;103e: 4cdf7cfc
+	RTS				;1042: 4e75
+LAB_0170:
+	LINK.W	A5,#-148		;1044: 4e55ff6c
+func_2_182:
+	BSR.W	LAB_0173		;1048: 61000016
+	LEA	LAB_0086+2,A6		;104c: 4df900000526
+LAB_0172:
+	BSR.W	LAB_0173		;1052: 6100000c
+	DBF	D5,LAB_0172		;1056: 51cdfffa
+	BNE.S	LAB_0172		;105a: 66f6
+	UNLK	A5			;105c: 4e5d
+	RTS				;105e: 4e75
+LAB_0173:
+	LINK.W	A5,#-160		;1060: 4e55ff60
+LAB_0174:
+	BSR.W	LAB_0183		;1064: 6100008a
+	DBF	D1,LAB_0174		;1068: 51c9fffa
+LAB_0175:
+	MOVEQ	#62,D5			;106c: 7a3e
+func_2_77:
+	MOVE.L	7306(A5),D3		;106e: 262d1c8a
+LAB_0177:
+	BSR.W	LAB_0183		;1072: 6100007c
+	BNE.S	LAB_0175		;1076: 66f4
+	MOVE.L	D5,D0			;1078: 2005
+	BNE.S	LAB_0177		;107a: 66f6
+LAB_0178:
+	MOVE.L	11300(A5),D1		;107c: 222d2c24
+	DBF	D6,LAB_0178		;1080: 51cefffa
+LAB_0179:
+	ADD.L	D2,D2			;1084: d482
+	BNE.S	LAB_0179		;1086: 66fc
+; ------------------------------------------------------------------------------
+; function 301
+; ------------------------------------------------------------------------------
+LAB_017A:
+	BSR.W	LAB_0191		;1088: 6100010c
+	DBF	D2,LAB_017A		;108c: 51cafffa
+	BSR.W	LAB_0191		;1090: 61000104
+	JSR	LAB_0191		;1094: 4eb900001196
+LAB_017B:
+	JSR	-300(A6)		;109a: 4eaefed4
+	DBF	D6,LAB_017B		;109e: 51cefffa
+	ADD.L	D3,D3			;10a2: d683
+	LEA	LAB_00FB+4(PC),A2	;10a4: 45fafafa
+LAB_017C:
+	JSR	-570(A6)		;10a8: 4eaefdc6
+	DBF	D6,LAB_017C		;10ac: 51cefffa
+LAB_017D:
+	BNE.S	LAB_017C		;10b0: 66f6
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+LAB_017E:
+	DBF	D6,LAB_017D		;10b2: 51cefffc
+	BRA.S	LAB_017F		;10b6: 600c
+	DC.W	$646f			;10b8
+	DC.W	$732e			;10ba
+	DC.W	$6c69			;10bc
+	BHI.S	LAB_0187+2		;10be: 6272
+	BSR.S	LAB_0187+4		;10c0: 6172
+	DC.W	$7900			;10c2
+LAB_017F:
+	ADD.L	D5,D4			;10c4: d885
+	BNE.S	LAB_017E		;10c6: 66ea
+	BSR.W	LAB_0191		;10c8: 610000cc
+LAB_0180:
+	JSR	-648(A6)		;10cc: 4eaefd78
+	DBF	D7,LAB_0180		;10d0: 51cffffa
+	BSR.W	LAB_0191		;10d4: 610000c0
+	MOVE.L	D4,D6			;10d8: 2c04
+LAB_0181:
+	BRA.S	LAB_0182		;10da: 600c
+	DC.W	$646f			;10dc
+	DC.W	$732e			;10de
+	DC.W	$6c69			;10e0
+	BHI.S	LAB_018A+2		;10e2: 6272
+	BSR.S	LAB_018B		;10e4: 6172
+	DC.W	$7900			;10e6
+LAB_0182:
+	DBF	D3,LAB_0181		;10e8: 51cbfff0
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+	UNLK	A5			;10ec: 4e5d
+	RTS				;10ee: 4e75
+LAB_0183:
+	LINK.W	A5,#-116		;10f0: 4e55ff8c
+	BSR.W	LAB_0191		;10f4: 610000a0
+	CMPI.L	#$0000001a,D1		;10f8: 0c810000001a
+	TST.L	D6			;10fe: 4a86
+LAB_0184:
+	JSR	LAB_0191		;1100: 4eb900001196
+	DBF	D7,LAB_0184		;1106: 51cffff8
+	CMPI.L	#$000000d0,D2		;110a: 0c82000000d0
+; call site 315
+	MOVEQ	#26,D7			;1110: 7e1a
+LAB_0185:
+	MOVE.L	D6,D4			;1112: 2806
+	BSR.W	LAB_0191		;1114: 61000080
+	BNE.S	LAB_0185		;1118: 66f8
+	MOVEQ	#-128,D1		;111a: 7280
+	JSR	LAB_0191		;111c: 4eb900001196
+	BRA.S	LAB_0186		;1122: 600a
+	DC.W	$2573			;1124
+	MOVE.W	-(A0),D5		;1126: 3a20
+	MOVE.L	25610(A4),0(A2)		;1128: 256c640a0000
+LAB_0186:
+	MOVEQ	#105,D4			;112e: 7869
+LAB_0187:
+	CMPI.L	#$0000009b,D4		;1130: 0c840000009b
+	JSR	-894(A6)		;1136: 4eaefc82
+	CMPI.L	#$00000019,D3		;113a: 0c8300000019
+; call site 210
+	LEA	LAB_00BF,A6		;1140: 4df900000772
+	BSR.W	LAB_0191		;1146: 6100004e
+	CMP.L	#$00003f25,D4		;114a: b8bc00003f25
+LAB_0189:
+	BSR.W	LAB_0191		;1150: 61000044
+LAB_018A:
+	DBF	D1,LAB_0189		;1154: 51c9fffa
+LAB_018B:
+	LEA	LAB_0090,A0		;1158: 41f900000592
+	JSR	LAB_0191		;115e: 4eb900001196
+	CMP.L	#$00005e38,D3		;1164: b6bc00005e38
+	BSR.W	LAB_0191		;116a: 6100002a
+LAB_018C:
+	ADDQ.L	#5,A6			;116e: 5a8e
+	DBF	D4,LAB_018C		;1170: 51ccfffc
+LAB_018D:
+; call site 105
+	LEA	LAB_0182(PC),A0		;1174: 41faff72
+LAB_018E:
+	DBF	D3,LAB_018D		;1178: 51cbfffa
+	DBF	D3,LAB_018E		;117c: 51cbfffa
+LAB_018F:
+	JSR	-180(A6)		;1180: 4eaeff4c
+	BNE.S	LAB_018F		;1184: 66fa
+	MOVE.L	#$000003c0,-(A7)	;1186: 2f3c000003c0
+	ADDQ.L	#quick_57,A3		;118c: 5e8b
+	BSR.W	LAB_0191		;118e: 61000006
+	UNLK	A5			;1192: 4e5d
+func_2_329:
+	RTS				;1194: 4e75
+LAB_0191:
+	NOP				;1196: 4e71
+	NOP				;1198: 4e71
+	NOP				;119a: 4e71
+	NOP				;119c: 4e71
+	NOP				;119e: 4e71
+	NOP				;11a0: 4e71
+	NOP				;11a2: 4e71
+	NOP				;11a4: 4e71
+	NOP				;11a6: 4e71
+	NOP				;11a8: 4e71
+	NOP				;11aa: 4e71
+	NOP				;11ac: 4e71
+	NOP				;11ae: 4e71
+	NOP				;11b0: 4e71
+	NOP				;11b2: 4e71
+	NOP				;11b4: 4e71
+	NOP				;11b6: 4e71
+	NOP				;11b8: 4e71
+	NOP				;11ba: 4e71
+	NOP				;11bc: 4e71
+	NOP				;11be: 4e71
+	NOP				;11c0: 4e71
+	NOP				;11c2: 4e71
+	NOP				;11c4: 4e71
+	NOP				;11c6: 4e71
+	NOP				;11c8: 4e71
+	NOP				;11ca: 4e71
+	NOP				;11cc: 4e71
+	NOP				;11ce: 4e71
+	NOP				;11d0: 4e71
+	NOP				;11d2: 4e71
+	NOP				;11d4: 4e71
+	NOP				;11d6: 4e71
+	NOP				;11d8: 4e71
+	NOP				;11da: 4e71
+	NOP				;11dc: 4e71
+	NOP				;11de: 4e71
+	NOP				;11e0: 4e71
+	NOP				;11e2: 4e71
+	NOP				;11e4: 4e71
+	NOP				;11e6: 4e71
+	NOP				;11e8: 4e71
+	NOP				;11ea: 4e71
+	NOP				;11ec: 4e71
+	NOP				;11ee: 4e71
+	NOP				;11f0: 4e71
+	NOP				;11f2: 4e71
+	NOP				;11f4: 4e71
+	NOP				;11f6: 4e71
+	NOP				;11f8: 4e71
+	NOP				;11fa: 4e71
+	NOP				;11fc: 4e71
+	RTS				;11fe: 4e75
+	END
@@ -0,0 +1,1485 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+
+
+	ORG	$0
+
+SECSTRT_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0000:
+	BSR.W	LAB_0009
+	TST.L	D0
+LAB_0001:
+	LEA	LAB_005F,A4
+	DBF	D4,LAB_0001
+LAB_0002:
+	MOVE.W	13253(A5),14562(A5)
+	DBF	D3,LAB_0002
+LAB_0003:
+	MOVEQ	#14,D5
+LAB_0004:
+	MOVE.W	17172(A5),18322(A5)
+	DBF	D5,LAB_0004
+	BNE.S	LAB_0003
+	BNE.S	LAB_0004
+LAB_0005:
+	CMP.L	#$0000e026,D4
+	DBF	D6,LAB_0005
+	BNE.S	LAB_0005
+	LEA	LAB_0002(PC),A6
+LAB_0006:
+	CMPI.L	#$00000018,D6
+	BNE.S	LAB_0006
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+LAB_0008:
+	RTS
+LAB_0009:
+	BSR.W	LAB_000D
+	MOVE.W	633(A5),27965(A5)
+LAB_000A:
+	BRA.S	LAB_000B
+	DC.B	"%s: %ld",10,0,0
+LAB_000B:
+	LEA	LAB_00C5+4,A0
+LAB_000C:
+	BNE.S	LAB_000A
+	DBF	D6,LAB_000C
+	MOVEQ	#23,D4
+	RTS
+LAB_000D:
+	BSR.W	LAB_001D
+	MOVEQ	#-30,D4
+LAB_000E:
+	CMP.L	#$0000760d,D4
+LAB_000F:
+	DBF	D1,LAB_000E
+	LEA	LAB_000F+2(PC),A0
+	BSR.W	LAB_0021
+LAB_0010:
+	MOVE.W	25258(A5),16623(A5)
+LAB_0011:
+	ADDQ.L	#5,A0
+	DBF	D0,LAB_0011
+LAB_0012:
+	BSR.W	LAB_0021
+LAB_0013:
+	BNE.S	LAB_0012
+LAB_0014:
+	JSR	-78(A6)
+	BNE.S	LAB_0013
+	JSR	LAB_0027
+	BNE.S	LAB_0014
+LAB_0015:
+	BRA.S	LAB_0016
+	DC.B	"Workbench",0
+LAB_0016:
+	DBF	D4,LAB_0015
+	DBF	D5,LAB_0016
+	BSR.W	LAB_001D
+LAB_0017:
+	LEA	LAB_0000+2(PC),A6
+	DBF	D2,LAB_0017
+LAB_0018:
+	BSR.W	LAB_0027
+	BNE.S	LAB_0018
+LAB_0019:
+	MOVE.L	15380(A5),D7
+	MOVE.L	5278(A5),D2
+	CMPI.L	#$000000a6,D1
+LAB_001A:
+	BSR.W	LAB_0021
+LAB_001B:
+	DBF	D6,LAB_001A
+	LEA	LAB_0014(PC),A6
+	BNE.S	LAB_001B
+	JSR	-264(A6)
+	BRA.S	LAB_001C
+	DC.B	"graphics.library",0,0
+LAB_001C:
+	MOVE.L	31186(A5),D5
+	BSR.W	LAB_0027
+	BNE.S	LAB_001C
+	JSR	-528(A6)
+	RTS
+LAB_001D:
+	BSR.W	LAB_0021
+LAB_001E:
+	MOVE.L	D7,D5
+	MOVEQ	#-11,D5
+LAB_001F:
+	BNE.S	LAB_001D
+	BNE.S	LAB_001E
+LAB_0020:
+	CMP.L	#$00000723,D0
+	DBF	D5,LAB_0020
+	RTS
+LAB_0021:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0022:
+	BSR.W	LAB_0027
+	MOVEQ	#27,D6
+	LEA	LAB_0008,A0
+LAB_0023:
+	CMP.L	#$0000af78,D5
+	MOVE.L	14638(A5),D3
+	BNE.S	LAB_0023
+	ADD.L	D4,D6
+	ADDQ.L	#7,A6
+	BSR.W	LAB_0030
+LAB_0024:
+	LEA	LAB_00AA,A2
+	MOVE.L	7262(A5),D2
+	MOVE.L	D2,D0
+	BNE.S	LAB_0024
+	MOVE.L	5250(A5),D2
+	BSR.W	LAB_0027
+	BRA.S	LAB_0026
+LAB_0025:
+	DC.B	"Error: ",0
+LAB_0026:
+	CMPI.L	#$000000dc,D2
+	MOVEQ	#-118,D4
+	MOVEQ	#80,D7
+	MOVE.W	31649(A5),12310(A5)
+	CMP.L	#$0000c18d,D1
+	BSR.W	LAB_0027
+	CMPI.L	#$000000ea,D5
+	MOVE.W	70(A5),5574(A5)
+	BSR.W	LAB_003A
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0027:
+	BSR.W	LAB_0030
+LAB_0028:
+	LEA	LAB_0019+2(PC),A0
+	DBF	D0,LAB_0028
+	ADD.L	D1,D5
+	ADD.L	D4,D6
+	BSR.W	LAB_003D
+LAB_0029:
+	CMP.L	#$00003568,D3
+	BNE.S	LAB_0029
+	ADD.L	D2,D1
+LAB_002A:
+	CMPI.L	#$00000076,D5
+LAB_002B:
+	DBF	D2,LAB_002A
+	DBF	D2,LAB_002B
+	MOVEQ	#-113,D2
+	MOVE.L	#$00000c5a,-(A7)
+	MOVE.W	23438(A5),26553(A5)
+	ADD.L	D2,D6
+LAB_002C:
+	MOVE.W	3052(A5),24827(A5)
+	DBF	D2,LAB_002C
+	CMP.L	#$00001a69,D0
+	BSR.W	LAB_0030
+	MOVE.W	25728(A5),26953(A5)
+LAB_002D:
+	JSR	-48(A6)
+	BSR.W	LAB_0030
+	BSR.W	LAB_003D
+	BNE.S	LAB_002D
+	BSR.W	LAB_0030
+	ADD.L	D5,D0
+	CMPI.L	#$00000077,D3
+LAB_002E:
+	MOVE.W	30793(A5),29177(A5)
+	MOVE.L	D1,D3
+LAB_002F:
+	BSR.W	LAB_003A
+	BNE.S	LAB_002E
+	BNE.S	LAB_002F
+	BSR.W	LAB_0030
+	CMP.L	#$0000a57c,D0
+	BSR.W	LAB_003D
+	RTS
+LAB_0030:
+	BSR.W	LAB_003A
+LAB_0031:
+	MOVE.L	#$00000a94,-(A7)
+	MOVE.W	19855(A5),2004(A5)
+	MOVEQ	#52,D5
+LAB_0032:
+	BNE.S	LAB_0031
+	MOVEQ	#22,D5
+	CMP.L	#$00007280,D2
+	BNE.S	LAB_0032
+	BSR.W	LAB_003D
+LAB_0033:
+	BSR.W	LAB_003A
+	BNE.S	LAB_0033
+LAB_0034:
+	MOVE.W	19153(A5),4100(A5)
+LAB_0035:
+	BNE.S	LAB_0034
+	DBF	D7,LAB_0035
+	MOVE.L	#$000011e8,-(A7)
+	CMP.L	#$00000281,D3
+LAB_0036:
+	JSR	-768(A6)
+	BNE.S	LAB_0036
+LAB_0037:
+	JSR	-348(A6)
+	MOVE.L	9256(A5),D5
+LAB_0038:
+	BNE.S	LAB_0037
+	BRA.S	LAB_0039
+	DC.B	"Ready.",0,0
+LAB_0039:
+	BNE.S	LAB_0038
+	BSR.W	LAB_004C
+	MOVE.L	D1,D3
+	RTS
+LAB_003A:
+	LINK.W	A5,#-52
+	BSR.W	LAB_003D
+LAB_003B:
+	TST.L	D4
+	DBF	D7,LAB_003B
+	JSR	LAB_004C
+LAB_003C:
+	JSR	-576(A6)
+	DBF	D6,LAB_003C
+	MOVE.W	29065(A5),18730(A5)
+	UNLK	A5
+	RTS
+LAB_003D:
+	BSR.W	LAB_004C
+	MOVE.L	D0,D2
+	ADDQ.L	#7,A6
+LAB_003E:
+	BSR.W	LAB_005D
+	BNE.S	LAB_003E
+LAB_003F:
+	JSR	LAB_004C
+	ADD.L	D7,D7
+	BSR.W	LAB_004C
+LAB_0040:
+	LEA	LAB_0025(PC),A4
+	CMP.L	#$0000c694,D2
+LAB_0041:
+	BNE.S	LAB_0040
+	JSR	LAB_0055
+LAB_0042:
+	BNE.S	LAB_0041
+	DBF	D2,LAB_0042
+	BRA.S	LAB_0043
+	DC.B	"Workbench",0
+LAB_0043:
+	CMPI.L	#$0000003a,D6
+LAB_0044:
+	MOVEQ	#-106,D0
+	DBF	D7,LAB_0044
+	BSR.W	LAB_004C
+	MOVE.L	#$00000896,-(A7)
+LAB_0045:
+	LEA	LAB_0054,A4
+LAB_0046:
+	DBF	D0,LAB_0045
+	MOVEQ	#122,D5
+LAB_0047:
+	JSR	-366(A6)
+	BNE.S	LAB_0046
+	BRA.S	LAB_0048
+	DC.B	"graphics.library",0,0
+LAB_0048:
+	BNE.S	LAB_0047
+	CMPI.L	#$0000005f,D5
+	BSR.W	LAB_005D
+	LEA	LAB_00B4,A0
+	ADDQ.L	#5,A6
+LAB_0049:
+	ADD.L	D6,D0
+LAB_004A:
+	DBF	D2,LAB_0049
+LAB_004B:
+	BNE.S	LAB_004A
+	BSR.W	LAB_005D
+	CMPI.L	#$00000006,D5
+	BSR.W	LAB_005D
+	RTS
+LAB_004C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0055
+	JSR	-510(A6)
+LAB_004D:
+	MOVE.L	24924(A5),D0
+LAB_004E:
+	DBF	D7,LAB_004D
+LAB_004F:
+	BSR.W	LAB_0067
+	MOVE.L	#$000007be,-(A7)
+	BSR.W	LAB_005D
+	BNE.S	LAB_004F
+	BSR.W	LAB_0067
+LAB_0050:
+	MOVE.L	D4,D6
+	BNE.S	LAB_0050
+LAB_0051:
+	MOVEQ	#58,D0
+LAB_0052:
+	DBF	D0,LAB_0051
+	BNE.S	LAB_0052
+	MOVE.L	D7,D5
+	MOVE.W	18667(A5),23994(A5)
+	ADDQ.L	#1,A6
+	JSR	-876(A6)
+LAB_0053:
+	ADDQ.L	#7,A5
+	ADD.L	D3,D4
+LAB_0054:
+	MOVE.L	#$0000097c,-(A7)
+	BSR.W	LAB_0067
+	ADDQ.L	#2,A0
+	LEA	LAB_003F+2(PC),A0
+	CMPI.L	#$000000f4,D6
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0055:
+	BSR.W	LAB_005D
+LAB_0056:
+	BRA.S	LAB_0057
+	DC.B	"Workbench",0
+LAB_0057:
+	DBF	D1,LAB_0056
+	MOVE.L	#$00000824,-(A7)
+	ADDQ.L	#7,A5
+	JSR	-306(A6)
+LAB_0058:
+	ADD.L	D0,D3
+	DBF	D1,LAB_0058
+	JSR	-78(A6)
+	BSR.W	LAB_0073
+	JSR	-366(A6)
+LAB_0059:
+	ADD.L	D1,D6
+LAB_005A:
+	BSR.W	LAB_0067
+LAB_005B:
+	BNE.S	LAB_0059
+LAB_005C:
+	BNE.S	LAB_005B
+	DBF	D3,LAB_005C
+	RTS
+LAB_005D:
+	BSR.W	LAB_0067
+	TST.L	D6
+	MOVE.L	29526(A5),D5
+	BNE.S	LAB_005D
+LAB_005E:
+	BRA.S	LAB_0060
+	DC.W	$696e
+LAB_005F:
+	DC.B	"tuition.library",0
+LAB_0060:
+	JSR	-510(A6)
+	BNE.S	LAB_005E
+	LEA	LAB_0120,A6
+	MOVE.L	D2,D0
+	ADD.L	D5,D4
+LAB_0061:
+	BSR.W	LAB_0067
+	DBF	D7,LAB_0061
+LAB_0062:
+	MOVE.W	2599(A5),13043(A5)
+LAB_0063:
+	LEA	LAB_001F(PC),A6
+	DBF	D2,LAB_0063
+	BNE.S	LAB_0062
+	ADD.L	D1,D0
+LAB_0064:
+	LEA	LAB_0048(PC),A6
+	DBF	D6,LAB_0064
+	MOVEQ	#82,D0
+	BNE.S	LAB_0064
+	BSR.W	LAB_0075
+	MOVE.L	22786(A5),D4
+	LEA	LAB_0022,A0
+LAB_0065:
+	MOVE.W	21803(A5),32577(A5)
+LAB_0066:
+	BNE.S	LAB_0065
+	DBF	D1,LAB_0066
+	RTS
+LAB_0067:
+	BSR.W	LAB_0073
+	TST.L	D1
+	LEA	LAB_004E(PC),A4
+LAB_0068:
+	MOVEQ	#41,D2
+	MOVE.L	17520(A5),D2
+	BRA.S	LAB_0069
+	DC.B	"Out of memory",0
+LAB_0069:
+	BNE.S	LAB_0068
+	BSR.W	LAB_007B
+	MOVE.L	25500(A5),D6
+	ADD.L	D4,D0
+	MOVE.L	17722(A5),D1
+	ADD.L	D7,D1
+	ADD.L	D4,D4
+	BSR.W	LAB_0075
+	JSR	LAB_007B
+	MOVE.W	18200(A5),8342(A5)
+LAB_006A:
+	MOVEQ	#17,D1
+LAB_006B:
+	ADDQ.L	#1,A3
+	BNE.S	LAB_006B
+	BNE.S	LAB_006A
+	BNE.S	LAB_006B
+	BSR.W	LAB_0075
+LAB_006C:
+	JSR	-726(A6)
+LAB_006D:
+	BNE.S	LAB_006C
+LAB_006E:
+	DBF	D5,LAB_006D
+	BNE.S	LAB_006D
+LAB_006F:
+	BNE.S	LAB_006E
+	BRA.S	LAB_0070
+	DC.B	"Out of memory",0
+LAB_0070:
+	LEA	LAB_0133,A6
+	BNE.S	LAB_006F
+	BSR.W	LAB_007B
+LAB_0071:
+	LEA	LAB_00B3,A2
+LAB_0072:
+	DBF	D5,LAB_0071
+	JSR	-342(A6)
+	BNE.S	LAB_0072
+	MOVEQ	#42,D2
+	RTS
+LAB_0073:
+	BSR.W	LAB_0075
+	DBF	D2,LAB_0073
+	LEA	LAB_00B0,A0
+	BNE.S	LAB_0073
+	MOVE.W	9078(A5),1968(A5)
+LAB_0074:
+	BSR.W	LAB_0075
+	BNE.S	LAB_0074
+	RTS
+LAB_0075:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0077:
+	BSR.W	LAB_007B
+LAB_0078:
+	DBF	D6,LAB_0077
+LAB_0079:
+	DBF	D2,LAB_0078
+	BSR.W	LAB_008E
+	BNE.S	LAB_0078
+	BNE.S	LAB_0079
+	CMPI.L	#$0000005f,D2
+	ADDQ.L	#7,A4
+	ADD.L	D6,D0
+	BRA.S	LAB_007A
+	DC.B	"topaz.font",0,0
+LAB_007A:
+	LEA	LAB_0006+4(PC),A2
+	MOVEQ	#-76,D0
+	MOVEQ	#122,D7
+	JSR	-342(A6)
+	CMPI.L	#$000000f9,D0
+	JSR	-396(A6)
+	BSR.W	LAB_007B
+	ADDQ.L	#6,A7
+	MOVE.W	7648(A5),10971(A5)
+	ADD.L	D4,D0
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_007B:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0083
+	MOVE.L	28990(A5),D7
+	BSR.W	LAB_008E
+	BSR.W	LAB_008E
+LAB_007C:
+	ADDQ.L	#1,A7
+LAB_007D:
+	BRA.S	LAB_007E
+	DC.B	"Error: ",0
+LAB_007E:
+	DBF	D2,LAB_007D
+	BNE.S	LAB_007E
+	BSR.W	LAB_009C
+	LEA	LAB_004B,A2
+LAB_007F:
+	ADDQ.L	#5,A7
+	DBF	D5,LAB_007F
+LAB_0080:
+	ADDQ.L	#4,A7
+	DBF	D4,LAB_0080
+	BNE.S	LAB_0080
+	JSR	-828(A6)
+LAB_0081:
+	ADDQ.L	#6,A3
+	BNE.S	LAB_0081
+	BNE.S	LAB_0081
+	BRA.S	LAB_0082
+	DC.B	"graphics.library",0,0
+LAB_0082:
+	ADD.L	D4,D6
+	MOVE.L	7174(A5),D3
+	MOVEQ	#64,D3
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0083:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_008E
+	MOVE.L	10642(A5),D5
+LAB_0084:
+	TST.L	D0
+	BNE.S	LAB_0084
+LAB_0085:
+	LEA	LAB_005A+2(PC),A6
+	MOVE.L	D6,D2
+	BRA.S	LAB_0087
+	DC.B	"graphics.libra"
+LAB_0086:
+	DC.L	$72790000
+LAB_0087:
+	BNE.S	LAB_0085
+LAB_0088:
+	MOVEQ	#-81,D0
+	BSR.W	LAB_009C
+	BNE.S	LAB_0088
+LAB_0089:
+	MOVE.W	10067(A5),5597(A5)
+LAB_008A:
+	BSR.W	LAB_009C
+LAB_008B:
+	BSR.W	LAB_009C
+	MOVE.L	#$00000868,-(A7)
+	BNE.S	LAB_008A
+	BNE.S	LAB_008B
+	MOVE.L	D0,D0
+	JSR	-426(A6)
+	BSR.W	LAB_008E
+	BSR.W	LAB_008E
+	BSR.W	LAB_009C
+	ADD.L	D7,D3
+LAB_008C:
+	CMP.L	#$0000681b,D5
+	DBF	D3,LAB_008C
+LAB_008D:
+	MOVE.L	22026(A5),D2
+	BNE.S	LAB_008D
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_008E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_009C
+	TST.L	D1
+	MOVEQ	#116,D4
+LAB_008F:
+	CMP.L	#$0000b11b,D2
+	DBF	D1,LAB_008F
+	MOVEQ	#102,D5
+	MOVE.L	28654(A5),D1
+	BSR.W	LAB_00A9
+	CMPI.L	#$000000c5,D1
+	LEA	LAB_007D(PC),A0
+	CMPI.L	#$000000da,D0
+	ADD.L	D1,D6
+LAB_0090:
+	LEA	LAB_0053,A2
+	DBF	D6,LAB_0090
+	ADD.L	D6,D1
+	MOVE.W	14886(A5),26322(A5)
+	ADDQ.L	#6,A7
+	ADD.L	D0,D5
+LAB_0091:
+	BSR.W	LAB_00A9
+LAB_0092:
+	BNE.S	LAB_0091
+	BNE.S	LAB_0092
+	BSR.W	LAB_009C
+	CMPI.L	#$00000044,D6
+	LEA	LAB_0133,A4
+LAB_0093:
+	BSR.W	LAB_00A9
+LAB_0094:
+	DBF	D4,LAB_0093
+LAB_0095:
+	DBF	D4,LAB_0094
+	DBF	D1,LAB_0095
+LAB_0096:
+	ADD.L	D5,D5
+LAB_0097:
+	DBF	D5,LAB_0096
+	DBF	D7,LAB_0097
+LAB_0098:
+	BRA.S	LAB_0099
+	DC.B	"dos.library",0
+LAB_0099:
+	DBF	D0,LAB_0098
+	CMP.L	#$00004aaa,D4
+LAB_009A:
+	BNE.S	LAB_0099
+	BNE.S	LAB_009A
+	BSR.W	LAB_00A9
+	BRA.S	LAB_009B
+	DC.B	"Error: ",0
+LAB_009B:
+	MOVE.W	8940(A5),169(A5)
+	LEA	LAB_0086(PC),A4
+	ADD.L	D6,D0
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_009C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00A9
+	CMP.L	#$00007886,D0
+	TST.L	D7
+LAB_009D:
+	MOVEQ	#69,D5
+LAB_009E:
+	DBF	D3,LAB_009D
+	CMPI.L	#$000000e7,D5
+	BNE.S	LAB_009E
+	MOVE.L	D1,D2
+	MOVE.L	#$00000960,-(A7)
+	JSR	LAB_00A9
+LAB_009F:
+	CMP.L	#$00009c4f,D1
+	DBF	D7,LAB_009F
+	LEA	LAB_0056(PC),A4
+	JSR	-144(A6)
+	CMPI.L	#$0000006a,D1
+	BSR.W	LAB_00A9
+LAB_00A0:
+	MOVEQ	#-85,D0
+LAB_00A1:
+	DBF	D0,LAB_00A0
+	DBF	D4,LAB_00A1
+	BNE.S	LAB_00A0
+LAB_00A2:
+	MOVE.W	22018(A5),6702(A5)
+	DBF	D2,LAB_00A2
+LAB_00A3:
+	MOVE.L	#$000008d2,-(A7)
+LAB_00A4:
+	MOVE.L	#$000009b6,-(A7)
+	DBF	D6,LAB_00A4
+	CMP.L	#$00003cae,D4
+	MOVEQ	#-80,D6
+	MOVE.L	D3,D6
+LAB_00A5:
+	CMP.L	#$00006be7,D6
+	ADDQ.L	#7,A6
+	MOVE.W	12977(A5),15252(A5)
+LAB_00A6:
+	BNE.S	LAB_00A5
+	DBF	D6,LAB_00A6
+LAB_00A7:
+	JSR	-174(A6)
+LAB_00A8:
+	BNE.S	LAB_00A7
+	BNE.S	LAB_00A8
+	BSR.W	LAB_00A9
+	MOVE.L	D1,D1
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00A9:
+	JSR	LAB_00B6
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+	DC.L	$1bed71db
+	DC.W	$2b48
+LAB_00AA:
+	DC.L	$ccef0000,$021014c5,$69187061,$0e5b603c
+	DC.L	$5273469e,$9d13690b,$8b1d3569,$a2ba6ed4
+	DC.L	$5f457d3b,$4a5e0d84,$35282637,$80a10000
+	DC.L	$0a54576f
+LAB_00AB:
+	DC.L	$726b6265,$6e636800,$2e4850de,$52656164
+	DC.L	$792e0000,$4e7307aa,$3ddec549,$70dc95b9
+	DC.L	$572b4847
+	DS.W	1
+LAB_00AC:
+	DC.L	$09023c99,$6a4c477f,$84792172,$e09628c0
+	DC.L	$674a4572,$726f723a,$200008e9,$d2596f81
+	DC.L	$6fa852cd,$42bb1269,$a2ef399b,$40d70000
+	DC.L	$06bc0000,$0d62615a
+	DC.W	$8a73
+LAB_00AD:
+	DC.L	$7352e688,$000009c2,$696e7475,$6974696f
+	DC.L	$6e2e6c69,$62726172,$790017ed,$eb24584d
+LAB_00AE:
+	DC.L	$5f1e0162
+	DC.W	$6179
+LAB_00AF:
+	DC.L	$5d646286,$5a03cf2d,$0571800d
+	DC.W	$3071
+LAB_00B0:
+	DC.L	$f4380413,$e6e36ec5,$46bc0000,$09b85dda
+	DC.L	$a5bb4236,$14a524a0,$cca721ed,$c4781be3
+	DC.L	$89977716,$433961a8,$331f7040,$99e730e6
+	DC.L	$03b63d52,$ebcb35e2,$768b6e96
+	DC.W	$6b17
+LAB_00B1:
+	DC.L	$4851d4a9,$32a4b794,$0405a048,$1ee0f41e
+	DC.L	$1c1a5d7d,$128c1443
+	DC.W	$6390
+LAB_00B2:
+	DC.L	$725c65cd,$9e906b49,$f0fb0000
+	DC.W	$0bca
+LAB_00B3:
+	DC.L	$2bffa838,$5f37bf4f,$7310e7ed,$19c03376
+	DC.L	$1085ade4,$325b583b,$00000970,$56a30d99
+	DC.L	$2d701eb5,$104b6c82,$646f732e,$6c696272
+	DC.L	$61727900,$74271696,$52656164
+	DC.W	$792e
+LAB_00B4:
+	DC.L	$0000696e,$74756974,$696f6e2e
+LAB_00B5:
+	DC.L	$6c696272,$61727900,$31b28d61,$70813d6f
+	DC.L	$15e39c58,$0c955e0e,$75101c99,$00a3ad97
+	DC.L	$2c91b2f4,$7590a3e2,$170d3926,$52716e20
+	DC.L	$64995f55,$0518c420,$7e3887d2,$40b991a6
+	DC.L	$67726170,$68696373,$2e6c6962,$72617279
+	DC.L	$00001f14,$c30d024b,$158a0000
+	DS.L	9
+	DS.W	1
+LAB_00B6:
+	LINK.W	A5,#-4
+	BSR.W	LAB_00BD
+LAB_00B7:
+	JSR	-726(A6)
+	CMPI.L	#$00000090,D7
+	MOVE.L	10716(A5),D2
+	BSR.W	LAB_00CA
+	MOVEQ	#78,D7
+LAB_00B8:
+	MOVE.W	20175(A5),27538(A5)
+	BNE.S	LAB_00B8
+LAB_00B9:
+	ADD.L	D4,D2
+	BSR.W	LAB_00CA
+	LEA	LAB_00B7+2(PC),A2
+	BRA.S	LAB_00BA
+	DC.B	"topaz.font",0,0
+LAB_00BA:
+	MOVE.W	12575(A5),2749(A5)
+	JSR	LAB_00CF
+LAB_00BB:
+	MOVE.W	23271(A5),30866(A5)
+	ADD.L	D3,D7
+	BSR.W	LAB_00BD
+LAB_00BC:
+	ADD.L	D0,D7
+	BNE.S	LAB_00BC
+	MOVE.W	9041(A5),2647(A5)
+	UNLK	A5
+	RTS
+LAB_00BD:
+	LINK.W	A5,#-24
+	BSR.W	LAB_00CA
+LAB_00BE:
+	TST.L	D2
+	DBF	D3,LAB_00BE
+	LEA	LAB_00B1,A4
+	BSR.W	LAB_00DB
+LAB_00BF:
+	MOVE.L	524(A5),D2
+LAB_00C0:
+	DBF	D4,LAB_00BF
+LAB_00C1:
+	MOVE.L	#$0000076a,-(A7)
+LAB_00C3:
+	DBF	D1,LAB_00C1
+	BNE.S	LAB_00C0
+	MOVE.L	8662(A5),D3
+LAB_00C4:
+	BNE.S	LAB_00C3
+LAB_00C5:
+	JSR	LAB_00CA
+	BSR.W	LAB_00CF
+	JSR	-324(A6)
+	JSR	-204(A6)
+	BSR.W	LAB_00CA
+	BSR.W	LAB_00DB
+	LEA	LAB_00BB+4(PC),A0
+LAB_00C6:
+	JSR	LAB_00CF
+	DBF	D1,LAB_00C6
+	MOVE.L	D7,D5
+	LEA	LAB_00BD(PC),A2
+LAB_00C7:
+	BSR.W	LAB_00CA
+	DBF	D4,LAB_00C7
+	BSR.W	LAB_00CF
+LAB_00C8:
+	BSR.W	LAB_00CA
+	ADDQ.L	#2,A6
+	LEA	LAB_00AD,A0
+LAB_00C9:
+	BNE.S	LAB_00C8
+	DBF	D4,LAB_00C9
+	JSR	LAB_00CF
+	UNLK	A5
+	RTS
+LAB_00CA:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00CF
+	BRA.S	LAB_00CB
+	DC.B	"graphics.library",0,0
+LAB_00CB:
+	BSR.W	LAB_00CF
+LAB_00CD:
+	BNE.S	LAB_00CB
+LAB_00CE:
+	DBF	D6,LAB_00CD
+	DBF	D5,LAB_00CE
+	BSR.W	LAB_00DB
+	MOVE.L	D1,D6
+	BSR.W	LAB_00DB
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00CF:
+	BSR.W	LAB_00DB
+	MOVE.L	314(A5),D0
+	BSR.W	LAB_00EC
+	CMPI.L	#$00000061,D2
+LAB_00D0:
+	MOVEQ	#-85,D2
+	DBF	D2,LAB_00D0
+	MOVE.W	25320(A5),29485(A5)
+	JSR	-834(A6)
+	BRA.S	LAB_00D2
+LAB_00D1:
+	DC.B	"topaz.font",0,0
+LAB_00D2:
+	JSR	-402(A6)
+	DBF	D5,LAB_00D2
+	LEA	LAB_00AC,A0
+	MOVE.L	28406(A5),D2
+	LEA	LAB_0010,A4
+	JSR	LAB_00EC
+LAB_00D3:
+	BSR.W	LAB_00EC
+	BNE.S	LAB_00D3
+	MOVE.L	D5,D4
+LAB_00D4:
+	BSR.W	LAB_00F5
+	DBF	D5,LAB_00D4
+LAB_00D5:
+	LEA	LAB_0089+4,A0
+	BNE.S	LAB_00D4
+LAB_00D6:
+	MOVE.W	10799(A5),25531(A5)
+	CMPI.L	#$0000004c,D7
+	JSR	LAB_00F5
+LAB_00D7:
+	CMPI.L	#$0000000e,D3
+	MOVEQ	#106,D1
+	LEA	LAB_0099,A4
+	MOVE.L	#$000005a6,-(A7)
+	LEA	LAB_00B2,A0
+LAB_00D8:
+	CMPI.L	#$00000033,D2
+	CMP.L	#$0000a62f,D4
+	BNE.S	LAB_00D8
+	MOVEQ	#-104,D2
+	MOVE.L	27550(A5),D3
+	MOVEQ	#92,D6
+LAB_00D9:
+	BSR.W	LAB_00EC
+LAB_00DA:
+	BNE.S	LAB_00D9
+	DBF	D6,LAB_00DA
+	BSR.W	LAB_00EC
+	MOVE.W	16108(A5),32145(A5)
+	JSR	-390(A6)
+	CMPI.L	#$00000034,D4
+	RTS
+LAB_00DB:
+	LINK.W	A5,#-100
+LAB_00DC:
+	BSR.W	LAB_00EC
+	DBF	D6,LAB_00DC
+	JSR	-858(A6)
+	BSR.W	LAB_00F7
+	MOVE.W	18739(A5),8801(A5)
+	CMPI.L	#$000000f9,D1
+LAB_00DD:
+	BSR.W	LAB_00F7
+	DBF	D6,LAB_00DD
+LAB_00DE:
+	LEA	LAB_00CB+2(PC),A2
+	BNE.S	LAB_00DE
+	BNE.S	LAB_00DE
+	MOVE.W	28214(A5),5994(A5)
+	JSR	-36(A6)
+LAB_00DF:
+	BSR.W	LAB_00F7
+LAB_00E0:
+	DBF	D3,LAB_00DF
+	DBF	D3,LAB_00E0
+LAB_00E1:
+	BSR.W	LAB_00EC
+LAB_00E2:
+	DBF	D7,LAB_00E1
+	BNE.S	LAB_00E2
+	BNE.S	LAB_00E2
+	ADDQ.L	#1,A5
+	BSR.W	LAB_00EC
+LAB_00E3:
+	LEA	LAB_00D5(PC),A6
+LAB_00E4:
+	DBF	D7,LAB_00E3
+	MOVEQ	#-115,D6
+LAB_00E5:
+	BNE.S	LAB_00E4
+LAB_00E6:
+	MOVE.L	D3,D1
+	DBF	D6,LAB_00E6
+	JSR	LAB_00F5
+	CMPI.L	#$00000058,D0
+LAB_00E7:
+	JSR	-552(A6)
+	ADDQ.L	#6,A7
+	BNE.S	LAB_00E7
+	ADDQ.L	#1,A2
+LAB_00E9:
+	LEA	LAB_00D1(PC),A4
+LAB_00EA:
+	DBF	D4,LAB_00E9
+	BNE.S	LAB_00EA
+LAB_00EB:
+	UNLK	A5
+	RTS
+LAB_00EC:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00F5
+	TST.L	D3
+	BRA.S	LAB_00ED
+	DC.B	"Workbench",0
+LAB_00ED:
+	BRA.S	LAB_00EE
+	DC.B	"Out of memory",0
+LAB_00EE:
+	DBF	D3,LAB_00ED
+	BNE.S	LAB_00EE
+	ADD.L	D3,D0
+	BNE.S	LAB_00EE
+LAB_00EF:
+	LEA	LAB_00EB(PC),A2
+	MOVE.L	#$00000912,-(A7)
+	MOVEQ	#-89,D2
+LAB_00F0:
+	BNE.S	LAB_00EF
+LAB_00F1:
+	DBF	D5,LAB_00F0
+	BNE.S	LAB_00F1
+	BRA.S	LAB_00F2
+	DC.B	"topaz.font",0,0
+LAB_00F2:
+	ADD.L	D3,D5
+	DBF	D0,LAB_00F2
+LAB_00F3:
+	ADDQ.L	#6,A1
+LAB_00F4:
+	DBF	D7,LAB_00F3
+	MOVEQ	#-118,D0
+	BNE.S	LAB_00F4
+	BSR.W	LAB_00F7
+	MOVE.L	27766(A5),D4
+	MOVEQ	#95,D5
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00F5:
+	LINK.W	A5,#-180
+	BSR.W	LAB_00F7
+	ADD.L	D7,D0
+	LEA	LAB_00B5,A0
+	JSR	-444(A6)
+	MOVE.W	24711(A5),30854(A5)
+	LEA	LAB_00E5(PC),A2
+	MOVE.W	19529(A5),26257(A5)
+	BRA.S	LAB_00F6
+	DC.B	"intuition.library",0
+LAB_00F6:
+	BSR.W	LAB_0105
+	ADDQ.L	#5,A2
+	BSR.W	LAB_00F7
+	MOVE.L	28970(A5),D5
+	UNLK	A5
+	RTS
+LAB_00F7:
+	LINK.W	A5,#-244
+	BSR.W	LAB_00FB
+	TST.L	D7
+	TST.L	D1
+LAB_00F8:
+	BSR.W	LAB_00FB
+LAB_00F9:
+	MOVE.W	14755(A5),27920(A5)
+	BNE.S	LAB_00F9
+	CMP.L	#$0000db70,D2
+LAB_00FA:
+	BSR.W	LAB_010A
+	DBF	D5,LAB_00FA
+	UNLK	A5
+	RTS
+LAB_00FB:
+	LINK.W	A5,#-124
+	BSR.W	LAB_0105
+	MOVE.L	D7,D0
+	ADD.L	D7,D1
+	LEA	LAB_00B9(PC),A4
+	BSR.W	LAB_0105
+LAB_00FC:
+	CMPI.L	#$00000035,D4
+	DBF	D5,LAB_00FC
+	MOVE.L	D6,D0
+	MOVEQ	#69,D2
+	BSR.W	LAB_010A
+	BSR.W	LAB_010A
+	ADD.L	D5,D4
+	MOVE.W	27271(A5),26258(A5)
+	LEA	LAB_00C1+4(PC),A0
+LAB_00FD:
+	BRA.S	LAB_00FE
+	DC.B	"Workbench",0
+LAB_00FE:
+	DBF	D5,LAB_00FD
+	JSR	LAB_011B
+	BSR.W	LAB_0105
+LAB_00FF:
+	CMP.L	#$00007cf9,D0
+	DBF	D0,LAB_00FF
+LAB_0100:
+	ADD.L	D1,D6
+LAB_0101:
+	BNE.S	LAB_0100
+	BNE.S	LAB_0101
+LAB_0102:
+	MOVE.W	30940(A5),5677(A5)
+	DBF	D1,LAB_0102
+LAB_0103:
+	ADDQ.L	#5,A3
+	DBF	D0,LAB_0103
+	ADD.L	D7,D6
+	JSR	-432(A6)
+	MOVE.L	D6,D6
+	MOVE.L	D6,D2
+	BRA.S	LAB_0104
+	DC.B	"graphics.library",0,0
+LAB_0104:
+	UNLK	A5
+	RTS
+LAB_0105:
+	LINK.W	A5,#-256
+LAB_0106:
+	BSR.W	LAB_010A
+	DBF	D6,LAB_0106
+LAB_0107:
+	MOVE.L	D7,D1
+	DBF	D7,LAB_0107
+LAB_0108:
+	JSR	-132(A6)
+LAB_0109:
+	DBF	D1,LAB_0108
+	DBF	D4,LAB_0109
+	MOVE.L	4070(A5),D6
+	BNE.S	LAB_0109
+	MOVE.W	22392(A5),24790(A5)
+	MOVEQ	#6,D4
+	CMP.L	#$00006c9c,D6
+	MOVE.L	#$00000ff2,-(A7)
+	LEA	LAB_00CD(PC),A2
+	UNLK	A5
+	RTS
+LAB_010A:
+	BSR.W	LAB_011B
+	MOVE.W	11834(A5),31462(A5)
+	TST.L	D3
+LAB_010B:
+	ADDQ.L	#7,A3
+	CMP.L	#$0000065b,D7
+	BSR.W	LAB_0121
+	BNE.S	LAB_010B
+	MOVE.L	D0,D6
+	MOVE.L	9092(A5),D5
+	MOVE.L	D0,D0
+	BSR.W	LAB_0121
+LAB_010C:
+	MOVE.L	17522(A5),D4
+	BNE.S	LAB_010C
+LAB_010D:
+	MOVEQ	#-28,D4
+	MOVE.W	27057(A5),26402(A5)
+	BNE.S	LAB_010D
+	BSR.W	LAB_011B
+LAB_010E:
+	ADD.L	D6,D6
+LAB_010F:
+	BNE.S	LAB_010E
+	BNE.S	LAB_010F
+LAB_0110:
+	JSR	LAB_011B
+	DBF	D1,LAB_0110
+LAB_0111:
+	BSR.W	LAB_0121
+LAB_0112:
+	DBF	D5,LAB_0111
+	DBF	D0,LAB_0112
+LAB_0113:
+	BSR.W	LAB_012E
+LAB_0114:
+	DBF	D7,LAB_0113
+LAB_0115:
+	MOVE.L	D5,D5
+	MOVE.W	11906(A5),2911(A5)
+LAB_0116:
+	BNE.S	LAB_0114
+	BNE.S	LAB_0115
+	MOVE.L	D6,D0
+LAB_0117:
+	BNE.S	LAB_0116
+	MOVE.W	22146(A5),30383(A5)
+	ADDQ.L	#3,A3
+LAB_0118:
+	BNE.S	LAB_0117
+LAB_0119:
+	BNE.S	LAB_0118
+	BNE.S	LAB_0119
+	BSR.W	LAB_0121
+	MOVE.L	#$00000130,-(A7)
+LAB_011A:
+	JSR	-744(A6)
+	BSR.W	LAB_012E
+	BNE.S	LAB_011A
+	RTS
+LAB_011B:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_011C:
+	BSR.W	LAB_0121
+	BSR.W	LAB_012E
+LAB_011D:
+	TST.L	D1
+	BNE.S	LAB_011C
+	BNE.S	LAB_011D
+	JSR	-678(A6)
+	MOVE.L	14488(A5),D5
+	JSR	-402(A6)
+LAB_011E:
+	MOVEQ	#-63,D4
+	DBF	D4,LAB_011E
+	MOVE.L	D4,D0
+	MOVE.L	D4,D3
+	ADD.W	D0,D0
+	MOVE.W	LAB_011F(PC,D0.W),D0
+	JMP	LAB_011F(PC,D0.W)
+LAB_011F:
+	DC.L	$0006000a,$000e7000
+LAB_0120:
+	DC.L	$4e757001,$4e757002
+	DC.W	$4e75
+LAB_0121:
+	LINK.W	A5,#-168
+	BSR.W	LAB_012E
+	TST.L	D5
+	LEA	LAB_00AF,A0
+LAB_0122:
+	MOVE.W	7772(A5),8032(A5)
+LAB_0123:
+	DBF	D6,LAB_0122
+	BSR.W	LAB_012E
+	MOVEQ	#79,D1
+	BNE.S	LAB_0123
+LAB_0124:
+	BSR.W	LAB_0134
+	DBF	D1,LAB_0124
+LAB_0125:
+	MOVE.L	D6,D3
+	MOVE.L	D3,D1
+	MOVE.L	21810(A5),D0
+	BNE.S	LAB_0125
+	MOVE.L	21360(A5),D0
+	BRA.S	LAB_0126
+	DC.B	"dos.library",0
+LAB_0126:
+	MOVEQ	#-89,D7
+	LEA	LAB_00C4(PC),A4
+	MOVE.W	21733(A5),21772(A5)
+	LEA	LAB_00F8(PC),A2
+	JSR	-30(A6)
+	MOVE.L	D5,D7
+	MOVEQ	#-44,D1
+	MOVE.L	D5,D4
+	MOVE.L	13752(A5),D2
+LAB_0127:
+	LEA	LAB_00DF(PC),A0
+LAB_0128:
+	DBF	D4,LAB_0127
+	CMP.L	#$00008064,D0
+	JSR	-708(A6)
+LAB_0129:
+	BNE.S	LAB_0128
+	DBF	D3,LAB_0129
+LAB_012A:
+	BSR.W	LAB_012E
+	BNE.S	LAB_012A
+	ADDQ.L	#2,A0
+	BSR.W	LAB_0136
+LAB_012B:
+	CMPI.L	#$000000d2,D5
+LAB_012C:
+	DBF	D1,LAB_012B
+	DBF	D4,LAB_012C
+	MOVE.W	14145(A5),24943(A5)
+LAB_012D:
+	JSR	-810(A6)
+	DBF	D1,LAB_012D
+	ADD.L	D2,D4
+	UNLK	A5
+	RTS
+LAB_012E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0134
+	LEA	LAB_00AE,A0
+	LEA	LAB_00D6+4(PC),A6
+	MOVE.L	#$000000c4,-(A7)
+	CMP.L	#$00003cb2,D3
+	MOVE.W	21221(A5),27392(A5)
+	MOVE.L	5170(A5),D7
+	CMP.L	#$000031fb,D0
+LAB_012F:
+	MOVEQ	#-115,D7
+LAB_0130:
+	DBF	D4,LAB_012F
+	DBF	D5,LAB_0130
+	BNE.S	LAB_0130
+	BSR.W	LAB_0136
+	JSR	LAB_0145
+	BSR.W	LAB_0145
+LAB_0131:
+	ADD.L	D3,D1
+LAB_0132:
+	DBF	D0,LAB_0131
+	MOVE.L	11782(A5),D1
+	BSR.W	LAB_0136
+	BNE.S	LAB_0132
+	MOVE.W	427(A5),3432(A5)
+	BSR.W	LAB_0134
+	MOVE.W	12308(A5),4468(A5)
+	BSR.W	LAB_0145
+	MOVE.W	15312(A5),13223(A5)
+	LEA	LAB_00E7+2(PC),A4
+LAB_0133:
+	LEA	LAB_00AB,A6
+	DBF	D1,LAB_0133
+	CMPI.L	#$0000003d,D4
+	MOVE.L	D3,D6
+	BSR.W	LAB_0134
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0134:
+	LINK.W	A5,#-148
+	BSR.W	LAB_0136
+	LEA	LAB_0075+2,A6
+LAB_0135:
+	BSR.W	LAB_0136
+	DBF	D5,LAB_0135
+	BNE.S	LAB_0135
+	UNLK	A5
+	RTS
+LAB_0136:
+	LINK.W	A5,#-160
+LAB_0137:
+	BSR.W	LAB_0145
+	DBF	D1,LAB_0137
+LAB_0138:
+	MOVEQ	#62,D5
+	MOVE.L	7306(A5),D3
+LAB_0139:
+	BSR.W	LAB_0145
+	BNE.S	LAB_0138
+	MOVE.L	D5,D0
+	BNE.S	LAB_0139
+LAB_013A:
+	MOVE.L	11300(A5),D1
+	DBF	D6,LAB_013A
+LAB_013B:
+	ADD.L	D2,D2
+	BNE.S	LAB_013B
+LAB_013C:
+	BSR.W	LAB_014E
+	DBF	D2,LAB_013C
+	BSR.W	LAB_014E
+	JSR	LAB_014E
+LAB_013D:
+	JSR	-300(A6)
+	DBF	D6,LAB_013D
+	ADD.L	D3,D3
+	LEA	LAB_00D7+4(PC),A2
+LAB_013E:
+	JSR	-570(A6)
+	DBF	D6,LAB_013E
+LAB_013F:
+	BNE.S	LAB_013E
+LAB_0140:
+	DBF	D6,LAB_013F
+	BRA.S	LAB_0141
+	DC.B	"dos.library",0
+LAB_0141:
+	ADD.L	D5,D4
+	BNE.S	LAB_0140
+	BSR.W	LAB_014E
+LAB_0142:
+	JSR	-648(A6)
+	DBF	D7,LAB_0142
+	BSR.W	LAB_014E
+	MOVE.L	D4,D6
+LAB_0143:
+	BRA.S	LAB_0144
+	DC.B	"dos.library",0
+LAB_0144:
+	DBF	D3,LAB_0143
+	UNLK	A5
+	RTS
+LAB_0145:
+	LINK.W	A5,#-116
+	BSR.W	LAB_014E
+	CMPI.L	#$0000001a,D1
+	TST.L	D6
+LAB_0146:
+	JSR	LAB_014E
+	DBF	D7,LAB_0146
+	CMPI.L	#$000000d0,D2
+	MOVEQ	#26,D7
+LAB_0147:
+	MOVE.L	D6,D4
+	BSR.W	LAB_014E
+	BNE.S	LAB_0147
+	MOVEQ	#-128,D1
+	JSR	LAB_014E
+	BRA.S	LAB_0148
+	DC.B	"%s: %ld",10,0,0
+LAB_0148:
+	MOVEQ	#105,D4
+	CMPI.L	#$0000009b,D4
+	JSR	-894(A6)
+	CMPI.L	#$00000019,D3
+	LEA	LAB_00A3,A6
+	BSR.W	LAB_014E
+	CMP.L	#$00003f25,D4
+LAB_0149:
+	BSR.W	LAB_014E
+	DBF	D1,LAB_0149
+	LEA	LAB_007C,A0
+	JSR	LAB_014E
+	CMP.L	#$00005e38,D3
+	BSR.W	LAB_014E
+LAB_014A:
+	ADDQ.L	#5,A6
+	DBF	D4,LAB_014A
+LAB_014B:
+	LEA	LAB_0144(PC),A0
+LAB_014C:
+	DBF	D3,LAB_014B
+	DBF	D3,LAB_014C
+LAB_014D:
+	JSR	-180(A6)
+	BNE.S	LAB_014D
+	MOVE.L	#$000003c0,-(A7)
+	ADDQ.L	#7,A3
+	BSR.W	LAB_014E
+	UNLK	A5
+	RTS
+LAB_014E:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+	END
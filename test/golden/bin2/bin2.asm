@@ -0,0 +1,1725 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+	MC68040
+
+
+
+	ORG	$0
+
+SECSTRT_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;000: 48e73f3e
+LAB_0000:
+	BSR.W	LAB_0011		;004: 610000aa
+	MOVE.L	D4,D0			;008: 2004
+	BSR.W	LAB_0023		;00a: 6100015c
+LAB_0001:
+	BSR.W	LAB_0011		;00e: 610000a0
+	ADD.L	D2,D2			;012: d482
+	JSR	(-30,A6)		;014: 4eaeffe2
+LAB_0002:
+	BSR.W	LAB_0011		;018: 61000096
+	BNE.S	LAB_0002		;01c: 66fa
+LAB_0003:
+	MOVE.L	(11602,A5),D3		;01e: 262d2d52
+	DBF	D4,LAB_0003		;022: 51ccfffa
+LAB_0004:
+	CMPI.L	#$000000b5,D1		;026: 0c81000000b5
+	DBF	D4,LAB_0004		;02c: 51ccfff8
+LAB_0005:
+	MOVE.W	(12732,A5),(17119,A5)	;030: 3b6d31bc42df
+LAB_0006:
+	CMP.L	#$00007e32,D6		;036: bcbc00007e32
+	JSR	(-366,A6)		;03c: 4eaefe92
+	BNE.S	LAB_0006		;040: 66f4
+LAB_0007:
+	ADD.L	D7,D2			;042: d487
+	DBF	D2,LAB_0007		;044: 51cafffc
+	BSR.W	LAB_0023		;048: 6100011e
+	MOVE.L	(20022,A5),D5		;04c: 2a2d4e36
+	JSR	(-90,A6)		;050: 4eaeffa6
+	JSR	(-768,A6)		;054: 4eaefd00
+	JSR	(-96,A6)		;058: 4eaeffa0
+	LEA	(LAB_0000,PC),A4	;05c: 49faffa6
+LAB_0008:
+	ADDQ.L	#7,A0			;060: 5e88
+	LEA	(LAB_0005+2,PC),A6	;062: 4dfaffce
+	BNE.S	LAB_0008		;066: 66f8
+LAB_0009:
+	BSR.W	LAB_0035		;068: 610001ae
+	DBF	D0,LAB_0009		;06c: 51c8fffa
+LAB_000A:
+	BSR.W	LAB_0023		;070: 610000f6
+LAB_000B:
+	MOVE.L	(16094,A5),D7		;074: 2e2d3ede
+	BNE.S	LAB_000A		;078: 66f6
+	BNE.S	LAB_000B		;07a: 66f8
+	BRA.S	LAB_000C		;07c: 600a
+	SUBQ.W	#3,(29291,A7)		;07e: 576f726b
+	DC.W	$6265			;082
+	DC.W	$6e63			;084
+	DC.W	$6800			;086
+LAB_000C:
+	CMP.L	#$00006441,D1		;088: b2bc00006441
+	BNE.S	LAB_000C		;08e: 66f8
+	ADDQ.L	#4,A1			;090: 5889
+	BSR.W	LAB_0011		;092: 6100001c
+LAB_000D:
+	BSR.W	LAB_0035		;096: 61000180
+LAB_000E:
+	MOVE.L	(1210,A5),D0		;09a: 202d04ba
+	DBF	D1,LAB_000E		;09e: 51c9fffa
+	BNE.S	LAB_000D		;0a2: 66f2
+LAB_000F:
+	BNE.S	LAB_000E		;0a4: 66f4
+	DBF	D0,LAB_000F		;0a6: 51c8fffc
+LAB_0010:
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0aa: 4cdf7cfc
+	RTS				;0ae: 4e75
+LAB_0011:
+	LINK.W	A5,#-176		;0b0: 4e55ff50
+	BSR.W	LAB_0023		;0b4: 610000b2
+LAB_0012:
+	LEA	(LAB_0010+2,PC),A4	;0b8: 49fafff2
+	DBF	D0,LAB_0012		;0bc: 51c8fffa
+LAB_0013:
+	MOVE.W	(27121,A5),(17250,A5)	;0c0: 3b6d69f14362
+LAB_0014:
+	DBF	D4,LAB_0013		;0c6: 51ccfff8
+	JSR	(-534,A6)		;0ca: 4eaefdea
+	LEA	(LAB_0014,PC),A0	;0ce: 41fafff6
+	MOVE.L	D7,D7			;0d2: 2e07
+	MOVE.L	(4036,A5),D6		;0d4: 2c2d0fc4
+	BSR.W	LAB_0035		;0d8: 6100013e
+	MOVE.L	(6378,A5),D3		;0dc: 262d18ea
+	CMPI.L	#$00000014,D3		;0e0: 0c8300000014
+	MOVE.L	D7,D5			;0e6: 2a07
+	ADDQ.L	#1,A7			;0e8: 528f
+	MOVE.L	D0,D2			;0ea: 2400
+LAB_0015:
+	CMP.L	#$0000175e,D1		;0ec: b2bc0000175e
+	DBF	D0,LAB_0015		;0f2: 51c8fff8
+	BSR.W	LAB_0043		;0f6: 610001a0
+	ADD.L	D1,D5			;0fa: da81
+	MOVE.L	D4,D3			;0fc: 2604
+LAB_0016:
+	ADD.L	D0,D2			;0fe: d480
+	BNE.S	LAB_0016		;100: 66fc
+LAB_0017:
+	BRA.S	LAB_0018		;102: 600c
+	DC.W	$646f			;104
+	DC.W	$732e			;106
+	DC.W	$6c69			;108
+	BHI.S	LAB_0027+2		;10a: 6272
+	BSR.S	LAB_0027+4		;10c: 6172
+	DC.W	$7900			;10e
+LAB_0018:
+	BNE.S	LAB_0017		;110: 66f0
+	BSR.W	LAB_0035		;112: 61000104
+LAB_0019:
+	JSR	(-192,A6)		;116: 4eaeff40
+	BNE.S	LAB_0019		;11a: 66fa
+LAB_001A:
+	LEA	LAB_00BA,A4		;11c: 49f900000762
+LAB_001B:
+	DBF	D7,LAB_001A		;122: 51cffff8
+LAB_001C:
+	DBF	D3,LAB_001B		;126: 51cbfffa
+	CMPI.L	#$0000007b,D1		;12a: 0c810000007b
+	ADDQ.L	#2,A7			;130: 548f
+LAB_001D:
+	BRA.S	LAB_001E		;132: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;134: 25733a20256c
+	BCC.S	LAB_001F+2		;13a: 640a
+	DC.W	$0000			;13c
+LAB_001E:
+	BNE.S	LAB_001D		;13e: 66f2
+	BSR.W	LAB_0043		;140: 61000156
+LAB_001F:
+	MOVE.W	(26788,A5),(12405,A5)	;144: 3b6d68a43075
+LAB_0020:
+	CMPI.L	#$000000e9,D2		;14a: 0c82000000e9
+LAB_0021:
+	DBF	D4,LAB_0020		;150: 51ccfff8
+LAB_0022:
+	DBF	D0,LAB_0021		;154: 51c8fffa
+	DBF	D0,LAB_0022		;158: 51c8fffa
+	BSR.W	LAB_0043		;15c: 6100013a
+	MOVEQ	#-72,D5			;160: 7ab8
+	ADDQ.L	#7,A5			;162: 5e8d
+	UNLK	A5			;164: 4e5d
+	RTS				;166: 4e75
+LAB_0023:
+	LINK.W	A5,#-116		;168: 4e55ff8c
+LAB_0024:
+	BSR.W	LAB_0035		;16c: 610000aa
+LAB_0025:
+	MOVE.W	(12451,A5),(21762,A5)	;170: 3b6d30a35502
+LAB_0026:
+	CMP.L	#$0000445c,D7		;176: bebc0000445c
+LAB_0027:
+	CMP.L	#$0000af63,D5		;17c: babc0000af63
+LAB_0029:
+	BNE.S	LAB_0025		;182: 66ec
+	BRA.S	LAB_002A		;184: 6012
+	BEQ.S	LAB_0031+2		;186: 6772
+	BSR.S	LAB_0031+2		;188: 6170
+	DC.W	$6869			;18a
+	DC.W	$6373			;18c
+	MOVEA.L	(26978,A4),A7		;18e: 2e6c6962
+	MOVEQ	#97,D1			;192: 7261
+	MOVEQ	#121,D1			;194: 7279
+	DC.W	$0000			;196
+LAB_002A:
+	BRA.S	LAB_002B		;198: 6012
+	BVS.S	LAB_0033		;19a: 696e
+	MOVEQ	#117,D2			;19c: 7475
+	BVS.S	LAB_0034		;19e: 6974
+	DC.W	$696f			;1a0
+	BGT.S	LAB_002E+2		;1a2: 6e2e
+	DC.W	$6c69			;1a4
+	BHI.S	LAB_0035+2		;1a6: 6272
+	BSR.S	LAB_0037		;1a8: 6172
+	DC.W	$7900			;1aa
+LAB_002B:
+	BSR.W	LAB_0053		;1ac: 6100018a
+	DBF	D3,LAB_002B		;1b0: 51cbfffa
+	MOVEQ	#92,D0			;1b4: 705c
+	CMP.L	#$0000b361,D1		;1b6: b2bc0000b361
+	BRA.S	LAB_002D		;1bc: 600a
+LAB_002C:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;1be: 25733a20256c
+	BCC.S	LAB_002E		;1c4: 640a
+	DC.W	$0000			;1c6
+LAB_002D:
+	MOVE.W	(21223,A5),(11650,A5)	;1c8: 3b6d52e72d82
+	MOVE.L	D4,D6			;1ce: 2c04
+LAB_002E:
+	MOVE.L	(29222,A5),D2		;1d0: 242d7226
+	CMPI.L	#$0000008f,D5		;1d4: 0c850000008f
+	BSR.W	LAB_0053		;1da: 6100015c
+	BSR.W	LAB_0043		;1de: 610000b8
+LAB_0030:
+	MOVE.W	(16134,A5),(22264,A5)	;1e2: 3b6d3f0656f8
+	DBF	D5,LAB_0030		;1e8: 51cdfff8
+	MOVE.W	(25234,A5),(2263,A5)	;1ec: 3b6d629208d7
+	MOVE.L	(30112,A5),D5		;1f2: 2a2d75a0
+	MOVE.L	D5,D2			;1f6: 2405
+LAB_0031:
+	MOVE.L	(24182,A5),D5		;1f8: 2a2d5e76
+	MOVE.L	(13840,A5),D0		;1fc: 202d3610
+LAB_0032:
+	ADD.L	D0,D7			;200: de80
+	BNE.S	LAB_0032		;202: 66fc
+	ADDQ.L	#5,A0			;204: 5a88
+	BSR.W	LAB_0035		;206: 61000010
+LAB_0033:
+	LEA	(LAB_0024+2,PC),A2	;20a: 45faff62
+	CMP.L	#$0000b3d4,D4		;20e: b8bc0000b3d4
+LAB_0034:
+	UNLK	A5			;214: 4e5d
+	RTS				;216: 4e75
+LAB_0035:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;218: 48e73f3e
+LAB_0037:
+	BSR.W	LAB_0043		;21c: 6100007a
+	BSR.W	LAB_0053		;220: 61000116
+	MOVE.W	(13771,A5),(28768,A5)	;224: 3b6d35cb7060
+LAB_0038:
+	ADDQ.L	#6,A5			;22a: 5c8d
+LAB_0039:
+	DBF	D5,LAB_0038		;22c: 51cdfffc
+LAB_003A:
+	BRA.S	LAB_003B		;230: 600a
+	SUBQ.W	#3,(29291,A7)		;232: 576f726b
+	DC.W	$6265			;236
+	DC.W	$6e63			;238
+	DC.W	$6800			;23a
+LAB_003B:
+	BRA.S	LAB_003D		;23c: 600e
+	DC.W	$4f75			;23e
+	MOVEQ	#32,D2			;240: 7420
+	BLE.S	LAB_0045		;242: 6f66
+	MOVEA.L	(25965,A5),A0		;244: 206d656d
+	BLE.S	LAB_0047		;248: 6f72
+LAB_003C:
+	DC.W	$7900			;24a
+LAB_003D:
+	BSR.W	LAB_0053		;24c: 610000ea
+	BNE.S	LAB_003A		;250: 66de
+	JSR	(-636,A6)		;252: 4eaefd84
+	LEA	(LAB_0011,PC),A4	;256: 49fafe58
+	LEA	(LAB_001C+2,PC),A0	;25a: 41fafecc
+	CMP.L	#$0000e59b,D6		;25e: bcbc0000e59b
+LAB_003E:
+	ADDQ.L	#1,A3			;264: 528b
+	DBF	D6,LAB_003E		;266: 51cefffc
+	ADDQ.L	#7,A5			;26a: 5e8d
+LAB_003F:
+	BRA.S	LAB_0040		;26c: 6008
+	DC.W	$4572			;26e
+	MOVEQ	#111,D1			;270: 726f
+	MOVEQ	#58,D1			;272: 723a
+	MOVE.L	D0,D0			;274: 2000
+LAB_0040:
+	ADDQ.L	#3,A4			;276: 568c
+	BNE.S	LAB_003F		;278: 66f2
+	MOVE.W	(26473,A5),(11495,A5)	;27a: 3b6d67692ce7
+LAB_0041:
+	CMPI.L	#$00000022,D5		;280: 0c8500000022
+LAB_0042:
+	DBF	D0,LAB_0041		;286: 51c8fff8
+	DBF	D1,LAB_0042		;28a: 51c9fffa
+	JSR	(-558,A6)		;28e: 4eaefdd2
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;292: 4cdf7cfc
+	RTS				;296: 4e75
+LAB_0043:
+	BSR.W	LAB_0053		;298: 6100009e
+	MOVEQ	#13,D5			;29c: 7a0d
+	JSR	(-66,A6)		;29e: 4eaeffbe
+	LEA	(LAB_0035+2,PC),A0	;2a2: 41faff76
+LAB_0044:
+	MOVE.L	(8160,A5),D5		;2a6: 2a2d1fe0
+LAB_0045:
+	ADD.L	D5,D7			;2aa: de85
+	ADD.L	D2,D7			;2ac: de82
+	MOVE.L	(14834,A5),D6		;2ae: 2c2d39f2
+LAB_0046:
+	ADDQ.L	#5,A0			;2b2: 5a88
+	ADD.L	D7,D7			;2b4: de87
+	MOVE.L	(22692,A5),D5		;2b6: 2a2d58a4
+	BNE.S	LAB_0046		;2ba: 66f6
+LAB_0047:
+	MOVE.W	(31558,A5),(31024,A5)	;2bc: 3b6d7b467930
+	ADDQ.L	#4,A5			;2c2: 588d
+LAB_0048:
+	BSR.W	LAB_0062		;2c4: 61000102
+	LEA	(LAB_0003,PC),A2	;2c8: 45fafd54
+	BSR.W	LAB_0053		;2cc: 6100006a
+	MOVE.L	D0,D7			;2d0: 2e00
+LAB_0049:
+	BRA.S	LAB_004A		;2d2: 6012
+	BVS.S	LAB_0054+4		;2d4: 696e
+	MOVEQ	#117,D2			;2d6: 7475
+	BVS.S	LAB_0056		;2d8: 6974
+	DC.W	$696f			;2da
+	BGT.S	LAB_004E		;2dc: 6e2e
+	DC.W	$6c69			;2de
+	BHI.S	LAB_0057+2		;2e0: 6272
+	BSR.S	LAB_0058		;2e2: 6172
+	DC.W	$7900			;2e4
+LAB_004A:
+	BNE.S	LAB_0049		;2e6: 66ea
+LAB_004B:
+	LEA	LAB_0122+2,A4		;2e8: 49f900000bde
+LAB_004C:
+	ADD.L	D1,D1			;2ee: d281
+	DBF	D0,LAB_004C		;2f0: 51c8fffc
+LAB_004D:
+	MOVE.L	D3,D7			;2f4: 2e03
+	DBF	D1,LAB_004D		;2f6: 51c9fffc
+	BRA.S	LAB_004F		;2fa: 6012
+	BEQ.S	LAB_005A		;2fc: 6772
+	BSR.S	LAB_005A		;2fe: 6170
+	DC.W	$6869			;300
+	DC.W	$6373			;302
+	MOVEA.L	(26978,A4),A7		;304: 2e6c6962
+	MOVEQ	#97,D1			;308: 7261
+	MOVEQ	#121,D1			;30a: 7279
+LAB_004E:
+	DC.W	$0000			;30c
+LAB_004F:
+	BSR.W	LAB_0053		;30e: 61000028
+LAB_0050:
+	LEA	(LAB_0039+2,PC),A4	;312: 49faff1a
+	DBF	D6,LAB_0050		;316: 51cefffa
+	MOVE.L	(18198,A5),D3		;31a: 262d4716
+	BRA.S	LAB_0051		;31e: 6008
+	ADDQ.W	#1,-(A5)		;320: 5265
+	BSR.S	LAB_005C		;322: 6164
+	DC.W	$792e			;324
+	DC.W	$0000			;326
+LAB_0051:
+	MOVEQ	#-7,D2			;328: 74f9
+	ADDQ.L	#6,A0			;32a: 5c88
+LAB_0052:
+	ADDQ.L	#4,A3			;32c: 588b
+	DBF	D3,LAB_0052		;32e: 51cbfffc
+	MOVE.L	(11866,A5),D1		;332: 222d2e5a
+	RTS				;336: 4e75
+LAB_0053:
+	LINK.W	A5,#-92			;338: 4e55ffa4
+	BSR.W	LAB_0062		;33c: 6100008a
+LAB_0054:
+	MOVE.W	(7034,A5),(17100,A5)	;340: 3b6d1b7a42cc
+	MOVE.W	(7346,A5),(21259,A5)	;346: 3b6d1cb2530b
+	BNE.S	LAB_0054		;34c: 66f2
+LAB_0056:
+	BSR.W	LAB_0082		;34e: 6100017e
+LAB_0057:
+	BSR.W	LAB_0074		;352: 61000120
+LAB_0058:
+	CMPI.L	#$0000009a,D7		;356: 0c870000009a
+	BRA.S	LAB_0059		;35c: 600c
+	MOVEQ	#111,D2			;35e: 746f
+	MOVEQ	#97,D0			;360: 7061
+	MOVEQ	#46,D5			;362: 7a2e
+	DC.W	$666f			;364
+	BGT.S	LAB_0063		;366: 6e74
+	DC.W	$0000			;368
+LAB_0059:
+	LEA	(LAB_0001+2,PC),A0	;36a: 41fafca4
+	BRA.S	LAB_005B		;36e: 6012
+LAB_005A:
+	BEQ.S	LAB_0066+2		;370: 6772
+	BSR.S	LAB_0066+2		;372: 6170
+	DC.W	$6869			;374
+	DC.W	$6373			;376
+	MOVEA.L	(26978,A4),A7		;378: 2e6c6962
+	MOVEQ	#97,D1			;37c: 7261
+	MOVEQ	#121,D1			;37e: 7279
+	DC.W	$0000			;380
+LAB_005B:
+	BSR.W	LAB_0062		;382: 61000044
+	BRA.S	LAB_005D		;386: 6012
+LAB_005C:
+	BVS.S	LAB_0069		;388: 696e
+	MOVEQ	#117,D2			;38a: 7475
+	BVS.S	LAB_006A+2		;38c: 6974
+	DC.W	$696f			;38e
+	BGT.S	LAB_0061		;390: 6e2e
+	DC.W	$6c69			;392
+	BHI.S	LAB_006B+4		;394: 6272
+	BSR.S	LAB_006C		;396: 6172
+	DC.W	$7900			;398
+LAB_005D:
+	BRA.S	LAB_005E		;39a: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;39c: 25733a20256c
+	BCC.S	LAB_005F		;3a2: 640a
+	DC.W	$0000			;3a4
+LAB_005E:
+	BRA.S	LAB_0060		;3a6: 6012
+	BEQ.S	LAB_006E		;3a8: 6772
+	BSR.S	LAB_006E		;3aa: 6170
+	DC.W	$6869			;3ac
+LAB_005F:
+	DC.W	$6373			;3ae
+	MOVEA.L	(26978,A4),A7		;3b0: 2e6c6962
+	MOVEQ	#97,D1			;3b4: 7261
+	MOVEQ	#121,D1			;3b6: 7279
+	DC.W	$0000			;3b8
+LAB_0060:
+	LEA	LAB_0035,A6		;3ba: 4df900000218
+LAB_0061:
+	BSR.W	LAB_0062		;3c0: 61000006
+	UNLK	A5			;3c4: 4e5d
+	RTS				;3c6: 4e75
+LAB_0062:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;3c8: 48e73f3e
+	BSR.W	LAB_0074		;3cc: 610000a6
+	TST.L	D5			;3d0: 4a85
+	BRA.S	LAB_0063		;3d2: 6008
+	ADDQ.W	#1,-(A5)		;3d4: 5265
+	BSR.S	LAB_0071		;3d6: 6164
+	DC.W	$792e			;3d8
+	DC.W	$0000			;3da
+LAB_0063:
+	ADDQ.L	#3,A2			;3dc: 568a
+LAB_0064:
+	BNE.S	LAB_0063		;3de: 66fc
+LAB_0065:
+	BNE.S	LAB_0063		;3e0: 66fa
+LAB_0066:
+	DBF	D7,LAB_0065		;3e2: 51cffffc
+	BNE.S	LAB_0064		;3e6: 66f6
+LAB_0067:
+	BRA.S	LAB_0068		;3e8: 600a
+	SUBQ.W	#3,(29291,A7)		;3ea: 576f726b
+	DC.W	$6265			;3ee
+	DC.W	$6e63			;3f0
+	DC.W	$6800			;3f2
+LAB_0068:
+	DBF	D3,LAB_0067		;3f4: 51cbfff2
+LAB_0069:
+	MOVE.L	(3300,A5),D2		;3f8: 242d0ce4
+	DBF	D6,LAB_0069		;3fc: 51cefffa
+LAB_006A:
+	BSR.W	LAB_0097		;400: 61000190
+LAB_006B:
+	CMP.L	#$00005996,D1		;404: b2bc00005996
+LAB_006C:
+	MOVE.L	(10580,A5),D5		;40a: 2a2d2954
+	BNE.S	LAB_006C		;40e: 66fa
+LAB_006D:
+	BRA.S	LAB_006F		;410: 600c
+	DC.W	$646f			;412
+	DC.W	$732e			;414
+	DC.W	$6c69			;416
+	BHI.S	LAB_0077+2		;418: 6272
+	BSR.S	LAB_0077+4		;41a: 6172
+LAB_006E:
+	DC.W	$7900			;41c
+LAB_006F:
+	BNE.S	LAB_006D		;41e: 66f0
+	ADDQ.L	#2,A2			;420: 548a
+	BSR.W	LAB_0082		;422: 610000aa
+	BRA.S	LAB_0072		;426: 6018
+	DC.W	$434f			;428
+	DC.W	$4e3a			;42a
+	MOVE.W	(12335,A7),D0		;42c: 302f302f
+	MOVE.W	(47,A4,D3.W),D3		;430: 3634302f
+LAB_0070:
+	MOVE.W	(47,A0,D3.W),D1		;434: 3230302f
+	DC.W	$4f75			;438
+	MOVEQ	#112,D2			;43a: 7470
+LAB_0071:
+	DC.W	$7574			;43c
+	DC.W	$0000			;43e
+LAB_0072:
+	MOVE.L	D0,D3			;440: 2600
+	JSR	(-774,A6)		;442: 4eaefcfa
+	ADD.W	D0,D0			;446: d040
+	MOVE.W	(LAB_0073,PC,D0.W),D0	;448: 303b0006
+	JMP	(LAB_0073,PC,D0.W)	;44c: 4efb0002
+LAB_0073:
+	DC.W	$000c			;450
+	ORI.B	#$14,(A0)		;452: 00100014
+	ORI.B	#$1c,(A0)+		;456: 0018001c
+	DC.W	$0020			;45a
+	MOVEQ	#0,D0			;45c: 7000
+	RTS				;45e: 4e75
+	MOVEQ	#1,D0			;460: 7001
+	RTS				;462: 4e75
+	MOVEQ	#2,D0			;464: 7002
+	RTS				;466: 4e75
+	MOVEQ	#3,D0			;468: 7003
+	RTS				;46a: 4e75
+	MOVEQ	#4,D0			;46c: 7004
+	RTS				;46e: 4e75
+	MOVEQ	#5,D0			;470: 7005
+	RTS				;472: 4e75
+LAB_0074:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;474: 48e73f3e
+	BSR.W	LAB_0082		;478: 61000054
+LAB_0075:
+	CMPI.L	#$00000065,D3		;47c: 0c8300000065
+LAB_0076:
+	MOVEQ	#-38,D7			;482: 7eda
+	DBF	D5,LAB_0076		;484: 51cdfffc
+	BNE.S	LAB_0075		;488: 66f2
+LAB_0077:
+	CMP.L	#$0000aeb9,D3		;48a: b6bc0000aeb9
+LAB_007A:
+	BSR.W	LAB_0097		;490: 61000100
+	BSR.W	LAB_009F		;494: 61000154
+LAB_007B:
+	BSR.W	LAB_0082		;498: 61000034
+LAB_007C:
+	BNE.S	LAB_007A		;49c: 66f2
+	DBF	D7,LAB_007C		;49e: 51cffffc
+LAB_007D:
+	BNE.S	LAB_007B		;4a2: 66f4
+	DBF	D6,LAB_007D		;4a4: 51cefffc
+LAB_007E:
+	MOVE.L	D4,D7			;4a8: 2e04
+	MOVE.L	D2,D4			;4aa: 2802
+LAB_007F:
+	BNE.S	LAB_007E		;4ac: 66fa
+	DBF	D3,LAB_007F		;4ae: 51cbfffc
+LAB_0080:
+	BSR.W	LAB_0082		;4b2: 6100001a
+	JSR	(-72,A6)		;4b6: 4eaeffb8
+	MOVE.L	D1,D0			;4ba: 2001
+LAB_0081:
+	BNE.S	LAB_0080		;4bc: 66f4
+	MOVE.L	D5,D0			;4be: 2005
+	BNE.S	LAB_0081		;4c0: 66fa
+	CMP.L	#$0000340d,D2		;4c2: b4bc0000340d
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;4c8: 4cdf7cfc
+	RTS				;4cc: 4e75
+LAB_0082:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;4ce: 48e73f3e
+LAB_0083:
+	BSR.W	LAB_0097		;4d2: 610000be
+	TST.L	D5			;4d6: 4a85
+	BSR.W	LAB_0097		;4d8: 610000b8
+	BNE.S	LAB_0083		;4dc: 66f4
+LAB_0084:
+	BRA.S	LAB_0086		;4de: 600e
+	DC.W	$4f75			;4e0
+	MOVEQ	#32,D2			;4e2: 7420
+LAB_0085:
+	BLE.S	LAB_0090		;4e4: 6f66
+	MOVEA.L	(25965,A5),A0		;4e6: 206d656d
+	BLE.S	LAB_0092+2		;4ea: 6f72
+	DC.W	$7900			;4ec
+LAB_0086:
+	DBF	D1,LAB_0084		;4ee: 51c9ffee
+LAB_0088:
+	DBF	D0,LAB_0086		;4f2: 51c8fffa
+LAB_0089:
+	LEA	LAB_0045,A2		;4f6: 45f9000002aa
+	DBF	D0,LAB_0089		;4fc: 51c8fff8
+LAB_008A:
+	LEA	LAB_00E6+2,A0		;500: 41f90000092e
+	MOVE.W	(3714,A5),(28703,A5)	;506: 3b6d0e82701f
+LAB_008B:
+	ADDQ.L	#4,A1			;50c: 5889
+LAB_008C:
+	DBF	D5,LAB_008B		;50e: 51cdfffc
+	DBF	D4,LAB_008C		;512: 51ccfffa
+	LEA	LAB_0086+2,A2		;516: 45f9000004f0
+	BRA.S	LAB_008D		;51c: 6008
+	DC.W	$4572			;51e
+	MOVEQ	#111,D1			;520: 726f
+	MOVEQ	#58,D1			;522: 723a
+	MOVE.L	D0,D0			;524: 2000
+LAB_008D:
+	LEA	LAB_0085,A4		;526: 49f9000004e4
+LAB_008E:
+	LEA	(LAB_008A+4,PC),A6	;52c: 4dfaffd6
+	DBF	D6,LAB_008E		;530: 51cefffa
+	CMPI.L	#$00000074,D7		;534: 0c8700000074
+	BRA.S	LAB_008F		;53a: 600c
+	DC.W	$646f			;53c
+	DC.W	$732e			;53e
+	DC.W	$6c69			;540
+	BHI.S	LAB_009A+4		;542: 6272
+	BSR.S	LAB_009B		;544: 6172
+	DC.W	$7900			;546
+LAB_008F:
+	MOVEQ	#-123,D0		;548: 7085
+	MOVE.L	D1,D2			;54a: 2401
+LAB_0090:
+	BNE.S	LAB_008F		;54c: 66fa
+	BRA.S	LAB_0093		;54e: 6018
+	DC.W	$434f			;550
+	DC.W	$4e3a			;552
+	MOVE.W	(12335,A7),D0		;554: 302f302f
+LAB_0091:
+	MOVE.W	(47,A4,D3.W),D3		;558: 3634302f
+LAB_0092:
+	MOVE.W	(47,A0,D3.W),D1		;55c: 3230302f
+	DC.W	$4f75			;560
+	MOVEQ	#112,D2			;562: 7470
+	DC.W	$7574			;564
+	DC.W	$0000			;566
+LAB_0093:
+	JSR	LAB_00A1		;568: 4eb900000618
+	DBF	D5,LAB_0093		;56e: 51cdfff8
+LAB_0094:
+	CMP.L	#$0000e1d7,D0		;572: b0bc0000e1d7
+	MOVEQ	#124,D2			;578: 747c
+	BNE.S	LAB_0094		;57a: 66f6
+	MOVE.L	D6,D0			;57c: 2006
+LAB_0095:
+	MOVE.W	(17061,A5),(12384,A5)	;57e: 3b6d42a53060
+LAB_0096:
+	DBF	D0,LAB_0095		;584: 51c8fff8
+	DBF	D5,LAB_0096		;588: 51cdfffa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;58c: 4cdf7cfc
+	RTS				;590: 4e75
+LAB_0097:
+	LINK.W	A5,#-44			;592: 4e55ffd4
+	BSR.W	LAB_009F		;596: 61000052
+	MOVE.W	(25563,A5),(19676,A5)	;59a: 3b6d63db4cdc
+	ADDQ.L	#2,A1			;5a0: 5489
+LAB_0098:
+	BSR.W	LAB_009F		;5a2: 61000046
+	LEA	LAB_004F,A6		;5a6: 4df90000030e
+	MOVEQ	#-57,D0			;5ac: 70c7
+LAB_0099:
+	BNE.S	LAB_0098		;5ae: 66f2
+	BNE.S	LAB_0099		;5b0: 66fc
+LAB_009A:
+	MOVE.L	#$000006a8,-(A7)	;5b2: 2f3c000006a8
+LAB_009B:
+	BRA.S	LAB_009C		;5b8: 600e
+	DC.W	$4f75			;5ba
+	MOVEQ	#32,D2			;5bc: 7420
+	BLE.S	LAB_00A2		;5be: 6f66
+	MOVEA.L	(25965,A5),A0		;5c0: 206d656d
+	BLE.S	LAB_00A4		;5c4: 6f72
+	DC.W	$7900			;5c6
+LAB_009C:
+	JSR	(-822,A6)		;5c8: 4eaefcca
+	MOVE.W	(17297,A5),(2646,A5)	;5cc: 3b6d43910a56
+	MOVEQ	#47,D5			;5d2: 7a2f
+	BNE.S	LAB_009C		;5d4: 66f2
+	BRA.S	LAB_009D		;5d6: 600c
+	MOVEQ	#111,D2			;5d8: 746f
+	MOVEQ	#97,D0			;5da: 7061
+	MOVEQ	#46,D5			;5dc: 7a2e
+	DC.W	$666f			;5de
+	BGT.S	LAB_00A8		;5e0: 6e74
+	DC.W	$0000			;5e2
+LAB_009D:
+	ADD.L	D6,D7			;5e4: de86
+	UNLK	A5			;5e6: 4e5d
+LAB_009E:
+	RTS				;5e8: 4e75
+LAB_009F:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;5ea: 48e73f3e
+	BSR.W	LAB_00A1		;5ee: 61000028
+	BSR.W	LAB_00AA		;5f2: 61000078
+	ADD.W	D0,D0			;5f6: d040
+	MOVE.W	(LAB_00A0,PC,D0.W),D0	;5f8: 303b0006
+	JMP	(LAB_00A0,PC,D0.W)	;5fc: 4efb0002
+LAB_00A0:
+	DC.W	$0008			;600
+	DC.W	$000c			;602
+	ORI.B	#$14,(A0)		;604: 00100014
+	MOVEQ	#0,D0			;608: 7000
+	RTS				;60a: 4e75
+	MOVEQ	#1,D0			;60c: 7001
+	RTS				;60e: 4e75
+	MOVEQ	#2,D0			;610: 7002
+	RTS				;612: 4e75
+	MOVEQ	#3,D0			;614: 7003
+	RTS				;616: 4e75
+LAB_00A1:
+	BSR.W	LAB_00AA		;618: 61000052
+	BSR.W	LAB_00AA		;61c: 6100004e
+	MOVEQ	#6,D7			;620: 7e06
+	BSR.W	LAB_00B6		;622: 610000ee
+LAB_00A2:
+	MOVE.W	(15062,A5),(32547,A5)	;626: 3b6d3ad67f23
+	MOVE.L	(7558,A5),D0		;62c: 202d1d86
+	MOVEQ	#71,D7			;630: 7e47
+LAB_00A3:
+	BNE.S	LAB_00A2		;632: 66f2
+	DBF	D7,LAB_00A3		;634: 51cffffc
+LAB_00A4:
+	ADDQ.L	#6,A2			;638: 5c8a
+	BRA.S	LAB_00A5		;63a: 600c
+	DC.W	$646f			;63c
+	DC.W	$732e			;63e
+	DC.W	$6c69			;640
+	BHI.S	LAB_00AE+4		;642: 6272
+	BSR.S	LAB_00AF		;644: 6172
+	DC.W	$7900			;646
+LAB_00A5:
+	ADD.L	D3,D1			;648: d283
+LAB_00A6:
+	MOVE.L	D6,D5			;64a: 2a06
+	DBF	D7,LAB_00A6		;64c: 51cffffc
+LAB_00A7:
+	MOVE.L	D0,D5			;650: 2a00
+	DBF	D0,LAB_00A7		;652: 51c8fffc
+LAB_00A8:
+	BNE.S	LAB_00A7		;656: 66f8
+	DBF	D0,LAB_00A8		;658: 51c8fffc
+LAB_00A9:
+	MOVEQ	#-63,D5			;65c: 7ac1
+	BNE.S	LAB_00A9		;65e: 66fc
+	LEA	(LAB_0077,PC),A4	;660: 49fafe28
+	ADDQ.L	#7,A5			;664: 5e8d
+	BSR.W	LAB_00B6		;666: 610000aa
+	RTS				;66a: 4e75
+LAB_00AA:
+	BSR.W	LAB_00B6		;66c: 610000a4
+	CMPI.L	#$00000046,D4		;670: 0c8400000046
+	MOVEQ	#64,D4			;676: 7840
+LAB_00AB:
+	CMP.L	#$0000384f,D3		;678: b6bc0000384f
+	DBF	D7,LAB_00AB		;67e: 51cffff8
+	BSR.W	LAB_00D4		;682: 610001dc
+	BNE.S	LAB_00AB		;686: 66f0
+LAB_00AC:
+	MOVEQ	#-90,D4			;688: 78a6
+	MOVE.L	(8534,A5),D1		;68a: 222d2156
+	CMPI.L	#$00000074,D3		;68e: 0c8300000074
+LAB_00AD:
+	BNE.S	LAB_00AC		;694: 66f2
+	DBF	D7,LAB_00AD		;696: 51cffffc
+	MOVEQ	#-111,D6		;69a: 7c91
+	CMP.L	#$0000801e,D5		;69c: babc0000801e
+	BSR.W	LAB_00B6		;6a2: 6100006e
+	MOVE.L	D3,D6			;6a6: 2c03
+	BSR.W	LAB_00C0		;6a8: 610000ee
+	CMPI.L	#$000000a5,D4		;6ac: 0c84000000a5
+LAB_00AE:
+	CMP.L	#$00005790,D5		;6b2: babc00005790
+LAB_00AF:
+	CMPI.L	#$000000c5,D3		;6b8: 0c83000000c5
+	ADDQ.L	#2,A7			;6be: 548f
+	MOVEQ	#-118,D0		;6c0: 708a
+	JSR	(-588,A6)		;6c2: 4eaefdb4
+	MOVE.W	(23789,A5),(23828,A5)	;6c6: 3b6d5ced5d14
+LAB_00B0:
+	BSR.W	LAB_00C0		;6cc: 610000ca
+LAB_00B1:
+	BNE.S	LAB_00B0		;6d0: 66fa
+	DBF	D2,LAB_00B1		;6d2: 51cafffc
+LAB_00B2:
+	BRA.S	LAB_00B3		;6d6: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;6d8: 25733a20256c
+	BCC.S	LAB_00B4		;6de: 640a
+	DC.W	$0000			;6e0
+LAB_00B3:
+	BNE.S	LAB_00B2		;6e2: 66f2
+	BSR.W	LAB_00C0		;6e4: 610000b2
+	BNE.S	LAB_00B3		;6e8: 66f8
+LAB_00B4:
+	LEA	(LAB_004B+2,PC),A0	;6ea: 41fafbfe
+	BRA.S	LAB_00B5		;6ee: 6012
+	BVS.S	LAB_00B9		;6f0: 696e
+	MOVEQ	#117,D2			;6f2: 7475
+	BVS.S	LAB_00BC		;6f4: 6974
+	DC.W	$696f			;6f6
+	BGT.S	LAB_00B7		;6f8: 6e2e
+	DC.W	$6c69			;6fa
+	BHI.S	LAB_00BD		;6fc: 6272
+	BSR.S	LAB_00BE		;6fe: 6172
+	DC.W	$7900			;700
+LAB_00B5:
+	MOVE.L	(17736,A5),D0		;702: 202d4548
+	BSR.W	LAB_00C0		;706: 61000090
+	LEA	LAB_0159,A2		;70a: 45f900000e24
+	RTS				;710: 4e75
+LAB_00B6:
+	LINK.W	A5,#-60			;712: 4e55ffc4
+	BSR.W	LAB_00C0		;716: 61000080
+	MOVEQ	#60,D2			;71a: 743c
+	BRA.S	LAB_00B8		;71c: 600e
+	DC.W	$4f75			;71e
+	MOVEQ	#32,D2			;720: 7420
+	BLE.S	LAB_00BF+4		;722: 6f66
+	MOVEA.L	(25965,A5),A0		;724: 206d656d
+LAB_00B7:
+	BLE.S	LAB_00C1		;728: 6f72
+	DC.W	$7900			;72a
+LAB_00B8:
+	MOVE.W	(22068,A5),(22168,A5)	;72c: 3b6d56345698
+	MOVE.L	D4,D5			;732: 2a04
+	ADD.L	D6,D2			;734: d486
+	JSR	(-384,A6)		;736: 4eaefe80
+	MOVE.L	(9734,A5),D7		;73a: 2e2d2606
+	ADD.L	D7,D1			;73e: d287
+	CMP.L	#$000015ed,D1		;740: b2bc000015ed
+	CMPI.L	#$000000d4,D4		;746: 0c84000000d4
+	BSR.W	LAB_00DC		;74c: 6100016c
+	CMPI.L	#$000000fc,D2		;750: 0c82000000fc
+	MOVE.L	(8004,A5),D7		;756: 2e2d1f44
+	BRA.S	LAB_00BB		;75a: 600a
+	SUBQ.W	#3,(29291,A7)		;75c: 576f726b
+LAB_00B9:
+	DC.W	$6265			;760
+LAB_00BA:
+	DC.W	$6e63			;762
+	DC.W	$6800			;764
+LAB_00BB:
+	JSR	(-852,A6)		;766: 4eaefcac
+LAB_00BC:
+	ADD.L	D7,D0			;76a: d087
+	LEA	(LAB_0009,PC),A6	;76c: 4dfaf8fa
+LAB_00BD:
+	MOVE.L	D2,D2			;770: 2402
+LAB_00BE:
+	CMP.L	#$00009381,D4		;772: b8bc00009381
+	CMP.L	#$000074eb,D3		;778: b6bc000074eb
+	ADDQ.L	#4,A2			;77e: 588a
+	JSR	(-174,A6)		;780: 4eaeff52
+	ADDQ.L	#5,A2			;784: 5a8a
+LAB_00BF:
+	MOVE.L	#$000000bc,-(A7)	;786: 2f3c000000bc
+	MOVE.L	D3,D6			;78c: 2c03
+	MOVE.L	#$0000007c,-(A7)	;78e: 2f3c0000007c
+	UNLK	A5			;794: 4e5d
+	RTS				;796: 4e75
+LAB_00C0:
+	LINK.W	A5,#-80			;798: 4e55ffb0
+LAB_00C1:
+	BSR.W	LAB_00D4		;79c: 610000c2
+LAB_00C2:
+	DBF	D5,LAB_00C1		;7a0: 51cdfffa
+	MOVEQ	#-19,D7			;7a4: 7eed
+LAB_00C3:
+	JSR	(-624,A6)		;7a6: 4eaefd90
+	DBF	D0,LAB_00C3		;7aa: 51c8fffa
+LAB_00C4:
+	BSR.W	LAB_00E5		;7ae: 61000174
+LAB_00C5:
+	BNE.S	LAB_00C3		;7b2: 66f2
+LAB_00C6:
+	BNE.S	LAB_00C4		;7b4: 66f8
+LAB_00C7:
+	BNE.S	LAB_00C5		;7b6: 66fa
+LAB_00C8:
+	BNE.S	LAB_00C6		;7b8: 66fa
+	DBF	D1,LAB_00C8		;7ba: 51c9fffc
+	BNE.S	LAB_00C7		;7be: 66f6
+	LEA	(LAB_009E,PC),A4	;7c0: 49fafe26
+	BSR.W	LAB_00D4		;7c4: 6100009a
+	LEA	LAB_0091+2,A0		;7c8: 41f90000055a
+	BRA.S	LAB_00C9		;7ce: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;7d0: 25733a20256c
+	BCC.S	LAB_00CA		;7d6: 640a
+	DC.W	$0000			;7d8
+LAB_00C9:
+	JSR	(-618,A6)		;7da: 4eaefd96
+	ADDQ.L	#7,A1			;7de: 5e89
+	ADDQ.L	#1,A0			;7e0: 5288
+LAB_00CA:
+	LEA	(LAB_002C+4,PC),A0	;7e2: 41faf9de
+	DBF	D2,LAB_00CA		;7e6: 51cafffa
+	BRA.S	LAB_00CB		;7ea: 6012
+	BVS.S	LAB_00D3		;7ec: 696e
+	MOVEQ	#117,D2			;7ee: 7475
+	BVS.S	LAB_00D5+2		;7f0: 6974
+	DC.W	$696f			;7f2
+	BGT.S	LAB_00CF		;7f4: 6e2e
+	DC.W	$6c69			;7f6
+	BHI.S	LAB_00D6+2		;7f8: 6272
+	BSR.S	LAB_00D6+4		;7fa: 6172
+	DC.W	$7900			;7fc
+LAB_00CB:
+	BSR.W	LAB_00D4		;7fe: 61000060
+	CMPI.L	#$0000000f,D1		;802: 0c810000000f
+	JSR	LAB_00D4		;808: 4eb900000860
+LAB_00CC:
+	MOVE.W	(9075,A5),(3061,A5)	;80e: 3b6d23730bf5
+	DBF	D2,LAB_00CC		;814: 51cafff8
+LAB_00CD:
+	MOVE.L	D7,D2			;818: 2407
+	DBF	D7,LAB_00CD		;81a: 51cffffc
+	BSR.W	LAB_00DC		;81e: 6100009a
+LAB_00CE:
+	BRA.S	LAB_00D0		;822: 600c
+LAB_00CF:
+	MOVEQ	#111,D2			;824: 746f
+	MOVEQ	#97,D0			;826: 7061
+	MOVEQ	#46,D5			;828: 7a2e
+	DC.W	$666f			;82a
+	BGT.S	LAB_00D9		;82c: 6e74
+	DC.W	$0000			;82e
+LAB_00D0:
+	DBF	D7,LAB_00CE		;830: 51cffff0
+	MOVEQ	#-48,D2			;834: 74d0
+	ADD.L	D4,D6			;836: dc84
+	BNE.S	LAB_00D0		;838: 66f6
+	BRA.S	LAB_00D1		;83a: 6008
+	DC.W	$4572			;83c
+	MOVEQ	#111,D1			;83e: 726f
+	MOVEQ	#58,D1			;840: 723a
+	MOVE.L	D0,D0			;842: 2000
+LAB_00D1:
+	CMP.L	#$0000e52b,D3		;844: b6bc0000e52b
+	DBF	D1,LAB_00D1		;84a: 51c9fff8
+	BRA.S	LAB_00D3		;84e: 600c
+	MOVEQ	#111,D2			;850: 746f
+	MOVEQ	#97,D0			;852: 7061
+	MOVEQ	#46,D5			;854: 7a2e
+	DC.W	$666f			;856
+	BGT.S	LAB_00DD+2		;858: 6e74
+	DC.W	$0000			;85a
+LAB_00D3:
+	UNLK	A5			;85c: 4e5d
+	RTS				;85e: 4e75
+LAB_00D4:
+	BSR.W	LAB_00DC		;860: 61000058
+LAB_00D5:
+	BSR.W	LAB_00F8		;864: 6100016c
+	ADD.L	D0,D5			;868: da80
+LAB_00D6:
+	MOVE.W	(17271,A5),(9777,A5)	;86a: 3b6d43772631
+	JSR	(-294,A6)		;870: 4eaefeda
+	BSR.W	LAB_00DC		;874: 61000044
+	BSR.W	LAB_00E5		;878: 610000aa
+	MOVE.W	(13720,A5),(12787,A5)	;87c: 3b6d359831f3
+LAB_00D8:
+	ADD.L	D5,D0			;882: d085
+	DBF	D0,LAB_00D8		;884: 51c8fffc
+	ADDQ.L	#5,A3			;888: 5a8b
+	JSR	LAB_00DC		;88a: 4eb9000008ba
+	BSR.W	LAB_00F8		;890: 61000140
+	CMPI.L	#$00000072,D6		;894: 0c8600000072
+	JSR	(-774,A6)		;89a: 4eaefcfa
+	BSR.W	LAB_00E5		;89e: 61000084
+LAB_00D9:
+	MOVEQ	#62,D0			;8a2: 703e
+LAB_00DA:
+	MOVE.L	D5,D6			;8a4: 2c05
+	DBF	D6,LAB_00DA		;8a6: 51cefffc
+LAB_00DB:
+	MOVE.W	(13955,A5),(15150,A5)	;8aa: 3b6d36833b2e
+	BNE.S	LAB_00DA		;8b0: 66f2
+	ADD.L	D1,D5			;8b2: da81
+	BNE.S	LAB_00DB		;8b4: 66f4
+	ADDQ.L	#7,A1			;8b6: 5e89
+	RTS				;8b8: 4e75
+LAB_00DC:
+	BSR.W	LAB_00E5		;8ba: 61000068
+	BSR.W	LAB_00E5		;8be: 61000064
+	BRA.S	LAB_00DE		;8c2: 6012
+	BEQ.S	LAB_00E7+4		;8c4: 6772
+	BSR.S	LAB_00E7+4		;8c6: 6170
+	DC.W	$6869			;8c8
+	DC.W	$6373			;8ca
+LAB_00DD:
+	MOVEA.L	(26978,A4),A7		;8cc: 2e6c6962
+	MOVEQ	#97,D1			;8d0: 7261
+	MOVEQ	#121,D1			;8d2: 7279
+	DC.W	$0000			;8d4
+LAB_00DE:
+	ADD.L	D2,D2			;8d6: d482
+	BSR.W	LAB_00E5		;8d8: 6100004a
+	ADD.L	D5,D6			;8dc: dc85
+	MOVE.L	D5,D1			;8de: 2205
+	BSR.W	LAB_00E5		;8e0: 61000042
+LAB_00DF:
+	BSR.W	LAB_0100		;8e4: 61000144
+	DBF	D0,LAB_00DF		;8e8: 51c8fffa
+LAB_00E0:
+	MOVEQ	#77,D3			;8ec: 764d
+	CMPI.L	#$00000017,D6		;8ee: 0c8600000017
+	BSR.W	LAB_00F8		;8f4: 610000dc
+	BNE.S	LAB_00E0		;8f8: 66f2
+	LEA	(LAB_0088,PC),A6	;8fa: 4dfafbf6
+LAB_00E1:
+	BSR.W	LAB_0100		;8fe: 6100012a
+LAB_00E2:
+	DBF	D1,LAB_00E1		;902: 51c9fffa
+LAB_00E3:
+	CMPI.L	#$00000034,D7		;906: 0c8700000034
+	DBF	D4,LAB_00E3		;90c: 51ccfff8
+LAB_00E4:
+	BNE.S	LAB_00E2		;910: 66f0
+	DBF	D7,LAB_00E4		;912: 51cffffc
+	MOVEQ	#-110,D6		;916: 7c92
+	BSR.W	LAB_00F8		;918: 610000b8
+	JSR	LAB_00F8		;91c: 4eb9000009d2
+	RTS				;922: 4e75
+LAB_00E5:
+	LINK.W	A5,#-176		;924: 4e55ff50
+	BSR.W	LAB_00F8		;928: 610000a8
+LAB_00E6:
+	MOVE.L	(18308,A5),D3		;92c: 262d4784
+	LEA	(LAB_0048+2,PC),A0	;930: 41faf994
+LAB_00E7:
+	LEA	LAB_00EE+4,A0		;934: 41f900000992
+	BSR.W	LAB_0100		;93a: 610000ee
+	BSR.W	LAB_00F8		;93e: 61000092
+	MOVE.W	(2802,A5),(4199,A5)	;942: 3b6d0af21067
+	BSR.W	LAB_0100		;948: 610000e0
+	ADD.L	D4,D2			;94c: d484
+	BSR.W	LAB_00F8		;94e: 61000082
+	BRA.S	LAB_00E9		;952: 600c
+	DC.W	$646f			;954
+	DC.W	$732e			;956
+	DC.W	$6c69			;958
+	BHI.S	LAB_00F6		;95a: 6272
+	BSR.S	LAB_00F7		;95c: 6172
+	DC.W	$7900			;95e
+LAB_00E9:
+	ADDQ.L	#6,A1			;960: 5c89
+	JSR	(-624,A6)		;962: 4eaefd90
+LAB_00EA:
+	MOVE.W	(8817,A5),(18293,A5)	;966: 3b6d22714775
+	BSR.W	LAB_00F8		;96c: 61000064
+LAB_00EB:
+	BNE.S	LAB_00EA		;970: 66f4
+	DBF	D2,LAB_00EB		;972: 51cafffc
+LAB_00EC:
+	CMPI.L	#$00000067,D5		;976: 0c8500000067
+	BNE.S	LAB_00EC		;97c: 66f8
+LAB_00ED:
+	ADD.L	D3,D3			;97e: d683
+	DBF	D7,LAB_00ED		;980: 51cffffc
+	JSR	(-102,A6)		;984: 4eaeff9a
+	BSR.W	LAB_0100		;988: 610000a0
+	BRA.S	LAB_00EF		;98c: 600a
+LAB_00EE:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;98e: 25733a20256c
+	BCC.S	LAB_00F1		;994: 640a
+	DC.W	$0000			;996
+LAB_00EF:
+	MOVEQ	#-85,D5			;998: 7aab
+LAB_00F0:
+	MOVE.L	D7,D4			;99a: 2807
+	DBF	D6,LAB_00F0		;99c: 51cefffc
+LAB_00F1:
+	BSR.W	LAB_010B		;9a0: 61000138
+	DBF	D3,LAB_00F1		;9a4: 51cbfffa
+	BRA.S	LAB_00F2		;9a8: 6008
+	DC.W	$4572			;9aa
+	MOVEQ	#111,D1			;9ac: 726f
+	MOVEQ	#58,D1			;9ae: 723a
+	MOVE.L	D0,D0			;9b0: 2000
+LAB_00F2:
+	CMP.L	#$00005c72,D4		;9b2: b8bc00005c72
+LAB_00F3:
+	MOVE.L	(13612,A5),D4		;9b8: 282d352c
+	DBF	D3,LAB_00F3		;9bc: 51cbfffa
+	MOVE.L	D0,D0			;9c0: 2000
+	MOVEQ	#-38,D4			;9c2: 78da
+LAB_00F4:
+	ADD.L	D4,D3			;9c4: d684
+LAB_00F5:
+	ADDQ.L	#1,A6			;9c6: 528e
+	DBF	D7,LAB_00F5		;9c8: 51cffffc
+	BNE.S	LAB_00F4		;9cc: 66f6
+LAB_00F6:
+	UNLK	A5			;9ce: 4e5d
+LAB_00F7:
+	RTS				;9d0: 4e75
+LAB_00F8:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;9d2: 48e73f3e
+	BSR.W	LAB_0100		;9d6: 61000052
+	MOVEQ	#-80,D6			;9da: 7cb0
+	TST.L	D1			;9dc: 4a81
+	MOVE.L	#$00000608,-(A7)	;9de: 2f3c00000608
+LAB_00F9:
+	BSR.W	LAB_0116		;9e4: 61000162
+LAB_00FA:
+	DBF	D1,LAB_00F9		;9e8: 51c9fffa
+	DBF	D4,LAB_00FA		;9ec: 51ccfffa
+	BSR.W	LAB_0116		;9f0: 61000156
+	BSR.W	LAB_0100		;9f4: 61000034
+LAB_00FB:
+	BRA.S	LAB_00FC		;9f8: 6008
+	ADDQ.W	#1,-(A5)		;9fa: 5265
+	BSR.S	LAB_0104+2		;9fc: 6164
+	DC.W	$792e			;9fe
+	DC.W	$0000			;a00
+LAB_00FC:
+	BRA.S	LAB_00FD		;a02: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;a04: 25733a20256c
+	BCC.S	LAB_00FE+2		;a0a: 640a
+	DC.W	$0000			;a0c
+LAB_00FD:
+	BSR.W	LAB_010B		;a0e: 610000ca
+	BNE.S	LAB_00FB		;a12: 66e4
+LAB_00FE:
+	CMP.L	#$000070b5,D3		;a14: b6bc000070b5
+LAB_00FF:
+	BSR.W	LAB_0116		;a1a: 6100012c
+	BNE.S	LAB_00FF		;a1e: 66fa
+	BSR.W	LAB_0116		;a20: 61000126
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;a24: 4cdf7cfc
+	RTS				;a28: 4e75
+LAB_0100:
+	LINK.W	A5,#-112		;a2a: 4e55ff90
+	BSR.W	LAB_010B		;a2e: 610000aa
+LAB_0101:
+	BSR.W	LAB_0116		;a32: 61000114
+	LEA	(LAB_00F5,PC),A6	;a36: 4dfaff8e
+	BRA.S	LAB_0102		;a3a: 600c
+	MOVEQ	#111,D2			;a3c: 746f
+	MOVEQ	#97,D0			;a3e: 7061
+	MOVEQ	#46,D5			;a40: 7a2e
+	DC.W	$666f			;a42
+	BGT.S	LAB_0108		;a44: 6e74
+	DC.W	$0000			;a46
+LAB_0102:
+	ADDQ.L	#4,A0			;a48: 5888
+LAB_0103:
+	ADD.L	D7,D6			;a4a: dc87
+	DBF	D6,LAB_0103		;a4c: 51cefffc
+	BSR.W	LAB_010B		;a50: 61000088
+	JSR	(-732,A6)		;a54: 4eaefd24
+	MOVE.L	(6040,A5),D5		;a58: 2a2d1798
+	LEA	(LAB_00D1+2,PC),A2	;a5c: 45fafde8
+LAB_0104:
+	CMPI.L	#$000000a7,D6		;a60: 0c86000000a7
+	BSR.W	LAB_010B		;a66: 61000072
+LAB_0105:
+	MOVEQ	#-105,D4		;a6a: 7897
+	DBF	D0,LAB_0105		;a6c: 51c8fffc
+	MOVE.L	(294,A5),D3		;a70: 262d0126
+	ADD.L	D6,D0			;a74: d086
+LAB_0106:
+	JSR	LAB_0121		;a76: 4eb900000bca
+	MOVE.L	D2,D3			;a7c: 2602
+	ADD.L	D1,D5			;a7e: da81
+	BNE.S	LAB_0106		;a80: 66f4
+	BRA.S	LAB_0107		;a82: 600c
+	MOVEQ	#111,D2			;a84: 746f
+	MOVEQ	#97,D0			;a86: 7061
+	MOVEQ	#46,D5			;a88: 7a2e
+	DC.W	$666f			;a8a
+	BGT.S	LAB_0110		;a8c: 6e74
+	DC.W	$0000			;a8e
+LAB_0107:
+	JSR	LAB_0121		;a90: 4eb900000bca
+	MOVEQ	#112,D4			;a96: 7870
+	MOVE.L	#$000002b8,-(A7)	;a98: 2f3c000002b8
+	BSR.W	LAB_010B		;a9e: 6100003a
+	MOVE.L	(1384,A5),D6		;aa2: 2c2d0568
+	ADDQ.L	#1,A1			;aa6: 5289
+	BSR.W	LAB_0121		;aa8: 61000120
+	BSR.W	LAB_0116		;aac: 6100009a
+	MOVE.L	(7584,A5),D7		;ab0: 2e2d1da0
+	BRA.S	LAB_0109		;ab4: 600a
+	SUBQ.W	#3,(29291,A7)		;ab6: 576f726b
+LAB_0108:
+	DC.W	$6265			;aba
+	DC.W	$6e63			;abc
+	DC.W	$6800			;abe
+LAB_0109:
+	CMPI.L	#$00000044,D2		;ac0: 0c8200000044
+LAB_010A:
+	CMPI.L	#$00000062,D0		;ac6: 0c8000000062
+	BSR.W	LAB_0116		;acc: 6100007a
+	BNE.S	LAB_010A		;ad0: 66f4
+	MOVE.L	(26582,A5),D4		;ad2: 282d67d6
+	UNLK	A5			;ad6: 4e5d
+	RTS				;ad8: 4e75
+LAB_010B:
+	BSR.W	LAB_0116		;ada: 6100006c
+LAB_010C:
+	TST.L	D0			;ade: 4a80
+	BSR.W	LAB_0116		;ae0: 61000066
+LAB_010D:
+	BNE.S	LAB_010C		;ae4: 66f8
+	DBF	D7,LAB_010D		;ae6: 51cffffc
+LAB_010E:
+	BRA.S	LAB_010F		;aea: 6012
+	BEQ.S	LAB_011A		;aec: 6772
+	BSR.S	LAB_011A		;aee: 6170
+	DC.W	$6869			;af0
+	DC.W	$6373			;af2
+	MOVEA.L	(26978,A4),A7		;af4: 2e6c6962
+	MOVEQ	#97,D1			;af8: 7261
+	MOVEQ	#121,D1			;afa: 7279
+	DC.W	$0000			;afc
+LAB_010F:
+	DBF	D2,LAB_010E		;afe: 51caffea
+LAB_0110:
+	CMPI.L	#$000000b2,D0		;b02: 0c80000000b2
+	JSR	(-786,A6)		;b08: 4eaefcee
+LAB_0111:
+	BNE.S	LAB_0110		;b0c: 66f4
+	CMP.L	#$000018e5,D5		;b0e: babc000018e5
+LAB_0112:
+	MOVE.W	(29060,A5),(1895,A5)	;b14: 3b6d71840767
+	BNE.S	LAB_0111		;b1a: 66f0
+LAB_0113:
+	ADDQ.L	#4,A1			;b1c: 5889
+	BNE.S	LAB_0112		;b1e: 66f4
+	CMP.L	#$0000b521,D4		;b20: b8bc0000b521
+	BNE.S	LAB_0113		;b26: 66f4
+	CMPI.L	#$000000f3,D7		;b28: 0c87000000f3
+LAB_0114:
+	BSR.W	LAB_012C		;b2e: 61000174
+LAB_0115:
+	DBF	D0,LAB_0114		;b32: 51c8fffa
+	BSR.W	LAB_012C		;b36: 6100016c
+	ADDQ.L	#6,A7			;b3a: 5c8f
+	BNE.S	LAB_0115		;b3c: 66f4
+	BSR.W	LAB_012C		;b3e: 61000164
+	BSR.W	LAB_0116		;b42: 61000004
+	RTS				;b46: 4e75
+LAB_0116:
+	BSR.W	LAB_0121		;b48: 61000080
+LAB_0117:
+	ADDQ.L	#5,A2			;b4c: 5a8a
+	TST.L	D7			;b4e: 4a87
+LAB_0118:
+	BNE.S	LAB_0117		;b50: 66fa
+	DBF	D7,LAB_0118		;b52: 51cffffc
+	MOVE.W	(115,A5),(27059,A5)	;b56: 3b6d007369b3
+LAB_0119:
+	MOVEQ	#33,D4			;b5c: 7821
+	ADD.L	D2,D7			;b5e: de82
+LAB_011A:
+	BNE.S	LAB_0119		;b60: 66fa
+	MOVE.L	(21004,A5),D6		;b62: 2c2d520c
+	BSR.W	LAB_012C		;b66: 6100013c
+	BSR.W	LAB_013D		;b6a: 610001e6
+	MOVE.L	D2,D5			;b6e: 2a02
+	CMP.L	#$000062e6,D0		;b70: b0bc000062e6
+	ADDQ.L	#7,A5			;b76: 5e8d
+LAB_011B:
+	LEA	(LAB_0044+2,PC),A0	;b78: 41faf72e
+	MOVE.L	#$00000972,-(A7)	;b7c: 2f3c00000972
+	LEA	(LAB_0101+2,PC),A2	;b82: 45fafeb0
+LAB_011C:
+	BNE.S	LAB_011B		;b86: 66f0
+	BRA.S	LAB_011D		;b88: 6008
+	DC.W	$4572			;b8a
+	MOVEQ	#111,D1			;b8c: 726f
+	MOVEQ	#58,D1			;b8e: 723a
+	MOVE.L	D0,D0			;b90: 2000
+LAB_011D:
+	ADDQ.L	#5,A2			;b92: 5a8a
+	BNE.S	LAB_011C		;b94: 66f0
+	MOVE.L	(20568,A5),D3		;b96: 262d5058
+LAB_011E:
+	MOVE.L	(13700,A5),D7		;b9a: 2e2d3584
+	BSR.W	LAB_013D		;b9e: 610001b2
+LAB_011F:
+	ADD.L	D5,D7			;ba2: de85
+	BNE.S	LAB_011E		;ba4: 66f4
+	BNE.S	LAB_011F		;ba6: 66fa
+	BNE.S	LAB_011F		;ba8: 66f8
+	MOVE.L	(3608,A5),D1		;baa: 222d0e18
+	ADDQ.L	#1,A2			;bae: 528a
+	MOVEQ	#-24,D5			;bb0: 7ae8
+	CMPI.L	#$00000033,D2		;bb2: 0c8200000033
+LAB_0120:
+	MOVE.W	(9689,A5),(1490,A5)	;bb8: 3b6d25d905d2
+	JSR	(-684,A6)		;bbe: 4eaefd54
+	BSR.W	LAB_012C		;bc2: 610000e0
+	BNE.S	LAB_0120		;bc6: 66f0
+	RTS				;bc8: 4e75
+LAB_0121:
+	LINK.W	A5,#-136		;bca: 4e55ff78
+	BSR.W	LAB_012C		;bce: 610000d4
+	MOVE.L	#$00000460,-(A7)	;bd2: 2f3c00000460
+	MOVE.L	(28820,A5),D0		;bd8: 202d7094
+LAB_0122:
+	JSR	(-72,A6)		;bdc: 4eaeffb8
+	MOVE.L	(16988,A5),D3		;be0: 262d425c
+LAB_0123:
+	BSR.W	LAB_015A		;be4: 61000244
+LAB_0124:
+	BNE.S	LAB_0123		;be8: 66fa
+	BNE.S	LAB_0124		;bea: 66fc
+	JSR	(-672,A6)		;bec: 4eaefd60
+LAB_0125:
+	CMP.L	#$0000e893,D4		;bf0: b8bc0000e893
+	DBF	D2,LAB_0125		;bf6: 51cafff8
+	BSR.W	LAB_012C		;bfa: 610000a8
+	CMP.L	#$0000d791,D0		;bfe: b0bc0000d791
+	ADDQ.L	#2,A3			;c04: 548b
+	CMP.L	#$0000b6ce,D2		;c06: b4bc0000b6ce
+	ADD.L	D0,D5			;c0c: da80
+LAB_0126:
+	BRA.S	LAB_0127		;c0e: 6018
+	DC.W	$434f			;c10
+	DC.W	$4e3a			;c12
+	MOVE.W	(12335,A7),D0		;c14: 302f302f
+	MOVE.W	(47,A4,D3.W),D3		;c18: 3634302f
+	MOVE.W	(47,A0,D3.W),D1		;c1c: 3230302f
+	DC.W	$4f75			;c20
+	MOVEQ	#112,D2			;c22: 7470
+	DC.W	$7574			;c24
+	DC.W	$0000			;c26
+LAB_0127:
+	BNE.S	LAB_0126		;c28: 66e4
+LAB_0128:
+	BRA.S	LAB_0129		;c2a: 6012
+	BEQ.S	LAB_012B		;c2c: 6772
+	BSR.S	LAB_012B		;c2e: 6170
+	DC.W	$6869			;c30
+	DC.W	$6373			;c32
+	MOVEA.L	(26978,A4),A7		;c34: 2e6c6962
+	MOVEQ	#97,D1			;c38: 7261
+	MOVEQ	#121,D1			;c3a: 7279
+	DC.W	$0000			;c3c
+LAB_0129:
+	DBF	D4,LAB_0128		;c3e: 51ccffea
+	CMP.L	#$0000b200,D5		;c42: babc0000b200
+	BSR.W	LAB_015A		;c48: 610001e0
+	JSR	LAB_012C		;c4c: 4eb900000ca4
+	ADD.L	D3,D4			;c52: d883
+	ADDQ.L	#4,A7			;c54: 588f
+	JSR	(-822,A6)		;c56: 4eaefcca
+	ADD.L	D5,D6			;c5a: dc85
+	MOVE.L	D2,D4			;c5c: 2802
+	CMPI.L	#$0000007b,D0		;c5e: 0c800000007b
+	MOVE.W	(25323,A5),(8686,A5)	;c64: 3b6d62eb21ee
+	CMPI.L	#$00000044,D6		;c6a: 0c8600000044
+	BSR.W	LAB_015A		;c70: 610001b8
+	BRA.S	LAB_012A		;c74: 600c
+	DC.W	$646f			;c76
+	DC.W	$732e			;c78
+	DC.W	$6c69			;c7a
+	BHI.S	LAB_0133		;c7c: 6272
+	BSR.S	LAB_0134		;c7e: 6172
+	DC.W	$7900			;c80
+LAB_012A:
+	BSR.W	LAB_015A		;c82: 610001a6
+	JSR	(-186,A6)		;c86: 4eaeff46
+	ADD.L	D2,D5			;c8a: da82
+	MOVE.W	(18413,A5),(25378,A5)	;c8c: 3b6d47ed6322
+	BSR.W	LAB_012C		;c92: 61000010
+	BRA.S	LAB_012B		;c96: 6008
+	ADDQ.W	#1,-(A5)		;c98: 5265
+	BSR.S	LAB_0135		;c9a: 6164
+	DC.W	$792e			;c9c
+	DC.W	$0000			;c9e
+LAB_012B:
+	UNLK	A5			;ca0: 4e5d
+	RTS				;ca2: 4e75
+LAB_012C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;ca4: 48e73f3e
+LAB_012D:
+	BSR.W	LAB_013D		;ca8: 610000a8
+	DBF	D5,LAB_012D		;cac: 51cdfffa
+	BSR.W	LAB_013D		;cb0: 610000a0
+	MOVE.W	(12796,A5),(10655,A5)	;cb4: 3b6d31fc299f
+	BRA.S	LAB_012E		;cba: 600c
+	DC.W	$646f			;cbc
+	DC.W	$732e			;cbe
+	DC.W	$6c69			;cc0
+	BHI.S	LAB_013A		;cc2: 6272
+	BSR.S	LAB_013B		;cc4: 6172
+	DC.W	$7900			;cc6
+LAB_012E:
+	BSR.W	LAB_013D		;cc8: 61000088
+	BSR.W	LAB_0161		;ccc: 610001a6
+	ADD.L	D4,D6			;cd0: dc84
+LAB_012F:
+	CMPI.L	#$0000000a,D2		;cd2: 0c820000000a
+LAB_0130:
+	DBF	D2,LAB_012F		;cd8: 51cafff8
+LAB_0131:
+	DBF	D4,LAB_0130		;cdc: 51ccfffa
+	JSR	(-468,A6)		;ce0: 4eaefe2c
+	BSR.W	LAB_013D		;ce4: 6100006c
+LAB_0132:
+	BNE.S	LAB_0131		;ce8: 66f2
+	BNE.S	LAB_0132		;cea: 66fc
+	LEA	(LAB_0026+2,PC),A0	;cec: 41faf48a
+LAB_0133:
+	ADDQ.L	#5,A6			;cf0: 5a8e
+LAB_0134:
+	BRA.S	LAB_0136		;cf2: 600e
+	DC.W	$4f75			;cf4
+	MOVEQ	#32,D2			;cf6: 7420
+	BLE.S	LAB_013F		;cf8: 6f66
+	MOVEA.L	(25965,A5),A0		;cfa: 206d656d
+	BLE.S	LAB_0142		;cfe: 6f72
+LAB_0135:
+	DC.W	$7900			;d00
+LAB_0136:
+	MOVE.L	D6,D4			;d02: 2806
+	BSR.W	LAB_0161		;d04: 6100016e
+	BRA.S	LAB_0137		;d08: 600e
+	DC.W	$4f75			;d0a
+	MOVEQ	#32,D2			;d0c: 7420
+	BLE.S	LAB_0143		;d0e: 6f66
+	MOVEA.L	(25965,A5),A0		;d10: 206d656d
+	BLE.S	LAB_0145		;d14: 6f72
+	DC.W	$7900			;d16
+LAB_0137:
+	MOVEQ	#-123,D5		;d18: 7a85
+LAB_0138:
+	MOVEQ	#81,D6			;d1a: 7c51
+	DBF	D7,LAB_0138		;d1c: 51cffffc
+	LEA	LAB_00E7,A2		;d20: 45f900000934
+	BRA.S	LAB_0139		;d26: 6008
+	DC.W	$4572			;d28
+	MOVEQ	#111,D1			;d2a: 726f
+	MOVEQ	#58,D1			;d2c: 723a
+	MOVE.L	D0,D0			;d2e: 2000
+LAB_0139:
+	CMP.L	#$000055ec,D5		;d30: babc000055ec
+LAB_013A:
+	BRA.S	LAB_013C		;d36: 6008
+LAB_013B:
+	DC.W	$4572			;d38
+	MOVEQ	#111,D1			;d3a: 726f
+	MOVEQ	#58,D1			;d3c: 723a
+	MOVE.L	D0,D0			;d3e: 2000
+LAB_013C:
+	DBF	D3,LAB_013A		;d40: 51cbfff4
+	DBF	D2,LAB_013C		;d44: 51cafffa
+	BSR.W	LAB_013D		;d48: 61000008
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;d4c: 4cdf7cfc
+	RTS				;d50: 4e75
+LAB_013D:
+	BSR.W	LAB_015A		;d52: 610000d6
+LAB_013E:
+	BRA.S	LAB_013F		;d56: 6008
+	DC.W	$4572			;d58
+	MOVEQ	#111,D1			;d5a: 726f
+	MOVEQ	#58,D1			;d5c: 723a
+	MOVE.L	D0,D0			;d5e: 2000
+LAB_013F:
+	DBF	D2,LAB_013E		;d60: 51cafff4
+	BNE.S	LAB_013E		;d64: 66f0
+	MOVEQ	#31,D7			;d66: 7e1f
+LAB_0140:
+	BRA.S	LAB_0144		;d68: 6012
+	BVS.S	LAB_014F		;d6a: 696e
+	MOVEQ	#117,D2			;d6c: 7475
+LAB_0141:
+	BVS.S	LAB_0150+4		;d6e: 6974
+	DC.W	$696f			;d70
+LAB_0142:
+	BGT.S	LAB_0148+4		;d72: 6e2e
+	DC.W	$6c69			;d74
+LAB_0143:
+	BHI.S	LAB_0151		;d76: 6272
+	BSR.S	LAB_0151+2		;d78: 6172
+	DC.W	$7900			;d7a
+LAB_0144:
+	DBF	D7,LAB_0140		;d7c: 51cfffea
+	ADDQ.L	#1,A5			;d80: 528d
+	CMP.L	#$0000a3ce,D6		;d82: bcbc0000a3ce
+LAB_0145:
+	CMP.L	#$000006a1,D4		;d88: b8bc000006a1
+LAB_0146:
+	BRA.S	LAB_0147		;d8e: 600a
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;d90: 25733a20256c
+	BCC.S	LAB_0148+4		;d96: 640a
+	DC.W	$0000			;d98
+LAB_0147:
+	DBF	D6,LAB_0146		;d9a: 51cefff2
+LAB_0148:
+	CMP.L	#$00001ffb,D7		;d9e: bebc00001ffb
+	BNE.S	LAB_0146		;da4: 66e8
+	LEA	LAB_0029,A4		;da6: 49f900000182
+	ADDQ.L	#6,A6			;dac: 5c8e
+	CMP.L	#$00001395,D4		;dae: b8bc00001395
+	MOVE.L	D0,D2			;db4: 2400
+	ADD.L	D1,D2			;db6: d481
+	BSR.W	LAB_0161		;db8: 610000ba
+LAB_0149:
+	MOVE.W	(15022,A5),(19803,A5)	;dbc: 3b6d3aae4d5b
+LAB_014A:
+	DBF	D1,LAB_0149		;dc2: 51c9fff8
+	DBF	D1,LAB_014A		;dc6: 51c9fffa
+LAB_014B:
+	CMP.L	#$0000036e,D4		;dca: b8bc0000036e
+LAB_014C:
+	DBF	D0,LAB_014B		;dd0: 51c8fff8
+LAB_014D:
+	BNE.S	LAB_014C		;dd4: 66fa
+LAB_014E:
+	DBF	D7,LAB_014D		;dd6: 51cffffc
+LAB_014F:
+	DBF	D1,LAB_014E		;dda: 51c9fffa
+	BRA.S	LAB_0151		;dde: 600a
+LAB_0150:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2) ;de0: 25733a20256c
+	BCC.S	LAB_0153		;de6: 640a
+	DC.W	$0000			;de8
+LAB_0151:
+	BSR.W	LAB_0161		;dea: 61000088
+	BSR.W	LAB_0171		;dee: 61000164
+LAB_0153:
+	BRA.S	LAB_0154		;df2: 6008
+	ADDQ.W	#1,-(A5)		;df4: 5265
+	BSR.S	LAB_015D		;df6: 6164
+	DC.W	$792e			;df8
+	DC.W	$0000			;dfa
+LAB_0154:
+	MOVEQ	#-119,D3		;dfc: 7689
+LAB_0155:
+	BNE.S	LAB_0153		;dfe: 66f2
+	BSR.W	LAB_0171		;e00: 61000152
+	BNE.S	LAB_0155		;e04: 66f8
+	MOVE.W	(698,A5),(21055,A5)	;e06: 3b6d02ba523f
+LAB_0156:
+	MOVE.W	(10660,A5),(30711,A5)	;e0c: 3b6d29a477f7
+	DBF	D0,LAB_0156		;e12: 51c8fff8
+LAB_0157:
+	CMP.L	#$00007c21,D1		;e16: b2bc00007c21
+LAB_0158:
+	DBF	D1,LAB_0157		;e1c: 51c9fff8
+	DBF	D3,LAB_0158		;e20: 51cbfffa
+LAB_0159:
+	MOVE.L	(18338,A5),D2		;e24: 242d47a2
+	RTS				;e28: 4e75
+LAB_015A:
+	BSR.W	LAB_0161		;e2a: 61000048
+	CMPI.L	#$0000005b,D5		;e2e: 0c850000005b
+	CMPI.L	#$00000092,D6		;e34: 0c8600000092
+	MOVE.W	(19449,A5),(6702,A5)	;e3a: 3b6d4bf91a2e
+LAB_015B:
+	MOVE.L	D7,D6			;e40: 2c07
+	ADDQ.L	#6,A3			;e42: 5c8b
+	BNE.S	LAB_015B		;e44: 66fa
+	JSR	(-696,A6)		;e46: 4eaefd48
+	CMPI.L	#$000000df,D4		;e4a: 0c84000000df
+	ADDQ.L	#3,A5			;e50: 568d
+	ADD.L	D4,D0			;e52: d084
+LAB_015C:
+	CMP.L	#$0000b136,D2		;e54: b4bc0000b136
+	BNE.S	LAB_015C		;e5a: 66f8
+LAB_015D:
+	BNE.S	LAB_015C		;e5c: 66f6
+LAB_015E:
+	DBF	D6,LAB_015D		;e5e: 51cefffc
+LAB_015F:
+	DBF	D7,LAB_015E		;e62: 51cffffa
+LAB_0160:
+	DBF	D6,LAB_015F		;e66: 51cefffa
+	DBF	D5,LAB_0160		;e6a: 51cdfffa
+	LEA	(LAB_003C,PC),A4	;e6e: 49faf3da
+	RTS				;e72: 4e75
+LAB_0161:
+	LINK.W	A5,#-16			;e74: 4e55fff0
+	BSR.W	LAB_0171		;e78: 610000da
+	LEA	(LAB_0070,PC),A2	;e7c: 45faf5b6
+	BRA.S	LAB_0162		;e80: 600c
+	DC.W	$646f			;e82
+	DC.W	$732e			;e84
+	DC.W	$6c69			;e86
+	BHI.S	LAB_0168		;e88: 6272
+	BSR.S	LAB_0169		;e8a: 6172
+	DC.W	$7900			;e8c
+LAB_0162:
+	BSR.W	LAB_017D		;e8e: 61000132
+	MOVE.L	D2,D0			;e92: 2002
+	BRA.S	LAB_0163		;e94: 6008
+	DC.W	$4572			;e96
+	MOVEQ	#111,D1			;e98: 726f
+	MOVEQ	#58,D1			;e9a: 723a
+	MOVE.L	D0,D0			;e9c: 2000
+LAB_0163:
+	BNE.S	LAB_0162		;e9e: 66ee
+	BNE.S	LAB_0163		;ea0: 66fc
+	BSR.W	LAB_017D		;ea2: 6100011e
+	JSR	(-198,A6)		;ea6: 4eaeff3a
+LAB_0164:
+	MOVE.L	#$00000110,-(A7)	;eaa: 2f3c00000110
+	BRA.S	LAB_0165		;eb0: 6008
+	DC.W	$4572			;eb2
+	MOVEQ	#111,D1			;eb4: 726f
+	MOVEQ	#58,D1			;eb6: 723a
+	MOVE.L	D0,D0			;eb8: 2000
+LAB_0165:
+	ADD.L	D4,D2			;eba: d484
+	BNE.S	LAB_0164		;ebc: 66ec
+	MOVE.W	(25507,A5),(13732,A5)	;ebe: 3b6d63a335a4
+	BNE.S	LAB_0165		;ec4: 66f4
+	LEA	(LAB_00C2,PC),A4	;ec6: 49faf8d8
+	MOVEQ	#122,D3			;eca: 767a
+	BRA.S	LAB_0166		;ecc: 6008
+	DC.W	$4572			;ece
+	MOVEQ	#111,D1			;ed0: 726f
+	MOVEQ	#58,D1			;ed2: 723a
+	MOVE.L	D0,D0			;ed4: 2000
+LAB_0166:
+	JSR	(-498,A6)		;ed6: 4eaefe0e
+	BSR.W	LAB_017D		;eda: 610000e6
+	BRA.S	LAB_0167		;ede: 600c
+	MOVEQ	#111,D2			;ee0: 746f
+	MOVEQ	#97,D0			;ee2: 7061
+	MOVEQ	#46,D5			;ee4: 7a2e
+	DC.W	$666f			;ee6
+	BGT.S	LAB_0172+2		;ee8: 6e74
+	DC.W	$0000			;eea
+LAB_0167:
+	BSR.W	LAB_017D		;eec: 610000d4
+	BRA.S	LAB_016A		;ef0: 6012
+	BVS.S	LAB_0173		;ef2: 696e
+	MOVEQ	#117,D2			;ef4: 7475
+	BVS.S	LAB_0174		;ef6: 6974
+	DC.W	$696f			;ef8
+	BGT.S	LAB_016C		;efa: 6e2e
+LAB_0168:
+	DC.W	$6c69			;efc
+LAB_0169:
+	BHI.S	LAB_0175+2		;efe: 6272
+	BSR.S	LAB_0177		;f00: 6172
+	DC.W	$7900			;f02
+LAB_016A:
+	BNE.S	LAB_0167		;f04: 66e6
+	MOVE.L	(26518,A5),D2		;f06: 242d6796
+	BSR.W	LAB_017D		;f0a: 610000b6
+	BSR.W	LAB_0171		;f0e: 61000044
+	LEA	LAB_0020,A6		;f12: 4df90000014a
+LAB_016B:
+	LEA	(LAB_0141,PC),A2	;f18: 45fafe54
+	BRA.S	LAB_016C		;f1c: 600c
+	MOVEQ	#111,D2			;f1e: 746f
+	MOVEQ	#97,D0			;f20: 7061
+	MOVEQ	#46,D5			;f22: 7a2e
+	DC.W	$666f			;f24
+	BGT.S	LAB_017A		;f26: 6e74
+	DC.W	$0000			;f28
+LAB_016C:
+	BNE.S	LAB_016B		;f2a: 66ec
+	DBF	D4,LAB_016C		;f2c: 51ccfffc
+LAB_016D:
+	JSR	LAB_0171		;f30: 4eb900000f54
+	DBF	D7,LAB_016D		;f36: 51cffff8
+LAB_016E:
+	BSR.W	LAB_0171		;f3a: 61000018
+	DBF	D2,LAB_016E		;f3e: 51cafffa
+LAB_016F:
+	BSR.W	LAB_017D		;f42: 6100007e
+LAB_0170:
+	DBF	D7,LAB_016F		;f46: 51cffffa
+	DBF	D6,LAB_0170		;f4a: 51cefffa
+	MOVEQ	#-69,D5			;f4e: 7abb
+	UNLK	A5			;f50: 4e5d
+	RTS				;f52: 4e75
+LAB_0171:
+	BSR.W	LAB_017D		;f54: 6100006c
+	DBF	D7,LAB_0171		;f58: 51cffffa
+LAB_0172:
+	MOVE.L	#$0000072c,-(A7)	;f5c: 2f3c0000072c
+LAB_0173:
+	MOVE.L	(25398,A5),D4		;f62: 282d6336
+	MOVE.L	#$000009c6,-(A7)	;f66: 2f3c000009c6
+LAB_0174:
+	MOVE.L	D3,D6			;f6c: 2c03
+	MOVE.L	D6,D5			;f6e: 2a06
+LAB_0175:
+	BSR.W	LAB_017D		;f70: 61000050
+LAB_0177:
+	MOVEQ	#-108,D1		;f74: 7294
+	MOVE.W	(29421,A5),(8264,A5)	;f76: 3b6d72ed2048
+	BNE.S	LAB_0175		;f7c: 66f2
+	LEA	(LAB_0166,PC),A0	;f7e: 41faff56
+LAB_0178:
+	BRA.S	LAB_0179		;f82: 6008
+	ADDQ.W	#1,-(A5)		;f84: 5265
+	BSR.S	LAB_017E		;f86: 6164
+	DC.W	$792e			;f88
+	DC.W	$0000			;f8a
+LAB_0179:
+	DBF	D3,LAB_0178		;f8c: 51cbfff4
+	BSR.W	LAB_017D		;f90: 61000030
+	BRA.S	LAB_017B		;f94: 6008
+	ADDQ.W	#1,-(A5)		;f96: 5265
+	BSR.S	LAB_017F		;f98: 6164
+	DC.W	$792e			;f9a
+LAB_017A:
+	DC.W	$0000			;f9c
+LAB_017B:
+	BRA.S	LAB_017C		;f9e: 600e
+	DC.W	$4f75			;fa0
+	MOVEQ	#32,D2			;fa2: 7420
+	DC.W	$6f66			;fa4
+	MOVEA.L	(25965,A5),A0		;fa6: 206d656d
+	DC.W	$6f72			;faa
+	DC.W	$7900			;fac
+LAB_017C:
+	JSR	(-516,A6)		;fae: 4eaefdfc
+	ADDQ.L	#5,A4			;fb2: 5a8c
+	ADDQ.L	#3,A2			;fb4: 568a
+	JSR	(-246,A6)		;fb6: 4eaeff0a
+	MOVE.W	(14395,A5),(30091,A5)	;fba: 3b6d383b758b
+	RTS				;fc0: 4e75
+LAB_017D:
+	NOP				;fc2: 4e71
+	NOP				;fc4: 4e71
+	NOP				;fc6: 4e71
+	NOP				;fc8: 4e71
+	NOP				;fca: 4e71
+	NOP				;fcc: 4e71
+	NOP				;fce: 4e71
+	NOP				;fd0: 4e71
+	NOP				;fd2: 4e71
+	NOP				;fd4: 4e71
+	NOP				;fd6: 4e71
+	NOP				;fd8: 4e71
+	NOP				;fda: 4e71
+	NOP				;fdc: 4e71
+	NOP				;fde: 4e71
+	NOP				;fe0: 4e71
+	NOP				;fe2: 4e71
+	NOP				;fe4: 4e71
+	NOP				;fe6: 4e71
+	NOP				;fe8: 4e71
+	NOP				;fea: 4e71
+LAB_017E:
+	NOP				;fec: 4e71
+	NOP				;fee: 4e71
+	NOP				;ff0: 4e71
+	NOP				;ff2: 4e71
+	NOP				;ff4: 4e71
+	NOP				;ff6: 4e71
+	NOP				;ff8: 4e71
+	NOP				;ffa: 4e71
+	NOP				;ffc: 4e71
+LAB_017F:
+	RTS				;ffe: 4e75
+	END
@@ -0,0 +1,1725 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+	MC68040
+
+
+
+	ORG	$0
+
+SECSTRT_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0000:
+	BSR.W	LAB_0011
+	MOVE.L	D4,D0
+	BSR.W	LAB_0023
+LAB_0001:
+	BSR.W	LAB_0011
+	ADD.L	D2,D2
+	JSR	(-30,A6)
+LAB_0002:
+	BSR.W	LAB_0011
+	BNE.S	LAB_0002
+LAB_0003:
+	MOVE.L	(11602,A5),D3
+	DBF	D4,LAB_0003
+LAB_0004:
+	CMPI.L	#$000000b5,D1
+	DBF	D4,LAB_0004
+LAB_0005:
+	MOVE.W	(12732,A5),(17119,A5)
+LAB_0006:
+	CMP.L	#$00007e32,D6
+	JSR	(-366,A6)
+	BNE.S	LAB_0006
+LAB_0007:
+	ADD.L	D7,D2
+	DBF	D2,LAB_0007
+	BSR.W	LAB_0023
+	MOVE.L	(20022,A5),D5
+	JSR	(-90,A6)
+	JSR	(-768,A6)
+	JSR	(-96,A6)
+	LEA	(LAB_0000,PC),A4
+LAB_0008:
+	ADDQ.L	#7,A0
+	LEA	(LAB_0005+2,PC),A6
+	BNE.S	LAB_0008
+LAB_0009:
+	BSR.W	LAB_0035
+	DBF	D0,LAB_0009
+LAB_000A:
+	BSR.W	LAB_0023
+LAB_000B:
+	MOVE.L	(16094,A5),D7
+	BNE.S	LAB_000A
+	BNE.S	LAB_000B
+	BRA.S	LAB_000C
+	SUBQ.W	#3,(29291,A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_000C:
+	CMP.L	#$00006441,D1
+	BNE.S	LAB_000C
+	ADDQ.L	#4,A1
+	BSR.W	LAB_0011
+LAB_000D:
+	BSR.W	LAB_0035
+LAB_000E:
+	MOVE.L	(1210,A5),D0
+	DBF	D1,LAB_000E
+	BNE.S	LAB_000D
+LAB_000F:
+	BNE.S	LAB_000E
+	DBF	D0,LAB_000F
+LAB_0010:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0011:
+	LINK.W	A5,#-176
+	BSR.W	LAB_0023
+LAB_0012:
+	LEA	(LAB_0010+2,PC),A4
+	DBF	D0,LAB_0012
+LAB_0013:
+	MOVE.W	(27121,A5),(17250,A5)
+LAB_0014:
+	DBF	D4,LAB_0013
+	JSR	(-534,A6)
+	LEA	(LAB_0014,PC),A0
+	MOVE.L	D7,D7
+	MOVE.L	(4036,A5),D6
+	BSR.W	LAB_0035
+	MOVE.L	(6378,A5),D3
+	CMPI.L	#$00000014,D3
+	MOVE.L	D7,D5
+	ADDQ.L	#1,A7
+	MOVE.L	D0,D2
+LAB_0015:
+	CMP.L	#$0000175e,D1
+	DBF	D0,LAB_0015
+	BSR.W	LAB_0043
+	ADD.L	D1,D5
+	MOVE.L	D4,D3
+LAB_0016:
+	ADD.L	D0,D2
+	BNE.S	LAB_0016
+LAB_0017:
+	BRA.S	LAB_0018
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_0027+2
+	BSR.S	LAB_0027+4
+	DC.W	$7900
+LAB_0018:
+	BNE.S	LAB_0017
+	BSR.W	LAB_0035
+LAB_0019:
+	JSR	(-192,A6)
+	BNE.S	LAB_0019
+LAB_001A:
+	LEA	LAB_00BA,A4
+LAB_001B:
+	DBF	D7,LAB_001A
+LAB_001C:
+	DBF	D3,LAB_001B
+	CMPI.L	#$0000007b,D1
+	ADDQ.L	#2,A7
+LAB_001D:
+	BRA.S	LAB_001E
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_001F+2
+	DC.W	$0000
+LAB_001E:
+	BNE.S	LAB_001D
+	BSR.W	LAB_0043
+LAB_001F:
+	MOVE.W	(26788,A5),(12405,A5)
+LAB_0020:
+	CMPI.L	#$000000e9,D2
+LAB_0021:
+	DBF	D4,LAB_0020
+LAB_0022:
+	DBF	D0,LAB_0021
+	DBF	D0,LAB_0022
+	BSR.W	LAB_0043
+	MOVEQ	#-72,D5
+	ADDQ.L	#7,A5
+	UNLK	A5
+	RTS
+LAB_0023:
+	LINK.W	A5,#-116
+LAB_0024:
+	BSR.W	LAB_0035
+LAB_0025:
+	MOVE.W	(12451,A5),(21762,A5)
+LAB_0026:
+	CMP.L	#$0000445c,D7
+LAB_0027:
+	CMP.L	#$0000af63,D5
+LAB_0029:
+	BNE.S	LAB_0025
+	BRA.S	LAB_002A
+	BEQ.S	LAB_0031+2
+	BSR.S	LAB_0031+2
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_002A:
+	BRA.S	LAB_002B
+	BVS.S	LAB_0033
+	MOVEQ	#117,D2
+	BVS.S	LAB_0034
+	DC.W	$696f
+	BGT.S	LAB_002E+2
+	DC.W	$6c69
+	BHI.S	LAB_0035+2
+	BSR.S	LAB_0037
+	DC.W	$7900
+LAB_002B:
+	BSR.W	LAB_0053
+	DBF	D3,LAB_002B
+	MOVEQ	#92,D0
+	CMP.L	#$0000b361,D1
+	BRA.S	LAB_002D
+LAB_002C:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_002E
+	DC.W	$0000
+LAB_002D:
+	MOVE.W	(21223,A5),(11650,A5)
+	MOVE.L	D4,D6
+LAB_002E:
+	MOVE.L	(29222,A5),D2
+	CMPI.L	#$0000008f,D5
+	BSR.W	LAB_0053
+	BSR.W	LAB_0043
+LAB_0030:
+	MOVE.W	(16134,A5),(22264,A5)
+	DBF	D5,LAB_0030
+	MOVE.W	(25234,A5),(2263,A5)
+	MOVE.L	(30112,A5),D5
+	MOVE.L	D5,D2
+LAB_0031:
+	MOVE.L	(24182,A5),D5
+	MOVE.L	(13840,A5),D0
+LAB_0032:
+	ADD.L	D0,D7
+	BNE.S	LAB_0032
+	ADDQ.L	#5,A0
+	BSR.W	LAB_0035
+LAB_0033:
+	LEA	(LAB_0024+2,PC),A2
+	CMP.L	#$0000b3d4,D4
+LAB_0034:
+	UNLK	A5
+	RTS
+LAB_0035:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0037:
+	BSR.W	LAB_0043
+	BSR.W	LAB_0053
+	MOVE.W	(13771,A5),(28768,A5)
+LAB_0038:
+	ADDQ.L	#6,A5
+LAB_0039:
+	DBF	D5,LAB_0038
+LAB_003A:
+	BRA.S	LAB_003B
+	SUBQ.W	#3,(29291,A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_003B:
+	BRA.S	LAB_003D
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_0045
+	MOVEA.L	(25965,A5),A0
+	BLE.S	LAB_0047
+LAB_003C:
+	DC.W	$7900
+LAB_003D:
+	BSR.W	LAB_0053
+	BNE.S	LAB_003A
+	JSR	(-636,A6)
+	LEA	(LAB_0011,PC),A4
+	LEA	(LAB_001C+2,PC),A0
+	CMP.L	#$0000e59b,D6
+LAB_003E:
+	ADDQ.L	#1,A3
+	DBF	D6,LAB_003E
+	ADDQ.L	#7,A5
+LAB_003F:
+	BRA.S	LAB_0040
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0040:
+	ADDQ.L	#3,A4
+	BNE.S	LAB_003F
+	MOVE.W	(26473,A5),(11495,A5)
+LAB_0041:
+	CMPI.L	#$00000022,D5
+LAB_0042:
+	DBF	D0,LAB_0041
+	DBF	D1,LAB_0042
+	JSR	(-558,A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0043:
+	BSR.W	LAB_0053
+	MOVEQ	#13,D5
+	JSR	(-66,A6)
+	LEA	(LAB_0035+2,PC),A0
+LAB_0044:
+	MOVE.L	(8160,A5),D5
+LAB_0045:
+	ADD.L	D5,D7
+	ADD.L	D2,D7
+	MOVE.L	(14834,A5),D6
+LAB_0046:
+	ADDQ.L	#5,A0
+	ADD.L	D7,D7
+	MOVE.L	(22692,A5),D5
+	BNE.S	LAB_0046
+LAB_0047:
+	MOVE.W	(31558,A5),(31024,A5)
+	ADDQ.L	#4,A5
+LAB_0048:
+	BSR.W	LAB_0062
+	LEA	(LAB_0003,PC),A2
+	BSR.W	LAB_0053
+	MOVE.L	D0,D7
+LAB_0049:
+	BRA.S	LAB_004A
+	BVS.S	LAB_0054+4
+	MOVEQ	#117,D2
+	BVS.S	LAB_0056
+	DC.W	$696f
+	BGT.S	LAB_004E
+	DC.W	$6c69
+	BHI.S	LAB_0057+2
+	BSR.S	LAB_0058
+	DC.W	$7900
+LAB_004A:
+	BNE.S	LAB_0049
+LAB_004B:
+	LEA	LAB_0122+2,A4
+LAB_004C:
+	ADD.L	D1,D1
+	DBF	D0,LAB_004C
+LAB_004D:
+	MOVE.L	D3,D7
+	DBF	D1,LAB_004D
+	BRA.S	LAB_004F
+	BEQ.S	LAB_005A
+	BSR.S	LAB_005A
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+LAB_004E:
+	DC.W	$0000
+LAB_004F:
+	BSR.W	LAB_0053
+LAB_0050:
+	LEA	(LAB_0039+2,PC),A4
+	DBF	D6,LAB_0050
+	MOVE.L	(18198,A5),D3
+	BRA.S	LAB_0051
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_005C
+	DC.W	$792e
+	DC.W	$0000
+LAB_0051:
+	MOVEQ	#-7,D2
+	ADDQ.L	#6,A0
+LAB_0052:
+	ADDQ.L	#4,A3
+	DBF	D3,LAB_0052
+	MOVE.L	(11866,A5),D1
+	RTS
+LAB_0053:
+	LINK.W	A5,#-92
+	BSR.W	LAB_0062
+LAB_0054:
+	MOVE.W	(7034,A5),(17100,A5)
+	MOVE.W	(7346,A5),(21259,A5)
+	BNE.S	LAB_0054
+LAB_0056:
+	BSR.W	LAB_0082
+LAB_0057:
+	BSR.W	LAB_0074
+LAB_0058:
+	CMPI.L	#$0000009a,D7
+	BRA.S	LAB_0059
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_0063
+	DC.W	$0000
+LAB_0059:
+	LEA	(LAB_0001+2,PC),A0
+	BRA.S	LAB_005B
+LAB_005A:
+	BEQ.S	LAB_0066+2
+	BSR.S	LAB_0066+2
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_005B:
+	BSR.W	LAB_0062
+	BRA.S	LAB_005D
+LAB_005C:
+	BVS.S	LAB_0069
+	MOVEQ	#117,D2
+	BVS.S	LAB_006A+2
+	DC.W	$696f
+	BGT.S	LAB_0061
+	DC.W	$6c69
+	BHI.S	LAB_006B+4
+	BSR.S	LAB_006C
+	DC.W	$7900
+LAB_005D:
+	BRA.S	LAB_005E
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_005F
+	DC.W	$0000
+LAB_005E:
+	BRA.S	LAB_0060
+	BEQ.S	LAB_006E
+	BSR.S	LAB_006E
+	DC.W	$6869
+LAB_005F:
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_0060:
+	LEA	LAB_0035,A6
+LAB_0061:
+	BSR.W	LAB_0062
+	UNLK	A5
+	RTS
+LAB_0062:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0074
+	TST.L	D5
+	BRA.S	LAB_0063
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0071
+	DC.W	$792e
+	DC.W	$0000
+LAB_0063:
+	ADDQ.L	#3,A2
+LAB_0064:
+	BNE.S	LAB_0063
+LAB_0065:
+	BNE.S	LAB_0063
+LAB_0066:
+	DBF	D7,LAB_0065
+	BNE.S	LAB_0064
+LAB_0067:
+	BRA.S	LAB_0068
+	SUBQ.W	#3,(29291,A7)
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0068:
+	DBF	D3,LAB_0067
+LAB_0069:
+	MOVE.L	(3300,A5),D2
+	DBF	D6,LAB_0069
+LAB_006A:
+	BSR.W	LAB_0097
+LAB_006B:
+	CMP.L	#$00005996,D1
+LAB_006C:
+	MOVE.L	(10580,A5),D5
+	BNE.S	LAB_006C
+LAB_006D:
+	BRA.S	LAB_006F
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_0077+2
+	BSR.S	LAB_0077+4
+LAB_006E:
+	DC.W	$7900
+LAB_006F:
+	BNE.S	LAB_006D
+	ADDQ.L	#2,A2
+	BSR.W	LAB_0082
+	BRA.S	LAB_0072
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	(12335,A7),D0
+	MOVE.W	(47,A4,D3.W),D3
+LAB_0070:
+	MOVE.W	(47,A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+LAB_0071:
+	DC.W	$7574
+	DC.W	$0000
+LAB_0072:
+	MOVE.L	D0,D3
+	JSR	(-774,A6)
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0073,PC,D0.W),D0
+	JMP	(LAB_0073,PC,D0.W)
+LAB_0073:
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	ORI.B	#$1c,(A0)+
+	DC.W	$0020
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+	MOVEQ	#4,D0
+	RTS
+	MOVEQ	#5,D0
+	RTS
+LAB_0074:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0082
+LAB_0075:
+	CMPI.L	#$00000065,D3
+LAB_0076:
+	MOVEQ	#-38,D7
+	DBF	D5,LAB_0076
+	BNE.S	LAB_0075
+LAB_0077:
+	CMP.L	#$0000aeb9,D3
+LAB_007A:
+	BSR.W	LAB_0097
+	BSR.W	LAB_009F
+LAB_007B:
+	BSR.W	LAB_0082
+LAB_007C:
+	BNE.S	LAB_007A
+	DBF	D7,LAB_007C
+LAB_007D:
+	BNE.S	LAB_007B
+	DBF	D6,LAB_007D
+LAB_007E:
+	MOVE.L	D4,D7
+	MOVE.L	D2,D4
+LAB_007F:
+	BNE.S	LAB_007E
+	DBF	D3,LAB_007F
+LAB_0080:
+	BSR.W	LAB_0082
+	JSR	(-72,A6)
+	MOVE.L	D1,D0
+LAB_0081:
+	BNE.S	LAB_0080
+	MOVE.L	D5,D0
+	BNE.S	LAB_0081
+	CMP.L	#$0000340d,D2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0082:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0083:
+	BSR.W	LAB_0097
+	TST.L	D5
+	BSR.W	LAB_0097
+	BNE.S	LAB_0083
+LAB_0084:
+	BRA.S	LAB_0086
+	DC.W	$4f75
+	MOVEQ	#32,D2
+LAB_0085:
+	BLE.S	LAB_0090
+	MOVEA.L	(25965,A5),A0
+	BLE.S	LAB_0092+2
+	DC.W	$7900
+LAB_0086:
+	DBF	D1,LAB_0084
+LAB_0088:
+	DBF	D0,LAB_0086
+LAB_0089:
+	LEA	LAB_0045,A2
+	DBF	D0,LAB_0089
+LAB_008A:
+	LEA	LAB_00E6+2,A0
+	MOVE.W	(3714,A5),(28703,A5)
+LAB_008B:
+	ADDQ.L	#4,A1
+LAB_008C:
+	DBF	D5,LAB_008B
+	DBF	D4,LAB_008C
+	LEA	LAB_0086+2,A2
+	BRA.S	LAB_008D
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_008D:
+	LEA	LAB_0085,A4
+LAB_008E:
+	LEA	(LAB_008A+4,PC),A6
+	DBF	D6,LAB_008E
+	CMPI.L	#$00000074,D7
+	BRA.S	LAB_008F
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_009A+4
+	BSR.S	LAB_009B
+	DC.W	$7900
+LAB_008F:
+	MOVEQ	#-123,D0
+	MOVE.L	D1,D2
+LAB_0090:
+	BNE.S	LAB_008F
+	BRA.S	LAB_0093
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	(12335,A7),D0
+LAB_0091:
+	MOVE.W	(47,A4,D3.W),D3
+LAB_0092:
+	MOVE.W	(47,A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_0093:
+	JSR	LAB_00A1
+	DBF	D5,LAB_0093
+LAB_0094:
+	CMP.L	#$0000e1d7,D0
+	MOVEQ	#124,D2
+	BNE.S	LAB_0094
+	MOVE.L	D6,D0
+LAB_0095:
+	MOVE.W	(17061,A5),(12384,A5)
+LAB_0096:
+	DBF	D0,LAB_0095
+	DBF	D5,LAB_0096
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0097:
+	LINK.W	A5,#-44
+	BSR.W	LAB_009F
+	MOVE.W	(25563,A5),(19676,A5)
+	ADDQ.L	#2,A1
+LAB_0098:
+	BSR.W	LAB_009F
+	LEA	LAB_004F,A6
+	MOVEQ	#-57,D0
+LAB_0099:
+	BNE.S	LAB_0098
+	BNE.S	LAB_0099
+LAB_009A:
+	MOVE.L	#$000006a8,-(A7)
+LAB_009B:
+	BRA.S	LAB_009C
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_00A2
+	MOVEA.L	(25965,A5),A0
+	BLE.S	LAB_00A4
+	DC.W	$7900
+LAB_009C:
+	JSR	(-822,A6)
+	MOVE.W	(17297,A5),(2646,A5)
+	MOVEQ	#47,D5
+	BNE.S	LAB_009C
+	BRA.S	LAB_009D
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_00A8
+	DC.W	$0000
+LAB_009D:
+	ADD.L	D6,D7
+	UNLK	A5
+LAB_009E:
+	RTS
+LAB_009F:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00A1
+	BSR.W	LAB_00AA
+	ADD.W	D0,D0
+	MOVE.W	(LAB_00A0,PC,D0.W),D0
+	JMP	(LAB_00A0,PC,D0.W)
+LAB_00A0:
+	DC.W	$0008
+	DC.W	$000c
+	ORI.B	#$14,(A0)
+	MOVEQ	#0,D0
+	RTS
+	MOVEQ	#1,D0
+	RTS
+	MOVEQ	#2,D0
+	RTS
+	MOVEQ	#3,D0
+	RTS
+LAB_00A1:
+	BSR.W	LAB_00AA
+	BSR.W	LAB_00AA
+	MOVEQ	#6,D7
+	BSR.W	LAB_00B6
+LAB_00A2:
+	MOVE.W	(15062,A5),(32547,A5)
+	MOVE.L	(7558,A5),D0
+	MOVEQ	#71,D7
+LAB_00A3:
+	BNE.S	LAB_00A2
+	DBF	D7,LAB_00A3
+LAB_00A4:
+	ADDQ.L	#6,A2
+	BRA.S	LAB_00A5
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_00AE+4
+	BSR.S	LAB_00AF
+	DC.W	$7900
+LAB_00A5:
+	ADD.L	D3,D1
+LAB_00A6:
+	MOVE.L	D6,D5
+	DBF	D7,LAB_00A6
+LAB_00A7:
+	MOVE.L	D0,D5
+	DBF	D0,LAB_00A7
+LAB_00A8:
+	BNE.S	LAB_00A7
+	DBF	D0,LAB_00A8
+LAB_00A9:
+	MOVEQ	#-63,D5
+	BNE.S	LAB_00A9
+	LEA	(LAB_0077,PC),A4
+	ADDQ.L	#7,A5
+	BSR.W	LAB_00B6
+	RTS
+LAB_00AA:
+	BSR.W	LAB_00B6
+	CMPI.L	#$00000046,D4
+	MOVEQ	#64,D4
+LAB_00AB:
+	CMP.L	#$0000384f,D3
+	DBF	D7,LAB_00AB
+	BSR.W	LAB_00D4
+	BNE.S	LAB_00AB
+LAB_00AC:
+	MOVEQ	#-90,D4
+	MOVE.L	(8534,A5),D1
+	CMPI.L	#$00000074,D3
+LAB_00AD:
+	BNE.S	LAB_00AC
+	DBF	D7,LAB_00AD
+	MOVEQ	#-111,D6
+	CMP.L	#$0000801e,D5
+	BSR.W	LAB_00B6
+	MOVE.L	D3,D6
+	BSR.W	LAB_00C0
+	CMPI.L	#$000000a5,D4
+LAB_00AE:
+	CMP.L	#$00005790,D5
+LAB_00AF:
+	CMPI.L	#$000000c5,D3
+	ADDQ.L	#2,A7
+	MOVEQ	#-118,D0
+	JSR	(-588,A6)
+	MOVE.W	(23789,A5),(23828,A5)
+LAB_00B0:
+	BSR.W	LAB_00C0
+LAB_00B1:
+	BNE.S	LAB_00B0
+	DBF	D2,LAB_00B1
+LAB_00B2:
+	BRA.S	LAB_00B3
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_00B4
+	DC.W	$0000
+LAB_00B3:
+	BNE.S	LAB_00B2
+	BSR.W	LAB_00C0
+	BNE.S	LAB_00B3
+LAB_00B4:
+	LEA	(LAB_004B+2,PC),A0
+	BRA.S	LAB_00B5
+	BVS.S	LAB_00B9
+	MOVEQ	#117,D2
+	BVS.S	LAB_00BC
+	DC.W	$696f
+	BGT.S	LAB_00B7
+	DC.W	$6c69
+	BHI.S	LAB_00BD
+	BSR.S	LAB_00BE
+	DC.W	$7900
+LAB_00B5:
+	MOVE.L	(17736,A5),D0
+	BSR.W	LAB_00C0
+	LEA	LAB_0159,A2
+	RTS
+LAB_00B6:
+	LINK.W	A5,#-60
+	BSR.W	LAB_00C0
+	MOVEQ	#60,D2
+	BRA.S	LAB_00B8
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_00BF+4
+	MOVEA.L	(25965,A5),A0
+LAB_00B7:
+	BLE.S	LAB_00C1
+	DC.W	$7900
+LAB_00B8:
+	MOVE.W	(22068,A5),(22168,A5)
+	MOVE.L	D4,D5
+	ADD.L	D6,D2
+	JSR	(-384,A6)
+	MOVE.L	(9734,A5),D7
+	ADD.L	D7,D1
+	CMP.L	#$000015ed,D1
+	CMPI.L	#$000000d4,D4
+	BSR.W	LAB_00DC
+	CMPI.L	#$000000fc,D2
+	MOVE.L	(8004,A5),D7
+	BRA.S	LAB_00BB
+	SUBQ.W	#3,(29291,A7)
+LAB_00B9:
+	DC.W	$6265
+LAB_00BA:
+	DC.W	$6e63
+	DC.W	$6800
+LAB_00BB:
+	JSR	(-852,A6)
+LAB_00BC:
+	ADD.L	D7,D0
+	LEA	(LAB_0009,PC),A6
+LAB_00BD:
+	MOVE.L	D2,D2
+LAB_00BE:
+	CMP.L	#$00009381,D4
+	CMP.L	#$000074eb,D3
+	ADDQ.L	#4,A2
+	JSR	(-174,A6)
+	ADDQ.L	#5,A2
+LAB_00BF:
+	MOVE.L	#$000000bc,-(A7)
+	MOVE.L	D3,D6
+	MOVE.L	#$0000007c,-(A7)
+	UNLK	A5
+	RTS
+LAB_00C0:
+	LINK.W	A5,#-80
+LAB_00C1:
+	BSR.W	LAB_00D4
+LAB_00C2:
+	DBF	D5,LAB_00C1
+	MOVEQ	#-19,D7
+LAB_00C3:
+	JSR	(-624,A6)
+	DBF	D0,LAB_00C3
+LAB_00C4:
+	BSR.W	LAB_00E5
+LAB_00C5:
+	BNE.S	LAB_00C3
+LAB_00C6:
+	BNE.S	LAB_00C4
+LAB_00C7:
+	BNE.S	LAB_00C5
+LAB_00C8:
+	BNE.S	LAB_00C6
+	DBF	D1,LAB_00C8
+	BNE.S	LAB_00C7
+	LEA	(LAB_009E,PC),A4
+	BSR.W	LAB_00D4
+	LEA	LAB_0091+2,A0
+	BRA.S	LAB_00C9
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_00CA
+	DC.W	$0000
+LAB_00C9:
+	JSR	(-618,A6)
+	ADDQ.L	#7,A1
+	ADDQ.L	#1,A0
+LAB_00CA:
+	LEA	(LAB_002C+4,PC),A0
+	DBF	D2,LAB_00CA
+	BRA.S	LAB_00CB
+	BVS.S	LAB_00D3
+	MOVEQ	#117,D2
+	BVS.S	LAB_00D5+2
+	DC.W	$696f
+	BGT.S	LAB_00CF
+	DC.W	$6c69
+	BHI.S	LAB_00D6+2
+	BSR.S	LAB_00D6+4
+	DC.W	$7900
+LAB_00CB:
+	BSR.W	LAB_00D4
+	CMPI.L	#$0000000f,D1
+	JSR	LAB_00D4
+LAB_00CC:
+	MOVE.W	(9075,A5),(3061,A5)
+	DBF	D2,LAB_00CC
+LAB_00CD:
+	MOVE.L	D7,D2
+	DBF	D7,LAB_00CD
+	BSR.W	LAB_00DC
+LAB_00CE:
+	BRA.S	LAB_00D0
+LAB_00CF:
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_00D9
+	DC.W	$0000
+LAB_00D0:
+	DBF	D7,LAB_00CE
+	MOVEQ	#-48,D2
+	ADD.L	D4,D6
+	BNE.S	LAB_00D0
+	BRA.S	LAB_00D1
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_00D1:
+	CMP.L	#$0000e52b,D3
+	DBF	D1,LAB_00D1
+	BRA.S	LAB_00D3
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_00DD+2
+	DC.W	$0000
+LAB_00D3:
+	UNLK	A5
+	RTS
+LAB_00D4:
+	BSR.W	LAB_00DC
+LAB_00D5:
+	BSR.W	LAB_00F8
+	ADD.L	D0,D5
+LAB_00D6:
+	MOVE.W	(17271,A5),(9777,A5)
+	JSR	(-294,A6)
+	BSR.W	LAB_00DC
+	BSR.W	LAB_00E5
+	MOVE.W	(13720,A5),(12787,A5)
+LAB_00D8:
+	ADD.L	D5,D0
+	DBF	D0,LAB_00D8
+	ADDQ.L	#5,A3
+	JSR	LAB_00DC
+	BSR.W	LAB_00F8
+	CMPI.L	#$00000072,D6
+	JSR	(-774,A6)
+	BSR.W	LAB_00E5
+LAB_00D9:
+	MOVEQ	#62,D0
+LAB_00DA:
+	MOVE.L	D5,D6
+	DBF	D6,LAB_00DA
+LAB_00DB:
+	MOVE.W	(13955,A5),(15150,A5)
+	BNE.S	LAB_00DA
+	ADD.L	D1,D5
+	BNE.S	LAB_00DB
+	ADDQ.L	#7,A1
+	RTS
+LAB_00DC:
+	BSR.W	LAB_00E5
+	BSR.W	LAB_00E5
+	BRA.S	LAB_00DE
+	BEQ.S	LAB_00E7+4
+	BSR.S	LAB_00E7+4
+	DC.W	$6869
+	DC.W	$6373
+LAB_00DD:
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_00DE:
+	ADD.L	D2,D2
+	BSR.W	LAB_00E5
+	ADD.L	D5,D6
+	MOVE.L	D5,D1
+	BSR.W	LAB_00E5
+LAB_00DF:
+	BSR.W	LAB_0100
+	DBF	D0,LAB_00DF
+LAB_00E0:
+	MOVEQ	#77,D3
+	CMPI.L	#$00000017,D6
+	BSR.W	LAB_00F8
+	BNE.S	LAB_00E0
+	LEA	(LAB_0088,PC),A6
+LAB_00E1:
+	BSR.W	LAB_0100
+LAB_00E2:
+	DBF	D1,LAB_00E1
+LAB_00E3:
+	CMPI.L	#$00000034,D7
+	DBF	D4,LAB_00E3
+LAB_00E4:
+	BNE.S	LAB_00E2
+	DBF	D7,LAB_00E4
+	MOVEQ	#-110,D6
+	BSR.W	LAB_00F8
+	JSR	LAB_00F8
+	RTS
+LAB_00E5:
+	LINK.W	A5,#-176
+	BSR.W	LAB_00F8
+LAB_00E6:
+	MOVE.L	(18308,A5),D3
+	LEA	(LAB_0048+2,PC),A0
+LAB_00E7:
+	LEA	LAB_00EE+4,A0
+	BSR.W	LAB_0100
+	BSR.W	LAB_00F8
+	MOVE.W	(2802,A5),(4199,A5)
+	BSR.W	LAB_0100
+	ADD.L	D4,D2
+	BSR.W	LAB_00F8
+	BRA.S	LAB_00E9
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_00F6
+	BSR.S	LAB_00F7
+	DC.W	$7900
+LAB_00E9:
+	ADDQ.L	#6,A1
+	JSR	(-624,A6)
+LAB_00EA:
+	MOVE.W	(8817,A5),(18293,A5)
+	BSR.W	LAB_00F8
+LAB_00EB:
+	BNE.S	LAB_00EA
+	DBF	D2,LAB_00EB
+LAB_00EC:
+	CMPI.L	#$00000067,D5
+	BNE.S	LAB_00EC
+LAB_00ED:
+	ADD.L	D3,D3
+	DBF	D7,LAB_00ED
+	JSR	(-102,A6)
+	BSR.W	LAB_0100
+	BRA.S	LAB_00EF
+LAB_00EE:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_00F1
+	DC.W	$0000
+LAB_00EF:
+	MOVEQ	#-85,D5
+LAB_00F0:
+	MOVE.L	D7,D4
+	DBF	D6,LAB_00F0
+LAB_00F1:
+	BSR.W	LAB_010B
+	DBF	D3,LAB_00F1
+	BRA.S	LAB_00F2
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_00F2:
+	CMP.L	#$00005c72,D4
+LAB_00F3:
+	MOVE.L	(13612,A5),D4
+	DBF	D3,LAB_00F3
+	MOVE.L	D0,D0
+	MOVEQ	#-38,D4
+LAB_00F4:
+	ADD.L	D4,D3
+LAB_00F5:
+	ADDQ.L	#1,A6
+	DBF	D7,LAB_00F5
+	BNE.S	LAB_00F4
+LAB_00F6:
+	UNLK	A5
+LAB_00F7:
+	RTS
+LAB_00F8:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0100
+	MOVEQ	#-80,D6
+	TST.L	D1
+	MOVE.L	#$00000608,-(A7)
+LAB_00F9:
+	BSR.W	LAB_0116
+LAB_00FA:
+	DBF	D1,LAB_00F9
+	DBF	D4,LAB_00FA
+	BSR.W	LAB_0116
+	BSR.W	LAB_0100
+LAB_00FB:
+	BRA.S	LAB_00FC
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0104+2
+	DC.W	$792e
+	DC.W	$0000
+LAB_00FC:
+	BRA.S	LAB_00FD
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_00FE+2
+	DC.W	$0000
+LAB_00FD:
+	BSR.W	LAB_010B
+	BNE.S	LAB_00FB
+LAB_00FE:
+	CMP.L	#$000070b5,D3
+LAB_00FF:
+	BSR.W	LAB_0116
+	BNE.S	LAB_00FF
+	BSR.W	LAB_0116
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0100:
+	LINK.W	A5,#-112
+	BSR.W	LAB_010B
+LAB_0101:
+	BSR.W	LAB_0116
+	LEA	(LAB_00F5,PC),A6
+	BRA.S	LAB_0102
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_0108
+	DC.W	$0000
+LAB_0102:
+	ADDQ.L	#4,A0
+LAB_0103:
+	ADD.L	D7,D6
+	DBF	D6,LAB_0103
+	BSR.W	LAB_010B
+	JSR	(-732,A6)
+	MOVE.L	(6040,A5),D5
+	LEA	(LAB_00D1+2,PC),A2
+LAB_0104:
+	CMPI.L	#$000000a7,D6
+	BSR.W	LAB_010B
+LAB_0105:
+	MOVEQ	#-105,D4
+	DBF	D0,LAB_0105
+	MOVE.L	(294,A5),D3
+	ADD.L	D6,D0
+LAB_0106:
+	JSR	LAB_0121
+	MOVE.L	D2,D3
+	ADD.L	D1,D5
+	BNE.S	LAB_0106
+	BRA.S	LAB_0107
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_0110
+	DC.W	$0000
+LAB_0107:
+	JSR	LAB_0121
+	MOVEQ	#112,D4
+	MOVE.L	#$000002b8,-(A7)
+	BSR.W	LAB_010B
+	MOVE.L	(1384,A5),D6
+	ADDQ.L	#1,A1
+	BSR.W	LAB_0121
+	BSR.W	LAB_0116
+	MOVE.L	(7584,A5),D7
+	BRA.S	LAB_0109
+	SUBQ.W	#3,(29291,A7)
+LAB_0108:
+	DC.W	$6265
+	DC.W	$6e63
+	DC.W	$6800
+LAB_0109:
+	CMPI.L	#$00000044,D2
+LAB_010A:
+	CMPI.L	#$00000062,D0
+	BSR.W	LAB_0116
+	BNE.S	LAB_010A
+	MOVE.L	(26582,A5),D4
+	UNLK	A5
+	RTS
+LAB_010B:
+	BSR.W	LAB_0116
+LAB_010C:
+	TST.L	D0
+	BSR.W	LAB_0116
+LAB_010D:
+	BNE.S	LAB_010C
+	DBF	D7,LAB_010D
+LAB_010E:
+	BRA.S	LAB_010F
+	BEQ.S	LAB_011A
+	BSR.S	LAB_011A
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_010F:
+	DBF	D2,LAB_010E
+LAB_0110:
+	CMPI.L	#$000000b2,D0
+	JSR	(-786,A6)
+LAB_0111:
+	BNE.S	LAB_0110
+	CMP.L	#$000018e5,D5
+LAB_0112:
+	MOVE.W	(29060,A5),(1895,A5)
+	BNE.S	LAB_0111
+LAB_0113:
+	ADDQ.L	#4,A1
+	BNE.S	LAB_0112
+	CMP.L	#$0000b521,D4
+	BNE.S	LAB_0113
+	CMPI.L	#$000000f3,D7
+LAB_0114:
+	BSR.W	LAB_012C
+LAB_0115:
+	DBF	D0,LAB_0114
+	BSR.W	LAB_012C
+	ADDQ.L	#6,A7
+	BNE.S	LAB_0115
+	BSR.W	LAB_012C
+	BSR.W	LAB_0116
+	RTS
+LAB_0116:
+	BSR.W	LAB_0121
+LAB_0117:
+	ADDQ.L	#5,A2
+	TST.L	D7
+LAB_0118:
+	BNE.S	LAB_0117
+	DBF	D7,LAB_0118
+	MOVE.W	(115,A5),(27059,A5)
+LAB_0119:
+	MOVEQ	#33,D4
+	ADD.L	D2,D7
+LAB_011A:
+	BNE.S	LAB_0119
+	MOVE.L	(21004,A5),D6
+	BSR.W	LAB_012C
+	BSR.W	LAB_013D
+	MOVE.L	D2,D5
+	CMP.L	#$000062e6,D0
+	ADDQ.L	#7,A5
+LAB_011B:
+	LEA	(LAB_0044+2,PC),A0
+	MOVE.L	#$00000972,-(A7)
+	LEA	(LAB_0101+2,PC),A2
+LAB_011C:
+	BNE.S	LAB_011B
+	BRA.S	LAB_011D
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_011D:
+	ADDQ.L	#5,A2
+	BNE.S	LAB_011C
+	MOVE.L	(20568,A5),D3
+LAB_011E:
+	MOVE.L	(13700,A5),D7
+	BSR.W	LAB_013D
+LAB_011F:
+	ADD.L	D5,D7
+	BNE.S	LAB_011E
+	BNE.S	LAB_011F
+	BNE.S	LAB_011F
+	MOVE.L	(3608,A5),D1
+	ADDQ.L	#1,A2
+	MOVEQ	#-24,D5
+	CMPI.L	#$00000033,D2
+LAB_0120:
+	MOVE.W	(9689,A5),(1490,A5)
+	JSR	(-684,A6)
+	BSR.W	LAB_012C
+	BNE.S	LAB_0120
+	RTS
+LAB_0121:
+	LINK.W	A5,#-136
+	BSR.W	LAB_012C
+	MOVE.L	#$00000460,-(A7)
+	MOVE.L	(28820,A5),D0
+LAB_0122:
+	JSR	(-72,A6)
+	MOVE.L	(16988,A5),D3
+LAB_0123:
+	BSR.W	LAB_015A
+LAB_0124:
+	BNE.S	LAB_0123
+	BNE.S	LAB_0124
+	JSR	(-672,A6)
+LAB_0125:
+	CMP.L	#$0000e893,D4
+	DBF	D2,LAB_0125
+	BSR.W	LAB_012C
+	CMP.L	#$0000d791,D0
+	ADDQ.L	#2,A3
+	CMP.L	#$0000b6ce,D2
+	ADD.L	D0,D5
+LAB_0126:
+	BRA.S	LAB_0127
+	DC.W	$434f
+	DC.W	$4e3a
+	MOVE.W	(12335,A7),D0
+	MOVE.W	(47,A4,D3.W),D3
+	MOVE.W	(47,A0,D3.W),D1
+	DC.W	$4f75
+	MOVEQ	#112,D2
+	DC.W	$7574
+	DC.W	$0000
+LAB_0127:
+	BNE.S	LAB_0126
+LAB_0128:
+	BRA.S	LAB_0129
+	BEQ.S	LAB_012B
+	BSR.S	LAB_012B
+	DC.W	$6869
+	DC.W	$6373
+	MOVEA.L	(26978,A4),A7
+	MOVEQ	#97,D1
+	MOVEQ	#121,D1
+	DC.W	$0000
+LAB_0129:
+	DBF	D4,LAB_0128
+	CMP.L	#$0000b200,D5
+	BSR.W	LAB_015A
+	JSR	LAB_012C
+	ADD.L	D3,D4
+	ADDQ.L	#4,A7
+	JSR	(-822,A6)
+	ADD.L	D5,D6
+	MOVE.L	D2,D4
+	CMPI.L	#$0000007b,D0
+	MOVE.W	(25323,A5),(8686,A5)
+	CMPI.L	#$00000044,D6
+	BSR.W	LAB_015A
+	BRA.S	LAB_012A
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_0133
+	BSR.S	LAB_0134
+	DC.W	$7900
+LAB_012A:
+	BSR.W	LAB_015A
+	JSR	(-186,A6)
+	ADD.L	D2,D5
+	MOVE.W	(18413,A5),(25378,A5)
+	BSR.W	LAB_012C
+	BRA.S	LAB_012B
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_0135
+	DC.W	$792e
+	DC.W	$0000
+LAB_012B:
+	UNLK	A5
+	RTS
+LAB_012C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_012D:
+	BSR.W	LAB_013D
+	DBF	D5,LAB_012D
+	BSR.W	LAB_013D
+	MOVE.W	(12796,A5),(10655,A5)
+	BRA.S	LAB_012E
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_013A
+	BSR.S	LAB_013B
+	DC.W	$7900
+LAB_012E:
+	BSR.W	LAB_013D
+	BSR.W	LAB_0161
+	ADD.L	D4,D6
+LAB_012F:
+	CMPI.L	#$0000000a,D2
+LAB_0130:
+	DBF	D2,LAB_012F
+LAB_0131:
+	DBF	D4,LAB_0130
+	JSR	(-468,A6)
+	BSR.W	LAB_013D
+LAB_0132:
+	BNE.S	LAB_0131
+	BNE.S	LAB_0132
+	LEA	(LAB_0026+2,PC),A0
+LAB_0133:
+	ADDQ.L	#5,A6
+LAB_0134:
+	BRA.S	LAB_0136
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_013F
+	MOVEA.L	(25965,A5),A0
+	BLE.S	LAB_0142
+LAB_0135:
+	DC.W	$7900
+LAB_0136:
+	MOVE.L	D6,D4
+	BSR.W	LAB_0161
+	BRA.S	LAB_0137
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	BLE.S	LAB_0143
+	MOVEA.L	(25965,A5),A0
+	BLE.S	LAB_0145
+	DC.W	$7900
+LAB_0137:
+	MOVEQ	#-123,D5
+LAB_0138:
+	MOVEQ	#81,D6
+	DBF	D7,LAB_0138
+	LEA	LAB_00E7,A2
+	BRA.S	LAB_0139
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0139:
+	CMP.L	#$000055ec,D5
+LAB_013A:
+	BRA.S	LAB_013C
+LAB_013B:
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_013C:
+	DBF	D3,LAB_013A
+	DBF	D2,LAB_013C
+	BSR.W	LAB_013D
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_013D:
+	BSR.W	LAB_015A
+LAB_013E:
+	BRA.S	LAB_013F
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_013F:
+	DBF	D2,LAB_013E
+	BNE.S	LAB_013E
+	MOVEQ	#31,D7
+LAB_0140:
+	BRA.S	LAB_0144
+	BVS.S	LAB_014F
+	MOVEQ	#117,D2
+LAB_0141:
+	BVS.S	LAB_0150+4
+	DC.W	$696f
+LAB_0142:
+	BGT.S	LAB_0148+4
+	DC.W	$6c69
+LAB_0143:
+	BHI.S	LAB_0151
+	BSR.S	LAB_0151+2
+	DC.W	$7900
+LAB_0144:
+	DBF	D7,LAB_0140
+	ADDQ.L	#1,A5
+	CMP.L	#$0000a3ce,D6
+LAB_0145:
+	CMP.L	#$000006a1,D4
+LAB_0146:
+	BRA.S	LAB_0147
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_0148+4
+	DC.W	$0000
+LAB_0147:
+	DBF	D6,LAB_0146
+LAB_0148:
+	CMP.L	#$00001ffb,D7
+	BNE.S	LAB_0146
+	LEA	LAB_0029,A4
+	ADDQ.L	#6,A6
+	CMP.L	#$00001395,D4
+	MOVE.L	D0,D2
+	ADD.L	D1,D2
+	BSR.W	LAB_0161
+LAB_0149:
+	MOVE.W	(15022,A5),(19803,A5)
+LAB_014A:
+	DBF	D1,LAB_0149
+	DBF	D1,LAB_014A
+LAB_014B:
+	CMP.L	#$0000036e,D4
+LAB_014C:
+	DBF	D0,LAB_014B
+LAB_014D:
+	BNE.S	LAB_014C
+LAB_014E:
+	DBF	D7,LAB_014D
+LAB_014F:
+	DBF	D1,LAB_014E
+	BRA.S	LAB_0151
+LAB_0150:
+	MOVE.L	(32,A3,D3.L*2),(9580,A2)
+	BCC.S	LAB_0153
+	DC.W	$0000
+LAB_0151:
+	BSR.W	LAB_0161
+	BSR.W	LAB_0171
+LAB_0153:
+	BRA.S	LAB_0154
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_015D
+	DC.W	$792e
+	DC.W	$0000
+LAB_0154:
+	MOVEQ	#-119,D3
+LAB_0155:
+	BNE.S	LAB_0153
+	BSR.W	LAB_0171
+	BNE.S	LAB_0155
+	MOVE.W	(698,A5),(21055,A5)
+LAB_0156:
+	MOVE.W	(10660,A5),(30711,A5)
+	DBF	D0,LAB_0156
+LAB_0157:
+	CMP.L	#$00007c21,D1
+LAB_0158:
+	DBF	D1,LAB_0157
+	DBF	D3,LAB_0158
+LAB_0159:
+	MOVE.L	(18338,A5),D2
+	RTS
+LAB_015A:
+	BSR.W	LAB_0161
+	CMPI.L	#$0000005b,D5
+	CMPI.L	#$00000092,D6
+	MOVE.W	(19449,A5),(6702,A5)
+LAB_015B:
+	MOVE.L	D7,D6
+	ADDQ.L	#6,A3
+	BNE.S	LAB_015B
+	JSR	(-696,A6)
+	CMPI.L	#$000000df,D4
+	ADDQ.L	#3,A5
+	ADD.L	D4,D0
+LAB_015C:
+	CMP.L	#$0000b136,D2
+	BNE.S	LAB_015C
+LAB_015D:
+	BNE.S	LAB_015C
+LAB_015E:
+	DBF	D6,LAB_015D
+LAB_015F:
+	DBF	D7,LAB_015E
+LAB_0160:
+	DBF	D6,LAB_015F
+	DBF	D5,LAB_0160
+	LEA	(LAB_003C,PC),A4
+	RTS
+LAB_0161:
+	LINK.W	A5,#-16
+	BSR.W	LAB_0171
+	LEA	(LAB_0070,PC),A2
+	BRA.S	LAB_0162
+	DC.W	$646f
+	DC.W	$732e
+	DC.W	$6c69
+	BHI.S	LAB_0168
+	BSR.S	LAB_0169
+	DC.W	$7900
+LAB_0162:
+	BSR.W	LAB_017D
+	MOVE.L	D2,D0
+	BRA.S	LAB_0163
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0163:
+	BNE.S	LAB_0162
+	BNE.S	LAB_0163
+	BSR.W	LAB_017D
+	JSR	(-198,A6)
+LAB_0164:
+	MOVE.L	#$00000110,-(A7)
+	BRA.S	LAB_0165
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0165:
+	ADD.L	D4,D2
+	BNE.S	LAB_0164
+	MOVE.W	(25507,A5),(13732,A5)
+	BNE.S	LAB_0165
+	LEA	(LAB_00C2,PC),A4
+	MOVEQ	#122,D3
+	BRA.S	LAB_0166
+	DC.W	$4572
+	MOVEQ	#111,D1
+	MOVEQ	#58,D1
+	MOVE.L	D0,D0
+LAB_0166:
+	JSR	(-498,A6)
+	BSR.W	LAB_017D
+	BRA.S	LAB_0167
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_0172+2
+	DC.W	$0000
+LAB_0167:
+	BSR.W	LAB_017D
+	BRA.S	LAB_016A
+	BVS.S	LAB_0173
+	MOVEQ	#117,D2
+	BVS.S	LAB_0174
+	DC.W	$696f
+	BGT.S	LAB_016C
+LAB_0168:
+	DC.W	$6c69
+LAB_0169:
+	BHI.S	LAB_0175+2
+	BSR.S	LAB_0177
+	DC.W	$7900
+LAB_016A:
+	BNE.S	LAB_0167
+	MOVE.L	(26518,A5),D2
+	BSR.W	LAB_017D
+	BSR.W	LAB_0171
+	LEA	LAB_0020,A6
+LAB_016B:
+	LEA	(LAB_0141,PC),A2
+	BRA.S	LAB_016C
+	MOVEQ	#111,D2
+	MOVEQ	#97,D0
+	MOVEQ	#46,D5
+	DC.W	$666f
+	BGT.S	LAB_017A
+	DC.W	$0000
+LAB_016C:
+	BNE.S	LAB_016B
+	DBF	D4,LAB_016C
+LAB_016D:
+	JSR	LAB_0171
+	DBF	D7,LAB_016D
+LAB_016E:
+	BSR.W	LAB_0171
+	DBF	D2,LAB_016E
+LAB_016F:
+	BSR.W	LAB_017D
+LAB_0170:
+	DBF	D7,LAB_016F
+	DBF	D6,LAB_0170
+	MOVEQ	#-69,D5
+	UNLK	A5
+	RTS
+LAB_0171:
+	BSR.W	LAB_017D
+	DBF	D7,LAB_0171
+LAB_0172:
+	MOVE.L	#$0000072c,-(A7)
+LAB_0173:
+	MOVE.L	(25398,A5),D4
+	MOVE.L	#$000009c6,-(A7)
+LAB_0174:
+	MOVE.L	D3,D6
+	MOVE.L	D6,D5
+LAB_0175:
+	BSR.W	LAB_017D
+LAB_0177:
+	MOVEQ	#-108,D1
+	MOVE.W	(29421,A5),(8264,A5)
+	BNE.S	LAB_0175
+	LEA	(LAB_0166,PC),A0
+LAB_0178:
+	BRA.S	LAB_0179
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_017E
+	DC.W	$792e
+	DC.W	$0000
+LAB_0179:
+	DBF	D3,LAB_0178
+	BSR.W	LAB_017D
+	BRA.S	LAB_017B
+	ADDQ.W	#1,-(A5)
+	BSR.S	LAB_017F
+	DC.W	$792e
+LAB_017A:
+	DC.W	$0000
+LAB_017B:
+	BRA.S	LAB_017C
+	DC.W	$4f75
+	MOVEQ	#32,D2
+	DC.W	$6f66
+	MOVEA.L	(25965,A5),A0
+	DC.W	$6f72
+	DC.W	$7900
+LAB_017C:
+	JSR	(-516,A6)
+	ADDQ.L	#5,A4
+	ADDQ.L	#3,A2
+	JSR	(-246,A6)
+	MOVE.W	(14395,A5),(30091,A5)
+	RTS
+LAB_017D:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_017E:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_017F:
+	RTS
+	END
@@ -0,0 +1,1322 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+EXT_0000	EQU	$14A
+EXT_0001	EQU	$182
+EXT_0002	EQU	$218
+EXT_0003	EQU	$2AA
+EXT_0004	EQU	$30E
+EXT_0005	EQU	$4E4
+EXT_0006	EQU	$4F0
+EXT_0007	EQU	$55A
+EXT_0008	EQU	$618
+EXT_0009	EQU	$762
+EXT_000a	EQU	$860
+EXT_000b	EQU	$8BA
+EXT_000c	EQU	$92E
+EXT_000d	EQU	$934
+EXT_000e	EQU	$992
+EXT_000f	EQU	$9D2
+EXT_0010	EQU	$BCA
+EXT_0011	EQU	$BDE
+EXT_0012	EQU	$CA4
+EXT_0013	EQU	$E24
+EXT_0014	EQU	$F54
+
+
+
+
+	ORG	$10000
+
+SECSTRT_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0000:
+	BSR.W	LAB_0011
+	MOVE.L	D4,D0
+	BSR.W	LAB_0022
+LAB_0001:
+	BSR.W	LAB_0011
+	ADD.L	D2,D2
+	JSR	-30(A6)
+LAB_0002:
+	BSR.W	LAB_0011
+	BNE.S	LAB_0002
+LAB_0003:
+	MOVE.L	11602(A5),D3
+	DBF	D4,LAB_0003
+LAB_0004:
+	CMPI.L	#$000000b5,D1
+	DBF	D4,LAB_0004
+LAB_0005:
+	MOVE.W	12732(A5),17119(A5)
+LAB_0006:
+	CMP.L	#$00007e32,D6
+	JSR	-366(A6)
+	BNE.S	LAB_0006
+LAB_0007:
+	ADD.L	D7,D2
+	DBF	D2,LAB_0007
+	BSR.W	LAB_0022
+	MOVE.L	20022(A5),D5
+	JSR	-90(A6)
+	JSR	-768(A6)
+	JSR	-96(A6)
+	LEA	LAB_0000(PC),A4
+LAB_0008:
+	ADDQ.L	#7,A0
+	LEA	LAB_0005+2(PC),A6
+	BNE.S	LAB_0008
+LAB_0009:
+	BSR.W	LAB_002C
+	DBF	D0,LAB_0009
+LAB_000A:
+	BSR.W	LAB_0022
+LAB_000B:
+	MOVE.L	16094(A5),D7
+	BNE.S	LAB_000A
+	BNE.S	LAB_000B
+	BRA.S	LAB_000C
+	DC.B	"Workbench",0
+LAB_000C:
+	CMP.L	#$00006441,D1
+	BNE.S	LAB_000C
+	ADDQ.L	#4,A1
+	BSR.W	LAB_0011
+LAB_000D:
+	BSR.W	LAB_002C
+LAB_000E:
+	MOVE.L	1210(A5),D0
+	DBF	D1,LAB_000E
+	BNE.S	LAB_000D
+LAB_000F:
+	BNE.S	LAB_000E
+	DBF	D0,LAB_000F
+LAB_0010:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0011:
+	LINK.W	A5,#-176
+	BSR.W	LAB_0022
+LAB_0012:
+	LEA	LAB_0010+2(PC),A4
+	DBF	D0,LAB_0012
+LAB_0013:
+	MOVE.W	27121(A5),17250(A5)
+LAB_0014:
+	DBF	D4,LAB_0013
+	JSR	-534(A6)
+	LEA	LAB_0014(PC),A0
+	MOVE.L	D7,D7
+	MOVE.L	4036(A5),D6
+	BSR.W	LAB_002C
+	MOVE.L	6378(A5),D3
+	CMPI.L	#$00000014,D3
+	MOVE.L	D7,D5
+	ADDQ.L	#1,A7
+	MOVE.L	D0,D2
+LAB_0015:
+	CMP.L	#$0000175e,D1
+	DBF	D0,LAB_0015
+	BSR.W	LAB_0039
+	ADD.L	D1,D5
+	MOVE.L	D4,D3
+LAB_0016:
+	ADD.L	D0,D2
+	BNE.S	LAB_0016
+LAB_0017:
+	BRA.S	LAB_0018
+	DC.B	"dos.library",0
+LAB_0018:
+	BNE.S	LAB_0017
+	BSR.W	LAB_002C
+LAB_0019:
+	JSR	-192(A6)
+	BNE.S	LAB_0019
+LAB_001A:
+	LEA	EXT_0009,A4
+LAB_001B:
+	DBF	D7,LAB_001A
+LAB_001C:
+	DBF	D3,LAB_001B
+	CMPI.L	#$0000007b,D1
+	ADDQ.L	#2,A7
+LAB_001D:
+	BRA.S	LAB_001E
+	DC.B	"%s: %ld",10,0,0
+LAB_001E:
+	BNE.S	LAB_001D
+	BSR.W	LAB_0039
+	MOVE.W	26788(A5),12405(A5)
+LAB_001F:
+	CMPI.L	#$000000e9,D2
+LAB_0020:
+	DBF	D4,LAB_001F
+LAB_0021:
+	DBF	D0,LAB_0020
+	DBF	D0,LAB_0021
+	BSR.W	LAB_0039
+	MOVEQ	#-72,D5
+	ADDQ.L	#7,A5
+	UNLK	A5
+	RTS
+LAB_0022:
+	LINK.W	A5,#-116
+LAB_0023:
+	BSR.W	LAB_002C
+LAB_0024:
+	MOVE.W	12451(A5),21762(A5)
+LAB_0025:
+	CMP.L	#$0000445c,D7
+	CMP.L	#$0000af63,D5
+	BNE.S	LAB_0024
+	BRA.S	LAB_0026
+	DC.B	"graphics.library",0,0
+LAB_0026:
+	BRA.S	LAB_0027
+	DC.B	"intuition.library",0
+LAB_0027:
+	BSR.W	LAB_0046
+	DBF	D3,LAB_0027
+	MOVEQ	#92,D0
+	CMP.L	#$0000b361,D1
+	BRA.S	LAB_0029
+	DC.L	$25733a20
+LAB_0028:
+	DC.B	"%ld",10,0,0
+LAB_0029:
+	MOVE.W	21223(A5),11650(A5)
+	MOVE.L	D4,D6
+	MOVE.L	29222(A5),D2
+	CMPI.L	#$0000008f,D5
+	BSR.W	LAB_0046
+	BSR.W	LAB_0039
+LAB_002A:
+	MOVE.W	16134(A5),22264(A5)
+	DBF	D5,LAB_002A
+	MOVE.W	25234(A5),2263(A5)
+	MOVE.L	30112(A5),D5
+	MOVE.L	D5,D2
+	MOVE.L	24182(A5),D5
+	MOVE.L	13840(A5),D0
+LAB_002B:
+	ADD.L	D0,D7
+	BNE.S	LAB_002B
+	ADDQ.L	#5,A0
+	BSR.W	LAB_002C
+	LEA	LAB_0023+2(PC),A2
+	CMP.L	#$0000b3d4,D4
+	UNLK	A5
+	RTS
+LAB_002C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0039
+	BSR.W	LAB_0046
+	MOVE.W	13771(A5),28768(A5)
+LAB_002E:
+	ADDQ.L	#6,A5
+LAB_002F:
+	DBF	D5,LAB_002E
+LAB_0030:
+	BRA.S	LAB_0031
+	DC.B	"Workbench",0
+LAB_0031:
+	BRA.S	LAB_0033
+	DC.B	"Out of memor"
+LAB_0032:
+	DC.W	$7900
+LAB_0033:
+	BSR.W	LAB_0046
+	BNE.S	LAB_0030
+	JSR	-636(A6)
+	LEA	LAB_0011(PC),A4
+	LEA	LAB_001C+2(PC),A0
+	CMP.L	#$0000e59b,D6
+LAB_0034:
+	ADDQ.L	#1,A3
+	DBF	D6,LAB_0034
+	ADDQ.L	#7,A5
+LAB_0035:
+	BRA.S	LAB_0036
+	DC.B	"Error: ",0
+LAB_0036:
+	ADDQ.L	#3,A4
+	BNE.S	LAB_0035
+	MOVE.W	26473(A5),11495(A5)
+LAB_0037:
+	CMPI.L	#$00000022,D5
+LAB_0038:
+	DBF	D0,LAB_0037
+	DBF	D1,LAB_0038
+	JSR	-558(A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0039:
+	BSR.W	LAB_0046
+	MOVEQ	#13,D5
+	JSR	-66(A6)
+	LEA	LAB_002C+2(PC),A0
+LAB_003A:
+	MOVE.L	8160(A5),D5
+	ADD.L	D5,D7
+	ADD.L	D2,D7
+	MOVE.L	14834(A5),D6
+LAB_003B:
+	ADDQ.L	#5,A0
+	ADD.L	D7,D7
+	MOVE.L	22692(A5),D5
+	BNE.S	LAB_003B
+	MOVE.W	31558(A5),31024(A5)
+	ADDQ.L	#4,A5
+LAB_003C:
+	BSR.W	LAB_004D
+	LEA	LAB_0003(PC),A2
+	BSR.W	LAB_0046
+	MOVE.L	D0,D7
+LAB_003D:
+	BRA.S	LAB_003E
+	DC.B	"intuition.library",0
+LAB_003E:
+	BNE.S	LAB_003D
+LAB_003F:
+	LEA	EXT_0011,A4
+LAB_0040:
+	ADD.L	D1,D1
+	DBF	D0,LAB_0040
+LAB_0041:
+	MOVE.L	D3,D7
+	DBF	D1,LAB_0041
+	BRA.S	LAB_0042
+	DC.B	"graphics.library",0,0
+LAB_0042:
+	BSR.W	LAB_0046
+LAB_0043:
+	LEA	LAB_002F+2(PC),A4
+	DBF	D6,LAB_0043
+	MOVE.L	18198(A5),D3
+	BRA.S	LAB_0044
+	DC.B	"Ready.",0,0
+LAB_0044:
+	MOVEQ	#-7,D2
+	ADDQ.L	#6,A0
+LAB_0045:
+	ADDQ.L	#4,A3
+	DBF	D3,LAB_0045
+	MOVE.L	11866(A5),D1
+	RTS
+LAB_0046:
+	LINK.W	A5,#-92
+	BSR.W	LAB_004D
+LAB_0047:
+	MOVE.W	7034(A5),17100(A5)
+	MOVE.W	7346(A5),21259(A5)
+	BNE.S	LAB_0047
+	BSR.W	LAB_0066
+	BSR.W	LAB_005A
+	CMPI.L	#$0000009a,D7
+	BRA.S	LAB_0048
+	DC.B	"topaz.font",0,0
+LAB_0048:
+	LEA	LAB_0001+2(PC),A0
+	BRA.S	LAB_0049
+	DC.B	"graphics.library",0,0
+LAB_0049:
+	BSR.W	LAB_004D
+	BRA.S	LAB_004A
+	DC.B	"intuition.library",0
+LAB_004A:
+	BRA.S	LAB_004B
+	DC.B	"%s: %ld",10,0,0
+LAB_004B:
+	BRA.S	LAB_004C
+	DC.B	"graphics.library",0,0
+LAB_004C:
+	LEA	EXT_0002,A6
+	BSR.W	LAB_004D
+	UNLK	A5
+	RTS
+LAB_004D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_005A
+	TST.L	D5
+	BRA.S	LAB_004E
+	DC.B	"Ready.",0,0
+LAB_004E:
+	ADDQ.L	#3,A2
+LAB_004F:
+	BNE.S	LAB_004E
+LAB_0050:
+	BNE.S	LAB_004E
+	DBF	D7,LAB_0050
+	BNE.S	LAB_004F
+LAB_0051:
+	BRA.S	LAB_0052
+	DC.B	"Workbench",0
+LAB_0052:
+	DBF	D3,LAB_0051
+LAB_0053:
+	MOVE.L	3300(A5),D2
+	DBF	D6,LAB_0053
+	BSR.W	LAB_0076
+	CMP.L	#$00005996,D1
+LAB_0054:
+	MOVE.L	10580(A5),D5
+	BNE.S	LAB_0054
+LAB_0055:
+	BRA.S	LAB_0056
+	DC.B	"dos.library",0
+LAB_0056:
+	BNE.S	LAB_0055
+	ADDQ.L	#2,A2
+	BSR.W	LAB_0066
+	BRA.S	LAB_0058
+	DC.B	"CON:0/0/640/"
+LAB_0057:
+	DC.B	"200/Output",0,0
+LAB_0058:
+	MOVE.L	D0,D3
+	JSR	-774(A6)
+	ADD.W	D0,D0
+	MOVE.W	LAB_0059(PC,D0.W),D0
+	JMP	LAB_0059(PC,D0.W)
+LAB_0059:
+	DC.L	$000c0010,$00140018,$001c0020,$70004e75
+	DC.L	$70014e75,$70024e75,$70034e75,$70044e75
+	DC.L	$70054e75
+LAB_005A:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0066
+LAB_005B:
+	CMPI.L	#$00000065,D3
+LAB_005C:
+	MOVEQ	#-38,D7
+	DBF	D5,LAB_005C
+	BNE.S	LAB_005B
+LAB_005D:
+	CMP.L	#$0000aeb9,D3
+LAB_005E:
+	BSR.W	LAB_0076
+	BSR.W	LAB_007C
+LAB_005F:
+	BSR.W	LAB_0066
+LAB_0060:
+	BNE.S	LAB_005E
+	DBF	D7,LAB_0060
+LAB_0061:
+	BNE.S	LAB_005F
+	DBF	D6,LAB_0061
+LAB_0062:
+	MOVE.L	D4,D7
+	MOVE.L	D2,D4
+LAB_0063:
+	BNE.S	LAB_0062
+	DBF	D3,LAB_0063
+LAB_0064:
+	BSR.W	LAB_0066
+	JSR	-72(A6)
+	MOVE.L	D1,D0
+LAB_0065:
+	BNE.S	LAB_0064
+	MOVE.L	D5,D0
+	BNE.S	LAB_0065
+	CMP.L	#$0000340d,D2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0066:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0067:
+	BSR.W	LAB_0076
+	TST.L	D5
+	BSR.W	LAB_0076
+	BNE.S	LAB_0067
+LAB_0068:
+	BRA.S	LAB_0069
+	DC.B	"Out of memory",0
+LAB_0069:
+	DBF	D1,LAB_0068
+LAB_006A:
+	DBF	D0,LAB_0069
+LAB_006B:
+	LEA	EXT_0003,A2
+	DBF	D0,LAB_006B
+LAB_006C:
+	LEA	EXT_000c,A0
+	MOVE.W	3714(A5),28703(A5)
+LAB_006D:
+	ADDQ.L	#4,A1
+LAB_006E:
+	DBF	D5,LAB_006D
+	DBF	D4,LAB_006E
+	LEA	EXT_0006,A2
+	BRA.S	LAB_006F
+	DC.B	"Error: ",0
+LAB_006F:
+	LEA	EXT_0005,A4
+LAB_0070:
+	LEA	LAB_006C+4(PC),A6
+	DBF	D6,LAB_0070
+	CMPI.L	#$00000074,D7
+	BRA.S	LAB_0071
+	DC.B	"dos.library",0
+LAB_0071:
+	MOVEQ	#-123,D0
+	MOVE.L	D1,D2
+	BNE.S	LAB_0071
+	BRA.S	LAB_0072
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_0072:
+	JSR	EXT_0008
+	DBF	D5,LAB_0072
+LAB_0073:
+	CMP.L	#$0000e1d7,D0
+	MOVEQ	#124,D2
+	BNE.S	LAB_0073
+	MOVE.L	D6,D0
+LAB_0074:
+	MOVE.W	17061(A5),12384(A5)
+LAB_0075:
+	DBF	D0,LAB_0074
+	DBF	D5,LAB_0075
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0076:
+	LINK.W	A5,#-44
+	BSR.W	LAB_007C
+	MOVE.W	25563(A5),19676(A5)
+	ADDQ.L	#2,A1
+LAB_0077:
+	BSR.W	LAB_007C
+	LEA	EXT_0004,A6
+	MOVEQ	#-57,D0
+LAB_0078:
+	BNE.S	LAB_0077
+	BNE.S	LAB_0078
+	MOVE.L	#$000006a8,-(A7)
+	BRA.S	LAB_0079
+	DC.B	"Out of memory",0
+LAB_0079:
+	JSR	-822(A6)
+	MOVE.W	17297(A5),2646(A5)
+	MOVEQ	#47,D5
+	BNE.S	LAB_0079
+	BRA.S	LAB_007A
+	DC.B	"topaz.font",0,0
+LAB_007A:
+	ADD.L	D6,D7
+	UNLK	A5
+LAB_007B:
+	RTS
+LAB_007C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_007E
+	BSR.W	LAB_0086
+	ADD.W	D0,D0
+	MOVE.W	LAB_007D(PC,D0.W),D0
+	JMP	LAB_007D(PC,D0.W)
+LAB_007D:
+	DC.L	$0008000c,$00100014,$70004e75,$70014e75
+	DC.L	$70024e75,$70034e75
+LAB_007E:
+	BSR.W	LAB_0086
+	BSR.W	LAB_0086
+	MOVEQ	#6,D7
+	BSR.W	LAB_008F
+LAB_007F:
+	MOVE.W	15062(A5),32547(A5)
+	MOVE.L	7558(A5),D0
+	MOVEQ	#71,D7
+LAB_0080:
+	BNE.S	LAB_007F
+	DBF	D7,LAB_0080
+	ADDQ.L	#6,A2
+	BRA.S	LAB_0081
+	DC.B	"dos.library",0
+LAB_0081:
+	ADD.L	D3,D1
+LAB_0082:
+	MOVE.L	D6,D5
+	DBF	D7,LAB_0082
+LAB_0083:
+	MOVE.L	D0,D5
+	DBF	D0,LAB_0083
+LAB_0084:
+	BNE.S	LAB_0083
+	DBF	D0,LAB_0084
+LAB_0085:
+	MOVEQ	#-63,D5
+	BNE.S	LAB_0085
+	LEA	LAB_005D(PC),A4
+	ADDQ.L	#7,A5
+	BSR.W	LAB_008F
+	RTS
+LAB_0086:
+	BSR.W	LAB_008F
+	CMPI.L	#$00000046,D4
+	MOVEQ	#64,D4
+LAB_0087:
+	CMP.L	#$0000384f,D3
+	DBF	D7,LAB_0087
+	BSR.W	LAB_00A5
+	BNE.S	LAB_0087
+LAB_0088:
+	MOVEQ	#-90,D4
+	MOVE.L	8534(A5),D1
+	CMPI.L	#$00000074,D3
+LAB_0089:
+	BNE.S	LAB_0088
+	DBF	D7,LAB_0089
+	MOVEQ	#-111,D6
+	CMP.L	#$0000801e,D5
+	BSR.W	LAB_008F
+	MOVE.L	D3,D6
+	BSR.W	LAB_0092
+	CMPI.L	#$000000a5,D4
+	CMP.L	#$00005790,D5
+	CMPI.L	#$000000c5,D3
+	ADDQ.L	#2,A7
+	MOVEQ	#-118,D0
+	JSR	-588(A6)
+	MOVE.W	23789(A5),23828(A5)
+LAB_008A:
+	BSR.W	LAB_0092
+LAB_008B:
+	BNE.S	LAB_008A
+	DBF	D2,LAB_008B
+LAB_008C:
+	BRA.S	LAB_008D
+	DC.B	"%s: %ld",10,0,0
+LAB_008D:
+	BNE.S	LAB_008C
+	BSR.W	LAB_0092
+	BNE.S	LAB_008D
+	LEA	LAB_003F+2(PC),A0
+	BRA.S	LAB_008E
+	DC.B	"intuition.library",0
+LAB_008E:
+	MOVE.L	17736(A5),D0
+	BSR.W	LAB_0092
+	LEA	EXT_0013,A2
+	RTS
+LAB_008F:
+	LINK.W	A5,#-60
+	BSR.W	LAB_0092
+	MOVEQ	#60,D2
+	BRA.S	LAB_0090
+	DC.B	"Out of memory",0
+LAB_0090:
+	MOVE.W	22068(A5),22168(A5)
+	MOVE.L	D4,D5
+	ADD.L	D6,D2
+	JSR	-384(A6)
+	MOVE.L	9734(A5),D7
+	ADD.L	D7,D1
+	CMP.L	#$000015ed,D1
+	CMPI.L	#$000000d4,D4
+	BSR.W	LAB_00A9
+	CMPI.L	#$000000fc,D2
+	MOVE.L	8004(A5),D7
+	BRA.S	LAB_0091
+	DC.B	"Workbench",0
+LAB_0091:
+	JSR	-852(A6)
+	ADD.L	D7,D0
+	LEA	LAB_0009(PC),A6
+	MOVE.L	D2,D2
+	CMP.L	#$00009381,D4
+	CMP.L	#$000074eb,D3
+	ADDQ.L	#4,A2
+	JSR	-174(A6)
+	ADDQ.L	#5,A2
+	MOVE.L	#$000000bc,-(A7)
+	MOVE.L	D3,D6
+	MOVE.L	#$0000007c,-(A7)
+	UNLK	A5
+	RTS
+LAB_0092:
+	LINK.W	A5,#-80
+LAB_0093:
+	BSR.W	LAB_00A5
+LAB_0094:
+	DBF	D5,LAB_0093
+	MOVEQ	#-19,D7
+LAB_0095:
+	JSR	-624(A6)
+	DBF	D0,LAB_0095
+LAB_0096:
+	BSR.W	LAB_00B1
+LAB_0097:
+	BNE.S	LAB_0095
+LAB_0098:
+	BNE.S	LAB_0096
+LAB_0099:
+	BNE.S	LAB_0097
+LAB_009A:
+	BNE.S	LAB_0098
+	DBF	D1,LAB_009A
+	BNE.S	LAB_0099
+	LEA	LAB_007B(PC),A4
+	BSR.W	LAB_00A5
+	LEA	EXT_0007,A0
+	BRA.S	LAB_009B
+	DC.B	"%s: %ld",10,0,0
+LAB_009B:
+	JSR	-618(A6)
+	ADDQ.L	#7,A1
+	ADDQ.L	#1,A0
+LAB_009C:
+	LEA	LAB_0028(PC),A0
+	DBF	D2,LAB_009C
+	BRA.S	LAB_009D
+	DC.B	"intuition.library",0
+LAB_009D:
+	BSR.W	LAB_00A5
+	CMPI.L	#$0000000f,D1
+	JSR	EXT_000a
+LAB_009E:
+	MOVE.W	9075(A5),3061(A5)
+	DBF	D2,LAB_009E
+LAB_009F:
+	MOVE.L	D7,D2
+	DBF	D7,LAB_009F
+	BSR.W	LAB_00A9
+LAB_00A0:
+	BRA.S	LAB_00A1
+	DC.B	"topaz.font",0,0
+LAB_00A1:
+	DBF	D7,LAB_00A0
+	MOVEQ	#-48,D2
+	ADD.L	D4,D6
+	BNE.S	LAB_00A1
+	BRA.S	LAB_00A2
+	DC.B	"Error: ",0
+LAB_00A2:
+	CMP.L	#$0000e52b,D3
+	DBF	D1,LAB_00A2
+	BRA.S	LAB_00A4
+	DC.B	"topaz.font",0,0
+LAB_00A4:
+	UNLK	A5
+	RTS
+LAB_00A5:
+	BSR.W	LAB_00A9
+	BSR.W	LAB_00BE
+	ADD.L	D0,D5
+	MOVE.W	17271(A5),9777(A5)
+	JSR	-294(A6)
+	BSR.W	LAB_00A9
+	BSR.W	LAB_00B1
+	MOVE.W	13720(A5),12787(A5)
+LAB_00A6:
+	ADD.L	D5,D0
+	DBF	D0,LAB_00A6
+	ADDQ.L	#5,A3
+	JSR	EXT_000b
+	BSR.W	LAB_00BE
+	CMPI.L	#$00000072,D6
+	JSR	-774(A6)
+	BSR.W	LAB_00B1
+	MOVEQ	#62,D0
+LAB_00A7:
+	MOVE.L	D5,D6
+	DBF	D6,LAB_00A7
+LAB_00A8:
+	MOVE.W	13955(A5),15150(A5)
+	BNE.S	LAB_00A7
+	ADD.L	D1,D5
+	BNE.S	LAB_00A8
+	ADDQ.L	#7,A1
+	RTS
+LAB_00A9:
+	BSR.W	LAB_00B1
+	BSR.W	LAB_00B1
+	BRA.S	LAB_00AA
+	DC.B	"graphics.library",0,0
+LAB_00AA:
+	ADD.L	D2,D2
+	BSR.W	LAB_00B1
+	ADD.L	D5,D6
+	MOVE.L	D5,D1
+	BSR.W	LAB_00B1
+LAB_00AB:
+	BSR.W	LAB_00C5
+	DBF	D0,LAB_00AB
+LAB_00AC:
+	MOVEQ	#77,D3
+	CMPI.L	#$00000017,D6
+	BSR.W	LAB_00BE
+	BNE.S	LAB_00AC
+	LEA	LAB_006A(PC),A6
+LAB_00AD:
+	BSR.W	LAB_00C5
+LAB_00AE:
+	DBF	D1,LAB_00AD
+LAB_00AF:
+	CMPI.L	#$00000034,D7
+	DBF	D4,LAB_00AF
+LAB_00B0:
+	BNE.S	LAB_00AE
+	DBF	D7,LAB_00B0
+	MOVEQ	#-110,D6
+	BSR.W	LAB_00BE
+	JSR	EXT_000f
+	RTS
+LAB_00B1:
+	LINK.W	A5,#-176
+	BSR.W	LAB_00BE
+	MOVE.L	18308(A5),D3
+	LEA	LAB_003C+2(PC),A0
+	LEA	EXT_000e,A0
+	BSR.W	LAB_00C5
+	BSR.W	LAB_00BE
+	MOVE.W	2802(A5),4199(A5)
+	BSR.W	LAB_00C5
+	ADD.L	D4,D2
+	BSR.W	LAB_00BE
+	BRA.S	LAB_00B2
+	DC.B	"dos.library",0
+LAB_00B2:
+	ADDQ.L	#6,A1
+	JSR	-624(A6)
+LAB_00B3:
+	MOVE.W	8817(A5),18293(A5)
+	BSR.W	LAB_00BE
+LAB_00B4:
+	BNE.S	LAB_00B3
+	DBF	D2,LAB_00B4
+LAB_00B5:
+	CMPI.L	#$00000067,D5
+	BNE.S	LAB_00B5
+LAB_00B6:
+	ADD.L	D3,D3
+	DBF	D7,LAB_00B6
+	JSR	-102(A6)
+	BSR.W	LAB_00C5
+	BRA.S	LAB_00B7
+	DC.B	"%s: %ld",10,0,0
+LAB_00B7:
+	MOVEQ	#-85,D5
+LAB_00B8:
+	MOVE.L	D7,D4
+	DBF	D6,LAB_00B8
+LAB_00B9:
+	BSR.W	LAB_00CE
+	DBF	D3,LAB_00B9
+	BRA.S	LAB_00BA
+	DC.B	"Error: ",0
+LAB_00BA:
+	CMP.L	#$00005c72,D4
+LAB_00BB:
+	MOVE.L	13612(A5),D4
+	DBF	D3,LAB_00BB
+	MOVE.L	D0,D0
+	MOVEQ	#-38,D4
+LAB_00BC:
+	ADD.L	D4,D3
+LAB_00BD:
+	ADDQ.L	#1,A6
+	DBF	D7,LAB_00BD
+	BNE.S	LAB_00BC
+	UNLK	A5
+	RTS
+LAB_00BE:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00C5
+	MOVEQ	#-80,D6
+	TST.L	D1
+	MOVE.L	#$00000608,-(A7)
+LAB_00BF:
+	BSR.W	LAB_00D9
+LAB_00C0:
+	DBF	D1,LAB_00BF
+	DBF	D4,LAB_00C0
+	BSR.W	LAB_00D9
+	BSR.W	LAB_00C5
+LAB_00C1:
+	BRA.S	LAB_00C2
+	DC.B	"Ready.",0,0
+LAB_00C2:
+	BRA.S	LAB_00C3
+	DC.B	"%s: %ld",10,0,0
+LAB_00C3:
+	BSR.W	LAB_00CE
+	BNE.S	LAB_00C1
+	CMP.L	#$000070b5,D3
+LAB_00C4:
+	BSR.W	LAB_00D9
+	BNE.S	LAB_00C4
+	BSR.W	LAB_00D9
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00C5:
+	LINK.W	A5,#-112
+	BSR.W	LAB_00CE
+LAB_00C6:
+	BSR.W	LAB_00D9
+	LEA	LAB_00BD(PC),A6
+	BRA.S	LAB_00C7
+	DC.B	"topaz.font",0,0
+LAB_00C7:
+	ADDQ.L	#4,A0
+LAB_00C8:
+	ADD.L	D7,D6
+	DBF	D6,LAB_00C8
+	BSR.W	LAB_00CE
+	JSR	-732(A6)
+	MOVE.L	6040(A5),D5
+	LEA	LAB_00A2+2(PC),A2
+	CMPI.L	#$000000a7,D6
+	BSR.W	LAB_00CE
+LAB_00C9:
+	MOVEQ	#-105,D4
+	DBF	D0,LAB_00C9
+	MOVE.L	294(A5),D3
+	ADD.L	D6,D0
+LAB_00CA:
+	JSR	EXT_0010
+	MOVE.L	D2,D3
+	ADD.L	D1,D5
+	BNE.S	LAB_00CA
+	BRA.S	LAB_00CB
+	DC.B	"topaz.font",0,0
+LAB_00CB:
+	JSR	EXT_0010
+	MOVEQ	#112,D4
+	MOVE.L	#$000002b8,-(A7)
+	BSR.W	LAB_00CE
+	MOVE.L	1384(A5),D6
+	ADDQ.L	#1,A1
+	BSR.W	LAB_00E3
+	BSR.W	LAB_00D9
+	MOVE.L	7584(A5),D7
+	BRA.S	LAB_00CC
+	DC.B	"Workbench",0
+LAB_00CC:
+	CMPI.L	#$00000044,D2
+LAB_00CD:
+	CMPI.L	#$00000062,D0
+	BSR.W	LAB_00D9
+	BNE.S	LAB_00CD
+	MOVE.L	26582(A5),D4
+	UNLK	A5
+	RTS
+LAB_00CE:
+	BSR.W	LAB_00D9
+LAB_00CF:
+	TST.L	D0
+	BSR.W	LAB_00D9
+LAB_00D0:
+	BNE.S	LAB_00CF
+	DBF	D7,LAB_00D0
+LAB_00D1:
+	BRA.S	LAB_00D2
+	DC.B	"graphics.library",0,0
+LAB_00D2:
+	DBF	D2,LAB_00D1
+LAB_00D3:
+	CMPI.L	#$000000b2,D0
+	JSR	-786(A6)
+LAB_00D4:
+	BNE.S	LAB_00D3
+	CMP.L	#$000018e5,D5
+LAB_00D5:
+	MOVE.W	29060(A5),1895(A5)
+	BNE.S	LAB_00D4
+LAB_00D6:
+	ADDQ.L	#4,A1
+	BNE.S	LAB_00D5
+	CMP.L	#$0000b521,D4
+	BNE.S	LAB_00D6
+	CMPI.L	#$000000f3,D7
+LAB_00D7:
+	BSR.W	LAB_00ED
+LAB_00D8:
+	DBF	D0,LAB_00D7
+	BSR.W	LAB_00ED
+	ADDQ.L	#6,A7
+	BNE.S	LAB_00D8
+	BSR.W	LAB_00ED
+	BSR.W	LAB_00D9
+	RTS
+LAB_00D9:
+	BSR.W	LAB_00E3
+LAB_00DA:
+	ADDQ.L	#5,A2
+	TST.L	D7
+LAB_00DB:
+	BNE.S	LAB_00DA
+	DBF	D7,LAB_00DB
+	MOVE.W	115(A5),27059(A5)
+LAB_00DC:
+	MOVEQ	#33,D4
+	ADD.L	D2,D7
+	BNE.S	LAB_00DC
+	MOVE.L	21004(A5),D6
+	BSR.W	LAB_00ED
+	BSR.W	LAB_00FA
+	MOVE.L	D2,D5
+	CMP.L	#$000062e6,D0
+	ADDQ.L	#7,A5
+LAB_00DD:
+	LEA	LAB_003A+2(PC),A0
+	MOVE.L	#$00000972,-(A7)
+	LEA	LAB_00C6+2(PC),A2
+LAB_00DE:
+	BNE.S	LAB_00DD
+	BRA.S	LAB_00DF
+	DC.B	"Error: ",0
+LAB_00DF:
+	ADDQ.L	#5,A2
+	BNE.S	LAB_00DE
+	MOVE.L	20568(A5),D3
+LAB_00E0:
+	MOVE.L	13700(A5),D7
+	BSR.W	LAB_00FA
+LAB_00E1:
+	ADD.L	D5,D7
+	BNE.S	LAB_00E0
+	BNE.S	LAB_00E1
+	BNE.S	LAB_00E1
+	MOVE.L	3608(A5),D1
+	ADDQ.L	#1,A2
+	MOVEQ	#-24,D5
+	CMPI.L	#$00000033,D2
+LAB_00E2:
+	MOVE.W	9689(A5),1490(A5)
+	JSR	-684(A6)
+	BSR.W	LAB_00ED
+	BNE.S	LAB_00E2
+	RTS
+LAB_00E3:
+	LINK.W	A5,#-136
+	BSR.W	LAB_00ED
+	MOVE.L	#$00000460,-(A7)
+	MOVE.L	28820(A5),D0
+	JSR	-72(A6)
+	MOVE.L	16988(A5),D3
+LAB_00E4:
+	BSR.W	LAB_010F
+LAB_00E5:
+	BNE.S	LAB_00E4
+	BNE.S	LAB_00E5
+	JSR	-672(A6)
+LAB_00E6:
+	CMP.L	#$0000e893,D4
+	DBF	D2,LAB_00E6
+	BSR.W	LAB_00ED
+	CMP.L	#$0000d791,D0
+	ADDQ.L	#2,A3
+	CMP.L	#$0000b6ce,D2
+	ADD.L	D0,D5
+LAB_00E7:
+	BRA.S	LAB_00E8
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_00E8:
+	BNE.S	LAB_00E7
+LAB_00E9:
+	BRA.S	LAB_00EA
+	DC.B	"graphics.library",0,0
+LAB_00EA:
+	DBF	D4,LAB_00E9
+	CMP.L	#$0000b200,D5
+	BSR.W	LAB_010F
+	JSR	EXT_0012
+	ADD.L	D3,D4
+	ADDQ.L	#4,A7
+	JSR	-822(A6)
+	ADD.L	D5,D6
+	MOVE.L	D2,D4
+	CMPI.L	#$0000007b,D0
+	MOVE.W	25323(A5),8686(A5)
+	CMPI.L	#$00000044,D6
+	BSR.W	LAB_010F
+	BRA.S	LAB_00EB
+	DC.B	"dos.library",0
+LAB_00EB:
+	BSR.W	LAB_010F
+	JSR	-186(A6)
+	ADD.L	D2,D5
+	MOVE.W	18413(A5),25378(A5)
+	BSR.W	LAB_00ED
+	BRA.S	LAB_00EC
+	DC.B	"Ready.",0,0
+LAB_00EC:
+	UNLK	A5
+	RTS
+LAB_00ED:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_00EE:
+	BSR.W	LAB_00FA
+	DBF	D5,LAB_00EE
+	BSR.W	LAB_00FA
+	MOVE.W	12796(A5),10655(A5)
+	BRA.S	LAB_00EF
+	DC.B	"dos.library",0
+LAB_00EF:
+	BSR.W	LAB_00FA
+	BSR.W	LAB_0116
+	ADD.L	D4,D6
+LAB_00F0:
+	CMPI.L	#$0000000a,D2
+LAB_00F1:
+	DBF	D2,LAB_00F0
+LAB_00F2:
+	DBF	D4,LAB_00F1
+	JSR	-468(A6)
+	BSR.W	LAB_00FA
+LAB_00F3:
+	BNE.S	LAB_00F2
+	BNE.S	LAB_00F3
+	LEA	LAB_0025+2(PC),A0
+	ADDQ.L	#5,A6
+	BRA.S	LAB_00F4
+	DC.B	"Out of memory",0
+LAB_00F4:
+	MOVE.L	D6,D4
+	BSR.W	LAB_0116
+	BRA.S	LAB_00F5
+	DC.B	"Out of memory",0
+LAB_00F5:
+	MOVEQ	#-123,D5
+LAB_00F6:
+	MOVEQ	#81,D6
+	DBF	D7,LAB_00F6
+	LEA	EXT_000d,A2
+	BRA.S	LAB_00F7
+	DC.B	"Error: ",0
+LAB_00F7:
+	CMP.L	#$000055ec,D5
+LAB_00F8:
+	BRA.S	LAB_00F9
+	DC.B	"Error: ",0
+LAB_00F9:
+	DBF	D3,LAB_00F8
+	DBF	D2,LAB_00F9
+	BSR.W	LAB_00FA
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00FA:
+	BSR.W	LAB_010F
+LAB_00FB:
+	BRA.S	LAB_00FC
+	DC.B	"Error: ",0
+LAB_00FC:
+	DBF	D2,LAB_00FB
+	BNE.S	LAB_00FB
+	MOVEQ	#31,D7
+LAB_00FD:
+	BRA.S	LAB_00FF
+	DC.L	$696e7475
+LAB_00FE:
+	DC.B	"ition.library",0
+LAB_00FF:
+	DBF	D7,LAB_00FD
+	ADDQ.L	#1,A5
+	CMP.L	#$0000a3ce,D6
+	CMP.L	#$000006a1,D4
+LAB_0100:
+	BRA.S	LAB_0101
+	DC.B	"%s: %ld",10,0,0
+LAB_0101:
+	DBF	D6,LAB_0100
+	CMP.L	#$00001ffb,D7
+	BNE.S	LAB_0100
+	LEA	EXT_0001,A4
+	ADDQ.L	#6,A6
+	CMP.L	#$00001395,D4
+	MOVE.L	D0,D2
+	ADD.L	D1,D2
+	BSR.W	LAB_0116
+LAB_0102:
+	MOVE.W	15022(A5),19803(A5)
+LAB_0103:
+	DBF	D1,LAB_0102
+	DBF	D1,LAB_0103
+LAB_0104:
+	CMP.L	#$0000036e,D4
+LAB_0105:
+	DBF	D0,LAB_0104
+LAB_0106:
+	BNE.S	LAB_0105
+LAB_0107:
+	DBF	D7,LAB_0106
+	DBF	D1,LAB_0107
+	BRA.S	LAB_0108
+	DC.B	"%s: %ld",10,0,0
+LAB_0108:
+	BSR.W	LAB_0116
+	BSR.W	LAB_0124
+LAB_0109:
+	BRA.S	LAB_010A
+	DC.B	"Ready.",0,0
+LAB_010A:
+	MOVEQ	#-119,D3
+LAB_010B:
+	BNE.S	LAB_0109
+	BSR.W	LAB_0124
+	BNE.S	LAB_010B
+	MOVE.W	698(A5),21055(A5)
+LAB_010C:
+	MOVE.W	10660(A5),30711(A5)
+	DBF	D0,LAB_010C
+LAB_010D:
+	CMP.L	#$00007c21,D1
+LAB_010E:
+	DBF	D1,LAB_010D
+	DBF	D3,LAB_010E
+	MOVE.L	18338(A5),D2
+	RTS
+LAB_010F:
+	BSR.W	LAB_0116
+	CMPI.L	#$0000005b,D5
+	CMPI.L	#$00000092,D6
+	MOVE.W	19449(A5),6702(A5)
+LAB_0110:
+	MOVE.L	D7,D6
+	ADDQ.L	#6,A3
+	BNE.S	LAB_0110
+	JSR	-696(A6)
+	CMPI.L	#$000000df,D4
+	ADDQ.L	#3,A5
+	ADD.L	D4,D0
+LAB_0111:
+	CMP.L	#$0000b136,D2
+	BNE.S	LAB_0111
+LAB_0112:
+	BNE.S	LAB_0111
+LAB_0113:
+	DBF	D6,LAB_0112
+LAB_0114:
+	DBF	D7,LAB_0113
+LAB_0115:
+	DBF	D6,LAB_0114
+	DBF	D5,LAB_0115
+	LEA	LAB_0032(PC),A4
+	RTS
+LAB_0116:
+	LINK.W	A5,#-16
+	BSR.W	LAB_0124
+	LEA	LAB_0057(PC),A2
+	BRA.S	LAB_0117
+	DC.B	"dos.library",0
+LAB_0117:
+	BSR.W	LAB_012A
+	MOVE.L	D2,D0
+	BRA.S	LAB_0118
+	DC.B	"Error: ",0
+LAB_0118:
+	BNE.S	LAB_0117
+	BNE.S	LAB_0118
+	BSR.W	LAB_012A
+	JSR	-198(A6)
+LAB_0119:
+	MOVE.L	#$00000110,-(A7)
+	BRA.S	LAB_011A
+	DC.B	"Error: ",0
+LAB_011A:
+	ADD.L	D4,D2
+	BNE.S	LAB_0119
+	MOVE.W	25507(A5),13732(A5)
+	BNE.S	LAB_011A
+	LEA	LAB_0094(PC),A4
+	MOVEQ	#122,D3
+	BRA.S	LAB_011B
+	DC.B	"Error: ",0
+LAB_011B:
+	JSR	-498(A6)
+	BSR.W	LAB_012A
+	BRA.S	LAB_011C
+	DC.B	"topaz.font",0,0
+LAB_011C:
+	BSR.W	LAB_012A
+	BRA.S	LAB_011D
+	DC.B	"intuition.library",0
+LAB_011D:
+	BNE.S	LAB_011C
+	MOVE.L	26518(A5),D2
+	BSR.W	LAB_012A
+	BSR.W	LAB_0124
+	LEA	EXT_0000,A6
+LAB_011E:
+	LEA	LAB_00FE(PC),A2
+	BRA.S	LAB_011F
+	DC.B	"topaz.font",0,0
+LAB_011F:
+	BNE.S	LAB_011E
+	DBF	D4,LAB_011F
+LAB_0120:
+	JSR	EXT_0014
+	DBF	D7,LAB_0120
+LAB_0121:
+	BSR.W	LAB_0124
+	DBF	D2,LAB_0121
+LAB_0122:
+	BSR.W	LAB_012A
+LAB_0123:
+	DBF	D7,LAB_0122
+	DBF	D6,LAB_0123
+	MOVEQ	#-69,D5
+	UNLK	A5
+	RTS
+LAB_0124:
+	BSR.W	LAB_012A
+	DBF	D7,LAB_0124
+	MOVE.L	#$0000072c,-(A7)
+	MOVE.L	25398(A5),D4
+	MOVE.L	#$000009c6,-(A7)
+	MOVE.L	D3,D6
+	MOVE.L	D6,D5
+LAB_0125:
+	BSR.W	LAB_012A
+	MOVEQ	#-108,D1
+	MOVE.W	29421(A5),8264(A5)
+	BNE.S	LAB_0125
+	LEA	LAB_011B(PC),A0
+LAB_0126:
+	BRA.S	LAB_0127
+	DC.B	"Ready.",0,0
+LAB_0127:
+	DBF	D3,LAB_0126
+	BSR.W	LAB_012A
+	BRA.S	LAB_0128
+	DC.B	"Ready.",0,0
+LAB_0128:
+	BRA.S	LAB_0129
+	DC.B	"Out of memory",0
+LAB_0129:
+	JSR	-516(A6)
+	ADDQ.L	#5,A4
+	ADDQ.L	#3,A2
+	JSR	-246(A6)
+	MOVE.W	14395(A5),30091(A5)
+	RTS
+LAB_012A:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+	END
@@ -0,0 +1,1833 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+
+
+	SECTION S_0,CODE
+
+sym_0_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0000: 48e73f3e
+	BSR.W	LAB_0005		;0004: 61000054
+	LEA	sym_0_0(PC),A0		;0008: 41fafff6
+	TST.L	D5			;000c: 4a85
+	MOVE.L	#LAB_0040+2,-(A7)	;000e: 2f3c000002bc
+LAB_0001:
+	MOVE.L	25452(A5),D6		;0014: 2c2d636c
+	MOVEQ	#-35,D6			;0018: 7cdd
+	BSR.W	LAB_0017		;001a: 6100010a
+	BNE.S	LAB_0001		;001e: 66f4
+	ADD.W	D0,D0			;0020: d040
+	MOVE.W	LAB_0002(PC,D0.W),D0	;0022: 303b0006
+	JMP	LAB_0002(PC,D0.W)	;0026: 4efb0002
+LAB_0002:
+	ORI.B	#$14,(A0)		;002a: 00100014
+	ORI.B	#$1c,(A0)+		;002e: 0018001c
+	ORI.B	#$24,-(A0)		;0032: 00200024
+LAB_0003:
+	ORI.B	#$2c,28672(A0)		;0036: 0028002c7000
+	RTS				;003c: 4e75
+	MOVEQ	#1,D0			;003e: 7001
+	RTS				;0040: 4e75
+	MOVEQ	#2,D0			;0042: 7002
+	RTS				;0044: 4e75
+sym_0_13:
+	MOVEQ	#3,D0			;0046: 7003
+	RTS				;0048: 4e75
+	MOVEQ	#4,D0			;004a: 7004
+	RTS				;004c: 4e75
+	MOVEQ	#5,D0			;004e: 7005
+	RTS				;0050: 4e75
+	MOVEQ	#6,D0			;0052: 7006
+	RTS				;0054: 4e75
+	MOVEQ	#7,D0			;0056: 7007
+	RTS				;0058: 4e75
+LAB_0005:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;005a: 48e73f3e
+	BSR.W	sym_0_39		;005e: 61000062
+	BSR.W	LAB_0019		;0062: 610000e8
+LAB_0006:
+	BSR.W	LAB_0019		;0066: 610000e4
+	DBF	D7,LAB_0006		;006a: 51cffffa
+	CMP.L	#$0000caa7,D3		;006e: b6bc0000caa7
+	JSR	-858(A6)		;0074: 4eaefca6
+	MOVEQ	#51,D3			;0078: 7633
+sym_0_26:
+	MOVEQ	#-89,D6			;007a: 7ca7
+	MOVE.W	23344(A5),21638(A5)	;007c: 3b6d5b305486
+	BRA.S	LAB_0008		;0082: 6018
+	DC.W	$434f			;0084
+	DC.W	$4e3a			;0086
+	MOVE.W	12335(A7),D0		;0088: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;008c: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0090: 3230302f
+	DC.W	$4f75			;0094
+	MOVEQ	#112,D2			;0096: 7470
+	DC.W	$7574			;0098
+	DC.W	$0000			;009a
+LAB_0008:
+	MOVE.L	D6,D4			;009c: 2806
+	DBF	D1,LAB_0008		;009e: 51c9fffc
+	BNE.S	LAB_0008		;00a2: 66f8
+	CMP.L	#$0000beee,D3		;00a4: b6bc0000beee
+LAB_0009:
+	CMP.L	#$00002a71,D3		;00aa: b6bc00002a71
+LAB_000A:
+	DBF	D5,LAB_0009		;00b0: 51cdfff8
+	BNE.S	LAB_000A		;00b4: 66fa
+	MOVE.W	31148(A5),30047(A5)	;00b6: 3b6d79ac755f
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;00bc: 4cdf7cfc
+	RTS				;00c0: 4e75
+sym_0_39:
+	BSR.W	LAB_0017		;00c2: 61000062
+	MOVE.L	D5,D7			;00c6: 2e05
+	MOVE.W	28102(A5),30109(A5)	;00c8: 3b6d6dc6759d
+	BSR.W	LAB_0021		;00ce: 610000e0
+	ADDQ.L	#6,A3			;00d2: 5c8b
+	JSR	-636(A6)		;00d4: 4eaefd84
+LAB_000C:
+	BSR.W	LAB_0021		;00d8: 610000d6
+LAB_000D:
+	BNE.S	LAB_000C		;00dc: 66fa
+	JSR	-390(A6)		;00de: 4eaefe7a
+LAB_000E:
+	BNE.S	LAB_000D		;00e2: 66f8
+	DBF	D0,LAB_000E		;00e4: 51c8fffc
+	BNE.S	LAB_000E		;00e8: 66f8
+sym_0_52:
+	MOVEQ	#57,D2			;00ea: 7439
+LAB_0010:
+	BSR.W	LAB_0021		;00ec: 610000c2
+	DBF	D5,LAB_0010		;00f0: 51cdfffa
+	CMPI.L	#$000000fb,D3		;00f4: 0c83000000fb
+	BRA.S	LAB_0011		;00fa: 600c
+	DC.W	$646f			;00fc
+	DC.W	$732e			;00fe
+	DC.W	$6c69			;0100
+	BHI.S	LAB_001C		;0102: 6272
+	BSR.S	LAB_001D		;0104: 6172
+	DC.W	$7900			;0106
+LAB_0011:
+	ADD.L	D3,D7			;0108: de83
+	LEA	sym_0_0(PC),A6		;010a: 4dfafef4
+	MOVEQ	#-112,D7		;010e: 7e90
+LAB_0012:
+	BSR.W	LAB_0021		;0110: 6100009e
+LAB_0013:
+	MOVE.L	23448(A5),D0		;0114: 202d5b98
+LAB_0014:
+	JSR	-888(A6)		;0118: 4eaefc88
+	BNE.S	LAB_0012		;011c: 66f2
+LAB_0015:
+	BNE.S	LAB_0013		;011e: 66f4
+sym_0_65:
+	DBF	D4,LAB_0015		;0120: 51ccfffc
+	RTS				;0124: 4e75
+LAB_0017:
+	BSR.W	LAB_0019		;0126: 61000024
+	JSR	LAB_0033		;012a: 4eb900000266
+	ADD.W	D0,D0			;0130: d040
+	MOVE.W	LAB_0018(PC,D0.W),D0	;0132: 303b0006
+	JMP	LAB_0018(PC,D0.W)	;0136: 4efb0002
+LAB_0018:
+	ORI.B	#$0a,D6			;013a: 0006000a
+	DC.W	$000e			;013e
+	MOVEQ	#0,D0			;0140: 7000
+	RTS				;0142: 4e75
+	MOVEQ	#1,D0			;0144: 7001
+	RTS				;0146: 4e75
+	MOVEQ	#2,D0			;0148: 7002
+	RTS				;014a: 4e75
+LAB_0019:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;014c: 48e73f3e
+	BSR.W	LAB_0021		;0150: 6100005e
+	BRA.S	LAB_001A		;0154: 600a
+	DC.W	$2573			;0156
+	MOVE.W	-(A0),D5		;0158: 3a20
+	MOVE.L	25610(A4),0(A2)		;015a: 256c640a0000
+LAB_001A:
+	MOVE.W	27718(A5),542(A5)	;0160: 3b6d6c46021e
+sym_0_78:
+	BRA.S	LAB_001E		;0166: 6012
+	BVS.S	LAB_0026		;0168: 696e
+	MOVEQ	#117,D2			;016a: 7475
+	BVS.S	LAB_0028		;016c: 6974
+	DC.W	$696f			;016e
+	BGT.S	LAB_0020		;0170: 6e2e
+	DC.W	$6c69			;0172
+	BHI.S	LAB_002A		;0174: 6272
+LAB_001C:
+	BSR.S	LAB_002B		;0176: 6172
+LAB_001D:
+	DC.W	$7900			;0178
+LAB_001E:
+	ADD.L	D3,D2			;017a: d483
+	ADD.W	D0,D0			;017c: d040
+	MOVE.W	LAB_001F(PC,D0.W),D0	;017e: 303b0006
+	JMP	LAB_001F(PC,D0.W)	;0182: 4efb0002
+LAB_001F:
+	DC.W	$000e			;0186
+	ORI.B	#$16,(A2)		;0188: 00120016
+	ORI.B	#$1e,(A2)+		;018c: 001a001e
+	ORI.B	#$26,-(A2)		;0190: 00220026
+	MOVEQ	#0,D0			;0194: 7000
+	RTS				;0196: 4e75
+	MOVEQ	#1,D0			;0198: 7001
+	RTS				;019a: 4e75
+	MOVEQ	#2,D0			;019c: 7002
+	RTS				;019e: 4e75
+LAB_0020:
+	MOVEQ	#3,D0			;01a0: 7003
+	RTS				;01a2: 4e75
+	MOVEQ	#4,D0			;01a4: 7004
+	RTS				;01a6: 4e75
+	MOVEQ	#5,D0			;01a8: 7005
+	RTS				;01aa: 4e75
+	MOVEQ	#6,D0			;01ac: 7006
+	RTS				;01ae: 4e75
+LAB_0021:
+	LINK.W	A5,#-248		;01b0: 4e55ff08
+	BSR.W	LAB_0033		;01b4: 610000b0
+LAB_0023:
+	TST.L	D3			;01b8: 4a83
+sym_0_91:
+	MOVE.L	#LAB_00B3,-(A7)		;01ba: 2f3c000009ae
+	ADD.L	D3,D6			;01c0: dc83
+	JSR	LAB_0033		;01c2: 4eb900000266
+	BNE.S	sym_0_91		;01c8: 66f0
+LAB_0025:
+	CMPI.L	#$0000002e,D6		;01ca: 0c860000002e
+	BNE.S	LAB_0025		;01d0: 66f8
+	ADD.L	D0,D5			;01d2: da80
+	LEA	LAB_0023(PC),A2		;01d4: 45faffe2
+LAB_0026:
+	BSR.W	LAB_0033		;01d8: 6100008c
+	MOVE.L	D3,D1			;01dc: 2203
+	MOVEQ	#-84,D0			;01de: 70ac
+LAB_0027:
+	ADDQ.L	#6,A3			;01e0: 5c8b
+LAB_0028:
+	DBF	D0,LAB_0027		;01e2: 51c8fffc
+sym_0_104:
+	BRA.S	LAB_002C		;01e6: 6018
+LAB_002A:
+	DC.W	$434f			;01e8
+LAB_002B:
+	DC.W	$4e3a			;01ea
+	MOVE.W	12335(A7),D0		;01ec: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;01f0: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;01f4: 3230302f
+	DC.W	$4f75			;01f8
+	MOVEQ	#112,D2			;01fa: 7470
+	DC.W	$7574			;01fc
+	DC.W	$0000			;01fe
+LAB_002C:
+	ADDQ.L	#1,A2			;0200: 528a
+	MOVE.L	#LAB_00B2,-(A7)		;0202: 2f3c000009a4
+LAB_002D:
+	BSR.W	LAB_0033		;0208: 6100005c
+	ADD.L	D6,D5			;020c: da86
+	BNE.S	LAB_002D		;020e: 66f8
+	JSR	-888(A6)		;0210: 4eaefc88
+	ADDQ.L	#4,A1			;0214: 5889
+	BRA.S	LAB_002E		;0216: 6012
+	BEQ.S	LAB_0036		;0218: 6772
+	BSR.S	LAB_0036		;021a: 6170
+	DC.W	$6869			;021c
+	DC.W	$6373			;021e
+	MOVEA.L	26978(A4),A7		;0220: 2e6c6962
+	MOVEQ	#97,D1			;0224: 7261
+	MOVEQ	#121,D1			;0226: 7279
+	DC.W	$0000			;0228
+LAB_002E:
+	BRA.S	LAB_002F		;022a: 6012
+	BVS.S	LAB_003A		;022c: 696e
+	MOVEQ	#117,D2			;022e: 7475
+	BVS.S	LAB_003B+2		;0230: 6974
+	DC.W	$696f			;0232
+	BGT.S	LAB_0032		;0234: 6e2e
+	DC.W	$6c69			;0236
+	BHI.S	LAB_003D		;0238: 6272
+	BSR.S	LAB_003E		;023a: 6172
+	DC.W	$7900			;023c
+LAB_002F:
+	BSR.W	LAB_0045		;023e: 610000d8
+	ADDQ.L	#3,A7			;0242: 568f
+	ADD.W	D0,D0			;0244: d040
+	MOVE.W	LAB_0030(PC,D0.W),D0	;0246: 303b0006
+	JMP	LAB_0030(PC,D0.W)	;024a: 4efb0002
+LAB_0030:
+	DC.W	$0008			;024e
+	DC.W	$000c			;0250
+	ORI.B	#$14,(A0)		;0252: 00100014
+sym_0_117:
+	MOVEQ	#0,D0			;0256: 7000
+	RTS				;0258: 4e75
+	MOVEQ	#1,D0			;025a: 7001
+	RTS				;025c: 4e75
+	MOVEQ	#2,D0			;025e: 7002
+	RTS				;0260: 4e75
+	MOVEQ	#3,D0			;0262: 7003
+LAB_0032:
+	RTS				;0264: 4e75
+LAB_0033:
+	BSR.W	LAB_0042		;0266: 6100007a
+	DBF	D3,LAB_0033		;026a: 51cbfffa
+	TST.L	D5			;026e: 4a85
+	BSR.W	LAB_0051		;0270: 61000144
+	LEA	LAB_0014+2(PC),A2	;0274: 45fafea4
+	JSR	-498(A6)		;0278: 4eaefe0e
+LAB_0034:
+	CMP.L	#$0000a5f1,D6		;027c: bcbc0000a5f1
+	CMPI.L	#$000000d2,D6		;0282: 0c86000000d2
+sym_0_130:
+	BSR.W	LAB_0045		;0288: 6100008e
+LAB_0036:
+	BNE.S	LAB_0034		;028c: 66ee
+	MOVE.L	D3,D1			;028e: 2203
+LAB_0037:
+	MOVE.W	32203(A5),12016(A5)	;0290: 3b6d7dcb2ef0
+LAB_0038:
+	MOVE.L	D2,D1			;0296: 2202
+	BNE.S	LAB_0038		;0298: 66fc
+LAB_0039:
+	BNE.S	LAB_0037		;029a: 66f4
+LAB_003A:
+	CMP.L	#$00009df4,D1		;029c: b2bc00009df4
+	BNE.S	LAB_0039		;02a2: 66f6
+LAB_003B:
+	BSR.W	LAB_0042		;02a4: 6100003c
+	DBF	D1,LAB_003B		;02a8: 51c9fffa
+LAB_003D:
+	MOVE.L	D4,D1			;02ac: 2204
+LAB_003E:
+	CMP.L	#$0000d7d5,D5		;02ae: babc0000d7d5
+sym_0_143:
+	ADD.W	D0,D0			;02b4: d040
+	MOVE.W	LAB_0041(PC,D0.W),D0	;02b6: 303b0006
+LAB_0040:
+	JMP	LAB_0041(PC,D0.W)	;02ba: 4efb0002
+LAB_0041:
+	DC.W	$000c			;02be
+	ORI.B	#$14,(A0)		;02c0: 00100014
+	ORI.B	#$1c,(A0)+		;02c4: 0018001c
+	DC.W	$0020			;02c8
+	MOVEQ	#0,D0			;02ca: 7000
+	RTS				;02cc: 4e75
+	MOVEQ	#1,D0			;02ce: 7001
+	RTS				;02d0: 4e75
+	MOVEQ	#2,D0			;02d2: 7002
+	RTS				;02d4: 4e75
+	MOVEQ	#3,D0			;02d6: 7003
+	RTS				;02d8: 4e75
+	MOVEQ	#4,D0			;02da: 7004
+	RTS				;02dc: 4e75
+	MOVEQ	#5,D0			;02de: 7005
+	RTS				;02e0: 4e75
+LAB_0042:
+	LINK.W	A5,#-252		;02e2: 4e55ff04
+	BSR.W	LAB_0045		;02e6: 61000030
+	ADD.W	D0,D0			;02ea: d040
+	MOVE.W	LAB_0043(PC,D0.W),D0	;02ec: 303b0006
+	JMP	LAB_0043(PC,D0.W)	;02f0: 4efb0002
+LAB_0043:
+	DC.W	$000c			;02f4
+	ORI.B	#$14,(A0)		;02f6: 00100014
+	ORI.B	#$1c,(A0)+		;02fa: 0018001c
+	DC.W	$0020			;02fe
+	MOVEQ	#0,D0			;0300: 7000
+	RTS				;0302: 4e75
+	MOVEQ	#1,D0			;0304: 7001
+	RTS				;0306: 4e75
+	MOVEQ	#2,D0			;0308: 7002
+	RTS				;030a: 4e75
+sym_0_156:
+	MOVEQ	#3,D0			;030c: 7003
+	RTS				;030e: 4e75
+	MOVEQ	#4,D0			;0310: 7004
+	RTS				;0312: 4e75
+	MOVEQ	#5,D0			;0314: 7005
+	RTS				;0316: 4e75
+LAB_0045:
+	BSR.W	LAB_0051		;0318: 6100009c
+	MOVE.L	D4,D3			;031c: 2604
+	ADDQ.L	#5,A3			;031e: 5a8b
+LAB_0046:
+	CMP.L	#$00003c83,D2		;0320: b4bc00003c83
+	BNE.S	LAB_0046		;0326: 66f8
+	BNE.S	LAB_0046		;0328: 66f6
+	JSR	-498(A6)		;032a: 4eaefe0e
+LAB_0047:
+	JSR	-858(A6)		;032e: 4eaefca6
+	DBF	D0,LAB_0047		;0332: 51c8fffa
+sym_0_169:
+	BSR.W	LAB_006D		;0336: 6100017c
+	ADD.L	D3,D1			;033a: d283
+LAB_0049:
+	MOVE.L	15060(A5),D4		;033c: 282d3ad4
+	DBF	D0,LAB_0049		;0340: 51c8fffa
+	MOVE.L	D6,D4			;0344: 2806
+	BRA.S	LAB_004A		;0346: 6018
+	DC.W	$434f			;0348
+	DC.W	$4e3a			;034a
+	MOVE.W	12335(A7),D0		;034c: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;0350: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0354: 3230302f
+	DC.W	$4f75			;0358
+	MOVEQ	#112,D2			;035a: 7470
+	DC.W	$7574			;035c
+	DC.W	$0000			;035e
+LAB_004A:
+	MOVEQ	#-37,D6			;0360: 7cdb
+	MOVE.L	#LAB_00D8,-(A7)		;0362: 2f3c00000b4a
+LAB_004B:
+	BSR.W	sym_0_221		;0368: 610000b0
+	BSR.W	LAB_0051		;036c: 61000048
+LAB_004C:
+	BRA.S	LAB_004D		;0370: 600a
+	SUBQ.W	#3,29291(A7)		;0372: 576f726b
+	DC.W	$6265			;0376
+	DC.W	$6e63			;0378
+	DC.W	$6800			;037a
+LAB_004D:
+	BNE.S	LAB_004B		;037c: 66ea
+	MOVE.W	22745(A5),7208(A5)	;037e: 3b6d58d91c28
+sym_0_182:
+	CMPI.L	#$00000015,D3		;0384: 0c8300000015
+	CMP.L	#$0000fa92,D3		;038a: b6bc0000fa92
+	BNE.S	sym_0_182		;0390: 66f2
+LAB_004F:
+	BSR.W	LAB_006D		;0392: 61000120
+	DBF	D3,LAB_004F		;0396: 51cbfffa
+	ADD.L	D2,D3			;039a: d682
+	BRA.S	LAB_0050		;039c: 600a
+	SUBQ.W	#3,29291(A7)		;039e: 576f726b
+	DC.W	$6265			;03a2
+	DC.W	$6e63			;03a4
+	DC.W	$6800			;03a6
+LAB_0050:
+	MOVEQ	#112,D6			;03a8: 7c70
+	CMPI.L	#$0000003f,D3		;03aa: 0c830000003f
+	BSR.W	LAB_0051		;03b0: 61000004
+	RTS				;03b4: 4e75
+LAB_0051:
+	LINK.W	A5,#-100		;03b6: 4e55ff9c
+	BSR.W	sym_0_221		;03ba: 6100005e
+sym_0_195:
+	BSR.W	LAB_006D		;03be: 610000f4
+LAB_0053:
+	DBF	D1,sym_0_195		;03c2: 51c9fffa
+	BNE.S	LAB_0053		;03c6: 66fa
+	BNE.S	sym_0_195		;03c8: 66f4
+	MOVE.L	D5,D1			;03ca: 2205
+LAB_0054:
+	CMPI.L	#$000000d6,D4		;03cc: 0c84000000d6
+	BSR.W	LAB_006D		;03d2: 610000e0
+	BSR.W	LAB_006D		;03d6: 610000dc
+	BNE.S	LAB_0054		;03da: 66f0
+LAB_0055:
+	MOVE.L	7416(A5),D6		;03dc: 2c2d1cf8
+LAB_0056:
+	ADDQ.L	#2,A5			;03e0: 548d
+	DBF	D0,LAB_0056		;03e2: 51c8fffc
+	BNE.S	LAB_0055		;03e6: 66f4
+sym_0_208:
+	MOVE.W	24928(A5),31906(A5)	;03e8: 3b6d61607ca2
+	CMP.L	#$0000c795,D5		;03ee: babc0000c795
+	JSR	-816(A6)		;03f4: 4eaefcd0
+	BNE.S	sym_0_208		;03f8: 66ee
+LAB_0058:
+	BRA.S	LAB_0059		;03fa: 6008
+	DC.W	$4572			;03fc
+	MOVEQ	#111,D1			;03fe: 726f
+	MOVEQ	#58,D1			;0400: 723a
+	MOVE.L	D0,D0			;0402: 2000
+LAB_0059:
+	DBF	D4,LAB_0058		;0404: 51ccfff4
+	MOVE.L	D3,D4			;0408: 2803
+	ADDQ.L	#6,A7			;040a: 5c8f
+	ADD.L	D5,D6			;040c: dc85
+	BSR.W	sym_0_221		;040e: 6100000a
+	BSR.W	LAB_0076		;0412: 610000c8
+	UNLK	A5			;0416: 4e5d
+	RTS				;0418: 4e75
+sym_0_221:
+	BSR.W	LAB_006D		;041a: 61000098
+LAB_005B:
+	DBF	D3,sym_0_221		;041e: 51cbfffa
+	CMP.L	#$0000bf49,D3		;0422: b6bc0000bf49
+	BNE.S	LAB_005B		;0428: 66f4
+LAB_005C:
+	BRA.S	LAB_005D		;042a: 6012
+	BVS.S	LAB_0068		;042c: 696e
+	MOVEQ	#117,D2			;042e: 7475
+	BVS.S	LAB_0069		;0430: 6974
+	DC.W	$696f			;0432
+	BGT.S	LAB_0060+2		;0434: 6e2e
+	DC.W	$6c69			;0436
+	BHI.S	LAB_006B		;0438: 6272
+	BSR.S	LAB_006C		;043a: 6172
+	DC.W	$7900			;043c
+LAB_005D:
+	DBF	D3,LAB_005C		;043e: 51cbffea
+	DBF	D4,LAB_005D		;0442: 51ccfffa
+	BSR.W	LAB_006D		;0446: 6100006c
+LAB_005E:
+	BRA.S	LAB_005F		;044a: 6012
+	BVS.S	LAB_006E		;044c: 696e
+	MOVEQ	#117,D2			;044e: 7475
+	BVS.S	LAB_0070		;0450: 6974
+	DC.W	$696f			;0452
+	BGT.S	LAB_0066		;0454: 6e2e
+	DC.W	$6c69			;0456
+	BHI.S	LAB_0073		;0458: 6272
+	BSR.S	LAB_0074		;045a: 6172
+	DC.W	$7900			;045c
+LAB_005F:
+	DBF	D7,LAB_005E		;045e: 51cfffea
+LAB_0060:
+	LEA	LAB_004C(PC),A0		;0462: 41faff0c
+	DBF	D0,LAB_0060		;0466: 51c8fffa
+sym_0_234:
+	MOVE.L	D6,D3			;046a: 2606
+LAB_0063:
+	ADD.L	D6,D5			;046c: da86
+	DBF	D6,LAB_0063		;046e: 51cefffc
+LAB_0064:
+	BSR.W	LAB_0076		;0472: 61000068
+	DBF	D4,LAB_0064		;0476: 51ccfffa
+	ADDQ.L	#4,A0			;047a: 5888
+	ADDQ.L	#7,A5			;047c: 5e8d
+LAB_0065:
+	CMP.L	#$0000735f,D6		;047e: bcbc0000735f
+LAB_0066:
+	BNE.S	LAB_0065		;0484: 66f8
+	ADD.W	D0,D0			;0486: d040
+	MOVE.W	LAB_0067(PC,D0.W),D0	;0488: 303b0006
+	JMP	LAB_0067(PC,D0.W)	;048c: 4efb0002
+LAB_0067:
+	DC.W	$000c			;0490
+	ORI.B	#$14,(A0)		;0492: 00100014
+	ORI.B	#$1c,(A0)+		;0496: 0018001c
+	DC.W	$0020			;049a
+LAB_0068:
+	MOVEQ	#0,D0			;049c: 7000
+	RTS				;049e: 4e75
+	MOVEQ	#1,D0			;04a0: 7001
+	RTS				;04a2: 4e75
+	MOVEQ	#2,D0			;04a4: 7002
+LAB_0069:
+	RTS				;04a6: 4e75
+sym_0_247:
+	MOVEQ	#3,D0			;04a8: 7003
+	RTS				;04aa: 4e75
+LAB_006B:
+	MOVEQ	#4,D0			;04ac: 7004
+LAB_006C:
+	RTS				;04ae: 4e75
+	MOVEQ	#5,D0			;04b0: 7005
+	RTS				;04b2: 4e75
+LAB_006D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;04b4: 48e73f3e
+	BSR.W	LAB_0076		;04b8: 61000022
+LAB_006E:
+	TST.L	D5			;04bc: 4a85
+	DBF	D3,LAB_006E		;04be: 51cbfffc
+LAB_006F:
+	JSR	-438(A6)		;04c2: 4eaefe4a
+LAB_0070:
+	BNE.S	LAB_006F		;04c6: 66fa
+LAB_0071:
+	MOVE.L	D0,D0			;04c8: 2000
+LAB_0072:
+	BNE.S	LAB_0071		;04ca: 66fc
+LAB_0073:
+	BNE.S	LAB_0072		;04cc: 66fc
+LAB_0074:
+	BNE.S	LAB_0071		;04ce: 66f8
+sym_0_260:
+	MOVE.L	D2,D5			;04d0: 2a02
+	DBF	D0,sym_0_260		;04d2: 51c8fffc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;04d6: 4cdf7cfc
+	RTS				;04da: 4e75
+LAB_0076:
+	BSR.W	LAB_0079		;04dc: 6100002c
+LAB_0077:
+	MOVE.W	24571(A5),10884(A5)	;04e0: 3b6d5ffb2a84
+	DBF	D1,LAB_0077		;04e6: 51c9fff8
+	BNE.S	LAB_0076		;04ea: 66f0
+	CMP.L	#$0000b556,D4		;04ec: b8bc0000b556
+	MOVEQ	#-66,D2			;04f2: 74be
+	BSR.W	sym_0_312		;04f4: 610000e2
+	BRA.S	sym_0_273		;04f8: 600e
+	DC.W	$4f75			;04fa
+	MOVEQ	#32,D2			;04fc: 7420
+	BLE.S	LAB_0080+2		;04fe: 6f66
+	MOVEA.L	25965(A5),A0		;0500: 206d656d
+	BLE.S	LAB_0083		;0504: 6f72
+	DC.W	$7900			;0506
+sym_0_273:
+	RTS				;0508: 4e75
+LAB_0079:
+	LINK.W	A5,#-60			;050a: 4e55ffc4
+	BSR.W	LAB_007E		;050e: 61000048
+	BSR.W	LAB_007E		;0512: 61000044
+	TST.L	D1			;0516: 4a81
+	ADD.L	D6,D2			;0518: d486
+LAB_007A:
+	ADDQ.L	#3,A7			;051a: 568f
+	DBF	D7,LAB_007A		;051c: 51cffffc
+LAB_007B:
+	MOVE.W	8236(A5),10348(A5)	;0520: 3b6d202c286c
+	DBF	D4,LAB_007B		;0526: 51ccfff8
+	CMP.L	#$0000c518,D6		;052a: bcbc0000c518
+	ADD.W	D0,D0			;0530: d040
+	MOVE.W	LAB_007C(PC,D0.W),D0	;0532: 303b0006
+	JMP	LAB_007C(PC,D0.W)	;0536: 4efb0002
+LAB_007C:
+	DC.W	$000a			;053a
+	DC.W	$000e			;053c
+	ORI.B	#$16,(A2)		;053e: 00120016
+	DC.W	$001a			;0542
+	MOVEQ	#0,D0			;0544: 7000
+	RTS				;0546: 4e75
+sym_0_286:
+	MOVEQ	#1,D0			;0548: 7001
+	RTS				;054a: 4e75
+	MOVEQ	#2,D0			;054c: 7002
+	RTS				;054e: 4e75
+	MOVEQ	#3,D0			;0550: 7003
+	RTS				;0552: 4e75
+	MOVEQ	#4,D0			;0554: 7004
+	RTS				;0556: 4e75
+LAB_007E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0558: 48e73f3e
+LAB_007F:
+	BSR.W	sym_0_312		;055c: 6100007a
+	DBF	D2,LAB_007F		;0560: 51cafffa
+LAB_0080:
+	BSR.W	LAB_0097		;0564: 61000114
+LAB_0081:
+	BRA.S	LAB_0082		;0568: 6008
+	ADDQ.W	#1,-(A5)		;056a: 5265
+	BSR.S	LAB_0088		;056c: 6164
+	DC.W	$792e			;056e
+	DC.W	$0000			;0570
+LAB_0082:
+	BNE.S	LAB_0081		;0572: 66f4
+	BNE.S	LAB_0082		;0574: 66fc
+	BRA.S	LAB_0084		;0576: 6012
+LAB_0083:
+	BEQ.S	LAB_008B		;0578: 6772
+	BSR.S	LAB_008B		;057a: 6170
+	DC.W	$6869			;057c
+	DC.W	$6373			;057e
+	MOVEA.L	26978(A4),A7		;0580: 2e6c6962
+	MOVEQ	#97,D1			;0584: 7261
+	MOVEQ	#121,D1			;0586: 7279
+	DC.W	$0000			;0588
+LAB_0084:
+	BSR.W	LAB_008C		;058a: 61000088
+sym_0_299:
+	BSR.W	sym_0_312		;058e: 61000048
+	BSR.W	LAB_008C		;0592: 61000080
+LAB_0086:
+	BSR.W	sym_0_312		;0596: 61000040
+	DBF	D3,LAB_0086		;059a: 51cbfffa
+	ADD.W	D0,D0			;059e: d040
+	MOVE.W	LAB_0087(PC,D0.W),D0	;05a0: 303b0006
+	JMP	LAB_0087(PC,D0.W)	;05a4: 4efb0002
+LAB_0087:
+	ORI.B	#$14,(A0)		;05a8: 00100014
+	ORI.B	#$1c,(A0)+		;05ac: 0018001c
+	ORI.B	#$24,-(A0)		;05b0: 00200024
+	ORI.B	#$2c,28672(A0)		;05b4: 0028002c7000
+	RTS				;05ba: 4e75
+	MOVEQ	#1,D0			;05bc: 7001
+	RTS				;05be: 4e75
+	MOVEQ	#2,D0			;05c0: 7002
+	RTS				;05c2: 4e75
+	MOVEQ	#3,D0			;05c4: 7003
+	RTS				;05c6: 4e75
+	MOVEQ	#4,D0			;05c8: 7004
+	RTS				;05ca: 4e75
+	MOVEQ	#5,D0			;05cc: 7005
+	RTS				;05ce: 4e75
+	MOVEQ	#6,D0			;05d0: 7006
+LAB_0088:
+	RTS				;05d2: 4e75
+	MOVEQ	#7,D0			;05d4: 7007
+	RTS				;05d6: 4e75
+sym_0_312:
+	LINK.W	A5,#-160		;05d8: 4e55ff60
+	BSR.W	LAB_008C		;05dc: 61000036
+	ADD.W	D0,D0			;05e0: d040
+	MOVE.W	LAB_008A(PC,D0.W),D0	;05e2: 303b0006
+	JMP	LAB_008A(PC,D0.W)	;05e6: 4efb0002
+LAB_008A:
+	DC.W	$000e			;05ea
+LAB_008B:
+	ORI.B	#$16,(A2)		;05ec: 00120016
+	ORI.B	#$1e,(A2)+		;05f0: 001a001e
+	ORI.B	#$26,-(A2)		;05f4: 00220026
+	MOVEQ	#0,D0			;05f8: 7000
+	RTS				;05fa: 4e75
+	MOVEQ	#1,D0			;05fc: 7001
+	RTS				;05fe: 4e75
+	MOVEQ	#2,D0			;0600: 7002
+	RTS				;0602: 4e75
+	MOVEQ	#3,D0			;0604: 7003
+	RTS				;0606: 4e75
+	MOVEQ	#4,D0			;0608: 7004
+	RTS				;060a: 4e75
+	MOVEQ	#5,D0			;060c: 7005
+	RTS				;060e: 4e75
+	MOVEQ	#6,D0			;0610: 7006
+	RTS				;0612: 4e75
+LAB_008C:
+	LINK.W	A5,#-100		;0614: 4e55ff9c
+LAB_008D:
+	BSR.W	LAB_0097		;0618: 61000060
+	CMPI.L	#$0000003d,D1		;061c: 0c810000003d
+sym_0_325:
+	JSR	LAB_0097		;0622: 4eb90000067a
+	BSR.W	LAB_009B		;0628: 6100007c
+	MOVE.L	D3,D5			;062c: 2a03
+LAB_008F:
+	BSR.W	LAB_009B		;062e: 61000076
+LAB_0090:
+	ADDQ.L	#7,A6			;0632: 5e8e
+	DBF	D0,LAB_0090		;0634: 51c8fffc
+LAB_0091:
+	MOVE.W	27415(A5),10241(A5)	;0638: 3b6d6b172801
+	CMP.L	#$0000c57a,D3		;063e: b6bc0000c57a
+	MOVEQ	#-45,D6			;0644: 7cd3
+LAB_0092:
+	BNE.S	LAB_0091		;0646: 66f0
+LAB_0093:
+	DBF	D0,LAB_0092		;0648: 51c8fffc
+	BNE.S	LAB_0092		;064c: 66f8
+	BNE.S	LAB_0093		;064e: 66f8
+sym_0_338:
+	BSR.W	LAB_00A9		;0650: 61000116
+LAB_0095:
+	JSR	-870(A6)		;0654: 4eaefc9a
+	DBF	D1,LAB_0095		;0658: 51c9fffa
+	MOVE.L	25456(A5),D1		;065c: 222d6370
+	LEA	LAB_0021+2(PC),A6	;0660: 4dfafb50
+	BSR.W	LAB_00A9		;0664: 61000102
+	CMPI.L	#$000000ca,D1		;0668: 0c81000000ca
+LAB_0096:
+	ADD.L	D6,D6			;066e: dc86
+	BSR.W	LAB_0097		;0670: 61000008
+	BNE.S	LAB_0096		;0674: 66f8
+	UNLK	A5			;0676: 4e5d
+	RTS				;0678: 4e75
+LAB_0097:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;067a: 48e73f3e
+sym_0_351:
+	BSR.W	LAB_009B		;067e: 61000026
+	BSR.W	LAB_00A9		;0682: 610000e4
+	CMPI.L	#$000000b1,D1		;0686: 0c81000000b1
+	MOVE.L	30854(A5),D4		;068c: 282d7886
+LAB_0099:
+	BRA.S	LAB_009A		;0690: 600a
+	DC.W	$2573			;0692
+	MOVE.W	-(A0),D5		;0694: 3a20
+	MOVE.L	25610(A4),0(A2)		;0696: 256c640a0000
+LAB_009A:
+	DBF	D5,LAB_0099		;069c: 51cdfff2
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;06a0: 4cdf7cfc
+	RTS				;06a4: 4e75
+LAB_009B:
+	BSR.W	LAB_00A9		;06a6: 610000c0
+	MOVE.L	4446(A5),D4		;06aa: 282d115e
+	MOVE.L	18658(A5),D6		;06ae: 2c2d48e2
+LAB_009C:
+	MOVE.L	12378(A5),D7		;06b2: 2e2d305a
+sym_0_364:
+	BRA.S	LAB_009E		;06b6: 6018
+	DC.W	$434f			;06b8
+	DC.W	$4e3a			;06ba
+	MOVE.W	12335(A7),D0		;06bc: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;06c0: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;06c4: 3230302f
+	DC.W	$4f75			;06c8
+	MOVEQ	#112,D2			;06ca: 7470
+	DC.W	$7574			;06cc
+	DC.W	$0000			;06ce
+LAB_009E:
+	JSR	-816(A6)		;06d0: 4eaefcd0
+LAB_009F:
+	BNE.S	LAB_009C		;06d4: 66dc
+	BSR.W	LAB_00AF		;06d6: 610000ee
+LAB_00A0:
+	BNE.S	LAB_009F		;06da: 66f8
+LAB_00A1:
+	DBF	D1,LAB_00A0		;06dc: 51c9fffc
+	ADDQ.L	#6,A5			;06e0: 5c8d
+	CMP.L	#$00005d1c,D3		;06e2: b6bc00005d1c
+	JSR	-30(A6)			;06e8: 4eaeffe2
+	JSR	-168(A6)		;06ec: 4eaeff58
+	MOVE.L	D2,D5			;06f0: 2a02
+	ADD.L	D6,D6			;06f2: dc86
+	CMPI.L	#$000000bb,D6		;06f4: 0c86000000bb
+sym_0_377:
+	MOVE.L	30430(A5),D3		;06fa: 262d76de
+	ADDQ.L	#7,A1			;06fe: 5e89
+	BSR.W	LAB_00AF		;0700: 610000c4
+LAB_00A3:
+	MOVEQ	#-92,D2			;0704: 74a4
+LAB_00A4:
+	MOVE.L	D6,D6			;0706: 2c06
+	BNE.S	LAB_00A4		;0708: 66fc
+	BNE.S	LAB_00A3		;070a: 66f8
+	ADD.L	D0,D5			;070c: da80
+	LEA	LAB_008F(PC),A2		;070e: 45faff1e
+	ADD.L	D6,D5			;0712: da86
+	CMP.L	#$0000f788,D4		;0714: b8bc0000f788
+	MOVE.W	24483(A5),23004(A5)	;071a: 3b6d5fa359dc
+LAB_00A5:
+	MOVE.L	32062(A5),D5		;0720: 2a2d7d3e
+sym_0_390:
+	DBF	D2,LAB_00A5		;0724: 51cafffa
+	ADDQ.L	#2,A1			;0728: 5489
+	JSR	-414(A6)		;072a: 4eaefe62
+	CMPI.L	#$0000009e,D0		;072e: 0c800000009e
+	ADD.L	D6,D3			;0734: d686
+	CMPI.L	#$00000094,D1		;0736: 0c8100000094
+	BSR.W	LAB_00AF		;073c: 61000088
+	LEA	LAB_005F(PC),A2		;0740: 45fafd1c
+	MOVE.W	5605(A5),7566(A5)	;0744: 3b6d15e51d8e
+	CMPI.L	#$0000001a,D1		;074a: 0c810000001a
+	LEA	LAB_008D+2(PC),A0	;0750: 41fafec8
+	BSR.W	LAB_00AF		;0754: 61000070
+	ADDQ.L	#4,A6			;0758: 588e
+sym_0_403:
+	BRA.S	LAB_00A8		;075a: 600a
+	SUBQ.W	#3,29291(A7)		;075c: 576f726b
+	DC.W	$6265			;0760
+	DC.W	$6e63			;0762
+	DC.W	$6800			;0764
+LAB_00A8:
+	RTS				;0766: 4e75
+LAB_00A9:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0768: 48e73f3e
+	BSR.W	LAB_00AF		;076c: 61000058
+	MOVE.W	6066(A5),26397(A5)	;0770: 3b6d17b2671d
+	TST.L	D3			;0776: 4a83
+LAB_00AA:
+	BSR.W	LAB_00AF		;0778: 6100004c
+	DBF	D5,LAB_00AA		;077c: 51cdfffa
+	MOVE.W	19688(A5),8049(A5)	;0780: 3b6d4ce81f71
+	CMPI.L	#$00000098,D5		;0786: 0c8500000098
+	BRA.S	LAB_00AB		;078c: 600c
+	DC.W	$646f			;078e
+	DC.W	$732e			;0790
+	DC.W	$6c69			;0792
+	DC.W	$6272			;0794
+	DC.W	$6172			;0796
+	DC.W	$7900			;0798
+LAB_00AB:
+	ADD.L	D3,D3			;079a: d683
+	DBF	D2,LAB_00AB		;079c: 51cafffc
+sym_0_416:
+	BSR.W	LAB_00AF		;07a0: 61000024
+LAB_00AD:
+	JSR	-738(A6)		;07a4: 4eaefd1e
+	DBF	D0,LAB_00AD		;07a8: 51c8fffa
+	BNE.S	sym_0_416		;07ac: 66f2
+	BNE.S	LAB_00AD		;07ae: 66f4
+	JSR	LAB_00AF		;07b0: 4eb9000007c6
+LAB_00AE:
+	CMP.L	#$00006a8c,D1		;07b6: b2bc00006a8c
+	DBF	D1,LAB_00AE		;07bc: 51c9fff8
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;07c0: 4cdf7cfc
+	RTS				;07c4: 4e75
+LAB_00AF:
+	JSR	sym_2_0			;07c6: 4eb900000a00
+	NOP				;07cc: 4e71
+	NOP				;07ce: 4e71
+	NOP				;07d0: 4e71
+	NOP				;07d2: 4e71
+	NOP				;07d4: 4e71
+	NOP				;07d6: 4e71
+	NOP				;07d8: 4e71
+	NOP				;07da: 4e71
+	NOP				;07dc: 4e71
+	NOP				;07de: 4e71
+	NOP				;07e0: 4e71
+	NOP				;07e2: 4e71
+	NOP				;07e4: 4e71
+	NOP				;07e6: 4e71
+	NOP				;07e8: 4e71
+	NOP				;07ea: 4e71
+	NOP				;07ec: 4e71
+	NOP				;07ee: 4e71
+	NOP				;07f0: 4e71
+	NOP				;07f2: 4e71
+	NOP				;07f4: 4e71
+	NOP				;07f6: 4e71
+	NOP				;07f8: 4e71
+	NOP				;07fa: 4e71
+	NOP				;07fc: 4e71
+	RTS				;07fe: 4e75
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	;0800
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e
+	DC.B	"intuition."
+LAB_00B0:
+	DC.L	$6c696272,$61727900,$5702fdd5,$2bc4ea31 ;080a
+	DC.L	$43331c7c,$52656164,$792e0000,$388ef53a ;081a
+	DC.L	$6847e829,$67726170,$68696373,$2e6c6962 ;082a
+	DC.L	$72617279,$0000696e,$74756974,$696f6e2e ;083a
+	DC.L	$6c696272,$61727900,$57b6feeb ;084a
+LAB_00B1:
+	DC.L	$219f3fba,$52656164,$792e0000,$741e38c3 ;0856
+	DC.L	$7763ec3b		;0866
+	DC.L	LAB_0071		;086a: 000004c8
+	DC.L	$45f97925,$52656164,$792e0000,$4f757420 ;086e
+	DC.L	$6f66206d,$656d6f72,$79002285,$f80d4572 ;087e
+	DC.L	$726f723a,$20002573,$3a20256c,$640a0000 ;088e
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172 ;089e
+	DC.L	$79003695,$e2656772,$61706869,$63732e6c ;08ae
+	DC.L	$69627261,$72790000,$52656164,$792e0000 ;08be
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172 ;08ce
+	DC.W	$7900			;08de
+	DC.L	LAB_00A1		;08e0: 000006dc
+	DC.L	$576f726b,$62656e63,$68002573,$3a20256c ;08e4
+	DC.L	$640a0000,$001374d2,$2995140b,$122a27f4 ;08f4
+	DC.L	$1ebb2f9a,$576f726b,$62656e63,$68004e35 ;0904
+	DC.L	$7b87656d,$06587d63,$95da1339,$ef1054e5 ;0914
+	DC.L	$65123cdb,$c6ea2168,$9f17395f,$91fe33e5 ;0924
+	DC.L	$c02258cc,$c8a65265,$6164792e,$000047f1 ;0934
+	DC.L	$7f0f4572,$726f723a,$2000620d,$f59165d7 ;0944
+	DC.L	$e2a35026,$44b42851,$68f1212b,$4b8727f0 ;0954
+	DC.L	$68d219da,$0e697fb4,$569315b9,$478040cb ;0964
+	DC.L	$02a23109,$e667162e,$e38c470f,$2a24434f ;0974
+	DC.L	$4e3a302f,$302f3634,$302f3230,$302f4f75 ;0984
+	DC.L	$74707574,$00002573,$3a20256c,$640a0000 ;0994
+LAB_00B2:
+	DC.L	$0dab112e,$746f7061	;09a4
+	DC.W	$7a2e			;09ac
+LAB_00B3:
+	DC.L	$666f6e74,$000061bf,$6d453840,$9aa63614 ;09ae
+	DC.W	$bb23			;09be
+	DC.L	LAB_006D		;09c0: 000004b4
+	DC.L	$4760408b,$746f7061,$7a2e666f,$6e740000 ;09c4
+	DC.L	$0b4e2b13		;09d4
+	DS.L	9			;09d8
+LAB_00B4:
+	DS.L	1			;09fc
+
+
+	SECTION S_2,CODE
+
+sym_2_0:
+	LINK.W	A5,#-188		;0a00: 4e55ff44
+	BSR.W	sym_2_13		;0a04: 61000058
+	BRA.S	LAB_00B6		;0a08: 6012
+	BVS.S	LAB_00C0+2		;0a0a: 696e
+	MOVEQ	#117,D2			;0a0c: 7475
+	BVS.S	LAB_00C3		;0a0e: 6974
+	DC.W	$696f			;0a10
+	BGT.S	LAB_00BA		;0a12: 6e2e
+	DC.W	$6c69			;0a14
+	BHI.S	LAB_00C5		;0a16: 6272
+	BSR.S	LAB_00C6		;0a18: 6172
+	DC.W	$7900			;0a1a
+LAB_00B6:
+	BRA.S	LAB_00B7		;0a1c: 6008
+	ADDQ.W	#1,-(A5)		;0a1e: 5265
+	BSR.S	LAB_00C4		;0a20: 6164
+	DC.W	$792e			;0a22
+	DC.W	$0000			;0a24
+LAB_00B7:
+	MOVE.L	28848(A5),D2		;0a26: 242d70b0
+	ADD.W	D0,D0			;0a2a: d040
+	MOVE.W	LAB_00B8(PC,D0.W),D0	;0a2c: 303b0006
+	JMP	LAB_00B8(PC,D0.W)	;0a30: 4efb0002
+LAB_00B8:
+	DC.W	$000e			;0a34
+	ORI.B	#$16,(A2)		;0a36: 00120016
+	ORI.B	#$1e,(A2)+		;0a3a: 001a001e
+LAB_00B9:
+	ORI.B	#$26,-(A2)		;0a3e: 00220026
+LAB_00BA:
+	MOVEQ	#0,D0			;0a42: 7000
+	RTS				;0a44: 4e75
+	MOVEQ	#1,D0			;0a46: 7001
+	RTS				;0a48: 4e75
+	MOVEQ	#2,D0			;0a4a: 7002
+	RTS				;0a4c: 4e75
+	MOVEQ	#3,D0			;0a4e: 7003
+	RTS				;0a50: 4e75
+	MOVEQ	#4,D0			;0a52: 7004
+	RTS				;0a54: 4e75
+LAB_00BB:
+	MOVEQ	#5,D0			;0a56: 7005
+	RTS				;0a58: 4e75
+	MOVEQ	#6,D0			;0a5a: 7006
+	RTS				;0a5c: 4e75
+sym_2_13:
+	BSR.W	LAB_00D1		;0a5e: 610000a2
+	JSR	-510(A6)		;0a62: 4eaefe02
+LAB_00BD:
+	BRA.S	LAB_00BE		;0a66: 6008
+	ADDQ.W	#1,-(A5)		;0a68: 5265
+	BSR.S	LAB_00CB		;0a6a: 6164
+	DC.W	$792e			;0a6c
+	DC.W	$0000			;0a6e
+LAB_00BE:
+	JSR	-654(A6)		;0a70: 4eaefd72
+LAB_00BF:
+	MOVE.L	9942(A5),D0		;0a74: 202d26d6
+LAB_00C0:
+	DBF	D5,LAB_00BF		;0a78: 51cdfffa
+LAB_00C2:
+	DBF	D0,LAB_00C0		;0a7c: 51c8fffa
+	DBF	D5,LAB_00C2		;0a80: 51cdfffa
+LAB_00C3:
+	BRA.S	LAB_00C7		;0a84: 6012
+LAB_00C4:
+	BEQ.S	LAB_00D0		;0a86: 6772
+	BSR.S	LAB_00D0		;0a88: 6170
+LAB_00C5:
+	DC.W	$6869			;0a8a
+LAB_00C6:
+	DC.W	$6373			;0a8c
+	MOVEA.L	26978(A4),A7		;0a8e: 2e6c6962
+	MOVEQ	#97,D1			;0a92: 7261
+	MOVEQ	#121,D1			;0a94: 7279
+	DC.W	$0000			;0a96
+LAB_00C7:
+	MOVE.W	14305(A5),28878(A5)	;0a98: 3b6d37e170ce
+LAB_00C8:
+	BSR.W	LAB_00DE		;0a9e: 610000fc
+	JSR	LAB_00D4		;0aa2: 4eb900000b34
+sym_2_26:
+	CMPI.L	#$00000051,D5		;0aa8: 0c8500000051
+	ADD.L	D6,D2			;0aae: d486
+	MOVEQ	#42,D5			;0ab0: 7a2a
+	MOVE.L	D1,D3			;0ab2: 2601
+	MOVE.L	#LAB_00BB,-(A7)		;0ab4: 2f3c00000a56
+	MOVE.L	15708(A5),D7		;0aba: 2e2d3d5c
+	ADD.L	D6,D3			;0abe: d686
+	BSR.W	LAB_00D1		;0ac0: 61000040
+	ADD.L	D2,D4			;0ac4: d882
+	CMP.L	#$0000d435,D7		;0ac6: bebc0000d435
+LAB_00CA:
+	BRA.S	LAB_00CC		;0acc: 6008
+	DC.W	$4572			;0ace
+LAB_00CB:
+	MOVEQ	#111,D1			;0ad0: 726f
+	MOVEQ	#58,D1			;0ad2: 723a
+	MOVE.L	D0,D0			;0ad4: 2000
+LAB_00CC:
+	BNE.S	LAB_00CA		;0ad6: 66f4
+	ADDQ.L	#7,A7			;0ad8: 5e8f
+sym_2_39:
+	BNE.S	LAB_00CA		;0ada: 66f0
+	BSR.W	LAB_00D1		;0adc: 61000024
+	ADD.W	D0,D0			;0ae0: d040
+	MOVE.W	LAB_00CE(PC,D0.W),D0	;0ae2: 303b0006
+	JMP	LAB_00CE(PC,D0.W)	;0ae6: 4efb0002
+LAB_00CE:
+	DC.W	$0008			;0aea
+	DC.W	$000c			;0aec
+	ORI.B	#$14,(A0)		;0aee: 00100014
+	MOVEQ	#0,D0			;0af2: 7000
+LAB_00CF:
+	RTS				;0af4: 4e75
+	MOVEQ	#1,D0			;0af6: 7001
+	RTS				;0af8: 4e75
+LAB_00D0:
+	MOVEQ	#2,D0			;0afa: 7002
+	RTS				;0afc: 4e75
+	MOVEQ	#3,D0			;0afe: 7003
+	RTS				;0b00: 4e75
+LAB_00D1:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0b02: 48e73f3e
+	BSR.W	LAB_00D4		;0b06: 6100002c
+	TST.L	D2			;0b0a: 4a82
+	CMP.L	#$0000c9fa,D2		;0b0c: b4bc0000c9fa
+	ADD.W	D0,D0			;0b12: d040
+	MOVE.W	LAB_00D2(PC,D0.W),D0	;0b14: 303b0006
+	JMP	LAB_00D2(PC,D0.W)	;0b18: 4efb0002
+LAB_00D2:
+	DC.W	$0008			;0b1c
+	DC.W	$000c			;0b1e
+	ORI.B	#$14,(A0)		;0b20: 00100014
+	MOVEQ	#0,D0			;0b24: 7000
+	RTS				;0b26: 4e75
+sym_2_52:
+	MOVEQ	#1,D0			;0b28: 7001
+	RTS				;0b2a: 4e75
+	MOVEQ	#2,D0			;0b2c: 7002
+	RTS				;0b2e: 4e75
+	MOVEQ	#3,D0			;0b30: 7003
+	RTS				;0b32: 4e75
+LAB_00D4:
+	BSR.W	LAB_00DE		;0b34: 61000066
+LAB_00D5:
+	BSR.W	LAB_00ED		;0b38: 610000ec
+	DBF	D1,LAB_00D5		;0b3c: 51c9fffa
+LAB_00D6:
+	JSR	LAB_00ED		;0b40: 4eb900000c26
+	BNE.S	LAB_00D6		;0b46: 66f8
+LAB_00D7:
+	BRA.S	LAB_00DA		;0b48: 6012
+LAB_00D8:
+	BEQ.S	LAB_00E2		;0b4a: 6772
+	BSR.S	LAB_00E2		;0b4c: 6170
+	DC.W	$6869			;0b4e
+	DC.W	$6373			;0b50
+	MOVEA.L	26978(A4),A7		;0b52: 2e6c6962
+LAB_00D9:
+	MOVEQ	#97,D1			;0b56: 7261
+	MOVEQ	#121,D1			;0b58: 7279
+	DC.W	$0000			;0b5a
+LAB_00DA:
+	MOVE.W	12729(A5),32666(A5)	;0b5c: 3b6d31b97f9a
+	BNE.S	LAB_00D7		;0b62: 66e4
+LAB_00DB:
+	JSR	LAB_00ED		;0b64: 4eb900000c26
+sym_2_65:
+	DBF	D0,LAB_00DB		;0b6a: 51c8fff8
+	DBF	D6,sym_2_65		;0b6e: 51cefffa
+	BNE.S	LAB_00DB		;0b72: 66f0
+	LEA	LAB_00B9(PC),A2		;0b74: 45fafec8
+LAB_00DD:
+	MOVE.L	27718(A5),D0		;0b78: 202d6c46
+	DBF	D7,LAB_00DD		;0b7c: 51cffffa
+	CMPI.L	#$000000d7,D5		;0b80: 0c85000000d7
+	MOVE.L	#LAB_00B1,-(A7)		;0b86: 2f3c00000856
+	MOVE.L	28254(A5),D5		;0b8c: 2a2d6e5e
+	LEA	LAB_00BD,A0		;0b90: 41f900000a66
+	MOVE.L	5506(A5),D2		;0b96: 242d1582
+	RTS				;0b9a: 4e75
+LAB_00DE:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0b9c: 48e73f3e
+sym_2_78:
+	BSR.W	LAB_00ED		;0ba0: 61000084
+	MOVE.L	D3,D5			;0ba4: 2a03
+	ADD.L	D5,D5			;0ba6: da85
+	BRA.S	LAB_00E1		;0ba8: 6008
+	DC.W	$4572			;0baa
+	MOVEQ	#111,D1			;0bac: 726f
+	MOVEQ	#58,D1			;0bae: 723a
+	MOVE.L	D0,D0			;0bb0: 2000
+LAB_00E1:
+	BRA.S	LAB_00E3		;0bb2: 6012
+	BVS.S	LAB_00EC		;0bb4: 696e
+	MOVEQ	#117,D2			;0bb6: 7475
+	BVS.S	LAB_00EF		;0bb8: 6974
+	DC.W	$696f			;0bba
+	BGT.S	LAB_00E9		;0bbc: 6e2e
+LAB_00E2:
+	DC.W	$6c69			;0bbe
+	BHI.S	LAB_00F0		;0bc0: 6272
+	BSR.S	LAB_00F0+2		;0bc2: 6172
+	DC.W	$7900			;0bc4
+LAB_00E3:
+	ADD.L	D3,D4			;0bc6: d883
+LAB_00E4:
+	BSR.W	LAB_0113		;0bc8: 6100017a
+LAB_00E5:
+	BRA.S	LAB_00E6		;0bcc: 600e
+	DC.W	$4f75			;0bce
+	MOVEQ	#32,D2			;0bd0: 7420
+	BLE.S	LAB_00F2		;0bd2: 6f66
+	MOVEA.L	25965(A5),A0		;0bd4: 206d656d
+	BLE.S	LAB_00F4+2		;0bd8: 6f72
+	DC.W	$7900			;0bda
+LAB_00E6:
+	BRA.S	LAB_00E8		;0bdc: 600c
+	DC.W	$646f			;0bde
+	DC.W	$732e			;0be0
+LAB_00E7:
+	DC.W	$6c69			;0be2
+	BHI.S	LAB_00F6		;0be4: 6272
+	BSR.S	LAB_00F6+2		;0be6: 6172
+	DC.W	$7900			;0be8
+LAB_00E8:
+	ADDQ.L	#3,A6			;0bea: 568e
+LAB_00E9:
+	ADD.W	D0,D0			;0bec: d040
+	MOVE.W	LAB_00EA(PC,D0.W),D0	;0bee: 303b0006
+	JMP	LAB_00EA(PC,D0.W)	;0bf2: 4efb0002
+LAB_00EA:
+	ORI.B	#$14,(A0)		;0bf6: 00100014
+	ORI.B	#$1c,(A0)+		;0bfa: 0018001c
+	ORI.B	#$24,-(A0)		;0bfe: 00200024
+	ORI.B	#$2c,28672(A0)		;0c02: 0028002c7000
+	RTS				;0c08: 4e75
+	MOVEQ	#1,D0			;0c0a: 7001
+	RTS				;0c0c: 4e75
+sym_2_91:
+	MOVEQ	#2,D0			;0c0e: 7002
+	RTS				;0c10: 4e75
+	MOVEQ	#3,D0			;0c12: 7003
+	RTS				;0c14: 4e75
+	MOVEQ	#4,D0			;0c16: 7004
+	RTS				;0c18: 4e75
+	MOVEQ	#5,D0			;0c1a: 7005
+	RTS				;0c1c: 4e75
+	MOVEQ	#6,D0			;0c1e: 7006
+	RTS				;0c20: 4e75
+	MOVEQ	#7,D0			;0c22: 7007
+LAB_00EC:
+	RTS				;0c24: 4e75
+LAB_00ED:
+	BSR.W	LAB_00FF		;0c26: 61000078
+LAB_00EE:
+	DBF	D1,LAB_00ED		;0c2a: 51c9fffa
+LAB_00EF:
+	DBF	D1,LAB_00EE		;0c2e: 51c9fffa
+	MOVEQ	#3,D1			;0c32: 7203
+LAB_00F0:
+	MOVE.L	#LAB_00B0,-(A7)		;0c34: 2f3c0000080a
+LAB_00F2:
+	BNE.S	LAB_00EF		;0c3a: 66f2
+sym_2_104:
+	LEA	LAB_00E4+2(PC),A2	;0c3c: 45faff8c
+	BSR.W	LAB_0113		;0c40: 61000102
+	JSR	LAB_00FF		;0c44: 4eb900000ca0
+LAB_00F4:
+	JSR	-282(A6)		;0c4a: 4eaefee6
+	DBF	D7,LAB_00F4		;0c4e: 51cffffa
+	CMPI.L	#$000000f4,D5		;0c52: 0c85000000f4
+LAB_00F6:
+	JSR	LAB_00FF		;0c58: 4eb900000ca0
+	BSR.W	LAB_00FF		;0c5e: 61000040
+	BSR.W	LAB_00FF		;0c62: 6100003c
+	BSR.W	LAB_00FF		;0c66: 61000038
+LAB_00F8:
+	CMPI.L	#$00000032,D3		;0c6a: 0c8300000032
+LAB_00F9:
+	DBF	D6,LAB_00F8		;0c70: 51cefff8
+	BNE.S	LAB_00F9		;0c74: 66fa
+sym_2_117:
+	BSR.W	LAB_0118		;0c76: 610000fa
+LAB_00FB:
+	BSR.W	LAB_0113		;0c7a: 610000c8
+	BNE.S	LAB_00FB		;0c7e: 66fa
+	MOVEQ	#-79,D0			;0c80: 70b1
+	JSR	-438(A6)		;0c82: 4eaefe4a
+LAB_00FC:
+	JSR	-666(A6)		;0c86: 4eaefd66
+	DBF	D2,LAB_00FC		;0c8a: 51cafffa
+	MOVE.L	D6,D1			;0c8e: 2206
+LAB_00FD:
+	BSR.W	LAB_00FF		;0c90: 6100000e
+	BSR.W	LAB_0118		;0c94: 610000dc
+	BNE.S	LAB_00FD		;0c98: 66f6
+	BNE.S	LAB_00FD		;0c9a: 66f4
+	MOVEQ	#3,D6			;0c9c: 7c03
+sym_2_130:
+	RTS				;0c9e: 4e75
+LAB_00FF:
+	LINK.W	A5,#-216		;0ca0: 4e55ff28
+	BSR.W	LAB_0113		;0ca4: 6100009e
+LAB_0100:
+	BRA.S	LAB_0101		;0ca8: 6012
+	BVS.S	LAB_010A		;0caa: 696e
+	MOVEQ	#117,D2			;0cac: 7475
+	BVS.S	LAB_010C+2		;0cae: 6974
+	DC.W	$696f			;0cb0
+	BGT.S	LAB_0104		;0cb2: 6e2e
+	DC.W	$6c69			;0cb4
+	BHI.S	LAB_010D+2		;0cb6: 6272
+	BSR.S	LAB_010F		;0cb8: 6172
+	DC.W	$7900			;0cba
+LAB_0101:
+	DBF	D6,LAB_0100		;0cbc: 51ceffea
+	MOVE.L	D3,D5			;0cc0: 2a03
+	BSR.W	LAB_0113		;0cc2: 61000080
+	BSR.W	LAB_011E		;0cc6: 61000108
+	ADD.L	D5,D0			;0cca: d085
+	MOVE.W	11158(A5),20033(A5)	;0ccc: 3b6d2b964e41
+LAB_0102:
+	LEA	LAB_00F2(PC),A0		;0cd2: 41faff66
+	LEA	LAB_00D9(PC),A0		;0cd6: 41fafe7e
+	CMPI.L	#$00000035,D1		;0cda: 0c8100000035
+sym_2_143:
+	BRA.S	LAB_0105		;0ce0: 600a
+LAB_0104:
+	SUBQ.W	#3,29291(A7)		;0ce2: 576f726b
+	DC.W	$6265			;0ce6
+	DC.W	$6e63			;0ce8
+	DC.W	$6800			;0cea
+LAB_0105:
+	MOVE.L	#LAB_00DB,-(A7)		;0cec: 2f3c00000b64
+	MOVE.L	32468(A5),D2		;0cf2: 242d7ed4
+LAB_0106:
+	BSR.W	LAB_011E		;0cf6: 610000d8
+LAB_0107:
+	DBF	D3,LAB_0106		;0cfa: 51cbfffa
+	DBF	D6,LAB_0107		;0cfe: 51cefffa
+LAB_0108:
+	ADD.L	D3,D1			;0d02: d283
+LAB_0109:
+	BSR.W	LAB_0118		;0d04: 6100006c
+	DBF	D6,LAB_0109		;0d08: 51cefffa
+	CMP.L	#$00000c12,D5		;0d0c: babc00000c12
+	JSR	-726(A6)		;0d12: 4eaefd2a
+	LEA	LAB_00C8+2(PC),A6	;0d16: 4dfafd88
+LAB_010A:
+	BSR.W	LAB_0113		;0d1a: 61000028
+sym_2_156:
+	DBF	D0,LAB_010A		;0d1e: 51c8fffa
+LAB_010C:
+	DBF	D0,sym_2_156		;0d22: 51c8fffa
+	MOVEQ	#-1,D0			;0d26: 70ff
+LAB_010D:
+	BSR.W	LAB_0113		;0d28: 6100001a
+LAB_010F:
+	DBF	D5,LAB_010D		;0d2c: 51cdfffa
+LAB_0110:
+	LEA	LAB_00DE+2(PC),A4	;0d30: 49fafe6c
+LAB_0111:
+	DBF	D2,LAB_0110		;0d34: 51cafffa
+	LEA	LAB_00E5(PC),A0		;0d38: 41fafe92
+LAB_0112:
+	BNE.S	LAB_0111		;0d3c: 66f6
+	BNE.S	LAB_0112		;0d3e: 66fc
+	UNLK	A5			;0d40: 4e5d
+	RTS				;0d42: 4e75
+LAB_0113:
+	LINK.W	A5,#-100		;0d44: 4e55ff9c
+sym_2_169:
+	BSR.W	LAB_0118		;0d48: 61000028
+	DBF	D0,sym_2_169		;0d4c: 51c8fffa
+LAB_0115:
+	TST.L	D4			;0d50: 4a84
+	BNE.S	LAB_0115		;0d52: 66fc
+	BRA.S	LAB_0116		;0d54: 600c
+	DC.W	$646f			;0d56
+	DC.W	$732e			;0d58
+	DC.W	$6c69			;0d5a
+	BHI.S	LAB_011E		;0d5c: 6272
+	BSR.S	LAB_011E+2		;0d5e: 6172
+	DC.W	$7900			;0d60
+LAB_0116:
+	CMP.L	#$00000261,D1		;0d62: b2bc00000261
+LAB_0117:
+	CMP.L	#$0000ca2e,D0		;0d68: b0bc0000ca2e
+	UNLK	A5			;0d6e: 4e5d
+	RTS				;0d70: 4e75
+LAB_0118:
+	LINK.W	A5,#-160		;0d72: 4e55ff60
+LAB_0119:
+	BSR.W	LAB_011E		;0d76: 61000058
+	DBF	D2,LAB_0119		;0d7a: 51cafffa
+	MOVE.L	D7,D3			;0d7e: 2607
+sym_2_182:
+	MOVE.L	13100(A5),D5		;0d80: 2a2d332c
+	DBF	D5,sym_2_182		;0d84: 51cdfffa
+	BNE.S	sym_2_182		;0d88: 66f6
+	BSR.W	LAB_0126		;0d8a: 6100008a
+LAB_011B:
+	MOVE.L	30506(A5),D1		;0d8e: 222d772a
+	DBF	D2,LAB_011B		;0d92: 51cafffa
+	ADD.W	D0,D0			;0d96: d040
+	MOVE.W	LAB_011C(PC,D0.W),D0	;0d98: 303b0006
+	JMP	LAB_011C(PC,D0.W)	;0d9c: 4efb0002
+LAB_011C:
+	ORI.B	#$14,(A0)		;0da0: 00100014
+	ORI.B	#$1c,(A0)+		;0da4: 0018001c
+	ORI.B	#$24,-(A0)		;0da8: 00200024
+	ORI.B	#$2c,28672(A0)		;0dac: 0028002c7000
+	RTS				;0db2: 4e75
+	MOVEQ	#1,D0			;0db4: 7001
+	RTS				;0db6: 4e75
+	MOVEQ	#2,D0			;0db8: 7002
+	RTS				;0dba: 4e75
+	MOVEQ	#3,D0			;0dbc: 7003
+	RTS				;0dbe: 4e75
+	MOVEQ	#4,D0			;0dc0: 7004
+	RTS				;0dc2: 4e75
+	MOVEQ	#5,D0			;0dc4: 7005
+	RTS				;0dc6: 4e75
+sym_2_195:
+	MOVEQ	#6,D0			;0dc8: 7006
+	RTS				;0dca: 4e75
+	MOVEQ	#7,D0			;0dcc: 7007
+	RTS				;0dce: 4e75
+LAB_011E:
+	LINK.W	A5,#-68			;0dd0: 4e55ffbc
+LAB_0120:
+	BSR.W	LAB_0123		;0dd4: 61000022
+	DBF	D7,LAB_0120		;0dd8: 51cffffa
+	JSR	-210(A6)		;0ddc: 4eaeff2e
+	ADDQ.L	#4,A6			;0de0: 588e
+	LEA	LAB_00DE(PC),A0		;0de2: 41fafdb8
+LAB_0121:
+	BRA.S	LAB_0122		;0de6: 6008
+	ADDQ.W	#1,-(A5)		;0de8: 5265
+	BSR.S	LAB_012B+2		;0dea: 6164
+	DC.W	$792e			;0dec
+	DC.W	$0000			;0dee
+LAB_0122:
+	DBF	D3,LAB_0121		;0df0: 51cbfff4
+	UNLK	A5			;0df4: 4e5d
+	RTS				;0df6: 4e75
+LAB_0123:
+	LINK.W	A5,#-240		;0df8: 4e55ff10
+sym_2_208:
+	BSR.W	LAB_0126		;0dfc: 61000018
+LAB_0125:
+	TST.L	D0			;0e00: 4a80
+	TST.L	D1			;0e02: 4a81
+	BNE.S	LAB_0125		;0e04: 66fa
+	ADD.L	D3,D3			;0e06: d683
+	BSR.W	LAB_0132		;0e08: 61000082
+	BSR.W	LAB_0132		;0e0c: 6100007e
+	MOVE.L	D6,D1			;0e10: 2206
+	UNLK	A5			;0e12: 4e5d
+	RTS				;0e14: 4e75
+LAB_0126:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0e16: 48e73f3e
+	BSR.W	LAB_0132		;0e1a: 61000070
+	BRA.S	sym_2_221		;0e1e: 6018
+	DC.W	$434f			;0e20
+	DC.W	$4e3a			;0e22
+	MOVE.W	12335(A7),D0		;0e24: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;0e28: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0e2c: 3230302f
+	DC.W	$4f75			;0e30
+	MOVEQ	#112,D2			;0e32: 7470
+	DC.W	$7574			;0e34
+	DC.W	$0000			;0e36
+sym_2_221:
+	ADD.L	D3,D5			;0e38: da83
+LAB_0128:
+	LEA	LAB_00E7(PC),A4		;0e3a: 49fafda6
+	DBF	D6,LAB_0128		;0e3e: 51cefffa
+	JSR	-846(A6)		;0e42: 4eaefcb2
+LAB_0129:
+	BNE.S	LAB_0128		;0e46: 66f2
+	BNE.S	LAB_0129		;0e48: 66fc
+LAB_012A:
+	LEA	LAB_0128(PC),A6		;0e4a: 4dfaffee
+LAB_012B:
+	DBF	D6,LAB_012A		;0e4e: 51cefffa
+LAB_012D:
+	DBF	D0,LAB_012B		;0e52: 51c8fffa
+LAB_012E:
+	BNE.S	LAB_012D		;0e56: 66fa
+LAB_012F:
+	DBF	D2,LAB_012E		;0e58: 51cafffc
+	MOVE.L	29724(A5),D3		;0e5c: 262d741c
+	CMPI.L	#$00000083,D1		;0e60: 0c8100000083
+sym_2_234:
+	BNE.S	LAB_012F		;0e66: 66f0
+	DBF	D7,sym_2_234		;0e68: 51cffffc
+	CMP.L	#$0000d296,D2		;0e6c: b4bc0000d296
+	BRA.S	LAB_0131		;0e72: 600c
+	DC.W	$646f			;0e74
+	DC.W	$732e			;0e76
+	DC.W	$6c69			;0e78
+	BHI.S	LAB_013B+4		;0e7a: 6272
+	BSR.S	LAB_013C		;0e7c: 6172
+	DC.W	$7900			;0e7e
+LAB_0131:
+	MOVEQ	#88,D5			;0e80: 7a58
+	DBF	D2,LAB_0131		;0e82: 51cafffc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0e86: 4cdf7cfc
+	RTS				;0e8a: 4e75
+LAB_0132:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0e8c: 48e73f3e
+LAB_0133:
+	BSR.W	LAB_0136		;0e90: 6100002e
+	DBF	D2,LAB_0133		;0e94: 51cafffa
+	CMPI.L	#$000000b0,D6		;0e98: 0c86000000b0
+	ADD.W	D0,D0			;0e9e: d040
+	MOVE.W	LAB_0134(PC,D0.W),D0	;0ea0: 303b0006
+	JMP	LAB_0134(PC,D0.W)	;0ea4: 4efb0002
+LAB_0134:
+	DC.W	$0008			;0ea8
+	DC.W	$000c			;0eaa
+	ORI.B	#$14,(A0)		;0eac: 00100014
+sym_2_247:
+	MOVEQ	#0,D0			;0eb0: 7000
+	RTS				;0eb2: 4e75
+	MOVEQ	#1,D0			;0eb4: 7001
+	RTS				;0eb6: 4e75
+	MOVEQ	#2,D0			;0eb8: 7002
+	RTS				;0eba: 4e75
+	MOVEQ	#3,D0			;0ebc: 7003
+	RTS				;0ebe: 4e75
+LAB_0136:
+	BSR.W	LAB_0143		;0ec0: 61000078
+LAB_0137:
+	JSR	-312(A6)		;0ec4: 4eaefec8
+	DBF	D1,LAB_0137		;0ec8: 51c9fffa
+	BSR.W	sym_2_338		;0ecc: 6100016a
+LAB_0138:
+	MOVE.L	23344(A5),D2		;0ed0: 242d5b30
+	DBF	D3,LAB_0138		;0ed4: 51cbfffa
+	MOVE.L	22500(A5),D4		;0ed8: 282d57e4
+LAB_0139:
+	CMPI.L	#$00000056,D1		;0edc: 0c8100000056
+sym_2_260:
+	MOVE.W	726(A5),9555(A5)	;0ee2: 3b6d02d62553
+	BNE.S	LAB_0139		;0ee8: 66f2
+LAB_013B:
+	CMPI.L	#$00000004,D7		;0eea: 0c8700000004
+LAB_013C:
+	BNE.S	sym_2_260		;0ef0: 66f0
+	CMP.L	#$0000c8ad,D1		;0ef2: b2bc0000c8ad
+	JSR	-228(A6)		;0ef8: 4eaeff1c
+	BSR.W	LAB_0151		;0efc: 610000c2
+	JSR	-456(A6)		;0f00: 4eaefe38
+	MOVE.L	6094(A5),D4		;0f04: 282d17ce
+LAB_013D:
+	MOVE.W	8346(A5),27483(A5)	;0f08: 3b6d209a6b5b
+LAB_013E:
+	DBF	D5,LAB_013D		;0f0e: 51cdfff8
+LAB_013F:
+	DBF	D0,LAB_013E		;0f12: 51c8fffa
+	DBF	D3,LAB_013F		;0f16: 51cbfffa
+sym_2_273:
+	MOVE.L	D7,D6			;0f1a: 2c07
+LAB_0141:
+	MOVE.L	D6,D2			;0f1c: 2406
+	MOVE.L	D3,D1			;0f1e: 2203
+	BNE.S	LAB_0141		;0f20: 66fa
+	BRA.S	LAB_0142		;0f22: 6012
+	BEQ.S	LAB_014B+2		;0f24: 6772
+	BSR.S	LAB_014B+2		;0f26: 6170
+	DC.W	$6869			;0f28
+	DC.W	$6373			;0f2a
+	MOVEA.L	26978(A4),A7		;0f2c: 2e6c6962
+	MOVEQ	#97,D1			;0f30: 7261
+	MOVEQ	#121,D1			;0f32: 7279
+	DC.W	$0000			;0f34
+LAB_0142:
+	ADD.L	D0,D2			;0f36: d480
+	RTS				;0f38: 4e75
+LAB_0143:
+	BSR.W	LAB_0151		;0f3a: 61000084
+	MOVEQ	#82,D1			;0f3e: 7252
+	BSR.W	LAB_0161		;0f40: 6100011a
+LAB_0144:
+	MOVE.L	D7,D4			;0f44: 2807
+	DBF	D1,LAB_0144		;0f46: 51c9fffc
+sym_2_286:
+	BSR.W	LAB_0151		;0f4a: 61000074
+	BNE.S	LAB_0144		;0f4e: 66f4
+	BSR.W	LAB_0161		;0f50: 6100010a
+	MOVE.L	D1,D7			;0f54: 2e01
+	JSR	-498(A6)		;0f56: 4eaefe0e
+	BSR.W	LAB_0161		;0f5a: 61000100
+	BSR.W	LAB_0151		;0f5e: 61000060
+LAB_0146:
+	MOVEQ	#36,D6			;0f62: 7c24
+	ADD.L	D1,D6			;0f64: dc81
+	LEA	LAB_00B4,A2		;0f66: 45f9000009fc
+	BNE.S	LAB_0146		;0f6c: 66f4
+LAB_0147:
+	BSR.W	LAB_0161		;0f6e: 610000ec
+	MOVE.L	D2,D0			;0f72: 2002
+sym_2_299:
+	BNE.S	LAB_0147		;0f74: 66f8
+	ADD.L	D7,D2			;0f76: d487
+	MOVE.L	27712(A5),D4		;0f78: 282d6c40
+	MOVE.L	D1,D1			;0f7c: 2201
+	BRA.S	LAB_0149		;0f7e: 6008
+	ADDQ.W	#1,-(A5)		;0f80: 5265
+	BSR.S	LAB_0155		;0f82: 6164
+	DC.W	$792e			;0f84
+	DC.W	$0000			;0f86
+LAB_0149:
+	BRA.S	LAB_014A		;0f88: 6008
+	DC.W	$4572			;0f8a
+	MOVEQ	#111,D1			;0f8c: 726f
+	MOVEQ	#58,D1			;0f8e: 723a
+	MOVE.L	D0,D0			;0f90: 2000
+LAB_014A:
+	DBF	D5,LAB_0149		;0f92: 51cdfff4
+LAB_014B:
+	BSR.W	sym_2_338		;0f96: 610000a0
+	CMPI.L	#$0000001f,D0		;0f9a: 0c800000001f
+LAB_014C:
+	LEA	LAB_0108(PC),A6		;0fa0: 4dfafd60
+LAB_014D:
+	DBF	D6,LAB_014C		;0fa4: 51cefffa
+	ADDQ.L	#7,A2			;0fa8: 5e8a
+	BNE.S	LAB_014D		;0faa: 66f8
+sym_2_312:
+	MOVE.L	D6,D1			;0fac: 2206
+LAB_014F:
+	DBF	D1,sym_2_312		;0fae: 51c9fffc
+	DBF	D3,LAB_014F		;0fb2: 51cbfffa
+LAB_0150:
+	JSR	-342(A6)		;0fb6: 4eaefeaa
+	DBF	D5,LAB_0150		;0fba: 51cdfffa
+	RTS				;0fbe: 4e75
+LAB_0151:
+	LINK.W	A5,#-156		;0fc0: 4e55ff64
+	BSR.W	sym_2_338		;0fc4: 61000072
+LAB_0152:
+	LEA	LAB_0117+2(PC),A2	;0fc8: 45fafda0
+LAB_0153:
+	MOVEQ	#95,D7			;0fcc: 7e5f
+	BNE.S	LAB_0152		;0fce: 66f8
+	BNE.S	LAB_0153		;0fd0: 66fa
+	LEA	LAB_0102(PC),A2		;0fd2: 45fafcfe
+sym_2_325:
+	BRA.S	LAB_0156		;0fd6: 6012
+	BVS.S	LAB_015C+2		;0fd8: 696e
+	MOVEQ	#117,D2			;0fda: 7475
+	BVS.S	LAB_015E		;0fdc: 6974
+	DC.W	$696f			;0fde
+	BGT.S	LAB_0159		;0fe0: 6e2e
+	DC.W	$6c69			;0fe2
+	BHI.S	LAB_015F		;0fe4: 6272
+	BSR.S	LAB_0160		;0fe6: 6172
+LAB_0155:
+	DC.W	$7900			;0fe8
+LAB_0156:
+	BRA.S	LAB_0157		;0fea: 600a
+	DC.W	$2573			;0fec
+	MOVE.W	-(A0),D5		;0fee: 3a20
+	MOVE.L	25610(A4),0(A2)		;0ff0: 256c640a0000
+LAB_0157:
+	CMPI.L	#$0000009c,D6		;0ff6: 0c860000009c
+LAB_0158:
+	MOVE.L	20020(A5),D7		;0ffc: 2e2d4e34
+	DBF	D4,LAB_0158		;1000: 51ccfffa
+	CMPI.L	#$000000a5,D5		;1004: 0c85000000a5
+	CMPI.L	#$000000ca,D5		;100a: 0c85000000ca
+LAB_0159:
+	ADD.W	D0,D0			;1010: d040
+	MOVE.W	LAB_015A(PC,D0.W),D0	;1012: 303b0006
+	JMP	LAB_015A(PC,D0.W)	;1016: 4efb0002
+LAB_015A:
+	DC.W	$000a			;101a
+	DC.W	$000e			;101c
+	ORI.B	#$16,(A2)		;101e: 00120016
+	DC.W	$001a			;1022
+	MOVEQ	#0,D0			;1024: 7000
+	RTS				;1026: 4e75
+	MOVEQ	#1,D0			;1028: 7001
+	RTS				;102a: 4e75
+	MOVEQ	#2,D0			;102c: 7002
+	RTS				;102e: 4e75
+	MOVEQ	#3,D0			;1030: 7003
+	RTS				;1032: 4e75
+	MOVEQ	#4,D0			;1034: 7004
+	RTS				;1036: 4e75
+sym_2_338:
+	LINK.W	A5,#-140		;1038: 4e55ff74
+	BSR.W	LAB_0161		;103c: 6100001e
+	ADD.W	D0,D0			;1040: d040
+	MOVE.W	LAB_015D(PC,D0.W),D0	;1042: 303b0006
+LAB_015C:
+	JMP	LAB_015D(PC,D0.W)	;1046: 4efb0002
+LAB_015D:
+	ORI.B	#$0a,D6			;104a: 0006000a
+	DC.W	$000e			;104e
+	MOVEQ	#0,D0			;1050: 7000
+LAB_015E:
+	RTS				;1052: 4e75
+	MOVEQ	#1,D0			;1054: 7001
+	RTS				;1056: 4e75
+LAB_015F:
+	MOVEQ	#2,D0			;1058: 7002
+LAB_0160:
+	RTS				;105a: 4e75
+LAB_0161:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;105c: 48e73f3e
+	BSR.W	LAB_0164		;1060: 6100003c
+	ADD.W	D0,D0			;1064: d040
+	MOVE.W	LAB_0162(PC,D0.W),D0	;1066: 303b0006
+	JMP	LAB_0162(PC,D0.W)	;106a: 4efb0002
+LAB_0162:
+	ORI.B	#$14,(A0)		;106e: 00100014
+	ORI.B	#$1c,(A0)+		;1072: 0018001c
+	ORI.B	#$24,-(A0)		;1076: 00200024
+	ORI.B	#$2c,28672(A0)		;107a: 0028002c7000
+	RTS				;1080: 4e75
+	MOVEQ	#1,D0			;1082: 7001
+	RTS				;1084: 4e75
+	MOVEQ	#2,D0			;1086: 7002
+	RTS				;1088: 4e75
+	MOVEQ	#3,D0			;108a: 7003
+	RTS				;108c: 4e75
+sym_2_351:
+	MOVEQ	#4,D0			;108e: 7004
+	RTS				;1090: 4e75
+	MOVEQ	#5,D0			;1092: 7005
+	RTS				;1094: 4e75
+	MOVEQ	#6,D0			;1096: 7006
+	RTS				;1098: 4e75
+	MOVEQ	#7,D0			;109a: 7007
+	RTS				;109c: 4e75
+LAB_0164:
+	BSR.W	LAB_016C		;109e: 61000062
+	BRA.S	LAB_0165		;10a2: 600e
+	DC.W	$4f75			;10a4
+	MOVEQ	#32,D2			;10a6: 7420
+	BLE.S	LAB_016E		;10a8: 6f66
+	MOVEA.L	25965(A5),A0		;10aa: 206d656d
+	BLE.S	LAB_0170+2		;10ae: 6f72
+	DC.W	$7900			;10b0
+LAB_0165:
+	BSR.W	LAB_016C		;10b2: 6100004e
+LAB_0166:
+	BSR.W	LAB_0172		;10b6: 6100007c
+	BNE.S	LAB_0166		;10ba: 66fa
+	BSR.W	LAB_016C		;10bc: 61000044
+	JSR	LAB_016C		;10c0: 4eb900001102
+	MOVE.W	15358(A5),15625(A5)	;10c6: 3b6d3bfe3d09
+sym_2_364:
+	BRA.S	LAB_0168		;10cc: 600a
+	SUBQ.W	#3,29291(A7)		;10ce: 576f726b
+	DC.W	$6265			;10d2
+	DC.W	$6e63			;10d4
+	DC.W	$6800			;10d6
+LAB_0168:
+	JSR	-162(A6)		;10d8: 4eaeff5e
+	DBF	D6,LAB_0168		;10dc: 51cefffa
+LAB_0169:
+	BSR.W	LAB_0172		;10e0: 61000052
+	DBF	D4,LAB_0169		;10e4: 51ccfffa
+	BRA.S	LAB_016A		;10e8: 600e
+	DC.W	$4f75			;10ea
+	MOVEQ	#32,D2			;10ec: 7420
+	BLE.S	LAB_0176		;10ee: 6f66
+	MOVEA.L	25965(A5),A0		;10f0: 206d656d
+	BLE.S	LAB_0178		;10f4: 6f72
+	DC.W	$7900			;10f6
+LAB_016A:
+	MOVEQ	#83,D7			;10f8: 7e53
+LAB_016B:
+	MOVE.L	D6,D2			;10fa: 2406
+	JSR	-114(A6)		;10fc: 4eaeff8e
+	RTS				;1100: 4e75
+LAB_016C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;1102: 48e73f3e
+	BSR.W	LAB_0172		;1106: 6100002c
+	BSR.W	LAB_017A		;110a: 6100006c
+sym_2_377:
+	BRA.S	LAB_016F		;110e: 600a
+LAB_016E:
+	DC.W	$2573			;1110
+	MOVE.W	-(A0),D5		;1112: 3a20
+	MOVE.L	25610(A4),0(A2)		;1114: 256c640a0000
+LAB_016F:
+	LEA	LAB_00CF(PC),A0		;111a: 41faf9d8
+	MOVE.L	D1,D2			;111e: 2401
+LAB_0170:
+	BSR.W	LAB_0184		;1120: 610000a0
+	MOVEQ	#-9,D7			;1124: 7ef7
+LAB_0171:
+	BSR.W	LAB_0184		;1126: 6100009a
+	DBF	D6,LAB_0171		;112a: 51cefffa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;112e: 4cdf7cfc
+	RTS				;1132: 4e75
+LAB_0172:
+	LINK.W	A5,#-132		;1134: 4e55ff7c
+	BSR.W	LAB_017A		;1138: 6100003e
+	ADD.L	D5,D0			;113c: d085
+	MOVEQ	#-79,D5			;113e: 7ab1
+sym_2_390:
+	JSR	LAB_0184		;1140: 4eb9000011c2
+	BSR.W	LAB_017A		;1146: 61000030
+LAB_0174:
+	ADD.L	D5,D0			;114a: d085
+	BNE.S	LAB_0174		;114c: 66fc
+LAB_0175:
+	LEA	LAB_0003+2,A0		;114e: 41f900000038
+	BRA.S	LAB_0177		;1154: 600a
+LAB_0176:
+	SUBQ.W	#3,29291(A7)		;1156: 576f726b
+	DC.W	$6265			;115a
+	DC.W	$6e63			;115c
+	DC.W	$6800			;115e
+LAB_0177:
+	ADD.L	D3,D7			;1160: de83
+	BNE.S	LAB_0175		;1162: 66ea
+	LEA	LAB_016B(PC),A2		;1164: 45faff94
+LAB_0178:
+	BSR.W	LAB_0184		;1168: 61000058
+	MOVEQ	#24,D0			;116c: 7018
+	CMP.L	#$0000594c,D4		;116e: b8bc0000594c
+	UNLK	A5			;1174: 4e5d
+sym_2_403:
+	RTS				;1176: 4e75
+LAB_017A:
+	BSR.W	LAB_0184		;1178: 61000048
+	ADDQ.L	#3,A3			;117c: 568b
+LAB_017B:
+	MOVE.L	25972(A5),D2		;117e: 242d6574
+LAB_017C:
+	DBF	D7,LAB_017B		;1182: 51cffffa
+LAB_017D:
+	DBF	D1,LAB_017C		;1186: 51c9fffa
+	DBF	D1,LAB_017D		;118a: 51c9fffa
+	BSR.W	LAB_0184		;118e: 61000032
+LAB_017E:
+	MOVE.W	20575(A5),13887(A5)	;1192: 3b6d505f363f
+LAB_017F:
+	DBF	D3,LAB_017E		;1198: 51cbfff8
+	MOVE.L	232(A5),D7		;119c: 2e2d00e8
+LAB_0180:
+	MOVE.L	14478(A5),D7		;11a0: 2e2d388e
+sym_2_416:
+	BNE.S	LAB_017F		;11a4: 66f2
+	BNE.S	LAB_0180		;11a6: 66f8
+	BSR.W	LAB_0184		;11a8: 61000018
+	MOVE.L	D5,D5			;11ac: 2a05
+	MOVE.L	1802(A5),D4		;11ae: 282d070a
+LAB_0182:
+	MOVE.L	D0,D7			;11b2: 2e00
+	DBF	D1,LAB_0182		;11b4: 51c9fffc
+LAB_0183:
+	BSR.W	LAB_0184		;11b8: 61000008
+	DBF	D5,LAB_0183		;11bc: 51cdfffa
+	RTS				;11c0: 4e75
+LAB_0184:
+	NOP				;11c2: 4e71
+	NOP				;11c4: 4e71
+	NOP				;11c6: 4e71
+	NOP				;11c8: 4e71
+	NOP				;11ca: 4e71
+	NOP				;11cc: 4e71
+	NOP				;11ce: 4e71
+	NOP				;11d0: 4e71
+	NOP				;11d2: 4e71
+	NOP				;11d4: 4e71
+	NOP				;11d6: 4e71
+	NOP				;11d8: 4e71
+	NOP				;11da: 4e71
+	NOP				;11dc: 4e71
+	NOP				;11de: 4e71
+	NOP				;11e0: 4e71
+	NOP				;11e2: 4e71
+	NOP				;11e4: 4e71
+	NOP				;11e6: 4e71
+	NOP				;11e8: 4e71
+	NOP				;11ea: 4e71
+	NOP				;11ec: 4e71
+	NOP				;11ee: 4e71
+	NOP				;11f0: 4e71
+	NOP				;11f2: 4e71
+	NOP				;11f4: 4e71
+	NOP				;11f6: 4e71
+	NOP				;11f8: 4e71
+	NOP				;11fa: 4e71
+	NOP				;11fc: 4e71
+	RTS				;11fe: 4e75
+
+
+	SECTION S_3,BSS
+
+SECSTRT_3:
+	DS.L	512			;1200
+	END
@@ -0,0 +1,1434 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+
+
+	SECTION S_0,CODE
+
+sym_0_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0000: 48e73f3e
+	BSR.W	LAB_0005		;0004: 61000054
+	LEA	sym_0_0(PC),A0		;0008: 41fafff6
+	TST.L	D5			;000c: 4a85
+	MOVE.L	#LAB_0033+2,-(A7)	;000e: 2f3c000002bc
+LAB_0001:
+	MOVE.L	25452(A5),D6		;0014: 2c2d636c
+	MOVEQ	#-35,D6			;0018: 7cdd
+	BSR.W	LAB_0017		;001a: 6100010a
+	BNE.S	LAB_0001		;001e: 66f4
+	ADD.W	D0,D0			;0020: d040
+	MOVE.W	LAB_0002(PC,D0.W),D0	;0022: 303b0006
+	JMP	LAB_0002(PC,D0.W)	;0026: 4efb0002
+LAB_0002:
+	DC.L	$00100014,$0018001c,$00200024 ;002a
+	DC.W	$0028			;0036
+LAB_0003:
+	DC.L	$002c7000,$4e757001,$4e757002 ;0038
+	DC.W	$4e75			;0044
+sym_0_13:
+	DC.L	$70034e75,$70044e75,$70054e75,$70064e75 ;0046
+	DC.L	$70074e75		;0056
+LAB_0005:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;005a: 48e73f3e
+	BSR.W	sym_0_39		;005e: 61000062
+	BSR.W	LAB_0019		;0062: 610000e8
+LAB_0006:
+	BSR.W	LAB_0019		;0066: 610000e4
+	DBF	D7,LAB_0006		;006a: 51cffffa
+	CMP.L	#$0000caa7,D3		;006e: b6bc0000caa7
+	JSR	-858(A6)		;0074: 4eaefca6
+	MOVEQ	#51,D3			;0078: 7633
+sym_0_26:
+	MOVEQ	#-89,D6			;007a: 7ca7
+	MOVE.W	23344(A5),21638(A5)	;007c: 3b6d5b305486
+	BRA.S	LAB_0008		;0082: 6018
+	;0084
+	;DC.B	$43,$4f,$4e,$3a,$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f
+	;DC.B	$4f,$75,$74,$70,$75,$74,$00,$00
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_0008:
+	MOVE.L	D6,D4			;009c: 2806
+	DBF	D1,LAB_0008		;009e: 51c9fffc
+	BNE.S	LAB_0008		;00a2: 66f8
+	CMP.L	#$0000beee,D3		;00a4: b6bc0000beee
+LAB_0009:
+	CMP.L	#$00002a71,D3		;00aa: b6bc00002a71
+LAB_000A:
+	DBF	D5,LAB_0009		;00b0: 51cdfff8
+	BNE.S	LAB_000A		;00b4: 66fa
+	MOVE.W	31148(A5),30047(A5)	;00b6: 3b6d79ac755f
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;00bc: 4cdf7cfc
+	RTS				;00c0: 4e75
+sym_0_39:
+	BSR.W	LAB_0017		;00c2: 61000062
+	MOVE.L	D5,D7			;00c6: 2e05
+	MOVE.W	28102(A5),30109(A5)	;00c8: 3b6d6dc6759d
+	BSR.W	LAB_001E		;00ce: 610000e0
+	ADDQ.L	#6,A3			;00d2: 5c8b
+	JSR	-636(A6)		;00d4: 4eaefd84
+LAB_000C:
+	BSR.W	LAB_001E		;00d8: 610000d6
+LAB_000D:
+	BNE.S	LAB_000C		;00dc: 66fa
+	JSR	-390(A6)		;00de: 4eaefe7a
+LAB_000E:
+	BNE.S	LAB_000D		;00e2: 66f8
+	DBF	D0,LAB_000E		;00e4: 51c8fffc
+	BNE.S	LAB_000E		;00e8: 66f8
+sym_0_52:
+	MOVEQ	#57,D2			;00ea: 7439
+LAB_0010:
+	BSR.W	LAB_001E		;00ec: 610000c2
+	DBF	D5,LAB_0010		;00f0: 51cdfffa
+	CMPI.L	#$000000fb,D3		;00f4: 0c83000000fb
+	BRA.S	LAB_0011		;00fa: 600c
+	;00fc
+	;DC.B	$64,$6f,$73,$2e,$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"dos.library",0
+LAB_0011:
+	ADD.L	D3,D7			;0108: de83
+	LEA	sym_0_0(PC),A6		;010a: 4dfafef4
+	MOVEQ	#-112,D7		;010e: 7e90
+LAB_0012:
+	BSR.W	LAB_001E		;0110: 6100009e
+LAB_0013:
+	MOVE.L	23448(A5),D0		;0114: 202d5b98
+LAB_0014:
+	JSR	-888(A6)		;0118: 4eaefc88
+	BNE.S	LAB_0012		;011c: 66f2
+LAB_0015:
+	BNE.S	LAB_0013		;011e: 66f4
+sym_0_65:
+	DBF	D4,LAB_0015		;0120: 51ccfffc
+	RTS				;0124: 4e75
+LAB_0017:
+	BSR.W	LAB_0019		;0126: 61000024
+	JSR	LAB_002B		;012a: 4eb900000266
+	ADD.W	D0,D0			;0130: d040
+	MOVE.W	LAB_0018(PC,D0.W),D0	;0132: 303b0006
+	JMP	LAB_0018(PC,D0.W)	;0136: 4efb0002
+LAB_0018:
+	DC.L	$0006000a,$000e7000,$4e757001,$4e757002 ;013a
+	DC.W	$4e75			;014a
+LAB_0019:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;014c: 48e73f3e
+	BSR.W	LAB_001E		;0150: 6100005e
+	BRA.S	LAB_001A		;0154: 600a
+	;0156
+	;DC.B	$25,$73,$3a,$20,$25,$6c,$64,$0a,$00,$00
+	DC.B	"%s: %ld",10,0,0
+LAB_001A:
+	MOVE.W	27718(A5),542(A5)	;0160: 3b6d6c46021e
+sym_0_78:
+	BRA.S	LAB_001C		;0166: 6012
+	;0168
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_001C:
+	ADD.L	D3,D2			;017a: d483
+	ADD.W	D0,D0			;017c: d040
+	MOVE.W	LAB_001D(PC,D0.W),D0	;017e: 303b0006
+	JMP	LAB_001D(PC,D0.W)	;0182: 4efb0002
+LAB_001D:
+	DC.L	$000e0012,$0016001a,$001e0022,$00267000 ;0186
+	DC.L	$4e757001,$4e757002,$4e757003,$4e757004 ;0196
+	DC.L	$4e757005,$4e757006	;01a6
+	DC.W	$4e75			;01ae
+LAB_001E:
+	LINK.W	A5,#-248		;01b0: 4e55ff08
+	BSR.W	LAB_002B		;01b4: 610000b0
+LAB_0020:
+	TST.L	D3			;01b8: 4a83
+sym_0_91:
+	MOVE.L	#LAB_0099,-(A7)		;01ba: 2f3c000009ae
+	ADD.L	D3,D6			;01c0: dc83
+	JSR	LAB_002B		;01c2: 4eb900000266
+	BNE.S	sym_0_91		;01c8: 66f0
+LAB_0022:
+	CMPI.L	#$0000002e,D6		;01ca: 0c860000002e
+	BNE.S	LAB_0022		;01d0: 66f8
+	ADD.L	D0,D5			;01d2: da80
+	LEA	LAB_0020(PC),A2		;01d4: 45faffe2
+	BSR.W	LAB_002B		;01d8: 6100008c
+	MOVE.L	D3,D1			;01dc: 2203
+	MOVEQ	#-84,D0			;01de: 70ac
+LAB_0023:
+	ADDQ.L	#6,A3			;01e0: 5c8b
+	DBF	D0,LAB_0023		;01e2: 51c8fffc
+sym_0_104:
+	BRA.S	LAB_0025		;01e6: 6018
+	;01e8
+	;DC.B	$43,$4f,$4e,$3a,$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f
+	;DC.B	$4f,$75,$74,$70,$75,$74,$00,$00
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_0025:
+	ADDQ.L	#1,A2			;0200: 528a
+	MOVE.L	#LAB_0098,-(A7)		;0202: 2f3c000009a4
+LAB_0026:
+	BSR.W	LAB_002B		;0208: 6100005c
+	ADD.L	D6,D5			;020c: da86
+	BNE.S	LAB_0026		;020e: 66f8
+	JSR	-888(A6)		;0210: 4eaefc88
+	ADDQ.L	#4,A1			;0214: 5889
+	BRA.S	LAB_0027		;0216: 6012
+	;0218
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62,$72,$61,$72,$79
+	;DC.B	$00,$00
+	DC.B	"graphics.library",0,0
+LAB_0027:
+	BRA.S	LAB_0028		;022a: 6012
+	;022c
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_0028:
+	BSR.W	LAB_0038		;023e: 610000d8
+	ADDQ.L	#3,A7			;0242: 568f
+	ADD.W	D0,D0			;0244: d040
+	MOVE.W	LAB_0029(PC,D0.W),D0	;0246: 303b0006
+	JMP	LAB_0029(PC,D0.W)	;024a: 4efb0002
+LAB_0029:
+	DC.L	$0008000c,$00100014	;024e
+sym_0_117:
+	DC.L	$70004e75,$70014e75,$70024e75,$70034e75 ;0256
+LAB_002B:
+	BSR.W	LAB_0035		;0266: 6100007a
+	DBF	D3,LAB_002B		;026a: 51cbfffa
+	TST.L	D5			;026e: 4a85
+	BSR.W	LAB_0044		;0270: 61000144
+	LEA	LAB_0014+2(PC),A2	;0274: 45fafea4
+	JSR	-498(A6)		;0278: 4eaefe0e
+LAB_002C:
+	CMP.L	#$0000a5f1,D6		;027c: bcbc0000a5f1
+	CMPI.L	#$000000d2,D6		;0282: 0c86000000d2
+sym_0_130:
+	BSR.W	LAB_0038		;0288: 6100008e
+	BNE.S	LAB_002C		;028c: 66ee
+	MOVE.L	D3,D1			;028e: 2203
+LAB_002E:
+	MOVE.W	32203(A5),12016(A5)	;0290: 3b6d7dcb2ef0
+LAB_002F:
+	MOVE.L	D2,D1			;0296: 2202
+	BNE.S	LAB_002F		;0298: 66fc
+LAB_0030:
+	BNE.S	LAB_002E		;029a: 66f4
+	CMP.L	#$00009df4,D1		;029c: b2bc00009df4
+	BNE.S	LAB_0030		;02a2: 66f6
+LAB_0031:
+	BSR.W	LAB_0035		;02a4: 6100003c
+	DBF	D1,LAB_0031		;02a8: 51c9fffa
+	MOVE.L	D4,D1			;02ac: 2204
+	CMP.L	#$0000d7d5,D5		;02ae: babc0000d7d5
+sym_0_143:
+	ADD.W	D0,D0			;02b4: d040
+	MOVE.W	LAB_0034(PC,D0.W),D0	;02b6: 303b0006
+LAB_0033:
+	JMP	LAB_0034(PC,D0.W)	;02ba: 4efb0002
+LAB_0034:
+	DC.L	$000c0010,$00140018,$001c0020,$70004e75 ;02be
+	DC.L	$70014e75,$70024e75,$70034e75,$70044e75 ;02ce
+	DC.L	$70054e75		;02de
+LAB_0035:
+	LINK.W	A5,#-252		;02e2: 4e55ff04
+	BSR.W	LAB_0038		;02e6: 61000030
+	ADD.W	D0,D0			;02ea: d040
+	MOVE.W	LAB_0036(PC,D0.W),D0	;02ec: 303b0006
+	JMP	LAB_0036(PC,D0.W)	;02f0: 4efb0002
+LAB_0036:
+	DC.L	$000c0010,$00140018,$001c0020,$70004e75 ;02f4
+	DC.L	$70014e75,$70024e75	;0304
+sym_0_156:
+	DC.L	$70034e75,$70044e75,$70054e75 ;030c
+LAB_0038:
+	BSR.W	LAB_0044		;0318: 6100009c
+	MOVE.L	D4,D3			;031c: 2604
+	ADDQ.L	#5,A3			;031e: 5a8b
+LAB_0039:
+	CMP.L	#$00003c83,D2		;0320: b4bc00003c83
+	BNE.S	LAB_0039		;0326: 66f8
+	BNE.S	LAB_0039		;0328: 66f6
+	JSR	-498(A6)		;032a: 4eaefe0e
+LAB_003A:
+	JSR	-858(A6)		;032e: 4eaefca6
+	DBF	D0,LAB_003A		;0332: 51c8fffa
+sym_0_169:
+	BSR.W	LAB_005A		;0336: 6100017c
+	ADD.L	D3,D1			;033a: d283
+LAB_003C:
+	MOVE.L	15060(A5),D4		;033c: 282d3ad4
+	DBF	D0,LAB_003C		;0340: 51c8fffa
+	MOVE.L	D6,D4			;0344: 2806
+	BRA.S	LAB_003D		;0346: 6018
+	;0348
+	;DC.B	$43,$4f,$4e,$3a,$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f
+	;DC.B	$4f,$75,$74,$70,$75,$74,$00,$00
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_003D:
+	MOVEQ	#-37,D6			;0360: 7cdb
+	MOVE.L	#LAB_00B6,-(A7)		;0362: 2f3c00000b4a
+LAB_003E:
+	BSR.W	sym_0_221		;0368: 610000b0
+	BSR.W	LAB_0044		;036c: 61000048
+LAB_003F:
+	BRA.S	LAB_0040		;0370: 600a
+	;0372
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_0040:
+	BNE.S	LAB_003E		;037c: 66ea
+	MOVE.W	22745(A5),7208(A5)	;037e: 3b6d58d91c28
+sym_0_182:
+	CMPI.L	#$00000015,D3		;0384: 0c8300000015
+	CMP.L	#$0000fa92,D3		;038a: b6bc0000fa92
+	BNE.S	sym_0_182		;0390: 66f2
+LAB_0042:
+	BSR.W	LAB_005A		;0392: 61000120
+	DBF	D3,LAB_0042		;0396: 51cbfffa
+	ADD.L	D2,D3			;039a: d682
+	BRA.S	LAB_0043		;039c: 600a
+	;039e
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_0043:
+	MOVEQ	#112,D6			;03a8: 7c70
+	CMPI.L	#$0000003f,D3		;03aa: 0c830000003f
+	BSR.W	LAB_0044		;03b0: 61000004
+	RTS				;03b4: 4e75
+LAB_0044:
+	LINK.W	A5,#-100		;03b6: 4e55ff9c
+	BSR.W	sym_0_221		;03ba: 6100005e
+sym_0_195:
+	BSR.W	LAB_005A		;03be: 610000f4
+LAB_0046:
+	DBF	D1,sym_0_195		;03c2: 51c9fffa
+	BNE.S	LAB_0046		;03c6: 66fa
+	BNE.S	sym_0_195		;03c8: 66f4
+	MOVE.L	D5,D1			;03ca: 2205
+LAB_0047:
+	CMPI.L	#$000000d6,D4		;03cc: 0c84000000d6
+	BSR.W	LAB_005A		;03d2: 610000e0
+	BSR.W	LAB_005A		;03d6: 610000dc
+	BNE.S	LAB_0047		;03da: 66f0
+LAB_0048:
+	MOVE.L	7416(A5),D6		;03dc: 2c2d1cf8
+LAB_0049:
+	ADDQ.L	#2,A5			;03e0: 548d
+	DBF	D0,LAB_0049		;03e2: 51c8fffc
+	BNE.S	LAB_0048		;03e6: 66f4
+sym_0_208:
+	MOVE.W	24928(A5),31906(A5)	;03e8: 3b6d61607ca2
+	CMP.L	#$0000c795,D5		;03ee: babc0000c795
+	JSR	-816(A6)		;03f4: 4eaefcd0
+	BNE.S	sym_0_208		;03f8: 66ee
+LAB_004B:
+	BRA.S	LAB_004C		;03fa: 6008
+	;03fc
+	;DC.B	$45,$72,$72,$6f,$72,$3a,$20,$00
+	DC.B	"Error: ",0
+LAB_004C:
+	DBF	D4,LAB_004B		;0404: 51ccfff4
+	MOVE.L	D3,D4			;0408: 2803
+	ADDQ.L	#6,A7			;040a: 5c8f
+	ADD.L	D5,D6			;040c: dc85
+	BSR.W	sym_0_221		;040e: 6100000a
+	BSR.W	LAB_0060		;0412: 610000c8
+	UNLK	A5			;0416: 4e5d
+	RTS				;0418: 4e75
+sym_0_221:
+	BSR.W	LAB_005A		;041a: 61000098
+LAB_004E:
+	DBF	D3,sym_0_221		;041e: 51cbfffa
+	CMP.L	#$0000bf49,D3		;0422: b6bc0000bf49
+	BNE.S	LAB_004E		;0428: 66f4
+LAB_004F:
+	BRA.S	LAB_0050		;042a: 6012
+	;042c
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_0050:
+	DBF	D3,LAB_004F		;043e: 51cbffea
+	DBF	D4,LAB_0050		;0442: 51ccfffa
+	BSR.W	LAB_005A		;0446: 6100006c
+LAB_0051:
+	BRA.S	LAB_0052		;044a: 6012
+	;044c
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_0052:
+	DBF	D7,LAB_0051		;045e: 51cfffea
+LAB_0053:
+	LEA	LAB_003F(PC),A0		;0462: 41faff0c
+	DBF	D0,LAB_0053		;0466: 51c8fffa
+sym_0_234:
+	MOVE.L	D6,D3			;046a: 2606
+LAB_0055:
+	ADD.L	D6,D5			;046c: da86
+	DBF	D6,LAB_0055		;046e: 51cefffc
+LAB_0056:
+	BSR.W	LAB_0060		;0472: 61000068
+	DBF	D4,LAB_0056		;0476: 51ccfffa
+	ADDQ.L	#4,A0			;047a: 5888
+	ADDQ.L	#7,A5			;047c: 5e8d
+LAB_0057:
+	CMP.L	#$0000735f,D6		;047e: bcbc0000735f
+	BNE.S	LAB_0057		;0484: 66f8
+	ADD.W	D0,D0			;0486: d040
+	MOVE.W	LAB_0058(PC,D0.W),D0	;0488: 303b0006
+	JMP	LAB_0058(PC,D0.W)	;048c: 4efb0002
+LAB_0058:
+	DC.L	$000c0010,$00140018,$001c0020,$70004e75 ;0490
+	DC.L	$70014e75,$70024e75	;04a0
+sym_0_247:
+	DC.L	$70034e75,$70044e75,$70054e75 ;04a8
+LAB_005A:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;04b4: 48e73f3e
+	BSR.W	LAB_0060		;04b8: 61000022
+LAB_005B:
+	TST.L	D5			;04bc: 4a85
+	DBF	D3,LAB_005B		;04be: 51cbfffc
+LAB_005C:
+	JSR	-438(A6)		;04c2: 4eaefe4a
+	BNE.S	LAB_005C		;04c6: 66fa
+LAB_005D:
+	MOVE.L	D0,D0			;04c8: 2000
+LAB_005E:
+	BNE.S	LAB_005D		;04ca: 66fc
+	BNE.S	LAB_005E		;04cc: 66fc
+	BNE.S	LAB_005D		;04ce: 66f8
+sym_0_260:
+	MOVE.L	D2,D5			;04d0: 2a02
+	DBF	D0,sym_0_260		;04d2: 51c8fffc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;04d6: 4cdf7cfc
+	RTS				;04da: 4e75
+LAB_0060:
+	BSR.W	LAB_0063		;04dc: 6100002c
+LAB_0061:
+	MOVE.W	24571(A5),10884(A5)	;04e0: 3b6d5ffb2a84
+	DBF	D1,LAB_0061		;04e6: 51c9fff8
+	BNE.S	LAB_0060		;04ea: 66f0
+	CMP.L	#$0000b556,D4		;04ec: b8bc0000b556
+	MOVEQ	#-66,D2			;04f2: 74be
+	BSR.W	sym_0_312		;04f4: 610000e2
+	BRA.S	sym_0_273		;04f8: 600e
+	;04fa
+	;DC.B	$4f,$75,$74,$20,$6f,$66,$20,$6d,$65,$6d,$6f,$72,$79,$00
+	DC.B	"Out of memory",0
+sym_0_273:
+	RTS				;0508: 4e75
+LAB_0063:
+	LINK.W	A5,#-60			;050a: 4e55ffc4
+	BSR.W	LAB_0068		;050e: 61000048
+	BSR.W	LAB_0068		;0512: 61000044
+	TST.L	D1			;0516: 4a81
+	ADD.L	D6,D2			;0518: d486
+LAB_0064:
+	ADDQ.L	#3,A7			;051a: 568f
+	DBF	D7,LAB_0064		;051c: 51cffffc
+LAB_0065:
+	MOVE.W	8236(A5),10348(A5)	;0520: 3b6d202c286c
+	DBF	D4,LAB_0065		;0526: 51ccfff8
+	CMP.L	#$0000c518,D6		;052a: bcbc0000c518
+	ADD.W	D0,D0			;0530: d040
+	MOVE.W	LAB_0066(PC,D0.W),D0	;0532: 303b0006
+	JMP	LAB_0066(PC,D0.W)	;0536: 4efb0002
+LAB_0066:
+	DC.L	$000a000e,$00120016,$001a7000 ;053a
+	DC.W	$4e75			;0546
+sym_0_286:
+	DC.L	$70014e75,$70024e75,$70034e75,$70044e75 ;0548
+LAB_0068:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0558: 48e73f3e
+LAB_0069:
+	BSR.W	sym_0_312		;055c: 6100007a
+	DBF	D2,LAB_0069		;0560: 51cafffa
+	BSR.W	LAB_007D		;0564: 61000114
+LAB_006A:
+	BRA.S	LAB_006B		;0568: 6008
+	;056a
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+LAB_006B:
+	BNE.S	LAB_006A		;0572: 66f4
+	BNE.S	LAB_006B		;0574: 66fc
+	BRA.S	LAB_006C		;0576: 6012
+	;0578
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62,$72,$61,$72,$79
+	;DC.B	$00,$00
+	DC.B	"graphics.library",0,0
+LAB_006C:
+	BSR.W	LAB_0072		;058a: 61000088
+sym_0_299:
+	BSR.W	sym_0_312		;058e: 61000048
+	BSR.W	LAB_0072		;0592: 61000080
+LAB_006E:
+	BSR.W	sym_0_312		;0596: 61000040
+	DBF	D3,LAB_006E		;059a: 51cbfffa
+	ADD.W	D0,D0			;059e: d040
+	MOVE.W	LAB_006F(PC,D0.W),D0	;05a0: 303b0006
+	JMP	LAB_006F(PC,D0.W)	;05a4: 4efb0002
+LAB_006F:
+	DC.L	$00100014,$0018001c,$00200024,$0028002c ;05a8
+	DC.L	$70004e75,$70014e75,$70024e75,$70034e75 ;05b8
+	DC.L	$70044e75,$70054e75,$70064e75,$70074e75 ;05c8
+sym_0_312:
+	LINK.W	A5,#-160		;05d8: 4e55ff60
+	BSR.W	LAB_0072		;05dc: 61000036
+	ADD.W	D0,D0			;05e0: d040
+	MOVE.W	LAB_0071(PC,D0.W),D0	;05e2: 303b0006
+	JMP	LAB_0071(PC,D0.W)	;05e6: 4efb0002
+LAB_0071:
+	DC.L	$000e0012,$0016001a,$001e0022,$00267000 ;05ea
+	DC.L	$4e757001,$4e757002,$4e757003,$4e757004 ;05fa
+	DC.L	$4e757005,$4e757006	;060a
+	DC.W	$4e75			;0612
+LAB_0072:
+	LINK.W	A5,#-100		;0614: 4e55ff9c
+LAB_0073:
+	BSR.W	LAB_007D		;0618: 61000060
+	CMPI.L	#$0000003d,D1		;061c: 0c810000003d
+sym_0_325:
+	JSR	LAB_007D		;0622: 4eb90000067a
+	BSR.W	LAB_0081		;0628: 6100007c
+	MOVE.L	D3,D5			;062c: 2a03
+LAB_0075:
+	BSR.W	LAB_0081		;062e: 61000076
+LAB_0076:
+	ADDQ.L	#7,A6			;0632: 5e8e
+	DBF	D0,LAB_0076		;0634: 51c8fffc
+LAB_0077:
+	MOVE.W	27415(A5),10241(A5)	;0638: 3b6d6b172801
+	CMP.L	#$0000c57a,D3		;063e: b6bc0000c57a
+	MOVEQ	#-45,D6			;0644: 7cd3
+LAB_0078:
+	BNE.S	LAB_0077		;0646: 66f0
+LAB_0079:
+	DBF	D0,LAB_0078		;0648: 51c8fffc
+	BNE.S	LAB_0078		;064c: 66f8
+	BNE.S	LAB_0079		;064e: 66f8
+sym_0_338:
+	BSR.W	LAB_008F		;0650: 61000116
+LAB_007B:
+	JSR	-870(A6)		;0654: 4eaefc9a
+	DBF	D1,LAB_007B		;0658: 51c9fffa
+	MOVE.L	25456(A5),D1		;065c: 222d6370
+	LEA	LAB_001E+2(PC),A6	;0660: 4dfafb50
+	BSR.W	LAB_008F		;0664: 61000102
+	CMPI.L	#$000000ca,D1		;0668: 0c81000000ca
+LAB_007C:
+	ADD.L	D6,D6			;066e: dc86
+	BSR.W	LAB_007D		;0670: 61000008
+	BNE.S	LAB_007C		;0674: 66f8
+	UNLK	A5			;0676: 4e5d
+	RTS				;0678: 4e75
+LAB_007D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;067a: 48e73f3e
+sym_0_351:
+	BSR.W	LAB_0081		;067e: 61000026
+	BSR.W	LAB_008F		;0682: 610000e4
+	CMPI.L	#$000000b1,D1		;0686: 0c81000000b1
+	MOVE.L	30854(A5),D4		;068c: 282d7886
+LAB_007F:
+	BRA.S	LAB_0080		;0690: 600a
+	;0692
+	;DC.B	$25,$73,$3a,$20,$25,$6c,$64,$0a,$00,$00
+	DC.B	"%s: %ld",10,0,0
+LAB_0080:
+	DBF	D5,LAB_007F		;069c: 51cdfff2
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;06a0: 4cdf7cfc
+	RTS				;06a4: 4e75
+LAB_0081:
+	BSR.W	LAB_008F		;06a6: 610000c0
+	MOVE.L	4446(A5),D4		;06aa: 282d115e
+	MOVE.L	18658(A5),D6		;06ae: 2c2d48e2
+LAB_0082:
+	MOVE.L	12378(A5),D7		;06b2: 2e2d305a
+sym_0_364:
+	BRA.S	LAB_0084		;06b6: 6018
+	;06b8
+	;DC.B	$43,$4f,$4e,$3a,$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f
+	;DC.B	$4f,$75,$74,$70,$75,$74,$00,$00
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_0084:
+	JSR	-816(A6)		;06d0: 4eaefcd0
+LAB_0085:
+	BNE.S	LAB_0082		;06d4: 66dc
+	BSR.W	LAB_0095		;06d6: 610000ee
+LAB_0086:
+	BNE.S	LAB_0085		;06da: 66f8
+LAB_0087:
+	DBF	D1,LAB_0086		;06dc: 51c9fffc
+	ADDQ.L	#6,A5			;06e0: 5c8d
+	CMP.L	#$00005d1c,D3		;06e2: b6bc00005d1c
+	JSR	-30(A6)			;06e8: 4eaeffe2
+	JSR	-168(A6)		;06ec: 4eaeff58
+	MOVE.L	D2,D5			;06f0: 2a02
+	ADD.L	D6,D6			;06f2: dc86
+	CMPI.L	#$000000bb,D6		;06f4: 0c86000000bb
+sym_0_377:
+	MOVE.L	30430(A5),D3		;06fa: 262d76de
+	ADDQ.L	#7,A1			;06fe: 5e89
+	BSR.W	LAB_0095		;0700: 610000c4
+LAB_0089:
+	MOVEQ	#-92,D2			;0704: 74a4
+LAB_008A:
+	MOVE.L	D6,D6			;0706: 2c06
+	BNE.S	LAB_008A		;0708: 66fc
+	BNE.S	LAB_0089		;070a: 66f8
+	ADD.L	D0,D5			;070c: da80
+	LEA	LAB_0075(PC),A2		;070e: 45faff1e
+	ADD.L	D6,D5			;0712: da86
+	CMP.L	#$0000f788,D4		;0714: b8bc0000f788
+	MOVE.W	24483(A5),23004(A5)	;071a: 3b6d5fa359dc
+LAB_008B:
+	MOVE.L	32062(A5),D5		;0720: 2a2d7d3e
+sym_0_390:
+	DBF	D2,LAB_008B		;0724: 51cafffa
+	ADDQ.L	#2,A1			;0728: 5489
+	JSR	-414(A6)		;072a: 4eaefe62
+	CMPI.L	#$0000009e,D0		;072e: 0c800000009e
+	ADD.L	D6,D3			;0734: d686
+	CMPI.L	#$00000094,D1		;0736: 0c8100000094
+	BSR.W	LAB_0095		;073c: 61000088
+	LEA	LAB_0052(PC),A2		;0740: 45fafd1c
+	MOVE.W	5605(A5),7566(A5)	;0744: 3b6d15e51d8e
+	CMPI.L	#$0000001a,D1		;074a: 0c810000001a
+	LEA	LAB_0073+2(PC),A0	;0750: 41fafec8
+	BSR.W	LAB_0095		;0754: 61000070
+	ADDQ.L	#4,A6			;0758: 588e
+sym_0_403:
+	BRA.S	LAB_008E		;075a: 600a
+	;075c
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_008E:
+	RTS				;0766: 4e75
+LAB_008F:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0768: 48e73f3e
+	BSR.W	LAB_0095		;076c: 61000058
+	MOVE.W	6066(A5),26397(A5)	;0770: 3b6d17b2671d
+	TST.L	D3			;0776: 4a83
+LAB_0090:
+	BSR.W	LAB_0095		;0778: 6100004c
+	DBF	D5,LAB_0090		;077c: 51cdfffa
+	MOVE.W	19688(A5),8049(A5)	;0780: 3b6d4ce81f71
+	CMPI.L	#$00000098,D5		;0786: 0c8500000098
+	BRA.S	LAB_0091		;078c: 600c
+	;078e
+	;DC.B	$64,$6f,$73,$2e,$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"dos.library",0
+LAB_0091:
+	ADD.L	D3,D3			;079a: d683
+	DBF	D2,LAB_0091		;079c: 51cafffc
+sym_0_416:
+	BSR.W	LAB_0095		;07a0: 61000024
+LAB_0093:
+	JSR	-738(A6)		;07a4: 4eaefd1e
+	DBF	D0,LAB_0093		;07a8: 51c8fffa
+	BNE.S	sym_0_416		;07ac: 66f2
+	BNE.S	LAB_0093		;07ae: 66f4
+	JSR	LAB_0095		;07b0: 4eb9000007c6
+LAB_0094:
+	CMP.L	#$00006a8c,D1		;07b6: b2bc00006a8c
+	DBF	D1,LAB_0094		;07bc: 51c9fff8
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;07c0: 4cdf7cfc
+	RTS				;07c4: 4e75
+LAB_0095:
+	JSR	sym_2_0			;07c6: 4eb900000a00
+	NOP				;07cc: 4e71
+	NOP				;07ce: 4e71
+	NOP				;07d0: 4e71
+	NOP				;07d2: 4e71
+	NOP				;07d4: 4e71
+	NOP				;07d6: 4e71
+	NOP				;07d8: 4e71
+	NOP				;07da: 4e71
+	NOP				;07dc: 4e71
+	NOP				;07de: 4e71
+	NOP				;07e0: 4e71
+	NOP				;07e2: 4e71
+	NOP				;07e4: 4e71
+	NOP				;07e6: 4e71
+	NOP				;07e8: 4e71
+	NOP				;07ea: 4e71
+	NOP				;07ec: 4e71
+	NOP				;07ee: 4e71
+	NOP				;07f0: 4e71
+	NOP				;07f2: 4e71
+	NOP				;07f4: 4e71
+	NOP				;07f6: 4e71
+	NOP				;07f8: 4e71
+	NOP				;07fa: 4e71
+	NOP				;07fc: 4e71
+	RTS				;07fe: 4e75
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	;0800
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e
+	DC.B	"intuition."
+LAB_0096:
+	DC.L	$6c696272,$61727900,$5702fdd5,$2bc4ea31 ;080a
+	DC.L	$43331c7c,$52656164,$792e0000,$388ef53a ;081a
+	DC.L	$6847e829,$67726170,$68696373,$2e6c6962 ;082a
+	DC.L	$72617279,$0000696e,$74756974,$696f6e2e ;083a
+	DC.L	$6c696272,$61727900,$57b6feeb ;084a
+LAB_0097:
+	DC.L	$219f3fba,$52656164,$792e0000,$741e38c3 ;0856
+	DC.L	$7763ec3b		;0866
+	DC.L	LAB_005D		;086a: 000004c8
+	DC.L	$45f97925,$52656164,$792e0000,$4f757420 ;086e
+	DC.L	$6f66206d,$656d6f72,$79002285,$f80d4572 ;087e
+	DC.L	$726f723a,$20002573,$3a20256c,$640a0000 ;088e
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172 ;089e
+	DC.L	$79003695,$e2656772,$61706869,$63732e6c ;08ae
+	DC.L	$69627261,$72790000,$52656164,$792e0000 ;08be
+	DC.L	$696e7475,$6974696f,$6e2e6c69,$62726172 ;08ce
+	DC.W	$7900			;08de
+	DC.L	LAB_0087		;08e0: 000006dc
+	DC.L	$576f726b,$62656e63,$68002573,$3a20256c ;08e4
+	DC.L	$640a0000,$001374d2,$2995140b,$122a27f4 ;08f4
+	DC.L	$1ebb2f9a,$576f726b,$62656e63,$68004e35 ;0904
+	DC.L	$7b87656d,$06587d63,$95da1339,$ef1054e5 ;0914
+	DC.L	$65123cdb,$c6ea2168,$9f17395f,$91fe33e5 ;0924
+	DC.L	$c02258cc,$c8a65265,$6164792e,$000047f1 ;0934
+	DC.L	$7f0f4572,$726f723a,$2000620d,$f59165d7 ;0944
+	DC.L	$e2a35026,$44b42851,$68f1212b,$4b8727f0 ;0954
+	DC.L	$68d219da,$0e697fb4,$569315b9,$478040cb ;0964
+	DC.L	$02a23109,$e667162e,$e38c470f,$2a24434f ;0974
+	DC.L	$4e3a302f,$302f3634,$302f3230,$302f4f75 ;0984
+	DC.L	$74707574,$00002573,$3a20256c,$640a0000 ;0994
+LAB_0098:
+	DC.L	$0dab112e,$746f7061	;09a4
+	DC.W	$7a2e			;09ac
+LAB_0099:
+	DC.L	$666f6e74,$000061bf,$6d453840,$9aa63614 ;09ae
+	DC.W	$bb23			;09be
+	DC.L	LAB_005A		;09c0: 000004b4
+	DC.L	$4760408b,$746f7061,$7a2e666f,$6e740000 ;09c4
+	DC.L	$0b4e2b13		;09d4
+	DS.L	9			;09d8
+LAB_009A:
+	DS.L	1			;09fc
+
+
+	SECTION S_2,CODE
+
+sym_2_0:
+	LINK.W	A5,#-188		;0a00: 4e55ff44
+	BSR.W	sym_2_13		;0a04: 61000058
+	BRA.S	LAB_009C		;0a08: 6012
+	;0a0a
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_009C:
+	BRA.S	LAB_009D		;0a1c: 6008
+	;0a1e
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+LAB_009D:
+	MOVE.L	28848(A5),D2		;0a26: 242d70b0
+	ADD.W	D0,D0			;0a2a: d040
+	MOVE.W	LAB_009E(PC,D0.W),D0	;0a2c: 303b0006
+	JMP	LAB_009E(PC,D0.W)	;0a30: 4efb0002
+LAB_009E:
+	DC.L	$000e0012,$0016001a	;0a34
+	DC.W	$001e			;0a3c
+LAB_009F:
+	DC.L	$00220026,$70004e75,$70014e75,$70024e75 ;0a3e
+	DC.L	$70034e75,$70044e75	;0a4e
+LAB_00A0:
+	DC.L	$70054e75,$70064e75	;0a56
+sym_2_13:
+	BSR.W	LAB_00AF		;0a5e: 610000a2
+	JSR	-510(A6)		;0a62: 4eaefe02
+LAB_00A2:
+	BRA.S	LAB_00A3		;0a66: 6008
+	;0a68
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+LAB_00A3:
+	JSR	-654(A6)		;0a70: 4eaefd72
+LAB_00A4:
+	MOVE.L	9942(A5),D0		;0a74: 202d26d6
+LAB_00A5:
+	DBF	D5,LAB_00A4		;0a78: 51cdfffa
+LAB_00A6:
+	DBF	D0,LAB_00A5		;0a7c: 51c8fffa
+	DBF	D5,LAB_00A6		;0a80: 51cdfffa
+	BRA.S	LAB_00A7		;0a84: 6012
+	;0a86
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62,$72,$61,$72,$79
+	;DC.B	$00,$00
+	DC.B	"graphics.library",0,0
+LAB_00A7:
+	MOVE.W	14305(A5),28878(A5)	;0a98: 3b6d37e170ce
+LAB_00A8:
+	BSR.W	LAB_00BC		;0a9e: 610000fc
+	JSR	LAB_00B2		;0aa2: 4eb900000b34
+sym_2_26:
+	CMPI.L	#$00000051,D5		;0aa8: 0c8500000051
+	ADD.L	D6,D2			;0aae: d486
+	MOVEQ	#42,D5			;0ab0: 7a2a
+	MOVE.L	D1,D3			;0ab2: 2601
+	MOVE.L	#LAB_00A0,-(A7)		;0ab4: 2f3c00000a56
+	MOVE.L	15708(A5),D7		;0aba: 2e2d3d5c
+	ADD.L	D6,D3			;0abe: d686
+	BSR.W	LAB_00AF		;0ac0: 61000040
+	ADD.L	D2,D4			;0ac4: d882
+	CMP.L	#$0000d435,D7		;0ac6: bebc0000d435
+LAB_00AA:
+	BRA.S	LAB_00AB		;0acc: 6008
+	;0ace
+	;DC.B	$45,$72,$72,$6f,$72,$3a,$20,$00
+	DC.B	"Error: ",0
+LAB_00AB:
+	BNE.S	LAB_00AA		;0ad6: 66f4
+	ADDQ.L	#7,A7			;0ad8: 5e8f
+sym_2_39:
+	BNE.S	LAB_00AA		;0ada: 66f0
+	BSR.W	LAB_00AF		;0adc: 61000024
+	ADD.W	D0,D0			;0ae0: d040
+	MOVE.W	LAB_00AD(PC,D0.W),D0	;0ae2: 303b0006
+	JMP	LAB_00AD(PC,D0.W)	;0ae6: 4efb0002
+LAB_00AD:
+	DC.L	$0008000c,$00100014	;0aea
+	DC.W	$7000			;0af2
+LAB_00AE:
+	DC.L	$4e757001,$4e757002,$4e757003 ;0af4
+	DC.W	$4e75			;0b00
+LAB_00AF:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0b02: 48e73f3e
+	BSR.W	LAB_00B2		;0b06: 6100002c
+	TST.L	D2			;0b0a: 4a82
+	CMP.L	#$0000c9fa,D2		;0b0c: b4bc0000c9fa
+	ADD.W	D0,D0			;0b12: d040
+	MOVE.W	LAB_00B0(PC,D0.W),D0	;0b14: 303b0006
+	JMP	LAB_00B0(PC,D0.W)	;0b18: 4efb0002
+LAB_00B0:
+	DC.L	$0008000c,$00100014,$70004e75 ;0b1c
+sym_2_52:
+	DC.L	$70014e75,$70024e75,$70034e75 ;0b28
+LAB_00B2:
+	BSR.W	LAB_00BC		;0b34: 61000066
+LAB_00B3:
+	BSR.W	LAB_00C8		;0b38: 610000ec
+	DBF	D1,LAB_00B3		;0b3c: 51c9fffa
+LAB_00B4:
+	JSR	LAB_00C8		;0b40: 4eb900000c26
+	BNE.S	LAB_00B4		;0b46: 66f8
+LAB_00B5:
+	BRA.S	LAB_00B8		;0b48: 6012
+LAB_00B6:
+	;0b4a
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62
+	DC.B	"graphics.lib"
+LAB_00B7:
+	;0b56
+	;DC.B	$72,$61,$72,$79,$00,$00
+	DC.B	"rary",0,0
+LAB_00B8:
+	MOVE.W	12729(A5),32666(A5)	;0b5c: 3b6d31b97f9a
+	BNE.S	LAB_00B5		;0b62: 66e4
+LAB_00B9:
+	JSR	LAB_00C8		;0b64: 4eb900000c26
+sym_2_65:
+	DBF	D0,LAB_00B9		;0b6a: 51c8fff8
+	DBF	D6,sym_2_65		;0b6e: 51cefffa
+	BNE.S	LAB_00B9		;0b72: 66f0
+	LEA	LAB_009F(PC),A2		;0b74: 45fafec8
+LAB_00BB:
+	MOVE.L	27718(A5),D0		;0b78: 202d6c46
+	DBF	D7,LAB_00BB		;0b7c: 51cffffa
+	CMPI.L	#$000000d7,D5		;0b80: 0c85000000d7
+	MOVE.L	#LAB_0097,-(A7)		;0b86: 2f3c00000856
+	MOVE.L	28254(A5),D5		;0b8c: 2a2d6e5e
+	LEA	LAB_00A2,A0		;0b90: 41f900000a66
+	MOVE.L	5506(A5),D2		;0b96: 242d1582
+	RTS				;0b9a: 4e75
+LAB_00BC:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0b9c: 48e73f3e
+sym_2_78:
+	BSR.W	LAB_00C8		;0ba0: 61000084
+	MOVE.L	D3,D5			;0ba4: 2a03
+	ADD.L	D5,D5			;0ba6: da85
+	BRA.S	LAB_00BF		;0ba8: 6008
+	;0baa
+	;DC.B	$45,$72,$72,$6f,$72,$3a,$20,$00
+	DC.B	"Error: ",0
+LAB_00BF:
+	BRA.S	LAB_00C0		;0bb2: 6012
+	;0bb4
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_00C0:
+	ADD.L	D3,D4			;0bc6: d883
+LAB_00C1:
+	BSR.W	LAB_00E5		;0bc8: 6100017a
+LAB_00C2:
+	BRA.S	LAB_00C3		;0bcc: 600e
+	;0bce
+	;DC.B	$4f,$75,$74,$20,$6f,$66,$20,$6d,$65,$6d,$6f,$72,$79,$00
+	DC.B	"Out of memory",0
+LAB_00C3:
+	BRA.S	LAB_00C5		;0bdc: 600c
+	DC.L	$646f732e		;0bde
+LAB_00C4:
+	;0be2
+	;DC.B	$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"library",0
+LAB_00C5:
+	ADDQ.L	#3,A6			;0bea: 568e
+	ADD.W	D0,D0			;0bec: d040
+	MOVE.W	LAB_00C6(PC,D0.W),D0	;0bee: 303b0006
+	JMP	LAB_00C6(PC,D0.W)	;0bf2: 4efb0002
+LAB_00C6:
+	DC.L	$00100014,$0018001c,$00200024,$0028002c ;0bf6
+	DC.L	$70004e75,$70014e75	;0c06
+sym_2_91:
+	DC.L	$70024e75,$70034e75,$70044e75,$70054e75 ;0c0e
+	DC.L	$70064e75,$70074e75	;0c1e
+LAB_00C8:
+	BSR.W	LAB_00D5		;0c26: 61000078
+LAB_00C9:
+	DBF	D1,LAB_00C8		;0c2a: 51c9fffa
+LAB_00CA:
+	DBF	D1,LAB_00C9		;0c2e: 51c9fffa
+	MOVEQ	#3,D1			;0c32: 7203
+	MOVE.L	#LAB_0096,-(A7)		;0c34: 2f3c0000080a
+LAB_00CB:
+	BNE.S	LAB_00CA		;0c3a: 66f2
+sym_2_104:
+	LEA	LAB_00C1+2(PC),A2	;0c3c: 45faff8c
+	BSR.W	LAB_00E5		;0c40: 61000102
+	JSR	LAB_00D5		;0c44: 4eb900000ca0
+LAB_00CD:
+	JSR	-282(A6)		;0c4a: 4eaefee6
+	DBF	D7,LAB_00CD		;0c4e: 51cffffa
+	CMPI.L	#$000000f4,D5		;0c52: 0c85000000f4
+	JSR	LAB_00D5		;0c58: 4eb900000ca0
+	BSR.W	LAB_00D5		;0c5e: 61000040
+	BSR.W	LAB_00D5		;0c62: 6100003c
+	BSR.W	LAB_00D5		;0c66: 61000038
+LAB_00CE:
+	CMPI.L	#$00000032,D3		;0c6a: 0c8300000032
+LAB_00CF:
+	DBF	D6,LAB_00CE		;0c70: 51cefff8
+	BNE.S	LAB_00CF		;0c74: 66fa
+sym_2_117:
+	BSR.W	LAB_00EA		;0c76: 610000fa
+LAB_00D1:
+	BSR.W	LAB_00E5		;0c7a: 610000c8
+	BNE.S	LAB_00D1		;0c7e: 66fa
+	MOVEQ	#-79,D0			;0c80: 70b1
+	JSR	-438(A6)		;0c82: 4eaefe4a
+LAB_00D2:
+	JSR	-666(A6)		;0c86: 4eaefd66
+	DBF	D2,LAB_00D2		;0c8a: 51cafffa
+	MOVE.L	D6,D1			;0c8e: 2206
+LAB_00D3:
+	BSR.W	LAB_00D5		;0c90: 6100000e
+	BSR.W	LAB_00EA		;0c94: 610000dc
+	BNE.S	LAB_00D3		;0c98: 66f6
+	BNE.S	LAB_00D3		;0c9a: 66f4
+	MOVEQ	#3,D6			;0c9c: 7c03
+sym_2_130:
+	RTS				;0c9e: 4e75
+LAB_00D5:
+	LINK.W	A5,#-216		;0ca0: 4e55ff28
+	BSR.W	LAB_00E5		;0ca4: 6100009e
+LAB_00D6:
+	BRA.S	LAB_00D7		;0ca8: 6012
+	;0caa
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_00D7:
+	DBF	D6,LAB_00D6		;0cbc: 51ceffea
+	MOVE.L	D3,D5			;0cc0: 2a03
+	BSR.W	LAB_00E5		;0cc2: 61000080
+	BSR.W	LAB_00F0		;0cc6: 61000108
+	ADD.L	D5,D0			;0cca: d085
+	MOVE.W	11158(A5),20033(A5)	;0ccc: 3b6d2b964e41
+LAB_00D8:
+	LEA	LAB_00CB(PC),A0		;0cd2: 41faff66
+	LEA	LAB_00B7(PC),A0		;0cd6: 41fafe7e
+	CMPI.L	#$00000035,D1		;0cda: 0c8100000035
+sym_2_143:
+	BRA.S	LAB_00DA		;0ce0: 600a
+	;0ce2
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_00DA:
+	MOVE.L	#LAB_00B9,-(A7)		;0cec: 2f3c00000b64
+	MOVE.L	32468(A5),D2		;0cf2: 242d7ed4
+LAB_00DB:
+	BSR.W	LAB_00F0		;0cf6: 610000d8
+LAB_00DC:
+	DBF	D3,LAB_00DB		;0cfa: 51cbfffa
+	DBF	D6,LAB_00DC		;0cfe: 51cefffa
+LAB_00DD:
+	ADD.L	D3,D1			;0d02: d283
+LAB_00DE:
+	BSR.W	LAB_00EA		;0d04: 6100006c
+	DBF	D6,LAB_00DE		;0d08: 51cefffa
+	CMP.L	#$00000c12,D5		;0d0c: babc00000c12
+	JSR	-726(A6)		;0d12: 4eaefd2a
+	LEA	LAB_00A8+2(PC),A6	;0d16: 4dfafd88
+LAB_00DF:
+	BSR.W	LAB_00E5		;0d1a: 61000028
+sym_2_156:
+	DBF	D0,LAB_00DF		;0d1e: 51c8fffa
+	DBF	D0,sym_2_156		;0d22: 51c8fffa
+	MOVEQ	#-1,D0			;0d26: 70ff
+LAB_00E1:
+	BSR.W	LAB_00E5		;0d28: 6100001a
+	DBF	D5,LAB_00E1		;0d2c: 51cdfffa
+LAB_00E2:
+	LEA	LAB_00BC+2(PC),A4	;0d30: 49fafe6c
+LAB_00E3:
+	DBF	D2,LAB_00E2		;0d34: 51cafffa
+	LEA	LAB_00C2(PC),A0		;0d38: 41fafe92
+LAB_00E4:
+	BNE.S	LAB_00E3		;0d3c: 66f6
+	BNE.S	LAB_00E4		;0d3e: 66fc
+	UNLK	A5			;0d40: 4e5d
+	RTS				;0d42: 4e75
+LAB_00E5:
+	LINK.W	A5,#-100		;0d44: 4e55ff9c
+sym_2_169:
+	BSR.W	LAB_00EA		;0d48: 61000028
+	DBF	D0,sym_2_169		;0d4c: 51c8fffa
+LAB_00E7:
+	TST.L	D4			;0d50: 4a84
+	BNE.S	LAB_00E7		;0d52: 66fc
+	BRA.S	LAB_00E8		;0d54: 600c
+	;0d56
+	;DC.B	$64,$6f,$73,$2e,$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"dos.library",0
+LAB_00E8:
+	CMP.L	#$00000261,D1		;0d62: b2bc00000261
+LAB_00E9:
+	CMP.L	#$0000ca2e,D0		;0d68: b0bc0000ca2e
+	UNLK	A5			;0d6e: 4e5d
+	RTS				;0d70: 4e75
+LAB_00EA:
+	LINK.W	A5,#-160		;0d72: 4e55ff60
+LAB_00EB:
+	BSR.W	LAB_00F0		;0d76: 61000058
+	DBF	D2,LAB_00EB		;0d7a: 51cafffa
+	MOVE.L	D7,D3			;0d7e: 2607
+sym_2_182:
+	MOVE.L	13100(A5),D5		;0d80: 2a2d332c
+	DBF	D5,sym_2_182		;0d84: 51cdfffa
+	BNE.S	sym_2_182		;0d88: 66f6
+	BSR.W	LAB_00F7		;0d8a: 6100008a
+LAB_00ED:
+	MOVE.L	30506(A5),D1		;0d8e: 222d772a
+	DBF	D2,LAB_00ED		;0d92: 51cafffa
+	ADD.W	D0,D0			;0d96: d040
+	MOVE.W	LAB_00EE(PC,D0.W),D0	;0d98: 303b0006
+	JMP	LAB_00EE(PC,D0.W)	;0d9c: 4efb0002
+LAB_00EE:
+	DC.L	$00100014,$0018001c,$00200024,$0028002c ;0da0
+	DC.L	$70004e75,$70014e75,$70024e75,$70034e75 ;0db0
+	DC.L	$70044e75,$70054e75	;0dc0
+sym_2_195:
+	DC.L	$70064e75,$70074e75	;0dc8
+LAB_00F0:
+	LINK.W	A5,#-68			;0dd0: 4e55ffbc
+LAB_00F1:
+	BSR.W	LAB_00F4		;0dd4: 61000022
+	DBF	D7,LAB_00F1		;0dd8: 51cffffa
+	JSR	-210(A6)		;0ddc: 4eaeff2e
+	ADDQ.L	#4,A6			;0de0: 588e
+	LEA	LAB_00BC(PC),A0		;0de2: 41fafdb8
+LAB_00F2:
+	BRA.S	LAB_00F3		;0de6: 6008
+	;0de8
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+LAB_00F3:
+	DBF	D3,LAB_00F2		;0df0: 51cbfff4
+	UNLK	A5			;0df4: 4e5d
+	RTS				;0df6: 4e75
+LAB_00F4:
+	LINK.W	A5,#-240		;0df8: 4e55ff10
+sym_2_208:
+	BSR.W	LAB_00F7		;0dfc: 61000018
+LAB_00F6:
+	TST.L	D0			;0e00: 4a80
+	TST.L	D1			;0e02: 4a81
+	BNE.S	LAB_00F6		;0e04: 66fa
+	ADD.L	D3,D3			;0e06: d683
+	BSR.W	LAB_0102		;0e08: 61000082
+	BSR.W	LAB_0102		;0e0c: 6100007e
+	MOVE.L	D6,D1			;0e10: 2206
+	UNLK	A5			;0e12: 4e5d
+	RTS				;0e14: 4e75
+LAB_00F7:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0e16: 48e73f3e
+	BSR.W	LAB_0102		;0e1a: 61000070
+	BRA.S	sym_2_221		;0e1e: 6018
+	;0e20
+	;DC.B	$43,$4f,$4e,$3a,$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f
+	;DC.B	$4f,$75,$74,$70,$75,$74,$00,$00
+	DC.B	"CON:0/0/640/200/Output",0,0
+sym_2_221:
+	ADD.L	D3,D5			;0e38: da83
+LAB_00F9:
+	LEA	LAB_00C4(PC),A4		;0e3a: 49fafda6
+	DBF	D6,LAB_00F9		;0e3e: 51cefffa
+	JSR	-846(A6)		;0e42: 4eaefcb2
+LAB_00FA:
+	BNE.S	LAB_00F9		;0e46: 66f2
+	BNE.S	LAB_00FA		;0e48: 66fc
+LAB_00FB:
+	LEA	LAB_00F9(PC),A6		;0e4a: 4dfaffee
+LAB_00FC:
+	DBF	D6,LAB_00FB		;0e4e: 51cefffa
+LAB_00FD:
+	DBF	D0,LAB_00FC		;0e52: 51c8fffa
+LAB_00FE:
+	BNE.S	LAB_00FD		;0e56: 66fa
+LAB_00FF:
+	DBF	D2,LAB_00FE		;0e58: 51cafffc
+	MOVE.L	29724(A5),D3		;0e5c: 262d741c
+	CMPI.L	#$00000083,D1		;0e60: 0c8100000083
+sym_2_234:
+	BNE.S	LAB_00FF		;0e66: 66f0
+	DBF	D7,sym_2_234		;0e68: 51cffffc
+	CMP.L	#$0000d296,D2		;0e6c: b4bc0000d296
+	BRA.S	LAB_0101		;0e72: 600c
+	;0e74
+	;DC.B	$64,$6f,$73,$2e,$6c,$69,$62,$72,$61,$72,$79,$00
+	DC.B	"dos.library",0
+LAB_0101:
+	MOVEQ	#88,D5			;0e80: 7a58
+	DBF	D2,LAB_0101		;0e82: 51cafffc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0e86: 4cdf7cfc
+	RTS				;0e8a: 4e75
+LAB_0102:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0e8c: 48e73f3e
+LAB_0103:
+	BSR.W	LAB_0106		;0e90: 6100002e
+	DBF	D2,LAB_0103		;0e94: 51cafffa
+	CMPI.L	#$000000b0,D6		;0e98: 0c86000000b0
+	ADD.W	D0,D0			;0e9e: d040
+	MOVE.W	LAB_0104(PC,D0.W),D0	;0ea0: 303b0006
+	JMP	LAB_0104(PC,D0.W)	;0ea4: 4efb0002
+LAB_0104:
+	DC.L	$0008000c,$00100014	;0ea8
+sym_2_247:
+	DC.L	$70004e75,$70014e75,$70024e75,$70034e75 ;0eb0
+LAB_0106:
+	BSR.W	LAB_0111		;0ec0: 61000078
+LAB_0107:
+	JSR	-312(A6)		;0ec4: 4eaefec8
+	DBF	D1,LAB_0107		;0ec8: 51c9fffa
+	BSR.W	sym_2_338		;0ecc: 6100016a
+LAB_0108:
+	MOVE.L	23344(A5),D2		;0ed0: 242d5b30
+	DBF	D3,LAB_0108		;0ed4: 51cbfffa
+	MOVE.L	22500(A5),D4		;0ed8: 282d57e4
+LAB_0109:
+	CMPI.L	#$00000056,D1		;0edc: 0c8100000056
+sym_2_260:
+	MOVE.W	726(A5),9555(A5)	;0ee2: 3b6d02d62553
+	BNE.S	LAB_0109		;0ee8: 66f2
+	CMPI.L	#$00000004,D7		;0eea: 0c8700000004
+	BNE.S	sym_2_260		;0ef0: 66f0
+	CMP.L	#$0000c8ad,D1		;0ef2: b2bc0000c8ad
+	JSR	-228(A6)		;0ef8: 4eaeff1c
+	BSR.W	LAB_011E		;0efc: 610000c2
+	JSR	-456(A6)		;0f00: 4eaefe38
+	MOVE.L	6094(A5),D4		;0f04: 282d17ce
+LAB_010B:
+	MOVE.W	8346(A5),27483(A5)	;0f08: 3b6d209a6b5b
+LAB_010C:
+	DBF	D5,LAB_010B		;0f0e: 51cdfff8
+LAB_010D:
+	DBF	D0,LAB_010C		;0f12: 51c8fffa
+	DBF	D3,LAB_010D		;0f16: 51cbfffa
+sym_2_273:
+	MOVE.L	D7,D6			;0f1a: 2c07
+LAB_010F:
+	MOVE.L	D6,D2			;0f1c: 2406
+	MOVE.L	D3,D1			;0f1e: 2203
+	BNE.S	LAB_010F		;0f20: 66fa
+	BRA.S	LAB_0110		;0f22: 6012
+	;0f24
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62,$72,$61,$72,$79
+	;DC.B	$00,$00
+	DC.B	"graphics.library",0,0
+LAB_0110:
+	ADD.L	D0,D2			;0f36: d480
+	RTS				;0f38: 4e75
+LAB_0111:
+	BSR.W	LAB_011E		;0f3a: 61000084
+	MOVEQ	#82,D1			;0f3e: 7252
+	BSR.W	LAB_0128		;0f40: 6100011a
+LAB_0112:
+	MOVE.L	D7,D4			;0f44: 2807
+	DBF	D1,LAB_0112		;0f46: 51c9fffc
+sym_2_286:
+	BSR.W	LAB_011E		;0f4a: 61000074
+	BNE.S	LAB_0112		;0f4e: 66f4
+	BSR.W	LAB_0128		;0f50: 6100010a
+	MOVE.L	D1,D7			;0f54: 2e01
+	JSR	-498(A6)		;0f56: 4eaefe0e
+	BSR.W	LAB_0128		;0f5a: 61000100
+	BSR.W	LAB_011E		;0f5e: 61000060
+LAB_0114:
+	MOVEQ	#36,D6			;0f62: 7c24
+	ADD.L	D1,D6			;0f64: dc81
+	LEA	LAB_009A,A2		;0f66: 45f9000009fc
+	BNE.S	LAB_0114		;0f6c: 66f4
+LAB_0115:
+	BSR.W	LAB_0128		;0f6e: 610000ec
+	MOVE.L	D2,D0			;0f72: 2002
+sym_2_299:
+	BNE.S	LAB_0115		;0f74: 66f8
+	ADD.L	D7,D2			;0f76: d487
+	MOVE.L	27712(A5),D4		;0f78: 282d6c40
+	MOVE.L	D1,D1			;0f7c: 2201
+	BRA.S	LAB_0117		;0f7e: 6008
+	;0f80
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+LAB_0117:
+	BRA.S	LAB_0118		;0f88: 6008
+	;0f8a
+	;DC.B	$45,$72,$72,$6f,$72,$3a,$20,$00
+	DC.B	"Error: ",0
+LAB_0118:
+	DBF	D5,LAB_0117		;0f92: 51cdfff4
+	BSR.W	sym_2_338		;0f96: 610000a0
+	CMPI.L	#$0000001f,D0		;0f9a: 0c800000001f
+LAB_0119:
+	LEA	LAB_00DD(PC),A6		;0fa0: 4dfafd60
+LAB_011A:
+	DBF	D6,LAB_0119		;0fa4: 51cefffa
+	ADDQ.L	#7,A2			;0fa8: 5e8a
+	BNE.S	LAB_011A		;0faa: 66f8
+sym_2_312:
+	MOVE.L	D6,D1			;0fac: 2206
+LAB_011C:
+	DBF	D1,sym_2_312		;0fae: 51c9fffc
+	DBF	D3,LAB_011C		;0fb2: 51cbfffa
+LAB_011D:
+	JSR	-342(A6)		;0fb6: 4eaefeaa
+	DBF	D5,LAB_011D		;0fba: 51cdfffa
+	RTS				;0fbe: 4e75
+LAB_011E:
+	LINK.W	A5,#-156		;0fc0: 4e55ff64
+	BSR.W	sym_2_338		;0fc4: 61000072
+LAB_011F:
+	LEA	LAB_00E9+2(PC),A2	;0fc8: 45fafda0
+LAB_0120:
+	MOVEQ	#95,D7			;0fcc: 7e5f
+	BNE.S	LAB_011F		;0fce: 66f8
+	BNE.S	LAB_0120		;0fd0: 66fa
+	LEA	LAB_00D8(PC),A2		;0fd2: 45fafcfe
+sym_2_325:
+	BRA.S	LAB_0122		;0fd6: 6012
+	;0fd8
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	;DC.B	$79,$00
+	DC.B	"intuition.library",0
+LAB_0122:
+	BRA.S	LAB_0123		;0fea: 600a
+	;0fec
+	;DC.B	$25,$73,$3a,$20,$25,$6c,$64,$0a,$00,$00
+	DC.B	"%s: %ld",10,0,0
+LAB_0123:
+	CMPI.L	#$0000009c,D6		;0ff6: 0c860000009c
+LAB_0124:
+	MOVE.L	20020(A5),D7		;0ffc: 2e2d4e34
+	DBF	D4,LAB_0124		;1000: 51ccfffa
+	CMPI.L	#$000000a5,D5		;1004: 0c85000000a5
+	CMPI.L	#$000000ca,D5		;100a: 0c85000000ca
+	ADD.W	D0,D0			;1010: d040
+	MOVE.W	LAB_0125(PC,D0.W),D0	;1012: 303b0006
+	JMP	LAB_0125(PC,D0.W)	;1016: 4efb0002
+LAB_0125:
+	DC.L	$000a000e,$00120016,$001a7000,$4e757001 ;101a
+	DC.L	$4e757002,$4e757003,$4e757004 ;102a
+	DC.W	$4e75			;1036
+sym_2_338:
+	LINK.W	A5,#-140		;1038: 4e55ff74
+	BSR.W	LAB_0128		;103c: 6100001e
+	ADD.W	D0,D0			;1040: d040
+	MOVE.W	LAB_0127(PC,D0.W),D0	;1042: 303b0006
+	JMP	LAB_0127(PC,D0.W)	;1046: 4efb0002
+LAB_0127:
+	DC.L	$0006000a,$000e7000,$4e757001,$4e757002 ;104a
+	DC.W	$4e75			;105a
+LAB_0128:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;105c: 48e73f3e
+	BSR.W	LAB_012B		;1060: 6100003c
+	ADD.W	D0,D0			;1064: d040
+	MOVE.W	LAB_0129(PC,D0.W),D0	;1066: 303b0006
+	JMP	LAB_0129(PC,D0.W)	;106a: 4efb0002
+LAB_0129:
+	DC.L	$00100014,$0018001c,$00200024,$0028002c ;106e
+	DC.L	$70004e75,$70014e75,$70024e75,$70034e75 ;107e
+sym_2_351:
+	DC.L	$70044e75,$70054e75,$70064e75,$70074e75 ;108e
+LAB_012B:
+	BSR.W	LAB_0133		;109e: 61000062
+	BRA.S	LAB_012C		;10a2: 600e
+	;10a4
+	;DC.B	$4f,$75,$74,$20,$6f,$66,$20,$6d,$65,$6d,$6f,$72,$79,$00
+	DC.B	"Out of memory",0
+LAB_012C:
+	BSR.W	LAB_0133		;10b2: 6100004e
+LAB_012D:
+	BSR.W	LAB_0137		;10b6: 6100007c
+	BNE.S	LAB_012D		;10ba: 66fa
+	BSR.W	LAB_0133		;10bc: 61000044
+	JSR	LAB_0133		;10c0: 4eb900001102
+	MOVE.W	15358(A5),15625(A5)	;10c6: 3b6d3bfe3d09
+sym_2_364:
+	BRA.S	LAB_012F		;10cc: 600a
+	;10ce
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_012F:
+	JSR	-162(A6)		;10d8: 4eaeff5e
+	DBF	D6,LAB_012F		;10dc: 51cefffa
+LAB_0130:
+	BSR.W	LAB_0137		;10e0: 61000052
+	DBF	D4,LAB_0130		;10e4: 51ccfffa
+	BRA.S	LAB_0131		;10e8: 600e
+	;10ea
+	;DC.B	$4f,$75,$74,$20,$6f,$66,$20,$6d,$65,$6d,$6f,$72,$79,$00
+	DC.B	"Out of memory",0
+LAB_0131:
+	MOVEQ	#83,D7			;10f8: 7e53
+LAB_0132:
+	MOVE.L	D6,D2			;10fa: 2406
+	JSR	-114(A6)		;10fc: 4eaeff8e
+	RTS				;1100: 4e75
+LAB_0133:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;1102: 48e73f3e
+	BSR.W	LAB_0137		;1106: 6100002c
+	BSR.W	LAB_013D		;110a: 6100006c
+sym_2_377:
+	BRA.S	LAB_0135		;110e: 600a
+	;1110
+	;DC.B	$25,$73,$3a,$20,$25,$6c,$64,$0a,$00,$00
+	DC.B	"%s: %ld",10,0,0
+LAB_0135:
+	LEA	LAB_00AE(PC),A0		;111a: 41faf9d8
+	MOVE.L	D1,D2			;111e: 2401
+	BSR.W	LAB_0147		;1120: 610000a0
+	MOVEQ	#-9,D7			;1124: 7ef7
+LAB_0136:
+	BSR.W	LAB_0147		;1126: 6100009a
+	DBF	D6,LAB_0136		;112a: 51cefffa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;112e: 4cdf7cfc
+	RTS				;1132: 4e75
+LAB_0137:
+	LINK.W	A5,#-132		;1134: 4e55ff7c
+	BSR.W	LAB_013D		;1138: 6100003e
+	ADD.L	D5,D0			;113c: d085
+	MOVEQ	#-79,D5			;113e: 7ab1
+sym_2_390:
+	JSR	LAB_0147		;1140: 4eb9000011c2
+	BSR.W	LAB_013D		;1146: 61000030
+LAB_0139:
+	ADD.L	D5,D0			;114a: d085
+	BNE.S	LAB_0139		;114c: 66fc
+LAB_013A:
+	LEA	LAB_0003,A0		;114e: 41f900000038
+	BRA.S	LAB_013B		;1154: 600a
+	;1156
+	;DC.B	$57,$6f,$72,$6b,$62,$65,$6e,$63,$68,$00
+	DC.B	"Workbench",0
+LAB_013B:
+	ADD.L	D3,D7			;1160: de83
+	BNE.S	LAB_013A		;1162: 66ea
+	LEA	LAB_0132(PC),A2		;1164: 45faff94
+	BSR.W	LAB_0147		;1168: 61000058
+	MOVEQ	#24,D0			;116c: 7018
+	CMP.L	#$0000594c,D4		;116e: b8bc0000594c
+	UNLK	A5			;1174: 4e5d
+sym_2_403:
+	RTS				;1176: 4e75
+LAB_013D:
+	BSR.W	LAB_0147		;1178: 61000048
+	ADDQ.L	#3,A3			;117c: 568b
+LAB_013E:
+	MOVE.L	25972(A5),D2		;117e: 242d6574
+LAB_013F:
+	DBF	D7,LAB_013E		;1182: 51cffffa
+LAB_0140:
+	DBF	D1,LAB_013F		;1186: 51c9fffa
+	DBF	D1,LAB_0140		;118a: 51c9fffa
+	BSR.W	LAB_0147		;118e: 61000032
+LAB_0141:
+	MOVE.W	20575(A5),13887(A5)	;1192: 3b6d505f363f
+LAB_0142:
+	DBF	D3,LAB_0141		;1198: 51cbfff8
+	MOVE.L	232(A5),D7		;119c: 2e2d00e8
+LAB_0143:
+	MOVE.L	14478(A5),D7		;11a0: 2e2d388e
+sym_2_416:
+	BNE.S	LAB_0142		;11a4: 66f2
+	BNE.S	LAB_0143		;11a6: 66f8
+	BSR.W	LAB_0147		;11a8: 61000018
+	MOVE.L	D5,D5			;11ac: 2a05
+	MOVE.L	1802(A5),D4		;11ae: 282d070a
+LAB_0145:
+	MOVE.L	D0,D7			;11b2: 2e00
+	DBF	D1,LAB_0145		;11b4: 51c9fffc
+LAB_0146:
+	BSR.W	LAB_0147		;11b8: 61000008
+	DBF	D5,LAB_0146		;11bc: 51cdfffa
+	RTS				;11c0: 4e75
+LAB_0147:
+	NOP				;11c2: 4e71
+	NOP				;11c4: 4e71
+	NOP				;11c6: 4e71
+	NOP				;11c8: 4e71
+	NOP				;11ca: 4e71
+	NOP				;11cc: 4e71
+	NOP				;11ce: 4e71
+	NOP				;11d0: 4e71
+	NOP				;11d2: 4e71
+	NOP				;11d4: 4e71
+	NOP				;11d6: 4e71
+	NOP				;11d8: 4e71
+	NOP				;11da: 4e71
+	NOP				;11dc: 4e71
+	NOP				;11de: 4e71
+	NOP				;11e0: 4e71
+	NOP				;11e2: 4e71
+	NOP				;11e4: 4e71
+	NOP				;11e6: 4e71
+	NOP				;11e8: 4e71
+	NOP				;11ea: 4e71
+	NOP				;11ec: 4e71
+	NOP				;11ee: 4e71
+	NOP				;11f0: 4e71
+	NOP				;11f2: 4e71
+	NOP				;11f4: 4e71
+	NOP				;11f6: 4e71
+	NOP				;11f8: 4e71
+	NOP				;11fa: 4e71
+	NOP				;11fc: 4e71
+	RTS				;11fe: 4e75
+
+
+	SECTION S_3,BSS
+
+SECSTRT_3:
+	DS.L	512			;1200
+	END
@@ -0,0 +1,8 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+
+	INCLUDE	"exe1.asm.S0"
+	INCLUDE	"exe1.asm.S1"
+	INCLUDE	"exe1.asm.S2"
+	INCLUDE	"exe1.asm.S3"
+	END
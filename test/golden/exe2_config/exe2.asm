@@ -0,0 +1,2408 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+; Custom equates (from config file)
+value_1	EQU	47412
+quick_9	EQU	7
+value_17	EQU	35660
+quick_25	EQU	5
+value_33	EQU	60687
+quick_41	EQU	2
+value_49	EQU	35795
+quick_57	EQU	3
+quick_65	EQU	1
+
+
+
+
+	SECTION S_0,CODE
+
+SECSTRT_0:
+; call site 0
+	BSR.W	func_0_98		;0000: 61000064
+LAB_0002:
+	LEA	(SECSTRT_0+2,PC),A0	;0004: 41fafffc
+	BSR.W	func_0_98		;0008: 6100005c
+LAB_0003:
+	LEA	LAB_0042,A6		;000c: 4df9000002c4
+	CMP.L	#value_1,D4		;0012: b8bc0000b934
+	ADDQ.L	#5,A1			;0018: 5a89
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+	ADD.L	D0,D0			;001a: d080
+	MOVE.W	(16178,A5),(22220,A5)	;001c: 3b6d3f3256cc
+LAB_0004:
+	MOVE.L	#LAB_006A,-(A7)		;0022: 2f3c000004b4
+	JSR	(-822,A6)		;0028: 4eaefcca
+	BNE.S	LAB_0004		;002c: 66f4
+	ADDQ.L	#1,A6			;002e: 528e
+LAB_0005:
+	MOVE.W	(19202,A5),(11796,A5)	;0030: 3b6d4b022e14
+func_0_182:
+	DBF	D0,LAB_0005		;0036: 51c8fff8
+LAB_0007:
+	CMPI.L	#$00000064,D3		;003a: 0c8300000064
+	BSR.W	func_0_98		;0040: 61000024
+LAB_0008:
+	BSR.W	LAB_001D		;0044: 610000ea
+LAB_0009:
+	LEA	(SECSTRT_0,PC),A0	;0048: 41faffb6
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+	CMPI.L	#$0000000f,D6		;004c: 0c860000000f
+	BSR.W	LAB_001D		;0052: 610000dc
+LAB_000A:
+	BNE.S	LAB_0009		;0056: 66f0
+	DBF	D5,LAB_000A		;0058: 51cdfffc
+	CMP.L	#$0000538c,D2		;005c: b4bc0000538c
+	MOVEQ	#102,D0			;0062: 7066
+	RTS				;0064: 4e75
+func_0_98:
+	LINK.W	A5,#-200		;0066: 4e55ff38
+	BSR.W	LAB_0019		;006a: 610000a6
+LAB_000C:
+	LEA	(LAB_0002+2,PC),A4	;006e: 49faff96
+	DBF	D1,LAB_000C		;0072: 51c9fffa
+	LEA	LAB_0153+2,A2		;0076: 45f900000e50
+LAB_000D:
+	MOVEQ	#-42,D2			;007c: 74d6
+LAB_000E:
+	MOVE.L	#LAB_0156,-(A7)		;007e: 2f3c00000e60
+; call site 189
+	BSR.W	LAB_002A		;0084: 6100012a
+	BNE.S	LAB_000D		;0088: 66f2
+LAB_000F:
+	LEA	(LAB_0008+2,PC),A6	;008a: 4dfaffba
+LAB_0010:
+	DBF	D1,LAB_000F		;008e: 51c9fffa
+LAB_0011:
+	MOVE.L	#LAB_013C,-(A7)		;0092: 2f3c00000d8c
+func_0_14:
+	MOVE.L	#LAB_01DC,-(A7)		;0098: 2f3c00001432
+	BNE.S	LAB_0010		;009e: 66ee
+	CMPI.L	#$0000001f,D4		;00a0: 0c840000001f
+	BSR.W	LAB_002A		;00a6: 61000108
+LAB_0013:
+	BSR.W	LAB_0019		;00aa: 61000066
+	DBF	D0,LAB_0013		;00ae: 51c8fffa
+	ADDQ.L	#2,A2			;00b2: 548a
+; call site 105
+	JSR	(-546,A6)		;00b4: 4eaefdde
+	BSR.W	LAB_002A		;00b8: 610000f6
+LAB_0014:
+	JSR	LAB_002A		;00bc: 4eb9000001b0
+	BSR.W	LAB_001D		;00c2: 6100006c
+LAB_0015:
+	BSR.W	LAB_001D		;00c6: 61000068
+	DBF	D5,LAB_0015		;00ca: 51cdfffa
+	BSR.W	LAB_001D		;00ce: 61000060
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+	LEA	(LAB_0007,PC),A0	;00d2: 41faff66
+LAB_0016:
+	BSR.W	LAB_002A		;00d6: 610000d8
+	DBF	D3,LAB_0016		;00da: 51cbfffa
+	LEA	LAB_00B3,A4		;00de: 49f9000007bc
+	ADD.W	D0,D0			;00e4: d040
+	MOVE.W	(LAB_0017,PC,D0.W),D0	;00e6: 303b0006
+	JMP	(LAB_0017,PC,D0.W)	;00ea: 4efb0002
+LAB_0017:
+	DC.W	$000c			;00ee
+	ORI.B	#$14,(A0)		;00f0: 00100014
+	ORI.B	#$1c,(A0)+		;00f4: 0018001c
+	DC.W	$0020			;00f8
+; call site 21
+	MOVEQ	#0,D0			;00fa: 7000
+LAB_0018:
+	RTS				;00fc: 4e75
+	MOVEQ	#1,D0			;00fe: 7001
+	RTS				;0100: 4e75
+	MOVEQ	#2,D0			;0102: 7002
+	RTS				;0104: 4e75
+	MOVEQ	#3,D0			;0106: 7003
+	RTS				;0108: 4e75
+	MOVEQ	#4,D0			;010a: 7004
+	RTS				;010c: 4e75
+	MOVEQ	#5,D0			;010e: 7005
+	RTS				;0110: 4e75
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+LAB_0019:
+	BSR.W	LAB_001D		;0112: 6100001c
+	TST.L	D4			;0116: 4a84
+LAB_001A:
+	BSR.W	LAB_001D		;0118: 61000016
+	DBF	D0,LAB_001A		;011c: 51c8fffa
+	BSR.W	LAB_0033		;0120: 610000e2
+	BNE.S	LAB_001A		;0124: 66f2
+LAB_001B:
+	BSR.W	LAB_001D		;0126: 61000008
+func_0_203:
+	DBF	D0,LAB_001B		;012a: 51c8fffa
+	RTS				;012e: 4e75
+LAB_001D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0130: 48e73f3e
+	BSR.W	LAB_002A		;0134: 6100007a
+	LEA	LAB_00D2+4,A6		;0138: 4df900000964
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_001E:
+	BSR.W	LAB_002A		;013e: 61000070
+	BNE.S	LAB_001E		;0142: 66fa
+LAB_001F:
+	JSR	(-744,A6)		;0144: 4eaefd18
+	BNE.S	LAB_001F		;0148: 66fa
+LAB_0020:
+	LEA	(LAB_0020,PC),A0	;014a: 41fafffe
+	LEA	(LAB_0014,PC),A4	;014e: 49faff6c
+	ADDQ.L	#2,A0			;0152: 5488
+func_0_119:
+	BNE.S	LAB_0020		;0154: 66f4
+LAB_0022:
+	BSR.W	LAB_002A		;0156: 61000058
+	DBF	D0,LAB_0022		;015a: 51c8fffa
+	BSR.W	LAB_0033		;015e: 610000a4
+LAB_0023:
+	CMP.L	#$0000179c,D7		;0162: bebc0000179c
+LAB_0024:
+	BSR.W	LAB_003C		;0168: 610000fa
+LAB_0025:
+	ADD.L	D5,D1			;016c: d285
+LAB_0026:
+; call site 210
+	BNE.S	LAB_0025		;016e: 66fc
+	BNE.S	LAB_0024		;0170: 66f6
+	CMPI.L	#$0000000e,D3		;0172: 0c830000000e
+	MOVE.L	(12850,A5),D2		;0178: 242d3232
+	ADDQ.L	#7,A6			;017c: 5e8e
+func_0_35:
+	LEA	LAB_0099,A4		;017e: 49f900000694
+	BSR.W	LAB_002A		;0184: 6100002a
+	MOVE.L	(24826,A5),D1		;0188: 222d60fa
+	ADD.L	D6,D3			;018c: d686
+	LEA	(LAB_0011+2,PC),A4	;018e: 49faff04
+	JSR	LAB_002A		;0192: 4eb9000001b0
+	ADDQ.L	#quick_9,A2		;0198: 5e8a
+LAB_0028:
+; call site 126
+	JSR	(-282,A6)		;019a: 4eaefee6
+	MOVE.W	(16334,A5),(11569,A5)	;019e: 3b6d3fce2d31
+	ADD.L	D5,D7			;01a4: de85
+LAB_0029:
+	BNE.S	LAB_0028		;01a6: 66f2
+	BNE.S	LAB_0029		;01a8: 66fc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;01aa: 4cdf7cfc
+	RTS				;01ae: 4e75
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+LAB_002A:
+	LINK.W	A5,#-92			;01b0: 4e55ffa4
+	BSR.W	LAB_0033		;01b4: 6100004e
+	TST.L	D1			;01b8: 4a81
+	MOVE.L	D2,D4			;01ba: 2802
+	ADD.L	D2,D1			;01bc: d282
+LAB_002B:
+; call site 42
+	MOVEQ	#20,D5			;01be: 7a14
+LAB_002C:
+	DBF	D4,LAB_002B		;01c0: 51ccfffc
+	ADD.L	D1,D5			;01c4: da81
+	BSR.W	LAB_0033		;01c6: 6100003c
+	LEA	(LAB_0022,PC),A6	;01ca: 4dfaff8a
+	BSR.W	LAB_003C		;01ce: 61000094
+	MOVE.L	#LAB_000E,-(A7)		;01d2: 2f3c0000007e
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	JSR	LAB_003E		;01d8: 4eb9000002a0
+	CMPI.L	#$00000063,D6		;01de: 0c8600000063
+	MOVE.L	(5690,A5),D0		;01e4: 202d163a
+LAB_002D:
+	CMPI.L	#$0000009d,D7		;01e8: 0c870000009d
+LAB_002F:
+	BNE.S	LAB_002D		;01ee: 66f8
+	BNE.S	LAB_002F		;01f0: 66fc
+	MOVE.L	D1,D6			;01f2: 2c01
+func_0_224:
+	BRA.S	LAB_0031		;01f4: 600a
+	SUBQ.W	#3,(29291,A7)		;01f6: 576f726b
+	DC.W	$6265			;01fa
+	DC.W	$6e63			;01fc
+	DC.W	$6800			;01fe
+LAB_0031:
+	UNLK	A5			;0200: 4e5d
+LAB_0032:
+	RTS				;0202: 4e75
+LAB_0033:
+	BSR.W	LAB_003C		;0204: 6100005e
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	CMP.L	#$00003eed,D3		;0208: b6bc00003eed
+	CMPI.L	#$000000d2,D0		;020e: 0c80000000d2
+	MOVE.L	#LAB_0065,-(A7)		;0214: 2f3c00000474
+	JSR	LAB_0050		;021a: 4eb900000332
+	MOVE.L	#LAB_007D+2,-(A7)	;0220: 2f3c0000056a
+	JSR	(-654,A6)		;0226: 4eaefd72
+	ADDQ.L	#1,A0			;022a: 5288
+func_0_140:
+	JSR	LAB_0050		;022c: 4eb900000332
+	MOVE.L	#LAB_013E,-(A7)		;0232: 2f3c00000d92
+	JSR	LAB_003E		;0238: 4eb9000002a0
+LAB_0035:
+	LEA	LAB_0133,A6		;023e: 4df900000d0a
+LAB_0036:
+	BNE.S	LAB_0035		;0244: 66f8
+	DBF	D4,LAB_0036		;0246: 51ccfffc
+	ADDQ.L	#5,A5			;024a: 5a8d
+LAB_0037:
+; call site 231
+	LEA	(LAB_002F,PC),A2	;024c: 45faffa0
+LAB_0038:
+	DBF	D4,LAB_0037		;0250: 51ccfffa
+	BSR.W	LAB_003C		;0254: 6100000e
+	JSR	(-210,A6)		;0258: 4eaeff2e
+LAB_0039:
+	BNE.S	LAB_0038		;025c: 66f2
+func_0_56:
+LAB_003A:
+	DBF	D3,LAB_0039		;025e: 51cbfffc
+	RTS				;0262: 4e75
+LAB_003C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0264: 48e73f3e
+	BSR.W	LAB_003E		;0268: 61000036
+	MOVE.L	(26998,A5),D3		;026c: 262d6976
+	MOVEQ	#7,D1			;0270: 7207
+	BRA.S	LAB_003D		;0272: 600c
+	DC.W	$646f			;0274
+	DC.W	$732e			;0276
+	DC.W	$6c69			;0278
+	BHI.S	LAB_0046+2		;027a: 6272
+	BSR.S	LAB_0047		;027c: 6172
+	DC.W	$7900			;027e
+LAB_003D:
+; call site 147
+	MOVEQ	#100,D1			;0280: 7264
+	BNE.S	LAB_003D		;0282: 66fc
+	JSR	LAB_003E		;0284: 4eb9000002a0
+	MOVE.L	(23682,A5),D4		;028a: 282d5c82
+	LEA	LAB_016E,A4		;028e: 49f900000f0a
+	JSR	LAB_0050		;0294: 4eb900000332
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;029a: 4cdf7cfc
+; ------------------------------------------------------------------------------
+; function 238
+; ------------------------------------------------------------------------------
+	RTS				;029e: 4e75
+LAB_003E:
+	LINK.W	A5,#-76			;02a0: 4e55ffb4
+	BSR.W	LAB_0050		;02a4: 6100008c
+LAB_003F:
+	MOVE.W	(11690,A5),(26225,A5)	;02a8: 3b6d2daa6671
+	TST.L	D5			;02ae: 4a85
+LAB_0040:
+; call site 63
+	JSR	(-84,A6)		;02b0: 4eaeffac
+	BNE.S	LAB_003F		;02b4: 66f2
+	BNE.S	LAB_0040		;02b6: 66f8
+	MOVE.L	#LAB_0009,-(A7)		;02b8: 2f3c00000048
+LAB_0041:
+	LEA	(LAB_003A+2,PC),A4	;02be: 49faffa0
+	BRA.S	LAB_0044		;02c2: 6012
+LAB_0042:
+	BEQ.S	LAB_0051+2		;02c4: 6772
+LAB_0043:
+	BSR.S	LAB_0051+2		;02c6: 6170
+	DC.W	$6869			;02c8
+	DC.W	$6373			;02ca
+	MOVEA.L	(26978,A4),A7		;02cc: 2e6c6962
+	MOVEQ	#97,D1			;02d0: 7261
+	MOVEQ	#121,D1			;02d2: 7279
+	DC.W	$0000			;02d4
+LAB_0044:
+	CMP.L	#$0000df55,D5		;02d6: babc0000df55
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_0041		;02dc: 66e0
+LAB_0045:
+	CMP.L	#$0000146b,D0		;02de: b0bc0000146b
+	BSR.W	LAB_005F		;02e4: 610000de
+	BNE.S	LAB_0045		;02e8: 66f4
+	ADDQ.L	#1,A1			;02ea: 5289
+LAB_0046:
+	JSR	(-720,A6)		;02ec: 4eaefd30
+LAB_0047:
+	MOVEQ	#62,D4			;02f0: 783e
+LAB_0048:
+	LEA	(LAB_0018,PC),A0	;02f2: 41fafe08
+LAB_0049:
+	MOVEQ	#125,D4			;02f6: 787d
+	BSR.W	LAB_0050		;02f8: 61000038
+LAB_004A:
+	BRA.S	LAB_004B		;02fc: 6008
+	DC.W	$4572			;02fe
+	MOVEQ	#111,D1			;0300: 726f
+	MOVEQ	#58,D1			;0302: 723a
+	MOVE.L	D0,D0			;0304: 2000
+LAB_004B:
+	BNE.S	LAB_0049		;0306: 66ee
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_004A		;0308: 66f2
+	MOVE.W	(24338,A5),(5676,A5)	;030a: 3b6d5f12162c
+	MOVEQ	#-73,D2			;0310: 74b7
+	LEA	LAB_0061,A0		;0312: 41f90000043a
+LAB_004C:
+	MOVE.L	D3,D1			;0318: 2203
+	DBF	D5,LAB_004C		;031a: 51cdfffc
+LAB_004D:
+	BSR.W	LAB_005F		;031e: 610000a4
+func_0_161:
+	DBF	D6,LAB_004D		;0322: 51cefffa
+	ADD.L	D1,D2			;0326: d481
+	MOVE.W	(14566,A5),(25111,A5)	;0328: 3b6d38e66217
+LAB_004F:
+	UNLK	A5			;032e: 4e5d
+	RTS				;0330: 4e75
+LAB_0050:
+	LINK.W	A5,#-180		;0332: 4e55ff4c
+LAB_0051:
+	BSR.W	LAB_005F		;0336: 6100008c
+LAB_0053:
+	DBF	D3,LAB_0051		;033a: 51cbfffa
+LAB_0054:
+	LEA	(LAB_0043,PC),A4	;033e: 49faff86
+LAB_0055:
+	BNE.S	LAB_0054		;0342: 66fa
+LAB_0056:
+	DBF	D3,LAB_0055		;0344: 51cbfffc
+	MOVE.L	D5,D5			;0348: 2a05
+func_0_77:
+	BNE.S	LAB_0056		;034a: 66f8
+	LEA	LAB_00E6+2,A6		;034c: 4df900000a20
+	ADD.L	D2,D3			;0352: d682
+LAB_0058:
+	LEA	LAB_00DF,A6		;0354: 4df9000009ee
+	MOVE.L	#LAB_01DF,-(A7)		;035a: 2f3c0000144a
+	MOVE.L	D6,D3			;0360: 2606
+	CMPI.L	#$00000013,D2		;0362: 0c8200000013
+; call site 168
+	BSR.W	LAB_005F		;0368: 6100005a
+	MOVE.L	(29078,A5),D4		;036c: 282d7196
+LAB_0059:
+	MOVE.L	#LAB_0068,-(A7)		;0370: 2f3c0000049a
+	DBF	D7,LAB_0059		;0376: 51cffff8
+LAB_005A:
+	MOVE.L	D7,D3			;037a: 2607
+LAB_005B:
+	DBF	D1,LAB_005A		;037c: 51c9fffc
+	DBF	D6,LAB_005B		;0380: 51cefffa
+	JSR	(-174,A6)		;0384: 4eaeff52
+LAB_005C:
+	MOVE.L	#LAB_00A6,-(A7)		;0388: 2f3c00000728
+	MOVEQ	#105,D1			;038e: 7269
+	CMP.L	#$00004001,D4		;0390: b8bc00004001
+	CMP.L	#value_17,D7		;0396: bebc00008b4c
+; call site 84
+	ADD.L	D3,D0			;039c: d083
+	BSR.W	LAB_005F		;039e: 61000024
+LAB_005D:
+	JSR	(-456,A6)		;03a2: 4eaefe38
+	DBF	D7,LAB_005D		;03a6: 51cffffa
+LAB_005E:
+	BSR.W	LAB_005F		;03aa: 61000018
+	CMPI.L	#$000000f2,D6		;03ae: 0c86000000f2
+	MOVE.W	(31977,A5),(2640,A5)	;03b4: 3b6d7ce90a50
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+	CMP.L	#$00006434,D7		;03ba: bebc00006434
+	UNLK	A5			;03c0: 4e5d
+	RTS				;03c2: 4e75
+LAB_005F:
+	JSR	SECSTRT_2		;03c4: 4eb900000500
+	NOP				;03ca: 4e71
+	NOP				;03cc: 4e71
+	NOP				;03ce: 4e71
+	NOP				;03d0: 4e71
+	NOP				;03d2: 4e71
+	NOP				;03d4: 4e71
+	NOP				;03d6: 4e71
+	NOP				;03d8: 4e71
+	NOP				;03da: 4e71
+	NOP				;03dc: 4e71
+	NOP				;03de: 4e71
+	NOP				;03e0: 4e71
+	NOP				;03e2: 4e71
+	NOP				;03e4: 4e71
+	NOP				;03e6: 4e71
+	NOP				;03e8: 4e71
+	NOP				;03ea: 4e71
+	NOP				;03ec: 4e71
+	NOP				;03ee: 4e71
+	NOP				;03f0: 4e71
+	NOP				;03f2: 4e71
+	NOP				;03f4: 4e71
+	NOP				;03f6: 4e71
+	NOP				;03f8: 4e71
+	NOP				;03fa: 4e71
+	NOP				;03fc: 4e71
+	RTS				;03fe: 4e75
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	DC.L	$47fb4e5b,$38449725,$5f942585,$26ff9c46 ;0400
+	DC.L	$0e2fc57b,$5788eab5,$303c921f,$08a0b5ea ;0410
+	DC.L	$4439f12e		;0420
+LAB_0060:
+	;0424
+	;DC.B	$52,$65,$61,$64,$79,$2e,$00,$00
+	DC.B	"Ready.",0,0
+	DC.L	func_6_161		;042c: 000013ba
+	DC.L	$2bdf0438		;0430
+	;0434
+	;DC.B	$45,$72,$72,$6f,$72,$3a
+	DC.B	"Error:"
+LAB_0061:
+	DC.W	$2000			;043a
+	DC.L	LAB_0138		;043c: 00000d38
+	DC.L	LAB_00FB		;0440: 00000aa4
+	;0444
+	;DC.B	$25,$73,$3a,$20
+	DC.B	"%s: "
+LAB_0062:
+	;0448
+	;DC.B	$25,$6c,$64,$0a,$00,$00
+	DC.B	"%ld",10,0,0
+LAB_0063:
+	DC.L	$540f2a49		;044e
+	DC.W	$5169			;0452
+LAB_0064:
+	DC.L	$90c2708d		;0454
+	DC.W	$5c5b			;0458
+	DC.L	LAB_00D8		;045a: 000009a8
+	DC.L	$7958d9db		;045e
+	DC.L	LAB_0126		;0462: 00000c50
+	DC.L	$39a97081,$2c919025,$3dbfbd4a ;0466
+	DC.W	$5fd5			;0472
+LAB_0065:
+	DC.L	$ac56037e		;0474
+	DC.W	$672e			;0478
+LAB_0066:
+	DC.L	LAB_019B		;047a: 0000110e
+	DC.W	$46f3			;047e
+LAB_0067:
+	DC.L	$b50f0c16,$639352ac	;0480
+	DC.W	$4e70			;0488
+	;048a
+	;DC.B	$69,$6e,$74,$75,$69,$74,$69,$6f,$6e,$2e,$6c,$69,$62,$72,$61,$72
+	DC.B	"intuition.librar"
+LAB_0068:
+	DC.L	$79000ae0,$fda75b9f,$887e0cb6,$5b045be0 ;049a
+	DC.L	$35f17f9f		;04aa
+	DC.W	$7e55			;04ae
+LAB_0069:
+	DC.L	$71e4cdb1		;04b0
+LAB_006A:
+	DC.L	LAB_0142		;04b4: 00000dc4
+LAB_006B:
+	DC.L	$3acbbc70		;04b8
+	DC.W	$17f8			;04bc
+LAB_006C:
+	DC.W	$7dbf			;04be
+	DC.L	LAB_01EC		;04c0: 000014e0
+	DC.W	$76e5			;04c4
+LAB_006D:
+	DC.L	$98dd212b,$66e276fd	;04c6
+	DC.W	$3e6f			;04ce
+	DC.L	LAB_0060		;04d0: 00000424
+	DC.L	$355ccbe9		;04d4
+	DS.L	3			;04d8
+LAB_006E:
+	DS.L	1			;04e4
+LAB_006F:
+	DS.L	4			;04e8
+	DS.W	1			;04f8
+LAB_0070:
+	DS.L	1			;04fa
+	DS.W	1			;04fe
+
+
+	SECTION S_2,CODE
+
+SECSTRT_2:
+; call site 0
+	LINK.W	A5,#-100		;0500: 4e55ff9c
+	BSR.W	LAB_007B		;0504: 6100004a
+LAB_0072:
+	MOVE.L	#LAB_013B,-(A7)		;0508: 2f3c00000d6c
+func_2_119:
+	JSR	(-798,A6)		;050e: 4eaefce2
+	ADDQ.L	#2,A7			;0512: 548f
+LAB_0074:
+	CMP.L	#$000006ad,D6		;0514: bcbc000006ad
+LAB_0075:
+	CMP.L	#$00003785,D3		;051a: b6bc00003785
+LAB_0076:
+	CMP.L	#$0000ef94,D7		;0520: bebc0000ef94
+	DBF	D3,LAB_0076		;0526: 51cbfff8
+	MOVE.L	(27282,A5),D1		;052a: 222d6a92
+	MOVE.W	(25397,A5),(20147,A5)	;052e: 3b6d63354eb3
+LAB_0078:
+	LEA	(func_2_119,PC),A2	;0534: 45faffd8
+	LEA	(LAB_0074+2,PC),A0	;0538: 41faffdc
+	CMPI.L	#$000000da,D1		;053c: 0c81000000da
+; call site 42
+	ADDQ.L	#7,A1			;0542: 5e89
+	ADDQ.L	#7,A7			;0544: 5e8f
+LAB_0079:
+	ADD.L	D1,D4			;0546: d881
+func_2_161:
+	DBF	D4,LAB_0079		;0548: 51ccfffc
+	UNLK	A5			;054c: 4e5d
+	RTS				;054e: 4e75
+LAB_007B:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0550: 48e73f3e
+	BSR.W	LAB_0086		;0554: 61000066
+	LEA	LAB_002D+2,A4		;0558: 49f9000001ea
+	ADDQ.L	#quick_25,A0		;055e: 5a88
+	MOVE.L	D4,D7			;0560: 2e04
+LAB_007C:
+	CMPI.L	#$00000078,D0		;0562: 0c8000000078
+LAB_007D:
+	DBF	D0,LAB_007C		;0568: 51c8fff8
+	JSR	(-594,A6)		;056c: 4eaefdae
+LAB_007E:
+; call site 84
+	MOVE.W	(2940,A5),(17258,A5)	;0570: 3b6d0b7c436a
+	MOVE.L	D1,D1			;0576: 2201
+LAB_007F:
+	JSR	LAB_0093		;0578: 4eb900000654
+func_2_203:
+	DBF	D6,LAB_007F		;057e: 51cefff8
+LAB_0081:
+	BSR.W	LAB_00A4		;0582: 61000182
+	DBF	D5,LAB_0081		;0586: 51cdfffa
+	BNE.S	LAB_0081		;058a: 66f6
+LAB_0082:
+	MOVE.L	D7,D4			;058c: 2807
+	MOVE.L	D6,D1			;058e: 2206
+	BNE.S	LAB_0082		;0590: 66fa
+	LEA	LAB_006E,A6		;0592: 4df9000004e4
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+LAB_0083:
+	MOVE.W	(22672,A5),(3105,A5)	;0598: 3b6d58900c21
+	DBF	D1,LAB_0083		;059e: 51c9fff8
+	BSR.W	LAB_0093		;05a2: 610000b0
+; call site 126
+	BSR.W	LAB_0086		;05a6: 61000014
+LAB_0084:
+	LEA	LAB_0063,A6		;05aa: 4df90000044e
+LAB_0085:
+	LEA	LAB_0045,A2		;05b0: 45f9000002de
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;05b6: 4cdf7cfc
+	RTS				;05ba: 4e75
+LAB_0086:
+	LINK.W	A5,#-180		;05bc: 4e55ff4c
+	BSR.W	LAB_0093		;05c0: 61000092
+LAB_0087:
+	BSR.W	LAB_00A4		;05c4: 61000140
+LAB_0088:
+	DBF	D3,LAB_0087		;05c8: 51cbfffa
+	BNE.S	LAB_0087		;05cc: 66f6
+	MOVEQ	#115,D3			;05ce: 7673
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	MOVE.L	D7,D3			;05d0: 2607
+	CMPI.L	#$000000ab,D2		;05d2: 0c82000000ab
+	ADDQ.L	#5,A2			;05d8: 5a8a
+; call site 168
+	CMPI.L	#$0000002e,D2		;05da: 0c820000002e
+LAB_0089:
+	JSR	LAB_0093		;05e0: 4eb900000654
+	BNE.S	LAB_0089		;05e6: 66f8
+	BSR.W	LAB_0093		;05e8: 6100006a
+LAB_008A:
+	LEA	(LAB_0072+4,PC),A2	;05ec: 45faff1e
+LAB_008B:
+	DBF	D0,LAB_008A		;05f0: 51c8fffa
+LAB_008C:
+	CMP.L	#$0000b010,D4		;05f4: b8bc0000b010
+LAB_008D:
+	BNE.S	LAB_008C		;05fa: 66f8
+	DBF	D1,LAB_008D		;05fc: 51c9fffc
+LAB_008E:
+	CMP.L	#$00003eb3,D6		;0600: bcbc00003eb3
+	DBF	D6,LAB_008E		;0606: 51cefff8
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+	JSR	LAB_0093		;060a: 4eb900000654
+	BSR.W	LAB_0093		;0610: 61000042
+LAB_008F:
+	MOVE.L	(134,A5),D5		;0614: 2a2d0086
+; call site 210
+	DBF	D3,LAB_008F		;0618: 51cbfffa
+	LEA	(LAB_0078+2,PC),A6	;061c: 4dfaff18
+	ADD.W	D0,D0			;0620: d040
+	MOVE.W	(LAB_0090,PC,D0.W),D0	;0622: 303b0006
+	JMP	(LAB_0090,PC,D0.W)	;0626: 4efb0002
+LAB_0090:
+	DC.W	$000e			;062a
+	ORI.B	#$16,(A2)		;062c: 00120016
+	ORI.B	#$1e,(A2)+		;0630: 001a001e
+	ORI.B	#$26,-(A2)		;0634: 00220026
+	MOVEQ	#0,D0			;0638: 7000
+	RTS				;063a: 4e75
+	MOVEQ	#1,D0			;063c: 7001
+LAB_0091:
+	RTS				;063e: 4e75
+	MOVEQ	#2,D0			;0640: 7002
+	RTS				;0642: 4e75
+	MOVEQ	#3,D0			;0644: 7003
+	RTS				;0646: 4e75
+	MOVEQ	#4,D0			;0648: 7004
+	RTS				;064a: 4e75
+func_2_14:
+	MOVEQ	#5,D0			;064c: 7005
+	RTS				;064e: 4e75
+	MOVEQ	#6,D0			;0650: 7006
+	RTS				;0652: 4e75
+LAB_0093:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0654: 48e73f3e
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_00A4		;0658: 610000ac
+	MOVE.L	#LAB_01E1+2,-(A7)	;065c: 2f3c0000145e
+	CMP.L	#$0000385c,D5		;0662: babc0000385c
+	BSR.W	LAB_00BA		;0668: 610001ae
+LAB_0094:
+	BSR.W	LAB_00BA		;066c: 610001aa
+	MOVEQ	#127,D0			;0670: 707f
+	BNE.S	LAB_0094		;0672: 66f8
+	JSR	LAB_00BA		;0674: 4eb900000818
+LAB_0096:
+	CMP.L	#$0000fd49,D7		;067a: bebc0000fd49
+LAB_0097:
+	BNE.S	LAB_0096		;0680: 66f8
+	DBF	D6,LAB_0097		;0682: 51cefffc
+func_2_56:
+	LEA	(func_2_203,PC),A2	;0686: 45fafef6
+	DBF	D1,func_2_56		;068a: 51c9fffa
+	MOVE.L	#LAB_0045,-(A7)		;068e: 2f3c000002de
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+LAB_0099:
+	CMPI.L	#$00000083,D2		;0694: 0c8200000083
+LAB_009A:
+	BSR.W	LAB_00A4		;069a: 6100006a
+	MOVEQ	#-76,D1			;069e: 72b4
+	BNE.S	LAB_009A		;06a0: 66f8
+LAB_009B:
+	ADD.L	D6,D7			;06a2: de86
+	DBF	D6,LAB_009B		;06a4: 51cefffc
+	CMPI.L	#$00000077,D3		;06a8: 0c8300000077
+	LEA	LAB_01F8,A6		;06ae: 4df900001560
+	MOVE.L	(9028,A5),D2		;06b4: 242d2344
+	MOVE.L	#LAB_017F,-(A7)		;06b8: 2f3c00000fac
+	ADDQ.L	#5,A6			;06be: 5a8e
+func_2_98:
+	LEA	(LAB_007E+2,PC),A4	;06c0: 49fafeb0
+	ADD.L	D0,D7			;06c4: de80
+	ADDQ.L	#2,A2			;06c6: 548a
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+LAB_009D:
+	LEA	(func_2_98,PC),A0	;06c8: 41fafff6
+LAB_009E:
+	DBF	D6,LAB_009D		;06cc: 51cefffa
+	DBF	D2,LAB_009E		;06d0: 51cafffa
+	JSR	(-282,A6)		;06d4: 4eaefee6
+LAB_009F:
+	MOVE.L	(22822,A5),D2		;06d8: 242d5926
+LAB_00A0:
+	DBF	D2,LAB_009F		;06dc: 51cafffa
+	DBF	D3,LAB_00A0		;06e0: 51cbfffa
+LAB_00A1:
+	LEA	(LAB_0076+4,PC),A0	;06e4: 41fafe3e
+; call site 21
+	DBF	D0,LAB_00A1		;06e8: 51c8fffa
+	CMP.L	#value_33,D3		;06ec: b6bc0000ed0f
+	BSR.W	LAB_00A4		;06f2: 61000012
+func_2_140:
+LAB_00A2:
+	BSR.W	LAB_00A4		;06f6: 6100000e
+	ADDQ.L	#4,A7			;06fa: 588f
+	LEA	(LAB_0075+4,PC),A4	;06fc: 49fafe20
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0700: 4cdf7cfc
+	RTS				;0704: 4e75
+LAB_00A4:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0706: 48e73f3e
+	BSR.W	LAB_00AE		;070a: 61000078
+	MOVE.W	(10692,A5),(151,A5)	;070e: 3b6d29c40097
+	CMP.L	#$0000994f,D7		;0714: bebc0000994f
+LAB_00A5:
+	MOVE.L	#LAB_0139,-(A7)		;071a: 2f3c00000d4c
+	ADDQ.L	#6,A3			;0720: 5c8b
+; call site 63
+	JSR	LAB_00AE		;0722: 4eb900000784
+LAB_00A6:
+	BNE.S	LAB_00A5		;0728: 66f0
+	DBF	D0,LAB_00A6		;072a: 51c8fffc
+func_2_182:
+	MOVE.L	#LAB_0147,-(A7)		;072e: 2f3c00000df6
+LAB_00A8:
+	DBF	D1,func_2_182		;0734: 51c9fff8
+LAB_00A9:
+	DBF	D5,LAB_00A8		;0738: 51cdfffa
+LAB_00AA:
+	DBF	D5,LAB_00A9		;073c: 51cdfffa
+LAB_00AB:
+	BNE.S	LAB_00AA		;0740: 66fa
+	BNE.S	LAB_00AB		;0742: 66fc
+LAB_00AC:
+	BSR.W	LAB_00C4		;0744: 61000148
+	DBF	D4,LAB_00AC		;0748: 51ccfffa
+	MOVE.L	(19366,A5),D3		;074c: 262d4ba6
+	LEA	(LAB_0091,PC),A6	;0750: 4dfafeec
+	LEA	LAB_013A,A2		;0754: 45f900000d60
+; call site 105
+	BSR.W	LAB_00AE		;075a: 61000028
+LAB_00AD:
+	JSR	(-924,A6)		;075e: 4eaefc64
+	DBF	D3,LAB_00AD		;0762: 51cbfffa
+	MOVEQ	#26,D6			;0766: 7c1a
+	ADD.L	D7,D3			;0768: d687
+	LEA	(LAB_0082,PC),A4	;076a: 49fafe20
+	MOVE.L	#LAB_0124,-(A7)		;076e: 2f3c00000c46
+	BSR.W	LAB_00C4		;0774: 61000118
+	CMP.L	#$000043e5,D3		;0778: b6bc000043e5
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;077e: 4cdf7cfc
+	RTS				;0782: 4e75
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_00AE:
+	BSR.W	LAB_00BA		;0784: 61000092
+	BSR.W	LAB_00C4		;0788: 61000104
+; call site 147
+	CMP.L	#$0000691f,D3		;078c: b6bc0000691f
+	ADDQ.L	#1,A2			;0792: 528a
+	BSR.W	LAB_00C4		;0794: 610000f8
+	MOVE.L	#LAB_0137,-(A7)		;0798: 2f3c00000d36
+	MOVE.W	(11737,A5),(28354,A5)	;079e: 3b6d2dd96ec2
+	LEA	LAB_0132,A6		;07a4: 4df900000d08
+LAB_00AF:
+	MOVE.L	(5082,A5),D7		;07aa: 2e2d13da
+	BSR.W	LAB_00C4		;07ae: 610000de
+LAB_00B1:
+	CMPI.L	#$00000065,D1		;07b2: 0c8100000065
+LAB_00B2:
+	DBF	D5,LAB_00B1		;07b8: 51cdfff8
+LAB_00B3:
+	MOVE.L	#LAB_0134,-(A7)		;07bc: 2f3c00000d14
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+LAB_00B4:
+	BNE.S	LAB_00B2		;07c2: 66f4
+	DBF	D5,LAB_00B4		;07c4: 51cdfffc
+	JSR	(-834,A6)		;07c8: 4eaefcbe
+; call site 189
+	MOVE.L	(1384,A5),D1		;07cc: 222d0568
+	BSR.W	LAB_00C4		;07d0: 610000bc
+	BRA.S	LAB_00B5		;07d4: 600e
+	DC.W	$4f75			;07d6
+	MOVEQ	#32,D2			;07d8: 7420
+	BLE.S	LAB_00BD		;07da: 6f66
+	MOVEA.L	(25965,A5),A0		;07dc: 206d656d
+	BLE.S	LAB_00BF		;07e0: 6f72
+	DC.W	$7900			;07e2
+LAB_00B5:
+	CMPI.L	#$00000004,D7		;07e4: 0c8700000004
+LAB_00B6:
+	JSR	LAB_00BA		;07ea: 4eb900000818
+LAB_00B7:
+	MOVE.L	#LAB_005E,-(A7)		;07f0: 2f3c000003aa
+	BSR.W	LAB_00C4		;07f6: 61000096
+	BNE.S	LAB_00B6		;07fa: 66ee
+LAB_00B8:
+	MOVE.L	#LAB_005C+2,-(A7)	;07fc: 2f3c0000038a
+	BNE.S	LAB_00B8		;0802: 66f8
+	LEA	(LAB_00A2+2,PC),A6	;0804: 4dfafef2
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	MOVE.L	D6,D0			;0808: 2006
+LAB_00B9:
+	MOVE.L	#LAB_0195,-(A7)		;080a: 2f3c000010d0
+	BNE.S	LAB_00B9		;0810: 66f8
+	BSR.W	LAB_00BA		;0812: 61000004
+	RTS				;0816: 4e75
+LAB_00BA:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0818: 48e73f3e
+	BSR.W	LAB_00C4		;081c: 61000070
+LAB_00BB:
+	ADDQ.L	#4,A7			;0820: 588f
+	JSR	LAB_00C4		;0822: 4eb90000088e
+	JSR	(-48,A6)		;0828: 4eaeffd0
+	BNE.S	LAB_00BB		;082c: 66f2
+func_2_35:
+	JSR	(-768,A6)		;082e: 4eaefd00
+	DBF	D2,func_2_35		;0832: 51cafffa
+	MOVE.L	D2,D3			;0836: 2602
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+	MOVE.L	#LAB_0141,-(A7)		;0838: 2f3c00000dc2
+	BSR.W	LAB_00C4		;083e: 6100004e
+LAB_00BD:
+	LEA	LAB_002C,A0		;0842: 41f9000001c0
+LAB_00BE:
+	LEA	(LAB_0085,PC),A4	;0848: 49fafd66
+	MOVE.L	#LAB_00F5+2,-(A7)	;084c: 2f3c00000a7e
+	BNE.S	LAB_00BE		;0852: 66f4
+LAB_00BF:
+	ADD.L	D2,D4			;0854: d882
+	DBF	D7,LAB_00BF		;0856: 51cffffc
+	BSR.W	LAB_00C4		;085a: 61000032
+	CMPI.L	#$0000003a,D6		;085e: 0c860000003a
+	MOVE.L	D4,D5			;0864: 2a04
+func_2_77:
+	MOVE.L	D2,D4			;0866: 2802
+	DBF	D6,func_2_77		;0868: 51cefffc
+	ADDQ.L	#quick_41,A3		;086c: 548b
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+	BRA.S	LAB_00C1		;086e: 600c
+	MOVEQ	#111,D2			;0870: 746f
+	MOVEQ	#97,D0			;0872: 7061
+	MOVEQ	#46,D5			;0874: 7a2e
+	DC.W	$666f			;0876
+	BGT.S	LAB_00C6		;0878: 6e74
+	DC.W	$0000			;087a
+LAB_00C1:
+	LEA	(LAB_0094+2,PC),A4	;087c: 49fafdf0
+LAB_00C2:
+	DBF	D3,LAB_00C1		;0880: 51cbfffa
+	DBF	D0,LAB_00C2		;0884: 51c8fffa
+LAB_00C3:
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0888: 4cdf7cfc
+	RTS				;088c: 4e75
+LAB_00C4:
+	JSR	SECSTRT_3		;088e: 4eb900000900
+	NOP				;0894: 4e71
+	NOP				;0896: 4e71
+	NOP				;0898: 4e71
+	NOP				;089a: 4e71
+	NOP				;089c: 4e71
+	NOP				;089e: 4e71
+	NOP				;08a0: 4e71
+	NOP				;08a2: 4e71
+	NOP				;08a4: 4e71
+	NOP				;08a6: 4e71
+	NOP				;08a8: 4e71
+	NOP				;08aa: 4e71
+	NOP				;08ac: 4e71
+	NOP				;08ae: 4e71
+	NOP				;08b0: 4e71
+	NOP				;08b2: 4e71
+	NOP				;08b4: 4e71
+	NOP				;08b6: 4e71
+	NOP				;08b8: 4e71
+	NOP				;08ba: 4e71
+	NOP				;08bc: 4e71
+	NOP				;08be: 4e71
+	NOP				;08c0: 4e71
+	NOP				;08c2: 4e71
+	NOP				;08c4: 4e71
+	NOP				;08c6: 4e71
+	NOP				;08c8: 4e71
+	NOP				;08ca: 4e71
+	NOP				;08cc: 4e71
+	NOP				;08ce: 4e71
+	NOP				;08d0: 4e71
+	NOP				;08d2: 4e71
+	NOP				;08d4: 4e71
+	NOP				;08d6: 4e71
+	NOP				;08d8: 4e71
+LAB_00C5:
+	NOP				;08da: 4e71
+	NOP				;08dc: 4e71
+	NOP				;08de: 4e71
+	NOP				;08e0: 4e71
+	NOP				;08e2: 4e71
+	NOP				;08e4: 4e71
+	NOP				;08e6: 4e71
+	NOP				;08e8: 4e71
+	NOP				;08ea: 4e71
+	NOP				;08ec: 4e71
+LAB_00C6:
+	NOP				;08ee: 4e71
+	NOP				;08f0: 4e71
+	NOP				;08f2: 4e71
+	NOP				;08f4: 4e71
+	NOP				;08f6: 4e71
+	NOP				;08f8: 4e71
+	NOP				;08fa: 4e71
+	NOP				;08fc: 4e71
+	RTS				;08fe: 4e75
+
+
+	SECTION S_3,CODE
+
+SECSTRT_3:
+; call site 0
+	BSR.W	LAB_00CE		;0900: 6100004a
+	MOVE.L	#LAB_0015,-(A7)		;0904: 2f3c000000c6
+LAB_00C8:
+	ADD.L	D1,D3			;090a: d681
+	DBF	D1,LAB_00C8		;090c: 51c9fffc
+func_3_140:
+	MOVE.W	(22586,A5),(30218,A5)	;0910: 3b6d583a760a
+	DBF	D6,func_3_140		;0916: 51cefff8
+	BNE.S	func_3_140		;091a: 66f4
+	MOVEQ	#6,D3			;091c: 7606
+LAB_00CA:
+	ADD.L	D0,D7			;091e: de80
+LAB_00CB:
+	DBF	D7,LAB_00CA		;0920: 51cffffc
+	ADD.W	D0,D0			;0924: d040
+	MOVE.W	(LAB_00CC,PC,D0.W),D0	;0926: 303b0006
+	JMP	(LAB_00CC,PC,D0.W)	;092a: 4efb0002
+LAB_00CC:
+	DC.W	$000a			;092e
+	DC.W	$000e			;0930
+	ORI.B	#$16,(A2)		;0932: 00120016
+	DC.W	$001a			;0936
+	MOVEQ	#0,D0			;0938: 7000
+	RTS				;093a: 4e75
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+LAB_00CD:
+	MOVEQ	#1,D0			;093c: 7001
+	RTS				;093e: 4e75
+	MOVEQ	#2,D0			;0940: 7002
+	RTS				;0942: 4e75
+	MOVEQ	#3,D0			;0944: 7003
+	RTS				;0946: 4e75
+	MOVEQ	#4,D0			;0948: 7004
+	RTS				;094a: 4e75
+LAB_00CE:
+	LINK.W	A5,#-28			;094c: 4e55ffe4
+LAB_00CF:
+; call site 189
+	BSR.W	LAB_00D7		;0950: 61000048
+	DBF	D1,LAB_00CF		;0954: 51c9fffa
+LAB_00D0:
+	ADDQ.L	#3,A4			;0958: 568c
+LAB_00D1:
+	DBF	D7,LAB_00D0		;095a: 51cffffc
+	BNE.S	LAB_00D1		;095e: 66fa
+LAB_00D2:
+	CMPI.L	#$000000af,D2		;0960: 0c82000000af
+	MOVE.L	#LAB_0146,-(A7)		;0966: 2f3c00000df0
+LAB_00D3:
+	MOVE.W	(8735,A5),(18843,A5)	;096c: 3b6d221f499b
+func_3_98:
+	DBF	D0,LAB_00D3		;0972: 51c8fff8
+	MOVE.W	(24848,A5),(19922,A5)	;0976: 3b6d61104dd2
+LAB_00D5:
+	JSR	(-402,A6)		;097c: 4eaefe6e
+	BSR.W	LAB_00D7		;0980: 61000018
+	BNE.S	LAB_00D5		;0984: 66f6
+LAB_00D6:
+	ADDQ.L	#2,A3			;0986: 548b
+	DBF	D7,LAB_00D6		;0988: 51cffffc
+	MOVE.W	(15440,A5),(20008,A5)	;098c: 3b6d3c504e28
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_00FC		;0992: 61000118
+	UNLK	A5			;0996: 4e5d
+	RTS				;0998: 4e75
+LAB_00D7:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;099a: 48e73f3e
+	BSR.W	LAB_00E9		;099e: 61000096
+; call site 147
+	JSR	LAB_00FC		;09a2: 4eb900000aac
+LAB_00D8:
+	MOVE.L	D3,D3			;09a8: 2603
+LAB_00D9:
+	ADDQ.L	#1,A4			;09aa: 528c
+	DBF	D6,LAB_00D9		;09ac: 51cefffc
+	MOVE.W	(13954,A5),(18799,A5)	;09b0: 3b6d3682496f
+	CMP.L	#$0000adc9,D1		;09b6: b2bc0000adc9
+	MOVEQ	#-53,D1			;09bc: 72cb
+LAB_00DA:
+	LEA	LAB_0143,A0		;09be: 41f900000dc6
+func_3_56:
+	BSR.W	LAB_00FC		;09c4: 610000e6
+LAB_00DC:
+	BNE.S	LAB_00DA		;09c8: 66f4
+	BNE.S	LAB_00DC		;09ca: 66fc
+LAB_00DD:
+	LEA	LAB_0144,A0		;09cc: 41f900000dda
+	JSR	LAB_00FC		;09d2: 4eb900000aac
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+	ADDQ.L	#2,A6			;09d8: 548e
+LAB_00DE:
+	BNE.S	LAB_00DD		;09da: 66f0
+	DBF	D0,LAB_00DE		;09dc: 51c8fffc
+	CMPI.L	#$000000cd,D2		;09e0: 0c82000000cd
+	BRA.S	LAB_00E1		;09e6: 6012
+	BVS.S	LAB_00EE		;09e8: 696e
+	MOVEQ	#117,D2			;09ea: 7475
+	BVS.S	LAB_00EF		;09ec: 6974
+LAB_00DF:
+	DC.W	$696f			;09ee
+	BGT.S	LAB_00E6+2		;09f0: 6e2e
+	DC.W	$6c69			;09f2
+LAB_00E0:
+	BHI.S	LAB_00F0		;09f4: 6272
+	BSR.S	LAB_00F0+2		;09f6: 6172
+	DC.W	$7900			;09f8
+LAB_00E1:
+	BSR.W	LAB_00E9		;09fa: 6100003a
+	JSR	LAB_0106		;09fe: 4eb900000b04
+LAB_00E2:
+	BSR.W	LAB_0106		;0a04: 610000fe
+; call site 105
+	BNE.S	LAB_00E2		;0a08: 66fa
+LAB_00E3:
+	MOVE.L	D7,D3			;0a0a: 2607
+	DBF	D4,LAB_00E3		;0a0c: 51ccfffc
+LAB_00E4:
+	MOVE.L	#LAB_004F,-(A7)		;0a10: 2f3c0000032e
+	CMPI.L	#$00000054,D7		;0a16: 0c8700000054
+LAB_00E5:
+	MOVE.L	D6,D5			;0a1c: 2a06
+LAB_00E6:
+	DBF	D0,LAB_00E5		;0a1e: 51c8fffc
+LAB_00E7:
+	MOVE.W	(14748,A5),(9711,A5)	;0a22: 3b6d399c25ef
+func_3_14:
+	BNE.S	LAB_00E7		;0a28: 66f8
+	BSR.W	LAB_00FC		;0a2a: 61000080
+	ADD.L	D7,D0			;0a2e: d087
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0a30: 4cdf7cfc
+	RTS				;0a34: 4e75
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+LAB_00E9:
+	BSR.W	LAB_00FC		;0a36: 61000074
+LAB_00EA:
+	DBF	D3,LAB_00E9		;0a3a: 51cbfffa
+LAB_00EB:
+	DBF	D3,LAB_00EA		;0a3e: 51cbfffa
+LAB_00EC:
+	BRA.S	LAB_00ED		;0a42: 6008
+	ADDQ.W	#1,-(A5)		;0a44: 5265
+	BSR.S	LAB_00FC		;0a46: 6164
+	DC.W	$792e			;0a48
+	DC.W	$0000			;0a4a
+LAB_00ED:
+	LEA	LAB_00EB,A4		;0a4c: 49f900000a3e
+	BRA.S	LAB_00EF		;0a52: 600e
+	DC.W	$4f75			;0a54
+	MOVEQ	#32,D2			;0a56: 7420
+LAB_00EE:
+	BLE.S	LAB_00FF		;0a58: 6f66
+	MOVEA.L	(25965,A5),A0		;0a5a: 206d656d
+	BLE.S	LAB_0102		;0a5e: 6f72
+	DC.W	$7900			;0a60
+LAB_00EF:
+	BNE.S	LAB_00EC		;0a62: 66de
+; call site 63
+	BSR.W	LAB_010D		;0a64: 610000cc
+LAB_00F0:
+	MOVE.L	#LAB_006B,-(A7)		;0a68: 2f3c000004b8
+LAB_00F2:
+	BNE.S	LAB_00EF		;0a6e: 66f2
+	MOVE.L	(23910,A5),D7		;0a70: 2e2d5d66
+LAB_00F3:
+	JSR	LAB_0106		;0a74: 4eb900000b04
+func_3_203:
+	BNE.S	LAB_00F3		;0a7a: 66f8
+LAB_00F5:
+	MOVE.L	#LAB_01F7,-(A7)		;0a7c: 2f3c00001558
+	DBF	D3,LAB_00F5		;0a82: 51cbfff8
+	LEA	LAB_0023,A4		;0a86: 49f900000162
+LAB_00F7:
+	LEA	(LAB_00C8,PC),A0	;0a8c: 41fafe7c
+LAB_00F9:
+	BNE.S	LAB_00F7		;0a90: 66fa
+	BSR.W	LAB_010D		;0a92: 6100009e
+	BSR.W	LAB_010D		;0a96: 6100009a
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	LEA	(LAB_00F2,PC),A6	;0a9a: 4dfaffd2
+LAB_00FA:
+	CMP.L	#$00009e50,D0		;0a9e: b0bc00009e50
+LAB_00FB:
+	JSR	(-924,A6)		;0aa4: 4eaefc64
+	BNE.S	LAB_00FA		;0aa8: 66f4
+	RTS				;0aaa: 4e75
+LAB_00FC:
+	BSR.W	LAB_0106		;0aac: 61000056
+	DBF	D4,LAB_00FC		;0ab0: 51ccfffa
+; call site 21
+	JSR	LAB_010D		;0ab4: 4eb900000b32
+LAB_00FD:
+	MOVEQ	#-3,D3			;0aba: 76fd
+LAB_00FE:
+	DBF	D2,LAB_00FD		;0abc: 51cafffc
+LAB_00FF:
+	MOVE.W	(28974,A5),(16972,A5)	;0ac0: 3b6d712e424c
+LAB_0100:
+	CMPI.L	#$000000d2,D3		;0ac6: 0c83000000d2
+func_3_161:
+	BNE.S	LAB_00FE		;0acc: 66ee
+	BSR.W	LAB_010D		;0ace: 61000062
+LAB_0102:
+	JSR	LAB_010D		;0ad2: 4eb900000b32
+LAB_0103:
+	BSR.W	LAB_0106		;0ad8: 6100002a
+	LEA	(LAB_00F7+2,PC),A4	;0adc: 49faffb0
+LAB_0104:
+	BNE.S	LAB_0103		;0ae0: 66f6
+LAB_0105:
+	MOVEQ	#-5,D0			;0ae2: 70fb
+	MOVEQ	#14,D2			;0ae4: 740e
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_0105		;0ae6: 66fa
+	ADD.L	D0,D4			;0ae8: d880
+	CMP.L	#$00004eca,D5		;0aea: babc00004eca
+	LEA	LAB_0155,A6		;0af0: 4df900000e5a
+	LEA	(LAB_00E4,PC),A4	;0af6: 49faff18
+; call site 210
+	BSR.W	LAB_0106		;0afa: 61000008
+	MOVE.L	(7308,A5),D2		;0afe: 242d1c8c
+	RTS				;0b02: 4e75
+LAB_0106:
+	BSR.W	LAB_010D		;0b04: 6100002c
+LAB_0107:
+	ADD.L	D2,D1			;0b08: d282
+	TST.L	D6			;0b0a: 4a86
+	MOVE.L	(14794,A5),D5		;0b0c: 2a2d39ca
+func_3_119:
+	BNE.S	LAB_0107		;0b10: 66f6
+	MOVE.L	D2,D3			;0b12: 2602
+	MOVE.L	D3,D1			;0b14: 2203
+LAB_0109:
+	MOVE.L	D4,D3			;0b16: 2604
+LAB_010A:
+	DBF	D2,LAB_0109		;0b18: 51cafffc
+	DBF	D6,LAB_010A		;0b1c: 51cefffa
+	MOVEQ	#48,D6			;0b20: 7c30
+LAB_010B:
+	BSR.W	LAB_0119		;0b22: 610000c4
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_010C:
+	BNE.S	LAB_010B		;0b26: 66fa
+	MOVE.L	#LAB_006D,-(A7)		;0b28: 2f3c000004c6
+	BNE.S	LAB_010C		;0b2e: 66f6
+	RTS				;0b30: 4e75
+LAB_010D:
+	LINK.W	A5,#-20			;0b32: 4e55ffec
+; call site 168
+	BSR.W	LAB_0119		;0b36: 610000b0
+LAB_010E:
+	LEA	(LAB_0104,PC),A4	;0b3a: 49faffa4
+	LEA	LAB_015E+2,A2		;0b3e: 45f900000ea6
+	BNE.S	LAB_010E		;0b44: 66f4
+	BSR.W	LAB_011F		;0b46: 610000c8
+	ADD.L	D2,D3			;0b4a: d682
+	LEA	LAB_0164,A2		;0b4c: 45f900000eca
+LAB_010F:
+	JSR	LAB_011F		;0b52: 4eb900000c10
+func_3_77:
+	DBF	D2,LAB_010F		;0b58: 51cafff8
+	DBF	D7,func_3_77		;0b5c: 51cffffa
+	MOVE.W	(28459,A5),(30517,A5)	;0b60: 3b6d6f2b7735
+LAB_0111:
+	ADD.L	D7,D2			;0b66: d487
+LAB_0112:
+	DBF	D4,LAB_0111		;0b68: 51ccfffc
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_0112		;0b6c: 66fa
+	MOVE.L	D3,D7			;0b6e: 2e03
+	LEA	LAB_00E0,A0		;0b70: 41f9000009f4
+LAB_0113:
+	CMP.L	#value_49,D3		;0b76: b6bc00008bd3
+	DBF	D4,LAB_0113		;0b7c: 51ccfff8
+	MOVEQ	#-15,D4			;0b80: 78f1
+	CMPI.L	#$0000005e,D2		;0b82: 0c820000005e
+LAB_0114:
+	LEA	(LAB_00F3,PC),A4	;0b88: 49fafeea
+; call site 126
+	BRA.S	LAB_0115		;0b8c: 6008
+	ADDQ.W	#1,-(A5)		;0b8e: 5265
+	BSR.S	LAB_011A+4		;0b90: 6164
+	DC.W	$792e			;0b92
+	DC.W	$0000			;0b94
+LAB_0115:
+	BNE.S	LAB_0114		;0b96: 66f0
+	MOVE.L	(14822,A5),D4		;0b98: 282d39e6
+	ADD.L	D6,D5			;0b9c: da86
+	MOVE.W	(11542,A5),(12236,A5)	;0b9e: 3b6d2d162fcc
+	JSR	LAB_0125		;0ba4: 4eb900000c4a
+LAB_0116:
+	LEA	LAB_0026,A2		;0baa: 45f90000016e
+	MOVE.L	(10330,A5),D0		;0bb0: 202d285a
+func_3_35:
+	BNE.S	LAB_0116		;0bb4: 66f4
+	LEA	(func_3_77,PC),A2	;0bb6: 45faffa0
+	ADD.W	D0,D0			;0bba: d040
+	MOVE.W	(LAB_0118,PC,D0.W),D0	;0bbc: 303b0006
+	JMP	(LAB_0118,PC,D0.W)	;0bc0: 4efb0002
+LAB_0118:
+	DC.W	$000c			;0bc4
+	ORI.B	#$14,(A0)		;0bc6: 00100014
+	ORI.B	#$1c,(A0)+		;0bca: 0018001c
+	DC.W	$0020			;0bce
+	MOVEQ	#0,D0			;0bd0: 7000
+	RTS				;0bd2: 4e75
+	MOVEQ	#1,D0			;0bd4: 7001
+	RTS				;0bd6: 4e75
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+	MOVEQ	#2,D0			;0bd8: 7002
+	RTS				;0bda: 4e75
+	MOVEQ	#3,D0			;0bdc: 7003
+	RTS				;0bde: 4e75
+	MOVEQ	#4,D0			;0be0: 7004
+	RTS				;0be2: 4e75
+	MOVEQ	#5,D0			;0be4: 7005
+	RTS				;0be6: 4e75
+LAB_0119:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0be8: 48e73f3e
+	BSR.W	LAB_011F		;0bec: 61000022
+	TST.L	D6			;0bf0: 4a86
+LAB_011A:
+	JSR	LAB_0125		;0bf2: 4eb900000c4a
+LAB_011C:
+; call site 84
+	DBF	D3,LAB_011A		;0bf8: 51cbfff8
+	CMPI.L	#$00000007,D0		;0bfc: 0c8000000007
+	ADDQ.L	#6,A4			;0c02: 5c8c
+	CMPI.L	#$0000000f,D5		;0c04: 0c850000000f
+LAB_011D:
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0c0a: 4cdf7cfc
+func_3_224:
+	RTS				;0c0e: 4e75
+LAB_011F:
+	LINK.W	A5,#-92			;0c10: 4e55ffa4
+	BSR.W	LAB_0125		;0c14: 61000034
+LAB_0120:
+	LEA	(LAB_011C+2,PC),A2	;0c18: 45faffe0
+	MOVE.L	#LAB_01B1+2,-(A7)	;0c1c: 2f3c0000124a
+	LEA	LAB_013F,A4		;0c22: 49f900000d96
+	ADD.W	D0,D0			;0c28: d040
+	MOVE.W	(LAB_0122,PC,D0.W),D0	;0c2a: 303b0006
+LAB_0121:
+	JMP	(LAB_0122,PC,D0.W)	;0c2e: 4efb0002
+LAB_0122:
+	DC.W	$0008			;0c32
+	DC.W	$000c			;0c34
+LAB_0123:
+	ORI.B	#$14,(A0)		;0c36: 00100014
+	MOVEQ	#0,D0			;0c3a: 7000
+	RTS				;0c3c: 4e75
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	MOVEQ	#1,D0			;0c3e: 7001
+	RTS				;0c40: 4e75
+	MOVEQ	#2,D0			;0c42: 7002
+	RTS				;0c44: 4e75
+LAB_0124:
+	MOVEQ	#3,D0			;0c46: 7003
+	RTS				;0c48: 4e75
+LAB_0125:
+	BSR.W	LAB_012F		;0c4a: 61000076
+	TST.L	D6			;0c4e: 4a86
+LAB_0126:
+	BSR.W	LAB_012F		;0c50: 61000070
+	BNE.S	LAB_0125		;0c54: 66f4
+LAB_0128:
+; call site 42
+	MOVE.L	D5,D2			;0c56: 2405
+	DBF	D7,LAB_0128		;0c58: 51cffffc
+	BRA.S	LAB_0129		;0c5c: 600c
+	DC.W	$646f			;0c5e
+	DC.W	$732e			;0c60
+	DC.W	$6c69			;0c62
+	BHI.S	LAB_0130		;0c64: 6272
+	BSR.S	LAB_0131		;0c66: 6172
+	DC.W	$7900			;0c68
+LAB_0129:
+	MOVE.L	#LAB_00B7,-(A7)		;0c6a: 2f3c000007f0
+	LEA	LAB_01A5,A4		;0c70: 49f9000011b6
+func_3_182:
+	MOVE.L	#LAB_0058,-(A7)		;0c76: 2f3c00000354
+LAB_012B:
+	CMPI.L	#$00000087,D5		;0c7c: 0c8500000087
+LAB_012C:
+	DBF	D0,LAB_012B		;0c82: 51c8fff8
+	DBF	D1,LAB_012C		;0c86: 51c9fffa
+	JSR	(-894,A6)		;0c8a: 4eaefc82
+	MOVE.W	(13685,A5),(32095,A5)	;0c8e: 3b6d35757d5f
+	MOVE.L	D3,D4			;0c94: 2803
+	CMP.L	#$0000e3ed,D6		;0c96: bcbc0000e3ed
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+LAB_012D:
+	BSR.W	LAB_012F		;0c9c: 61000024
+	DBF	D6,LAB_012D		;0ca0: 51cefffa
+	CMP.L	#$000090f2,D1		;0ca4: b2bc000090f2
+	JSR	LAB_012F		;0caa: 4eb900000cc2
+	BRA.S	LAB_012E		;0cb0: 600e
+	DC.W	$4f75			;0cb2
+	MOVEQ	#32,D2			;0cb4: 7420
+	DC.W	$6f66			;0cb6
+	MOVEA.L	(25965,A5),A0		;0cb8: 206d656d
+	DC.W	$6f72			;0cbc
+	DC.W	$7900			;0cbe
+LAB_012E:
+	RTS				;0cc0: 4e75
+LAB_012F:
+	JSR	SECSTRT_5		;0cc2: 4eb900000e00
+	NOP				;0cc8: 4e71
+	NOP				;0cca: 4e71
+	NOP				;0ccc: 4e71
+	NOP				;0cce: 4e71
+	NOP				;0cd0: 4e71
+	NOP				;0cd2: 4e71
+	NOP				;0cd4: 4e71
+	NOP				;0cd6: 4e71
+LAB_0130:
+	NOP				;0cd8: 4e71
+LAB_0131:
+	NOP				;0cda: 4e71
+	NOP				;0cdc: 4e71
+	NOP				;0cde: 4e71
+	NOP				;0ce0: 4e71
+	NOP				;0ce2: 4e71
+	NOP				;0ce4: 4e71
+	NOP				;0ce6: 4e71
+	NOP				;0ce8: 4e71
+	NOP				;0cea: 4e71
+	NOP				;0cec: 4e71
+	NOP				;0cee: 4e71
+	NOP				;0cf0: 4e71
+	NOP				;0cf2: 4e71
+	NOP				;0cf4: 4e71
+	NOP				;0cf6: 4e71
+	NOP				;0cf8: 4e71
+	NOP				;0cfa: 4e71
+	NOP				;0cfc: 4e71
+	RTS				;0cfe: 4e75
+
+
+	SECTION S_4,DATA
+
+SECSTRT_4:
+	DC.L	$31c453ed		;0d00
+	;0d04
+	;DC.B	$45,$72,$72,$6f
+	DC.B	"Erro"
+LAB_0132:
+	DC.W	$723a			;0d08
+LAB_0133:
+	DC.L	$20000e2e,$7dd6734d	;0d0a
+	DC.W	$8e69			;0d12
+LAB_0134:
+	DC.L	LAB_006F		;0d14: 000004e8
+	DC.W	$3a25			;0d18
+LAB_0135:
+	DC.L	$747a48cf		;0d1a
+	DC.W	$df07			;0d1e
+LAB_0136:
+	DC.L	LAB_011D		;0d20: 00000c0a
+	DC.L	LAB_0123		;0d24: 00000c36
+	DC.L	$04604b49,$2df8cb14,$415e18d4 ;0d28
+	DC.W	$0bd7			;0d34
+LAB_0137:
+	DC.W	$b2b3			;0d36
+LAB_0138:
+	DC.L	$5073bc44,$775842ec,$0c1f3afc,$61f0661e ;0d38
+	DC.L	$477d3905		;0d48
+LAB_0139:
+	DC.L	$41d85083		;0d4c
+	DC.L	LAB_005B		;0d50: 0000037c
+	DC.L	$0967787c,$28085c47,$0b41d5af ;0d54
+LAB_013A:
+	;0d60
+	;DC.B	$4f,$75,$74,$20,$6f,$66,$20,$6d,$65,$6d,$6f,$72
+	DC.B	"Out of memor"
+LAB_013B:
+	DC.W	$7900			;0d6c
+	DC.L	LAB_015B		;0d6e: 00000e86
+	DC.L	$16a40973		;0d72
+	;0d76
+	;DC.B	$67,$72,$61,$70,$68,$69,$63,$73,$2e,$6c,$69,$62,$72,$61,$72,$79
+	;DC.B	$00,$00
+	DC.B	"graphics.library",0,0
+	DC.L	$277fd1e8		;0d88
+LAB_013C:
+	DC.W	$2c6a			;0d8c
+LAB_013D:
+	DC.L	$3b736be4		;0d8e
+LAB_013E:
+	DC.W	$eebb			;0d92
+	;0d94
+	;DC.B	$64,$6f
+	DC.B	"do"
+LAB_013F:
+	DC.L	$732e6c69,$62726172,$79002332 ;0d96
+	DC.W	$84d3			;0da2
+	DC.L	LAB_0062		;0da4: 00000448
+	DC.L	$1dfdbfcc,$500a94ed	;0da8
+	;0db0
+	;DC.B	$43,$4f,$4e,$3a
+	DC.B	"CON:"
+LAB_0140:
+	;0db4
+	;DC.B	$30,$2f,$30,$2f,$36,$34,$30,$2f,$32,$30,$30,$2f,$4f,$75
+	DC.B	"0/0/640/200/Ou"
+LAB_0141:
+	DC.W	$7470			;0dc2
+LAB_0142:
+	DC.W	$7574			;0dc4
+LAB_0143:
+	DS.W	1			;0dc6
+	DC.L	LAB_00CB		;0dc8: 00000920
+	DC.L	$21657f17,$5184fee1,$6483d998 ;0dcc
+	DS.W	1			;0dd8
+LAB_0144:
+	DS.L	3			;0dda
+	DS.W	1			;0de6
+LAB_0145:
+	DS.L	2			;0de8
+LAB_0146:
+	DS.L	1			;0df0
+	DS.W	1			;0df4
+LAB_0147:
+	DS.L	2			;0df6
+	DS.W	1			;0dfe
+
+
+	SECTION S_5,CODE
+
+SECSTRT_5:
+; call site 0
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0e00: 48e73f3e
+LAB_0149:
+	BSR.W	func_5_182		;0e04: 61000092
+	DBF	D0,LAB_0149		;0e08: 51c8fffa
+	LEA	LAB_0188,A6		;0e0c: 4df900001018
+LAB_014A:
+	MOVE.L	#LAB_0053,-(A7)		;0e12: 2f3c0000033a
+	DBF	D1,LAB_014A		;0e18: 51c9fff8
+LAB_014B:
+	CMP.L	#$0000cd61,D0		;0e1c: b0bc0000cd61
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+LAB_014C:
+	LEA	LAB_0174,A2		;0e22: 45f900000f3e
+	JSR	(-180,A6)		;0e28: 4eaeff4c
+	BSR.W	LAB_0179		;0e2c: 6100013c
+LAB_014E:
+	JSR	(-618,A6)		;0e30: 4eaefd96
+	DBF	D7,LAB_014E		;0e34: 51cffffa
+	MOVE.L	D6,D7			;0e38: 2e06
+LAB_014F:
+	CMP.L	#$0000edce,D5		;0e3a: babc0000edce
+func_5_119:
+	DBF	D5,LAB_014F		;0e40: 51cdfff8
+LAB_0151:
+	BSR.W	LAB_0179		;0e44: 61000124
+	ADDQ.L	#5,A3			;0e48: 5a8b
+LAB_0152:
+	JSR	(-450,A6)		;0e4a: 4eaefe3e
+LAB_0153:
+	DBF	D5,LAB_0152		;0e4e: 51cdfffa
+	JSR	LAB_0179		;0e52: 4eb900000f6a
+LAB_0154:
+	BNE.S	LAB_0152		;0e58: 66f0
+LAB_0155:
+; call site 63
+	BRA.S	LAB_0157		;0e5a: 600c
+	DC.W	$646f			;0e5c
+	DC.W	$732e			;0e5e
+LAB_0156:
+	DC.W	$6c69			;0e60
+	BHI.S	LAB_0165+2		;0e62: 6272
+	BSR.S	LAB_0165+4		;0e64: 6172
+	DC.W	$7900			;0e66
+LAB_0157:
+	BNE.S	LAB_0154		;0e68: 66ee
+	LEA	(LAB_0151,PC),A0	;0e6a: 41faffd8
+LAB_0158:
+	BRA.S	LAB_0159		;0e6e: 6008
+	DC.W	$4572			;0e70
+	MOVEQ	#111,D1			;0e72: 726f
+	MOVEQ	#58,D1			;0e74: 723a
+	MOVE.L	D0,D0			;0e76: 2000
+LAB_0159:
+	BSR.W	LAB_0179		;0e78: 610000f0
+	BNE.S	LAB_0158		;0e7c: 66f0
+	LEA	(LAB_014C+2,PC),A2	;0e7e: 45faffa4
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+LAB_015A:
+	LEA	(LAB_014C,PC),A2	;0e82: 45faff9e
+LAB_015B:
+	BSR.W	func_5_182		;0e86: 61000010
+	MOVE.L	#LAB_00AF+2,-(A7)	;0e8a: 2f3c000007ac
+	BNE.S	LAB_015A		;0e90: 66f0
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0e92: 4cdf7cfc
+	RTS				;0e96: 4e75
+func_5_182:
+	BSR.W	LAB_0173		;0e98: 61000096
+	LEA	(LAB_014B+4,PC),A2	;0e9c: 45faff82
+LAB_015D:
+	JSR	(-72,A6)		;0ea0: 4eaeffb8
+LAB_015E:
+	DBF	D3,LAB_015D		;0ea4: 51cbfffa
+	BNE.S	LAB_015E		;0ea8: 66fa
+LAB_0160:
+	JSR	(-156,A6)		;0eaa: 4eaeff64
+LAB_0161:
+	DBF	D5,LAB_0160		;0eae: 51cdfffa
+; call site 126
+	DBF	D3,LAB_0161		;0eb2: 51cbfffa
+	BSR.W	LAB_0173		;0eb6: 61000078
+LAB_0162:
+	LEA	LAB_0060,A6		;0eba: 4df900000424
+LAB_0163:
+	JSR	LAB_0179		;0ec0: 4eb900000f6a
+	DBF	D7,LAB_0163		;0ec6: 51cffff8
+LAB_0164:
+	BNE.S	LAB_0162		;0eca: 66ee
+	DBF	D6,LAB_0164		;0ecc: 51cefffc
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+	MOVEQ	#-69,D3			;0ed0: 76bb
+	MOVE.L	D5,D6			;0ed2: 2c05
+LAB_0165:
+	MOVE.L	#LAB_0070,-(A7)		;0ed4: 2f3c000004fa
+	MOVE.L	#SECSTRT_6+2,-(A7)	;0eda: 2f3c00001202
+LAB_0168:
+	MOVE.L	#LAB_01BE,-(A7)		;0ee0: 2f3c000012ac
+	BNE.S	LAB_0165		;0ee6: 66ec
+LAB_0169:
+	BSR.W	LAB_0173		;0ee8: 61000046
+func_5_14:
+	DBF	D4,LAB_0169		;0eec: 51ccfffa
+	MOVE.L	#LAB_0121,-(A7)		;0ef0: 2f3c00000c2e
+	CMP.L	#$00003846,D5		;0ef6: babc00003846
+LAB_016B:
+	JSR	LAB_0179		;0efc: 4eb900000f6a
+LAB_016C:
+	BSR.W	LAB_0173		;0f02: 6100002c
+LAB_016D:
+	DBF	D0,LAB_016C		;0f06: 51c8fffa
+LAB_016E:
+	DBF	D3,LAB_016D		;0f0a: 51cbfffa
+LAB_016F:
+; call site 189
+	JSR	LAB_0180		;0f0e: 4eb900000fb0
+	BSR.W	LAB_0179		;0f14: 61000054
+LAB_0170:
+	ADD.L	D1,D0			;0f18: d081
+LAB_0171:
+	DBF	D1,LAB_0170		;0f1a: 51c9fffc
+	DBF	D3,LAB_0171		;0f1e: 51cbfffa
+	MOVE.L	D6,D5			;0f22: 2a06
+LAB_0172:
+	BSR.W	LAB_0179		;0f24: 61000044
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	BSR.W	LAB_0180		;0f28: 61000086
+	BNE.S	LAB_0172		;0f2c: 66f6
+	RTS				;0f2e: 4e75
+LAB_0173:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0f30: 48e73f3e
+	BSR.W	LAB_0179		;0f34: 61000034
+	MOVE.W	(11855,A5),(14035,A5)	;0f38: 3b6d2e4f36d3
+LAB_0174:
+	TST.L	D6			;0f3e: 4a86
+func_5_77:
+	DBF	D0,LAB_0174		;0f40: 51c8fffc
+	CMPI.L	#$000000a2,D0		;0f44: 0c80000000a2
+	BNE.S	func_5_77		;0f4a: 66f4
+	MOVEQ	#102,D7			;0f4c: 7e66
+LAB_0176:
+	BSR.W	LAB_0180		;0f4e: 61000060
+LAB_0177:
+	DBF	D4,LAB_0176		;0f52: 51ccfffa
+	MOVE.L	(842,A5),D5		;0f56: 2a2d034a
+LAB_0178:
+; call site 21
+	BNE.S	LAB_0177		;0f5a: 66f6
+	DBF	D6,LAB_0178		;0f5c: 51cefffc
+	JSR	(-204,A6)		;0f60: 4eaeff34
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0f64: 4cdf7cfc
+	RTS				;0f68: 4e75
+LAB_0179:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0f6a: 48e73f3e
+	BSR.W	LAB_0180		;0f6e: 61000040
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+LAB_017A:
+	ADDQ.L	#quick_57,A1		;0f72: 5689
+	JSR	(-384,A6)		;0f74: 4eaefe80
+LAB_017B:
+	BNE.S	LAB_017A		;0f78: 66f8
+	DBF	D7,LAB_017B		;0f7a: 51cffffc
+	LEA	LAB_0145,A2		;0f7e: 45f900000de8
+LAB_017C:
+	MOVE.L	(1002,A5),D3		;0f84: 262d03ea
+	DBF	D6,LAB_017C		;0f88: 51cefffa
+func_5_140:
+	BSR.W	LAB_0193		;0f8c: 61000132
+	MOVE.L	D0,D1			;0f90: 2200
+	MOVEQ	#-124,D6		;0f92: 7c84
+	ADD.W	D0,D0			;0f94: d040
+	MOVE.W	(LAB_017E,PC,D0.W),D0	;0f96: 303b0006
+	JMP	(LAB_017E,PC,D0.W)	;0f9a: 4efb0002
+LAB_017E:
+	ORI.B	#$0a,D6			;0f9e: 0006000a
+	DC.W	$000e			;0fa2
+	MOVEQ	#0,D0			;0fa4: 7000
+	RTS				;0fa6: 4e75
+	MOVEQ	#1,D0			;0fa8: 7001
+	RTS				;0faa: 4e75
+LAB_017F:
+	MOVEQ	#2,D0			;0fac: 7002
+	RTS				;0fae: 4e75
+LAB_0180:
+; call site 84
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0fb0: 48e73f3e
+LAB_0181:
+	BSR.W	LAB_0186		;0fb4: 61000054
+	DBF	D1,LAB_0181		;0fb8: 51c9fffa
+	MOVE.W	(21195,A5),(6830,A5)	;0fbc: 3b6d52cb1aae
+	ADD.L	D3,D3			;0fc2: d683
+	MOVE.L	D4,D7			;0fc4: 2e04
+	MOVE.W	(24908,A5),(2446,A5)	;0fc6: 3b6d614c098e
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+LAB_0182:
+	BSR.W	LAB_0193		;0fcc: 610000f2
+	BSR.W	LAB_0193		;0fd0: 610000ee
+	BNE.S	LAB_0182		;0fd4: 66f6
+	ADDQ.L	#1,A0			;0fd6: 5288
+	JSR	(-426,A6)		;0fd8: 4eaefe56
+	LEA	LAB_0113,A0		;0fdc: 41f900000b76
+	MOVE.L	D2,D7			;0fe2: 2e02
+func_5_203:
+	JSR	LAB_0186		;0fe4: 4eb90000100a
+	MOVEQ	#69,D7			;0fea: 7e45
+	JSR	(-654,A6)		;0fec: 4eaefd72
+	MOVE.L	D7,D5			;0ff0: 2a07
+LAB_0184:
+	BSR.W	LAB_0186		;0ff2: 61000016
+	DBF	D2,LAB_0184		;0ff6: 51cafffa
+LAB_0185:
+	MOVEQ	#61,D3			;0ffa: 763d
+; call site 147
+	DBF	D7,LAB_0185		;0ffc: 51cffffc
+	JSR	(-384,A6)		;1000: 4eaefe80
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;1004: 4cdf7cfc
+	RTS				;1008: 4e75
+LAB_0186:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;100a: 48e73f3e
+	BSR.W	LAB_0193		;100e: 610000b0
+	BSR.W	LAB_019E		;1012: 61000126
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+LAB_0187:
+	MOVEQ	#2,D5			;1016: 7a02
+LAB_0188:
+	DBF	D4,LAB_0187		;1018: 51ccfffc
+LAB_0189:
+	BRA.S	LAB_018B		;101c: 600a
+	DC.W	$2573			;101e
+	MOVE.W	-(A0),D5		;1020: 3a20
+LAB_018A:
+	MOVE.L	(25610,A4),(0,A2)	;1022: 256c640a0000
+LAB_018B:
+	JSR	(-594,A6)		;1028: 4eaefdae
+	DBF	D6,LAB_018B		;102c: 51cefffa
+	BNE.S	LAB_0189		;1030: 66ea
+	ADD.L	D3,D5			;1032: da83
+func_5_35:
+	BSR.W	LAB_019E		;1034: 61000104
+LAB_018D:
+	JSR	(-96,A6)		;1038: 4eaeffa0
+	JSR	(-708,A6)		;103c: 4eaefd3c
+	BNE.S	LAB_018D		;1040: 66f6
+	MOVEQ	#-88,D6			;1042: 7ca8
+	JSR	LAB_0193		;1044: 4eb9000010c0
+LAB_018E:
+	LEA	(LAB_0160,PC),A4	;104a: 49fafe5e
+; call site 210
+	BNE.S	LAB_018E		;104e: 66fa
+	ADDQ.L	#5,A0			;1050: 5a88
+	BRA.S	LAB_018F		;1052: 600a
+	DC.W	$2573			;1054
+	MOVE.W	-(A0),D5		;1056: 3a20
+	MOVE.L	(25610,A4),(0,A2)	;1058: 256c640a0000
+LAB_018F:
+	MOVE.L	(10990,A5),D7		;105e: 2e2d2aee
+	ADD.L	D0,D5			;1062: da80
+	MOVE.L	#LAB_01F5+2,-(A7)	;1064: 2f3c00001556
+	CMPI.L	#$00000018,D6		;106a: 0c8600000018
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+LAB_0190:
+	MOVE.L	#LAB_00F2,-(A7)		;1070: 2f3c00000a6e
+	ADD.L	D4,D4			;1076: d884
+	MOVEQ	#103,D4			;1078: 7867
+	BNE.S	LAB_0190		;107a: 66f4
+	ADD.L	D3,D2			;107c: d483
+	JSR	LAB_0193		;107e: 4eb9000010c0
+	BSR.W	LAB_0193		;1084: 6100003a
+func_5_98:
+	CMPI.L	#$00000088,D2		;1088: 0c8200000088
+	DBF	D5,func_5_98		;108e: 51cdfff8
+	JSR	LAB_0198		;1092: 4eb9000010f8
+	ADD.L	D0,D6			;1098: dc80
+LAB_0192:
+	MOVE.W	(19035,A5),(15119,A5)	;109a: 3b6d4a5b3b0f
+	DBF	D1,LAB_0192		;10a0: 51c9fff8
+	LEA	(LAB_016F+2,PC),A2	;10a4: 45fafe6a
+; call site 42
+	BNE.S	LAB_0192		;10a8: 66f0
+	MOVE.L	#LAB_00CD,-(A7)		;10aa: 2f3c0000093c
+	MOVE.W	(6478,A5),(18684,A5)	;10b0: 3b6d194e48fc
+	BSR.W	LAB_0193		;10b6: 61000008
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;10ba: 4cdf7cfc
+	RTS				;10be: 4e75
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+LAB_0193:
+	BSR.W	LAB_0198		;10c0: 61000036
+LAB_0194:
+	DBF	D1,LAB_0193		;10c4: 51c9fffa
+	CMPI.L	#$00000011,D7		;10c8: 0c8700000011
+	BNE.S	LAB_0194		;10ce: 66f4
+LAB_0195:
+	ADD.W	D0,D0			;10d0: d040
+	MOVE.W	(LAB_0196,PC,D0.W),D0	;10d2: 303b0006
+	JMP	(LAB_0196,PC,D0.W)	;10d6: 4efb0002
+LAB_0196:
+	DC.W	$000a			;10da
+	DC.W	$000e			;10dc
+	ORI.B	#$16,(A2)		;10de: 00120016
+	DC.W	$001a			;10e2
+	MOVEQ	#0,D0			;10e4: 7000
+	RTS				;10e6: 4e75
+	MOVEQ	#1,D0			;10e8: 7001
+	RTS				;10ea: 4e75
+func_5_161:
+	MOVEQ	#2,D0			;10ec: 7002
+	RTS				;10ee: 4e75
+	MOVEQ	#3,D0			;10f0: 7003
+	RTS				;10f2: 4e75
+	MOVEQ	#4,D0			;10f4: 7004
+	RTS				;10f6: 4e75
+LAB_0198:
+	BSR.W	LAB_019E		;10f8: 61000040
+LAB_0199:
+	ADD.L	D1,D6			;10fc: dc81
+	ADD.L	D1,D4			;10fe: d881
+; call site 105
+	BNE.S	LAB_0199		;1100: 66fa
+	MOVE.L	D7,D7			;1102: 2e07
+LAB_019A:
+	MOVE.L	#LAB_0100,-(A7)		;1104: 2f3c00000ac6
+	DBF	D7,LAB_019A		;110a: 51cffff8
+LAB_019B:
+	LEA	(LAB_018A,PC),A2	;110e: 45faff12
+	ADD.W	D0,D0			;1112: d040
+	MOVE.W	(LAB_019C,PC,D0.W),D0	;1114: 303b0006
+	JMP	(LAB_019C,PC,D0.W)	;1118: 4efb0002
+LAB_019C:
+	DC.W	$000a			;111c
+	DC.W	$000e			;111e
+	ORI.B	#$16,(A2)		;1120: 00120016
+	DC.W	$001a			;1124
+	MOVEQ	#0,D0			;1126: 7000
+	RTS				;1128: 4e75
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	MOVEQ	#1,D0			;112a: 7001
+	RTS				;112c: 4e75
+	MOVEQ	#2,D0			;112e: 7002
+	RTS				;1130: 4e75
+	MOVEQ	#3,D0			;1132: 7003
+	RTS				;1134: 4e75
+LAB_019D:
+	MOVEQ	#4,D0			;1136: 7004
+	RTS				;1138: 4e75
+LAB_019E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;113a: 48e73f3e
+LAB_019F:
+	BSR.W	LAB_01A2		;113e: 6100003a
+	DBF	D2,LAB_019F		;1142: 51cafffa
+func_5_224:
+	ADD.W	D0,D0			;1146: d040
+	MOVE.W	(LAB_01A1,PC,D0.W),D0	;1148: 303b0006
+	JMP	(LAB_01A1,PC,D0.W)	;114c: 4efb0002
+LAB_01A1:
+	DC.W	$000e			;1150
+	ORI.B	#$16,(A2)		;1152: 00120016
+	ORI.B	#$1e,(A2)+		;1156: 001a001e
+	ORI.B	#$26,-(A2)		;115a: 00220026
+	MOVEQ	#0,D0			;115e: 7000
+	RTS				;1160: 4e75
+	MOVEQ	#1,D0			;1162: 7001
+	RTS				;1164: 4e75
+	MOVEQ	#2,D0			;1166: 7002
+	RTS				;1168: 4e75
+	MOVEQ	#3,D0			;116a: 7003
+	RTS				;116c: 4e75
+	MOVEQ	#4,D0			;116e: 7004
+	RTS				;1170: 4e75
+	MOVEQ	#5,D0			;1172: 7005
+	RTS				;1174: 4e75
+; call site 168
+	MOVEQ	#6,D0			;1176: 7006
+	RTS				;1178: 4e75
+LAB_01A2:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;117a: 48e73f3e
+	BSR.W	LAB_01A6		;117e: 61000048
+	MOVE.L	#LAB_010F,-(A7)		;1182: 2f3c00000b52
+	BSR.W	LAB_01A6		;1188: 6100003e
+LAB_01A3:
+	MOVE.L	#LAB_0003,-(A7)		;118c: 2f3c0000000c
+	DBF	D3,LAB_01A3		;1192: 51cbfff8
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	MOVE.L	#LAB_0032,-(A7)		;1196: 2f3c00000202
+	MOVE.L	(12636,A5),D1		;119c: 222d315c
+	CMPI.L	#$00000020,D2		;11a0: 0c8200000020
+	BSR.W	LAB_01A6		;11a6: 61000020
+	MOVEQ	#118,D1			;11aa: 7276
+	MOVE.L	(20980,A5),D3		;11ac: 262d51f4
+	ADDQ.L	#4,A1			;11b0: 5889
+func_5_56:
+	BSR.W	LAB_01A6		;11b2: 61000014
+LAB_01A5:
+	MOVE.L	#LAB_0037,-(A7)		;11b6: 2f3c0000024c
+	CMPI.L	#$0000001c,D3		;11bc: 0c830000001c
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;11c2: 4cdf7cfc
+	RTS				;11c6: 4e75
+LAB_01A6:
+	JSR	SECSTRT_6		;11c8: 4eb900001200
+	NOP				;11ce: 4e71
+	NOP				;11d0: 4e71
+	NOP				;11d2: 4e71
+	NOP				;11d4: 4e71
+	NOP				;11d6: 4e71
+	NOP				;11d8: 4e71
+	NOP				;11da: 4e71
+	NOP				;11dc: 4e71
+	NOP				;11de: 4e71
+	NOP				;11e0: 4e71
+	NOP				;11e2: 4e71
+	NOP				;11e4: 4e71
+	NOP				;11e6: 4e71
+	NOP				;11e8: 4e71
+	NOP				;11ea: 4e71
+	NOP				;11ec: 4e71
+	NOP				;11ee: 4e71
+	NOP				;11f0: 4e71
+	NOP				;11f2: 4e71
+	NOP				;11f4: 4e71
+	NOP				;11f6: 4e71
+	NOP				;11f8: 4e71
+	NOP				;11fa: 4e71
+	NOP				;11fc: 4e71
+	RTS				;11fe: 4e75
+
+
+	SECTION S_6,CODE
+
+SECSTRT_6:
+; call site 0
+	BSR.W	LAB_01BD		;1200: 610000a0
+	TST.L	D3			;1204: 4a83
+LAB_01A9:
+	ADD.L	D4,D3			;1206: d684
+	BSR.W	LAB_01C8		;1208: 61000130
+LAB_01AA:
+	BNE.S	LAB_01A9		;120c: 66f8
+LAB_01AB:
+	MOVE.L	D7,D2			;120e: 2407
+; ------------------------------------------------------------------------------
+; function 133
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_01AA		;1210: 66fa
+LAB_01AC:
+	MOVE.L	D4,D0			;1212: 2004
+	BNE.S	LAB_01AC		;1214: 66fc
+LAB_01AD:
+	ADD.L	D4,D5			;1216: da84
+	CMP.L	#$00001b0f,D3		;1218: b6bc00001b0f
+LAB_01AE:
+	MOVE.L	#LAB_006C,-(A7)		;121e: 2f3c000004be
+	MOVE.L	#LAB_0125,-(A7)		;1224: 2f3c00000c4a
+	JSR	(-678,A6)		;122a: 4eaefd5a
+	CMPI.L	#$0000000e,D4		;122e: 0c840000000e
+; ------------------------------------------------------------------------------
+; function 70
+; ------------------------------------------------------------------------------
+LAB_01AF:
+	MOVE.L	#LAB_013A,-(A7)		;1234: 2f3c00000d60
+LAB_01B0:
+	DBF	D0,LAB_01AF		;123a: 51c8fff8
+	DBF	D7,LAB_01B0		;123e: 51cffffa
+	BSR.W	LAB_01C8		;1242: 610000f6
+	MOVEQ	#-83,D4			;1246: 78ad
+LAB_01B1:
+	BSR.W	LAB_01C8		;1248: 610000f0
+LAB_01B2:
+	LEA	(LAB_01AE+2,PC),A4	;124c: 49faffd2
+func_6_203:
+	DBF	D2,LAB_01B2		;1250: 51cafffa
+	ADD.L	D6,D1			;1254: d286
+; ------------------------------------------------------------------------------
+; function 7
+; ------------------------------------------------------------------------------
+LAB_01B4:
+	JSR	LAB_01BD		;1256: 4eb9000012a2
+	ADDQ.L	#4,A5			;125c: 588d
+	BNE.S	LAB_01B4		;125e: 66f6
+	MOVE.W	(12813,A5),(24361,A5)	;1260: 3b6d320d5f29
+	MOVE.W	(24875,A5),(4905,A5)	;1266: 3b6d612b1329
+LAB_01B5:
+	LEA	(LAB_01B5,PC),A6	;126c: 4dfafffe
+LAB_01B6:
+	MOVE.L	#LAB_0120+2,-(A7)	;1270: 2f3c00000c1a
+func_6_140:
+	DBF	D5,LAB_01B6		;1276: 51cdfff8
+	JSR	(-612,A6)		;127a: 4eaefd9c
+	MOVE.L	D3,D6			;127e: 2c03
+LAB_01B8:
+	LEA	LAB_0136,A4		;1280: 49f900000d20
+LAB_01BA:
+	BNE.S	LAB_01B8		;1286: 66f8
+	DBF	D1,LAB_01BA		;1288: 51c9fffc
+	LEA	LAB_0067,A6		;128c: 4df900000480
+	BSR.W	LAB_01C8		;1292: 610000a6
+LAB_01BB:
+	MOVE.L	#LAB_00F9,-(A7)		;1296: 2f3c00000a90
+func_6_77:
+	DBF	D3,LAB_01BB		;129c: 51cbfff8
+	RTS				;12a0: 4e75
+LAB_01BD:
+	LINK.W	A5,#-160		;12a2: 4e55ff60
+	BSR.W	LAB_01C8		;12a6: 61000092
+	ADD.L	D7,D6			;12aa: dc87
+LAB_01BE:
+	TST.L	D1			;12ac: 4a81
+	JSR	(-132,A6)		;12ae: 4eaeff7c
+; call site 210
+	BNE.S	LAB_01BE		;12b2: 66f8
+	BRA.S	func_6_14		;12b4: 600a
+	SUBQ.W	#3,(29291,A7)		;12b6: 576f726b
+	DC.W	$6265			;12ba
+	DC.W	$6e63			;12bc
+	DC.W	$6800			;12be
+func_6_14:
+	JSR	(-654,A6)		;12c0: 4eaefd72
+	BRA.S	LAB_01C0		;12c4: 6018
+	DC.W	$434f			;12c6
+	DC.W	$4e3a			;12c8
+	MOVE.W	(12335,A7),D0		;12ca: 302f302f
+	MOVE.W	(47,A4,D3.W),D3		;12ce: 3634302f
+	MOVE.W	(47,A0,D3.W),D1		;12d2: 3230302f
+	DC.W	$4f75			;12d6
+	MOVEQ	#112,D2			;12d8: 7470
+	DC.W	$7574			;12da
+	DC.W	$0000			;12dc
+LAB_01C0:
+	MOVE.L	#LAB_0135,-(A7)		;12de: 2f3c00000d1a
+LAB_01C1:
+	CMPI.L	#$00000008,D3		;12e4: 0c8300000008
+	CMP.L	#$0000c0d0,D5		;12ea: babc0000c0d0
+	BNE.S	LAB_01C1		;12f0: 66f2
+LAB_01C2:
+	MOVE.W	(24126,A5),(11266,A5)	;12f2: 3b6d5e3e2c02
+LAB_01C3:
+; call site 147
+	BNE.S	LAB_01C2		;12f8: 66f8
+	BNE.S	LAB_01C2		;12fa: 66f6
+LAB_01C4:
+	LEA	(LAB_01AB,PC),A2	;12fc: 45faff10
+	CMPI.L	#$00000067,D3		;1300: 0c8300000067
+	BNE.S	LAB_01C4		;1306: 66f4
+LAB_01C5:
+	BNE.S	LAB_01C4		;1308: 66f2
+	DBF	D4,LAB_01C5		;130a: 51ccfffc
+	ADD.L	D7,D4			;130e: d887
+	ADD.L	D3,D4			;1310: d883
+; call site 84
+	CMPI.L	#$00000024,D3		;1312: 0c8300000024
+	CMP.L	#$00002593,D4		;1318: b8bc00002593
+	JSR	LAB_01C8		;131e: 4eb90000133a
+	BSR.W	LAB_01CF		;1324: 6100008c
+LAB_01C6:
+	BSR.W	LAB_01C8		;1328: 61000010
+LAB_01C7:
+	BSR.W	LAB_01CF		;132c: 61000084
+	DBF	D7,LAB_01C7		;1330: 51cffffa
+; ------------------------------------------------------------------------------
+; function 217
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_01C6		;1334: 66f2
+	UNLK	A5			;1336: 4e5d
+; call site 21
+	RTS				;1338: 4e75
+LAB_01C8:
+	BSR.W	LAB_01CF		;133a: 61000076
+	MOVEQ	#-115,D4		;133e: 788d
+LAB_01C9:
+	BSR.W	LAB_01CF		;1340: 61000070
+	BSR.W	LAB_01CF		;1344: 6100006c
+	LEA	(LAB_01B8+4,PC),A2	;1348: 45faff3a
+; ------------------------------------------------------------------------------
+; function 154
+; ------------------------------------------------------------------------------
+	BNE.S	LAB_01C9		;134c: 66f2
+	MOVE.L	(21814,A5),D6		;134e: 2c2d5536
+	LEA	(LAB_01AD,PC),A0	;1352: 41fafec2
+LAB_01CA:
+	LEA	(LAB_01C3,PC),A6	;1356: 4dfaffa0
+	DBF	D3,LAB_01CA		;135a: 51cbfffa
+	BNE.S	LAB_01CA		;135e: 66f6
+LAB_01CB:
+	BSR.W	LAB_01CF		;1360: 61000050
+	MOVEQ	#-14,D1			;1364: 72f2
+	BNE.S	LAB_01CB		;1366: 66f8
+; ------------------------------------------------------------------------------
+; function 91
+; ------------------------------------------------------------------------------
+	MOVEQ	#-123,D2		;1368: 7485
+LAB_01CC:
+	CMPI.L	#$000000e4,D3		;136a: 0c83000000e4
+	MOVE.L	(20006,A5),D3		;1370: 262d4e26
+	BSR.W	LAB_01E8		;1374: 61000110
+	BNE.S	LAB_01CC		;1378: 66f0
+	MOVE.L	(23226,A5),D0		;137a: 202d5aba
+	ADD.W	D0,D0			;137e: d040
+	MOVE.W	(LAB_01CD,PC,D0.W),D0	;1380: 303b0006
+	JMP	(LAB_01CD,PC,D0.W)	;1384: 4efb0002
+LAB_01CD:
+	DC.W	$000e			;1388
+	ORI.B	#$16,(A2)		;138a: 00120016
+	ORI.B	#$1e,(A2)+		;138e: 001a001e
+	ORI.B	#$26,-(A2)		;1392: 00220026
+func_6_224:
+	MOVEQ	#0,D0			;1396: 7000
+	RTS				;1398: 4e75
+	MOVEQ	#1,D0			;139a: 7001
+	RTS				;139c: 4e75
+; ------------------------------------------------------------------------------
+; function 28
+; ------------------------------------------------------------------------------
+	MOVEQ	#2,D0			;139e: 7002
+	RTS				;13a0: 4e75
+	MOVEQ	#3,D0			;13a2: 7003
+	RTS				;13a4: 4e75
+	MOVEQ	#4,D0			;13a6: 7004
+	RTS				;13a8: 4e75
+	MOVEQ	#5,D0			;13aa: 7005
+	RTS				;13ac: 4e75
+	MOVEQ	#6,D0			;13ae: 7006
+	RTS				;13b0: 4e75
+LAB_01CF:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;13b2: 48e73f3e
+LAB_01D0:
+	BSR.W	LAB_01DA		;13b6: 6100006c
+func_6_161:
+	DBF	D2,LAB_01D0		;13ba: 51cafffa
+	BSR.W	LAB_01E8		;13be: 610000c6
+LAB_01D2:
+	JSR	(-414,A6)		;13c2: 4eaefe62
+	MOVE.L	(20510,A5),D6		;13c6: 2c2d501e
+LAB_01D3:
+	BSR.W	LAB_01ED		;13ca: 61000116
+LAB_01D4:
+	DBF	D0,LAB_01D3		;13ce: 51c8fffa
+	BSR.W	LAB_01ED		;13d2: 6100010e
+	LEA	(LAB_01B8+4,PC),A4	;13d6: 49fafeac
+	BNE.S	LAB_01D4		;13da: 66f2
+func_6_98:
+LAB_01D5:
+	CMPI.L	#$000000f6,D6		;13dc: 0c86000000f6
+	JSR	(-408,A6)		;13e2: 4eaefe68
+	BSR.W	LAB_01DA		;13e6: 6100003c
+	JSR	(-708,A6)		;13ea: 4eaefd3c
+	LEA	LAB_00AF,A0		;13ee: 41f9000007aa
+	MOVE.L	D5,D2			;13f4: 2405
+	LEA	(LAB_01D5+4,PC),A4	;13f6: 49faffe8
+LAB_01D7:
+; call site 231
+	LEA	(LAB_01CC,PC),A2	;13fa: 45faff6e
+	DBF	D0,LAB_01D7		;13fe: 51c8fffa
+func_6_35:
+	ADD.W	D0,D0			;1402: d040
+	MOVE.W	(LAB_01D9,PC,D0.W),D0	;1404: 303b0006
+	JMP	(LAB_01D9,PC,D0.W)	;1408: 4efb0002
+LAB_01D9:
+	DC.W	$0008			;140c
+	DC.W	$000c			;140e
+	ORI.B	#$14,(A0)		;1410: 00100014
+	MOVEQ	#0,D0			;1414: 7000
+	RTS				;1416: 4e75
+	MOVEQ	#1,D0			;1418: 7001
+	RTS				;141a: 4e75
+	MOVEQ	#2,D0			;141c: 7002
+	RTS				;141e: 4e75
+	MOVEQ	#3,D0			;1420: 7003
+	RTS				;1422: 4e75
+LAB_01DA:
+	LINK.W	A5,#-168		;1424: 4e55ff58
+	BSR.W	LAB_01E8		;1428: 6100005c
+LAB_01DB:
+; call site 168
+	MOVE.L	#LAB_0126+2,-(A7)	;142c: 2f3c00000c52
+LAB_01DC:
+	DBF	D1,LAB_01DB		;1432: 51c9fff8
+LAB_01DD:
+	BSR.W	LAB_01F1		;1436: 610000e4
+	DBF	D1,LAB_01DD		;143a: 51c9fffa
+LAB_01DE:
+	BSR.W	LAB_01ED		;143e: 610000a2
+	LEA	LAB_0048,A2		;1442: 45f9000002f2
+	BNE.S	LAB_01DE		;1448: 66f4
+LAB_01DF:
+	MOVE.L	#LAB_0066+2,-(A7)	;144a: 2f3c0000047c
+	BSR.W	LAB_01ED		;1450: 61000090
+; call site 105
+	ADD.L	D4,D4			;1454: d884
+LAB_01E0:
+	BNE.S	LAB_01DF		;1456: 66f2
+	DBF	D1,LAB_01E0		;1458: 51c9fffc
+LAB_01E1:
+	LEA	LAB_01B5,A6		;145c: 4df90000126c
+	DBF	D3,LAB_01E1		;1462: 51cbfff8
+LAB_01E3:
+	ADD.L	D4,D7			;1466: de84
+LAB_01E4:
+	DBF	D2,LAB_01E3		;1468: 51cafffc
+	ADD.L	D1,D6			;146c: dc81
+	BNE.S	LAB_01E4		;146e: 66f8
+LAB_01E5:
+; call site 42
+	ADD.L	D3,D1			;1470: d283
+LAB_01E6:
+	DBF	D5,LAB_01E5		;1472: 51cdfffc
+LAB_01E7:
+	BSR.W	LAB_01F1		;1476: 610000a4
+	LEA	LAB_0168+4,A2		;147a: 45f900000ee4
+	BNE.S	LAB_01E7		;1480: 66f4
+	UNLK	A5			;1482: 4e5d
+	RTS				;1484: 4e75
+; ------------------------------------------------------------------------------
+; function 175
+; ------------------------------------------------------------------------------
+LAB_01E8:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;1486: 48e73f3e
+	BSR.W	LAB_01ED		;148a: 61000056
+	LEA	LAB_00C3,A6		;148e: 4df900000888
+LAB_01E9:
+	TST.L	D5			;1494: 4a85
+	BSR.W	LAB_01F1		;1496: 61000084
+	LEA	(LAB_01E6,PC),A6	;149a: 4dfaffd6
+	BSR.W	LAB_01ED		;149e: 61000042
+	ADDQ.L	#quick_65,A1		;14a2: 5289
+	MOVEQ	#109,D1			;14a4: 726d
+; ------------------------------------------------------------------------------
+; function 112
+; ------------------------------------------------------------------------------
+	CMP.L	#$00009c72,D6		;14a6: bcbc00009c72
+	MOVE.W	(22922,A5),(15033,A5)	;14ac: 3b6d598a3ab9
+	MOVE.W	(3745,A5),(19708,A5)	;14b2: 3b6d0ea14cfc
+	BSR.W	LAB_01F1		;14b8: 61000062
+	MOVE.L	D5,D6			;14bc: 2c05
+	LEA	(LAB_01D2,PC),A2	;14be: 45faff02
+	LEA	LAB_019D,A6		;14c2: 4df900001136
+LAB_01EA:
+	LEA	LAB_0064,A4		;14c8: 49f900000454
+LAB_01EB:
+	DBF	D2,LAB_01EA		;14ce: 51cafff8
+; ------------------------------------------------------------------------------
+; function 49
+; ------------------------------------------------------------------------------
+	DBF	D4,LAB_01EB		;14d2: 51ccfffa
+	ADDQ.L	#5,A1			;14d6: 5a89
+	BNE.S	LAB_01EB		;14d8: 66f4
+	MOVE.L	D0,D2			;14da: 2400
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;14dc: 4cdf7cfc
+LAB_01EC:
+	RTS				;14e0: 4e75
+LAB_01ED:
+	LINK.W	A5,#-20			;14e2: 4e55ffec
+func_6_182:
+	BSR.W	LAB_01F1		;14e6: 61000034
+	JSR	(-204,A6)		;14ea: 4eaeff34
+	MOVE.L	#LAB_0069,-(A7)		;14ee: 2f3c000004b0
+	BNE.S	func_6_182		;14f4: 66f0
+	JSR	(-906,A6)		;14f6: 4eaefc76
+	JSR	(-594,A6)		;14fa: 4eaefdae
+	JSR	LAB_01FF		;14fe: 4eb9000015be
+	MOVE.L	#LAB_0140,-(A7)		;1504: 2f3c00000db4
+LAB_01EF:
+	LEA	(LAB_01E9,PC),A6	;150a: 4dfaff88
+func_6_119:
+	DBF	D0,LAB_01EF		;150e: 51c8fffa
+	MOVE.L	#LAB_00C5,-(A7)		;1512: 2f3c000008da
+	UNLK	A5			;1518: 4e5d
+	RTS				;151a: 4e75
+LAB_01F1:
+	LINK.W	A5,#-100		;151c: 4e55ff9c
+	BSR.W	LAB_01F8		;1520: 6100003e
+	JSR	(-546,A6)		;1524: 4eaefdde
+	MOVE.L	D6,D0			;1528: 2006
+	BSR.W	LAB_01FF		;152a: 61000092
+func_6_56:
+	BSR.W	LAB_01FF		;152e: 6100008e
+	BSR.W	LAB_01FF		;1532: 6100008a
+	LEA	LAB_016B,A6		;1536: 4df900000efc
+	BSR.W	LAB_01FF		;153c: 61000080
+LAB_01F3:
+	LEA	func_5_203,A0		;1540: 41f900000fe4
+	CMP.L	#$000013c7,D2		;1546: b4bc000013c7
+	BNE.S	LAB_01F3		;154c: 66f2
+; call site 189
+	BNE.S	LAB_01F3		;154e: 66f0
+LAB_01F4:
+	BSR.W	LAB_01FF		;1550: 6100006c
+LAB_01F5:
+	DBF	D2,LAB_01F4		;1554: 51cafffa
+LAB_01F7:
+	DBF	D4,LAB_01F5		;1558: 51ccfffa
+	UNLK	A5			;155c: 4e5d
+	RTS				;155e: 4e75
+LAB_01F8:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;1560: 48e73f3e
+	BSR.W	LAB_01FF		;1564: 61000058
+LAB_01F9:
+	MOVE.L	#LAB_013D,-(A7)		;1568: 2f3c00000d8e
+; call site 126
+	MOVE.L	#LAB_0088,-(A7)		;156e: 2f3c000005c8
+LAB_01FA:
+	MOVEQ	#102,D6			;1574: 7c66
+	BNE.S	LAB_01F9		;1576: 66f0
+LAB_01FB:
+	BNE.S	LAB_01FA		;1578: 66fa
+	MOVE.L	#LAB_008B,-(A7)		;157a: 2f3c000005f0
+LAB_01FC:
+	BNE.S	LAB_01FB		;1580: 66f6
+	BNE.S	LAB_01FC		;1582: 66fc
+	MOVE.L	(27620,A5),D4		;1584: 282d6be4
+	JSR	LAB_01FF		;1588: 4eb9000015be
+LAB_01FD:
+; call site 63
+	LEA	LAB_0084+2,A6		;158e: 4df9000005ac
+	DBF	D0,LAB_01FD		;1594: 51c8fff8
+	JSR	(-300,A6)		;1598: 4eaefed4
+	ADD.W	D0,D0			;159c: d040
+	MOVE.W	(LAB_01FE,PC,D0.W),D0	;159e: 303b0006
+	JMP	(LAB_01FE,PC,D0.W)	;15a2: 4efb0002
+LAB_01FE:
+	DC.W	$0008			;15a6
+	DC.W	$000c			;15a8
+	ORI.B	#$14,(A0)		;15aa: 00100014
+	MOVEQ	#0,D0			;15ae: 7000
+	RTS				;15b0: 4e75
+	MOVEQ	#1,D0			;15b2: 7001
+	RTS				;15b4: 4e75
+	MOVEQ	#2,D0			;15b6: 7002
+	RTS				;15b8: 4e75
+; ------------------------------------------------------------------------------
+; function 196
+; ------------------------------------------------------------------------------
+	MOVEQ	#3,D0			;15ba: 7003
+	RTS				;15bc: 4e75
+LAB_01FF:
+	NOP				;15be: 4e71
+	NOP				;15c0: 4e71
+	NOP				;15c2: 4e71
+	NOP				;15c4: 4e71
+	NOP				;15c6: 4e71
+	NOP				;15c8: 4e71
+	NOP				;15ca: 4e71
+	NOP				;15cc: 4e71
+	NOP				;15ce: 4e71
+	NOP				;15d0: 4e71
+	NOP				;15d2: 4e71
+	NOP				;15d4: 4e71
+	NOP				;15d6: 4e71
+	NOP				;15d8: 4e71
+	NOP				;15da: 4e71
+	NOP				;15dc: 4e71
+	NOP				;15de: 4e71
+	NOP				;15e0: 4e71
+	NOP				;15e2: 4e71
+	NOP				;15e4: 4e71
+	NOP				;15e6: 4e71
+	NOP				;15e8: 4e71
+	NOP				;15ea: 4e71
+	NOP				;15ec: 4e71
+	NOP				;15ee: 4e71
+	NOP				;15f0: 4e71
+	NOP				;15f2: 4e71
+	NOP				;15f4: 4e71
+	NOP				;15f6: 4e71
+	NOP				;15f8: 4e71
+	NOP				;15fa: 4e71
+	NOP				;15fc: 4e71
+	RTS				;15fe: 4e75
+	END
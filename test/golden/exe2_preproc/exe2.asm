@@ -0,0 +1,1897 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+	MC68020
+
+
+
+	SECTION S_0,CODE
+
+SECSTRT_0:
+	BSR.W	LAB_000A
+LAB_0002:
+	LEA	(SECSTRT_0+2,PC),A0
+	BSR.W	LAB_000A
+LAB_0003:
+	LEA	LAB_003A,A6
+	CMP.L	#$0000b934,D4
+	ADDQ.L	#5,A1
+	ADD.L	D0,D0
+	MOVE.W	(16178,A5),(22220,A5)
+LAB_0004:
+	MOVE.L	#LAB_005D,-(A7)
+	JSR	(-822,A6)
+	BNE.S	LAB_0004
+	ADDQ.L	#1,A6
+LAB_0005:
+	MOVE.W	(19202,A5),(11796,A5)
+	DBF	D0,LAB_0005
+LAB_0006:
+	CMPI.L	#$00000064,D3
+	BSR.W	LAB_000A
+LAB_0007:
+	BSR.W	LAB_001A
+LAB_0008:
+	LEA	(SECSTRT_0,PC),A0
+	CMPI.L	#$0000000f,D6
+	BSR.W	LAB_001A
+LAB_0009:
+	BNE.S	LAB_0008
+	DBF	D5,LAB_0009
+	CMP.L	#$0000538c,D2
+	MOVEQ	#102,D0
+	RTS
+LAB_000A:
+	LINK.W	A5,#-200
+	BSR.W	LAB_0017
+LAB_000B:
+	LEA	(LAB_0002+2,PC),A4
+	DBF	D1,LAB_000B
+	LEA	LAB_012F+2,A2
+LAB_000C:
+	MOVEQ	#-42,D2
+LAB_000D:
+	MOVE.L	#LAB_0132,-(A7)
+	BSR.W	LAB_0025
+	BNE.S	LAB_000C
+LAB_000E:
+	LEA	(LAB_0007+2,PC),A6
+LAB_000F:
+	DBF	D1,LAB_000E
+LAB_0010:
+	MOVE.L	#LAB_0119,-(A7)
+	MOVE.L	#LAB_01AA,-(A7)
+	BNE.S	LAB_000F
+	CMPI.L	#$0000001f,D4
+	BSR.W	LAB_0025
+LAB_0011:
+	BSR.W	LAB_0017
+	DBF	D0,LAB_0011
+	ADDQ.L	#2,A2
+	JSR	(-546,A6)
+	BSR.W	LAB_0025
+LAB_0012:
+	JSR	LAB_0025
+	BSR.W	LAB_001A
+LAB_0013:
+	BSR.W	LAB_001A
+	DBF	D5,LAB_0013
+	BSR.W	LAB_001A
+	LEA	(LAB_0006,PC),A0
+LAB_0014:
+	BSR.W	LAB_0025
+	DBF	D3,LAB_0014
+	LEA	LAB_00A3,A4
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0015,PC,D0.W),D0
+	JMP	(LAB_0015,PC,D0.W)
+LAB_0015:
+	DC.L	$000c0010,$00140018,$001c0020
+	DC.W	$7000
+LAB_0016:
+	DC.L	$4e757001,$4e757002,$4e757003,$4e757004
+	DC.L	$4e757005
+	DC.W	$4e75
+LAB_0017:
+	BSR.W	LAB_001A
+	TST.L	D4
+LAB_0018:
+	BSR.W	LAB_001A
+	DBF	D0,LAB_0018
+	BSR.W	LAB_002D
+	BNE.S	LAB_0018
+LAB_0019:
+	BSR.W	LAB_001A
+	DBF	D0,LAB_0019
+	RTS
+LAB_001A:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0025
+	LEA	LAB_00C0+4,A6
+LAB_001B:
+	BSR.W	LAB_0025
+	BNE.S	LAB_001B
+LAB_001C:
+	JSR	(-744,A6)
+	BNE.S	LAB_001C
+LAB_001D:
+	LEA	(LAB_001D,PC),A0
+	LEA	(LAB_0012,PC),A4
+	ADDQ.L	#2,A0
+	BNE.S	LAB_001D
+LAB_001E:
+	BSR.W	LAB_0025
+	DBF	D0,LAB_001E
+	BSR.W	LAB_002D
+LAB_001F:
+	CMP.L	#$0000179c,D7
+LAB_0020:
+	BSR.W	LAB_0034
+LAB_0021:
+	ADD.L	D5,D1
+LAB_0022:
+	BNE.S	LAB_0021
+	BNE.S	LAB_0020
+	CMPI.L	#$0000000e,D3
+	MOVE.L	(12850,A5),D2
+	ADDQ.L	#7,A6
+	LEA	LAB_008A,A4
+	BSR.W	LAB_0025
+	MOVE.L	(24826,A5),D1
+	ADD.L	D6,D3
+	LEA	(LAB_0010+2,PC),A4
+	JSR	LAB_0025
+	ADDQ.L	#7,A2
+LAB_0023:
+	JSR	(-282,A6)
+	MOVE.W	(16334,A5),(11569,A5)
+	ADD.L	D5,D7
+LAB_0024:
+	BNE.S	LAB_0023
+	BNE.S	LAB_0024
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0025:
+	LINK.W	A5,#-92
+	BSR.W	LAB_002D
+	TST.L	D1
+	MOVE.L	D2,D4
+	ADD.L	D2,D1
+LAB_0026:
+	MOVEQ	#20,D5
+LAB_0027:
+	DBF	D4,LAB_0026
+	ADD.L	D1,D5
+	BSR.W	LAB_002D
+	LEA	(LAB_001E,PC),A6
+	BSR.W	LAB_0034
+	MOVE.L	#LAB_000D,-(A7)
+	JSR	LAB_0036
+	CMPI.L	#$00000063,D6
+	MOVE.L	(5690,A5),D0
+LAB_0028:
+	CMPI.L	#$0000009d,D7
+LAB_002A:
+	BNE.S	LAB_0028
+	BNE.S	LAB_002A
+	MOVE.L	D1,D6
+	BRA.S	LAB_002B
+	DC.B	"Workbench",0
+LAB_002B:
+	UNLK	A5
+LAB_002C:
+	RTS
+LAB_002D:
+	BSR.W	LAB_0034
+	CMP.L	#$00003eed,D3
+	CMPI.L	#$000000d2,D0
+	MOVE.L	#LAB_0058,-(A7)
+	JSR	LAB_0045
+	MOVE.L	#LAB_006F+2,-(A7)
+	JSR	(-654,A6)
+	ADDQ.L	#1,A0
+	JSR	LAB_0045
+	MOVE.L	#LAB_011B,-(A7)
+	JSR	LAB_0036
+LAB_002E:
+	LEA	LAB_0110,A6
+LAB_002F:
+	BNE.S	LAB_002E
+	DBF	D4,LAB_002F
+	ADDQ.L	#5,A5
+LAB_0030:
+	LEA	(LAB_002A,PC),A2
+LAB_0031:
+	DBF	D4,LAB_0030
+	BSR.W	LAB_0034
+	JSR	(-210,A6)
+LAB_0032:
+	BNE.S	LAB_0031
+LAB_0033:
+	DBF	D3,LAB_0032
+	RTS
+LAB_0034:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0036
+	MOVE.L	(26998,A5),D3
+	MOVEQ	#7,D1
+	BRA.S	LAB_0035
+	DC.B	"dos.library",0
+LAB_0035:
+	MOVEQ	#100,D1
+	BNE.S	LAB_0035
+	JSR	LAB_0036
+	MOVE.L	(23682,A5),D4
+	LEA	LAB_0147,A4
+	JSR	LAB_0045
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0036:
+	LINK.W	A5,#-76
+	BSR.W	LAB_0045
+LAB_0037:
+	MOVE.W	(11690,A5),(26225,A5)
+	TST.L	D5
+LAB_0038:
+	JSR	(-84,A6)
+	BNE.S	LAB_0037
+	BNE.S	LAB_0038
+	MOVE.L	#LAB_0008,-(A7)
+LAB_0039:
+	LEA	(LAB_0033+2,PC),A4
+	BRA.S	LAB_003C
+LAB_003A:
+	DC.W	$6772
+LAB_003B:
+	DC.B	"aphics.library",0,0
+LAB_003C:
+	CMP.L	#$0000df55,D5
+	BNE.S	LAB_0039
+LAB_003D:
+	CMP.L	#$0000146b,D0
+	BSR.W	LAB_0052
+	BNE.S	LAB_003D
+	ADDQ.L	#1,A1
+	JSR	(-720,A6)
+	MOVEQ	#62,D4
+LAB_003E:
+	LEA	(LAB_0016,PC),A0
+LAB_003F:
+	MOVEQ	#125,D4
+	BSR.W	LAB_0045
+LAB_0040:
+	BRA.S	LAB_0041
+	DC.B	"Error: ",0
+LAB_0041:
+	BNE.S	LAB_003F
+	BNE.S	LAB_0040
+	MOVE.W	(24338,A5),(5676,A5)
+	MOVEQ	#-73,D2
+	LEA	LAB_0054,A0
+LAB_0042:
+	MOVE.L	D3,D1
+	DBF	D5,LAB_0042
+LAB_0043:
+	BSR.W	LAB_0052
+	DBF	D6,LAB_0043
+	ADD.L	D1,D2
+	MOVE.W	(14566,A5),(25111,A5)
+LAB_0044:
+	UNLK	A5
+	RTS
+LAB_0045:
+	LINK.W	A5,#-180
+LAB_0046:
+	BSR.W	LAB_0052
+LAB_0047:
+	DBF	D3,LAB_0046
+LAB_0048:
+	LEA	(LAB_003B,PC),A4
+LAB_0049:
+	BNE.S	LAB_0048
+LAB_004A:
+	DBF	D3,LAB_0049
+	MOVE.L	D5,D5
+	BNE.S	LAB_004A
+	LEA	LAB_00D2+2,A6
+	ADD.L	D2,D3
+LAB_004B:
+	LEA	LAB_00CB,A6
+	MOVE.L	#LAB_01AD,-(A7)
+	MOVE.L	D6,D3
+	CMPI.L	#$00000013,D2
+	BSR.W	LAB_0052
+	MOVE.L	(29078,A5),D4
+LAB_004C:
+	MOVE.L	#LAB_005B,-(A7)
+	DBF	D7,LAB_004C
+LAB_004D:
+	MOVE.L	D7,D3
+LAB_004E:
+	DBF	D1,LAB_004D
+	DBF	D6,LAB_004E
+	JSR	(-174,A6)
+LAB_004F:
+	MOVE.L	#LAB_0096,-(A7)
+	MOVEQ	#105,D1
+	CMP.L	#$00004001,D4
+	CMP.L	#$00008b4c,D7
+	ADD.L	D3,D0
+	BSR.W	LAB_0052
+LAB_0050:
+	JSR	(-456,A6)
+	DBF	D7,LAB_0050
+LAB_0051:
+	BSR.W	LAB_0052
+	CMPI.L	#$000000f2,D6
+	MOVE.W	(31977,A5),(2640,A5)
+	CMP.L	#$00006434,D7
+	UNLK	A5
+	RTS
+LAB_0052:
+	JSR	SECSTRT_2
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	DC.L	$47fb4e5b,$38449725,$5f942585,$26ff9c46
+	DC.L	$0e2fc57b,$5788eab5,$303c921f,$08a0b5ea
+	DC.L	$4439f12e
+LAB_0053:
+	DC.B	"Ready.",0,0
+	DC.L	LAB_01A1
+	DC.L	$2bdf0438,$4572726f
+	DC.W	$723a
+LAB_0054:
+	DC.W	$2000
+	DC.L	LAB_0115
+	DC.L	LAB_00E2
+	DC.L	$25733a20
+LAB_0055:
+	DC.B	"%ld",10,0,0
+LAB_0056:
+	DC.L	$540f2a49
+	DC.W	$5169
+LAB_0057:
+	DC.L	$90c2708d
+	DC.W	$5c5b
+	DC.L	LAB_00C5
+	DC.L	$7958d9db
+	DC.L	LAB_0106
+	DC.L	$39a97081,$2c919025,$3dbfbd4a
+	DC.W	$5fd5
+LAB_0058:
+	DC.L	$ac56037e
+	DC.W	$672e
+LAB_0059:
+	DC.L	LAB_0171
+	DC.W	$46f3
+LAB_005A:
+	DC.L	$b50f0c16,$639352ac,$4e70696e,$74756974
+	DC.L	$696f6e2e,$6c696272
+	DC.W	$6172
+LAB_005B:
+	DC.L	$79000ae0,$fda75b9f,$887e0cb6,$5b045be0
+	DC.L	$35f17f9f
+	DC.W	$7e55
+LAB_005C:
+	DC.L	$71e4cdb1
+LAB_005D:
+	DC.L	LAB_011F
+LAB_005E:
+	DC.L	$3acbbc70
+	DC.W	$17f8
+LAB_005F:
+	DC.W	$7dbf
+	DC.L	LAB_01BA
+	DC.W	$76e5
+LAB_0060:
+	DC.L	$98dd212b,$66e276fd
+	DC.W	$3e6f
+	DC.L	LAB_0053
+	DC.L	$355ccbe9
+	DS.L	3
+LAB_0061:
+	DS.L	1
+LAB_0062:
+	DS.L	4
+	DS.W	1
+LAB_0063:
+	DS.L	1
+	DS.W	1
+
+
+	SECTION S_2,CODE
+
+SECSTRT_2:
+	LINK.W	A5,#-100
+	BSR.W	LAB_006D
+LAB_0065:
+	MOVE.L	#LAB_0118,-(A7)
+LAB_0066:
+	JSR	(-798,A6)
+	ADDQ.L	#2,A7
+LAB_0067:
+	CMP.L	#$000006ad,D6
+LAB_0068:
+	CMP.L	#$00003785,D3
+LAB_0069:
+	CMP.L	#$0000ef94,D7
+	DBF	D3,LAB_0069
+	MOVE.L	(27282,A5),D1
+	MOVE.W	(25397,A5),(20147,A5)
+LAB_006B:
+	LEA	(LAB_0066,PC),A2
+	LEA	(LAB_0067+2,PC),A0
+	CMPI.L	#$000000da,D1
+	ADDQ.L	#7,A1
+	ADDQ.L	#7,A7
+LAB_006C:
+	ADD.L	D1,D4
+	DBF	D4,LAB_006C
+	UNLK	A5
+	RTS
+LAB_006D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0078
+	LEA	LAB_0028+2,A4
+	ADDQ.L	#5,A0
+	MOVE.L	D4,D7
+LAB_006E:
+	CMPI.L	#$00000078,D0
+LAB_006F:
+	DBF	D0,LAB_006E
+	JSR	(-594,A6)
+LAB_0070:
+	MOVE.W	(2940,A5),(17258,A5)
+	MOVE.L	D1,D1
+LAB_0071:
+	JSR	LAB_0084
+LAB_0072:
+	DBF	D6,LAB_0071
+LAB_0073:
+	BSR.W	LAB_0094
+	DBF	D5,LAB_0073
+	BNE.S	LAB_0073
+LAB_0074:
+	MOVE.L	D7,D4
+	MOVE.L	D6,D1
+	BNE.S	LAB_0074
+	LEA	LAB_0061,A6
+LAB_0075:
+	MOVE.W	(22672,A5),(3105,A5)
+	DBF	D1,LAB_0075
+	BSR.W	LAB_0084
+	BSR.W	LAB_0078
+LAB_0076:
+	LEA	LAB_0056,A6
+LAB_0077:
+	LEA	LAB_003D,A2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0078:
+	LINK.W	A5,#-180
+	BSR.W	LAB_0084
+LAB_0079:
+	BSR.W	LAB_0094
+LAB_007A:
+	DBF	D3,LAB_0079
+	BNE.S	LAB_0079
+	MOVEQ	#115,D3
+	MOVE.L	D7,D3
+	CMPI.L	#$000000ab,D2
+	ADDQ.L	#5,A2
+	CMPI.L	#$0000002e,D2
+LAB_007B:
+	JSR	LAB_0084
+	BNE.S	LAB_007B
+	BSR.W	LAB_0084
+LAB_007C:
+	LEA	(LAB_0065+4,PC),A2
+LAB_007D:
+	DBF	D0,LAB_007C
+LAB_007E:
+	CMP.L	#$0000b010,D4
+LAB_007F:
+	BNE.S	LAB_007E
+	DBF	D1,LAB_007F
+LAB_0080:
+	CMP.L	#$00003eb3,D6
+	DBF	D6,LAB_0080
+	JSR	LAB_0084
+	BSR.W	LAB_0084
+LAB_0081:
+	MOVE.L	(134,A5),D5
+	DBF	D3,LAB_0081
+	LEA	(LAB_006B+2,PC),A6
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0082,PC,D0.W),D0
+	JMP	(LAB_0082,PC,D0.W)
+LAB_0082:
+	DC.L	$000e0012,$0016001a,$001e0022,$00267000
+	DC.L	$4e757001
+LAB_0083:
+	DC.L	$4e757002,$4e757003,$4e757004,$4e757005
+	DC.L	$4e757006
+	DC.W	$4e75
+LAB_0084:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0094
+	MOVE.L	#LAB_01AF+2,-(A7)
+	CMP.L	#$0000385c,D5
+	BSR.W	LAB_00AA
+LAB_0085:
+	BSR.W	LAB_00AA
+	MOVEQ	#127,D0
+	BNE.S	LAB_0085
+	JSR	LAB_00AA
+LAB_0087:
+	CMP.L	#$0000fd49,D7
+LAB_0088:
+	BNE.S	LAB_0087
+	DBF	D6,LAB_0088
+LAB_0089:
+	LEA	(LAB_0072,PC),A2
+	DBF	D1,LAB_0089
+	MOVE.L	#LAB_003D,-(A7)
+LAB_008A:
+	CMPI.L	#$00000083,D2
+LAB_008B:
+	BSR.W	LAB_0094
+	MOVEQ	#-76,D1
+	BNE.S	LAB_008B
+LAB_008C:
+	ADD.L	D6,D7
+	DBF	D6,LAB_008C
+	CMPI.L	#$00000077,D3
+	LEA	LAB_01C4,A6
+	MOVE.L	(9028,A5),D2
+	MOVE.L	#LAB_0157,-(A7)
+	ADDQ.L	#5,A6
+LAB_008D:
+	LEA	(LAB_0070+2,PC),A4
+	ADD.L	D0,D7
+	ADDQ.L	#2,A2
+LAB_008E:
+	LEA	(LAB_008D,PC),A0
+LAB_008F:
+	DBF	D6,LAB_008E
+	DBF	D2,LAB_008F
+	JSR	(-282,A6)
+LAB_0090:
+	MOVE.L	(22822,A5),D2
+LAB_0091:
+	DBF	D2,LAB_0090
+	DBF	D3,LAB_0091
+LAB_0092:
+	LEA	(LAB_0069+4,PC),A0
+	DBF	D0,LAB_0092
+	CMP.L	#$0000ed0f,D3
+	BSR.W	LAB_0094
+LAB_0093:
+	BSR.W	LAB_0094
+	ADDQ.L	#4,A7
+	LEA	(LAB_0068+4,PC),A4
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0094:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_009E
+	MOVE.W	(10692,A5),(151,A5)
+	CMP.L	#$0000994f,D7
+LAB_0095:
+	MOVE.L	#LAB_0116,-(A7)
+	ADDQ.L	#6,A3
+	JSR	LAB_009E
+LAB_0096:
+	BNE.S	LAB_0095
+	DBF	D0,LAB_0096
+LAB_0097:
+	MOVE.L	#LAB_0124,-(A7)
+LAB_0098:
+	DBF	D1,LAB_0097
+LAB_0099:
+	DBF	D5,LAB_0098
+LAB_009A:
+	DBF	D5,LAB_0099
+LAB_009B:
+	BNE.S	LAB_009A
+	BNE.S	LAB_009B
+LAB_009C:
+	BSR.W	LAB_00B3
+	DBF	D4,LAB_009C
+	MOVE.L	(19366,A5),D3
+	LEA	(LAB_0083,PC),A6
+	LEA	LAB_0117,A2
+	BSR.W	LAB_009E
+LAB_009D:
+	JSR	(-924,A6)
+	DBF	D3,LAB_009D
+	MOVEQ	#26,D6
+	ADD.L	D7,D3
+	LEA	(LAB_0074,PC),A4
+	MOVE.L	#LAB_0104,-(A7)
+	BSR.W	LAB_00B3
+	CMP.L	#$000043e5,D3
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_009E:
+	BSR.W	LAB_00AA
+	BSR.W	LAB_00B3
+	CMP.L	#$0000691f,D3
+	ADDQ.L	#1,A2
+	BSR.W	LAB_00B3
+	MOVE.L	#LAB_0114,-(A7)
+	MOVE.W	(11737,A5),(28354,A5)
+	LEA	LAB_010F,A6
+LAB_009F:
+	MOVE.L	(5082,A5),D7
+	BSR.W	LAB_00B3
+LAB_00A1:
+	CMPI.L	#$00000065,D1
+LAB_00A2:
+	DBF	D5,LAB_00A1
+LAB_00A3:
+	MOVE.L	#LAB_0111,-(A7)
+LAB_00A4:
+	BNE.S	LAB_00A2
+	DBF	D5,LAB_00A4
+	JSR	(-834,A6)
+	MOVE.L	(1384,A5),D1
+	BSR.W	LAB_00B3
+	BRA.S	LAB_00A5
+	DC.B	"Out of memory",0
+LAB_00A5:
+	CMPI.L	#$00000004,D7
+LAB_00A6:
+	JSR	LAB_00AA
+LAB_00A7:
+	MOVE.L	#LAB_0051,-(A7)
+	BSR.W	LAB_00B3
+	BNE.S	LAB_00A6
+LAB_00A8:
+	MOVE.L	#LAB_004F+2,-(A7)
+	BNE.S	LAB_00A8
+	LEA	(LAB_0093+2,PC),A6
+	MOVE.L	D6,D0
+LAB_00A9:
+	MOVE.L	#LAB_016C,-(A7)
+	BNE.S	LAB_00A9
+	BSR.W	LAB_00AA
+	RTS
+LAB_00AA:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00B3
+LAB_00AB:
+	ADDQ.L	#4,A7
+	JSR	LAB_00B3
+	JSR	(-48,A6)
+	BNE.S	LAB_00AB
+LAB_00AC:
+	JSR	(-768,A6)
+	DBF	D2,LAB_00AC
+	MOVE.L	D2,D3
+	MOVE.L	#LAB_011E,-(A7)
+	BSR.W	LAB_00B3
+	LEA	LAB_0027,A0
+LAB_00AD:
+	LEA	(LAB_0077,PC),A4
+	MOVE.L	#LAB_00DC+2,-(A7)
+	BNE.S	LAB_00AD
+LAB_00AE:
+	ADD.L	D2,D4
+	DBF	D7,LAB_00AE
+	BSR.W	LAB_00B3
+	CMPI.L	#$0000003a,D6
+	MOVE.L	D4,D5
+LAB_00AF:
+	MOVE.L	D2,D4
+	DBF	D6,LAB_00AF
+	ADDQ.L	#2,A3
+	BRA.S	LAB_00B0
+	DC.B	"topaz.font",0,0
+LAB_00B0:
+	LEA	(LAB_0085+2,PC),A4
+LAB_00B1:
+	DBF	D3,LAB_00B0
+	DBF	D0,LAB_00B1
+LAB_00B2:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00B3:
+	JSR	SECSTRT_3
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+LAB_00B4:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_3,CODE
+
+SECSTRT_3:
+	BSR.W	LAB_00BC
+	MOVE.L	#LAB_0013,-(A7)
+LAB_00B6:
+	ADD.L	D1,D3
+	DBF	D1,LAB_00B6
+LAB_00B7:
+	MOVE.W	(22586,A5),(30218,A5)
+	DBF	D6,LAB_00B7
+	BNE.S	LAB_00B7
+	MOVEQ	#6,D3
+LAB_00B8:
+	ADD.L	D0,D7
+LAB_00B9:
+	DBF	D7,LAB_00B8
+	ADD.W	D0,D0
+	MOVE.W	(LAB_00BA,PC,D0.W),D0
+	JMP	(LAB_00BA,PC,D0.W)
+LAB_00BA:
+	DC.L	$000a000e,$00120016,$001a7000
+	DC.W	$4e75
+LAB_00BB:
+	DC.L	$70014e75,$70024e75,$70034e75,$70044e75
+LAB_00BC:
+	LINK.W	A5,#-28
+LAB_00BD:
+	BSR.W	LAB_00C4
+	DBF	D1,LAB_00BD
+LAB_00BE:
+	ADDQ.L	#3,A4
+LAB_00BF:
+	DBF	D7,LAB_00BE
+	BNE.S	LAB_00BF
+LAB_00C0:
+	CMPI.L	#$000000af,D2
+	MOVE.L	#LAB_0123,-(A7)
+LAB_00C1:
+	MOVE.W	(8735,A5),(18843,A5)
+	DBF	D0,LAB_00C1
+	MOVE.W	(24848,A5),(19922,A5)
+LAB_00C2:
+	JSR	(-402,A6)
+	BSR.W	LAB_00C4
+	BNE.S	LAB_00C2
+LAB_00C3:
+	ADDQ.L	#2,A3
+	DBF	D7,LAB_00C3
+	MOVE.W	(15440,A5),(20008,A5)
+	BSR.W	LAB_00E3
+	UNLK	A5
+	RTS
+LAB_00C4:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00D4
+	JSR	LAB_00E3
+LAB_00C5:
+	MOVE.L	D3,D3
+LAB_00C6:
+	ADDQ.L	#1,A4
+	DBF	D6,LAB_00C6
+	MOVE.W	(13954,A5),(18799,A5)
+	CMP.L	#$0000adc9,D1
+	MOVEQ	#-53,D1
+LAB_00C7:
+	LEA	LAB_0120,A0
+	BSR.W	LAB_00E3
+LAB_00C8:
+	BNE.S	LAB_00C7
+	BNE.S	LAB_00C8
+LAB_00C9:
+	LEA	LAB_0121,A0
+	JSR	LAB_00E3
+	ADDQ.L	#2,A6
+LAB_00CA:
+	BNE.S	LAB_00C9
+	DBF	D0,LAB_00CA
+	CMPI.L	#$000000cd,D2
+	BRA.S	LAB_00CD
+	DC.B	"intuit"
+LAB_00CB:
+	DC.B	"ion.li"
+LAB_00CC:
+	DC.B	"brary",0
+LAB_00CD:
+	BSR.W	LAB_00D4
+	JSR	LAB_00EA
+LAB_00CE:
+	BSR.W	LAB_00EA
+	BNE.S	LAB_00CE
+LAB_00CF:
+	MOVE.L	D7,D3
+	DBF	D4,LAB_00CF
+LAB_00D0:
+	MOVE.L	#LAB_0044,-(A7)
+	CMPI.L	#$00000054,D7
+LAB_00D1:
+	MOVE.L	D6,D5
+LAB_00D2:
+	DBF	D0,LAB_00D1
+LAB_00D3:
+	MOVE.W	(14748,A5),(9711,A5)
+	BNE.S	LAB_00D3
+	BSR.W	LAB_00E3
+	ADD.L	D7,D0
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00D4:
+	BSR.W	LAB_00E3
+LAB_00D5:
+	DBF	D3,LAB_00D4
+LAB_00D6:
+	DBF	D3,LAB_00D5
+LAB_00D7:
+	BRA.S	LAB_00D8
+	DC.B	"Ready.",0,0
+LAB_00D8:
+	LEA	LAB_00D6,A4
+	BRA.S	LAB_00D9
+	DC.B	"Out of memory",0
+LAB_00D9:
+	BNE.S	LAB_00D7
+	BSR.W	LAB_00F0
+	MOVE.L	#LAB_005E,-(A7)
+LAB_00DA:
+	BNE.S	LAB_00D9
+	MOVE.L	(23910,A5),D7
+LAB_00DB:
+	JSR	LAB_00EA
+	BNE.S	LAB_00DB
+LAB_00DC:
+	MOVE.L	#LAB_01C3,-(A7)
+	DBF	D3,LAB_00DC
+	LEA	LAB_001F,A4
+LAB_00DE:
+	LEA	(LAB_00B6,PC),A0
+LAB_00E0:
+	BNE.S	LAB_00DE
+	BSR.W	LAB_00F0
+	BSR.W	LAB_00F0
+	LEA	(LAB_00DA,PC),A6
+LAB_00E1:
+	CMP.L	#$00009e50,D0
+LAB_00E2:
+	JSR	(-924,A6)
+	BNE.S	LAB_00E1
+	RTS
+LAB_00E3:
+	BSR.W	LAB_00EA
+	DBF	D4,LAB_00E3
+	JSR	LAB_00F0
+LAB_00E4:
+	MOVEQ	#-3,D3
+LAB_00E5:
+	DBF	D2,LAB_00E4
+	MOVE.W	(28974,A5),(16972,A5)
+LAB_00E6:
+	CMPI.L	#$000000d2,D3
+	BNE.S	LAB_00E5
+	BSR.W	LAB_00F0
+	JSR	LAB_00F0
+LAB_00E7:
+	BSR.W	LAB_00EA
+	LEA	(LAB_00DE+2,PC),A4
+LAB_00E8:
+	BNE.S	LAB_00E7
+LAB_00E9:
+	MOVEQ	#-5,D0
+	MOVEQ	#14,D2
+	BNE.S	LAB_00E9
+	ADD.L	D0,D4
+	CMP.L	#$00004eca,D5
+	LEA	LAB_0131,A6
+	LEA	(LAB_00D0,PC),A4
+	BSR.W	LAB_00EA
+	MOVE.L	(7308,A5),D2
+	RTS
+LAB_00EA:
+	BSR.W	LAB_00F0
+LAB_00EB:
+	ADD.L	D2,D1
+	TST.L	D6
+	MOVE.L	(14794,A5),D5
+	BNE.S	LAB_00EB
+	MOVE.L	D2,D3
+	MOVE.L	D3,D1
+LAB_00EC:
+	MOVE.L	D4,D3
+LAB_00ED:
+	DBF	D2,LAB_00EC
+	DBF	D6,LAB_00ED
+	MOVEQ	#48,D6
+LAB_00EE:
+	BSR.W	LAB_00FB
+LAB_00EF:
+	BNE.S	LAB_00EE
+	MOVE.L	#LAB_0060,-(A7)
+	BNE.S	LAB_00EF
+	RTS
+LAB_00F0:
+	LINK.W	A5,#-20
+	BSR.W	LAB_00FB
+LAB_00F1:
+	LEA	(LAB_00E8,PC),A4
+	LEA	LAB_013A+2,A2
+	BNE.S	LAB_00F1
+	BSR.W	LAB_00FF
+	ADD.L	D2,D3
+	LEA	LAB_0140,A2
+LAB_00F2:
+	JSR	LAB_00FF
+LAB_00F3:
+	DBF	D2,LAB_00F2
+	DBF	D7,LAB_00F3
+	MOVE.W	(28459,A5),(30517,A5)
+LAB_00F4:
+	ADD.L	D7,D2
+LAB_00F5:
+	DBF	D4,LAB_00F4
+	BNE.S	LAB_00F5
+	MOVE.L	D3,D7
+	LEA	LAB_00CC,A0
+LAB_00F6:
+	CMP.L	#$00008bd3,D3
+	DBF	D4,LAB_00F6
+	MOVEQ	#-15,D4
+	CMPI.L	#$0000005e,D2
+LAB_00F7:
+	LEA	(LAB_00DB,PC),A4
+	BRA.S	LAB_00F8
+	DC.B	"Ready.",0,0
+LAB_00F8:
+	BNE.S	LAB_00F7
+	MOVE.L	(14822,A5),D4
+	ADD.L	D6,D5
+	MOVE.W	(11542,A5),(12236,A5)
+	JSR	LAB_0105
+LAB_00F9:
+	LEA	LAB_0022,A2
+	MOVE.L	(10330,A5),D0
+	BNE.S	LAB_00F9
+	LEA	(LAB_00F3,PC),A2
+	ADD.W	D0,D0
+	MOVE.W	(LAB_00FA,PC,D0.W),D0
+	JMP	(LAB_00FA,PC,D0.W)
+LAB_00FA:
+	DC.L	$000c0010,$00140018,$001c0020,$70004e75
+	DC.L	$70014e75,$70024e75,$70034e75,$70044e75
+	DC.L	$70054e75
+LAB_00FB:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_00FF
+	TST.L	D6
+LAB_00FC:
+	JSR	LAB_0105
+LAB_00FD:
+	DBF	D3,LAB_00FC
+	CMPI.L	#$00000007,D0
+	ADDQ.L	#6,A4
+	CMPI.L	#$0000000f,D5
+LAB_00FE:
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_00FF:
+	LINK.W	A5,#-92
+	BSR.W	LAB_0105
+LAB_0100:
+	LEA	(LAB_00FD+2,PC),A2
+	MOVE.L	#LAB_0185+2,-(A7)
+	LEA	LAB_011C,A4
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0102,PC,D0.W),D0
+LAB_0101:
+	JMP	(LAB_0102,PC,D0.W)
+LAB_0102:
+	DC.L	$0008000c
+LAB_0103:
+	DC.L	$00100014,$70004e75,$70014e75,$70024e75
+LAB_0104:
+	DC.L	$70034e75
+LAB_0105:
+	BSR.W	LAB_010E
+	TST.L	D6
+LAB_0106:
+	BSR.W	LAB_010E
+	BNE.S	LAB_0105
+LAB_0108:
+	MOVE.L	D5,D2
+	DBF	D7,LAB_0108
+	BRA.S	LAB_0109
+	DC.B	"dos.library",0
+LAB_0109:
+	MOVE.L	#LAB_00A7,-(A7)
+	LEA	LAB_0179,A4
+	MOVE.L	#LAB_004B,-(A7)
+LAB_010A:
+	CMPI.L	#$00000087,D5
+LAB_010B:
+	DBF	D0,LAB_010A
+	DBF	D1,LAB_010B
+	JSR	(-894,A6)
+	MOVE.W	(13685,A5),(32095,A5)
+	MOVE.L	D3,D4
+	CMP.L	#$0000e3ed,D6
+LAB_010C:
+	BSR.W	LAB_010E
+	DBF	D6,LAB_010C
+	CMP.L	#$000090f2,D1
+	JSR	LAB_010E
+	BRA.S	LAB_010D
+	DC.B	"Out of memory",0
+LAB_010D:
+	RTS
+LAB_010E:
+	JSR	SECSTRT_5
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_4,DATA
+
+SECSTRT_4:
+	DC.L	$31c453ed,$4572726f
+LAB_010F:
+	DC.W	$723a
+LAB_0110:
+	DC.L	$20000e2e,$7dd6734d
+	DC.W	$8e69
+LAB_0111:
+	DC.L	LAB_0062
+	DC.W	$3a25
+LAB_0112:
+	DC.L	$747a48cf
+	DC.W	$df07
+LAB_0113:
+	DC.L	LAB_00FE
+	DC.L	LAB_0103
+	DC.L	$04604b49,$2df8cb14,$415e18d4
+	DC.W	$0bd7
+LAB_0114:
+	DC.W	$b2b3
+LAB_0115:
+	DC.L	$5073bc44,$775842ec,$0c1f3afc,$61f0661e
+	DC.L	$477d3905
+LAB_0116:
+	DC.L	$41d85083
+	DC.L	LAB_004E
+	DC.L	$0967787c,$28085c47,$0b41d5af
+LAB_0117:
+	DC.B	"Out of memor"
+LAB_0118:
+	DC.W	$7900
+	DC.L	LAB_0137
+	DC.L	$16a40973,$67726170,$68696373,$2e6c6962
+	DC.L	$72617279,$0000277f
+	DC.W	$d1e8
+LAB_0119:
+	DC.W	$2c6a
+LAB_011A:
+	DC.L	$3b736be4
+LAB_011B:
+	DC.L	$eebb646f
+LAB_011C:
+	DC.L	$732e6c69,$62726172,$79002332
+	DC.W	$84d3
+	DC.L	LAB_0055
+	DC.L	$1dfdbfcc,$500a94ed,$434f4e3a
+LAB_011D:
+	DC.B	"0/0/640/200/Ou"
+LAB_011E:
+	DC.W	$7470
+LAB_011F:
+	DC.W	$7574
+LAB_0120:
+	DS.W	1
+	DC.L	LAB_00B9
+	DC.L	$21657f17,$5184fee1,$6483d998
+	DS.W	1
+LAB_0121:
+	DS.L	3
+	DS.W	1
+LAB_0122:
+	DS.L	2
+LAB_0123:
+	DS.L	1
+	DS.W	1
+LAB_0124:
+	DS.L	2
+	DS.W	1
+
+
+	SECTION S_5,CODE
+
+SECSTRT_5:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0126:
+	BSR.W	LAB_0138
+	DBF	D0,LAB_0126
+	LEA	LAB_0160,A6
+LAB_0127:
+	MOVE.L	#LAB_0047,-(A7)
+	DBF	D1,LAB_0127
+LAB_0128:
+	CMP.L	#$0000cd61,D0
+LAB_0129:
+	LEA	LAB_014D,A2
+	JSR	(-180,A6)
+	BSR.W	LAB_0152
+LAB_012B:
+	JSR	(-618,A6)
+	DBF	D7,LAB_012B
+	MOVE.L	D6,D7
+LAB_012C:
+	CMP.L	#$0000edce,D5
+	DBF	D5,LAB_012C
+LAB_012D:
+	BSR.W	LAB_0152
+	ADDQ.L	#5,A3
+LAB_012E:
+	JSR	(-450,A6)
+LAB_012F:
+	DBF	D5,LAB_012E
+	JSR	LAB_0152
+LAB_0130:
+	BNE.S	LAB_012E
+LAB_0131:
+	BRA.S	LAB_0133
+	DC.L	$646f732e
+LAB_0132:
+	DC.B	"library",0
+LAB_0133:
+	BNE.S	LAB_0130
+	LEA	(LAB_012D,PC),A0
+LAB_0134:
+	BRA.S	LAB_0135
+	DC.B	"Error: ",0
+LAB_0135:
+	BSR.W	LAB_0152
+	BNE.S	LAB_0134
+	LEA	(LAB_0129+2,PC),A2
+LAB_0136:
+	LEA	(LAB_0129,PC),A2
+LAB_0137:
+	BSR.W	LAB_0138
+	MOVE.L	#LAB_009F+2,-(A7)
+	BNE.S	LAB_0136
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0138:
+	BSR.W	LAB_014C
+	LEA	(LAB_0128+4,PC),A2
+LAB_0139:
+	JSR	(-72,A6)
+LAB_013A:
+	DBF	D3,LAB_0139
+	BNE.S	LAB_013A
+LAB_013C:
+	JSR	(-156,A6)
+LAB_013D:
+	DBF	D5,LAB_013C
+	DBF	D3,LAB_013D
+	BSR.W	LAB_014C
+LAB_013E:
+	LEA	LAB_0053,A6
+LAB_013F:
+	JSR	LAB_0152
+	DBF	D7,LAB_013F
+LAB_0140:
+	BNE.S	LAB_013E
+	DBF	D6,LAB_0140
+	MOVEQ	#-69,D3
+	MOVE.L	D5,D6
+LAB_0141:
+	MOVE.L	#LAB_0063,-(A7)
+	MOVE.L	#SECSTRT_6+2,-(A7)
+LAB_0142:
+	MOVE.L	#LAB_018F,-(A7)
+	BNE.S	LAB_0141
+LAB_0143:
+	BSR.W	LAB_014C
+	DBF	D4,LAB_0143
+	MOVE.L	#LAB_0101,-(A7)
+	CMP.L	#$00003846,D5
+LAB_0144:
+	JSR	LAB_0152
+LAB_0145:
+	BSR.W	LAB_014C
+LAB_0146:
+	DBF	D0,LAB_0145
+LAB_0147:
+	DBF	D3,LAB_0146
+LAB_0148:
+	JSR	LAB_0158
+	BSR.W	LAB_0152
+LAB_0149:
+	ADD.L	D1,D0
+LAB_014A:
+	DBF	D1,LAB_0149
+	DBF	D3,LAB_014A
+	MOVE.L	D6,D5
+LAB_014B:
+	BSR.W	LAB_0152
+	BSR.W	LAB_0158
+	BNE.S	LAB_014B
+	RTS
+LAB_014C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0152
+	MOVE.W	(11855,A5),(14035,A5)
+LAB_014D:
+	TST.L	D6
+LAB_014E:
+	DBF	D0,LAB_014D
+	CMPI.L	#$000000a2,D0
+	BNE.S	LAB_014E
+	MOVEQ	#102,D7
+LAB_014F:
+	BSR.W	LAB_0158
+LAB_0150:
+	DBF	D4,LAB_014F
+	MOVE.L	(842,A5),D5
+LAB_0151:
+	BNE.S	LAB_0150
+	DBF	D6,LAB_0151
+	JSR	(-204,A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_0152:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_0158
+LAB_0153:
+	ADDQ.L	#3,A1
+	JSR	(-384,A6)
+LAB_0154:
+	BNE.S	LAB_0153
+	DBF	D7,LAB_0154
+	LEA	LAB_0122,A2
+LAB_0155:
+	MOVE.L	(1002,A5),D3
+	DBF	D6,LAB_0155
+	BSR.W	LAB_016A
+	MOVE.L	D0,D1
+	MOVEQ	#-124,D6
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0156,PC,D0.W),D0
+	JMP	(LAB_0156,PC,D0.W)
+LAB_0156:
+	DC.L	$0006000a,$000e7000,$4e757001
+	DC.W	$4e75
+LAB_0157:
+	DC.L	$70024e75
+LAB_0158:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0159:
+	BSR.W	LAB_015E
+	DBF	D1,LAB_0159
+	MOVE.W	(21195,A5),(6830,A5)
+	ADD.L	D3,D3
+	MOVE.L	D4,D7
+	MOVE.W	(24908,A5),(2446,A5)
+LAB_015A:
+	BSR.W	LAB_016A
+	BSR.W	LAB_016A
+	BNE.S	LAB_015A
+	ADDQ.L	#1,A0
+	JSR	(-426,A6)
+	LEA	LAB_00F6,A0
+	MOVE.L	D2,D7
+LAB_015B:
+	JSR	LAB_015E
+	MOVEQ	#69,D7
+	JSR	(-654,A6)
+	MOVE.L	D7,D5
+LAB_015C:
+	BSR.W	LAB_015E
+	DBF	D2,LAB_015C
+LAB_015D:
+	MOVEQ	#61,D3
+	DBF	D7,LAB_015D
+	JSR	(-384,A6)
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_015E:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_016A
+	BSR.W	LAB_0174
+LAB_015F:
+	MOVEQ	#2,D5
+LAB_0160:
+	DBF	D4,LAB_015F
+LAB_0161:
+	BRA.S	LAB_0163
+	DC.L	$25733a20
+LAB_0162:
+	DC.B	"%ld",10,0,0
+LAB_0163:
+	JSR	(-594,A6)
+	DBF	D6,LAB_0163
+	BNE.S	LAB_0161
+	ADD.L	D3,D5
+	BSR.W	LAB_0174
+LAB_0164:
+	JSR	(-96,A6)
+	JSR	(-708,A6)
+	BNE.S	LAB_0164
+	MOVEQ	#-88,D6
+	JSR	LAB_016A
+LAB_0165:
+	LEA	(LAB_013C,PC),A4
+	BNE.S	LAB_0165
+	ADDQ.L	#5,A0
+	BRA.S	LAB_0166
+	DC.B	"%s: %ld",10,0,0
+LAB_0166:
+	MOVE.L	(10990,A5),D7
+	ADD.L	D0,D5
+	MOVE.L	#LAB_01C1+2,-(A7)
+	CMPI.L	#$00000018,D6
+LAB_0167:
+	MOVE.L	#LAB_00DA,-(A7)
+	ADD.L	D4,D4
+	MOVEQ	#103,D4
+	BNE.S	LAB_0167
+	ADD.L	D3,D2
+	JSR	LAB_016A
+	BSR.W	LAB_016A
+LAB_0168:
+	CMPI.L	#$00000088,D2
+	DBF	D5,LAB_0168
+	JSR	LAB_016E
+	ADD.L	D0,D6
+LAB_0169:
+	MOVE.W	(19035,A5),(15119,A5)
+	DBF	D1,LAB_0169
+	LEA	(LAB_0148+2,PC),A2
+	BNE.S	LAB_0169
+	MOVE.L	#LAB_00BB,-(A7)
+	MOVE.W	(6478,A5),(18684,A5)
+	BSR.W	LAB_016A
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_016A:
+	BSR.W	LAB_016E
+LAB_016B:
+	DBF	D1,LAB_016A
+	CMPI.L	#$00000011,D7
+	BNE.S	LAB_016B
+LAB_016C:
+	ADD.W	D0,D0
+	MOVE.W	(LAB_016D,PC,D0.W),D0
+	JMP	(LAB_016D,PC,D0.W)
+LAB_016D:
+	DC.L	$000a000e,$00120016,$001a7000,$4e757001
+	DC.L	$4e757002,$4e757003,$4e757004
+	DC.W	$4e75
+LAB_016E:
+	BSR.W	LAB_0174
+LAB_016F:
+	ADD.L	D1,D6
+	ADD.L	D1,D4
+	BNE.S	LAB_016F
+	MOVE.L	D7,D7
+LAB_0170:
+	MOVE.L	#LAB_00E6,-(A7)
+	DBF	D7,LAB_0170
+LAB_0171:
+	LEA	(LAB_0162,PC),A2
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0172,PC,D0.W),D0
+	JMP	(LAB_0172,PC,D0.W)
+LAB_0172:
+	DC.L	$000a000e,$00120016,$001a7000,$4e757001
+	DC.L	$4e757002,$4e757003
+	DC.W	$4e75
+LAB_0173:
+	DC.L	$70044e75
+LAB_0174:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_0175:
+	BSR.W	LAB_0177
+	DBF	D2,LAB_0175
+	ADD.W	D0,D0
+	MOVE.W	(LAB_0176,PC,D0.W),D0
+	JMP	(LAB_0176,PC,D0.W)
+LAB_0176:
+	DC.L	$000e0012,$0016001a,$001e0022,$00267000
+	DC.L	$4e757001,$4e757002,$4e757003,$4e757004
+	DC.L	$4e757005,$4e757006
+	DC.W	$4e75
+LAB_0177:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_017A
+	MOVE.L	#LAB_00F2,-(A7)
+	BSR.W	LAB_017A
+LAB_0178:
+	MOVE.L	#LAB_0003,-(A7)
+	DBF	D3,LAB_0178
+	MOVE.L	#LAB_002C,-(A7)
+	MOVE.L	(12636,A5),D1
+	CMPI.L	#$00000020,D2
+	BSR.W	LAB_017A
+	MOVEQ	#118,D1
+	MOVE.L	(20980,A5),D3
+	ADDQ.L	#4,A1
+	BSR.W	LAB_017A
+LAB_0179:
+	MOVE.L	#LAB_0030,-(A7)
+	CMPI.L	#$0000001c,D3
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+	RTS
+LAB_017A:
+	JSR	SECSTRT_6
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+
+
+	SECTION S_6,CODE
+
+SECSTRT_6:
+	BSR.W	LAB_018E
+	TST.L	D3
+LAB_017D:
+	ADD.L	D4,D3
+	BSR.W	LAB_0199
+LAB_017E:
+	BNE.S	LAB_017D
+LAB_017F:
+	MOVE.L	D7,D2
+	BNE.S	LAB_017E
+LAB_0180:
+	MOVE.L	D4,D0
+	BNE.S	LAB_0180
+LAB_0181:
+	ADD.L	D4,D5
+	CMP.L	#$00001b0f,D3
+LAB_0182:
+	MOVE.L	#LAB_005F,-(A7)
+	MOVE.L	#LAB_0105,-(A7)
+	JSR	(-678,A6)
+	CMPI.L	#$0000000e,D4
+LAB_0183:
+	MOVE.L	#LAB_0117,-(A7)
+LAB_0184:
+	DBF	D0,LAB_0183
+	DBF	D7,LAB_0184
+	BSR.W	LAB_0199
+	MOVEQ	#-83,D4
+LAB_0185:
+	BSR.W	LAB_0199
+LAB_0186:
+	LEA	(LAB_0182+2,PC),A4
+	DBF	D2,LAB_0186
+	ADD.L	D6,D1
+LAB_0187:
+	JSR	LAB_018E
+	ADDQ.L	#4,A5
+	BNE.S	LAB_0187
+	MOVE.W	(12813,A5),(24361,A5)
+	MOVE.W	(24875,A5),(4905,A5)
+LAB_0188:
+	LEA	(LAB_0188,PC),A6
+LAB_0189:
+	MOVE.L	#LAB_0100+2,-(A7)
+	DBF	D5,LAB_0189
+	JSR	(-612,A6)
+	MOVE.L	D3,D6
+LAB_018A:
+	LEA	LAB_0113,A4
+LAB_018C:
+	BNE.S	LAB_018A
+	DBF	D1,LAB_018C
+	LEA	LAB_005A,A6
+	BSR.W	LAB_0199
+LAB_018D:
+	MOVE.L	#LAB_00E0,-(A7)
+	DBF	D3,LAB_018D
+	RTS
+LAB_018E:
+	LINK.W	A5,#-160
+	BSR.W	LAB_0199
+	ADD.L	D7,D6
+LAB_018F:
+	TST.L	D1
+	JSR	(-132,A6)
+	BNE.S	LAB_018F
+	BRA.S	LAB_0190
+	DC.B	"Workbench",0
+LAB_0190:
+	JSR	(-654,A6)
+	BRA.S	LAB_0191
+	DC.B	"CON:0/0/640/200/Output",0,0
+LAB_0191:
+	MOVE.L	#LAB_0112,-(A7)
+LAB_0192:
+	CMPI.L	#$00000008,D3
+	CMP.L	#$0000c0d0,D5
+	BNE.S	LAB_0192
+LAB_0193:
+	MOVE.W	(24126,A5),(11266,A5)
+LAB_0194:
+	BNE.S	LAB_0193
+	BNE.S	LAB_0193
+LAB_0195:
+	LEA	(LAB_017F,PC),A2
+	CMPI.L	#$00000067,D3
+	BNE.S	LAB_0195
+LAB_0196:
+	BNE.S	LAB_0195
+	DBF	D4,LAB_0196
+	ADD.L	D7,D4
+	ADD.L	D3,D4
+	CMPI.L	#$00000024,D3
+	CMP.L	#$00002593,D4
+	JSR	LAB_0199
+	BSR.W	LAB_019F
+LAB_0197:
+	BSR.W	LAB_0199
+LAB_0198:
+	BSR.W	LAB_019F
+	DBF	D7,LAB_0198
+	BNE.S	LAB_0197
+	UNLK	A5
+	RTS
+LAB_0199:
+	BSR.W	LAB_019F
+	MOVEQ	#-115,D4
+LAB_019A:
+	BSR.W	LAB_019F
+	BSR.W	LAB_019F
+	LEA	(LAB_018A+4,PC),A2
+	BNE.S	LAB_019A
+	MOVE.L	(21814,A5),D6
+	LEA	(LAB_0181,PC),A0
+LAB_019B:
+	LEA	(LAB_0194,PC),A6
+	DBF	D3,LAB_019B
+	BNE.S	LAB_019B
+LAB_019C:
+	BSR.W	LAB_019F
+	MOVEQ	#-14,D1
+	BNE.S	LAB_019C
+	MOVEQ	#-123,D2
+LAB_019D:
+	CMPI.L	#$000000e4,D3
+	MOVE.L	(20006,A5),D3
+	BSR.W	LAB_01B6
+	BNE.S	LAB_019D
+	MOVE.L	(23226,A5),D0
+	ADD.W	D0,D0
+	MOVE.W	(LAB_019E,PC,D0.W),D0
+	JMP	(LAB_019E,PC,D0.W)
+LAB_019E:
+	DC.L	$000e0012,$0016001a,$001e0022,$00267000
+	DC.L	$4e757001,$4e757002,$4e757003,$4e757004
+	DC.L	$4e757005,$4e757006
+	DC.W	$4e75
+LAB_019F:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+LAB_01A0:
+	BSR.W	LAB_01A8
+LAB_01A1:
+	DBF	D2,LAB_01A0
+	BSR.W	LAB_01B6
+LAB_01A2:
+	JSR	(-414,A6)
+	MOVE.L	(20510,A5),D6
+LAB_01A3:
+	BSR.W	LAB_01BB
+LAB_01A4:
+	DBF	D0,LAB_01A3
+	BSR.W	LAB_01BB
+	LEA	(LAB_018A+4,PC),A4
+	BNE.S	LAB_01A4
+LAB_01A5:
+	CMPI.L	#$000000f6,D6
+	JSR	(-408,A6)
+	BSR.W	LAB_01A8
+	JSR	(-708,A6)
+	LEA	LAB_009F,A0
+	MOVE.L	D5,D2
+	LEA	(LAB_01A5+4,PC),A4
+LAB_01A6:
+	LEA	(LAB_019D,PC),A2
+	DBF	D0,LAB_01A6
+	ADD.W	D0,D0
+	MOVE.W	(LAB_01A7,PC,D0.W),D0
+	JMP	(LAB_01A7,PC,D0.W)
+LAB_01A7:
+	DC.L	$0008000c,$00100014,$70004e75,$70014e75
+	DC.L	$70024e75,$70034e75
+LAB_01A8:
+	LINK.W	A5,#-168
+	BSR.W	LAB_01B6
+LAB_01A9:
+	MOVE.L	#LAB_0106+2,-(A7)
+LAB_01AA:
+	DBF	D1,LAB_01A9
+LAB_01AB:
+	BSR.W	LAB_01BE
+	DBF	D1,LAB_01AB
+LAB_01AC:
+	BSR.W	LAB_01BB
+	LEA	LAB_003E,A2
+	BNE.S	LAB_01AC
+LAB_01AD:
+	MOVE.L	#LAB_0059+2,-(A7)
+	BSR.W	LAB_01BB
+	ADD.L	D4,D4
+LAB_01AE:
+	BNE.S	LAB_01AD
+	DBF	D1,LAB_01AE
+LAB_01AF:
+	LEA	LAB_0188,A6
+	DBF	D3,LAB_01AF
+LAB_01B1:
+	ADD.L	D4,D7
+LAB_01B2:
+	DBF	D2,LAB_01B1
+	ADD.L	D1,D6
+	BNE.S	LAB_01B2
+LAB_01B3:
+	ADD.L	D3,D1
+LAB_01B4:
+	DBF	D5,LAB_01B3
+LAB_01B5:
+	BSR.W	LAB_01BE
+	LEA	LAB_0142+4,A2
+	BNE.S	LAB_01B5
+	UNLK	A5
+	RTS
+LAB_01B6:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_01BB
+	LEA	LAB_00B2,A6
+LAB_01B7:
+	TST.L	D5
+	BSR.W	LAB_01BE
+	LEA	(LAB_01B4,PC),A6
+	BSR.W	LAB_01BB
+	ADDQ.L	#1,A1
+	MOVEQ	#109,D1
+	CMP.L	#$00009c72,D6
+	MOVE.W	(22922,A5),(15033,A5)
+	MOVE.W	(3745,A5),(19708,A5)
+	BSR.W	LAB_01BE
+	MOVE.L	D5,D6
+	LEA	(LAB_01A2,PC),A2
+	LEA	LAB_0173,A6
+LAB_01B8:
+	LEA	LAB_0057,A4
+LAB_01B9:
+	DBF	D2,LAB_01B8
+	DBF	D4,LAB_01B9
+	ADDQ.L	#5,A1
+	BNE.S	LAB_01B9
+	MOVE.L	D0,D2
+	MOVEM.L	(A7)+,D2-D7/A2-A6
+LAB_01BA:
+	RTS
+LAB_01BB:
+	LINK.W	A5,#-20
+LAB_01BC:
+	BSR.W	LAB_01BE
+	JSR	(-204,A6)
+	MOVE.L	#LAB_005C,-(A7)
+	BNE.S	LAB_01BC
+	JSR	(-906,A6)
+	JSR	(-594,A6)
+	JSR	LAB_01CB
+	MOVE.L	#LAB_011D,-(A7)
+LAB_01BD:
+	LEA	(LAB_01B7,PC),A6
+	DBF	D0,LAB_01BD
+	MOVE.L	#LAB_00B4,-(A7)
+	UNLK	A5
+	RTS
+LAB_01BE:
+	LINK.W	A5,#-100
+	BSR.W	LAB_01C4
+	JSR	(-546,A6)
+	MOVE.L	D6,D0
+	BSR.W	LAB_01CB
+	BSR.W	LAB_01CB
+	BSR.W	LAB_01CB
+	LEA	LAB_0144,A6
+	BSR.W	LAB_01CB
+LAB_01BF:
+	LEA	LAB_015B,A0
+	CMP.L	#$000013c7,D2
+	BNE.S	LAB_01BF
+	BNE.S	LAB_01BF
+LAB_01C0:
+	BSR.W	LAB_01CB
+LAB_01C1:
+	DBF	D2,LAB_01C0
+LAB_01C3:
+	DBF	D4,LAB_01C1
+	UNLK	A5
+	RTS
+LAB_01C4:
+	MOVEM.L	D2-D7/A2-A6,-(A7)
+	BSR.W	LAB_01CB
+LAB_01C5:
+	MOVE.L	#LAB_011A,-(A7)
+	MOVE.L	#LAB_007A,-(A7)
+LAB_01C6:
+	MOVEQ	#102,D6
+	BNE.S	LAB_01C5
+LAB_01C7:
+	BNE.S	LAB_01C6
+	MOVE.L	#LAB_007D,-(A7)
+LAB_01C8:
+	BNE.S	LAB_01C7
+	BNE.S	LAB_01C8
+	MOVE.L	(27620,A5),D4
+	JSR	LAB_01CB
+LAB_01C9:
+	LEA	LAB_0076+2,A6
+	DBF	D0,LAB_01C9
+	JSR	(-300,A6)
+	ADD.W	D0,D0
+	MOVE.W	(LAB_01CA,PC,D0.W),D0
+	JMP	(LAB_01CA,PC,D0.W)
+LAB_01CA:
+	DC.L	$0008000c,$00100014,$70004e75,$70014e75
+	DC.L	$70024e75,$70034e75
+LAB_01CB:
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	NOP
+	RTS
+	END
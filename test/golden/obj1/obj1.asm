@@ -0,0 +1,1754 @@
+; (c)2009-2015 Frank Wille, (c)2014-2017 Nicolas Bastien
+
+EXT_0000	EQU	$0
+
+
+
+
+	SECTION S_0,CODE
+
+sym_0_0:
+	LINK.W	A5,#-176		;0000: 4e55ff50
+	BSR.W	LAB_0011		;0004: 61000076
+LAB_0001:
+	ADDQ.L	#7,A1			;0008: 5e89
+LAB_0002:
+	DBF	D3,LAB_0001		;000a: 51cbfffc
+LAB_0003:
+	CMPI.L	#$00000049,D3		;000e: 0c8300000049
+LAB_0005:
+	ADDQ.L	#2,A0			;0014: 5488
+LAB_0006:
+	DBF	D7,LAB_0005		;0016: 51cffffc
+LAB_0007:
+	ADD.L	D6,D7			;001a: de86
+LAB_0008:
+	ADD.L	D3,D1			;001c: d283
+	DBF	D2,LAB_0008		;001e: 51cafffc
+	BNE.S	LAB_0007		;0022: 66f6
+	BSR.W	LAB_0027		;0024: 6100011a
+	MOVE.L	15652(A5),D4		;0028: 282d3d24
+sym_0_13:
+	BRA.S	LAB_000A		;002c: 6008
+	DC.W	$4572			;002e
+	MOVEQ	#111,D1			;0030: 726f
+	MOVEQ	#58,D1			;0032: 723a
+	MOVE.L	D0,D0			;0034: 2000
+LAB_000A:
+	CMP.L	#$0000712e,D4		;0036: b8bc0000712e
+LAB_000C:
+	BSR.W	LAB_0011		;003c: 6100003e
+LAB_000E:
+	DBF	D1,LAB_000C		;0040: 51c9fffa
+	LEA	LAB_00E7,A2		;0044: 45f90000083c
+	MOVE.L	D2,D4			;004a: 2802
+	BNE.S	LAB_000E		;004c: 66f2
+	LEA	LAB_000A+2(PC),A2	;004e: 45faffe8
+	ADDQ.L	#4,A4			;0052: 588c
+	LEA	LAB_0002(PC),A4		;0054: 49faffb4
+	LEA	LAB_0003+4(PC),A6	;0058: 4dfaffb8
+	CMP.L	#$0000c624,D3		;005c: b6bc0000c624
+LAB_000F:
+	LEA	LAB_0006(PC),A0		;0062: 41faffb2
+sym_0_26:
+	DBF	D7,LAB_000F		;0066: 51cffffa
+	BSR.W	LAB_001E		;006a: 61000086
+	CMP.L	#$0000311b,D1		;006e: b2bc0000311b
+	MOVE.L	29776(A5),D4		;0074: 282d7450
+	UNLK	A5			;0078: 4e5d
+	RTS				;007a: 4e75
+LAB_0011:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;007c: 48e73f3e
+	BSR.W	LAB_001E		;0080: 61000070
+LAB_0012:
+	MOVE.W	11262(A5),809(A5)	;0084: 3b6d2bfe0329
+	TST.L	D7			;008a: 4a87
+	BSR.W	LAB_0027		;008c: 610000b2
+LAB_0013:
+	MOVE.L	13848(A5),D1		;0090: 222d3618
+LAB_0014:
+	BSR.W	LAB_0027		;0094: 610000aa
+sym_0_39:
+	MOVE.L	D5,D5			;0098: 2a05
+	BNE.S	LAB_0013		;009a: 66f4
+	BNE.S	sym_0_39		;009c: 66fa
+LAB_0016:
+	MOVE.W	23614(A5),31494(A5)	;009e: 3b6d5c3e7b06
+	LEA	LAB_0014+2(PC),A4	;00a4: 49fafff0
+	ADDQ.L	#6,A0			;00a8: 5c88
+	BNE.S	LAB_0016		;00aa: 66f2
+LAB_0017:
+	LEA	LAB_000E(PC),A2		;00ac: 45faff92
+	JSR	-636(A6)		;00b0: 4eaefd84
+	ADDQ.L	#3,A3			;00b4: 568b
+LAB_0018:
+	ADD.L	D2,D6			;00b6: dc82
+	DBF	D0,LAB_0018		;00b8: 51c8fffc
+	MOVE.L	21510(A5),D3		;00bc: 262d5406
+sym_0_52:
+	ADD.L	D7,D1			;00c0: d287
+	JSR	-114(A6)		;00c2: 4eaeff8e
+	LEA	LAB_0012(PC),A2		;00c6: 45faffbc
+LAB_001A:
+	MOVEQ	#-113,D0		;00ca: 708f
+LAB_001B:
+	DBF	D2,LAB_001A		;00cc: 51cafffc
+	MOVEQ	#-121,D6		;00d0: 7c87
+	BNE.S	LAB_001B		;00d2: 66f8
+LAB_001C:
+	MOVEQ	#-87,D2			;00d4: 74a9
+	DBF	D0,LAB_001C		;00d6: 51c8fffc
+	BSR.W	LAB_0027		;00da: 61000064
+	ADD.L	D3,D4			;00de: d883
+	CMP.L	#$0000e3a5,D2		;00e0: b4bc0000e3a5
+	JSR	-366(A6)		;00e6: 4eaefe92
+sym_0_65:
+	ADD.L	D2,D3			;00ea: d682
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;00ec: 4cdf7cfc
+	RTS				;00f0: 4e75
+LAB_001E:
+	BSR.W	LAB_0027		;00f2: 6100004c
+	BSR.W	LAB_0027		;00f6: 61000048
+	ADD.L	D4,D5			;00fa: da84
+LAB_001F:
+	JSR	-264(A6)		;00fc: 4eaefef8
+	DBF	D6,LAB_001F		;0100: 51cefffa
+	CMP.L	#$0000e8dc,D4		;0104: b8bc0000e8dc
+LAB_0020:
+	BNE.S	LAB_001F		;010a: 66f0
+	DBF	D6,LAB_0020		;010c: 51cefffc
+	MOVEQ	#-4,D5			;0110: 7afc
+sym_0_78:
+	BSR.W	LAB_0031		;0112: 61000080
+	MOVE.L	D6,D5			;0116: 2a06
+	MOVE.W	29474(A5),8260(A5)	;0118: 3b6d73222044
+LAB_0022:
+	BSR.W	LAB_0031		;011e: 61000074
+LAB_0023:
+	BNE.S	LAB_0022		;0122: 66fa
+LAB_0024:
+	DBF	D0,LAB_0023		;0124: 51c8fffc
+	BNE.S	LAB_0024		;0128: 66fa
+	BRA.S	LAB_0026		;012a: 600c
+LAB_0025:
+	MOVEQ	#111,D2			;012c: 746f
+	MOVEQ	#97,D0			;012e: 7061
+	MOVEQ	#46,D5			;0130: 7a2e
+	DC.W	$666f			;0132
+	BGT.S	LAB_0036		;0134: 6e74
+	DC.W	$0000			;0136
+LAB_0026:
+	MOVEQ	#-72,D0			;0138: 70b8
+	BSR.W	LAB_0027		;013a: 61000004
+	RTS				;013e: 4e75
+LAB_0027:
+	LINK.W	A5,#-240		;0140: 4e55ff10
+LAB_0028:
+	BSR.W	sym_0_104		;0144: 6100002c
+sym_0_91:
+	DBF	D4,LAB_0028		;0148: 51ccfffa
+	ADD.L	D5,D3			;014c: d685
+LAB_002A:
+	BSR.W	sym_0_104		;014e: 61000022
+LAB_002B:
+	BRA.S	LAB_002C		;0152: 600a
+	DC.W	$2573			;0154
+	MOVE.W	-(A0),D5		;0156: 3a20
+	MOVE.L	25610(A4),0(A2)		;0158: 256c640a0000
+LAB_002C:
+	BNE.S	LAB_002B		;015e: 66f2
+	BNE.S	LAB_002A		;0160: 66ec
+	BNE.S	LAB_002B		;0162: 66ee
+LAB_002D:
+	BNE.S	LAB_002C		;0164: 66f8
+	BNE.S	LAB_002D		;0166: 66fc
+LAB_002E:
+	ADD.L	D0,D3			;0168: d680
+	DBF	D0,LAB_002E		;016a: 51c8fffc
+	UNLK	A5			;016e: 4e5d
+	RTS				;0170: 4e75
+sym_0_104:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0172: 48e73f3e
+	BSR.W	LAB_0031		;0176: 6100001c
+	MOVE.L	1744(A5),D2		;017a: 242d06d0
+LAB_0030:
+	ADD.L	D5,D2			;017e: d485
+	JSR	-708(A6)		;0180: 4eaefd3c
+	BNE.S	LAB_0030		;0184: 66f8
+	ADD.L	D6,D7			;0186: de86
+	CMPI.L	#$0000005e,D1		;0188: 0c810000005e
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;018e: 4cdf7cfc
+	RTS				;0192: 4e75
+LAB_0031:
+	LINK.W	A5,#-132		;0194: 4e55ff7c
+	BSR.W	LAB_0041		;0198: 61000088
+	TST.L	D0			;019c: 4a80
+sym_0_117:
+	LEA	LAB_001C(PC),A6		;019e: 4dfaff34
+LAB_0033:
+	MOVEQ	#75,D7			;01a2: 7e4b
+LAB_0034:
+	MOVE.L	D4,D4			;01a4: 2804
+LAB_0035:
+	DBF	D0,LAB_0034		;01a6: 51c8fffc
+LAB_0036:
+	DBF	D5,LAB_0035		;01aa: 51cdfffa
+	ADD.L	D2,D6			;01ae: dc82
+	BSR.W	LAB_0057		;01b0: 61000148
+LAB_0037:
+	CMPI.L	#$000000b2,D1		;01b4: 0c81000000b2
+	DBF	D3,LAB_0037		;01ba: 51cbfff8
+	BNE.S	LAB_0037		;01be: 66f4
+	BRA.S	LAB_0038		;01c0: 600a
+	SUBQ.W	#3,29291(A7)		;01c2: 576f726b
+	DC.W	$6265			;01c6
+	DC.W	$6e63			;01c8
+	DC.W	$6800			;01ca
+LAB_0038:
+	ADDQ.L	#3,A7			;01cc: 568f
+	DBF	D7,LAB_0038		;01ce: 51cffffc
+sym_0_130:
+	MOVE.W	2344(A5),13370(A5)	;01d2: 3b6d0928343a
+LAB_003A:
+	LEA	sym_0_13,A2		;01d8: 45f90000002c
+LAB_003B:
+	DBF	D7,LAB_003A		;01de: 51cffff8
+	MOVEQ	#-26,D7			;01e2: 7ee6
+	BSR.W	LAB_0041		;01e4: 6100003c
+	BSR.W	LAB_0055		;01e8: 610000ec
+	BRA.S	LAB_003D		;01ec: 600a
+	SUBQ.W	#3,29291(A7)		;01ee: 576f726b
+LAB_003C:
+	DC.W	$6265			;01f2
+	DC.W	$6e63			;01f4
+	DC.W	$6800			;01f6
+LAB_003D:
+	JSR	-282(A6)		;01f8: 4eaefee6
+	DBF	D4,LAB_003D		;01fc: 51ccfffa
+	MOVE.W	13547(A5),1858(A5)	;0200: 3b6d34eb0742
+	BRA.S	LAB_003E		;0206: 600e
+	DC.W	$4f75			;0208
+	MOVEQ	#32,D2			;020a: 7420
+	BLE.S	sym_0_169		;020c: 6f66
+	MOVEA.L	25965(A5),A0		;020e: 206d656d
+	BLE.S	LAB_004F		;0212: 6f72
+	DC.W	$7900			;0214
+LAB_003E:
+	ADD.L	D0,D1			;0216: d280
+	MOVE.L	D1,D7			;0218: 2e01
+sym_0_143:
+	BSR.W	LAB_0055		;021a: 610000ba
+	UNLK	A5			;021e: 4e5d
+LAB_0040:
+	RTS				;0220: 4e75
+LAB_0041:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0222: 48e73f3e
+	BSR.W	LAB_0055		;0226: 610000ae
+	JSR	-438(A6)		;022a: 4eaefe4a
+LAB_0042:
+	TST.L	D7			;022e: 4a87
+	CMP.L	#$00004137,D6		;0230: bcbc00004137
+	BNE.S	LAB_0042		;0236: 66f6
+	BSR.W	LAB_006B		;0238: 6100016e
+LAB_0043:
+	ADD.L	D1,D0			;023c: d081
+	MOVE.W	4110(A5),11694(A5)	;023e: 3b6d100e2dae
+	BNE.S	LAB_0043		;0244: 66f6
+sym_0_156:
+LAB_0044:
+	MOVE.L	#LAB_00F2,-(A7)		;0246: 2f3c000009b0
+LAB_0046:
+	CMPI.L	#$000000cf,D5		;024c: 0c85000000cf
+LAB_0047:
+	DBF	D4,LAB_0046		;0252: 51ccfff8
+	MOVEQ	#79,D2			;0256: 744f
+	CMP.L	#$00001747,D6		;0258: bcbc00001747
+LAB_0048:
+	LEA	LAB_0033(PC),A6		;025e: 4dfaff42
+LAB_0049:
+	BNE.S	LAB_0048		;0262: 66fa
+LAB_004A:
+	DBF	D2,LAB_0049		;0264: 51cafffc
+	ADDQ.L	#2,A7			;0268: 548f
+	ADD.L	D3,D5			;026a: da83
+LAB_004B:
+	BNE.S	LAB_004A		;026c: 66f6
+LAB_004C:
+	DBF	D6,LAB_004B		;026e: 51cefffc
+	BNE.S	LAB_004C		;0272: 66fa
+sym_0_169:
+	ADD.L	D2,D5			;0274: da82
+	DBF	D2,sym_0_169		;0276: 51cafffc
+	CMPI.L	#$0000008e,D0		;027a: 0c800000008e
+LAB_004E:
+	LEA	LAB_00ED,A4		;0280: 49f9000008dc
+LAB_004F:
+	CMP.L	#$000057be,D7		;0286: bebc000057be
+	CMPI.L	#$0000007b,D7		;028c: 0c870000007b
+	BSR.W	LAB_0055		;0292: 61000042
+	LEA	LAB_003B+2(PC),A0	;0296: 41faff48
+	ADDQ.L	#3,A4			;029a: 568c
+	MOVE.W	28631(A5),20424(A5)	;029c: 3b6d6fd74fc8
+LAB_0050:
+	BSR.W	LAB_0055		;02a2: 61000032
+	BNE.S	LAB_0050		;02a6: 66fa
+	BSR.W	LAB_006B		;02a8: 610000fe
+sym_0_182:
+	ADDQ.L	#1,A2			;02ac: 528a
+	MOVEQ	#-107,D2		;02ae: 7495
+	BNE.S	sym_0_182		;02b0: 66fa
+	BRA.S	LAB_0052		;02b2: 600c
+	MOVEQ	#111,D2			;02b4: 746f
+	MOVEQ	#97,D0			;02b6: 7061
+	MOVEQ	#46,D5			;02b8: 7a2e
+	DC.W	$666f			;02ba
+	BGT.S	LAB_005C+2		;02bc: 6e74
+	DC.W	$0000			;02be
+LAB_0052:
+	BSR.W	LAB_006B		;02c0: 610000e6
+	DBF	D6,LAB_0052		;02c4: 51cefffa
+LAB_0053:
+	ADD.L	D6,D5			;02c8: da86
+	JSR	-774(A6)		;02ca: 4eaefcfa
+	BNE.S	LAB_0053		;02ce: 66f8
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;02d0: 4cdf7cfc
+LAB_0054:
+	RTS				;02d4: 4e75
+LAB_0055:
+	LINK.W	A5,#-176		;02d6: 4e55ff50
+	BSR.W	LAB_0057		;02da: 6100001e
+sym_0_195:
+	BSR.W	LAB_0073		;02de: 61000106
+	MOVEQ	#0,D4			;02e2: 7800
+	MOVE.L	D4,D7			;02e4: 2e04
+	MOVEQ	#71,D7			;02e6: 7e47
+	JSR	EXT_0000		;02e8: 4eb900000000
+	MOVE.L	D3,D5			;02ee: 2a03
+	ADDQ.L	#3,A5			;02f0: 568d
+	BSR.W	LAB_006B		;02f2: 610000b4
+	UNLK	A5			;02f6: 4e5d
+	RTS				;02f8: 4e75
+LAB_0057:
+	LINK.W	A5,#-48			;02fa: 4e55ffd0
+LAB_0058:
+	BSR.W	LAB_006B		;02fe: 610000a8
+	DBF	D1,LAB_0058		;0302: 51c9fffa
+sym_0_208:
+	BRA.S	LAB_005A		;0306: 6018
+	DC.W	$434f			;0308
+	DC.W	$4e3a			;030a
+	MOVE.W	12335(A7),D0		;030c: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;0310: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0314: 3230302f
+	DC.W	$4f75			;0318
+	MOVEQ	#112,D2			;031a: 7470
+	DC.W	$7574			;031c
+	DC.W	$0000			;031e
+LAB_005A:
+	DBF	D4,sym_0_208		;0320: 51ccffe4
+	BNE.S	sym_0_208		;0324: 66e0
+LAB_005B:
+	LEA	LAB_0013(PC),A4		;0326: 49fafd68
+	BSR.W	LAB_006B		;032a: 6100007c
+	BNE.S	LAB_005B		;032e: 66f6
+LAB_005C:
+	MOVE.L	#LAB_00F5,-(A7)		;0330: 2f3c000009c4
+	DBF	D7,LAB_005C		;0336: 51cffff8
+LAB_005E:
+	MOVE.L	6282(A5),D2		;033a: 242d188a
+	DBF	D5,LAB_005E		;033e: 51cdfffa
+	BNE.S	LAB_005E		;0342: 66f6
+	BSR.W	LAB_0080		;0344: 61000122
+LAB_005F:
+	BSR.W	LAB_0080		;0348: 6100011e
+sym_0_221:
+	DBF	D7,LAB_005F		;034c: 51cffffa
+	BRA.S	LAB_0062		;0350: 600c
+	DC.W	$646f			;0352
+	DC.W	$732e			;0354
+	DC.W	$6c69			;0356
+	BHI.S	LAB_006F+4		;0358: 6272
+LAB_0061:
+	BSR.S	LAB_0070		;035a: 6172
+	DC.W	$7900			;035c
+LAB_0062:
+	BSR.W	LAB_0080		;035e: 61000108
+LAB_0063:
+	LEA	LAB_0025(PC),A6		;0362: 4dfafdc8
+	JSR	-54(A6)			;0366: 4eaeffca
+	BNE.S	LAB_0063		;036a: 66f6
+LAB_0064:
+	ADD.L	D6,D5			;036c: da86
+LAB_0065:
+	BSR.W	LAB_0073		;036e: 61000076
+	BSR.W	LAB_006B		;0372: 61000034
+	MOVEQ	#116,D6			;0376: 7c74
+LAB_0066:
+	BNE.S	LAB_0065		;0378: 66f4
+	DBF	D0,LAB_0066		;037a: 51c8fffc
+LAB_0067:
+	BSR.W	LAB_006B		;037e: 61000028
+sym_0_234:
+	ADDQ.L	#1,A7			;0382: 528f
+	BSR.W	LAB_006B		;0384: 61000022
+	ADD.L	D3,D4			;0388: d883
+	LEA	LAB_00F5,A2		;038a: 45f9000009c4
+LAB_0069:
+	BSR.W	LAB_0080		;0390: 610000d6
+	ADD.L	D5,D0			;0394: d085
+	CMP.L	#$0000aa23,D4		;0396: b8bc0000aa23
+	BSR.W	LAB_006B		;039c: 6100000a
+	MOVE.L	10408(A5),D5		;03a0: 2a2d28a8
+LAB_006A:
+	UNLK	A5			;03a4: 4e5d
+	RTS				;03a6: 4e75
+LAB_006B:
+	BSR.W	LAB_0073		;03a8: 6100003c
+sym_0_247:
+	TST.L	D2			;03ac: 4a82
+	DBF	D0,sym_0_247		;03ae: 51c8fffc
+LAB_006D:
+	BSR.W	LAB_0073		;03b2: 61000032
+LAB_006E:
+	LEA	LAB_0061(PC),A4		;03b6: 49faffa2
+	LEA	LAB_000C+2(PC),A2	;03ba: 45fafc82
+	BNE.S	LAB_006D		;03be: 66f2
+	LEA	LAB_0064(PC),A0		;03c0: 41faffaa
+	MOVE.L	24132(A5),D3		;03c4: 262d5e44
+LAB_006F:
+	CMP.L	#$00007dc7,D4		;03c8: b8bc00007dc7
+LAB_0070:
+	MOVE.L	D6,D1			;03ce: 2206
+	BSR.W	LAB_0073		;03d0: 61000014
+LAB_0071:
+	ADDQ.L	#2,A5			;03d4: 548d
+	BNE.S	LAB_0071		;03d6: 66fc
+sym_0_260:
+	ADDQ.L	#3,A0			;03d8: 5688
+	MOVE.W	19433(A5),13630(A5)	;03da: 3b6d4be9353e
+	LEA	LAB_0003(PC),A4		;03e0: 49fafc2c
+	RTS				;03e4: 4e75
+LAB_0073:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;03e6: 48e73f3e
+LAB_0074:
+	BSR.W	LAB_0080		;03ea: 6100007c
+LAB_0075:
+	DBF	D7,LAB_0074		;03ee: 51cffffa
+LAB_0076:
+	DBF	D0,LAB_0075		;03f2: 51c8fffa
+	BNE.S	LAB_0076		;03f6: 66fa
+	BSR.W	LAB_008C		;03f8: 610000f4
+	MOVEQ	#111,D2			;03fc: 746f
+	MOVEQ	#5,D7			;03fe: 7e05
+	MOVE.W	28239(A5),16979(A5)	;0400: 3b6d6e4f4253
+sym_0_273:
+	JSR	EXT_0000		;0406: 4eb900000000
+	LEA	LAB_00AF,A0		;040c: 41f900000624
+	MOVE.L	D2,D1			;0412: 2202
+	ADD.L	D4,D4			;0414: d884
+LAB_0078:
+	BSR.W	LAB_0086		;0416: 61000098
+	DBF	D0,LAB_0078		;041a: 51c8fffa
+	BSR.W	LAB_0086		;041e: 61000090
+LAB_0079:
+	BSR.W	LAB_0080		;0422: 61000044
+	DBF	D5,LAB_0079		;0426: 51cdfffa
+LAB_007A:
+	MOVE.L	9354(A5),D5		;042a: 2a2d248a
+	BNE.S	LAB_007A		;042e: 66fa
+LAB_007B:
+	MOVE.L	13298(A5),D7		;0430: 2e2d33f2
+	DBF	D2,LAB_007B		;0434: 51cafffa
+sym_0_286:
+	MOVE.L	D2,D1			;0438: 2202
+	ADDQ.L	#6,A4			;043a: 5c8c
+	LEA	LAB_0063(PC),A6		;043c: 4dfaff24
+LAB_007D:
+	JSR	-252(A6)		;0440: 4eaeff04
+LAB_007E:
+	DBF	D4,LAB_007D		;0444: 51ccfffa
+	DBF	D2,LAB_007E		;0448: 51cafffa
+	BNE.S	LAB_007D		;044c: 66f2
+	BNE.S	LAB_007E		;044e: 66f4
+	BSR.W	LAB_008C		;0450: 6100009c
+	LEA	LAB_0094,A2		;0454: 45f90000051e
+	JSR	-882(A6)		;045a: 4eaefc8e
+	BSR.W	LAB_008C		;045e: 6100008e
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0462: 4cdf7cfc
+sym_0_299:
+	RTS				;0466: 4e75
+LAB_0080:
+	LINK.W	A5,#-200		;0468: 4e55ff38
+	BSR.W	LAB_0086		;046c: 61000042
+	JSR	-384(A6)		;0470: 4eaefe80
+	JSR	-372(A6)		;0474: 4eaefe8c
+	ADD.L	D0,D2			;0478: d480
+	BSR.W	sym_0_351		;047a: 610000b2
+	LEA	LAB_0017+2(PC),A2	;047e: 45fafc2e
+	ADD.L	D0,D6			;0482: dc80
+	LEA	LAB_004E+2(PC),A4	;0484: 49fafdfc
+	MOVEQ	#-119,D5		;0488: 7a89
+LAB_0081:
+	BRA.S	LAB_0084		;048a: 6012
+	BVS.S	LAB_008E		;048c: 696e
+LAB_0082:
+	MOVEQ	#117,D2			;048e: 7475
+LAB_0083:
+	BVS.S	LAB_0090+2		;0490: 6974
+	DC.W	$696f			;0492
+	BGT.S	LAB_0088+2		;0494: 6e2e
+	DC.W	$6c69			;0496
+	BHI.S	LAB_0091+4		;0498: 6272
+	BSR.S	LAB_0092		;049a: 6172
+	DC.W	$7900			;049c
+LAB_0084:
+	MOVEQ	#122,D7			;049e: 7e7a
+sym_0_312:
+	BSR.W	LAB_0086		;04a0: 6100000e
+	BNE.S	LAB_0081		;04a4: 66e4
+	CMP.L	#$0000fe56,D5		;04a6: babc0000fe56
+	UNLK	A5			;04ac: 4e5d
+	RTS				;04ae: 4e75
+LAB_0086:
+	BSR.W	LAB_008C		;04b0: 6100003c
+	BSR.W	LAB_00A0		;04b4: 610000f4
+	JSR	EXT_0000		;04b8: 4eb900000000
+LAB_0087:
+	MOVE.L	19632(A5),D7		;04be: 2e2d4cb0
+LAB_0088:
+	DBF	D4,LAB_0087		;04c2: 51ccfffa
+	BSR.W	sym_0_351		;04c6: 61000066
+	ADDQ.L	#6,A7			;04ca: 5c8f
+sym_0_325:
+	CMP.L	#$00005d05,D6		;04cc: bcbc00005d05
+LAB_008A:
+	DBF	D7,sym_0_325		;04d2: 51cffff8
+	DBF	D6,LAB_008A		;04d6: 51cefffa
+	LEA	LAB_006A(PC),A0		;04da: 41fafec8
+	LEA	LAB_006E+2(PC),A4	;04de: 49fafed8
+LAB_008B:
+	MOVEQ	#55,D6			;04e2: 7c37
+	BNE.S	LAB_008B		;04e4: 66fc
+	MOVE.W	25082(A5),16569(A5)	;04e6: 3b6d61fa40b9
+	RTS				;04ec: 4e75
+LAB_008C:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;04ee: 48e73f3e
+	BSR.W	sym_0_351		;04f2: 6100003a
+LAB_008D:
+	MOVE.L	#LAB_00DE+2,-(A7)	;04f6: 2f3c0000077e
+LAB_008E:
+	MOVE.W	32458(A5),4535(A5)	;04fc: 3b6d7eca11b7
+sym_0_338:
+	BNE.S	LAB_008D		;0502: 66f2
+LAB_0090:
+	JSR	-912(A6)		;0504: 4eaefc70
+LAB_0091:
+	CMP.L	#$0000bed0,D1		;0508: b2bc0000bed0
+LAB_0092:
+	MOVE.L	D7,D6			;050e: 2c07
+LAB_0093:
+	BSR.W	LAB_00AB		;0510: 610000fa
+	CMP.L	#$0000ed2e,D6		;0514: bcbc0000ed2e
+	JSR	-288(A6)		;051a: 4eaefee0
+LAB_0094:
+	BSR.W	LAB_00AB		;051e: 610000ec
+	MOVE.L	26230(A5),D6		;0522: 2c2d6676
+	BNE.S	LAB_0094		;0526: 66f6
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0528: 4cdf7cfc
+	RTS				;052c: 4e75
+sym_0_351:
+	BSR.W	LAB_00A0		;052e: 6100007a
+	BSR.W	LAB_00B3		;0532: 61000114
+LAB_0096:
+	MOVE.W	5902(A5),13728(A5)	;0536: 3b6d170e35a0
+	MOVE.L	D5,D6			;053c: 2c05
+	BSR.W	LAB_00A0		;053e: 6100006a
+	BNE.S	LAB_0096		;0542: 66f2
+LAB_0097:
+	MOVE.L	D3,D5			;0544: 2a03
+	DBF	D6,LAB_0097		;0546: 51cefffc
+	MOVE.W	24812(A5),29485(A5)	;054a: 3b6d60ec732d
+	BRA.S	LAB_0098		;0550: 6012
+	BVS.S	LAB_00A3		;0552: 696e
+	MOVEQ	#117,D2			;0554: 7475
+	BVS.S	LAB_00A5		;0556: 6974
+	DC.W	$696f			;0558
+	BGT.S	LAB_009C		;055a: 6e2e
+	DC.W	$6c69			;055c
+	BHI.S	LAB_00A6+4		;055e: 6272
+	BSR.S	LAB_00A7		;0560: 6172
+	DC.W	$7900			;0562
+LAB_0098:
+	BSR.W	LAB_00B3		;0564: 610000e2
+	CMPI.L	#$000000eb,D0		;0568: 0c80000000eb
+	LEA	LAB_0040(PC),A2		;056e: 45fafcb0
+sym_0_364:
+	MOVE.L	8624(A5),D4		;0572: 282d21b0
+LAB_009A:
+	BSR.W	LAB_00B3		;0576: 610000d0
+LAB_009B:
+	ADDQ.L	#6,A7			;057a: 5c8f
+	BNE.S	LAB_009A		;057c: 66f8
+	BNE.S	LAB_009B		;057e: 66fa
+	MOVE.L	D4,D3			;0580: 2604
+	BSR.W	LAB_00AB		;0582: 61000088
+	JSR	-540(A6)		;0586: 4eaefde4
+LAB_009C:
+	BSR.W	LAB_00AB		;058a: 61000080
+	DBF	D5,LAB_009C		;058e: 51cdfffa
+LAB_009D:
+	ADD.L	D0,D3			;0592: d680
+	DBF	D2,LAB_009D		;0594: 51cafffc
+	MOVEQ	#126,D2			;0598: 747e
+sym_0_377:
+	ADD.L	D4,D2			;059a: d484
+LAB_009F:
+	JSR	EXT_0000		;059c: 4eb900000000
+	DBF	D4,LAB_009F		;05a2: 51ccfff8
+	ADD.L	D0,D1			;05a6: d280
+	RTS				;05a8: 4e75
+LAB_00A0:
+	LINK.W	A5,#-252		;05aa: 4e55ff04
+	BSR.W	LAB_00AB		;05ae: 6100005c
+LAB_00A1:
+	TST.L	D1			;05b2: 4a81
+	DBF	D5,LAB_00A1		;05b4: 51cdfffc
+LAB_00A2:
+	LEA	LAB_0003(PC),A4		;05b8: 49fafa54
+	BNE.S	LAB_00A2		;05bc: 66fa
+	BSR.W	LAB_00AB		;05be: 6100004c
+LAB_00A3:
+	BSR.W	LAB_00B9		;05c2: 610000a0
+sym_0_390:
+	CMPI.L	#$00000051,D6		;05c6: 0c8600000051
+LAB_00A5:
+	ADDQ.L	#4,A2			;05cc: 588a
+LAB_00A6:
+	MOVE.L	#SECSTRT_1,-(A7)	;05ce: 2f3c00000800
+LAB_00A7:
+	BRA.S	LAB_00A8		;05d4: 6012
+	BVS.S	sym_0_416		;05d6: 696e
+	MOVEQ	#117,D2			;05d8: 7475
+	BVS.S	LAB_00B4+4		;05da: 6974
+	DC.W	$696f			;05dc
+	BGT.S	LAB_00AB+2		;05de: 6e2e
+	DC.W	$6c69			;05e0
+	BHI.S	LAB_00B6		;05e2: 6272
+	BSR.S	LAB_00B6+2		;05e4: 6172
+	DC.W	$7900			;05e6
+LAB_00A8:
+	ADD.L	D0,D5			;05e8: da80
+LAB_00A9:
+	DBF	D3,LAB_00A8		;05ea: 51cbfffc
+	LEA	LAB_0093(PC),A2		;05ee: 45faff20
+	BNE.S	LAB_00A9		;05f2: 66f6
+	BRA.S	LAB_00AA		;05f4: 6012
+	BEQ.S	LAB_00BA+2		;05f6: 6772
+	BSR.S	LAB_00BA+2		;05f8: 6170
+	DC.W	$6869			;05fa
+	DC.W	$6373			;05fc
+	MOVEA.L	26978(A4),A7		;05fe: 2e6c6962
+	MOVEQ	#97,D1			;0602: 7261
+	MOVEQ	#121,D1			;0604: 7279
+	DC.W	$0000			;0606
+LAB_00AA:
+	UNLK	A5			;0608: 4e5d
+	RTS				;060a: 4e75
+LAB_00AB:
+	LINK.W	A5,#-92			;060c: 4e55ffa4
+	BSR.W	LAB_00B3		;0610: 61000036
+sym_0_403:
+	MOVE.L	14210(A5),D6		;0614: 2c2d3782
+	MOVEQ	#53,D5			;0618: 7a35
+	ADD.L	D5,D6			;061a: dc85
+LAB_00AE:
+	BSR.W	LAB_00D0		;061c: 610000fa
+	BSR.W	LAB_00B3		;0620: 61000026
+LAB_00AF:
+	MOVE.L	11846(A5),D1		;0624: 222d2e46
+LAB_00B0:
+	BNE.S	LAB_00AE		;0628: 66f2
+	MOVE.L	#LAB_01AD,-(A7)		;062a: 2f3c000010fe
+LAB_00B1:
+	MOVE.W	11172(A5),9971(A5)	;0630: 3b6d2ba426f3
+	DBF	D6,LAB_00B1		;0636: 51cefff8
+	CMPI.L	#$00000073,D2		;063a: 0c8200000073
+	BSR.W	LAB_00B3		;0640: 61000006
+	UNLK	A5			;0644: 4e5d
+sym_0_416:
+	RTS				;0646: 4e75
+LAB_00B3:
+	BSR.W	LAB_00B9		;0648: 6100001a
+LAB_00B4:
+	LEA	LAB_016E,A0		;064c: 41f900000e48
+	DBF	D0,LAB_00B4		;0652: 51c8fff8
+LAB_00B6:
+	BSR.W	LAB_00D8		;0656: 610000f0
+LAB_00B8:
+	ADD.L	D7,D6			;065a: dc87
+	JSR	-528(A6)		;065c: 4eaefdf0
+	BNE.S	LAB_00B8		;0660: 66f8
+	RTS				;0662: 4e75
+LAB_00B9:
+	LINK.W	A5,#-220		;0664: 4e55ff24
+LAB_00BA:
+	BSR.W	LAB_00D0		;0668: 610000ae
+	LEA	LAB_0054(PC),A0		;066c: 41fafc66
+sym_0_429:
+	CMP.L	#$0000f98c,D1		;0670: b2bc0000f98c
+	DBF	D7,sym_0_429		;0676: 51cffff8
+	MOVEQ	#-62,D3			;067a: 76c2
+	JSR	EXT_0000		;067c: 4eb900000000
+LAB_00BC:
+	JSR	EXT_0000		;0682: 4eb900000000
+LAB_00BD:
+	DBF	D7,LAB_00BC		;0688: 51cffff8
+	MOVEQ	#-29,D2			;068c: 74e3
+LAB_00BE:
+	CMP.L	#$0000bc17,D3		;068e: b6bc0000bc17
+	BNE.S	LAB_00BD		;0694: 66f2
+LAB_00BF:
+	MOVEQ	#72,D7			;0696: 7e48
+LAB_00C0:
+	BNE.S	LAB_00BE		;0698: 66f4
+	DBF	D2,LAB_00C0		;069a: 51cafffc
+LAB_00C1:
+	JSR	-480(A6)		;069e: 4eaefe20
+sym_0_442:
+	BNE.S	LAB_00C0		;06a2: 66f4
+	BRA.S	LAB_00C3		;06a4: 600e
+	DC.W	$4f75			;06a6
+	MOVEQ	#32,D2			;06a8: 7420
+	BLE.S	sym_0_468		;06aa: 6f66
+	MOVEA.L	25965(A5),A0		;06ac: 206d656d
+	BLE.S	LAB_00D3		;06b0: 6f72
+	DC.W	$7900			;06b2
+LAB_00C3:
+	BNE.S	LAB_00C1		;06b4: 66e8
+	BSR.W	LAB_00D0		;06b6: 61000060
+LAB_00C4:
+	JSR	-600(A6)		;06ba: 4eaefda8
+LAB_00C5:
+	BRA.S	LAB_00C6		;06be: 600a
+	DC.W	$2573			;06c0
+	MOVE.W	-(A0),D5		;06c2: 3a20
+	MOVE.L	25610(A4),0(A2)		;06c4: 256c640a0000
+LAB_00C6:
+	BNE.S	LAB_00C5		;06ca: 66f2
+LAB_00C7:
+	BNE.S	LAB_00C4		;06cc: 66ec
+LAB_00C8:
+	BNE.S	LAB_00C7		;06ce: 66fc
+	ADDQ.L	#3,A5			;06d0: 568d
+	CMPI.L	#$00000081,D5		;06d2: 0c8500000081
+	BNE.S	LAB_00C8		;06d8: 66f4
+	MOVE.L	#LAB_0145+4,-(A7)	;06da: 2f3c00000ce6
+sym_0_455:
+	LEA	LAB_00B4(PC),A2		;06e0: 45faff6a
+	LEA	LAB_00BC(PC),A6		;06e4: 4dfaff9c
+LAB_00CA:
+	MOVE.W	2618(A5),18862(A5)	;06e8: 3b6d0a3a49ae
+LAB_00CB:
+	LEA	LAB_0044+4(PC),A6	;06ee: 4dfafb5a
+	CMP.L	#$00004728,D4		;06f2: b8bc00004728
+LAB_00CC:
+	BNE.S	LAB_00CA		;06f8: 66ee
+	MOVE.L	13002(A5),D4		;06fa: 282d32ca
+	BNE.S	LAB_00CC		;06fe: 66f8
+LAB_00CD:
+	LEA	LAB_0082(PC),A0		;0700: 41fafd8c
+	DBF	D3,LAB_00CD		;0704: 51cbfffa
+LAB_00CE:
+	BSR.W	LAB_00D8		;0708: 6100003e
+	DBF	D3,LAB_00CE		;070c: 51cbfffa
+	MOVEQ	#-79,D5			;0710: 7ab1
+sym_0_468:
+	ADD.L	D4,D6			;0712: dc84
+	UNLK	A5			;0714: 4e5d
+	RTS				;0716: 4e75
+LAB_00D0:
+	LINK.W	A5,#-192		;0718: 4e55ff40
+LAB_00D1:
+	BSR.W	LAB_00D8		;071c: 6100002a
+LAB_00D2:
+	DBF	D4,LAB_00D1		;0720: 51ccfffa
+LAB_00D3:
+	DBF	D2,LAB_00D2		;0724: 51cafffa
+	MOVE.W	29160(A5),3339(A5)	;0728: 3b6d71e80d0b
+	BSR.W	LAB_00E5		;072e: 61000092
+LAB_00D4:
+	BNE.S	LAB_00D3		;0732: 66f0
+	DBF	D6,LAB_00D4		;0734: 51cefffc
+LAB_00D5:
+	LEA	LAB_00CB+2(PC),A0	;0738: 41faffb6
+LAB_00D6:
+	DBF	D2,LAB_00D5		;073c: 51cafffa
+sym_0_481:
+	DBF	D2,LAB_00D6		;0740: 51cafffa
+	UNLK	A5			;0744: 4e5d
+	RTS				;0746: 4e75
+LAB_00D8:
+	BSR.W	LAB_00E5		;0748: 61000078
+	BSR.W	LAB_00E5		;074c: 61000074
+LAB_00D9:
+	TST.L	D3			;0750: 4a83
+	DBF	D1,LAB_00D9		;0752: 51c9fffc
+	JSR	-420(A6)		;0756: 4eaefe5c
+	MOVEQ	#-77,D6			;075a: 7cb3
+	MOVEQ	#104,D3			;075c: 7668
+	BSR.W	LAB_00E5		;075e: 61000062
+LAB_00DA:
+	LEA	LAB_0069+2(PC),A0	;0762: 41fafc2e
+sym_0_494:
+	DBF	D2,LAB_00DA		;0766: 51cafffa
+LAB_00DC:
+	DBF	D7,sym_0_494		;076a: 51cffffa
+LAB_00DD:
+	BNE.S	LAB_00DC		;076e: 66fa
+	DBF	D3,LAB_00DD		;0770: 51cbfffc
+	JSR	-186(A6)		;0774: 4eaeff46
+	BSR.W	LAB_00E5		;0778: 61000048
+LAB_00DE:
+	JSR	EXT_0000		;077c: 4eb900000000
+	CMP.L	#$00009439,D7		;0782: bebc00009439
+LAB_00DF:
+	CMPI.L	#$000000e6,D3		;0788: 0c83000000e6
+LAB_00E0:
+	DBF	D7,LAB_00DF		;078e: 51cffff8
+	LEA	LAB_00F0,A2		;0792: 45f900000974
+	BNE.S	LAB_00E0		;0798: 66f4
+	MOVE.L	D7,D0			;079a: 2007
+sym_0_507:
+	MOVE.W	27769(A5),28641(A5)	;079c: 3b6d6c796fe1
+	MOVE.L	D3,D6			;07a2: 2c03
+LAB_00E2:
+	BSR.W	LAB_00E5		;07a4: 6100001c
+	DBF	D7,LAB_00E2		;07a8: 51cffffa
+	BSR.W	LAB_00E5		;07ac: 61000014
+LAB_00E3:
+	BSR.W	LAB_00E5		;07b0: 61000010
+	DBF	D1,LAB_00E3		;07b4: 51c9fffa
+LAB_00E4:
+	LEA	LAB_0067(PC),A4		;07b8: 49fafbc4
+	DBF	D1,LAB_00E4		;07bc: 51c9fffa
+	RTS				;07c0: 4e75
+LAB_00E5:
+	JSR	sym_2_0			;07c2: 4eb900000a00
+	NOP				;07c8: 4e71
+	NOP				;07ca: 4e71
+	NOP				;07cc: 4e71
+	NOP				;07ce: 4e71
+	NOP				;07d0: 4e71
+	NOP				;07d2: 4e71
+	NOP				;07d4: 4e71
+	NOP				;07d6: 4e71
+	NOP				;07d8: 4e71
+	NOP				;07da: 4e71
+	NOP				;07dc: 4e71
+	NOP				;07de: 4e71
+	NOP				;07e0: 4e71
+	NOP				;07e2: 4e71
+	NOP				;07e4: 4e71
+	NOP				;07e6: 4e71
+	NOP				;07e8: 4e71
+	NOP				;07ea: 4e71
+	NOP				;07ec: 4e71
+	NOP				;07ee: 4e71
+	NOP				;07f0: 4e71
+	NOP				;07f2: 4e71
+	NOP				;07f4: 4e71
+	NOP				;07f6: 4e71
+	NOP				;07f8: 4e71
+	NOP				;07fa: 4e71
+	NOP				;07fc: 4e71
+	RTS				;07fe: 4e75
+
+
+	SECTION S_1,DATA
+
+SECSTRT_1:
+	DC.L	$4b74f1ba,$04e6aa29,$576f726b,$62656e63 ;0800
+	DC.L	$68000706,$1a8a5783,$92d434a6,$bc2f0f51 ;0810
+	DC.L	$462742a5,$55345afb,$e87d1e51,$499e6772 ;0820
+	DC.L	$61706869,$63732e6c,$69627261 ;0830
+LAB_00E7:
+	DC.L	$72790000,$27b5ba00	;083c
+	DC.W	$030e			;0844
+LAB_00E8:
+	DC.W	$e9c9			;0846
+LAB_00E9:
+	DC.L	LAB_00FA		;0848: 00000a18
+	DC.L	$7cfc8b29,$067e4a1f,$4fa38c65 ;084c
+LAB_00EA:
+	DC.L	$49ef0bdd		;0858
+LAB_00EB:
+	DC.L	$15946e18,$1dfe0c58,$5d3ea920,$41db5a0f ;085c
+	DC.L	$70f3581f,$25733a20,$256c640a,$00006397 ;086c
+	DC.L	$c93241c5,$e9175e99,$1925514b,$433d07c9 ;087c
+	DC.L	$898b66c7,$50925ef4,$2434466d,$b1f238bf ;088c
+	DC.L	$6e154368,$12ad59b4,$c6ee434f,$4e3a302f ;089c
+	DC.L	$302f3634,$302f3230,$302f4f75,$74707574 ;08ac
+	DC.L	$0000646f		;08bc
+LAB_00EC:
+	DC.L	$732e6c69,$62726172,$790005fe,$b9741351 ;08c0
+	DC.L	$d539683c,$643a0a2a,$d37b45d6 ;08d0
+LAB_00ED:
+	DC.L	$127d7d81,$bfb2600a,$b4e645b4,$48bf6cf9 ;08dc
+	DC.L	$d9e134eb		;08ec
+LAB_00EE:
+	DC.L	$7ad73ecd,$14110f80,$5d434180,$55ab17fe ;08f0
+	DC.L	$4f3f3486,$cf3929d9,$8d2011f6,$78f8145f ;0900
+	DC.L	$23b35ae4,$c2c7052f	;0910
+	DC.W	$f8a3			;0918
+	DC.L	LAB_00EA		;091a: 00000858
+	DC.L	$01099877,$5d449e23,$6cb2b635,$2fd1b375 ;091e
+	DC.L	$4c404333,$6c44d660	;092e
+	DC.L	LAB_0151		;0936: 00000d52
+	DC.L	$306df3f0,$7b3d4139,$61a9b7b3,$3ddafbf6 ;093a
+	DC.L	$35c31145,$55b06aee,$388f2a89,$6b02e08a ;094a
+	DC.L	$516e81fb,$08091391,$5067ed74,$21c2c34b ;095a
+	DC.W	$33b4			;096a
+LAB_00EF:
+	DC.L	$007d0b6e,$94c75265	;096c
+LAB_00F0:
+	DC.L	$6164792e,$0000732e,$3eb175ec ;0974
+	DC.W	$52a2			;0980
+LAB_00F1:
+	DC.L	$39fe02d1,$5ff2f19f,$68adaa59,$58901aaa ;0982
+	DC.L	$4572726f,$723a2000,$50f5a69a,$1e2427ab ;0992
+	DC.L	$65ad3620,$026bddbf,$7844fe8b ;09a2
+	DC.W	$077e			;09ae
+LAB_00F2:
+	DC.L	$79c51401		;09b0
+LAB_00F3:
+	DC.L	$c62023f1,$fad9413b	;09b4
+	DC.W	$8df3			;09bc
+LAB_00F4:
+	DC.L	$5fce665b		;09be
+	DC.W	$3d21			;09c2
+LAB_00F5:
+	DC.L	$f1d307eb,$379566e2,$0f6c0501,$630a4f31 ;09c4
+	DC.L	$2150045b,$9c590000	;09d4
+	DS.L	6			;09dc
+LAB_00F6:
+	DS.L	3			;09f4
+
+
+	SECTION S_2,CODE
+
+sym_2_0:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0a00: 48e73f3e
+	BSR.W	LAB_0103		;0a04: 61000078
+	LEA	LAB_003C,A4		;0a08: 49f9000001f2
+LAB_00F8:
+	TST.L	D7			;0a0e: 4a87
+LAB_00F9:
+	MOVE.W	28221(A5),28577(A5)	;0a10: 3b6d6e3d6fa1
+	BNE.S	LAB_00F8		;0a16: 66f6
+LAB_00FA:
+	BNE.S	LAB_00F9		;0a18: 66f6
+LAB_00FB:
+	BNE.S	LAB_00F9		;0a1a: 66f4
+	MOVE.L	9616(A5),D0		;0a1c: 202d2590
+LAB_00FC:
+	BNE.S	LAB_00FB		;0a20: 66f8
+	LEA	LAB_00FC,A6		;0a22: 4df900000a20
+	BSR.W	LAB_0103		;0a28: 61000054
+	CMPI.L	#$00000096,D5		;0a2c: 0c8500000096
+sym_2_13:
+	BSR.W	sym_2_78		;0a32: 610000e2
+	MOVE.L	29406(A5),D5		;0a36: 2a2d72de
+	MOVE.L	#LAB_012A+2,-(A7)	;0a3a: 2f3c00000c08
+LAB_00FE:
+	ADDQ.L	#5,A4			;0a40: 5a8c
+	JSR	-324(A6)		;0a42: 4eaefebc
+	BSR.W	LAB_0103		;0a46: 61000036
+LAB_00FF:
+	BNE.S	LAB_00FE		;0a4a: 66f4
+	BSR.W	LAB_010D		;0a4c: 61000074
+	LEA	LAB_00FF(PC),A6		;0a50: 4dfafff8
+	LEA	LAB_00FA(PC),A4		;0a54: 49faffc2
+	CMPI.L	#$000000f5,D3		;0a58: 0c83000000f5
+	BSR.W	sym_2_78		;0a5e: 610000b6
+LAB_0100:
+	MOVE.W	20026(A5),18726(A5)	;0a62: 3b6d4e3a4926
+sym_2_26:
+	DBF	D4,LAB_0100		;0a68: 51ccfff8
+	CMPI.L	#$0000007e,D7		;0a6c: 0c870000007e
+LAB_0102:
+	BNE.S	sym_2_26		;0a72: 66f4
+	DBF	D6,LAB_0102		;0a74: 51cefffc
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0a78: 4cdf7cfc
+	RTS				;0a7c: 4e75
+LAB_0103:
+	LINK.W	A5,#-72			;0a7e: 4e55ffb8
+	BSR.W	LAB_010D		;0a82: 6100003e
+	TST.L	D1			;0a86: 4a81
+	MOVEQ	#106,D3			;0a88: 766a
+LAB_0104:
+	BSR.W	LAB_010D		;0a8a: 61000036
+	DBF	D3,LAB_0104		;0a8e: 51cbfffa
+LAB_0105:
+	BSR.W	LAB_010D		;0a92: 6100002e
+sym_2_39:
+	ADDQ.L	#7,A6			;0a96: 5e8e
+	MOVE.L	D1,D4			;0a98: 2801
+	JSR	EXT_0000		;0a9a: 4eb900000000
+LAB_0107:
+	MOVE.W	20086(A5),13162(A5)	;0aa0: 3b6d4e76336a
+	ADDQ.L	#2,A1			;0aa6: 5489
+LAB_0108:
+	MOVE.W	25805(A5),14148(A5)	;0aa8: 3b6d64cd3744
+	BNE.S	LAB_0107		;0aae: 66f0
+	BSR.W	sym_2_78		;0ab0: 61000064
+LAB_0109:
+	BNE.S	LAB_0108		;0ab4: 66f2
+LAB_010A:
+	MOVEQ	#10,D7			;0ab6: 7e0a
+LAB_010B:
+	DBF	D0,LAB_010A		;0ab8: 51c8fffc
+	BNE.S	LAB_0109		;0abc: 66f6
+	UNLK	A5			;0abe: 4e5d
+sym_2_52:
+	RTS				;0ac0: 4e75
+LAB_010D:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0ac2: 48e73f3e
+	BSR.W	sym_2_78		;0ac6: 6100004e
+	ADD.L	D1,D3			;0aca: d681
+	BSR.W	LAB_0120		;0acc: 610000ca
+	MOVE.L	D3,D7			;0ad0: 2e03
+	LEA	LAB_0105(PC),A0		;0ad2: 41faffbe
+	BSR.W	LAB_0120		;0ad6: 610000c0
+	LEA	LAB_0103(PC),A6		;0ada: 4dfaffa2
+	CMP.L	#$0000d004,D5		;0ade: babc0000d004
+	BSR.W	LAB_0126		;0ae4: 610000fc
+	MOVE.L	20758(A5),D6		;0ae8: 2c2d5116
+LAB_010E:
+	MOVE.L	D1,D4			;0aec: 2801
+sym_2_65:
+	DBF	D7,LAB_010E		;0aee: 51cffffc
+LAB_0110:
+	JSR	-288(A6)		;0af2: 4eaefee0
+	BSR.W	sym_2_78		;0af6: 6100001e
+	BNE.S	LAB_0110		;0afa: 66f6
+	MOVEQ	#33,D3			;0afc: 7621
+	JSR	EXT_0000		;0afe: 4eb900000000
+	ADDQ.L	#7,A5			;0b04: 5e8d
+	BSR.W	LAB_0120		;0b06: 61000090
+LAB_0111:
+	BSR.W	sym_2_78		;0b0a: 6100000a
+	BNE.S	LAB_0111		;0b0e: 66fa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0b10: 4cdf7cfc
+	RTS				;0b14: 4e75
+sym_2_78:
+	BSR.W	LAB_0120		;0b16: 61000080
+	TST.L	D3			;0b1a: 4a83
+LAB_0113:
+	TST.L	D2			;0b1c: 4a82
+LAB_0114:
+	DBF	D6,LAB_0113		;0b1e: 51cefffc
+	DBF	D6,LAB_0114		;0b22: 51cefffa
+LAB_0115:
+	MOVEQ	#3,D7			;0b26: 7e03
+	DBF	D7,LAB_0115		;0b28: 51cffffc
+LAB_0116:
+	BSR.W	LAB_0126		;0b2c: 610000b4
+	DBF	D4,LAB_0116		;0b30: 51ccfffa
+	MOVEQ	#98,D2			;0b34: 7462
+LAB_0117:
+	MOVE.L	#LAB_00BF,-(A7)		;0b36: 2f3c00000696
+	JSR	EXT_0000		;0b3c: 4eb900000000
+	BNE.S	LAB_0117		;0b42: 66f2
+sym_2_91:
+	MOVEQ	#115,D0			;0b44: 7073
+	BSR.W	LAB_0134		;0b46: 610000fc
+	MOVE.L	D5,D2			;0b4a: 2405
+	ADD.L	D6,D4			;0b4c: d886
+LAB_0119:
+	JSR	-528(A6)		;0b4e: 4eaefdf0
+	BSR.W	LAB_0126		;0b52: 6100008e
+	MOVE.L	20470(A5),D1		;0b56: 222d4ff6
+	BSR.W	LAB_0120		;0b5a: 6100003c
+	MOVE.W	23573(A5),20717(A5)	;0b5e: 3b6d5c1550ed
+LAB_011A:
+	JSR	-678(A6)		;0b64: 4eaefd5a
+	BNE.S	LAB_011A		;0b68: 66fa
+LAB_011B:
+	MOVE.W	19070(A5),30058(A5)	;0b6a: 3b6d4a7e756a
+	BNE.S	LAB_011B		;0b70: 66f8
+sym_2_104:
+	BSR.W	LAB_0134		;0b72: 610000d0
+	MOVEQ	#103,D7			;0b76: 7e67
+	MOVE.W	1504(A5),2027(A5)	;0b78: 3b6d05e007eb
+LAB_011D:
+	CMP.L	#$00000626,D4		;0b7e: b8bc00000626
+	DBF	D2,LAB_011D		;0b84: 51cafff8
+LAB_011F:
+	CMPI.L	#$000000ea,D4		;0b88: 0c84000000ea
+	DBF	D3,LAB_011F		;0b8e: 51cbfff8
+	MOVE.L	32112(A5),D0		;0b92: 202d7d70
+	RTS				;0b96: 4e75
+LAB_0120:
+	LINK.W	A5,#-56			;0b98: 4e55ffc8
+	BSR.W	LAB_0126		;0b9c: 61000044
+	BRA.S	LAB_0121		;0ba0: 6012
+	BVS.S	LAB_012D+2		;0ba2: 696e
+	MOVEQ	#117,D2			;0ba4: 7475
+	BVS.S	LAB_012E+2		;0ba6: 6974
+	DC.W	$696f			;0ba8
+	BGT.S	LAB_0125		;0baa: 6e2e
+	DC.W	$6c69			;0bac
+	BHI.S	LAB_012F+2		;0bae: 6272
+	BSR.S	LAB_012F+4		;0bb0: 6172
+	DC.W	$7900			;0bb2
+LAB_0121:
+	BSR.W	LAB_0126		;0bb4: 6100002c
+sym_2_117:
+	MOVE.L	23146(A5),D7		;0bb8: 2e2d5a6a
+	ADD.L	D1,D6			;0bbc: dc81
+	ADDQ.L	#4,A5			;0bbe: 588d
+LAB_0123:
+	MOVEQ	#111,D2			;0bc0: 746f
+	DBF	D7,LAB_0123		;0bc2: 51cffffc
+	ADD.W	D0,D0			;0bc6: d040
+	MOVE.W	LAB_0124(PC,D0.W),D0	;0bc8: 303b0006
+	JMP	LAB_0124(PC,D0.W)	;0bcc: 4efb0002
+LAB_0124:
+	ORI.B	#$0a,D6			;0bd0: 0006000a
+	DC.W	$000e			;0bd4
+	MOVEQ	#0,D0			;0bd6: 7000
+	RTS				;0bd8: 4e75
+LAB_0125:
+	MOVEQ	#1,D0			;0bda: 7001
+	RTS				;0bdc: 4e75
+	MOVEQ	#2,D0			;0bde: 7002
+	RTS				;0be0: 4e75
+LAB_0126:
+	BSR.W	LAB_0134		;0be2: 61000060
+	JSR	EXT_0000		;0be6: 4eb900000000
+LAB_0127:
+	MOVE.L	#LAB_00EC,-(A7)		;0bec: 2f3c000008c0
+sym_2_130:
+	DBF	D4,LAB_0127		;0bf2: 51ccfff8
+	BNE.S	sym_2_130		;0bf6: 66fa
+	BRA.S	LAB_0129		;0bf8: 6008
+	ADDQ.W	#1,-(A5)		;0bfa: 5265
+	BSR.S	LAB_013B		;0bfc: 6164
+	DC.W	$792e			;0bfe
+	DC.W	$0000			;0c00
+LAB_0129:
+	LEA	LAB_0119(PC),A4		;0c02: 49faff4a
+LAB_012A:
+	DBF	D6,LAB_0129		;0c06: 51cefffa
+	DBF	D3,LAB_012A		;0c0a: 51cbfffa
+LAB_012C:
+	MOVEQ	#-91,D7			;0c0e: 7ea5
+LAB_012D:
+	DBF	D6,LAB_012C		;0c10: 51cefffc
+	JSR	-42(A6)			;0c14: 4eaeffd6
+	BNE.S	LAB_012C		;0c18: 66f4
+LAB_012E:
+	CMPI.L	#$0000004e,D7		;0c1a: 0c870000004e
+LAB_012F:
+	MOVE.L	#LAB_00EB,-(A7)		;0c20: 2f3c0000085c
+	DBF	D6,LAB_012F		;0c26: 51cefff8
+sym_2_143:
+	ADDQ.L	#7,A0			;0c2a: 5e88
+	ADD.L	D1,D5			;0c2c: da81
+	MOVEQ	#-93,D3			;0c2e: 76a3
+	CMPI.L	#$000000fc,D5		;0c30: 0c85000000fc
+	BRA.S	LAB_0133		;0c36: 6008
+	ADDQ.W	#1,-(A5)		;0c38: 5265
+	BSR.S	LAB_013E+2		;0c3a: 6164
+	DC.W	$792e			;0c3c
+	DC.W	$0000			;0c3e
+LAB_0133:
+	ADD.L	D6,D6			;0c40: dc86
+	RTS				;0c42: 4e75
+LAB_0134:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0c44: 48e73f3e
+	BSR.W	LAB_0140		;0c48: 61000066
+	ADDQ.L	#4,A1			;0c4c: 5889
+LAB_0136:
+	TST.L	D5			;0c4e: 4a85
+LAB_0137:
+	DBF	D0,LAB_0136		;0c50: 51c8fffc
+LAB_0138:
+	BNE.S	LAB_0137		;0c54: 66fa
+sym_2_156:
+	DBF	D7,LAB_0138		;0c56: 51cffffc
+LAB_013A:
+	CMPI.L	#$00000078,D5		;0c5a: 0c8500000078
+	MOVE.L	D1,D6			;0c60: 2c01
+LAB_013B:
+	BNE.S	LAB_013A		;0c62: 66f6
+LAB_013C:
+	DBF	D6,LAB_013B		;0c64: 51cefffc
+	DBF	D2,LAB_013C		;0c68: 51cafffa
+	MOVE.W	6779(A5),13199(A5)	;0c6c: 3b6d1a7b338f
+	BSR.W	sym_2_208		;0c72: 610000be
+	BRA.S	LAB_013D		;0c76: 6018
+	DC.W	$434f			;0c78
+	DC.W	$4e3a			;0c7a
+	MOVE.W	12335(A7),D0		;0c7c: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;0c80: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0c84: 3230302f
+	DC.W	$4f75			;0c88
+	MOVEQ	#112,D2			;0c8a: 7470
+	DC.W	$7574			;0c8c
+	DC.W	$0000			;0c8e
+LAB_013D:
+	BSR.W	LAB_014A		;0c90: 61000078
+	LEA	LAB_0047+2,A4		;0c94: 49f900000254
+	BSR.W	LAB_0140		;0c9a: 61000014
+LAB_013E:
+	BSR.W	sym_2_208		;0c9e: 61000092
+sym_2_169:
+	ADDQ.L	#7,A6			;0ca2: 5e8e
+	CMP.L	#$0000467d,D4		;0ca4: b8bc0000467d
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0caa: 4cdf7cfc
+	RTS				;0cae: 4e75
+LAB_0140:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0cb0: 48e73f3e
+	BSR.W	LAB_014A		;0cb4: 61000054
+	ADDQ.L	#1,A7			;0cb8: 528f
+	MOVE.L	#LAB_0027,-(A7)		;0cba: 2f3c00000140
+LAB_0141:
+	ADDQ.L	#6,A1			;0cc0: 5c89
+LAB_0142:
+	DBF	D1,LAB_0141		;0cc2: 51c9fffc
+	BNE.S	LAB_0142		;0cc6: 66fa
+	BNE.S	LAB_0141		;0cc8: 66f6
+	MOVEQ	#-46,D4			;0cca: 78d2
+sym_2_182:
+	MOVE.L	19758(A5),D4		;0ccc: 282d4d2e
+	JSR	-126(A6)		;0cd0: 4eaeff82
+	CMPI.L	#$0000003f,D4		;0cd4: 0c840000003f
+	BSR.W	sym_2_234		;0cda: 610000bc
+LAB_0144:
+	ADDQ.L	#7,A7			;0cde: 5e8f
+	BNE.S	LAB_0144		;0ce0: 66fc
+LAB_0145:
+	CMP.L	#$0000a6d8,D2		;0ce2: b4bc0000a6d8
+	DBF	D5,LAB_0145		;0ce8: 51cdfff8
+	ADD.L	D2,D4			;0cec: d882
+	MOVE.L	27380(A5),D3		;0cee: 262d6af4
+	BSR.W	LAB_014A		;0cf2: 61000016
+LAB_0147:
+	MOVE.W	27319(A5),10658(A5)	;0cf6: 3b6d6ab729a2
+LAB_0148:
+	DBF	D1,LAB_0147		;0cfc: 51c9fff8
+sym_2_195:
+	DBF	D4,LAB_0148		;0d00: 51ccfffa
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0d04: 4cdf7cfc
+	RTS				;0d08: 4e75
+LAB_014A:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0d0a: 48e73f3e
+LAB_014B:
+	BSR.W	sym_2_208		;0d0e: 61000022
+	DBF	D3,LAB_014B		;0d12: 51cbfffa
+LAB_014C:
+	MOVE.L	12194(A5),D6		;0d16: 2c2d2fa2
+	JSR	EXT_0000		;0d1a: 4eb900000000
+	BSR.W	sym_2_234		;0d20: 61000076
+	MOVE.L	11204(A5),D3		;0d24: 262d2bc4
+	BSR.W	sym_2_234		;0d28: 6100006e
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0d2c: 4cdf7cfc
+	RTS				;0d30: 4e75
+sym_2_208:
+	LINK.W	A5,#-196		;0d32: 4e55ff3c
+	BSR.W	sym_2_234		;0d36: 61000060
+LAB_014E:
+	MOVE.L	21704(A5),D4		;0d3a: 282d54c8
+	JSR	-672(A6)		;0d3e: 4eaefd60
+LAB_014F:
+	BNE.S	LAB_014E		;0d42: 66f6
+	MOVEQ	#-106,D4		;0d44: 7896
+LAB_0150:
+	BNE.S	LAB_014F		;0d46: 66fa
+	LEA	LAB_00E9+2,A6		;0d48: 4df90000084a
+	BSR.W	sym_2_234		;0d4e: 61000048
+LAB_0151:
+	BNE.S	LAB_0150		;0d52: 66f2
+	ADD.L	D2,D7			;0d54: de82
+LAB_0152:
+	BSR.W	LAB_0173		;0d56: 6100012c
+	BRA.S	sym_2_221		;0d5a: 600c
+	DC.W	$646f			;0d5c
+	DC.W	$732e			;0d5e
+	DC.W	$6c69			;0d60
+	BHI.S	LAB_015E		;0d62: 6272
+	BSR.S	LAB_015E+2		;0d64: 6172
+	DC.W	$7900			;0d66
+sym_2_221:
+	MOVE.L	D3,D3			;0d68: 2603
+	JSR	-210(A6)		;0d6a: 4eaeff2e
+LAB_0154:
+	BSR.W	LAB_0173		;0d6e: 61000114
+	DBF	D1,LAB_0154		;0d72: 51c9fffa
+	MOVE.W	32380(A5),21888(A5)	;0d76: 3b6d7e7c5580
+	MOVEQ	#-61,D2			;0d7c: 74c3
+LAB_0155:
+	BSR.W	sym_2_234		;0d7e: 61000018
+LAB_0156:
+	DBF	D6,LAB_0155		;0d82: 51cefffa
+	DBF	D0,LAB_0156		;0d86: 51c8fffa
+LAB_0157:
+	CMPI.L	#$000000c9,D6		;0d8a: 0c86000000c9
+	DBF	D0,LAB_0157		;0d90: 51c8fff8
+	UNLK	A5			;0d94: 4e5d
+	RTS				;0d96: 4e75
+sym_2_234:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;0d98: 48e73f3e
+	BSR.W	LAB_016B		;0d9c: 6100008c
+	MOVE.L	#LAB_00F3,-(A7)		;0da0: 2f3c000009b4
+	BSR.W	LAB_016B		;0da6: 61000082
+	LEA	LAB_00F6,A6		;0daa: 4df9000009f4
+LAB_0159:
+	ADDQ.L	#4,A1			;0db0: 5889
+	DBF	D1,LAB_0159		;0db2: 51c9fffc
+	MOVEQ	#21,D2			;0db6: 7415
+LAB_015A:
+	BSR.W	LAB_016B		;0db8: 61000070
+	MOVE.L	D2,D1			;0dbc: 2202
+	MOVE.L	16788(A5),D6		;0dbe: 2c2d4194
+LAB_015B:
+	BNE.S	LAB_015A		;0dc2: 66f4
+	DBF	D7,LAB_015B		;0dc4: 51cffffc
+sym_2_247:
+	MOVE.L	D5,D6			;0dc8: 2c05
+LAB_015D:
+	MOVE.L	D1,D5			;0dca: 2a01
+	DBF	D0,LAB_015D		;0dcc: 51c8fffc
+	CMP.L	#$00004918,D4		;0dd0: b8bc00004918
+LAB_015E:
+	BSR.W	LAB_016B		;0dd6: 61000052
+LAB_0160:
+	JSR	-342(A6)		;0dda: 4eaefeaa
+	DBF	D1,LAB_0160		;0dde: 51c9fffa
+LAB_0161:
+	BSR.W	LAB_016B		;0de2: 61000046
+	JSR	-228(A6)		;0de6: 4eaeff1c
+LAB_0162:
+	BNE.S	LAB_0161		;0dea: 66f6
+LAB_0163:
+	JSR	-480(A6)		;0dec: 4eaefe20
+	DBF	D6,LAB_0163		;0df0: 51cefffa
+	BNE.S	LAB_0162		;0df4: 66f4
+sym_2_260:
+	MOVEQ	#4,D4			;0df6: 7804
+	ADDQ.L	#4,A0			;0df8: 5888
+	BSR.W	LAB_0173		;0dfa: 61000088
+LAB_0165:
+	LEA	LAB_0137(PC),A6		;0dfe: 4dfafe50
+LAB_0166:
+	BNE.S	LAB_0165		;0e02: 66fa
+	BNE.S	LAB_0165		;0e04: 66f8
+	BNE.S	LAB_0166		;0e06: 66fa
+LAB_0167:
+	BSR.W	LAB_017A		;0e08: 610000de
+	DBF	D0,LAB_0167		;0e0c: 51c8fffa
+	CMP.L	#$00006bdb,D2		;0e10: b4bc00006bdb
+LAB_0168:
+	CMP.L	#$000041e3,D1		;0e16: b2bc000041e3
+LAB_0169:
+	LEA	LAB_014C+2(PC),A4	;0e1c: 49fafefa
+	DBF	D4,LAB_0169		;0e20: 51ccfffa
+sym_2_273:
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;0e24: 4cdf7cfc
+	RTS				;0e28: 4e75
+LAB_016B:
+	LINK.W	A5,#-76			;0e2a: 4e55ffb4
+	BSR.W	LAB_0173		;0e2e: 61000054
+	TST.L	D2			;0e32: 4a82
+	CMP.L	#$00004406,D3		;0e34: b6bc00004406
+LAB_016C:
+	ADDQ.L	#3,A3			;0e3a: 568b
+	MOVEQ	#-101,D7		;0e3c: 7e9b
+LAB_016D:
+	BSR.W	LAB_0180		;0e3e: 610000da
+	BNE.S	LAB_016C		;0e42: 66f6
+	BSR.W	LAB_017A		;0e44: 610000a2
+LAB_016E:
+	BSR.W	LAB_0173		;0e48: 6100003a
+	DBF	D5,LAB_016E		;0e4c: 51cdfffa
+sym_2_286:
+	MOVE.W	26215(A5),28011(A5)	;0e50: 3b6d66676d6b
+	MOVE.W	588(A5),2120(A5)	;0e56: 3b6d024c0848
+	BSR.W	LAB_0173		;0e5c: 61000026
+LAB_0170:
+	ADDQ.L	#7,A5			;0e60: 5e8d
+	MOVE.W	11096(A5),17422(A5)	;0e62: 3b6d2b58440e
+	MOVE.L	D0,D1			;0e68: 2200
+	BNE.S	LAB_0170		;0e6a: 66f4
+	JSR	-498(A6)		;0e6c: 4eaefe0e
+LAB_0171:
+	MOVEQ	#-14,D6			;0e70: 7cf2
+	DBF	D5,LAB_0171		;0e72: 51cdfffc
+	MOVEQ	#-77,D1			;0e76: 72b3
+	ADD.L	D6,D3			;0e78: d686
+	MOVE.W	4768(A5),12677(A5)	;0e7a: 3b6d12a03185
+sym_2_299:
+	UNLK	A5			;0e80: 4e5d
+	RTS				;0e82: 4e75
+LAB_0173:
+	BSR.W	LAB_017A		;0e84: 61000062
+	JSR	EXT_0000		;0e88: 4eb900000000
+	CMP.L	#$0000d077,D3		;0e8e: b6bc0000d077
+	BNE.S	LAB_0173		;0e94: 66ee
+	ADDQ.L	#6,A7			;0e96: 5c8f
+	MOVE.L	D0,D5			;0e98: 2a00
+LAB_0174:
+	CMPI.L	#$000000e0,D5		;0e9a: 0c85000000e0
+	BNE.S	LAB_0174		;0ea0: 66f8
+	MOVE.L	D3,D2			;0ea2: 2403
+	BRA.S	sym_2_312		;0ea4: 6018
+	DC.W	$434f			;0ea6
+	DC.W	$4e3a			;0ea8
+	MOVE.W	12335(A7),D0		;0eaa: 302f302f
+	MOVE.W	47(A4,D3.W),D3		;0eae: 3634302f
+	MOVE.W	47(A0,D3.W),D1		;0eb2: 3230302f
+	DC.W	$4f75			;0eb6
+	MOVEQ	#112,D2			;0eb8: 7470
+	DC.W	$7574			;0eba
+	DC.W	$0000			;0ebc
+sym_2_312:
+	JSR	EXT_0000		;0ebe: 4eb900000000
+LAB_0176:
+	LEA	LAB_011D+2(PC),A2	;0ec4: 45fafcba
+LAB_0177:
+	DBF	D6,LAB_0176		;0ec8: 51cefffa
+LAB_0178:
+	DBF	D5,LAB_0177		;0ecc: 51cdfffa
+	DBF	D6,LAB_0178		;0ed0: 51cefffa
+LAB_0179:
+	BNE.S	LAB_0177		;0ed4: 66f2
+	DBF	D6,LAB_0179		;0ed6: 51cefffc
+	JSR	EXT_0000		;0eda: 4eb900000000
+	CMP.L	#$00004a22,D2		;0ee0: b4bc00004a22
+	RTS				;0ee6: 4e75
+LAB_017A:
+	BSR.W	LAB_0180		;0ee8: 61000030
+LAB_017B:
+	CMP.L	#$0000df78,D5		;0eec: babc0000df78
+sym_2_325:
+	DBF	D6,LAB_017B		;0ef2: 51cefff8
+LAB_017D:
+	DBF	D2,sym_2_325		;0ef6: 51cafffa
+LAB_017E:
+	DBF	D2,LAB_017D		;0efa: 51cafffa
+	DBF	D0,LAB_017E		;0efe: 51c8fffa
+LAB_017F:
+	BSR.W	LAB_0196		;0f02: 61000118
+	DBF	D1,LAB_017F		;0f06: 51c9fffa
+	BNE.S	LAB_017F		;0f0a: 66f6
+	MOVE.W	18018(A5),28014(A5)	;0f0c: 3b6d46626d6e
+	MOVE.W	30274(A5),8494(A5)	;0f12: 3b6d7642212e
+	RTS				;0f18: 4e75
+LAB_0180:
+	BSR.W	LAB_0187		;0f1a: 61000044
+	MOVE.L	#LAB_00F1,-(A7)		;0f1e: 2f3c00000982
+sym_2_338:
+	LEA	LAB_00F4,A4		;0f24: 49f9000009be
+	LEA	LAB_0134+2(PC),A2	;0f2a: 45fafd1a
+	ADD.L	D0,D1			;0f2e: d280
+	LEA	LAB_0152(PC),A0		;0f30: 41fafe24
+LAB_0182:
+	ADDQ.L	#1,A6			;0f34: 528e
+LAB_0183:
+	DBF	D0,LAB_0182		;0f36: 51c8fffc
+	DBF	D6,LAB_0183		;0f3a: 51cefffa
+LAB_0184:
+	MOVE.W	16896(A5),13956(A5)	;0f3e: 3b6d42003684
+	BNE.S	LAB_0184		;0f44: 66f8
+	JSR	-870(A6)		;0f46: 4eaefc9a
+	LEA	LAB_00EE,A4		;0f4a: 49f9000008f0
+LAB_0185:
+	JSR	-270(A6)		;0f50: 4eaefef2
+	CMP.L	#$00001eb5,D3		;0f54: b6bc00001eb5
+sym_2_351:
+	MOVE.L	D5,D1			;0f5a: 2205
+	BNE.S	LAB_0185		;0f5c: 66f2
+	RTS				;0f5e: 4e75
+LAB_0187:
+	LINK.W	A5,#-192		;0f60: 4e55ff40
+	BSR.W	LAB_0196		;0f64: 610000b6
+	CMP.L	#$00003f14,D2		;0f68: b4bc00003f14
+	BSR.W	LAB_0196		;0f6e: 610000ac
+LAB_0188:
+	MOVE.L	#LAB_00EF,-(A7)		;0f72: 2f3c0000096c
+LAB_0189:
+	MOVE.L	D1,D7			;0f78: 2e01
+LAB_018A:
+	DBF	D4,LAB_0189		;0f7a: 51ccfffc
+	BNE.S	LAB_0188		;0f7e: 66f2
+	ADDQ.L	#1,A1			;0f80: 5289
+	JSR	-666(A6)		;0f82: 4eaefd66
+sym_2_364:
+	BSR.W	LAB_0196		;0f86: 61000094
+	CMP.L	#$0000a32d,D3		;0f8a: b6bc0000a32d
+	CMPI.L	#$00000039,D3		;0f90: 0c8300000039
+	BNE.S	sym_2_364		;0f96: 66ee
+LAB_018C:
+	BSR.W	LAB_01A6		;0f98: 6100011a
+	DBF	D2,LAB_018C		;0f9c: 51cafffa
+	ADD.L	D0,D0			;0fa0: d080
+LAB_018D:
+	CMP.L	#$00005255,D6		;0fa2: bcbc00005255
+	DBF	D1,LAB_018D		;0fa8: 51c9fff8
+	ADDQ.L	#2,A3			;0fac: 548b
+	BNE.S	LAB_018D		;0fae: 66f2
+	CMPI.L	#$000000d1,D1		;0fb0: 0c81000000d1
+	BRA.S	sym_2_377		;0fb6: 600e
+	DC.W	$4f75			;0fb8
+	MOVEQ	#32,D2			;0fba: 7420
+	BLE.S	LAB_0198		;0fbc: 6f66
+	MOVEA.L	25965(A5),A0		;0fbe: 206d656d
+	BLE.S	LAB_0199+4		;0fc2: 6f72
+	DC.W	$7900			;0fc4
+sym_2_377:
+	MOVE.L	D0,D5			;0fc6: 2a00
+	BSR.W	LAB_01AE		;0fc8: 6100013c
+	MOVE.L	D1,D0			;0fcc: 2001
+	LEA	LAB_013C(PC),A2		;0fce: 45fafc94
+LAB_018F:
+	ADDQ.L	#7,A7			;0fd2: 5e8f
+LAB_0190:
+	BNE.S	LAB_018F		;0fd4: 66fc
+LAB_0191:
+	ADD.L	D7,D2			;0fd6: d487
+	DBF	D7,LAB_0191		;0fd8: 51cffffc
+	BNE.S	LAB_0190		;0fdc: 66f6
+	LEA	LAB_0168(PC),A2		;0fde: 45fafe36
+LAB_0192:
+	BSR.W	LAB_0196		;0fe2: 61000038
+	MOVE.L	D1,D6			;0fe6: 2c01
+	BNE.S	LAB_0192		;0fe8: 66f8
+sym_2_390:
+	BSR.W	LAB_0196		;0fea: 61000030
+	MOVE.L	#LAB_00B0,-(A7)		;0fee: 2f3c00000628
+	CMPI.L	#$00000011,D3		;0ff4: 0c8300000011
+	MOVE.L	D1,D4			;0ffa: 2801
+	ADD.L	D5,D7			;0ffc: de85
+LAB_0194:
+	BRA.S	LAB_0195		;0ffe: 600a
+	SUBQ.W	#3,29291(A7)		;1000: 576f726b
+	DC.W	$6265			;1004
+	DC.W	$6e63			;1006
+	DC.W	$6800			;1008
+LAB_0195:
+	DBF	D6,LAB_0194		;100a: 51cefff2
+	CMPI.L	#$000000d5,D6		;100e: 0c86000000d5
+	BSR.W	LAB_01A6		;1014: 6100009e
+	UNLK	A5			;1018: 4e5d
+	RTS				;101a: 4e75
+LAB_0196:
+	BSR.W	LAB_01A6		;101c: 61000096
+sym_2_403:
+	BSR.W	sym_2_481		;1020: 6100012c
+LAB_0198:
+	LEA	LAB_018A+2(PC),A6	;1024: 4dfaff56
+	LEA	LAB_010B+2(PC),A6	;1028: 4dfafa90
+	MOVE.W	26193(A5),25309(A5)	;102c: 3b6d665162dd
+LAB_0199:
+	CMP.L	#$0000306c,D4		;1032: b8bc0000306c
+	BNE.S	LAB_0199		;1038: 66f8
+	MOVE.L	D7,D7			;103a: 2e07
+LAB_019B:
+	MOVE.L	D7,D1			;103c: 2207
+	BNE.S	LAB_019B		;103e: 66fc
+	MOVEQ	#-31,D6			;1040: 7ce1
+	BSR.W	LAB_01A6		;1042: 61000070
+	BSR.W	sym_2_481		;1046: 61000106
+	CMP.L	#$0000fd53,D6		;104a: bcbc0000fd53
+sym_2_416:
+	JSR	EXT_0000		;1050: 4eb900000000
+LAB_019D:
+	BSR.W	LAB_01AE		;1056: 610000ae
+	DBF	D0,LAB_019D		;105a: 51c8fffa
+	CMPI.L	#$0000009b,D7		;105e: 0c870000009b
+	MOVEQ	#-72,D1			;1064: 72b8
+	ADDQ.L	#4,A1			;1066: 5889
+	ADDQ.L	#3,A4			;1068: 568c
+	LEA	LAB_016D,A2		;106a: 45f900000e3e
+	LEA	LAB_00E8,A6		;1070: 4df900000846
+LAB_019E:
+	MOVE.W	12726(A5),22869(A5)	;1076: 3b6d31b65955
+	MOVE.L	D4,D4			;107c: 2804
+	MOVE.L	D0,D2			;107e: 2400
+	BNE.S	LAB_019E		;1080: 66f4
+sym_2_429:
+	MOVE.W	8688(A5),22451(A5)	;1082: 3b6d21f057b3
+	JSR	-582(A6)		;1088: 4eaefdba
+	MOVE.L	D2,D6			;108c: 2c02
+	MOVE.L	30132(A5),D1		;108e: 222d75b4
+	ADD.L	D7,D5			;1092: da87
+LAB_01A0:
+	BSR.W	sym_2_481		;1094: 610000b8
+	JSR	-774(A6)		;1098: 4eaefcfa
+LAB_01A1:
+	BSR.W	sym_2_481		;109c: 610000b0
+	BNE.S	LAB_01A0		;10a0: 66f2
+LAB_01A2:
+	BNE.S	LAB_01A1		;10a2: 66f8
+LAB_01A3:
+	BSR.W	sym_2_481		;10a4: 610000a8
+	DBF	D4,LAB_01A3		;10a8: 51ccfffa
+LAB_01A4:
+	BNE.S	LAB_01A2		;10ac: 66f4
+sym_2_442:
+	DBF	D7,LAB_01A4		;10ae: 51cffffc
+	RTS				;10b2: 4e75
+LAB_01A6:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;10b4: 48e73f3e
+LAB_01A7:
+	BSR.W	LAB_01AE		;10b8: 6100004c
+LAB_01A8:
+	DBF	D3,LAB_01A7		;10bc: 51cbfffa
+	DBF	D7,LAB_01A8		;10c0: 51cffffa
+LAB_01A9:
+	BSR.W	sym_2_481		;10c4: 61000088
+	DBF	D7,LAB_01A9		;10c8: 51cffffa
+	JSR	-828(A6)		;10cc: 4eaefcc4
+LAB_01AA:
+	BSR.W	sym_2_481		;10d0: 6100007c
+	MOVE.L	D2,D0			;10d4: 2002
+	BNE.S	LAB_01AA		;10d6: 66f8
+	ADD.W	D0,D0			;10d8: d040
+	MOVE.W	LAB_01AB(PC,D0.W),D0	;10da: 303b0006
+	JMP	LAB_01AB(PC,D0.W)	;10de: 4efb0002
+LAB_01AB:
+	DC.W	$000c			;10e2
+	ORI.B	#$14,(A0)		;10e4: 00100014
+	ORI.B	#$1c,(A0)+		;10e8: 0018001c
+	DC.W	$0020			;10ec
+sym_2_455:
+	MOVEQ	#0,D0			;10ee: 7000
+	RTS				;10f0: 4e75
+	MOVEQ	#1,D0			;10f2: 7001
+	RTS				;10f4: 4e75
+	MOVEQ	#2,D0			;10f6: 7002
+	RTS				;10f8: 4e75
+	MOVEQ	#3,D0			;10fa: 7003
+	RTS				;10fc: 4e75
+LAB_01AD:
+	MOVEQ	#4,D0			;10fe: 7004
+	RTS				;1100: 4e75
+	MOVEQ	#5,D0			;1102: 7005
+	RTS				;1104: 4e75
+LAB_01AE:
+	MOVEM.L	D2-D7/A2-A6,-(A7)	;1106: 48e73f3e
+	BSR.W	sym_2_481		;110a: 61000042
+	MOVE.L	8168(A5),D6		;110e: 2c2d1fe8
+	CMPI.L	#$00000060,D0		;1112: 0c8000000060
+	JSR	-360(A6)		;1118: 4eaefe98
+LAB_01AF:
+	ADDQ.L	#1,A4			;111c: 528c
+	DBF	D2,LAB_01AF		;111e: 51cafffc
+sym_2_468:
+	JSR	-648(A6)		;1122: 4eaefd78
+	DBF	D3,sym_2_468		;1126: 51cbfffa
+LAB_01B1:
+	ADD.L	D7,D5			;112a: da87
+LAB_01B2:
+	DBF	D4,LAB_01B1		;112c: 51ccfffc
+LAB_01B3:
+	BNE.S	LAB_01B2		;1130: 66fa
+	DBF	D4,LAB_01B3		;1132: 51ccfffc
+	BNE.S	LAB_01B2		;1136: 66f4
+	MOVEQ	#27,D1			;1138: 721b
+	CMP.L	#$000088e9,D1		;113a: b2bc000088e9
+	ADDQ.L	#2,A3			;1140: 548b
+	MOVE.L	#LAB_0083,-(A7)		;1142: 2f3c00000490
+	MOVEM.L	(A7)+,D2-D7/A2-A6	;1148: 4cdf7cfc
+	RTS				;114c: 4e75
+sym_2_481:
+	LINK.W	A5,#-40			;114e: 4e55ffd8
+	BSR.W	LAB_01B7		;1152: 61000044
+	TST.L	D7			;1156: 4a87
+	ADDQ.L	#7,A1			;1158: 5e89
+	BSR.W	LAB_01B7		;115a: 6100003c
+	ADD.W	D0,D0			;115e: d040
+	MOVE.W	LAB_01B5(PC,D0.W),D0	;1160: 303b0006
+	JMP	LAB_01B5(PC,D0.W)	;1164: 4efb0002
+LAB_01B5:
+	ORI.B	#$14,(A0)		;1168: 00100014
+	ORI.B	#$1c,(A0)+		;116c: 0018001c
+	ORI.B	#$24,-(A0)		;1170: 00200024
+	ORI.B	#$2c,28672(A0)		;1174: 0028002c7000
+	RTS				;117a: 4e75
+	MOVEQ	#1,D0			;117c: 7001
+	RTS				;117e: 4e75
+	MOVEQ	#2,D0			;1180: 7002
+	RTS				;1182: 4e75
+	MOVEQ	#3,D0			;1184: 7003
+	RTS				;1186: 4e75
+	MOVEQ	#4,D0			;1188: 7004
+	RTS				;118a: 4e75
+	MOVEQ	#5,D0			;118c: 7005
+	RTS				;118e: 4e75
+	MOVEQ	#6,D0			;1190: 7006
+	RTS				;1192: 4e75
+sym_2_494:
+	MOVEQ	#7,D0			;1194: 7007
+	RTS				;1196: 4e75
+LAB_01B7:
+	NOP				;1198: 4e71
+	NOP				;119a: 4e71
+	NOP				;119c: 4e71
+	NOP				;119e: 4e71
+	NOP				;11a0: 4e71
+	NOP				;11a2: 4e71
+	NOP				;11a4: 4e71
+	NOP				;11a6: 4e71
+	NOP				;11a8: 4e71
+	NOP				;11aa: 4e71
+	NOP				;11ac: 4e71
+	NOP				;11ae: 4e71
+	NOP				;11b0: 4e71
+	NOP				;11b2: 4e71
+	NOP				;11b4: 4e71
+	NOP				;11b6: 4e71
+	NOP				;11b8: 4e71
+	NOP				;11ba: 4e71
+	NOP				;11bc: 4e71
+	NOP				;11be: 4e71
+	NOP				;11c0: 4e71
+	NOP				;11c2: 4e71
+	NOP				;11c4: 4e71
+	NOP				;11c6: 4e71
+	NOP				;11c8: 4e71
+	NOP				;11ca: 4e71
+	NOP				;11cc: 4e71
+	NOP				;11ce: 4e71
+	NOP				;11d0: 4e71
+	NOP				;11d2: 4e71
+	NOP				;11d4: 4e71
+	NOP				;11d6: 4e71
+	NOP				;11d8: 4e71
+	NOP				;11da: 4e71
+	NOP				;11dc: 4e71
+	NOP				;11de: 4e71
+	NOP				;11e0: 4e71
+	NOP				;11e2: 4e71
+	NOP				;11e4: 4e71
+	NOP				;11e6: 4e71
+	NOP				;11e8: 4e71
+	NOP				;11ea: 4e71
+	NOP				;11ec: 4e71
+	NOP				;11ee: 4e71
+	NOP				;11f0: 4e71
+	NOP				;11f2: 4e71
+	NOP				;11f4: 4e71
+	NOP				;11f6: 4e71
+	NOP				;11f8: 4e71
+	NOP				;11fa: 4e71
+	NOP				;11fc: 4e71
+	RTS				;11fe: 4e75
+
+
+	SECTION S_3,BSS
+
+SECSTRT_3:
+	DS.L	128			;1200
+	END
@@ -0,0 +1,200 @@
+#!/bin/sh
+#
+# run.sh
+#
+#  Created on: 17 october 2026
+#      Project  : IRA  -  680x0 Interactive ReAssembler
+#      Part     : test/run.sh
+#      Purpose  : "make test", golden outputs and a performance gate
+#
+# Usage: run.sh <ira> <mkcorpus> [-golden | -baseline]
+#
+# Every case of test/cases reassembles a source of test/corpus, with its
+# config file for -CONFIG. The files IRA writes and its standard output
+# must be those of test/golden/<case>, without the IRA version line and
+# the cache file name.
+# A case with -CACHE=cache runs twice, the second run must find Pass 1 in
+# the cache and write $source.hit.asm the same as $source.asm.
+# -golden writes them anew.
+#
+# Then larger sources are made with mkcorpus and reassembled, as they are
+# and with -PREPROC, three times each, with Pass 2 on one thread (-JOBS=1)
+# whatever the number of CPUs. Their CPU time is taken relative to that of
+# mkcorpus writing a 64 MB binary, their peak RSS as KB over that of IRA
+# for test/corpus/exe1 per MB of source, both references measured here, so
+# that the numbers hold from one machine to another. The CPU ratio of the
+# fastest runs, summed, and the largest RSS per MB must not exceed
+# test/baseline by more than IRA_TEST_CPU (25) and IRA_TEST_RSS (10)
+# percent. -baseline writes that file anew.
+#
+# The corpus was made by bench/mkcorpus:
+#     mkcorpus -seed 11 -hunks 3 -size 2048 -bss 2048 -symbols -jmptabs 10 -strings 8 -cnf exe1.cnf exe1
+#     mkcorpus -seed 12 -hunks 7 -size 1024 -relocs 15 -jmptabs 6 -cnf exe2.cnf exe2
+#     mkcorpus -object -seed 13 -hunks 3 -size 2048 -bss 512 -symbols -cnf obj1.cnf obj1
+#     mkcorpus -binary -seed 14 -hunks 3 -size 2048 -relocs 8 -cnf bin1.cnf bin1
+#     mkcorpus -binary -seed 15 -size 4096 -strings 10 bin2
+
+IRA=$1
+MKCORPUS=$2
+MODE=${3:-check}
+
+if [ ! -x "$IRA" ] || [ ! -x "$MKCORPUS" ]; then
+    echo "Usage: run.sh <ira> <mkcorpus> [-golden | -baseline]" >&2
+    exit 1
+fi
+case $IRA in /*) ;; *) IRA=$(pwd)/$IRA ;; esac
+case $MKCORPUS in /*) ;; *) MKCORPUS=$(pwd)/$MKCORPUS ;; esac
+TEST=$(cd "$(dirname "$0")" && pwd)
+
+DIR=$(mktemp -d "${TMPDIR:-/tmp}/iratest.XXXXXX") || exit 1
+trap 'rm -rf "$DIR"' EXIT INT TERM
+failed=0
+
+# Golden outputs
+if [ "$MODE" != -baseline ]; then
+    while read -r name source options; do
+        case $name in '' | '#'*) continue ;; esac
+        mkdir "$DIR/$name"
+        cp "$TEST/corpus/$source" "$DIR/$name/"
+        case " $options " in *" -CONFIG "*) cp "$TEST/corpus/$source.cnf" "$DIR/$name/" ;; esac
+        case " $options " in *" -CACHE=cache "*) mkdir "$DIR/$name/cache" ;; esac
+        (cd "$DIR/$name" && "$IRA" $options "$source" "$source.asm" >stdout 2>/dev/null </dev/null; echo "exit $?" >>stdout)
+        case " $options " in *" -CACHE=cache "*)
+            (cd "$DIR/$name" && "$IRA" $options "$source" "$source.hit.asm" >stdout.hit 2>/dev/null </dev/null; echo "exit $?" >>stdout.hit)
+            if ! cmp -s "$DIR/$name/$source.asm" "$DIR/$name/$source.hit.asm"; then
+                echo "$name: output differs on a cache hit" >&2
+                failed=1
+            fi
+            # named after a hash of the IRA build
+            rm -rf "$DIR/$name/cache"
+            ;;
+        esac
+        rm -f "$DIR/$name/$source"
+        case " $options " in *" -CONFIG "*) rm -f "$DIR/$name/$source.cnf" ;; esac
+        for file in "$DIR/$name"/*; do
+            sed -e '/^; IRA V[0-9]*\.[0-9]* (/d' -e 's|"cache/[0-9a-f]*\.irc"|"cache/KEY.irc"|' "$file" >"$DIR/filtered" && mv "$DIR/filtered" "$file"
+        done
+
+        if [ "$MODE" = -golden ]; then
+            rm -rf "$TEST/golden/$name"
+            mkdir -p "$TEST/golden"
+            cp -R "$DIR/$name" "$TEST/golden/$name"
+        elif ! diff -r "$TEST/golden/$name" "$DIR/$name" >"$DIR/diff" 2>&1; then
+            echo "$name: output differs" >&2
+            head -n 20 "$DIR/diff" >&2
+            failed=1
+        fi
+        rm -rf "$DIR/$name"
+    done <"$TEST/cases"
+    [ "$MODE" = -golden ] && exit 0
+fi
+
+# Performance gate
+cd "$DIR" || exit 1
+"$MKCORPUS" -seed 21 -hunks 6 -size 1048576 -relocs 15 -symbols perf1 || exit 1
+"$MKCORPUS" -seed 22 -binary -size 4194304 -strings 10 perf2 || exit 1
+cp "$TEST/corpus/exe1" small
+jobs=0
+for job in "perf1" "perf1 -PREPROC" "perf2 -BINARY" "perf2 -BINARY -PREPROC"; do
+    jobs=$((jobs + 1))
+    run=0
+    while [ $run -lt 3 ]; do
+        rm -f perf1.cnf perf2.cnf
+        set -- $job
+        source=$1
+        shift
+        "$IRA" "$@" -JOBS=1 -STATS=JSON "$source" "$source.asm" 2>/dev/null | grep '^{' >>"stats.$jobs"
+        run=$((run + 1))
+    done
+done
+# the references: user and system time of the child, peak RSS of IRA
+run=0
+while [ $run -lt 3 ]; do
+    ("$MKCORPUS" -seed 23 -binary -size 67108864 -relocs 15 -strings 10 /dev/null; times) | tail -n 1 >>reference.cpu
+    "$IRA" -JOBS=1 -STATS=JSON small small.asm 2>/dev/null | grep '^{' >>reference.rss
+    run=$((run + 1))
+done
+# fastest of the three runs of each job, summed, against the fastest
+# reference, and the largest RSS over the smallest reference RSS per MB
+awk -v size1="$(wc -c <perf1)" -v size2="$(wc -c <perf2)" '
+    FILENAME == "reference.cpu" {
+        cpu = 0
+        for (i = 1; i <= NF; i++) {
+            split($i, time, "m")
+            cpu += (time[1] * 60 + time[2]) * 1000
+        }
+        if (!refCpu || cpu < refCpu)
+            refCpu = cpu
+        next
+    }
+    match($0, /"peak_rss_kb": [0-9]+/) {
+        kb = substr($0, RSTART + 15, RLENGTH - 15) + 0
+        if (FILENAME == "reference.rss") {
+            if (!refRss || kb < refRss)
+                refRss = kb
+            next
+        }
+        if (kb > rss[FILENAME])
+            rss[FILENAME] = kb
+    }
+    {
+        n = split($0, field, "\"cpu_ms\": ")
+        cpu = 0
+        for (i = 2; i <= n; i++)
+            cpu += field[i] + 0
+        if (!(FILENAME in best) || cpu < best[FILENAME])
+            best[FILENAME] = cpu
+        runs++
+    }
+    END {
+        for (job in best) {
+            total += best[job]
+            perMb = (rss[job] - refRss) * 1048576 / (job ~ /[12]$/ ? size1 : size2)
+            if (perMb > maxPerMb) {
+                maxPerMb = perMb
+                peak = rss[job]
+            }
+        }
+        if (runs != 12 || refCpu <= 0 || refRss <= 0)
+            exit 1
+        printf "cpu_ratio %.3f\nrss_kb_per_mb %.1f\n", total / refCpu, maxPerMb
+        printf "# %.1f ms against %.1f ms, %d KB against %d KB\n", total, refCpu, peak, refRss
+    }' reference.cpu reference.rss stats.* >measured || {
+    echo "performance runs failed" >&2
+    exit 1
+}
+
+if [ "$MODE" = -baseline ]; then
+    {
+        echo "# CPU time of the performance runs of run.sh relative to mkcorpus,"
+        echo "# their peak RSS over that for a small source per MB, see there"
+        grep -v '^#' measured
+    } >"$TEST/baseline"
+    cat measured
+    exit 0
+fi
+
+if [ ! -f "$TEST/baseline" ]; then
+    echo "No baseline, performance not checked." >&2
+else
+    awk -v cpuLimit="${IRA_TEST_CPU:-25}" -v rssLimit="${IRA_TEST_RSS:-10}" '
+        FNR == NR { if ($1 !~ /^#/) base[$1] = $2; next }
+        /^#/ { detail = $0; next }
+        { now[$1] = $2 }
+        END {
+            printf "CPU ratio %.3f (baseline %.3f), peak RSS %.1f KB per MB (baseline %.1f)\n", now["cpu_ratio"], base["cpu_ratio"], now["rss_kb_per_mb"], base["rss_kb_per_mb"]
+            print detail
+            if (now["cpu_ratio"] > base["cpu_ratio"] * (1 + cpuLimit / 100)) {
+                printf "CPU time more than %d%% over the baseline\n", cpuLimit
+                failed = 1
+            }
+            if (now["rss_kb_per_mb"] > base["rss_kb_per_mb"] * (1 + rssLimit / 100)) {
+                printf "peak RSS more than %d%% over the baseline\n", rssLimit
+                failed = 1
+            }
+            exit failed
+        }' "$TEST/baseline" measured || failed=1
+fi
+
+[ $failed = 0 ] && echo "All tests passed."
+exit $failed